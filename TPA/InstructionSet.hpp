@@ -19,6 +19,7 @@
 #include <bitset>
 #include <array>
 #include <string>
+#include <cstring>
 #include <thread>
 
 #ifdef  _MSC_VER 
@@ -53,6 +54,49 @@ namespace tpa_cpuid_private {
 
 #if defined(TPA_X86_64)        
         
+#pragma region Identification
+        /// <summary>
+        /// <para>Returns true if the CPU vendor is Intel</para>
+        /// </summary>
+        /// <param name=""></param>
+        /// <returns></returns>
+        bool IsIntel(void) const noexcept { return isIntel_; }
+
+        /// <summary>
+        /// <para>Returns true if the CPU vendor is AMD</para>
+        /// </summary>
+        /// <param name=""></param>
+        /// <returns></returns>
+        bool IsAMD(void) const noexcept { return isAMD_; }
+
+        /// <summary>
+        /// <para>Returns the display family of the CPU (base family + extended family)</para>
+        /// <para>e.g. 0x06 for Intel Core/Xeon, 0x19 for AMD Zen 3/Zen 4</para>
+        /// </summary>
+        /// <param name=""></param>
+        /// <returns></returns>
+        uint32_t Family(void) const noexcept
+        {
+            const uint32_t family = (signature_ >> 8u) & 0xFu;
+
+            return (family == 0xFu) ? family + ((signature_ >> 20u) & 0xFFu) : family;
+        }//End of Family
+
+        /// <summary>
+        /// <para>Returns the display model of the CPU (base model + extended model)</para>
+        /// <para>e.g. 0x55 for Intel Skylake-SP/Cascade Lake, 0x6A for Intel Ice Lake-SP</para>
+        /// </summary>
+        /// <param name=""></param>
+        /// <returns></returns>
+        uint32_t Model(void) const noexcept
+        {
+            const uint32_t family = (signature_ >> 8u) & 0xFu;
+            const uint32_t model = (signature_ >> 4u) & 0xFu;
+
+            return (family == 0x6u || family == 0xFu) ? model + (((signature_ >> 16u) & 0xFu) << 4u) : model;
+        }//End of Model
+#pragma endregion
+
 #pragma region SIMD
         /// <summary>
         /// <para>CPU has Multi-Media eXtentions instructions if returns true</para>
@@ -296,7 +340,7 @@ namespace tpa_cpuid_private {
         /// </summary>
         /// <param name=""></param>
         /// <returns></returns>
-        bool VPOPCNTDQ(void) const noexcept { return f_7_EBX_[32]; }
+        bool VPOPCNTDQ(void) const noexcept { return f_7_ECX_[14]; }
 
         /// <summary>
         /// <para>CPU has Advanced Vector eXtentions 512-Bit Bit Algorithms Instructions if returns true</para>
@@ -810,6 +854,7 @@ namespace tpa_cpuid_private {
         int32_t nExIds_ = 0;
         bool isIntel_ = false;
         bool isAMD_ = false;
+        uint32_t signature_ = 0u;
         std::bitset<32> f_1_ECX_;
         std::bitset<32> f_1_EDX_;
         std::bitset<32> f_7_EBX_;
@@ -829,6 +874,7 @@ namespace tpa_cpuid_private {
                 nExIds_{ 0 },
                 isIntel_{ false },
                 isAMD_{ false },
+                signature_{ 0u },
                 f_1_ECX_{ 0 },
                 f_1_EDX_{ 0 },
                 f_7_EBX_{ 0 },
@@ -867,6 +913,7 @@ namespace tpa_cpuid_private {
             // load bitset with flags for function 0x00000001
             if (nIds_ >= 1)
             {
+                signature_ = static_cast<uint32_t>(data_[1][0]);
                 f_1_ECX_ = data_[1][2];
                 f_1_EDX_ = data_[1][3];
             }//End if
@@ -939,39 +986,47 @@ public:
 }//End of namespace
 
 namespace tpa{
-static const tpa_cpuid_private::InstructionSet runtime_instruction_set;
+inline const tpa_cpuid_private::InstructionSet runtime_instruction_set;//Probed once per program, shared by every translation unit
 
 #if defined(TPA_X86_64)
-static const bool hasMMX = runtime_instruction_set.MMX();//Automatically set to true if system has MMX at runtime - note that MMX intrinsics should be avoided as Intel has deprecated them and down-clocked them severely in order to cripple thier performance to encourage the use of SSE or better!
-
-static const bool has_SSE = runtime_instruction_set.SSE();//Automatically set to true if system has SSE at runtime
-static const bool has_SSE2 = runtime_instruction_set.SSE2();//Automatically set to true if system has SSE2 at runtime
-static const bool has_SSE3 = runtime_instruction_set.SSE3();//Automatically set to true if system has SSE3 at runtime
-static const bool has_SSSE3 = runtime_instruction_set.SSSE3();//Automatically set to true if system has SSSE3 at runtime
-static const bool has_SSE41 = runtime_instruction_set.SSE41();//Automatically set to true if system has SSE4.1 at runtime
-static const bool has_SSE42 = runtime_instruction_set.SSE42();//Automatically set to true if system has SSE4.2 at runtime
-
-static const bool hasAVX = runtime_instruction_set.AVX();//Automatically set to true if system has AVX at runtime
-static const bool hasAVX2 = runtime_instruction_set.AVX2();//Automatically set to true if system has AVX2 at runtime
-static const bool hasFMA = runtime_instruction_set.FMA();//Automatically set to true if system has FMA at runtime
-static const bool hasAVX512 = runtime_instruction_set.AVX512F();//Automatically set to true if system has AVX512 (foundation) at runtime
-static const bool hasAVX512_ByteWord = runtime_instruction_set.AVX512BW();//Automatically set to true if system has AVX512 Byte & Word Instructions at runtime
-static const bool hasAVX512_DWQW = runtime_instruction_set.AVX512DQ();//Automatically set to true if system has AVX512 Double-Word and Quad-Word Instructions at runtime
-
-static const bool hasBMI1 = runtime_instruction_set.BMI1();//Automatically set to true if system has BMI1 Instructions at runtime
-static const bool hasBMI2 = runtime_instruction_set.BMI2();//Automatically set to true if system has BMI2 Instructions at runtime
-static const bool hasPOPCNT = runtime_instruction_set.POPCNT();//Automatically set to true if system has POP COUNT Instructions at runtime
-static const bool hasLZCNT = runtime_instruction_set.LZCNT();//Automatically set to true if system has Leading Zero Count Instructions at runtime
-static const bool hasABM = runtime_instruction_set.ABM();//Automatically set to true if system has ABM Instructions at runtime
-
-static const bool hasRD_RAND = runtime_instruction_set.RDRAND() && runtime_instruction_set.RDSEED();//Automatically set to true if system has Random Number Instructions at runtime
+inline const bool hasMMX = runtime_instruction_set.MMX();//Automatically set to true if system has MMX at runtime - note that MMX intrinsics should be avoided as Intel has deprecated them and down-clocked them severely in order to cripple thier performance to encourage the use of SSE or better!
+
+inline const bool has_SSE = runtime_instruction_set.SSE();//Automatically set to true if system has SSE at runtime
+inline const bool has_SSE2 = runtime_instruction_set.SSE2();//Automatically set to true if system has SSE2 at runtime
+inline const bool has_SSE3 = runtime_instruction_set.SSE3();//Automatically set to true if system has SSE3 at runtime
+inline const bool has_SSSE3 = runtime_instruction_set.SSSE3();//Automatically set to true if system has SSSE3 at runtime
+inline const bool has_SSE41 = runtime_instruction_set.SSE41();//Automatically set to true if system has SSE4.1 at runtime
+inline const bool has_SSE42 = runtime_instruction_set.SSE42();//Automatically set to true if system has SSE4.2 at runtime
+
+inline const bool hasAVX = runtime_instruction_set.AVX();//Automatically set to true if system has AVX at runtime
+inline const bool hasAVX2 = runtime_instruction_set.AVX2();//Automatically set to true if system has AVX2 at runtime
+inline const bool hasFMA = runtime_instruction_set.FMA();//Automatically set to true if system has FMA at runtime
+inline const bool hasAVX512 = runtime_instruction_set.AVX512F();//Automatically set to true if system has AVX512 (foundation) at runtime
+inline const bool hasAVX512_ByteWord = runtime_instruction_set.AVX512BW();//Automatically set to true if system has AVX512 Byte & Word Instructions at runtime
+inline const bool hasAVX512_DWQW = runtime_instruction_set.AVX512DQ();//Automatically set to true if system has AVX512 Double-Word and Quad-Word Instructions at runtime
+inline const bool hasAVX512_VL = runtime_instruction_set.AVX512VL();//Automatically set to true if system has AVX512 Vector Length Extensions at runtime
+inline const bool hasAVX512_CD = runtime_instruction_set.AVX512CD();//Automatically set to true if system has AVX512 Conflict Detection Instructions at runtime
+inline const bool hasAVX512_VBMI = runtime_instruction_set.VBMI();//Automatically set to true if system has AVX512 Vector Byte Manipulation Instructions at runtime
+inline const bool hasAVX512_VBMI2 = runtime_instruction_set.VBMI2();//Automatically set to true if system has AVX512 Vector Byte Manipulation 2 Instructions (8/16-bit compress & expand) at runtime
+inline const bool hasAVX512_VNNI = runtime_instruction_set.VNNI();//Automatically set to true if system has AVX512 Vector Neural Network Instructions at runtime
+inline const bool hasAVX512_BITALG = runtime_instruction_set.BITALG();//Automatically set to true if system has AVX512 Bit Algorithms (8/16-bit population count) at runtime
+inline const bool hasAVX512_VPOPCNTDQ = runtime_instruction_set.VPOPCNTDQ();//Automatically set to true if system has AVX512 32/64-bit population count at runtime
+inline const bool hasGFNI = runtime_instruction_set.GFNI();//Automatically set to true if system has Galois Field New Instructions at runtime
+
+inline const bool hasBMI1 = runtime_instruction_set.BMI1();//Automatically set to true if system has BMI1 Instructions at runtime
+inline const bool hasBMI2 = runtime_instruction_set.BMI2();//Automatically set to true if system has BMI2 Instructions at runtime
+inline const bool hasPOPCNT = runtime_instruction_set.POPCNT();//Automatically set to true if system has POP COUNT Instructions at runtime
+inline const bool hasLZCNT = runtime_instruction_set.LZCNT();//Automatically set to true if system has Leading Zero Count Instructions at runtime
+inline const bool hasABM = runtime_instruction_set.ABM();//Automatically set to true if system has ABM Instructions at runtime
+
+inline const bool hasRD_RAND = runtime_instruction_set.RDRAND() && runtime_instruction_set.RDSEED();//Automatically set to true if system has Random Number Instructions at runtime
 
 #elif defined(TPA_ARM)
     
-static const bool hasNeon = runtime_instruction_set.NEON(); // Automatically set to true if system has NEON Instructions at compile time (required for TPA on ARM)
-static const bool has_SVE = runtime_instruction_set.SVE(); // Automatically set to true if system has SVE Instructions at compile time (required for TPA on ARM)
-static const bool has_SVE2 = runtime_instruction_set.SVE2(); // Automatically set to true if system has SVE2 Instructions at compile time (required for TPA on ARM)
-static const bool hasHelium = runtime_instruction_set.HELIUM(); // Automatically set to true if system has HELIUM Instructions at compile time (required for TPA on ARM)
+inline const bool hasNeon = runtime_instruction_set.NEON(); // Automatically set to true if system has NEON Instructions at compile time (required for TPA on ARM)
+inline const bool has_SVE = runtime_instruction_set.SVE(); // Automatically set to true if system has SVE Instructions at compile time (required for TPA on ARM)
+inline const bool has_SVE2 = runtime_instruction_set.SVE2(); // Automatically set to true if system has SVE2 Instructions at compile time (required for TPA on ARM)
+inline const bool hasHelium = runtime_instruction_set.HELIUM(); // Automatically set to true if system has HELIUM Instructions at compile time (required for TPA on ARM)
 #endif
 
 }//End of namespace
\ No newline at end of file
@@ -163,11 +163,11 @@ namespace tpa_thread_pool_private {
 
 			//Clean up existing AVX Registar Data
 #ifdef TPA_X86_64
-			if (tpa::hasAVX || tpa::hasAVX512)
+			if (tpa::hasAVX || tpa::hasAVX512) [&]() TPA_TARGET("avx")
 			{
 				//Clean Up Registers
 				_mm256_zeroall();
-			}//End else
+			}();//End else
 #endif
 		};//End of constructor
 
@@ -191,11 +191,11 @@ namespace tpa_thread_pool_private {
 
 			//Clean up AVX Registar Data
 #ifdef TPA_X86_64
-			if (tpa::hasAVX || tpa::hasAVX512)
+			if (tpa::hasAVX || tpa::hasAVX512) [&]() TPA_TARGET("avx")
 			{
 				//Clean Up Registers
 				_mm256_zeroall();
-			}//End else
+			}();//End else
 #endif
 		}//End of destructor
 	public:
@@ -226,7 +226,6 @@ namespace tpa_thread_pool_private {
 		std::mutex taskMTX;							//Mutex to lock 'tasks' queue
 
 		//Wake Conditon
-		std::mutex wakeMutex;
 		std::condition_variable wakeCond;
 		std::atomic<bool> morePossibleWork = true;
 
@@ -270,8 +269,9 @@ namespace tpa_thread_pool_private {
 			while (morePossibleWork)
 			{
 				{
-					std::unique_lock<std::mutex> lk(wakeMutex);
-					wakeCond.wait(lk);
+					//Tasks are queued under taskMTX, waiting on it with a predicate cannot miss a wake-up sent before this thread was waiting
+					std::unique_lock<std::mutex> lk(taskMTX);
+					wakeCond.wait(lk, [this] { return !tasks.empty() || !morePossibleWork; });
 				}//End lock
 
 				while (!tasks.empty())
@@ -317,18 +317,21 @@ namespace tpa_thread_pool_private {
 
 			//Clean up existing AVX Registar Data
 #ifdef TPA_X86_64
-			if (tpa::hasAVX || tpa::hasAVX512)
+			if (tpa::hasAVX || tpa::hasAVX512) [&]() TPA_TARGET("avx")
 			{
 				//Clean Up Registers
 				_mm256_zeroall();
-			}//End else
+			}();//End else
 #endif
 		};//End of constructor
 
 	public:
 		~ThreadPool()
 		{
-			morePossibleWork = false;
+			{
+				std::scoped_lock<std::mutex> lk(taskMTX);
+				morePossibleWork = false;
+			}//End lock
 			wakeCond.notify_all();
 
 			for (auto& t : threads)
@@ -340,11 +343,11 @@ namespace tpa_thread_pool_private {
 
 			//Clean up AVX Registar Data
 #ifdef TPA_X86_64
-			if (tpa::hasAVX || tpa::hasAVX512)
+			if (tpa::hasAVX || tpa::hasAVX512) [&]() TPA_TARGET("avx")
 			{
 				//Clean Up Registers
 				_mm256_zeroall();
-			}//End else
+			}();//End else
 #endif
 		}//End of destructor
 
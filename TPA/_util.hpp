@@ -26,6 +26,9 @@
 #include <bitset>
 #include <bit>
 #include <array>
+#include <limits>
+#include <cmath>
+#include <cstring>
 
 #include "ThreadPool.hpp"
 #include "excepts.hpp"
@@ -112,6 +115,73 @@ namespace tpa::util
 #endif
 	}//End of max
 
+	/// <summary>
+	/// <para>Saturating addition, clamps the result to the range of T instead of wrapping around.</para>
+	/// <para>Floating-point types are added normally (they already saturate to infinity).</para>
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>T</returns>
+	template<typename T>
+	[[nodiscard]] inline constexpr T add_sat(const T a, const T b) noexcept
+	{
+		if constexpr (std::is_floating_point<T>())
+		{
+			return a + b;
+		}//End if
+		else if constexpr (std::is_unsigned<T>())
+		{
+			const T sum = static_cast<T>(a + b);
+			return (sum < a) ? std::numeric_limits<T>::max() : sum;
+		}//End if
+		else
+		{
+			if (b > 0 && a > static_cast<T>(std::numeric_limits<T>::max() - b))
+			{
+				return std::numeric_limits<T>::max();
+			}//End if
+			if (b < 0 && a < static_cast<T>(std::numeric_limits<T>::min() - b))
+			{
+				return std::numeric_limits<T>::min();
+			}//End if
+			return static_cast<T>(a + b);
+		}//End else
+	}//End of add_sat
+
+	/// <summary>
+	/// <para>Saturating subtraction, clamps the result to the range of T instead of wrapping around.</para>
+	/// <para>Floating-point types are subtracted normally (they already saturate to infinity).</para>
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>T</returns>
+	template<typename T>
+	[[nodiscard]] inline constexpr T sub_sat(const T a, const T b) noexcept
+	{
+		if constexpr (std::is_floating_point<T>())
+		{
+			return a - b;
+		}//End if
+		else if constexpr (std::is_unsigned<T>())
+		{
+			return (b > a) ? static_cast<T>(0) : static_cast<T>(a - b);
+		}//End if
+		else
+		{
+			if (b < 0 && a > static_cast<T>(std::numeric_limits<T>::max() + b))
+			{
+				return std::numeric_limits<T>::max();
+			}//End if
+			if (b > 0 && a < static_cast<T>(std::numeric_limits<T>::min() + b))
+			{
+				return std::numeric_limits<T>::min();
+			}//End if
+			return static_cast<T>(a - b);
+		}//End else
+	}//End of sub_sat
+
 	/// <summary>
 	/// <para>Calculate powers</para>
 	/// </summary>
@@ -524,7 +594,7 @@ namespace tpa::util
 	{
 		if constexpr (std::is_same<T, float>())
 		{
-#ifdef TPA_X86_64
+#if defined(TPA_X86_64) && defined(TPA_HAS_SVML)
 			if (inaccurateOptimization && tpa::has_SSE)
 			{				
 				__m128 _num = _mm_set1_ps(num);
@@ -541,13 +611,13 @@ namespace tpa::util
 			{
 #endif
 				return static_cast<T>(1.0f / std::sqrt(num));
-#ifdef TPA_X86_64
+#if defined(TPA_X86_64) && defined(TPA_HAS_SVML)
 			}//End if
 #endif
 		}//End if
 		else if constexpr (std::is_same<T, double>())
 		{
-#ifdef TPA_X86_64
+#if defined(TPA_X86_64) && defined(TPA_HAS_SVML)
 			if (inaccurateOptimization && tpa::has_SSE2)
 			{
 				__m128d _num = _mm_set1_pd(num);
@@ -564,7 +634,7 @@ namespace tpa::util
 			{
 #endif
 				return static_cast<T>(1.0 / std::sqrt(num));
-#ifdef TPA_X86_64
+#if defined(TPA_X86_64) && defined(TPA_HAS_SVML)
 			}//End if
 #endif
 		}//End if		
@@ -587,7 +657,7 @@ namespace tpa::util
 	{
 		if constexpr (std::is_same<T, float>())
 		{
-#ifdef TPA_X86_64
+#if defined(TPA_X86_64) && defined(TPA_HAS_SVML)
 			if (inaccurateOptimization && tpa::has_SSE)
 			{
 				__m128 _num = _mm_set1_ps(num);
@@ -604,13 +674,13 @@ namespace tpa::util
 			{
 #endif
 				return static_cast<T>(std::cbrt(num));
-#ifdef TPA_X86_64
+#if defined(TPA_X86_64) && defined(TPA_HAS_SVML)
 			}//End if
 #endif
 		}//End if
 		else if constexpr (std::is_same<T, double>())
 		{
-#ifdef TPA_X86_64
+#if defined(TPA_X86_64) && defined(TPA_HAS_SVML)
 			if (inaccurateOptimization && tpa::has_SSE2)
 			{
 				__m128d _num = _mm_set1_pd(num);
@@ -627,7 +697,7 @@ namespace tpa::util
 			{
 #endif
 				return static_cast<T>(std::cbrt(num));
-#ifdef TPA_X86_64
+#if defined(TPA_X86_64) && defined(TPA_HAS_SVML)
 			}//End if
 #endif
 		}//End if		
@@ -650,7 +720,7 @@ namespace tpa::util
 	{
 		if constexpr (std::is_same<T, float>())
 		{
-#ifdef TPA_X86_64
+#if defined(TPA_X86_64) && defined(TPA_HAS_SVML)
 			if (inaccurateOptimization && tpa::has_SSE)
 			{
 				__m128 _num = _mm_set1_ps(num);
@@ -667,13 +737,13 @@ namespace tpa::util
 			{
 #endif
 				return static_cast<T>(1.0f / std::cbrt(num));
-#ifdef TPA_X86_64
+#if defined(TPA_X86_64) && defined(TPA_HAS_SVML)
 			}//End if
 #endif
 		}//End if
 		else if constexpr (std::is_same<T, double>())
 		{
-#ifdef TPA_X86_64
+#if defined(TPA_X86_64) && defined(TPA_HAS_SVML)
 			if (inaccurateOptimization && tpa::has_SSE2)
 			{
 				__m128d _num = _mm_set1_pd(num);
@@ -690,7 +760,7 @@ namespace tpa::util
 			{
 #endif
 				return static_cast<T>(1.0 / std::cbrt(num));
-#ifdef TPA_X86_64
+#if defined(TPA_X86_64) && defined(TPA_HAS_SVML)
 			}//End if
 #endif
 		}//End if		
@@ -703,7 +773,9 @@ namespace tpa::util
 
 
 	/// <summary>
-	/// Creates a vector of pairs(size_t,size_t) to serve as a list of sections, 1 section for each thread
+	/// <para>Creates a vector of pairs(size_t,size_t) to serve as a list of sections, 1 section for each thread</para>
+	/// <para>When every section holds at least 1024 elements the boundaries between sections are rounded down to a multiple of 64 elements,</para>
+	/// <para>so for a container aligned to 64 bytes every section starts on a 64-byte boundary whatever the value_type.</para>
 	/// </summary>
 	inline void prepareThreading(std::vector<std::pair<size_t,size_t>>& sections, const size_t arr_size)
 	{
@@ -722,10 +794,13 @@ namespace tpa::util
 			size_t EndOff = 0uz;
 			size_t i = 0uz;
 
+			//64 elements of any type is a multiple of 64 bytes
+			const size_t granule = ((arr_size / tpa::nThreads) >= 1024uz) ? 64uz : 1uz;
+
 			for (; i != tpa::nThreads; ++i)
 			{
-				StartOff = static_cast<size_t>(i * arr_size / tpa::nThreads);
-				EndOff = static_cast<size_t>((i + 1uz) * arr_size / tpa::nThreads);
+				StartOff = EndOff;
+				EndOff = (i + 1uz == tpa::nThreads) ? arr_size : static_cast<size_t>((i + 1uz) * arr_size / tpa::nThreads) / granule * granule;
 				sections[i] = {StartOff, EndOff};
 			}//End for
 		}//End try
@@ -745,4 +820,57 @@ namespace tpa::util
 			std::cerr << "Exception thrown in tpa::util::prepareThreading: unknown!\n";
 		}//End catch
 	}//End of prepareThreading
+
+	/// <summary>
+	/// <para>Creates a list of ranges for each thread, tiles[t] holds the [first, second) ranges which thread 't' processes in order.</para>
+	/// <para>Tiles of 'tile' elements are dealt out round-robin so that the threads walk neighbouring tiles together, used by tpa::exec::BLOCKED.</para>
+	/// <para>If 'tile' is 0 each thread gets the single section from prepareThreading (tpa::exec::LINEAR).</para>
+	/// </summary>
+	inline void prepareTiling(std::vector<std::vector<std::pair<size_t, size_t>>>& tiles, const size_t arr_size, const size_t tile)
+	{
+		try
+		{
+			tiles.assign(tpa::nThreads, {});
+
+			if (tile == 0uz)
+			{
+				std::vector<std::pair<size_t, size_t>> sections;
+				prepareThreading(sections, arr_size);
+
+				for (size_t t = 0uz; t != tpa::nThreads; ++t)
+				{
+					tiles[t].emplace_back(sections[t]);
+				}//End for
+
+				return;
+			}//End if
+
+			const size_t count = (arr_size + tile - 1uz) / tile;
+
+			for (auto& t : tiles)
+			{
+				t.reserve((count / tpa::nThreads) + 1uz);
+			}//End for
+
+			for (size_t k = 0uz; k != count; ++k)
+			{
+				tiles[k % tpa::nThreads].emplace_back(k * tile, tpa::util::min(arr_size, (k + 1uz) * tile));
+			}//End for
+		}//End try
+		catch (const std::bad_alloc& ex)
+		{
+			std::scoped_lock<std::mutex> lock(consoleMtx);
+			std::cerr << "Exception thrown in tpa::util::prepareTiling: " << ex.what() << "\n";
+		}//End catch
+		catch (const std::exception& ex)
+		{
+			std::scoped_lock<std::mutex> lock(consoleMtx);
+			std::cerr << "Exception thrown in tpa::util::prepareTiling: " << ex.what() << "\n";
+		}//End catch
+		catch (...)
+		{
+			std::scoped_lock<std::mutex> lock(consoleMtx);
+			std::cerr << "Exception thrown in tpa::util::prepareTiling: unknown!\n";
+		}//End catch
+	}//End of prepareTiling
 }//End of namespace
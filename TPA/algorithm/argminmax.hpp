@@ -0,0 +1,398 @@
+#pragma once
+/*
+*	Truly Parallel Algorithms Library - Algorithm - argmin and argmax functions
+*	By: David Aaron Braun
+*	2022-08-17
+*/
+
+/*
+*           Copyright David Aaron Braun 2021 - .
+*   Distributed under the Boost Software License, Version 1.0.
+*       (See accompanying file LICENSE_1_0.txt or copy at
+*           https://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include <utility>
+#include <mutex>
+#include <future>
+#include <iostream>
+#include <functional>
+#include <limits>
+
+#include <array>
+#include <vector>
+
+#include "../_util.hpp"
+#include "../ThreadPool.hpp"
+#include "../excepts.hpp"
+#include "../size_t_lit.hpp"
+#include "../tpa_macros.hpp"
+#include "../predicates.hpp"
+#include "../tpa_concepts.hpp"
+#include "../InstructionSet.hpp"
+#include "../simd/simd.hpp"
+#include "../simd/vec.hpp"
+#include "../simd/dispatch.hpp"
+
+/// <summary>
+/// <para>Private Namespace for the TPA argmin and argmax kernels.</para>
+/// <para>Each kernel folds [beg, end) into the best value and its index, MAX = false for argmin and true for argmax.</para>
+/// <para>Ties are won by the leftmost element, as with std::min_element and std::max_element.</para>
+/// </summary>
+namespace tpa_argminmax_private
+{
+    /// <summary>
+    /// <para>The unsigned integer with the same size as T, the lane type of the index vectors.</para>
+    /// </summary>
+    template<typename T>
+    using index_lane = std::conditional_t<sizeof(T) == 1uz, uint8_t, std::conditional_t<sizeof(T) == 2uz, uint16_t, std::conditional_t<sizeof(T) == 4uz, uint32_t, uint64_t>>>;
+
+    /// <summary>
+    /// <para>Returns true if 'a' should replace 'b'.</para>
+    /// </summary>
+    template<bool MAX, typename T>
+    [[nodiscard]] inline bool better(const T a, const T b) noexcept
+    {
+        if constexpr (MAX)
+        {
+            return a > b;
+        }//End if
+        else
+        {
+            return a < b;
+        }//End else
+    }//End of better
+
+    /// <summary>
+    /// <para>Folds [i, end) into 'best' and 'best_idx' with tpa::simd::vec&lt;T, W&gt;, 'i' is advanced past the elements processed.</para>
+    /// <para>Every lane keeps its best value and the iteration it was found in, updated with a blend on a strict compare so that each lane keeps its leftmost best.</para>
+    /// <para>The iteration counters share the lane size of T, so the input is walked in chunks short enough that they cannot overflow and the lanes are merged into 'best' after each chunk.</para>
+    /// </summary>
+    template<size_t W, bool MAX, typename T>
+    TPA_FORCE_INLINE void arg_block(size_t& i, const size_t end, const T* arr, T& best, size_t& best_idx) noexcept
+    {
+        using U = index_lane<T>;
+        using V = tpa::simd::vec<T, W>;
+        using I = tpa::simd::vec<U, W>;
+
+        constexpr size_t A = tpa::simd::unroll;
+        constexpr size_t step = W * A;
+
+        //The largest U marks a lane which did not improve on 'best', the counters stop one short of it
+        constexpr U none = std::numeric_limits<U>::max();
+        constexpr size_t limit = (sizeof(U) >= 4uz) ? (1uz << 31) : static_cast<size_t>(none);
+
+        const I _one(static_cast<U>(1));
+
+        while ((i + step) <= end)
+        {
+            const size_t base = i;
+            const size_t iters = tpa::util::min((end - i) / step, limit);
+
+            std::array<V, A> _best;
+            std::array<I, A> _idx;
+            _best.fill(V(best));
+            _idx.fill(I(none));
+
+            I _k(static_cast<U>(0));
+
+            for (size_t k = 0uz; k != iters; ++k, i += step)
+            {
+                tpa::simd::prefetch<step * sizeof(T)>(arr + i);
+
+                for (size_t a = 0uz; a < A; ++a)
+                {
+                    const V _val = V::load(arr + i + (W * a));
+
+                    if constexpr (MAX)
+                    {
+                        const auto _m = _val > _best[a];
+
+                        _best[a] = tpa::simd::select(_m, _val, _best[a]);
+                        _idx[a] = tpa::simd::select(tpa::simd::mask_cast<U>(_m), _k, _idx[a]);
+                    }//End if
+                    else
+                    {
+                        const auto _m = _val < _best[a];
+
+                        _best[a] = tpa::simd::select(_m, _val, _best[a]);
+                        _idx[a] = tpa::simd::select(tpa::simd::mask_cast<U>(_m), _k, _idx[a]);
+                    }//End else
+                }//End for
+
+                _k = _k + _one;
+            }//End for
+
+            //Merge the lanes, the smallest index wins a tie
+            for (size_t a = 0uz; a < A; ++a)
+            {
+                T vals[W];
+                U iter[W];
+
+                _best[a].store(vals);
+                _idx[a].store(iter);
+
+                for (size_t l = 0uz; l != W; ++l)
+                {
+                    if (iter[l] == none)
+                    {
+                        continue;
+                    }//End if
+
+                    const size_t pos = base + (((static_cast<size_t>(iter[l]) * A) + a) * W) + l;
+
+                    if (tpa_argminmax_private::better<MAX>(vals[l], best) || (vals[l] == best && pos < best_idx))
+                    {
+                        best = vals[l];
+                        best_idx = pos;
+                    }//End if
+                }//End for
+            }//End for
+        }//End while
+    }//End of arg_block
+
+    /// <summary>
+    /// <para>Folds the elements [i, end) into 'best' and 'best_idx' one at a time, also used to finish the leftovers of the SIMD kernels.</para>
+    /// </summary>
+    template<bool MAX, typename T>
+    inline void arg_scalar(size_t i, const size_t end, const T* arr, T& best, size_t& best_idx) noexcept
+    {
+        for (; i != end; ++i)
+        {
+            if (tpa_argminmax_private::better<MAX>(arr[i], best))
+            {
+                best = arr[i];
+                best_idx = i;
+            }//End if
+        }//End for
+    }//End of arg_scalar
+
+#ifdef TPA_X86_64
+    template<bool MAX, typename T>
+    TPA_TARGET_SSE41 inline void arg_sse41(size_t i, const size_t end, const T* arr, T& best, size_t& best_idx) noexcept
+    {
+        tpa_argminmax_private::arg_block<16uz / sizeof(T), MAX>(i, end, arr, best, best_idx);
+        tpa_argminmax_private::arg_scalar<MAX>(i, end, arr, best, best_idx);
+    }//End of arg_sse41
+
+    template<bool MAX, typename T>
+    TPA_TARGET_AVX2 inline void arg_avx2(size_t i, const size_t end, const T* arr, T& best, size_t& best_idx) noexcept
+    {
+        tpa_argminmax_private::arg_block<32uz / sizeof(T), MAX>(i, end, arr, best, best_idx);
+        tpa_argminmax_private::arg_scalar<MAX>(i, end, arr, best, best_idx);
+    }//End of arg_avx2
+
+    template<bool MAX, typename T>
+    TPA_TARGET_AVX512 inline void arg_avx512(size_t i, const size_t end, const T* arr, T& best, size_t& best_idx) noexcept
+    {
+        tpa_argminmax_private::arg_block<64uz / sizeof(T), MAX>(i, end, arr, best, best_idx);
+        tpa_argminmax_private::arg_scalar<MAX>(i, end, arr, best, best_idx);
+    }//End of arg_avx512
+#elif defined(TPA_NEON)
+    template<bool MAX, typename T>
+    inline void arg_neon(size_t i, const size_t end, const T* arr, T& best, size_t& best_idx) noexcept
+    {
+        tpa_argminmax_private::arg_block<16uz / sizeof(T), MAX>(i, end, arr, best, best_idx);
+        tpa_argminmax_private::arg_scalar<MAX>(i, end, arr, best, best_idx);
+    }//End of arg_neon
+#endif
+
+    /// <summary>
+    /// <para>Returns the argmin (MAX = false) or argmax (MAX = true) kernels for T.</para>
+    /// </summary>
+    template<bool MAX, typename T>
+    [[nodiscard]] inline auto arg_kernels() noexcept
+    {
+        tpa::simd::kernel_table<void(size_t, const size_t, const T*, T&, size_t&)> table;
+        table.scalar = &tpa_argminmax_private::arg_scalar<MAX, T>;
+
+        if constexpr (tpa::simd::is_vec_type<T>)
+        {
+#ifdef TPA_X86_64
+            table.sse41 = &tpa_argminmax_private::arg_sse41<MAX, T>;
+            table.avx2 = &tpa_argminmax_private::arg_avx2<MAX, T>;
+            table.avx512 = &tpa_argminmax_private::arg_avx512<MAX, T>;
+#elif defined(TPA_NEON)
+            table.neon = &tpa_argminmax_private::arg_neon<MAX, T>;
+#endif
+        }//End if
+
+        return table;
+    }//End of arg_kernels
+
+    /// <summary>
+    /// <para>Runs the kernels over every section of [0, count) and merges the sections in order, so the leftmost best element wins.</para>
+    /// </summary>
+    template<bool MAX, typename T>
+    [[nodiscard]] inline size_t arg_threaded(const size_t count, const T* arr)
+    {
+        uint32_t complete = 0;
+
+        std::vector<std::pair<size_t, size_t>> sections;
+        tpa::util::prepareThreading(sections, count);
+
+        std::vector<std::shared_future<std::pair<T, size_t>>> results;
+        results.reserve(tpa::nThreads);
+
+        std::shared_future<std::pair<T, size_t>> temp;
+
+        //Built on first use, not per call
+        static const auto kernels = tpa_argminmax_private::arg_kernels<MAX, T>();
+
+        for (const auto& sec : sections)
+        {
+            //Launch lambda from multiple threads
+            temp = tpa::tp->addTask([&sec, arr]()
+                {
+                    if (sec.first == sec.second)
+                    {
+                        return std::pair<T, size_t>(arr[0], 0uz);
+                    }//End if
+
+                    T best = arr[sec.first];
+                    size_t best_idx = sec.first;
+
+                    kernels.resolve_for((sec.second - sec.first) * sizeof(T))(sec.first + 1uz, sec.second, arr, best, best_idx);
+
+                    return std::pair<T, size_t>(best, best_idx);
+                });//End of lambda
+
+            results.emplace_back(std::move(temp));
+        }//End for
+
+        T best = arr[0];
+        size_t best_idx = 0uz;
+
+        for (const auto& fut : results)
+        {
+            const std::pair<T, size_t>& part = fut.get();
+
+            if (tpa_argminmax_private::better<MAX>(part.first, best))
+            {
+                best = part.first;
+                best_idx = part.second;
+            }//End if
+
+            complete += 1;
+        }//End for
+
+        //Check all threads completed
+        if (complete != tpa::nThreads)
+        {
+            throw tpa::exceptions::NotAllThreadsCompleted(complete);
+        }//End if
+
+        return best_idx;
+    }//End of arg_threaded
+}//End of namespace
+
+/// <summary>
+/// <para>Truly Parallel Algorithms</para>
+/// <para>By David Aaron Braun</para>
+/// <para>Version 0.1</para>
+/// </summary>
+namespace tpa {
+#pragma region generic
+
+	/// <summary>
+	/// <para>Returns the index of the smallest element in the container, the first one if several are equal (as std::min_element).</para>
+	/// <para>This parallel implementation uses Multi-Threading and SIMD, each vector lane tracks the index of its smallest value.</para>
+	/// <para>If passing an container containing no elements, will throw an exception and return 0.</para>
+	/// </summary>
+	/// <typeparam name="CONTAINER_T"></typeparam>
+	/// <typeparam name="T"></typeparam>
+	/// <param name="arr"></param>
+	/// <returns></returns>
+	template<class CONTAINER_T, typename T = CONTAINER_T::value_type>
+	[[nodiscard]] inline constexpr size_t argmin(const CONTAINER_T& arr)
+	requires tpa::util::contiguous_seqeunce<CONTAINER_T> && std::is_arithmetic<T>::value
+	{
+        try
+        {
+            //Guard against zero-element arrays
+            if (arr.size() == 0)
+            {
+                throw tpa::exceptions::EmptyArray();
+            }//End if
+
+            return tpa_argminmax_private::arg_threaded<false>(arr.size(), arr.data());
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::argmin(): " << ex.code()
+                << " " << ex.what() << "\n";
+            return 0uz;
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::argmin(): " << ex.what() << "\n";
+            return 0uz;
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::argmin(): " << ex.what() << "\n";
+            return 0uz;
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::argmin(): unknown!\n";
+            return 0uz;
+        }//End catch
+	}//End of argmin
+
+	/// <summary>
+	/// <para>Returns the index of the largest element in the container, the first one if several are equal (as std::max_element).</para>
+	/// <para>This parallel implementation uses Multi-Threading and SIMD, each vector lane tracks the index of its largest value.</para>
+	/// <para>If passing an container containing no elements, will throw an exception and return 0.</para>
+	/// </summary>
+	/// <typeparam name="CONTAINER_T"></typeparam>
+	/// <typeparam name="T"></typeparam>
+	/// <param name="arr"></param>
+	/// <returns></returns>
+	template<class CONTAINER_T, typename T = CONTAINER_T::value_type>
+	[[nodiscard]] inline constexpr size_t argmax(const CONTAINER_T& arr)
+	requires tpa::util::contiguous_seqeunce<CONTAINER_T> && std::is_arithmetic<T>::value
+	{
+        try
+        {
+            //Guard against zero-element arrays
+            if (arr.size() == 0)
+            {
+                throw tpa::exceptions::EmptyArray();
+            }//End if
+
+            return tpa_argminmax_private::arg_threaded<true>(arr.size(), arr.data());
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::argmax(): " << ex.code()
+                << " " << ex.what() << "\n";
+            return 0uz;
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::argmax(): " << ex.what() << "\n";
+            return 0uz;
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::argmax(): " << ex.what() << "\n";
+            return 0uz;
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::argmax(): unknown!\n";
+            return 0uz;
+        }//End catch
+	}//End of argmax
+#pragma endregion
+}//End of namespace
@@ -19,6 +19,7 @@
 #include <future>
 #include <array>
 #include <vector>
+#include <cstring>
 
 #include "../tpa.hpp"
 #include "../ThreadPool.hpp"
@@ -29,6 +30,89 @@
 #include "../tpa_concepts.hpp"
 #include "../InstructionSet.hpp"
 #include "../simd/simd.hpp"
+#include "../simd/vec.hpp"
+#include "../simd/dispatch.hpp"
+
+/// <summary>
+/// <para>Private Namespace for TPA copy.</para>
+/// <para>Not intended to be used directly.</para>
+/// </summary>
+namespace tpa_copy_private {
+
+    /// <summary>
+    /// <para>memmove of 'bytes' bytes, the regular copy and the fallback of the streaming kernels.</para>
+    /// </summary>
+    inline void copy_memmove(uint8_t* dest, const uint8_t* src, const size_t bytes) noexcept
+    {
+        std::memmove(dest, src, bytes);
+    }//End of copy_memmove
+
+    /// <summary>
+    /// <para>Copies 'bytes' bytes with unaligned BYTES-wide loads and non-temporal stores, which bypass the cache and skip the read-for-ownership of each line.</para>
+    /// <para>The head is copied with memmove up to a BYTES boundary of 'dest' as streaming stores must be aligned.</para>
+    /// <para>Overlapping ranges use memmove.</para>
+    /// </summary>
+    template<size_t BYTES>
+    TPA_FORCE_INLINE void copy_stream(uint8_t* dest, const uint8_t* src, const size_t bytes) noexcept
+    {
+        using V = tpa::simd::vec<uint8_t, BYTES>;
+
+        if ((dest < src + bytes) && (src < dest + bytes))
+        {
+            std::memmove(dest, src, bytes);
+            return;
+        }//End if
+
+        const size_t head = tpa::simd::align_index<BYTES>(0uz, bytes, dest);
+        std::memcpy(dest, src, head);
+
+        size_t i = head;
+
+        for (; (i + BYTES) <= bytes; i += BYTES)
+        {
+            V::load(src + i).store_stream(dest + i);
+        }//End for
+
+        tpa::simd::stream_fence();
+
+        std::memcpy(dest + i, src + i, bytes - i);
+    }//End of copy_stream
+
+#ifdef TPA_X86_64
+    TPA_TARGET_SSE41 inline void copy_stream_sse41(uint8_t* dest, const uint8_t* src, const size_t bytes) noexcept
+    {
+        tpa_copy_private::copy_stream<16uz>(dest, src, bytes);
+    }//End of copy_stream_sse41
+
+    TPA_TARGET_AVX2 inline void copy_stream_avx2(uint8_t* dest, const uint8_t* src, const size_t bytes) noexcept
+    {
+        tpa_copy_private::copy_stream<32uz>(dest, src, bytes);
+    }//End of copy_stream_avx2
+
+    TPA_TARGET_AVX512 inline void copy_stream_avx512(uint8_t* dest, const uint8_t* src, const size_t bytes) noexcept
+    {
+        tpa_copy_private::copy_stream<64uz>(dest, src, bytes);
+    }//End of copy_stream_avx512
+#endif
+
+    /// <summary>
+    /// <para>Returns the streaming copy kernels for this hardware.</para>
+    /// <para>NEON has no non-temporal store intrinsic, ARM uses memmove.</para>
+    /// </summary>
+    [[nodiscard]] inline auto copy_stream_kernels() noexcept
+    {
+        tpa::simd::kernel_table<void(uint8_t*, const uint8_t*, const size_t)> table;
+        table.scalar = &tpa_copy_private::copy_memmove;
+
+#ifdef TPA_X86_64
+        table.sse41 = &tpa_copy_private::copy_stream_sse41;
+        table.avx2 = &tpa_copy_private::copy_stream_avx2;
+        table.avx512 = &tpa_copy_private::copy_stream_avx512;
+#endif
+
+        return table;
+    }//End of copy_stream_kernels
+}//End of namespace
 
 /// <summary>
 /// <para>Truly Parallel Algorithms</para>
@@ -49,13 +133,14 @@ namespace tpa {
     /// <param name="source"></param>
     /// <param name="dest"></param>
     /// <param name="item_count"></param>
+    /// <param name="stream_threshold"> - optional defaults to tpa::simd::stream_min_bytes (the last level cache size), copies of at least this many bytes use non-temporal stores</param>
     template <typename SOURCE, typename DEST>
-    inline constexpr void copy(const SOURCE& source, DEST& dest, size_t item_count = 0)
+    inline constexpr void copy(const SOURCE& source, DEST& dest, size_t item_count = 0, const size_t stream_threshold = tpa::simd::stream_min_bytes)
     requires tpa::util::contiguous_seqeunce<SOURCE> && tpa::util::contiguous_seqeunce<DEST>
     {
         try
         {
-            static_assert(std::is_same<SOURCE::value_type, DEST::value_type>() == true, "Compile Error! The source and destination container must be of the same value type!");
+            static_assert(std::is_same<typename SOURCE::value_type, typename DEST::value_type>() == true, "Compile Error! The source and destination container must be of the same value type!");
 
             using T = SOURCE::value_type;
 
@@ -67,6 +152,8 @@ namespace tpa {
 
             uint32_t complete = 0;
 
+            const bool stream = (item_count * sizeof(T)) >= stream_threshold;
+
             std::vector<std::pair<size_t, size_t>> sections;
             tpa::util::prepareThreading(sections, item_count);
 
@@ -77,12 +164,24 @@ namespace tpa {
 
             for (const auto& sec : sections)
             {
-                temp = tpa::tp->addTask([&source, &dest, &item_count, &sec]()
+                temp = tpa::tp->addTask([&source, &dest, &item_count, &sec, stream]()
                     {
                         const size_t beg = sec.first;
                         const size_t end = sec.second;
                         size_t i = beg;
 
+#pragma region stream
+                        if (stream)
+                        {
+                            //Built on first use, not per call
+                            static const auto stream_kernels = tpa_copy_private::copy_stream_kernels();
+
+                            stream_kernels.resolve_for((end - i) * sizeof(T))(
+                                reinterpret_cast<uint8_t*>(&dest[i]), reinterpret_cast<const uint8_t*>(&source[i]), (end - i) * sizeof(T));
+
+                            return static_cast<uint32_t>(1);
+                        }//End if
+#pragma endregion
 #pragma region byte
                         if constexpr (std::is_same<T, int8_t>() == true)
                         {
@@ -95,7 +194,7 @@ namespace tpa {
                                 }//End if
 
                                 //Copy with avx2
-                                _mm256_store_si256((__m256i*) & dest[i], _mm256_load_si256((__m256i const*) & source[i]));
+                                _mm256_storeu_si256((__m256i*) & dest[i], _mm256_loadu_si256((__m256i const*) & source[i]));
                             }//End for
                             */
                             //Finish leftovers
@@ -114,7 +213,7 @@ namespace tpa {
                                 }//End if
 
                                 //Copy with avx2
-                                _mm256_store_si256((__m256i*) & dest[i], _mm256_load_si256((__m256i const*) & source[i]));
+                                _mm256_storeu_si256((__m256i*) & dest[i], _mm256_loadu_si256((__m256i const*) & source[i]));
                             }//End for
                             */
                             //Finish leftovers
@@ -133,7 +232,7 @@ namespace tpa {
                                 }//End if
 
                                 //Copy with avx2
-                                _mm256_store_si256((__m256i*) & dest[i], _mm256_load_si256((__m256i const*) & source[i]));
+                                _mm256_storeu_si256((__m256i*) & dest[i], _mm256_loadu_si256((__m256i const*) & source[i]));
                             }//End for
                             */
                             //Finish leftovers
@@ -152,7 +251,7 @@ namespace tpa {
                                 }//End if
 
                                 //Copy with avx2
-                                _mm256_store_si256((__m256i*) & dest[i], _mm256_load_si256((__m256i const*) & source[i]));
+                                _mm256_storeu_si256((__m256i*) & dest[i], _mm256_loadu_si256((__m256i const*) & source[i]));
                             }//End for
                             */
                             //Finish leftovers
@@ -171,7 +270,7 @@ namespace tpa {
                                 }//End if
 
                                 //Copy with avx2
-                                _mm256_store_si256((__m256i*) & dest[i], _mm256_load_si256((__m256i const*) & source[i]));
+                                _mm256_storeu_si256((__m256i*) & dest[i], _mm256_loadu_si256((__m256i const*) & source[i]));
                             }//End for
                             */
                             //Finish leftovers
@@ -190,7 +289,7 @@ namespace tpa {
                                 }//End if
 
                                 //Copy with avx2
-                                _mm256_store_si256((__m256i*) & dest[i], _mm256_load_si256((__m256i const*) & source[i]));
+                                _mm256_storeu_si256((__m256i*) & dest[i], _mm256_loadu_si256((__m256i const*) & source[i]));
                             }//End for
                             */
                             //Finish leftovers
@@ -209,7 +308,7 @@ namespace tpa {
                                     }//End if
 
                                     //Copy with avx2
-                                    _mm256_store_si256((__m256i*) & dest[i], _mm256_load_si256((__m256i const*) & source[i]));
+                                    _mm256_storeu_si256((__m256i*) & dest[i], _mm256_loadu_si256((__m256i const*) & source[i]));
                                 }//End for
                                 */
                                 //Finish leftovers
@@ -228,7 +327,7 @@ namespace tpa {
                                     }//End if
 
                                     //Copy with avx2
-                                    _mm256_store_si256((__m256i*) & dest[i], _mm256_load_si256((__m256i const*) & source[i]));
+                                    _mm256_storeu_si256((__m256i*) & dest[i], _mm256_loadu_si256((__m256i const*) & source[i]));
                                 }//End for
                                 */
                                 //Finish leftovers
@@ -247,7 +346,7 @@ namespace tpa {
                                 }//End if
 
                                 //Copy with avx2
-                                _mm256_store_ps(&dest[i], _mm256_load_ps(&source[i]));
+                                _mm256_storeu_ps(&dest[i], _mm256_loadu_ps(&source[i]));
                             }//End for
                             */
                             //Finish leftovers
@@ -266,7 +365,7 @@ namespace tpa {
                                     }//End if
 
                                     //Copy with avx2
-                                    _mm256_store_pd(&dest[i], _mm256_load_pd(&source[i]));
+                                    _mm256_storeu_pd(&dest[i], _mm256_loadu_pd(&source[i]));
                                 }//End for
                                 */
                                 //Finish leftovers
@@ -332,8 +431,9 @@ namespace tpa {
     /// <param name="source"></param>
     /// <param name="dest"></param>
     /// <param name="item_count"></param>
+    /// <param name="stream_threshold"> - optional defaults to tpa::simd::stream_min_bytes (the last level cache size), copies of at least this many bytes use non-temporal stores</param>
     template <typename T, size_t SIZE1, size_t SIZE2>
-    inline constexpr void copy(const std::array<T,SIZE1>& source, std::array<T,SIZE2>& dest, size_t item_count = 0)
+    inline constexpr void copy(const std::array<T,SIZE1>& source, std::array<T,SIZE2>& dest, size_t item_count = 0, const size_t stream_threshold = tpa::simd::stream_min_bytes)
     {
         try
         {
@@ -345,6 +445,8 @@ namespace tpa {
 
             uint32_t complete = 0;
 
+            const bool stream = (item_count * sizeof(T)) >= stream_threshold;
+
             std::vector<std::pair<size_t, size_t>> sections;
             tpa::util::prepareThreading(sections, item_count);
 
@@ -355,12 +457,24 @@ namespace tpa {
 
             for (const auto& sec : sections)
             {
-                temp = tpa::tp->addTask([&source, &dest, &item_count, &sec]()
+                temp = tpa::tp->addTask([&source, &dest, &item_count, &sec, stream]()
                     {
                         const size_t beg = sec.first;
                         const size_t end = sec.second;
                         size_t i = beg;
 
+#pragma region stream
+                        if (stream)
+                        {
+                            //Built on first use, not per call
+                            static const auto stream_kernels = tpa_copy_private::copy_stream_kernels();
+
+                            stream_kernels.resolve_for((end - i) * sizeof(T))(
+                                reinterpret_cast<uint8_t*>(&dest[i]), reinterpret_cast<const uint8_t*>(&source[i]), (end - i) * sizeof(T));
+
+                            return static_cast<uint32_t>(1);
+                        }//End if
+#pragma endregion
 #pragma region byte
                         if constexpr (std::is_same<T, int8_t>() == true)
                         {
@@ -373,7 +487,7 @@ namespace tpa {
                                 }//End if
 
                                 //Copy with avx2
-                                _mm256_store_si256((__m256i*) & dest[i], _mm256_load_si256((__m256i const*) & source[i]));
+                                _mm256_storeu_si256((__m256i*) & dest[i], _mm256_loadu_si256((__m256i const*) & source[i]));
                             }//End for
                             */
                             //Finish leftovers
@@ -392,7 +506,7 @@ namespace tpa {
                                 }//End if
 
                                 //Copy with avx2
-                                _mm256_store_si256((__m256i*) & dest[i], _mm256_load_si256((__m256i const*) & source[i]));
+                                _mm256_storeu_si256((__m256i*) & dest[i], _mm256_loadu_si256((__m256i const*) & source[i]));
                             }//End for
                             */
                             //Finish leftovers
@@ -411,7 +525,7 @@ namespace tpa {
                                 }//End if
 
                                 //Copy with avx2
-                                _mm256_store_si256((__m256i*) & dest[i], _mm256_load_si256((__m256i const*) & source[i]));
+                                _mm256_storeu_si256((__m256i*) & dest[i], _mm256_loadu_si256((__m256i const*) & source[i]));
                             }//End for
                             */
                             //Finish leftovers
@@ -430,7 +544,7 @@ namespace tpa {
                                 }//End if
 
                                 //Copy with avx2
-                                _mm256_store_si256((__m256i*) & dest[i], _mm256_load_si256((__m256i const*) & source[i]));
+                                _mm256_storeu_si256((__m256i*) & dest[i], _mm256_loadu_si256((__m256i const*) & source[i]));
                             }//End for
                             */
                             //Finish leftovers
@@ -449,7 +563,7 @@ namespace tpa {
                                 }//End if
 
                                 //Copy with avx2
-                                _mm256_store_si256((__m256i*) & dest[i], _mm256_load_si256((__m256i const*) & source[i]));
+                                _mm256_storeu_si256((__m256i*) & dest[i], _mm256_loadu_si256((__m256i const*) & source[i]));
                             }//End for
                             */
                             //Finish leftovers
@@ -468,7 +582,7 @@ namespace tpa {
                                 }//End if
 
                                 //Copy with avx2
-                                _mm256_store_si256((__m256i*) & dest[i], _mm256_load_si256((__m256i const*) & source[i]));
+                                _mm256_storeu_si256((__m256i*) & dest[i], _mm256_loadu_si256((__m256i const*) & source[i]));
                             }//End for
                             */
                             //Finish leftovers
@@ -487,7 +601,7 @@ namespace tpa {
                                     }//End if
 
                                     //Copy with avx2
-                                    _mm256_store_si256((__m256i*) & dest[i], _mm256_load_si256((__m256i const*) & source[i]));
+                                    _mm256_storeu_si256((__m256i*) & dest[i], _mm256_loadu_si256((__m256i const*) & source[i]));
                                 }//End for
                                 */
                                 //Finish leftovers
@@ -506,7 +620,7 @@ namespace tpa {
                                     }//End if
 
                                     //Copy with avx2
-                                    _mm256_store_si256((__m256i*) & dest[i], _mm256_load_si256((__m256i const*) & source[i]));
+                                    _mm256_storeu_si256((__m256i*) & dest[i], _mm256_loadu_si256((__m256i const*) & source[i]));
                                 }//End for
                                 */
                                 //Finish leftovers
@@ -525,7 +639,7 @@ namespace tpa {
                                 }//End if
 
                                 //Copy with avx2
-                                _mm256_store_ps(&dest[i], _mm256_load_ps(&source[i]));
+                                _mm256_storeu_ps(&dest[i], _mm256_loadu_ps(&source[i]));
                             }//End for
                             */
                             //Finish leftovers
@@ -544,7 +658,7 @@ namespace tpa {
                                     }//End if
 
                                     //Copy with avx2
-                                    _mm256_store_pd(&dest[i], _mm256_load_pd(&source[i]));
+                                    _mm256_storeu_pd(&dest[i], _mm256_loadu_pd(&source[i]));
                                 }//End for
                                 */
                                 //Finish leftovers
@@ -610,8 +724,9 @@ namespace tpa {
     /// <param name="source"></param>
     /// <param name="dest"></param>
     /// <param name="item_count"></param>
+    /// <param name="stream_threshold"> - optional defaults to tpa::simd::stream_min_bytes (the last level cache size), copies of at least this many bytes use non-temporal stores</param>
     template <typename T>
-    inline constexpr void copy(const std::vector<T>& source, std::vector<T>& dest, size_t item_count = 0)
+    inline constexpr void copy(const std::vector<T>& source, std::vector<T>& dest, size_t item_count = 0, const size_t stream_threshold = tpa::simd::stream_min_bytes)
     {
         try
         {
@@ -623,6 +738,8 @@ namespace tpa {
 
             uint32_t complete = 0;
 
+            const bool stream = (item_count * sizeof(T)) >= stream_threshold;
+
             std::vector<std::pair<size_t, size_t>> sections;
             tpa::util::prepareThreading(sections, item_count);
 
@@ -633,13 +750,25 @@ namespace tpa {
 
             for (const auto& sec : sections)
             {
-                temp = tpa::tp->addTask([&source, &dest, &item_count, &sec]()
+                temp = tpa::tp->addTask([&source, &dest, &item_count, &sec, stream]()
                     {
                     
                         const size_t beg = sec.first;
                         const size_t end = sec.second;
                         size_t i = beg;
 
+#pragma region stream
+                        if (stream)
+                        {
+                            //Built on first use, not per call
+                            static const auto stream_kernels = tpa_copy_private::copy_stream_kernels();
+
+                            stream_kernels.resolve_for((end - i) * sizeof(T))(
+                                reinterpret_cast<uint8_t*>(&dest[i]), reinterpret_cast<const uint8_t*>(&source[i]), (end - i) * sizeof(T));
+
+                            return static_cast<uint32_t>(1);
+                        }//End if
+#pragma endregion
 #pragma region byte
                         if constexpr (std::is_same<T, int8_t>() == true)
                         {
@@ -652,7 +781,7 @@ namespace tpa {
                                 }//End if
 
                                 //Copy with avx2
-                                _mm256_store_si256((__m256i*) & dest[i], _mm256_load_si256((__m256i const*) & source[i]));
+                                _mm256_storeu_si256((__m256i*) & dest[i], _mm256_loadu_si256((__m256i const*) & source[i]));
                             }//End for
                             */
                             //Finish leftovers
@@ -671,7 +800,7 @@ namespace tpa {
                                 }//End if
 
                                 //Copy with avx2
-                                _mm256_store_si256((__m256i*) & dest[i], _mm256_load_si256((__m256i const*) & source[i]));
+                                _mm256_storeu_si256((__m256i*) & dest[i], _mm256_loadu_si256((__m256i const*) & source[i]));
                             }//End for
                             */
                             //Finish leftovers
@@ -690,7 +819,7 @@ namespace tpa {
                                 }//End if
 
                                 //Copy with avx2
-                                _mm256_store_si256((__m256i*) & dest[i], _mm256_load_si256((__m256i const*) & source[i]));
+                                _mm256_storeu_si256((__m256i*) & dest[i], _mm256_loadu_si256((__m256i const*) & source[i]));
                             }//End for
                             */
                             //Finish leftovers
@@ -709,7 +838,7 @@ namespace tpa {
                                 }//End if
 
                                 //Copy with avx2
-                                _mm256_store_si256((__m256i*) & dest[i], _mm256_load_si256((__m256i const*) & source[i]));
+                                _mm256_storeu_si256((__m256i*) & dest[i], _mm256_loadu_si256((__m256i const*) & source[i]));
                             }//End for
                             */
                             //Finish leftovers
@@ -728,7 +857,7 @@ namespace tpa {
                                 }//End if
 
                                 //Copy with avx2
-                                _mm256_store_si256((__m256i*) & dest[i], _mm256_load_si256((__m256i const*) & source[i]));
+                                _mm256_storeu_si256((__m256i*) & dest[i], _mm256_loadu_si256((__m256i const*) & source[i]));
                             }//End for
                             */
                             //Finish leftovers
@@ -747,7 +876,7 @@ namespace tpa {
                                 }//End if
 
                                 //Copy with avx2
-                                _mm256_store_si256((__m256i*) & dest[i], _mm256_load_si256((__m256i const*) & source[i]));
+                                _mm256_storeu_si256((__m256i*) & dest[i], _mm256_loadu_si256((__m256i const*) & source[i]));
                             }//End for
                             */
                             //Finish leftovers
@@ -766,7 +895,7 @@ namespace tpa {
                                 }//End if
 
                                 //Copy with avx2
-                                _mm256_store_si256((__m256i*) & dest[i], _mm256_load_si256((__m256i const*) & source[i]));
+                                _mm256_storeu_si256((__m256i*) & dest[i], _mm256_loadu_si256((__m256i const*) & source[i]));
                             }//End for
                             */
                             //Finish leftovers
@@ -785,7 +914,7 @@ namespace tpa {
                                 }//End if
 
                                 //Copy with avx2
-                                _mm256_store_si256((__m256i*) & dest[i], _mm256_load_si256((__m256i const*) & source[i]));
+                                _mm256_storeu_si256((__m256i*) & dest[i], _mm256_loadu_si256((__m256i const*) & source[i]));
                             }//End for
                             */
                             //Finish leftovers
@@ -804,7 +933,7 @@ namespace tpa {
                                 }//End if
 
                                 //Copy with avx2
-                                _mm256_store_ps(&dest[i], _mm256_load_ps(&source[i]));
+                                _mm256_storeu_ps(&dest[i], _mm256_loadu_ps(&source[i]));
                             }//End for                            
                             */
                             //Finish leftovers
@@ -823,7 +952,7 @@ namespace tpa {
                                 }//End if
 
                                 //Copy with avx2
-                                _mm256_store_pd(&dest[i], _mm256_load_pd(&source[i]));
+                                _mm256_storeu_pd(&dest[i], _mm256_loadu_pd(&source[i]));
                             }//End for
                             */
                             //Finish leftovers
@@ -19,6 +19,8 @@
 #include <future>
 #include <array>
 #include <vector>
+#include <algorithm>
+#include <cmath>
 
 #include "../tpa.hpp"
 #include "../ThreadPool.hpp"
@@ -29,6 +31,375 @@
 #include "../tpa_concepts.hpp"
 #include "../InstructionSet.hpp"
 #include "../simd/simd.hpp"
+#include "../simd/dispatch.hpp"
+#include "../simd/vec.hpp"
+
+#include "count.hpp"
+
+/// <summary>
+/// <para>Private Namespace for the TPA stream compaction engine used by copy_if, remove_if and partition_copy.</para>
+/// <para>Every thread counts the elements it keeps, the counts are turned into output offsets with an exclusive scan and every thread then left-packs its section to its own offset.</para>
+/// </summary>
+namespace tpa_copy_if_private
+{
+    /// <summary>
+    /// <para>Wraps a tpa::cond predicate and its parameter.</para>
+    /// <para>'simd' is set when COND can be tested with the tpa::simd::vec kernels and 'para' is exactly representable as T.</para>
+    /// <para>DIVISIBLE_BY divides with precomputed magic numbers only when 'para' is exactly representable as T, as tpa::count_if does.</para>
+    /// </summary>
+    template<tpa::cond COND, typename T, typename P>
+    struct cond_filter
+    {
+        static constexpr tpa::cond cond = COND;
+        static constexpr bool vectorized = tpa_count_private::vec_countable<COND, T>;
+        static constexpr bool divides = (COND == tpa::cond::DIVISIBLE_BY) && std::is_integral<T>::value && !std::is_same<T, bool>::value;
+
+        P para;
+        T value;
+        bool simd = false;
+        bool divisor_fits = false;
+
+        //Precomputed magic-number divisor, only used by DIVISIBLE_BY when 'divisor_fits'
+        std::conditional_t<divides, tpa::simd::int_divider<std::conditional_t<divides, T, int32_t>>, bool> div;
+
+        explicit cond_filter(const P p, const bool useSIMD) :
+            para(p), value(static_cast<T>(p)), divisor_fits(divides && static_cast<P>(static_cast<T>(p)) == p), div(divisor_fits ? static_cast<T>(p) : 1)
+        {
+            if constexpr (vectorized)
+            {
+                simd = useSIMD && static_cast<P>(value) == para;
+            }//End if
+        }//End constructor
+
+        [[nodiscard]] inline bool operator()(const T x) const noexcept
+        {
+            if constexpr (COND == tpa::cond::EQUAL_TO) { return x == para; }
+            else if constexpr (COND == tpa::cond::NOT_EQUAL_TO) { return x != para; }
+            else if constexpr (COND == tpa::cond::LESS_THAN) { return x < para; }
+            else if constexpr (COND == tpa::cond::LESS_THAN_OR_EQUAL_TO) { return x <= para; }
+            else if constexpr (COND == tpa::cond::GREATER_THAN) { return x > para; }
+            else if constexpr (COND == tpa::cond::GREATER_THAN_OR_EQUAL_TO) { return x >= para; }
+            else if constexpr (COND == tpa::cond::EVEN) { return tpa::util::isEven(x); }
+            else if constexpr (COND == tpa::cond::ODD) { return tpa::util::isOdd(x); }
+            else if constexpr (COND == tpa::cond::DIVISIBLE_BY && divides && std::is_integral<P>::value) { return divisor_fits ? div.modulo(x) == 0 : x % para == 0; }
+            else if constexpr (COND == tpa::cond::DIVISIBLE_BY && divides) { return divisor_fits ? div.modulo(x) == 0 : std::fmod(x, para) == 0.0; }
+            else if constexpr (COND == tpa::cond::DIVISIBLE_BY) { return std::fmod(x, para) == 0.0; }
+            else if constexpr (COND == tpa::cond::POWER_OF) { return tpa::util::isPower(x, para); }
+            else if constexpr (COND == tpa::cond::PRIME) { return tpa::util::isPrime(x); }
+            else if constexpr (COND == tpa::cond::PERFECT_SQUARE) { return tpa::util::isPerfectSquare(x); }
+            else if constexpr (COND == tpa::cond::FIBONACCI) { return tpa::util::isFibonacci(x); }
+            else if constexpr (COND == tpa::cond::SYLVESTER) { return tpa::util::isSylvester(x); }
+            else
+            {
+                [] <bool flag = false>()
+                {
+                    static_assert(flag, " You have specifed an invalid predicate function in tpa::copy_if<__UNDEFINED_PREDICATE__>(CONTAINER<T>).");
+                }();
+                return false;
+            }//End else
+        }//End of operator()
+    };//End of cond_filter
+
+    /// <summary>
+    /// <para>Wraps a predicate function, always tested one element at a time.</para>
+    /// </summary>
+    template<typename PRED>
+    struct pred_filter
+    {
+        static constexpr bool vectorized = false;
+
+        PRED pred;
+
+        template<typename T>
+        [[nodiscard]] inline bool operator()(const T x) const
+        {
+            return static_cast<bool>(pred(x));
+        }//End of operator()
+    };//End of pred_filter
+
+    /// <summary>
+    /// <para>Left-packs the elements of [i, end) for which COND is KEEP to 'out' with tpa::simd::vec&lt;T, W&gt;, 'i' and 'out' are advanced past the elements processed and written.</para>
+    /// <para>'out' may equal 'src' + 'i' (in-place), every store lands on elements which have already been loaded.</para>
+    /// </summary>
+    template<size_t W, tpa::cond COND, bool KEEP, typename T>
+    TPA_FORCE_INLINE void compact_block(size_t& i, const size_t end, const T* src, const T para, T*& out) noexcept
+    {
+        using V = tpa::simd::vec<T, W>;
+
+        constexpr size_t A = tpa::simd::unroll;
+        constexpr size_t step = W * A;
+
+        const V _para(para);
+
+        for (; (i + step) <= end; i += step)
+        {
+            tpa::simd::prefetch<step * sizeof(T)>(src + i);
+
+            for (size_t a = 0uz; a < A; ++a)
+            {
+                const V _val = V::load(src + i + (W * a));
+
+                if constexpr (KEEP)
+                {
+                    out += tpa::simd::compress_store(_val, tpa_count_private::matches<COND>(_val, _para), out);
+                }//End if
+                else
+                {
+                    out += tpa::simd::compress_store(_val, ~tpa_count_private::matches<COND>(_val, _para), out);
+                }//End else
+            }//End for
+        }//End for
+    }//End of compact_block
+
+    /// <summary>
+    /// <para>Left-packs the elements of [i, end) for which COND is KEEP to 'out' one at a time, also used to finish the leftovers of the SIMD kernels.</para>
+    /// </summary>
+    template<tpa::cond COND, bool KEEP, typename T>
+    inline void compact_scalar(size_t& i, const size_t end, const T* src, const T para, T*& out) noexcept
+    {
+        for (; i != end; ++i)
+        {
+            if (tpa_count_private::matches<COND>(src[i], para) == KEEP)
+            {
+                *out++ = src[i];
+            }//End if
+        }//End for
+    }//End of compact_scalar
+
+#ifdef TPA_X86_64
+    template<tpa::cond COND, bool KEEP, typename T>
+    TPA_TARGET_SSE41 inline void compact_sse41(size_t& i, const size_t end, const T* src, const T para, T*& out) noexcept
+    {
+        tpa_copy_if_private::compact_block<16uz / sizeof(T), COND, KEEP>(i, end, src, para, out);
+        tpa_copy_if_private::compact_scalar<COND, KEEP>(i, end, src, para, out);
+    }//End of compact_sse41
+
+    template<tpa::cond COND, bool KEEP, typename T>
+    TPA_TARGET_AVX2 inline void compact_avx2(size_t& i, const size_t end, const T* src, const T para, T*& out) noexcept
+    {
+        tpa_copy_if_private::compact_block<32uz / sizeof(T), COND, KEEP>(i, end, src, para, out);
+        tpa_copy_if_private::compact_scalar<COND, KEEP>(i, end, src, para, out);
+    }//End of compact_avx2
+
+    template<tpa::cond COND, bool KEEP, typename T>
+    TPA_TARGET_AVX512 inline void compact_avx512(size_t& i, const size_t end, const T* src, const T para, T*& out) noexcept
+    {
+        tpa_copy_if_private::compact_block<64uz / sizeof(T), COND, KEEP>(i, end, src, para, out);
+        tpa_copy_if_private::compact_scalar<COND, KEEP>(i, end, src, para, out);
+    }//End of compact_avx512
+#elif defined(TPA_NEON)
+    template<tpa::cond COND, bool KEEP, typename T>
+    inline void compact_neon(size_t& i, const size_t end, const T* src, const T para, T*& out) noexcept
+    {
+        tpa_copy_if_private::compact_block<16uz / sizeof(T), COND, KEEP>(i, end, src, para, out);
+        tpa_copy_if_private::compact_scalar<COND, KEEP>(i, end, src, para, out);
+    }//End of compact_neon
+#endif
+
+    /// <summary>
+    /// <para>Returns the kernels left-packing the elements for which COND is KEEP, see compact_block.</para>
+    /// </summary>
+    template<tpa::cond COND, bool KEEP, typename T>
+    [[nodiscard]] inline auto compact_kernels() noexcept
+    {
+        tpa::simd::kernel_table<void(size_t&, const size_t, const T*, const T, T*&)> table;
+        table.scalar = &tpa_copy_if_private::compact_scalar<COND, KEEP, T>;
+
+#ifdef TPA_X86_64
+        table.sse41 = &tpa_copy_if_private::compact_sse41<COND, KEEP, T>;
+        table.avx2 = &tpa_copy_if_private::compact_avx2<COND, KEEP, T>;
+        table.avx512 = &tpa_copy_if_private::compact_avx512<COND, KEEP, T>;
+#elif defined(TPA_NEON)
+        table.neon = &tpa_copy_if_private::compact_neon<COND, KEEP, T>;
+#endif
+
+        return table;
+    }//End of compact_kernels
+
+    /// <summary>
+    /// <para>Returns the number of elements of [beg, end) for which 'filter' is KEEP.</para>
+    /// </summary>
+    template<bool KEEP, typename T, typename FILTER>
+    [[nodiscard]] inline size_t count_section(const size_t beg, const size_t end, const T* src, const FILTER& filter)
+    {
+        size_t i = beg;
+        size_t cnt = 0uz;
+
+        if constexpr (FILTER::vectorized)
+        {
+            if (filter.simd)
+            {
+                //Built on first use, not per call
+                static const auto kernels = tpa_count_private::count_kernels<FILTER::cond, T>();
+
+                uint64_t total = 0ull;
+                kernels.resolve_for((end - beg) * sizeof(T))(i, end, src, filter.value, total);
+                cnt = static_cast<size_t>(total);
+            }//End if
+        }//End if
+
+        for (; i != end; ++i)
+        {
+            if (filter(src[i]))
+            {
+                ++cnt;
+            }//End if
+        }//End for
+
+        return KEEP ? cnt : (end - beg) - cnt;
+    }//End of count_section
+
+    /// <summary>
+    /// <para>Left-packs the elements of [beg, end) for which 'filter' is KEEP to 'out' and returns the end of the written range.</para>
+    /// </summary>
+    template<bool KEEP, typename T, typename FILTER>
+    inline T* compact_section(const size_t beg, const size_t end, const T* src, T* out, const FILTER& filter)
+    {
+        size_t i = beg;
+
+        if constexpr (FILTER::vectorized)
+        {
+            if (filter.simd)
+            {
+                //Built on first use, not per call
+                static const auto kernels = tpa_copy_if_private::compact_kernels<FILTER::cond, KEEP, T>();
+
+                kernels.resolve_for((end - beg) * sizeof(T))(i, end, src, filter.value, out);
+            }//End if
+        }//End if
+
+        for (; i != end; ++i)
+        {
+            if (filter(src[i]) == KEEP)
+            {
+                *out++ = src[i];
+            }//End if
+        }//End for
+
+        return out;
+    }//End of compact_section
+
+    /// <summary>
+    /// <para>Runs count_fn(beg, end) over every section of [0, count), scans the counts into offsets, calls check(total) and then runs write_fn(beg, end, offset) over every section.</para>
+    /// <para>Returns the total, the output of section k starts at the sum of the counts of sections 0 to k - 1.</para>
+    /// </summary>
+    template<typename COUNT_FN, typename CHECK_FN, typename WRITE_FN>
+    [[nodiscard]] inline size_t compact_threaded(const size_t count, const COUNT_FN& count_fn, const CHECK_FN& check, const WRITE_FN& write_fn)
+    {
+        uint32_t complete = 0;
+
+        std::vector<std::pair<size_t, size_t>> sections;
+        tpa::util::prepareThreading(sections, count);
+
+        std::vector<std::shared_future<size_t>> counts;
+        counts.reserve(tpa::nThreads);
+
+        for (const auto& sec : sections)
+        {
+            //Launch lambda from multiple threads
+            counts.emplace_back(tpa::tp->addTask([&sec, &count_fn]()
+                {
+                    return static_cast<size_t>(count_fn(sec.first, sec.second));
+                }));//End of lambda
+        }//End for
+
+        //Exclusive scan of the counts
+        std::vector<size_t> offsets;
+        offsets.reserve(sections.size());
+
+        size_t total = 0uz;
+        for (const auto& fut : counts)
+        {
+            offsets.push_back(total);
+            total += fut.get();
+            complete += 1;
+        }//End for
+
+        //Check all threads completed
+        if (complete != tpa::nThreads)
+        {
+            throw tpa::exceptions::NotAllThreadsCompleted(complete);
+        }//End if
+
+        check(total);
+
+        complete = 0;
+
+        std::vector<std::shared_future<uint32_t>> results;
+        results.reserve(tpa::nThreads);
+
+        for (size_t k = 0uz; k != sections.size(); ++k)
+        {
+            //Launch lambda from multiple threads
+            results.emplace_back(tpa::tp->addTask([&sec = sections[k], offset = offsets[k], &write_fn]()
+                {
+                    write_fn(sec.first, sec.second, offset);
+                    return static_cast<uint32_t>(1);
+                }));//End of lambda
+        }//End for
+
+        for (const auto& fut : results)
+        {
+            complete += fut.get();
+        }//End for
+
+        //Check all threads completed
+        if (complete != tpa::nThreads)
+        {
+            throw tpa::exceptions::NotAllThreadsCompleted(complete);
+        }//End if
+
+        return total;
+    }//End of compact_threaded
+
+    /// <summary>
+    /// <para>Removes the elements of [0, count) of 'arr' for which 'filter' is true in place and returns the number kept.</para>
+    /// <para>Every thread left-packs its section in place, the packed sections are then moved down in order so that no section is overwritten before it has moved.</para>
+    /// </summary>
+    template<typename T, typename FILTER>
+    [[nodiscard]] inline size_t remove_threaded(const size_t count, T* arr, const FILTER& filter)
+    {
+        uint32_t complete = 0;
+
+        std::vector<std::pair<size_t, size_t>> sections;
+        tpa::util::prepareThreading(sections, count);
+
+        std::vector<std::shared_future<size_t>> kept;
+        kept.reserve(tpa::nThreads);
+
+        for (const auto& sec : sections)
+        {
+            //Launch lambda from multiple threads
+            kept.emplace_back(tpa::tp->addTask([&sec, arr, &filter]()
+                {
+                    T* last = tpa_copy_if_private::compact_section<false>(sec.first, sec.second, arr, arr + sec.first, filter);
+                    return static_cast<size_t>(last - (arr + sec.first));
+                }));//End of lambda
+        }//End for
+
+        size_t total = 0uz;
+        for (size_t k = 0uz; k != sections.size(); ++k)
+        {
+            const size_t n = kept[k].get();
+
+            if (total != sections[k].first)
+            {
+                std::copy(arr + sections[k].first, arr + sections[k].first + n, arr + total);
+            }//End if
+
+            total += n;
+            complete += 1;
+        }//End for
+
+        //Check all threads completed
+        if (complete != tpa::nThreads)
+        {
+            throw tpa::exceptions::NotAllThreadsCompleted(complete);
+        }//End if
+
+        return total;
+    }//End of remove_threaded
+}//End of namespace
 
 /// <summary>
 /// <para>Truly Parallel Algorithms</para>
@@ -39,120 +410,97 @@ namespace tpa {
 #pragma region generic
 
     /// <summary>
-    /// <para>Parellel Implementation of copy_if taking a predicate function returning a bool, copying data from SOURCE to DEST if the data matches the predicate</para>
-    /// <para>Does not use AVX</para>
+    /// <para>Parellel Implementation of copy_if taking a predicate function returning a bool, copying the elements of SOURCE which match the predicate to the front of DEST in their original order</para>
+    /// <para>Returns the number of elements copied, 'dest' only needs to be large enough to hold them.</para>
+    /// <para>Does not use SIMD</para>
     /// </summary>
     /// <typeparam name="SOURCE"></typeparam>
     /// <typeparam name="DEST"></typeparam>
     /// <typeparam name="UnaryPredicate"></typeparam>
     /// <param name="source"></param>
     /// <param name="dest"></param>
-    /// <param name="eraseZeros"> - set to false for a performance increase (in some cases) at the expense of having to deal with the zeros later.</param>
+    /// <param name="shrinkDest"> - erase the elements of 'dest' past the ones copied, when 'dest' supports erase.</param>
     /// <param name="pred"></param>
+    /// <returns>The number of elements copied</returns>
     template <typename SOURCE, typename DEST, typename N>
-    inline constexpr void copy_if(
+    inline constexpr size_t copy_if(
         const SOURCE& source, 
         DEST& dest, 
         bool (*pred)(N), 
-        bool eraseZeros = true,
+        bool shrinkDest = true,
         size_t item_count = 0
     ) requires tpa::util::contiguous_seqeunce<SOURCE> && tpa::util::contiguous_seqeunce<DEST>
     {
         try
         {
-            static_assert(std::is_same<SOURCE::value_type, DEST::value_type>() == true, "Compile Error! The source and destination container must be of the same value type!");
+            static_assert(std::is_same<typename SOURCE::value_type, typename DEST::value_type>() == true, "Compile Error! The source and destination container must be of the same value type!");
 
             using T = SOURCE::value_type;
 
             //Prevent overflow
-            if (item_count <= 0 || item_count > source.size() || item_count > dest.size())
+            if (item_count <= 0 || item_count > source.size())
             {
-                item_count = dest.size();
+                item_count = source.size();
             }//End if
 
-            uint32_t complete = 0;
-
-            std::vector<std::pair<size_t, size_t>> sections;
-            tpa::util::prepareThreading(sections, item_count);
+            const tpa_copy_if_private::pred_filter<bool (*)(N)> filter{ pred };
 
-            std::vector<std::shared_future<uint32_t>> results;
-            results.reserve(tpa::nThreads);
+            const T* src = source.data();
+            T* out = dest.data();
 
-            std::shared_future<uint32_t> temp;
+            const size_t total = tpa_copy_if_private::compact_threaded(item_count,
+                [src, &filter](const size_t beg, const size_t end) { return tpa_copy_if_private::count_section<true>(beg, end, src, filter); },
+                [&dest](const size_t n) { if (n > dest.size()) { throw tpa::exceptions::ArrayTooSmall(); } },
+                [src, out, &filter](const size_t beg, const size_t end, const size_t offset) { tpa_copy_if_private::compact_section<true>(beg, end, src, out + offset, filter); });
 
-            for (const auto& sec : sections)
+            if constexpr (requires { dest.erase(dest.begin(), dest.end()); })
             {
-                temp = tpa::tp->addTask([&source, &dest, &pred, &sec]()
-                    {
-                        const size_t beg = sec.first;
-                        const size_t end = sec.second;
-                        size_t i = beg;
-
-#pragma region generic
-                        
-                        for (; i != end; ++i)
-                        {
-                            if (pred(source[i]) == true)
-                            {
-                                dest[i] = source[i];
-                            }//End else
-                        }//End for
-#pragma endregion
-                        return static_cast<uint32_t>(1);
-                    });//End of lambda
-
-                results.emplace_back(std::move(temp));
-            }//End for
-
-            for (const auto& fut : results)
-            {
-                complete += fut.get();
-            }//End for
-
-            //Check all threads completed
-            if (complete != tpa::nThreads)
-            {
-                throw tpa::exceptions::NotAllThreadsCompleted(complete);
+                if (shrinkDest == true)
+                {
+                    dest.erase(dest.begin() + total, dest.end());
+                }//End if
             }//End if
 
-            if (eraseZeros == true)
-            {
-                dest.erase(std::remove_if(std::execution::par_unseq, dest.begin(), dest.end(), [](T x) {return x == 0; }));
-            }//End if
+            return total;
         }//End try
         catch (const std::future_error& ex)
         {
             std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
             std::cerr << "Exception thrown in tpa::copy_if(): " << ex.code()
                 << " " << ex.what() << "\n";
+            return 0uz;
         }//End catch
         catch (const std::bad_alloc& ex)
         {
             std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
             std::cerr << "Exception thrown in tpa::copy_if(): " << ex.what() << "\n";
+            return 0uz;
         }//End catch
         catch (const std::exception& ex)
         {
             std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
             std::cerr << "Exception thrown in tpa::copy_if(): " << ex.what() << "\n";
+            return 0uz;
         }//End catch
         catch (...)
         {
             std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-            std::cerr << "Exception thrown in tpa::copy()_if: unknown!\n";
+            std::cerr << "Exception thrown in tpa::copy_if(): unknown!\n";
+            return 0uz;
         }//End catch
     }//End of copy_if
 
     /// <summary>
-    /// <para>Parallel Implementation of copy_if using a constexpr SIMD instructions, Copies data from SOURCE to DEST if the condtion matches</para>
-    /// <para>Uses AVX2</para>
+    /// <para>Parallel Implementation of copy_if using a constexpr predicate, copying the elements of SOURCE which match the condition to the front of DEST in their original order</para>
+    /// <para>Returns the number of elements copied, 'dest' only needs to be large enough to hold them.</para>
+    /// <para>The comparison conditions, EVEN and ODD are counted and left-packed with SIMD (VPCOMPRESS on AVX-512, a permute table on AVX2), the others one element at a time.</para>
     /// </summary>
     /// <typeparam name="DEST"></typeparam>
     /// <typeparam name="SOURCE"></typeparam>
     /// <typeparam name="P"></typeparam>
     /// <param name="source"></param>
     /// <param name="dest"></param>
-    /// <param name="eraseZeros"> - set to false for a performance increase (in some cases) at the expense of having to deal with the zeros later.</param>
+    /// <param name="shrinkDest"> - erase the elements of 'dest' past the ones copied, when 'dest' supports erase.</param>
     /// <param name="param">
     /// <para> -- Optional!  Only used with:        </para>
     /// <para>tpa::cond::EQUAL_TO		            </para>	
@@ -162,200 +510,78 @@ namespace tpa {
     /// <para>tpa::cond::GREATER_THAN               </para>
     /// <para>tpa::cond::GREATER_THAN_OR_EQUAL_TO   </para>
     /// <para>tpa::cond::POWER_OF</para>
+    /// <para>tpa::cond::DIVISIBLE_BY</para>
     /// <para>Other options not taking a parameter: </para>
     /// <para>tpa::cond::PRIME</para>
     /// <para>tpa::cond::EVEN</para>
     /// <para>tpa::cond::ODD</para>
     /// </param>
+    /// <returns>The number of elements copied</returns>
     template <tpa::cond COND, typename SOURCE, typename DEST, typename P = uint64_t>
-    inline constexpr void copy_if(
+    inline constexpr size_t copy_if(
         const SOURCE& source, 
         DEST& dest, 
-        bool eraseZeros = true, 
+        bool shrinkDest = true,
         P param = 0,
         size_t item_count = 0)
         requires tpa::util::contiguous_seqeunce<SOURCE>&& tpa::util::contiguous_seqeunce<DEST>
     {
         try
         {
-            static_assert(std::is_same<SOURCE::value_type, DEST::value_type>() == true, "Compile Error! The source and destination container must be of the same value type!");
+            static_assert(std::is_same<typename SOURCE::value_type, typename DEST::value_type>() == true, "Compile Error! The source and destination container must be of the same value type!");
 
             using T = SOURCE::value_type;
 
             //Prevent overflow
-            if (item_count <= 0 || item_count > source.size() || item_count > dest.size())
+            if (item_count <= 0 || item_count > source.size())
             {
-                item_count = dest.size();
+                item_count = source.size();
             }//End if
 
-            uint32_t complete = 0;
-
-            std::vector<std::pair<size_t, size_t>> sections;
-            tpa::util::prepareThreading(sections, item_count);
-
-            std::vector<std::shared_future<uint32_t>> results;
-            results.reserve(nThreads);
-
-            std::shared_future<uint32_t> temp;
-
-            for (const auto& sec : sections)
-            {
-                temp = tpa::tp->addTask([&source, &dest, &param, &sec]()
-                    {
-                        const size_t beg = sec.first;
-                        const size_t end = sec.second;
-                        size_t i = beg;
-
-#pragma region int
-						if constexpr (std::is_same<T, int32_t>() == true)
-						{
-#ifdef TPA_X86_64
-                            if (tpa::hasAVX2)
-                            {
-                                const __m256i _ZERO = _mm256_set1_epi32(0);
-                                const __m256i _ONE = _mm256_set1_epi32(1);
-                                const __m256i _TWO = _mm256_set1_epi32(2);
-                                __m256i _TEMP;
-                                __m256i _MASK;
-                                __m256 _MASKps;
-
-                                __m256i _SOURCE;
-
-                                for (; i+8 < end; i += 8)
-                                {                                    
-                                    //Set Values
-                                    _SOURCE = _mm256_load_si256((__m256i*) & source[i]);
-
-                                    //Filter
-                                    if constexpr (COND == tpa::cond::EVEN)
-                                    {
-                                        _TEMP = _mm256_rem_epi32(_SOURCE, _TWO);
-
-                                        _MASK = _mm256_cmpeq_epi32(_TEMP, _ZERO);
-
-                                        //Store Result
-                                        _mm256_maskstore_epi32((int*)&dest[i], _MASK, _SOURCE);
-                                    }//End if
-                                    else if constexpr (COND == tpa::cond::ODD)
-                                    {
-                                        _TEMP = _mm256_rem_epi32(_SOURCE, _TWO);
-
-                                        _MASKps = _mm256_cmp_ps(_mm256_castsi256_ps(_TEMP), _mm256_castsi256_ps(_ZERO), _CMP_NEQ_OQ);
-
-                                        //Store Result
-                                        _mm256_maskstore_epi32((int32_t*)&dest[i], _mm256_castps_si256(_MASKps), _SOURCE);
-                                    }//End if
-                                    else if constexpr (COND == tpa::cond::PRIME)
-                                    {
-                                        /*
-                                        __m256i _M = _mm256_div_epi32(_SOURCE, _TWO);
-                                        __m256i _I = _mm256_set1_epi32(static_cast<int32_t>(2));
-                                        __m256 _MUL;
-
-                                        _MUL = _mm256_mul_ps(
-                                            _mm256_castsi256_ps(_I),
-                                            _mm256_castsi256_ps(_I)
-                                        );
-
-                                        _MASKps = _mm256_cmp_ps(
-                                            _MUL,
-                                            _mm256_castsi256_ps(_M),
-                                            _CMP_LE_OQ
-                                        );
-
-                                        //Store Result
-                                        _mm256_maskstore_epi32((int32_t*)&dest[i], _mm256_castps_si256(_MASKps), _SOURCE);
-                                        */
-
-                                    }//End if
-                                    else
-                                    {
-                                        [] <bool flag = false>()
-                                        {
-                                            static_assert(flag, " You have specifed an invalid predicate function in tpa::copy_if<__UNDEFINED_PREDICATE__>(CONTAINER<int32_t>).");
-                                        }();
-                                    }//End else
-                                }//End for
-                            }//End if hasAVX2
-#endif
-							for (; i != end; ++i)
-							{
-								//Calc
-								if constexpr (COND == tpa::cond::EVEN)
-								{
-                                    if (tpa::util::isEven(source[i]))
-                                    {
-                                        dest[i] = source[i];
-                                    }//End if
-								}//End if
-                                else if constexpr (COND == tpa::cond::ODD)
-                                {
-                                    if (tpa::util::isOdd(source[i]))
-                                    {
-                                        dest[i] = source[i];
-                                    }//End if
-                                }//End if
-                                else if constexpr (COND == tpa::cond::PRIME)
-                                {
-                                    if (tpa::util::isPrime(source[i]))
-                                    {
-                                        dest[i] = source[i];
-                                    }//End if
-                                }//End if
-								else
-								{
-                                    [] <bool flag = false>()
-                                    {
-                                        static_assert(flag, " You have specifed an invalid predicate function in tpa::copy_if<__UNDEFINED_PREDICATE__>(CONTAINER<int32_t>).");
-                                    }();
-								}//End else
-							}//End for
-						}//End if
-#pragma endregion
-
-                        return static_cast<uint32_t>(1);
-                    });//End of lambda
+            const tpa_copy_if_private::cond_filter<COND, T, P> filter(param, true);
 
-                results.emplace_back(std::move(temp));
-            }//End for
+            const T* src = source.data();
+            T* out = dest.data();
 
-            for (const auto& fut : results)
-            {
-                complete += fut.get();
-            }//End for
+            const size_t total = tpa_copy_if_private::compact_threaded(item_count,
+                [src, &filter](const size_t beg, const size_t end) { return tpa_copy_if_private::count_section<true>(beg, end, src, filter); },
+                [&dest](const size_t n) { if (n > dest.size()) { throw tpa::exceptions::ArrayTooSmall(); } },
+                [src, out, &filter](const size_t beg, const size_t end, const size_t offset) { tpa_copy_if_private::compact_section<true>(beg, end, src, out + offset, filter); });
 
-            //Check all threads completed
-            if (complete != nThreads)
+            if constexpr (requires { dest.erase(dest.begin(), dest.end()); })
             {
-                throw tpa::exceptions::NotAllThreadsCompleted(complete);
+                if (shrinkDest == true)
+                {
+                    dest.erase(dest.begin() + total, dest.end());
+                }//End if
             }//End if
 
-            if (eraseZeros == true)
-            {
-                //Remove all zeros from dest
-                dest.erase(std::remove_if(std::execution::par_unseq, dest.begin(), dest.end(), [](T x) {return x == static_cast<T>(0); }));
-            }//End if
+            return total;
         }//End try
         catch (const std::future_error& ex)
         {
             std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
             std::cerr << "Exception thrown in tpa::copy_if(): " << ex.code()
                 << " " << ex.what() << "\n";
+            return 0uz;
         }//End catch
         catch (const std::bad_alloc& ex)
         {
             std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
             std::cerr << "Exception thrown in tpa::copy_if(): " << ex.what() << "\n";
+            return 0uz;
         }//End catch
         catch (const std::exception& ex)
         {
             std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
             std::cerr << "Exception thrown in tpa::copy_if(): " << ex.what() << "\n";
+            return 0uz;
         }//End catch
         catch (...)
         {
             std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
             std::cerr << "Exception thrown in tpa::copy_if(): unknown!\n";
+            return 0uz;
         }//End catch
     }//End of copy_if
 #pragma endregion
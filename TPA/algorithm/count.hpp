@@ -17,6 +17,10 @@
 #include <utility>
 #include <iostream>
 #include <future>
+#include <limits>
+
+#include <array>
+#include <vector>
 
 #include "../tpa.hpp"
 #include "../ThreadPool.hpp"
@@ -27,6 +31,178 @@
 #include "../tpa_concepts.hpp"
 #include "../InstructionSet.hpp"
 #include "../simd/simd.hpp"
+#include "../simd/dispatch.hpp"
+#include "../simd/vec.hpp"
+
+/// <summary>
+/// <para>Private Namespace for the TPA count kernels.</para>
+/// </summary>
+namespace tpa_count_private
+{
+    /// <summary>
+    /// <para>True if the count kernels can test COND on a tpa::simd::vec of T, other conditions are counted one element at a time.</para>
+    /// </summary>
+    template<tpa::cond COND, typename T>
+    inline constexpr bool vec_countable = tpa::simd::is_vec_type<T> &&
+        (COND == tpa::cond::EQUAL_TO || COND == tpa::cond::NOT_EQUAL_TO ||
+        COND == tpa::cond::LESS_THAN || COND == tpa::cond::LESS_THAN_OR_EQUAL_TO ||
+        COND == tpa::cond::GREATER_THAN || COND == tpa::cond::GREATER_THAN_OR_EQUAL_TO ||
+        ((COND == tpa::cond::EVEN || COND == tpa::cond::ODD) && std::is_integral<T>::value));
+
+    /// <summary>
+    /// <para>Returns true if 'x' satisfies COND against 'para'.</para>
+    /// </summary>
+    template<tpa::cond COND, typename T>
+    [[nodiscard]] inline bool matches(const T x, const T para) noexcept
+    {
+        if constexpr (COND == tpa::cond::EQUAL_TO) { return x == para; }
+        else if constexpr (COND == tpa::cond::NOT_EQUAL_TO) { return x != para; }
+        else if constexpr (COND == tpa::cond::LESS_THAN) { return x < para; }
+        else if constexpr (COND == tpa::cond::LESS_THAN_OR_EQUAL_TO) { return x <= para; }
+        else if constexpr (COND == tpa::cond::GREATER_THAN) { return x > para; }
+        else if constexpr (COND == tpa::cond::GREATER_THAN_OR_EQUAL_TO) { return x >= para; }
+        else if constexpr (COND == tpa::cond::EVEN) { return tpa::util::isEven(x); }
+        else { return tpa::util::isOdd(x); }
+    }//End of matches
+
+    /// <summary>
+    /// <para>Returns the lanes of '_val' which satisfy COND against '_para'.</para>
+    /// </summary>
+    template<tpa::cond COND, typename T, size_t W>
+    [[nodiscard]] TPA_FORCE_INLINE tpa::simd::mask<T, W> matches(const tpa::simd::vec<T, W> _val, const tpa::simd::vec<T, W> _para) noexcept
+    {
+        using V = tpa::simd::vec<T, W>;
+
+        if constexpr (COND == tpa::cond::EQUAL_TO) { return _val == _para; }
+        else if constexpr (COND == tpa::cond::NOT_EQUAL_TO) { return _val != _para; }
+        else if constexpr (COND == tpa::cond::LESS_THAN) { return _val < _para; }
+        else if constexpr (COND == tpa::cond::LESS_THAN_OR_EQUAL_TO) { return _val <= _para; }
+        else if constexpr (COND == tpa::cond::GREATER_THAN) { return _val > _para; }
+        else if constexpr (COND == tpa::cond::GREATER_THAN_OR_EQUAL_TO) { return _val >= _para; }
+        else if constexpr (COND == tpa::cond::EVEN) { return (_val & V(static_cast<T>(1))) == V(static_cast<T>(0)); }
+        else { return (_val & V(static_cast<T>(1))) != V(static_cast<T>(0)); }
+    }//End of matches
+
+    /// <summary>
+    /// <para>Adds the number of elements of [i, end) which satisfy COND to 'total' with tpa::simd::vec&lt;T, W&gt;, 'i' is advanced past the elements processed.</para>
+    /// <para>Matches are counted in unsigned lanes as wide as T, and the lanes are widened into 'total' before any of them can wrap (every 255 steps for 8-bit and 65535 for 16-bit), so the count is exact at any size.</para>
+    /// </summary>
+    template<size_t W, tpa::cond COND, typename T>
+    TPA_FORCE_INLINE void count_block(size_t& i, const size_t end, const T* arr, const T para, uint64_t& total) noexcept
+    {
+        using U = std::conditional_t<sizeof(T) == 1uz, uint8_t, std::conditional_t<sizeof(T) == 2uz, uint16_t, std::conditional_t<sizeof(T) == 4uz, uint32_t, uint64_t>>>;
+        using V = tpa::simd::vec<T, W>;
+        using C = tpa::simd::vec<U, W>;
+
+        constexpr size_t A = tpa::simd::unroll;
+        constexpr size_t step = W * A;
+        constexpr size_t flush_every = (sizeof(U) < 4uz) ? static_cast<size_t>(std::numeric_limits<U>::max()) : (1uz << 31);
+
+        const V _para(para);
+        const C _one(static_cast<U>(1));
+        const C _zero(static_cast<U>(0));
+
+        while ((i + step) <= end)
+        {
+            const size_t iters = tpa::util::min((end - i) / step, flush_every);
+
+            std::array<C, A> _count;
+            _count.fill(_zero);
+
+            for (size_t k = 0uz; k != iters; ++k, i += step)
+            {
+                tpa::simd::prefetch<step * sizeof(T)>(arr + i);
+
+                for (size_t a = 0uz; a < A; ++a)
+                {
+                    const auto _m = tpa_count_private::matches<COND>(V::load(arr + i + (W * a)), _para);
+
+                    _count[a] = _count[a] + tpa::simd::select(tpa::simd::mask_cast<U>(_m), _one, _zero);
+                }//End for
+            }//End for
+
+            //Widen the lanes before they can wrap
+            for (size_t a = 0uz; a < A; ++a)
+            {
+                U lanes[W];
+                _count[a].store(lanes);
+
+                for (size_t l = 0uz; l != W; ++l)
+                {
+                    total += static_cast<uint64_t>(lanes[l]);
+                }//End for
+            }//End for
+        }//End while
+    }//End of count_block
+
+    /// <summary>
+    /// <para>Adds the number of elements of [i, end) which satisfy COND to 'total' one at a time, also used to finish the leftovers of the SIMD kernels.</para>
+    /// </summary>
+    template<tpa::cond COND, typename T>
+    inline void count_scalar(size_t& i, const size_t end, const T* arr, const T para, uint64_t& total) noexcept
+    {
+        for (; i != end; ++i)
+        {
+            if (tpa_count_private::matches<COND>(arr[i], para))
+            {
+                ++total;
+            }//End if
+        }//End for
+    }//End of count_scalar
+
+#ifdef TPA_X86_64
+    template<tpa::cond COND, typename T>
+    TPA_TARGET_SSE41 inline void count_sse41(size_t& i, const size_t end, const T* arr, const T para, uint64_t& total) noexcept
+    {
+        tpa_count_private::count_block<16uz / sizeof(T), COND>(i, end, arr, para, total);
+        tpa_count_private::count_scalar<COND>(i, end, arr, para, total);
+    }//End of count_sse41
+
+    template<tpa::cond COND, typename T>
+    TPA_TARGET_AVX2 inline void count_avx2(size_t& i, const size_t end, const T* arr, const T para, uint64_t& total) noexcept
+    {
+        tpa_count_private::count_block<32uz / sizeof(T), COND>(i, end, arr, para, total);
+        tpa_count_private::count_scalar<COND>(i, end, arr, para, total);
+    }//End of count_avx2
+
+    template<tpa::cond COND, typename T>
+    TPA_TARGET_AVX512 inline void count_avx512(size_t& i, const size_t end, const T* arr, const T para, uint64_t& total) noexcept
+    {
+        tpa_count_private::count_block<64uz / sizeof(T), COND>(i, end, arr, para, total);
+        tpa_count_private::count_scalar<COND>(i, end, arr, para, total);
+    }//End of count_avx512
+#elif defined(TPA_NEON)
+    template<tpa::cond COND, typename T>
+    inline void count_vec_neon(size_t& i, const size_t end, const T* arr, const T para, uint64_t& total) noexcept
+    {
+        tpa_count_private::count_block<16uz / sizeof(T), COND>(i, end, arr, para, total);
+        tpa_count_private::count_scalar<COND>(i, end, arr, para, total);
+    }//End of count_vec_neon
+#endif
+
+    /// <summary>
+    /// <para>Returns the kernels counting the elements which satisfy COND, see count_block.</para>
+    /// </summary>
+    template<tpa::cond COND, typename T>
+    [[nodiscard]] inline auto count_kernels() noexcept
+    {
+        tpa::simd::kernel_table<void(size_t&, const size_t, const T*, const T, uint64_t&)> table;
+        table.scalar = &tpa_count_private::count_scalar<COND, T>;
+
+        if constexpr (tpa_count_private::vec_countable<COND, T>)
+        {
+#ifdef TPA_X86_64
+            table.sse41 = &tpa_count_private::count_sse41<COND, T>;
+            table.avx2 = &tpa_count_private::count_avx2<COND, T>;
+            table.avx512 = &tpa_count_private::count_avx512<COND, T>;
+#elif defined(TPA_NEON)
+            table.neon = &tpa_count_private::count_vec_neon<COND, T>;
+#endif
+        }//End if
+
+        return table;
+    }//End of count_kernels
+}//End of namespace
 
 /// <summary>
 /// <para>Truly Parallel Algorithms</para>
@@ -40,23 +216,21 @@ namespace tpa {
     /// <para>The return type must be specifed as a template argument.</para>
     /// <para>The type of 'value' must be identical to the value_type of 'arr'</para>
     /// <para>Uses multi-threading and SIMD where available</para>
-    /// <para>WARNING! 8-bit and 16-bit integral types have very limted 
-    /// range and using SIMD to count them can produce incorrect results when you pass containers of more than 1,000,000 elements.</para>
-    /// <para>If passing an array of 8-bit with > 1,000,000 or 16-bith with > 100,000,000 elements set useSIMD to false.</para>
+    /// <para>The SIMD counters are widened before they can wrap, so 8-bit and 16-bit containers are counted exactly at any size.</para>
     /// </summary>
     /// <typeparam name="RETURN_T"></typeparam>
     /// <typeparam name="ARR"></typeparam>
     /// <typeparam name="T"></typeparam>
     /// <param name="arr"></param>
     /// <param name="value"></param>
-    /// <param name="useSIMD"> Set me to false to fix incorrect results from large 8-bit and 16-bit int containers</param>
+    /// <param name="useSIMD"> Set me to false to count without SIMD</param>
     /// <returns></returns>
     template <typename RETURN_T, typename ARR, typename T>
     inline RETURN_T count(const ARR& arr, T value, const bool useSIMD = true) requires tpa::util::contiguous_seqeunce<ARR> && tpa::util::calculatable<T> && tpa::util::calculatable<RETURN_T>
     {
         try
         {
-            static_assert(std::is_same<T,ARR::value_type>(), "Error in tpa::count: The type of 'value' must be identical to the value_type of the container 'arr'");
+            static_assert(std::is_same<T,typename ARR::value_type>(), "Error in tpa::count: The type of 'value' must be identical to the value_type of the container 'arr'");
 
             uint32_t complete = 0u;
             RETURN_T count = 0;
@@ -69,6 +243,9 @@ namespace tpa {
 
             std::shared_future<RETURN_T> temp;
 
+            //Built on first use, not per call
+            static const auto kernels = tpa_count_private::count_kernels<tpa::cond::EQUAL_TO, T>();
+
             for (const auto& sec : sections)
             {
                 temp = tpa::tp->addTask([&arr, &value, &useSIMD, &sec]()
@@ -80,624 +257,12 @@ namespace tpa {
                     const T val = value;
                     RETURN_T cnt = 0;
 
-#pragma region byte
-                    if constexpr (std::is_same<T, int8_t>())
-                    {
-#ifdef TPA_X86_64
-                        if (tpa::hasAVX512_ByteWord && useSIMD)
-                        {
-                            const __m512i _val = _mm512_set1_epi8(val);
-                            __m512i _arr = _mm512_setzero_si512();
-                            __mmask64 _mask;
-                            __m512i _count = _mm512_setzero_si512();
-
-                            for (; (i + 64uz) < end; i += 64uz)
-                            {
-                                _arr = _mm512_loadu_epi8(&arr[i]);
-
-                                _mask = _mm512_cmpeq_epi8_mask(_arr, _val);
-
-                                _count = _mm512_sub_epi8(_count, _mm512_set1_epi8(_mask));
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm512_sum_epi8(_count));
-                        }//End if
-                        else if (tpa::hasAVX2 && useSIMD)
-                        {
-                            const __m256i _val = _mm256_set1_epi8(val);
-                            __m256i _arr = _mm256_setzero_si256();
-                            __m256i _mask = _mm256_setzero_si256();
-                            __m256i _count = _mm256_setzero_si256();
-
-                            for (; (i + 32uz) < end; i += 32uz)
-                            {
-                                _arr = _mm256_load_si256((__m256i*) &arr[i]);
-
-                                _mask = _mm256_cmpeq_epi8(_arr, _val);
-
-                                _count = _mm256_sub_epi8(_count, _mask);
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm256_sum_epi8(_count));
-
-                        }//End if
-                        else if (tpa::has_SSE2 && useSIMD)
-                        {
-                            const __m128i _val = _mm_set1_epi8(val);
-                            __m128i _arr = _mm_setzero_si128();
-                            __m128i _mask = _mm_setzero_si128();
-                            __m128i _count = _mm_setzero_si128();
-
-                            for (; (i + 16uz) < end; i += 16uz)
-                            {
-                                _arr = _mm_load_si128((__m128i*) & arr[i]);
-
-                                _mask = _mm_cmpeq_epi8(_arr, _val);
-
-                                _count = _mm_sub_epi8(_count, _mask);
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm_sum_epi8(_count));
-                        }//End if
-#endif
-                    }//End if
-#pragma endregion
-#pragma region unsigned byte
-                    if constexpr (std::is_same<T, uint8_t>())
-                    {
-#ifdef TPA_X86_64
-                        if (tpa::hasAVX512_ByteWord && useSIMD)
-                        {
-                            const __m512i _val = _mm512_set1_epi8(val);
-                            __m512i _arr = _mm512_setzero_si512();
-                            __mmask64 _mask;
-                            __m512i _count = _mm512_setzero_si512();
-
-                            for (; (i + 64uz) < end; i += 64uz)
-                            {
-                                _arr = _mm512_loadu_epi8(&arr[i]);
-
-                                _mask = _mm512_cmpeq_epi8_mask(_arr, _val);
-
-                                _count = _mm512_sub_epi8(_count, _mm512_set1_epi8(_mask));
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm512_sum_epi8(_count));
-                        }//End if
-                        else if (tpa::hasAVX2 && useSIMD)
-                        {
-                            const __m256i _val = _mm256_set1_epi8(val);
-                            __m256i _arr = _mm256_setzero_si256();
-                            __m256i _mask = _mm256_setzero_si256();
-                            __m256i _count = _mm256_setzero_si256();
-
-                            for (; (i + 32uz) < end; i += 32uz)
-                            {
-                                _arr = _mm256_load_si256((__m256i*) & arr[i]);
-
-                                _mask = _mm256_cmpeq_epi8(_arr, _val);
-
-                                _count = _mm256_sub_epi8(_count, _mask);
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm256_sum_epi8(_count));
-
-                        }//End if
-                        else if (tpa::has_SSE2 && useSIMD)
-                        {
-                            const __m128i _val = _mm_set1_epi8(val);
-                            __m128i _arr = _mm_setzero_si128();
-                            __m128i _mask = _mm_setzero_si128();
-                            __m128i _count = _mm_setzero_si128();
-
-                            for (; (i + 16uz) < end; i += 16uz)
-                            {
-                                _arr = _mm_load_si128((__m128i*) & arr[i]);
-
-                                _mask = _mm_cmpeq_epi8(_arr, _val);
-
-                                _count = _mm_sub_epi8(_count, _mask);
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm_sum_epi8(_count));
-                        }//End if
-#endif
-                    }//End if
-#pragma endregion
-#pragma region short
-                    if constexpr (std::is_same<T, int16_t>())
-                    {
-#ifdef TPA_X86_64
-                        if (tpa::hasAVX512_ByteWord && useSIMD)
-                        {
-                            const __m512i _val = _mm512_set1_epi16(val);
-                            __m512i _arr = _mm512_setzero_si512();
-                            __mmask32 _mask;
-                            __m512i _count = _mm512_setzero_si512();
-
-                            for (; (i + 32uz) < end; i += 32uz)
-                            {
-                                _arr = _mm512_loadu_epi16(&arr[i]);
-
-                                _mask = _mm512_cmpeq_epi16_mask(_arr, _val);
-
-                                _count = _mm512_sub_epi16(_count, _mm512_set1_epi16(_mask));
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm512_sum_epi16(_count));
-                        }//End if
-                        else if (tpa::hasAVX2 && useSIMD)
-                        {
-                            const __m256i _val = _mm256_set1_epi16(val);
-                            __m256i _arr = _mm256_setzero_si256();
-                            __m256i _mask = _mm256_setzero_si256();
-                            __m256i _count = _mm256_setzero_si256();
-
-                            for (; (i + 16uz) < end; i += 16uz)
-                            {
-                                _arr = _mm256_load_si256((__m256i*) & arr[i]);
-
-                                _mask = _mm256_cmpeq_epi16(_arr, _val);
-
-                                _count = _mm256_sub_epi16(_count, _mask);
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm256_sum_epi16(_count));
-
-                        }//End if
-                        else if (tpa::has_SSE2 && useSIMD)
-                        {
-                            const __m128i _val = _mm_set1_epi16(val);
-                            __m128i _arr = _mm_setzero_si128();
-                            __m128i _mask = _mm_setzero_si128();
-                            __m128i _count = _mm_setzero_si128();
-
-                            for (; (i + 8uz) < end; i += 8uz)
-                            {
-                                _arr = _mm_load_si128((__m128i*) & arr[i]);
-
-                                _mask = _mm_cmpeq_epi16(_arr, _val);
-
-                                _count = _mm_sub_epi16(_count, _mask);
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm_sum_epi16(_count));
-                        }//End if
-#endif
-                    }//End if
-#pragma endregion
-#pragma region unsigned short
-                    if constexpr (std::is_same<T, uint16_t>())
-                    {
-#ifdef TPA_X86_64
-                        if (tpa::hasAVX512_ByteWord && useSIMD)
-                        {
-                            const __m512i _val = _mm512_set1_epi16(val);
-                            __m512i _arr = _mm512_setzero_si512();
-                            __mmask32 _mask;
-                            __m512i _count = _mm512_setzero_si512();
-
-                            for (; (i + 32uz) < end; i += 32uz)
-                            {
-                                _arr = _mm512_loadu_epi16(&arr[i]);
-
-                                _mask = _mm512_cmpeq_epi16_mask(_arr, _val);
-
-                                _count = _mm512_sub_epi16(_count, _mm512_set1_epi16(_mask));
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm512_sum_epi16(_count));
-                        }//End if
-                        else if (tpa::hasAVX2 && useSIMD)
-                        {
-                            const __m256i _val = _mm256_set1_epi16(val);
-                            __m256i _arr = _mm256_setzero_si256();
-                            __m256i _mask = _mm256_setzero_si256();
-                            __m256i _count = _mm256_setzero_si256();
-
-                            for (; (i + 16uz) < end; i += 16uz)
-                            {
-                                _arr = _mm256_load_si256((__m256i*) & arr[i]);
-
-                                _mask = _mm256_cmpeq_epi16(_arr, _val);
-
-                                _count = _mm256_sub_epi16(_count, _mask);
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm256_sum_epi16(_count));
-
-                        }//End if
-                        else if (tpa::has_SSE2 && useSIMD)
-                        {
-                            const __m128i _val = _mm_set1_epi16(val);
-                            __m128i _arr = _mm_setzero_si128();
-                            __m128i _mask = _mm_setzero_si128();
-                            __m128i _count = _mm_setzero_si128();
-
-                            for (; (i + 8uz) < end; i += 8uz)
-                            {
-                                _arr = _mm_load_si128((__m128i*) & arr[i]);
-
-                                _mask = _mm_cmpeq_epi16(_arr, _val);
-
-                                _count = _mm_sub_epi16(_count, _mask);
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm_sum_epi16(_count));
-                        }//End if
-#endif
-                    }//End if
-#pragma endregion
-#pragma region int                    
-                    if constexpr (std::is_same<T, int32_t>())
-                    {
-#ifdef TPA_X86_64
-                        if (tpa::hasAVX512 && useSIMD)
-                        {
-                            const __m512i _val = _mm512_set1_epi32(val);
-                            __m512i _arr = _mm512_setzero_si512();
-                            __mmask16 _mask;
-                            __m512i _count = _mm512_setzero_epi32();
-
-                            for (; (i + 16uz) < end; i += 16uz)
-                            {
-                                _arr = _mm512_load_epi32(&arr[i]);
-
-                                _mask = _mm512_cmpeq_epi32_mask(_arr, _val);
-
-                                _count = _mm512_sub_epi32(_count, _mm512_set1_epi32(_mask));
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm512_sum_epi32(_count));
-                        }//End if
-                        else if (tpa::hasAVX2 && useSIMD)
-                        {
-                            const __m256i _val = _mm256_set1_epi32(val);
-                            __m256i _arr = _mm256_setzero_si256();
-                            __m256i _mask = _mm256_setzero_si256();
-                            __m256i _count = _mm256_setzero_si256();
-
-                            for (; (i + 8uz) < end; i += 8uz)
-                            {
-                                _arr = _mm256_load_si256((__m256i*) &arr[i]);
-
-                                _mask = _mm256_cmpeq_epi32(_arr, _val);
-
-                                _count = _mm256_sub_epi32(_count, _mask);
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm256_sum_epi32(_count));
-
-                        }//End if
-                        else if (tpa::has_SSE2 && useSIMD)
-                        {
-                            const __m128i _val = _mm_set1_epi32(val);
-                            __m128i _arr = _mm_setzero_si128();
-                            __m128i _mask = _mm_setzero_si128();
-                            __m128i _count = _mm_setzero_si128();
-
-                            for (; (i + 4uz) < end; i += 4uz)
-                            {
-                                _arr = _mm_load_si128((__m128i*) &arr[i]);
-
-                                _mask = _mm_cmpeq_epi32(_arr, _val);
-
-                                _count = _mm_sub_epi32(_count, _mask);
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm_sum_epi32(_count));
-                        }//End if
-#endif
-                    }//End if
-#pragma endregion
-#pragma region unsigned int
-                    if constexpr (std::is_same<T, uint32_t>())
-                    {
-#ifdef TPA_X86_64
-                        if (tpa::hasAVX512 && useSIMD)
-                        {
-                            const __m512i _val = _mm512_set1_epi32(val);
-                            __m512i _arr = _mm512_setzero_si512();
-                            __mmask16 _mask;
-                            __m512i _count = _mm512_setzero_epi32();
-
-                            for (; (i + 16uz) < end; i += 16uz)
-                            {
-                                _arr = _mm512_load_epi32(&arr[i]);
-
-                                _mask = _mm512_cmpeq_epi32_mask(_arr, _val);
-
-                                _count = _mm512_sub_epi32(_count, _mm512_set1_epi32(_mask));
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm512_sum_epi32(_count));
-                        }//End if
-                        else if (tpa::hasAVX2 && useSIMD)
-                        {
-                            const __m256i _val = _mm256_set1_epi32(val);
-                            __m256i _arr = _mm256_setzero_si256();
-                            __m256i _mask = _mm256_setzero_si256();
-                            __m256i _count = _mm256_setzero_si256();
-
-                            for (; (i + 8uz) < end; i += 8uz)
-                            {
-                                _arr = _mm256_load_si256((__m256i*) & arr[i]);
-
-                                _mask = _mm256_cmpeq_epi32(_arr, _val);
-
-                                _count = _mm256_sub_epi32(_count, _mask);
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm256_sum_epi32(_count));
-
-                        }//End if
-                        else if (tpa::has_SSE2 && useSIMD)
-                        {
-                            const __m128i _val = _mm_set1_epi32(val);
-                            __m128i _arr = _mm_setzero_si128();
-                            __m128i _mask = _mm_setzero_si128();
-                            __m128i _count = _mm_setzero_si128();
-
-                            for (; (i + 4uz) < end; i += 4uz)
-                            {
-                                _arr = _mm_load_si128((__m128i*) & arr[i]);
-
-                                _mask = _mm_cmpeq_epi32(_arr, _val);
-
-                                _count = _mm_sub_epi32(_count, _mask);
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm_sum_epi32(_count));
-                        }//End if
-#endif
-                    }//End if
-#pragma endregion
-#pragma region long
-                    if constexpr (std::is_same<T, int64_t>())
-                    {
-#ifdef TPA_X86_64
-                        if (tpa::hasAVX512 && useSIMD)
-                        {
-                            const __m512i _val = _mm512_set1_epi64(val);
-                            __m512i _arr = _mm512_setzero_si512();
-                            __mmask8 _mask;
-                            __m512i _count = _mm512_setzero_si512();
-
-                            for (; (i + 8uz) < end; i += 8uz)
-                            {
-                                _arr = _mm512_load_epi64(&arr[i]);
-
-                                _mask = _mm512_cmpeq_epi64_mask(_arr, _val);
-
-                                _count = _mm512_sub_epi64(_count, _mm512_set1_epi64(_mask));
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm512_sum_epi64(_count));
-                        }//End if
-                        else if (tpa::hasAVX2 && useSIMD)
-                        {
-                            const __m256i _val = _mm256_set1_epi64x(val);
-                            __m256i _arr = _mm256_setzero_si256();
-                            __m256i _mask = _mm256_setzero_si256();
-                            __m256i _count = _mm256_setzero_si256();
-
-                            for (; (i + 4uz) < end; i += 4uz)
-                            {
-                                _arr = _mm256_load_si256((__m256i*) & arr[i]);
-
-                                _mask = _mm256_cmpeq_epi64(_arr, _val);
-
-                                _count = _mm256_sub_epi64(_count, _mask);
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm256_sum_epi64(_count));
-
-                        }//End if
-                        else if (tpa::has_SSE41 && useSIMD)
-                        {
-                            const __m128i _val = _mm_set1_epi64x(val);
-                            __m128i _arr = _mm_setzero_si128();
-                            __m128i _mask = _mm_setzero_si128();
-                            __m128i _count = _mm_setzero_si128();
-
-                            for (; (i + 2uz) < end; i += 2uz)
-                            {
-                                _arr = _mm_load_si128((__m128i*) & arr[i]);
-
-                                _mask = _mm_cmpeq_epi64(_arr, _val);
-
-                                _count = _mm_sub_epi64(_count, _mask);
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm_sum_epi64(_count));
-                        }//End if
-#endif
-                    }//End if
-#pragma endregion
-#pragma region unsigned long
-                    if constexpr (std::is_same<T, uint64_t>())
-                    {
-#ifdef _M_AMD64
-                        if (tpa::hasAVX512 && useSIMD)
-                        {
-                            const __m512i _val = _mm512_set1_epi64(val);
-                            __m512i _arr = _mm512_setzero_si512();
-                            __mmask8 _mask;
-                            __m512i _count = _mm512_setzero_si512();
-
-                            for (; (i + 8uz) < end; i += 8uz)
-                            {
-                                _arr = _mm512_load_epi64(&arr[i]);
-
-                                _mask = _mm512_cmpeq_epi64_mask(_arr, _val);
-
-                                _count = _mm512_sub_epi64(_count, _mm512_set1_epi64(_mask));
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm512_sum_epi64(_count));
-                        }//End if
-                        else if (tpa::hasAVX2 && useSIMD)
-                        {
-                            const __m256i _val = _mm256_set1_epi64x(val);
-                            __m256i _arr = _mm256_setzero_si256();
-                            __m256i _mask = _mm256_setzero_si256();
-                            __m256i _count = _mm256_setzero_si256();
-
-                            for (; (i + 4uz) < end; i += 4uz)
-                            {
-                                _arr = _mm256_load_si256((__m256i*) & arr[i]);
-
-                                _mask = _mm256_cmpeq_epi64(_arr, _val);
-
-                                _count = _mm256_sub_epi64(_count, _mask);
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm256_sum_epi64(_count));
-
-                        }//End if
-                        else if (tpa::has_SSE41 && useSIMD)
-                        {
-                            const __m128i _val = _mm_set1_epi64x(val);
-                            __m128i _arr = _mm_setzero_si128();
-                            __m128i _mask = _mm_setzero_si128();
-                            __m128i _count = _mm_setzero_si128();
-
-                            for (; (i + 2uz) < end; i += 2uz)
-                            {
-                                _arr = _mm_load_si128((__m128i*) & arr[i]);
-
-                                _mask = _mm_cmpeq_epi64(_arr, _val);
-
-                                _count = _mm_sub_epi64(_count, _mask);
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm_sum_epi64(_count));
-                        }//End if
-#endif
-                    }//End if
-#pragma endregion
-#pragma region float
-                    if constexpr (std::is_same<T, float>())
-                    {
-#ifdef TPA_X86_64
-                        if (tpa::hasAVX512 && useSIMD)
-                        {
-                            const __m512 _val = _mm512_set1_ps(val);
-                            __m512 _arr = _mm512_setzero_ps();
-                            __mmask16 _mask;
-                            __m512 _count = _mm512_setzero_ps();
-
-                            for (; (i + 16uz) < end; i += 16uz)
-                            {
-                                _arr = _mm512_load_ps(&arr[i]);
-
-                                _mask = _mm512_cmpeq_ps_mask(_arr, _val);
-
-                                _count = _mm512_sub_ps(_count, _mm512_set1_ps(_mask));
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm512_sum_ps(_count));
-                        }//End if
-                        else if (tpa::hasAVX2 && useSIMD)
-                        {
-                            const __m256 _val = _mm256_set1_ps(val);
-                            __m256 _arr = _mm256_setzero_ps();
-                            __m256i _mask = _mm256_setzero_si256();
-                            __m256 _count = _mm256_setzero_ps();
-
-                            for (; (i + 8uz) < end; i += 8uz)
-                            {
-                                _arr = _mm256_load_ps(&arr[i]);
-
-                                _mask = _mm256_castps_si256(_mm256_cmp_ps(_arr, _val, _CMP_EQ_OQ));
-
-                                _count = _mm256_sub_ps(_count, _mm256_cvtepi32_ps(_mask));
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm256_sum_ps(_count));
-
-                        }//End if
-                        else if (tpa::has_SSE && useSIMD)
-                        {
-                            const __m128 _val = _mm_set1_ps(val);
-                            __m128 _arr = _mm_setzero_ps();
-                            __m128i _mask = _mm_setzero_si128();
-                            __m128 _count = _mm_setzero_ps();
-
-                            for (; (i + 4uz) < end; i += 4uz)
-                            {
-                                _arr = _mm_load_ps(&arr[i]);
-
-                                _mask = _mm_castps_si128(_mm_cmpeq_ps(_arr, _val));
-
-                                _count = _mm_sub_ps(_count, _mm_cvtepi32_ps(_mask));
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm_sum_ps(_count));
-                        }//End if
-#endif
-                    }//End if
-#pragma endregion
-#pragma region double
-                    if constexpr (std::is_same<T, double>())
+#pragma region simd
+                    if (useSIMD)
                     {
-#ifdef TPA_X86_64
-                        if (tpa::hasAVX512 && useSIMD)
-                        {
-                            const __m512d _val = _mm512_set1_pd(val);
-                            __m512d _arr = _mm512_setzero_pd();
-                            __mmask8 _mask;
-                            __m512d _count = _mm512_setzero_pd();
-
-                            for (; (i + 8uz) < end; i += 8uz)
-                            {
-                                _arr = _mm512_load_pd(&arr[i]);
-
-                                _mask = _mm512_cmpeq_pd_mask(_arr, _val);
-
-                                _count = _mm512_sub_pd(_count, _mm512_set1_pd(_mask));
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm512_sum_pd(_count));
-                        }//End if
-                        else if (tpa::hasAVX && useSIMD)
-                        {
-                            const __m256d _val = _mm256_set1_pd(val);
-                            __m256d _arr = _mm256_setzero_pd();
-                            __m256i _mask = _mm256_setzero_si256();
-                            __m256d _count = _mm256_setzero_pd();
-
-                            for (; (i + 4uz) < end; i += 4uz)
-                            {
-                                _arr = _mm256_load_pd(&arr[i]);
-
-                                _mask = _mm256_castpd_si256(_mm256_cmp_pd(_arr, _val, _CMP_EQ_OQ));
-
-                                _count = _mm256_sub_pd(_count, tpa::simd::_mm256_cvtepi64_pd(_mask));
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm256_sum_pd(_count));
-
-                        }//End if
-                        else if (tpa::has_SSE2 && useSIMD)
-                        {
-                            const __m128d _val = _mm_set1_pd(val);
-                            __m128d _arr = _mm_setzero_pd();
-                            __m128i _mask = _mm_setzero_si128();
-                            __m128d _count = _mm_setzero_pd();
-
-                            for (; (i + 4uz) < end; i += 4uz)
-                            {
-                                _arr = _mm_load_pd(&arr[i]);
-
-                                _mask = _mm_castpd_si128(_mm_cmpeq_pd(_arr, _val));
-
-                                _count = _mm_sub_pd(_count, tpa::simd::_mm_cvtepi64_pd(_mask));
-                            }//End for
-
-                            cnt = static_cast<RETURN_T>(tpa::simd::_mm_sum_pd(_count));
-                        }//End if
-#endif
+                        uint64_t total = 0ull;
+                        kernels.resolve_for((end - beg) * sizeof(T))(i, end, arr.data(), val, total);
+                        cnt += static_cast<RETURN_T>(total);
                     }//End if
 #pragma endregion
 #pragma region generic
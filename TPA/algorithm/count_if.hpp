@@ -17,6 +17,7 @@
 #include <utility>
 #include <iostream>
 #include <future>
+#include <bit>
 
 #include "../tpa.hpp"
 #include "../ThreadPool.hpp"
@@ -27,6 +28,10 @@
 #include "../tpa_concepts.hpp"
 #include "../InstructionSet.hpp"
 #include "../simd/simd.hpp"
+#include "../simd/dispatch.hpp"
+#include "../simd/vec.hpp"
+
+#include "count.hpp"
 
 /// <summary>
 /// <para>Truly Parallel Algorithms</para>
@@ -135,9 +140,7 @@ namespace tpa {
     /// <para>Count the number of items in the container 'arr' which match the constraints of the unary predicate 'PRED'</para>
     /// <para>The return type is templated and must be specifed.</para>
     /// <para>This implementation uses multi-threading and SIMD where available.</para>
-    /// <para>WARNING! 8-bit and 16-bit integral types have very limted 
-    /// range and using SIMD to count them can produce incorrect results when you pass containers of more than 1,000,000 elements.</para>
-    /// <para>If passing an array of 8-bit with > 1,000,000 or 16-bith with > 100,000,000 elements set useSIMD to false.</para>
+    /// <para>The SIMD counters are widened before they can wrap, so 8-bit and 16-bit containers are counted exactly at any size.</para>
     /// <para>Takes 1 templated predicate from tpa::cond</para>
     /// <para>tpa::cond::EQUAL_TO		            </para>	
     /// <para>tpa::cond::NOT_EQUAL_TO			    </para>
@@ -177,9 +180,26 @@ namespace tpa {
 
             std::shared_future<RETURN_T> temp;
 
+            //DIVISIBLE_BY: the divisor is checked once here instead of in every section
+            constexpr bool divides = (COND == tpa::cond::DIVISIBLE_BY) && std::is_integral<T>::value;
+
+            if constexpr (divides)
+            {
+                if (param == 0)
+                {
+                    throw tpa::exceptions::DivideByZero();
+                }//End if
+            }//End if
+
+            //The int32_t kernels divide with precomputed magic numbers, only when 'param' is exactly representable as int32_t
+            constexpr bool divides32 = divides && std::is_same<T, int32_t>::value;
+            const bool divisor_fits = divides32 && static_cast<P>(static_cast<int32_t>(param)) == param;
+
+            const std::conditional_t<divides32, tpa::simd::int_divider<int32_t>, bool> divider(divisor_fits ? static_cast<int32_t>(param) : 1);
+
             for (const auto& sec : sections)
             {
-                temp = tpa::tp->addTask([&arr, &param, &useSIMD, &sec]()
+                temp = tpa::tp->addTask([&arr, &param, &useSIMD, &sec, &divider, divisor_fits]()
                     {
                         const size_t beg = sec.first;
                         const size_t end = sec.second;
@@ -189,6 +209,21 @@ namespace tpa {
 
                         RETURN_T cnt = 0;
 
+#pragma region vec
+                if constexpr (tpa_count_private::vec_countable<COND, T> && !std::is_same<T, int32_t>())
+                {
+                    //Only when 'para' is exactly representable as T, the generic loop compares in the type of P otherwise
+                    if (useSIMD && static_cast<P>(static_cast<T>(para)) == para)
+                    {
+                        //Built on first use, not per call
+                        static const auto kernels = tpa_count_private::count_kernels<COND, T>();
+
+                        uint64_t total = 0ull;
+                        kernels.resolve_for((end - beg) * sizeof(T))(i, end, arr.data(), static_cast<T>(para), total);
+                        cnt += static_cast<RETURN_T>(total);
+                    }//End if
+                }//End if
+#pragma endregion
 #pragma region int
                 if constexpr (std::is_same<T, int32_t>())
                 {
@@ -196,44 +231,60 @@ namespace tpa {
                     if constexpr (COND == tpa::cond::EVEN)
                     {
 #ifdef TPA_X86_64
-                        if (tpa::hasAVX2 && useSIMD)
+                        if (tpa::hasAVX512 && useSIMD) [&]() TPA_TARGET("avx512f")
+                        {
+                            const __m512i _ONE = _mm512_set1_epi32(1);
+
+                            __m512i _ARR;
+                            __mmask16 _MASK;
+
+                            for (; (i + 16uz) < end; i += 16uz)
+                            {
+                                //Set Values
+                                _ARR = _mm512_loadu_epi32(&arr[i]);
+
+                                //Lowest bit clear == even
+                                _MASK = _mm512_testn_epi32_mask(_ARR, _ONE);
+
+                                cnt += static_cast<RETURN_T>(std::popcount(static_cast<uint32_t>(_MASK)));
+                            }//End for
+                        }();//End if hasAVX512
+                        else if (tpa::hasAVX2 && useSIMD) [&]() TPA_TARGET("avx2")
                         {
                             const __m256i _ZERO = _mm256_set1_epi32(0);
-                            const __m256i _TWO = _mm256_set1_epi32(2);
+                            const __m256i _ONE = _mm256_set1_epi32(1);
                             __m256i _count = _mm256_setzero_si256();
 
-                            __m256i _ARR, _REM, _MASK;
+                            __m256i _ARR, _MASK;
 
                             for (; (i + 8uz) < end; i += 8uz)
                             {
                                 //Set Values
-                                _ARR = _mm256_load_si256((__m256i*) & arr[i]);
+                                _ARR = _mm256_loadu_si256((__m256i*) & arr[i]);
 
-                                _REM = _mm256_rem_epi32(_ARR, _TWO);
-
-                                _MASK = _mm256_cmpeq_epi32(_REM, _ZERO);
+                                //Lowest bit clear == even
+                                _MASK = _mm256_cmpeq_epi32(_mm256_and_si256(_ARR, _ONE), _ZERO);
 
                                 _count = _mm256_sub_epi32(_count, _MASK);
                             }//End for
 
                             cnt = static_cast<RETURN_T>(tpa::simd::_mm256_sum_epi32(_count));
-                        }//End if hasAVX2
+                        }();//End if hasAVX2
                         else if (tpa::has_SSE2 && useSIMD)
                         {
                             const __m128i _ZERO = _mm_set1_epi32(0);
-                            const __m128i _TWO = _mm_set1_epi32(2);
+                            const __m128i _ONE = _mm_set1_epi32(1);
                             __m128i _count = _mm_setzero_si128();
 
-                            __m128i _ARR, _REM, _MASK;
+                            __m128i _ARR, _MASK;
 
                             for (; (i + 4uz) < end; i += 4uz)
                             {
                                 //Set Values
-                                _ARR = _mm_load_si128((__m128i*) & arr[i]);
+                                _ARR = _mm_loadu_si128((__m128i*) & arr[i]);
 
-                                _REM = _mm_rem_epi32(_ARR, _TWO);
-
-                                _MASK = _mm_cmpeq_epi32(_REM, _ZERO);
+                                //Lowest bit clear == even
+                                _MASK = _mm_cmpeq_epi32(_mm_and_si128(_ARR, _ONE), _ZERO);
 
                                 _count = _mm_sub_epi32(_count, _MASK);
                             }//End for
@@ -244,53 +295,59 @@ namespace tpa {
                     }//End if
                     else if constexpr (COND == tpa::cond::ODD)
                     {
-#ifdef _M_AMD64
-                        if (tpa::hasAVX2 && useSIMD)
+#ifdef TPA_X86_64
+                        if (tpa::hasAVX512 && useSIMD) [&]() TPA_TARGET("avx512f")
                         {
-                            const __m256i _NEG_ONE = _mm256_set1_epi32(-1);
-                            const __m256i _ZERO = _mm256_set1_epi32(0);
-                            const __m256i _TWO = _mm256_set1_epi32(2);
-                            
-                            __m256i _count = _mm256_setzero_si256();
+                            const __m512i _ONE = _mm512_set1_epi32(1);
 
-                            __m256i _ARR, _REM, _MASK;
+                            __m512i _ARR;
+                            __mmask16 _MASK;
 
-                            for (; (i + 8uz) < end; i += 8uz)
+                            for (; (i + 16uz) < end; i += 16uz)
                             {
                                 //Set Values
-                                _ARR = _mm256_load_si256((__m256i*) & arr[i]);
+                                _ARR = _mm512_loadu_epi32(&arr[i]);
 
-                                _REM = _mm256_rem_epi32(_ARR, _TWO);
+                                //Lowest bit set == odd
+                                _MASK = _mm512_test_epi32_mask(_ARR, _ONE);
 
-                                _MASK = _mm256_cmpeq_epi32(_REM, _ZERO);
-                                _MASK = _mm256_xor_si256(_MASK, _NEG_ONE);//Not Equal
+                                cnt += static_cast<RETURN_T>(std::popcount(static_cast<uint32_t>(_MASK)));
+                            }//End for
+                        }();//End if hasAVX512
+                        else if (tpa::hasAVX2 && useSIMD) [&]() TPA_TARGET("avx2")
+                        {
+                            const __m256i _ONE = _mm256_set1_epi32(1);
 
-                                _count = _mm256_sub_epi32(_count, _MASK);
+                            __m256i _count = _mm256_setzero_si256();
+
+                            __m256i _ARR;
+
+                            for (; (i + 8uz) < end; i += 8uz)
+                            {
+                                //Set Values
+                                _ARR = _mm256_loadu_si256((__m256i*) & arr[i]);
+
+                                //Lowest bit is 1 for odd numbers and 0 for even
+                                _count = _mm256_add_epi32(_count, _mm256_and_si256(_ARR, _ONE));
                             }//End for
 
                             cnt = static_cast<RETURN_T>(tpa::simd::_mm256_sum_epi32(_count));
-                        }//End if hasAVX2
+                        }();//End if hasAVX2
                         else if (tpa::has_SSE2 && useSIMD)
                         {
-                            const __m128i _NEG_ONE = _mm_set1_epi32(-1);
-                            const __m128i _ZERO = _mm_set1_epi32(0);
-                            const __m128i _TWO = _mm_set1_epi32(2);
-                            
+                            const __m128i _ONE = _mm_set1_epi32(1);
+
                             __m128i _count = _mm_setzero_si128();
 
-                            __m128i _ARR, _REM, _MASK;
+                            __m128i _ARR;
 
                             for (; (i + 4uz) < end; i += 4uz)
                             {
                                 //Set Values
-                                _ARR = _mm_load_si128((__m128i*) & arr[i]);
+                                _ARR = _mm_loadu_si128((__m128i*) & arr[i]);
 
-                                _REM = _mm_rem_epi32(_ARR, _TWO);
-
-                                _MASK = _mm_cmpeq_epi32(_REM, _ZERO);
-                                _MASK = _mm_xor_si128(_MASK, _NEG_ONE);//Not Equal
-
-                                _count = _mm_sub_epi32(_count, _MASK);
+                                //Lowest bit is 1 for odd numbers and 0 for even
+                                _count = _mm_add_epi32(_count, _mm_and_si128(_ARR, _ONE));
                             }//End for
 
                             cnt = static_cast<RETURN_T>(tpa::simd::_mm_sum_epi32(_count));
@@ -299,23 +356,41 @@ namespace tpa {
                     }//End if
                     else if constexpr (COND == tpa::cond::DIVISIBLE_BY)
                     {
-#ifdef _M_AMD64
-                        if (tpa::hasAVX2 && useSIMD)
+#ifdef TPA_X86_64
+                        //Precomputed magic-number divisor, replaces _mm*_rem_epi32 (SVML)
+                        const tpa::simd::int_divider<int32_t>& _Di = divider;
+
+                        if (tpa::hasAVX512 && useSIMD && divisor_fits) [&]() TPA_TARGET("avx512f")
+                        {
+                            __m512i _ARR, _REM;
+                            __mmask16 _MASK;
+
+                            for (; (i + 16uz) < end; i += 16uz)
+                            {
+                                //Set Values
+                                _ARR = _mm512_loadu_epi32(&arr[i]);
+
+                                _REM = tpa::simd::_mm512_rem_magic(_ARR, _Di);
+
+                                _MASK = _mm512_testn_epi32_mask(_REM, _REM);
+
+                                cnt += static_cast<RETURN_T>(std::popcount(static_cast<uint32_t>(_MASK)));
+                            }//End for
+                        }();//End if hasAVX512
+                        else if (tpa::hasAVX2 && useSIMD && divisor_fits) [&]() TPA_TARGET("avx2")
                         {
-                            const __m256i _NEG_ONE = _mm256_set1_epi32(-1);
                             const __m256i _ZERO = _mm256_set1_epi32(0);
-                            const __m256i _divisor = _mm256_set1_epi32(static_cast<int32_t>(para));
 
                             __m256i _count = _mm256_setzero_si256();
-                            
+
                             __m256i _ARR, _REM, _MASK;
 
                             for (; (i + 8uz) < end; i += 8uz)
                             {
                                 //Set Values
-                                _ARR = _mm256_load_si256((__m256i*) & arr[i]);
+                                _ARR = _mm256_loadu_si256((__m256i*) & arr[i]);
 
-                                _REM = _mm256_rem_epi32(_ARR, _divisor);
+                                _REM = tpa::simd::_mm256_rem_magic(_ARR, _Di);
 
                                 _MASK = _mm256_cmpeq_epi32(_REM, _ZERO);
 
@@ -323,12 +398,10 @@ namespace tpa {
                             }//End for
 
                             cnt = static_cast<RETURN_T>(tpa::simd::_mm256_sum_epi32(_count));
-                        }//End if hasAVX2
-                        else if (tpa::has_SSE2)
+                        }();//End if hasAVX2
+                        else if (tpa::has_SSE2 && useSIMD && divisor_fits)
                         {
-                            const __m128i _NEG_ONE = _mm_set1_epi32(-1);
                             const __m128i _ZERO = _mm_set1_epi32(0);
-                            const __m128i _divisor = _mm_set1_epi32(static_cast<int32_t>(para));
 
                             __m128i _count = _mm_setzero_si128();
 
@@ -337,9 +410,9 @@ namespace tpa {
                             for (; (i + 4uz) < end; i += 4uz)
                             {
                                 //Set Values
-                                _ARR = _mm_load_si128((__m128i*) & arr[i]);
+                                _ARR = _mm_loadu_si128((__m128i*) & arr[i]);
 
-                                _REM = _mm_rem_epi32(_ARR, _divisor);
+                                _REM = tpa::simd::_mm_rem_magic(_ARR, _Di);
 
                                 _MASK = _mm_cmpeq_epi32(_REM, _ZERO);
 
@@ -372,7 +445,7 @@ namespace tpa {
                             for (; (i + 8uz) < end; i += 8uz)
                             {
                                 //Set Values
-                                _N_INT = _mm256_load_si256((__m256i*) &arr[i]);
+                                _N_INT = _mm256_loadu_si256((__m256i*) &arr[i]);
                                 _N_DBL = _mm256_cvtepi32_ps(_N_INT);
                                 
                                 LOG_OF_N = _mm256_log_ps(_N_DBL);
@@ -407,7 +480,7 @@ namespace tpa {
                             for (; (i + 4uz) < end; i += 4uz)
                             {
                                 //Set Values
-                                _N_INT = _mm_load_si128((__m128i*) & arr[i]);
+                                _N_INT = _mm_loadu_si128((__m128i*) & arr[i]);
                                 _N_DBL = _mm_cvtepi32_ps(_N_INT);
 
                                 LOG_OF_N = _mm_log_ps(_N_DBL);
@@ -437,7 +510,7 @@ namespace tpa {
 
                             for (; (i + 8uz) < end; i += 8uz)
                             {
-                                _arr = _mm256_load_si256((__m256i*) & arr[i]);
+                                _arr = _mm256_loadu_si256((__m256i*) & arr[i]);
 
                                 _mask = _mm256_cmpeq_epi32(_arr, _val);
 
@@ -456,7 +529,7 @@ namespace tpa {
 
                             for (; (i + 4uz) < end; i += 4uz)
                             {
-                                _arr = _mm_load_si128((__m128i*) & arr[i]);
+                                _arr = _mm_loadu_si128((__m128i*) & arr[i]);
 
                                 _mask = _mm_cmpeq_epi32(_arr, _val);
 
@@ -480,7 +553,7 @@ namespace tpa {
 
                             for (; (i + 8uz) < end; i += 8uz)
                             {
-                                _arr = _mm256_load_si256((__m256i*) & arr[i]);
+                                _arr = _mm256_loadu_si256((__m256i*) & arr[i]);
 
                                 _mask = _mm256_cmpeq_epi32(_arr, _val);
                                 _mask = _mm256_xor_si256(_mask, _NEG_ONE);//Not Equal
@@ -501,7 +574,7 @@ namespace tpa {
 
                             for (; (i + 4uz) < end; i += 4uz)
                             {
-                                _arr = _mm_load_si128((__m128i*) & arr[i]);
+                                _arr = _mm_loadu_si128((__m128i*) & arr[i]);
 
                                 _mask = _mm_cmpeq_epi32(_arr, _val);
                                 _mask = _mm_xor_si128(_mask, _NEG_ONE);//Not Equal
@@ -525,7 +598,7 @@ namespace tpa {
 
                             for (; (i + 8uz) < end; i += 8uz)
                             {
-                                _arr = _mm256_load_si256((__m256i*) & arr[i]);
+                                _arr = _mm256_loadu_si256((__m256i*) & arr[i]);
 
                                 _mask = _mm256_cmpgt_epi32(_arr, _val);
 
@@ -544,7 +617,7 @@ namespace tpa {
 
                             for (; (i + 4uz) < end; i += 4uz)
                             {
-                                _arr = _mm_load_si128((__m128i*) & arr[i]);
+                                _arr = _mm_loadu_si128((__m128i*) & arr[i]);
 
                                 _mask = _mm_cmpgt_epi32(_arr, _val);
 
@@ -567,7 +640,7 @@ namespace tpa {
 
                             for (; (i + 8uz) < end; i += 8uz)
                             {
-                                _arr = _mm256_load_si256((__m256i*) & arr[i]);
+                                _arr = _mm256_loadu_si256((__m256i*) & arr[i]);
 
                                 _mask = _mm256_or_si256(_mm256_cmpeq_epi32(_arr, _val), _mm256_cmpgt_epi32(_arr, _val));
 
@@ -586,7 +659,7 @@ namespace tpa {
 
                             for (; (i + 4uz) < end; i += 4uz)
                             {
-                                _arr = _mm_load_si128((__m128i*) & arr[i]);
+                                _arr = _mm_loadu_si128((__m128i*) & arr[i]);
 
                                 _mask = _mm_or_si128(_mm_cmpeq_epi32(_arr, _val), _mm_cmpgt_epi32(_arr, _val));
 
@@ -609,7 +682,7 @@ namespace tpa {
 
                             for (; (i + 8uz) < end; i += 8uz)
                             {
-                                _arr = _mm256_load_si256((__m256i*) & arr[i]);
+                                _arr = _mm256_loadu_si256((__m256i*) & arr[i]);
 
                                 _mask = _mm256_cmpgt_epi32(_val, _arr);
 
@@ -628,7 +701,7 @@ namespace tpa {
 
                             for (; (i + 4uz) < end; i += 4uz)
                             {
-                                _arr = _mm_load_si128((__m128i*) & arr[i]);
+                                _arr = _mm_loadu_si128((__m128i*) & arr[i]);
 
                                 _mask = _mm_cmpgt_epi32(_val, _arr);
 
@@ -651,7 +724,7 @@ namespace tpa {
 
                             for (; (i + 8uz) < end; i += 8uz)
                             {
-                                _arr = _mm256_load_si256((__m256i*) & arr[i]);
+                                _arr = _mm256_loadu_si256((__m256i*) & arr[i]);
 
                                 _mask = _mm256_or_si256(_mm256_cmpeq_epi32(_arr, _val), _mm256_cmpgt_epi32(_val, _arr));
 
@@ -670,7 +743,7 @@ namespace tpa {
 
                             for (; (i + 4uz) < end; i += 4uz)
                             {
-                                _arr = _mm_load_si128((__m128i*) & arr[i]);
+                                _arr = _mm_loadu_si128((__m128i*) & arr[i]);
 
                                 _mask = _mm_or_si128(_mm_cmpeq_epi32(_arr, _val), _mm_cmpgt_epi32(_val, _arr));
 
@@ -697,7 +770,7 @@ namespace tpa {
 
                             for (; (i + 8uz) < end; i += 8uz)
                             {
-                                _ARR = _mm256_load_si256((__m256i*) &arr[i]);
+                                _ARR = _mm256_loadu_si256((__m256i*) &arr[i]);
 
                                 _sqrt = _mm256_cvtps_epi32(_mm256_sqrt_ps(_mm256_cvtepi32_ps(_ARR)));
                                 _sqrt = _mm256_mullo_epi32(_sqrt, _sqrt);
@@ -718,7 +791,7 @@ namespace tpa {
 
                             for (; (i + 4uz) < end; i += 4uz)
                             {
-                                _ARR = _mm_load_si128((__m128i*) & arr[i]);
+                                _ARR = _mm_loadu_si128((__m128i*) & arr[i]);
 
                                 _sqrt = _mm_cvtps_epi32(_mm_sqrt_ps(_mm_cvtepi32_ps(_ARR)));
                                 _sqrt = _mm_mullo_epi32(_sqrt, _sqrt);
@@ -752,7 +825,7 @@ namespace tpa {
 
                             for (; (i + 8uz) < end; i += 8uz)
                             {
-                                _ARR = _mm256_load_si256((__m256i*) &arr[i]);
+                                _ARR = _mm256_loadu_si256((__m256i*) &arr[i]);
 
                                 _mult = _mm256_mullo_epi32(_five, _ARR);
                                 _mult = _mm256_mullo_epi32(_mult, _ARR);
@@ -790,7 +863,7 @@ namespace tpa {
 
                             for (; (i + 4uz) < end; i += 4uz)
                             {
-                                _ARR = _mm_load_si128((__m128i*) & arr[i]);
+                                _ARR = _mm_loadu_si128((__m128i*) & arr[i]);
 
                                 _mult = _mm_mullo_epi32(_five, _ARR);
                                 _mult = _mm_mullo_epi32(_mult, _ARR);
@@ -847,7 +920,7 @@ namespace tpa {
                            
                             for (; (i + 4uz) < end; i += 4uz)
                             {
-                                _ARR = _mm256_cvtepi32_epi64(_mm_load_si128((__m128i*) &arr[i]));
+                                _ARR = _mm256_cvtepi32_epi64(_mm_loadu_si128((__m128i*) &arr[i]));
                                 
                                 _mask0 = _mm256_cmpeq_epi64(_ARR, _syl0);
                                 _mask1 = _mm256_cmpeq_epi64(_ARR, _syl1);
@@ -29,6 +29,242 @@
 #include "../tpa_concepts.hpp"
 #include "../InstructionSet.hpp"
 #include "../simd/simd.hpp"
+#include "../simd/vec.hpp"
+#include "../simd/dispatch.hpp"
+
+/// <summary>
+/// <para>Private Namespace for TPA fill.</para>
+/// <para>Not intended to be used directly.</para>
+/// </summary>
+namespace tpa_fill_private {
+
+    /// <summary>
+    /// <para>Broadcasts 'val' into a tpa::simd::vec&lt;T, W&gt; and stores it 'W' elements at a time.</para>
+    /// <para>Stores are unaligned as sections begin at arbitrary offsets, the AVX2 and AVX-512 kernels peel a prologue so that they land on aligned addresses.</para>
+    /// <para>ALIGNED stores are used when 'arr + i' is known to be aligned to the vector size.</para>
+    /// <para>Leaves 'i' at the first element which was not filled.</para>
+    /// </summary>
+    template<size_t W, bool ALIGNED = false, typename T>
+    TPA_FORCE_INLINE void fill_block(size_t& i, const size_t end, T* arr, const T val) noexcept
+    {
+        const tpa::simd::vec<T, W> _Val(val);
+
+        for (; (i + W) <= end; i += W)
+        {
+            if constexpr (ALIGNED)
+            {
+                _Val.store_aligned(arr + i);
+            }//End if
+            else
+            {
+                _Val.store(arr + i);
+            }//End else
+        }//End for
+    }//End of fill_block
+
+    /// <summary>
+    /// <para>Scalar fill of [i, end), also used to finish the leftovers of the SIMD kernels.</para>
+    /// </summary>
+    template<typename T>
+    inline void fill_scalar(size_t i, const size_t end, T* arr, const T val) noexcept
+    {
+        for (; i != end; ++i)
+        {
+            arr[i] = val;
+        }//End for
+    }//End of fill_scalar
+
+#ifdef TPA_X86_64
+    template<typename T>
+    TPA_TARGET_SSE41 inline void fill_sse41(size_t i, const size_t end, T* arr, const T val) noexcept
+    {
+        tpa_fill_private::fill_block<16uz / sizeof(T)>(i, end, arr, val);
+        tpa_fill_private::fill_scalar(i, end, arr, val);
+    }//End of fill_sse41
+
+    /// <summary>
+    /// <para>Peels a scalar head up to a 32-byte boundary, every full store after it is aligned.</para>
+    /// <para>ALIGNED = 'arr' comes from a tpa::util::aligned_sequence, the stores use the aligned form.</para>
+    /// </summary>
+    template<typename T, bool ALIGNED = false>
+    TPA_TARGET_AVX2 inline void fill_avx2(size_t i, const size_t end, T* arr, const T val) noexcept
+    {
+        const size_t head = tpa::simd::align_index<32uz>(i, end, arr);
+        tpa_fill_private::fill_scalar(i, head, arr, val);
+
+        i = head;
+        tpa_fill_private::fill_block<32uz / sizeof(T), ALIGNED>(i, end, arr, val);
+        tpa_fill_private::fill_scalar(i, end, arr, val);
+    }//End of fill_avx2
+
+    /// <summary>
+    /// <para>Masked stores fill the head up to a 64-byte boundary and the tail, every full store is aligned.</para>
+    /// <para>ALIGNED = 'arr' comes from a tpa::util::aligned_sequence, the stores use the aligned form.</para>
+    /// </summary>
+    template<typename T, bool ALIGNED = false>
+    TPA_TARGET_AVX512 inline void fill_avx512(size_t i, const size_t end, T* arr, const T val) noexcept
+    {
+        using V = tpa::simd::vec<T, 64uz / sizeof(T)>;
+
+        const V _Val(val);
+
+        const size_t head = tpa::simd::align_index<64uz>(i, end, arr);
+        _Val.store_partial(arr + i, head - i);
+
+        i = head;
+        tpa_fill_private::fill_block<V::width, ALIGNED>(i, end, arr, val);
+
+        _Val.store_partial(arr + i, end - i);
+    }//End of fill_avx512
+#elif defined(TPA_NEON)
+    template<typename T>
+    inline void fill_neon(size_t i, const size_t end, T* arr, const T val) noexcept
+    {
+        tpa_fill_private::fill_block<16uz / sizeof(T)>(i, end, arr, val);
+        tpa_fill_private::fill_scalar(i, end, arr, val);
+    }//End of fill_neon
+#ifdef TPA_SVE
+    /// <summary>
+    /// <para>SVE fill at the hardware vector length, the last partial vector is a predicated store so no scalar tail is needed.</para>
+    /// </summary>
+    template<typename T>
+    requires tpa::simd::is_vec_type<T>
+    inline void fill_sve(size_t i, const size_t end, T* arr, const T val) noexcept
+    {
+        while (i < end)
+        {
+            if constexpr (std::is_same<T, float>::value)
+            {
+                svst1_f32(svwhilelt_b32_u64(i, end), &arr[i], svdup_n_f32(val));
+                i += svcntw();
+            }//End if
+            else if constexpr (std::is_same<T, double>::value)
+            {
+                svst1_f64(svwhilelt_b64_u64(i, end), &arr[i], svdup_n_f64(val));
+                i += svcntd();
+            }//End if
+            else if constexpr (sizeof(T) == 1uz)
+            {
+                svst1_u8(svwhilelt_b8_u64(i, end), reinterpret_cast<uint8_t*>(&arr[i]), svdup_n_u8(static_cast<uint8_t>(val)));
+                i += svcntb();
+            }//End if
+            else if constexpr (sizeof(T) == 2uz)
+            {
+                svst1_u16(svwhilelt_b16_u64(i, end), reinterpret_cast<uint16_t*>(&arr[i]), svdup_n_u16(static_cast<uint16_t>(val)));
+                i += svcnth();
+            }//End if
+            else if constexpr (sizeof(T) == 4uz)
+            {
+                svst1_u32(svwhilelt_b32_u64(i, end), reinterpret_cast<uint32_t*>(&arr[i]), svdup_n_u32(static_cast<uint32_t>(val)));
+                i += svcntw();
+            }//End if
+            else
+            {
+                svst1_u64(svwhilelt_b64_u64(i, end), reinterpret_cast<uint64_t*>(&arr[i]), svdup_n_u64(static_cast<uint64_t>(val)));
+                i += svcntd();
+            }//End else
+        }//End while
+    }//End of fill_sve
+#endif
+#endif
+
+    /// <summary>
+    /// <para>Returns the fill kernels for this hardware, built once per value type.</para>
+    /// <para>ALIGNED selects kernels which use aligned stores, only for containers satisfying tpa::util::aligned_sequence.</para>
+    /// </summary>
+    template<typename T, bool ALIGNED = false>
+    [[nodiscard]] inline auto fill_kernels() noexcept
+    {
+        tpa::simd::kernel_table<void(size_t, const size_t, T*, const T)> table;
+        table.scalar = &tpa_fill_private::fill_scalar<T>;
+
+#ifdef TPA_X86_64
+        table.sse41 = &tpa_fill_private::fill_sse41<T>;
+        table.avx2 = &tpa_fill_private::fill_avx2<T, ALIGNED>;
+        table.avx512 = &tpa_fill_private::fill_avx512<T, ALIGNED>;
+#elif defined(TPA_NEON)
+        table.neon = &tpa_fill_private::fill_neon<T>;
+#ifdef TPA_SVE
+        if constexpr (tpa::simd::is_vec_type<T>)
+        {
+            table.neon = &tpa_fill_private::fill_sve<T>;
+        }//End if
+#endif
+#endif
+
+        return table;
+    }//End of fill_kernels
+
+    /// <summary>
+    /// <para>Fills [i, end) with BYTES-wide non-temporal stores, which bypass the cache and skip the read-for-ownership of each line.</para>
+    /// <para>Streaming stores must be aligned so a scalar head is peeled to a BYTES boundary, if 'arr' can never reach one regular stores are used.</para>
+    /// </summary>
+    template<size_t BYTES, typename T>
+    TPA_FORCE_INLINE void fill_stream(size_t i, const size_t end, T* arr, const T val) noexcept
+    {
+        using V = tpa::simd::vec<T, BYTES / sizeof(T)>;
+
+        const size_t head = tpa::simd::align_index<BYTES>(i, end, arr);
+        tpa_fill_private::fill_scalar(i, head, arr, val);
+
+        i = head;
+
+        if ((reinterpret_cast<uintptr_t>(arr + i) & (BYTES - 1uz)) == 0uz)
+        {
+            const V _Val(val);
+
+            for (; (i + V::width) <= end; i += V::width)
+            {
+                _Val.store_stream(arr + i);
+            }//End for
+
+            tpa::simd::stream_fence();
+        }//End if
+
+        tpa_fill_private::fill_scalar(i, end, arr, val);
+    }//End of fill_stream
+
+#ifdef TPA_X86_64
+    template<typename T>
+    TPA_TARGET_SSE41 inline void fill_stream_sse41(size_t i, const size_t end, T* arr, const T val) noexcept
+    {
+        tpa_fill_private::fill_stream<16uz>(i, end, arr, val);
+    }//End of fill_stream_sse41
+
+    template<typename T>
+    TPA_TARGET_AVX2 inline void fill_stream_avx2(size_t i, const size_t end, T* arr, const T val) noexcept
+    {
+        tpa_fill_private::fill_stream<32uz>(i, end, arr, val);
+    }//End of fill_stream_avx2
+
+    template<typename T>
+    TPA_TARGET_AVX512 inline void fill_stream_avx512(size_t i, const size_t end, T* arr, const T val) noexcept
+    {
+        tpa_fill_private::fill_stream<64uz>(i, end, arr, val);
+    }//End of fill_stream_avx512
+#endif
+
+    /// <summary>
+    /// <para>Returns the streaming fill kernels for this hardware, built once per value type.</para>
+    /// <para>NEON has no non-temporal store intrinsic, ARM uses the regular fill kernel.</para>
+    /// </summary>
+    template<typename T>
+    [[nodiscard]] inline auto fill_stream_kernels() noexcept
+    {
+        tpa::simd::kernel_table<void(size_t, const size_t, T*, const T)> table;
+        table.scalar = &tpa_fill_private::fill_scalar<T>;
+
+#ifdef TPA_X86_64
+        table.sse41 = &tpa_fill_private::fill_stream_sse41<T>;
+        table.avx2 = &tpa_fill_private::fill_stream_avx2<T>;
+        table.avx512 = &tpa_fill_private::fill_stream_avx512<T>;
+#elif defined(TPA_NEON)
+        table.neon = tpa_fill_private::fill_kernels<T>().neon;
+#endif
+
+        return table;
+    }//End of fill_stream_kernels
+}//End of namespace
 
 /// <summary>
 /// <para>Truly Parallel Algorithms</para>
@@ -39,15 +275,17 @@ namespace tpa {
 #pragma region generic
 
     /// <summary>
-    /// Fills the container with the specified value upto the specified index
+    /// <para>Fills the container with the specified value upto the specified index</para>
+    /// <para>Fills of at least 'stream_threshold' bytes use non-temporal stores so that they do not evict the cache.</para>
     /// </summary>
     /// <typeparam name="CONTAINER"></typeparam>
     /// <typeparam name="T"></typeparam>
     /// <param name="arr"></param>
     /// <param name="val"></param>
     /// <param name="item_count"> - optional defaults to the size of the container</param>
+    /// <param name="stream_threshold"> - optional defaults to tpa::simd::stream_min_bytes (the last level cache size)</param>
     template<typename CONTAINER, typename T>
-    inline constexpr void fill(CONTAINER& arr, const T val, size_t item_count = 0)
+    inline constexpr void fill(CONTAINER& arr, const T val, size_t item_count = 0, const size_t stream_threshold = tpa::simd::stream_min_bytes)
         requires tpa::util::contiguous_seqeunce<CONTAINER>
     {
         using CONTAINER_TYPE = CONTAINER::value_type;
@@ -64,6 +302,8 @@ namespace tpa {
 
             uint32_t complete = 0;
 
+            const bool stream = (item_count * sizeof(T)) >= stream_threshold;
+
             std::vector<std::pair<size_t, size_t>> sections;
             tpa::util::prepareThreading(sections, item_count);
 
@@ -74,11 +314,25 @@ namespace tpa {
 
             for (const auto& sec : sections)
             {
-                temp = tpa::tp->addTask([&arr, &val, &sec]()
+                temp = tpa::tp->addTask([&arr, &val, &sec, stream]()
                     {
                         const size_t beg = sec.first;
                         const size_t end = sec.second;
                         size_t i = beg;
+#pragma region stream
+                        if constexpr (tpa::simd::is_vec_type<T>)
+                        {
+                            if (stream)
+                            {
+                                //Built on first use, not per call
+                                static const auto stream_kernels = tpa_fill_private::fill_stream_kernels<T>();
+
+                                stream_kernels.resolve_for((end - i) * sizeof(T))(i, end, &arr[0], val);
+
+                                return static_cast<uint32_t>(1);
+                            }//End if
+                        }//End if
+#pragma endregion
 #pragma region byte
                         if constexpr (std::is_same<T, int8_t>())
                         {
@@ -92,7 +346,7 @@ namespace tpa {
                                     break;
                                 }//End if
 
-                                _mm256_store_si256((__m256i*) &arr[i], _Val);
+                                _mm256_storeu_si256((__m256i*) &arr[i], _Val);
                             }//End for
 
                             //Finish leftovers
@@ -117,7 +371,7 @@ namespace tpa {
                                     break;
                                 }//End if
 
-                                _mm256_store_si256((__m256i*) &arr[i], _Val);
+                                _mm256_storeu_si256((__m256i*) &arr[i], _Val);
                             }//End for
 
                             //Finish leftovers
@@ -135,329 +389,13 @@ namespace tpa {
 #endif
                         }//End if
 #pragma endregion
-#pragma region short
-                        else if constexpr (std::is_same<T, int16_t>())
+#pragma region simd
+                        else if constexpr (tpa::simd::is_vec_type<T>)
                         {
-#ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
-                            {
-                                const __m512i _Val = _mm512_set1_epi16(static_cast<int16_t>(val));
-
-                                for (; (i + 32uz) < end; i += 32uz)
-                                {
-                                    _mm512_store_si512(&arr[i], _Val);
-                                }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
-                            {
-                                const __m256i _Val = _mm256_set1_epi16(static_cast<int16_t>(val));
+                            //Built on first use, not per call
+                            static const auto kernels = tpa_fill_private::fill_kernels<T, tpa::util::aligned_sequence<CONTAINER>>();
 
-                                for (; (i + 16uz) < end; i += 16uz)
-                                {
-                                    _mm256_store_si256((__m256i*) &arr[i], _Val);
-                                }//End for
-                            }//End if hasAVX2
-                            else if (tpa::has_SSE2)
-                            {
-                                const __m128i _Val = _mm_set1_epi16(static_cast<int16_t>(val));
-
-                                for (; (i + 8uz) < end; i += 8uz)
-                                {
-                                    _mm_store_si128((__m128i*) &arr[i], _Val);
-                                }//End for
-                            }//End if hasAVX2
-#endif
-                            //Finish leftovers
-                            for (; i != end; ++i)
-                            {
-                                arr[i] = val;
-                            }//End for
-                        }//End if
-#pragma endregion
-#pragma region unsigned short
-                        else if constexpr (std::is_same<T, uint16_t>())
-                        {
-#ifdef _MSC_VER
-                            __stosw(reinterpret_cast<uint16_t*>(&arr[i]), val, end - i);
-#else
-
-#ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
-                            {
-                                const __m512i _Val = _mm512_set1_epi16(static_cast<uint16_t>(val));
-
-                                for (; (i + 32uz) < end; i += 32uz)
-                                {
-                                    _mm512_store_si512(&arr[i], _Val);
-                                }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
-                            {
-                                const __m256i _Val = _mm256_set1_epi16(static_cast<uint16_t>(val));
-
-                                for (; i + 16 < end; i += 16)
-                                {
-                                    _mm256_store_si256((__m256i*) & arr[i], _Val);
-                                }//End for
-                            }//End if hasAVX2
-                            else if (tpa::has_SSE2)
-                            {
-                                const __m128i _Val = _mm_set1_epi16(static_cast<uint16_t>(val));
-
-                                for (; (i + 8uz) < end; i += 8uz)
-                                {
-                                    _mm_store_si128((__m128i*) & arr[i], _Val);
-                                }//End for
-                            }//End if hasAVX2
-#endif
-                            //Finish leftovers
-                            for (; i != end; ++i)
-                            {
-                                arr[i] = val;
-                            }//End for
-#endif
-                        }//End if
-#pragma endregion
-#pragma region int
-                        else if constexpr (std::is_same<T, int32_t>())
-                        {
-#ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
-                            {
-                                const __m512i _Val = _mm512_set1_epi32(static_cast<int32_t>(val));
-
-                                for (; (i + 16uz) < end; i += 16uz)
-                                {
-                                    _mm512_store_si512(&arr[i], _Val);
-                                }//End for
-                            }//End if hasAVX512
-                            if (tpa::hasAVX2)
-                            {
-                                const __m256i _Val = _mm256_set1_epi32(static_cast<int32_t>(val));
-
-                                for (; (i + 8uz) < end; i += 8uz)
-                                {
-                                    _mm256_store_si256((__m256i*) & arr[i], _Val);
-                                }//End for
-                            }//End if hasAVX2
-                            else if (tpa::has_SSE2)
-                            {
-                                const __m128i _Val = _mm_set1_epi32(static_cast<int32_t>(val));
-
-                                for (; (i + 4uz) < end; i += 4uz)
-                                {
-                                    _mm_store_si128((__m128i*) & arr[i], _Val);
-                                }//End for
-                            }//End if hasSSE
-#endif
-                        //Finish leftovers
-                            for (; i != end; ++i)
-                            {
-                                arr[i] = val;
-                            }//End for
-                        }//End if
-#pragma endregion
-#pragma region unsigned int
-                        else if constexpr (std::is_same<T, uint32_t>())
-                        {
-#ifdef _MSC_VER
-                            __stosd(reinterpret_cast<unsigned long*>(&arr[i]), val, end - i);
-#else
-#ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
-                            {
-                                const __m512i _Val = _mm512_set1_epi32(static_cast<uint32_t>(val));
-
-                                for (; (i + 16uz) < end; i += 16uz)
-                                {
-                                    _mm512_store_si512(&arr[i], _Val);
-                                }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
-                            {
-                                const __m256i _Val = _mm256_set1_epi32(static_cast<uint32_t>(val));
-
-                                for (; (i + 8uz) < end; i += 8uz)
-                                {
-                                    _mm256_store_si256((__m256i*) & arr[i], _Val);
-                                }//End for
-                            }//End if haxAVX2
-                            else if (tpa::has_SSE2)
-                            {
-                                const __m128i _Val = _mm_set1_epi32(static_cast<uint32_t>(val));
-
-                                for (; (i + 4uz) < end; i += 4uz)
-                                {
-                                    _mm_store_si128((__m128i*) & arr[i], _Val);
-                                }//End for
-                            }//End if hasSSE
-#endif
-                            //Finish leftovers
-                            for (; i != end; ++i)
-                            {
-                                arr[i] = val;
-                            }//End for
-#endif
-                        }//End if
-#pragma endregion
-#pragma region long
-                        else if constexpr (std::is_same<T, int64_t>())
-                        {
-#ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
-                            {
-                                const __m512i _Val = _mm512_set1_epi64(static_cast<int64_t>(val));
-
-                                for (; (i + 8uz) < end; i += 8uz)
-                                {
-                                    _mm512_store_si512(&arr[i], _Val);
-                                }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
-                            {
-                                const __m256i _Val = _mm256_set1_epi64x(static_cast<int64_t>(val));
-
-                                for (; (i + 4uz) < end; i += 4uz)
-                                {
-                                    _mm256_store_si256((__m256i*) & arr[i], _Val);
-                                }//End for
-                            }//End if hasAVX2
-                            else if (tpa::has_SSE2)
-                            {
-                                const __m128i _Val = _mm_set1_epi64x(static_cast<int64_t>(val));
-
-                                for (; (i + 2uz) < end; i += 2uz)
-                                {
-                                    _mm_store_si128((__m128i*) & arr[i], _Val);
-                                }//End for
-                            }//End if hasSSE
-#endif 
-                        //Finish leftovers
-                            for (; i != end; ++i)
-                            {
-                                arr[i] = val;
-                            }//End for
-                        }//End if
-#pragma endregion
-#pragma region unsigned long
-                        else if constexpr (std::is_same<T, uint64_t>())
-                        {
-#ifdef _MSC_VER
-                            __stosq(reinterpret_cast<uint64_t*>(&arr[i]), val, end - i);
-#else
-#ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
-                            {
-                                const __m512i _Val = _mm512_set1_epi64(static_cast<uint64_t>(val));
-
-                                for (; (i + 8uz) < end; i += 8uz)
-                                {
-                                    _mm512_store_si512(&arr[i], _Val);
-                                }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
-                            {
-                                const __m256i _Val = _mm256_set1_epi64x(static_cast<uint64_t>(val));
-
-                                for (; (i + 4uz) < end; i += 4uz)
-                                {
-                                    _mm256_store_si256((__m256i*) & arr[i], _Val);
-                                }//End for
-                            }//End if hasAVX2
-                            else if (tpa::has_SSE2)
-                            {
-                                const __m128i _Val = _mm_set1_epi64x(static_cast<uint64_t>(val));
-
-                                for (; (i + 2uz) < end; i += 2uz)
-                                {
-                                    _mm_store_si128((__m128i*) & arr[i], _Val);
-                                }//End for
-                            }//End if hasSSE
-#endif
-                        //Finish leftovers
-                            for (; i != end; ++i)
-                            {
-                                arr[i] = val;
-                            }//End for
-#endif
-                        }//End if
-#pragma endregion
-#pragma region float
-                        else if constexpr (std::is_same < T, float >())
-                        {
-#ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
-                            {
-                                const __m512 _Val = _mm512_set1_ps(static_cast<float>(val));
-
-                                for (; (i + 16uz) < end; i += 16uz)
-                                {
-                                    _mm512_store_ps(&arr[i], _Val);
-                                }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX)
-                            {
-                                const __m256 _Val = _mm256_set1_ps(static_cast<float>(val));
-
-                                for (; (i + 8uz) < end; i += 8uz)
-                                {
-                                    _mm256_store_ps(&arr[i], _Val);
-                                }//End for
-                            }//End if
-                            else if (tpa::has_SSE)
-                            {
-                                const __m128 _Val = _mm_set1_ps(static_cast<float>(val));
-
-                                for (; (i + 4uz) < end; i += 4uz)
-                                {
-                                    _mm_store_ps(&arr[i], _Val);
-                                }//End for
-                            }//End if hasSSE
-#endif
-                        //Finish leftovers
-                            for (; i != end; ++i)
-                            {
-                                arr[i] = val;
-                            }//End for
-                        }//End if
-#pragma endregion
-#pragma region double
-                        else if constexpr (std::is_same <T, double>())
-                        {
-#ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
-                            {
-                                const __m512d _Val = _mm512_set1_pd(static_cast<double>(val));
-
-                                for (; (i + 8uz) < end; i += 8uz)
-                                {
-                                    _mm512_store_pd(&arr[i], _Val);
-                                }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX)
-                            {
-                                const __m256d _Val = _mm256_set1_pd(static_cast<double>(val));
-
-                                for (; (i + 4uz) < end; i += 4uz)
-                                {
-                                    _mm256_store_pd(&arr[i], _Val);
-                                }//End for
-                            }//End if hasAVX2
-                            else if (tpa::has_SSE2)
-                            {
-                                const __m128d _Val = _mm_set1_pd(static_cast<double> (val));
-
-                                for (; (i + 2uz) < end; i += 2uz)
-                                {
-                                    _mm_store_pd(&arr[i], _Val);
-                                }//End for
-                            }//End if hasSSE2
-#endif
-                        //Finish leftovers
-                            for (; i != end; ++i)
-                            {
-                                arr[i] = val;
-                            }//End for
+                            kernels.resolve_for((end - i) * sizeof(T))(i, end, &arr[0], val);
                         }//End if
 #pragma endregion
 #pragma region generic      
@@ -0,0 +1,635 @@
+#pragma once
+/*
+*	Truly Parallel Algorithms Library - Algorithm - find, find_if, any_of, all_of and none_of functions
+*	By: David Aaron Braun
+*	2022-08-23
+*/
+
+/*
+*           Copyright David Aaron Braun 2021 - .
+*   Distributed under the Boost Software License, Version 1.0.
+*       (See accompanying file LICENSE_1_0.txt or copy at
+*           https://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include <utility>
+#include <mutex>
+#include <future>
+#include <atomic>
+#include <iostream>
+#include <bit>
+
+#include <vector>
+
+#include "../_util.hpp"
+#include "../ThreadPool.hpp"
+#include "../excepts.hpp"
+#include "../size_t_lit.hpp"
+#include "../tpa_macros.hpp"
+#include "../predicates.hpp"
+#include "../tpa_concepts.hpp"
+#include "../InstructionSet.hpp"
+#include "../simd/simd.hpp"
+#include "../simd/vec.hpp"
+#include "../simd/dispatch.hpp"
+
+#include "count.hpp"
+#include "copy_if.hpp"
+
+/// <summary>
+/// <para>Private Namespace for TPA find, find_if, any_of, all_of and none_of.</para>
+/// <para>The threads walk neighbouring tiles of the container together and share the lowest index found so far,
+/// a thread stops as soon as its next tile starts past it. A hit near the front is found without reading the rest of the container.</para>
+/// </summary>
+namespace tpa_find_private
+{
+    /// <summary>
+    /// <para>Bytes searched per tile, the threads only look at the shared result between tiles.</para>
+    /// <para>Containers of one tile or less are searched on the calling thread.</para>
+    /// </summary>
+    inline constexpr size_t tile_bytes = 1uz << 16;
+
+    /// <summary>
+    /// <para>Tests a tpa::cond predicate and its parameter, NEGATE = looks for the elements which do NOT satisfy it (all_of).</para>
+    /// </summary>
+    template<tpa::cond COND, bool NEGATE, typename T, typename P>
+    struct cond_test
+    {
+        static constexpr bool vectorized = tpa_count_private::vec_countable<COND, T>;
+
+        tpa_copy_if_private::cond_filter<COND, T, P> filter;
+
+        explicit cond_test(const P p) : filter(p, true) {}
+
+        /// <summary>
+        /// <para>False when the parameter does not fit T and only the scalar kernel may be used.</para>
+        /// </summary>
+        [[nodiscard]] inline bool simd() const noexcept
+        {
+            return filter.simd;
+        }//End of simd
+
+        [[nodiscard]] inline bool operator()(const T x) const noexcept
+        {
+            return filter(x) != NEGATE;
+        }//End of operator()
+
+        template<size_t W>
+        [[nodiscard]] TPA_FORCE_INLINE tpa::simd::mask<T, W> operator()(const tpa::simd::vec<T, W> _val) const noexcept
+        {
+            const auto _hit = tpa_count_private::matches<COND>(_val, tpa::simd::vec<T, W>(filter.value));
+
+            if constexpr (NEGATE)
+            {
+                return ~_hit;
+            }//End if
+            else
+            {
+                return _hit;
+            }//End else
+        }//End of operator()
+    };//End of cond_test
+
+    /// <summary>
+    /// <para>Tests a user supplied vector predicate, called with tpa::simd::vec&lt;T, W&gt; and returning its comparison mask.</para>
+    /// <para>Single elements are tested as tpa::simd::vec&lt;T, 1&gt;, NEGATE = looks for the elements which do NOT satisfy it (all_of).</para>
+    /// </summary>
+    template<class PRED, bool NEGATE, typename T>
+    struct pred_test
+    {
+        static constexpr bool vectorized = tpa::simd::is_vec_type<T>;
+
+        const PRED& pred;
+
+        [[nodiscard]] inline bool simd() const noexcept
+        {
+            return true;
+        }//End of simd
+
+        [[nodiscard]] inline bool operator()(const T x) const
+        {
+            return pred(tpa::simd::vec<T, 1uz>(x)).any() != NEGATE;
+        }//End of operator()
+
+        template<size_t W>
+        [[nodiscard]] TPA_FORCE_INLINE tpa::simd::mask<T, W> operator()(const tpa::simd::vec<T, W> _val) const
+        {
+            if constexpr (NEGATE)
+            {
+                return ~pred(_val);
+            }//End if
+            else
+            {
+                return pred(_val);
+            }//End else
+        }//End of operator()
+    };//End of pred_test
+
+    /// <summary>
+    /// <para>Tests TPA_UNROLL vectors at a time and stops at the first vector with a set lane, 'i' is left at the first hit or at the first element not processed.</para>
+    /// <para>Returns true if a hit was found.</para>
+    /// </summary>
+    template<size_t W, typename T, class TEST>
+    TPA_FORCE_INLINE bool find_block(size_t& i, const size_t end, const T* arr, const TEST& test)
+    {
+        using V = tpa::simd::vec<T, W>;
+
+        constexpr size_t A = tpa::simd::unroll;
+        constexpr size_t step = W * A;
+
+        for (; (i + step) <= end; i += step)
+        {
+            tpa::simd::prefetch<step * sizeof(T)>(arr + i);
+
+            auto _any = test(V::load(arr + i));
+            for (size_t a = 1uz; a < A; ++a)
+            {
+                _any = _any | test(V::load(arr + i + (W * a)));
+            }//End for
+
+            if (_any.none())
+            {
+                continue;
+            }//End if
+
+            for (size_t a = 0uz; a < A; ++a)
+            {
+                const uint64_t bits = test(V::load(arr + i + (W * a))).bits();
+
+                if (bits != 0ull)
+                {
+                    i += (W * a) + static_cast<size_t>(std::countr_zero(bits));
+                    return true;
+                }//End if
+            }//End for
+        }//End for
+
+        for (; (i + W) <= end; i += W)
+        {
+            const uint64_t bits = test(V::load(arr + i)).bits();
+
+            if (bits != 0ull)
+            {
+                i += static_cast<size_t>(std::countr_zero(bits));
+                return true;
+            }//End if
+        }//End for
+
+        return false;
+    }//End of find_block
+
+    /// <summary>
+    /// <para>Returns the index of the first element of [i, end) which passes 'test' or 'end', also used to finish the leftovers of the SIMD kernels.</para>
+    /// </summary>
+    template<typename T, class TEST>
+    [[nodiscard]] inline size_t find_scalar(size_t i, const size_t end, const T* arr, const TEST& test)
+    {
+        for (; i != end; ++i)
+        {
+            if (test(arr[i]))
+            {
+                return i;
+            }//End if
+        }//End for
+
+        return end;
+    }//End of find_scalar
+
+#ifdef TPA_X86_64
+    template<typename T, class TEST>
+    TPA_TARGET_SSE41 TPA_FLATTEN inline size_t find_sse41(size_t i, const size_t end, const T* arr, const TEST& test)
+    {
+        if (tpa_find_private::find_block<16uz / sizeof(T)>(i, end, arr, test))
+        {
+            return i;
+        }//End if
+
+        return tpa_find_private::find_scalar(i, end, arr, test);
+    }//End of find_sse41
+
+    template<typename T, class TEST>
+    TPA_TARGET_AVX2 TPA_FLATTEN inline size_t find_avx2(size_t i, const size_t end, const T* arr, const TEST& test)
+    {
+        if (tpa_find_private::find_block<32uz / sizeof(T)>(i, end, arr, test))
+        {
+            return i;
+        }//End if
+
+        return tpa_find_private::find_scalar(i, end, arr, test);
+    }//End of find_avx2
+
+    template<typename T, class TEST>
+    TPA_TARGET_AVX512 TPA_FLATTEN inline size_t find_avx512(size_t i, const size_t end, const T* arr, const TEST& test)
+    {
+        if (tpa_find_private::find_block<64uz / sizeof(T)>(i, end, arr, test))
+        {
+            return i;
+        }//End if
+
+        return tpa_find_private::find_scalar(i, end, arr, test);
+    }//End of find_avx512
+#elif defined(TPA_NEON)
+    template<typename T, class TEST>
+    TPA_FLATTEN inline size_t find_neon(size_t i, const size_t end, const T* arr, const TEST& test)
+    {
+        if (tpa_find_private::find_block<16uz / sizeof(T)>(i, end, arr, test))
+        {
+            return i;
+        }//End if
+
+        return tpa_find_private::find_scalar(i, end, arr, test);
+    }//End of find_neon
+#endif
+
+    /// <summary>
+    /// <para>Returns the find kernels for T and TEST, only the scalar kernel when TEST cannot be tested on a tpa::simd::vec.</para>
+    /// </summary>
+    template<typename T, class TEST>
+    [[nodiscard]] inline auto find_kernels() noexcept
+    {
+        tpa::simd::kernel_table<size_t(size_t, const size_t, const T*, const TEST&)> table;
+        table.scalar = &tpa_find_private::find_scalar<T, TEST>;
+
+        if constexpr (TEST::vectorized)
+        {
+#ifdef TPA_X86_64
+            table.sse41 = &tpa_find_private::find_sse41<T, TEST>;
+            table.avx2 = &tpa_find_private::find_avx2<T, TEST>;
+            table.avx512 = &tpa_find_private::find_avx512<T, TEST>;
+#elif defined(TPA_NEON)
+            table.neon = &tpa_find_private::find_neon<T, TEST>;
+#endif
+        }//End if
+
+        return table;
+    }//End of find_kernels
+
+    /// <summary>
+    /// <para>Returns the index of the first element of [0, count) which passes 'test' or 'count' if none does.</para>
+    /// <para>The tiles are dealt out round-robin (see tpa::util::prepareTiling) and every hit lowers a shared atomic index,
+    /// tiles starting past it are skipped. Each thread searches its tiles in order, so its first hit is also its last.</para>
+    /// </summary>
+    template<typename T, class TEST>
+    [[nodiscard]] inline size_t find_threaded(const size_t count, const T* arr, const TEST& test)
+    {
+        //Built on first use, not per call
+        static const auto kernels = tpa_find_private::find_kernels<T, TEST>();
+
+        const auto kernel = test.simd() ? kernels.resolve_for(count * sizeof(T)) : kernels.scalar;
+
+        const size_t tile = tpa::util::max(1uz, tile_bytes / sizeof(T));
+
+        if (count <= tile)
+        {
+            return kernel(0uz, count, arr, test);
+        }//End if
+
+        uint32_t complete = 0;
+
+        std::vector<std::vector<std::pair<size_t, size_t>>> tiles;
+        tpa::util::prepareTiling(tiles, count, tile);
+
+        std::atomic<size_t> found = count;
+
+        std::vector<std::shared_future<uint32_t>> results;
+        results.reserve(tpa::nThreads);
+
+        std::shared_future<uint32_t> temp;
+
+        for (const auto& mine : tiles)
+        {
+            //Launch lambda from multiple threads
+            temp = tpa::tp->addTask([&mine, &found, kernel, arr, &test]()
+                {
+                    for (const auto& t : mine)
+                    {
+                        //Every element of this tile and the ones after it is past a known hit
+                        if (t.first >= found.load(std::memory_order_relaxed))
+                        {
+                            break;
+                        }//End if
+
+                        const size_t p = kernel(t.first, t.second, arr, test);
+
+                        if (p != t.second)
+                        {
+                            size_t best = found.load(std::memory_order_relaxed);
+
+                            while (p < best && !found.compare_exchange_weak(best, p, std::memory_order_relaxed))
+                            {
+                            }//End while
+
+                            break;
+                        }//End if
+                    }//End for
+
+                    return static_cast<uint32_t>(1);
+                });//End of lambda
+
+            results.emplace_back(std::move(temp));
+        }//End for
+
+        for (const auto& fut : results)
+        {
+            complete += fut.get();
+        }//End for
+
+        //Check all threads completed
+        if (complete != tpa::nThreads)
+        {
+            throw tpa::exceptions::NotAllThreadsCompleted(complete);
+        }//End if
+
+        return found.load();
+    }//End of find_threaded
+}//End of namespace
+
+/// <summary>
+/// <para>Truly Parallel Algorithms</para>
+/// <para>By David Aaron Braun</para>
+/// <para>Version 0.1</para>
+/// </summary>
+namespace tpa {
+#pragma region generic
+
+	/// <summary>
+	/// <para>Returns the index of the first element of the container which satisfies the tpa::cond predicate COND against 'param', or the size of the container if none does.</para>
+	/// <para>This parallel implementation uses Multi-Threading and SIMD, the threads search neighbouring tiles and stop at the first hit found by any of them.</para>
+	/// <para>Predicates other than the comparisons, EVEN and ODD are tested one element at a time.</para>
+	/// <para>Returns the size of the container if an exception is thrown.</para>
+	/// </summary>
+	/// <typeparam name="CONTAINER_T"></typeparam>
+	/// <typeparam name="P"></typeparam>
+	/// <param name="arr"></param>
+	/// <param name="param">Only used with predicates which take a parameter, see tpa::count_if</param>
+	/// <returns>The index of the first match</returns>
+	template<tpa::cond COND, class CONTAINER_T, typename P = CONTAINER_T::value_type>
+	[[nodiscard]] inline size_t find_if(const CONTAINER_T& arr, const P param = 0)
+	requires tpa::util::contiguous_seqeunce<CONTAINER_T> && std::is_arithmetic<typename CONTAINER_T::value_type>::value
+	{
+        try
+        {
+            using T = CONTAINER_T::value_type;
+
+            const tpa_find_private::cond_test<COND, false, T, P> test(param);
+
+            return tpa_find_private::find_threaded(arr.size(), arr.data(), test);
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::find_if(): " << ex.code()
+                << " " << ex.what() << "\n";
+            return arr.size();
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::find_if(): " << ex.what() << "\n";
+            return arr.size();
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::find_if(): " << ex.what() << "\n";
+            return arr.size();
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::find_if(): unknown!\n";
+            return arr.size();
+        }//End catch
+	}//End of find_if
+
+	/// <summary>
+	/// <para>Returns the index of the first element of the container for which 'pred' is true, or the size of the container if none.</para>
+	/// <para>As with tpa::transform 'pred' must be a generic lambda (or function object) taking a tpa::simd::vec&lt;T, W&gt; and returning its comparison mask.</para>
+	/// <para>e.g. the first NaN: tpa::find_if(arr, [](const auto x) { return x != x; });</para>
+	/// <para>This parallel implementation uses Multi-Threading and SIMD, the threads search neighbouring tiles and stop at the first hit found by any of them.</para>
+	/// <para>Returns the size of the container if an exception is thrown.</para>
+	/// </summary>
+	/// <typeparam name="CONTAINER_T"></typeparam>
+	/// <typeparam name="PRED"></typeparam>
+	/// <param name="arr"></param>
+	/// <param name="pred"></param>
+	/// <returns>The index of the first match</returns>
+	template<class CONTAINER_T, class PRED>
+	[[nodiscard]] inline size_t find_if(const CONTAINER_T& arr, const PRED& pred)
+	requires tpa::util::contiguous_seqeunce<CONTAINER_T> && std::is_arithmetic<typename CONTAINER_T::value_type>::value
+	{
+        try
+        {
+            using T = CONTAINER_T::value_type;
+
+            const tpa_find_private::pred_test<PRED, false, T> test{ pred };
+
+            return tpa_find_private::find_threaded(arr.size(), arr.data(), test);
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::find_if(): " << ex.code()
+                << " " << ex.what() << "\n";
+            return arr.size();
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::find_if(): " << ex.what() << "\n";
+            return arr.size();
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::find_if(): " << ex.what() << "\n";
+            return arr.size();
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::find_if(): unknown!\n";
+            return arr.size();
+        }//End catch
+	}//End of find_if
+
+	/// <summary>
+	/// <para>Returns the index of the first element of the container equal to 'value', or the size of the container if none is.</para>
+	/// <para>This parallel implementation uses Multi-Threading and SIMD, see tpa::find_if.</para>
+	/// </summary>
+	/// <typeparam name="CONTAINER_T"></typeparam>
+	/// <typeparam name="T"></typeparam>
+	/// <param name="arr"></param>
+	/// <param name="value"></param>
+	/// <returns>The index of the first match</returns>
+	template<class CONTAINER_T, typename T = CONTAINER_T::value_type>
+	[[nodiscard]] inline size_t find(const CONTAINER_T& arr, const T value)
+	requires tpa::util::contiguous_seqeunce<CONTAINER_T> && std::is_arithmetic<typename CONTAINER_T::value_type>::value
+	{
+		return tpa::find_if<tpa::cond::EQUAL_TO>(arr, value);
+	}//End of find
+
+	/// <summary>
+	/// <para>Returns true if any element of the container satisfies the tpa::cond predicate COND against 'param', false for an empty container.</para>
+	/// <para>Stops at the first match, see tpa::find_if.</para>
+	/// </summary>
+	/// <typeparam name="CONTAINER_T"></typeparam>
+	/// <typeparam name="P"></typeparam>
+	/// <param name="arr"></param>
+	/// <param name="param"></param>
+	/// <returns></returns>
+	template<tpa::cond COND, class CONTAINER_T, typename P = CONTAINER_T::value_type>
+	[[nodiscard]] inline bool any_of(const CONTAINER_T& arr, const P param = 0)
+	requires tpa::util::contiguous_seqeunce<CONTAINER_T> && std::is_arithmetic<typename CONTAINER_T::value_type>::value
+	{
+		return tpa::find_if<COND>(arr, param) != arr.size();
+	}//End of any_of
+
+	/// <summary>
+	/// <para>Returns true if 'pred' is true for any element of the container, false for an empty container.</para>
+	/// <para>'pred' takes a tpa::simd::vec&lt;T, W&gt; and returns its comparison mask, see tpa::find_if.</para>
+	/// </summary>
+	/// <typeparam name="CONTAINER_T"></typeparam>
+	/// <typeparam name="PRED"></typeparam>
+	/// <param name="arr"></param>
+	/// <param name="pred"></param>
+	/// <returns></returns>
+	template<class CONTAINER_T, class PRED>
+	[[nodiscard]] inline bool any_of(const CONTAINER_T& arr, const PRED& pred)
+	requires tpa::util::contiguous_seqeunce<CONTAINER_T> && std::is_arithmetic<typename CONTAINER_T::value_type>::value
+	{
+		return tpa::find_if(arr, pred) != arr.size();
+	}//End of any_of
+
+	/// <summary>
+	/// <para>Returns true if no element of the container satisfies the tpa::cond predicate COND against 'param', true for an empty container.</para>
+	/// <para>Stops at the first match, see tpa::find_if.</para>
+	/// </summary>
+	/// <typeparam name="CONTAINER_T"></typeparam>
+	/// <typeparam name="P"></typeparam>
+	/// <param name="arr"></param>
+	/// <param name="param"></param>
+	/// <returns></returns>
+	template<tpa::cond COND, class CONTAINER_T, typename P = CONTAINER_T::value_type>
+	[[nodiscard]] inline bool none_of(const CONTAINER_T& arr, const P param = 0)
+	requires tpa::util::contiguous_seqeunce<CONTAINER_T> && std::is_arithmetic<typename CONTAINER_T::value_type>::value
+	{
+		return tpa::find_if<COND>(arr, param) == arr.size();
+	}//End of none_of
+
+	/// <summary>
+	/// <para>Returns true if 'pred' is false for every element of the container, true for an empty container.</para>
+	/// <para>'pred' takes a tpa::simd::vec&lt;T, W&gt; and returns its comparison mask, see tpa::find_if.</para>
+	/// </summary>
+	/// <typeparam name="CONTAINER_T"></typeparam>
+	/// <typeparam name="PRED"></typeparam>
+	/// <param name="arr"></param>
+	/// <param name="pred"></param>
+	/// <returns></returns>
+	template<class CONTAINER_T, class PRED>
+	[[nodiscard]] inline bool none_of(const CONTAINER_T& arr, const PRED& pred)
+	requires tpa::util::contiguous_seqeunce<CONTAINER_T> && std::is_arithmetic<typename CONTAINER_T::value_type>::value
+	{
+		return tpa::find_if(arr, pred) == arr.size();
+	}//End of none_of
+
+	/// <summary>
+	/// <para>Returns true if every element of the container satisfies the tpa::cond predicate COND against 'param', true for an empty container.</para>
+	/// <para>Searches for the first element which does not and stops there, see tpa::find_if.</para>
+	/// <para>Returns false if an exception is thrown.</para>
+	/// </summary>
+	/// <typeparam name="CONTAINER_T"></typeparam>
+	/// <typeparam name="P"></typeparam>
+	/// <param name="arr"></param>
+	/// <param name="param"></param>
+	/// <returns></returns>
+	template<tpa::cond COND, class CONTAINER_T, typename P = CONTAINER_T::value_type>
+	[[nodiscard]] inline bool all_of(const CONTAINER_T& arr, const P param = 0)
+	requires tpa::util::contiguous_seqeunce<CONTAINER_T> && std::is_arithmetic<typename CONTAINER_T::value_type>::value
+	{
+        try
+        {
+            using T = CONTAINER_T::value_type;
+
+            const tpa_find_private::cond_test<COND, true, T, P> test(param);
+
+            return tpa_find_private::find_threaded(arr.size(), arr.data(), test) == arr.size();
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::all_of(): " << ex.code()
+                << " " << ex.what() << "\n";
+            return false;
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::all_of(): " << ex.what() << "\n";
+            return false;
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::all_of(): " << ex.what() << "\n";
+            return false;
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::all_of(): unknown!\n";
+            return false;
+        }//End catch
+	}//End of all_of
+
+	/// <summary>
+	/// <para>Returns true if 'pred' is true for every element of the container, true for an empty container.</para>
+	/// <para>'pred' takes a tpa::simd::vec&lt;T, W&gt; and returns its comparison mask, see tpa::find_if.</para>
+	/// <para>Searches for the first element for which it is false and stops there. Returns false if an exception is thrown.</para>
+	/// </summary>
+	/// <typeparam name="CONTAINER_T"></typeparam>
+	/// <typeparam name="PRED"></typeparam>
+	/// <param name="arr"></param>
+	/// <param name="pred"></param>
+	/// <returns></returns>
+	template<class CONTAINER_T, class PRED>
+	[[nodiscard]] inline bool all_of(const CONTAINER_T& arr, const PRED& pred)
+	requires tpa::util::contiguous_seqeunce<CONTAINER_T> && std::is_arithmetic<typename CONTAINER_T::value_type>::value
+	{
+        try
+        {
+            using T = CONTAINER_T::value_type;
+
+            const tpa_find_private::pred_test<PRED, true, T> test{ pred };
+
+            return tpa_find_private::find_threaded(arr.size(), arr.data(), test) == arr.size();
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::all_of(): " << ex.code()
+                << " " << ex.what() << "\n";
+            return false;
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::all_of(): " << ex.what() << "\n";
+            return false;
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::all_of(): " << ex.what() << "\n";
+            return false;
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::all_of(): unknown!\n";
+            return false;
+        }//End catch
+	}//End of all_of
+#pragma endregion
+}//End of namespace
@@ -31,6 +31,100 @@
 #include "../tpa_concepts.hpp"
 #include "../InstructionSet.hpp"
 #include "../simd/simd.hpp"
+#include "../simd/vec.hpp"
+#include "../simd/dispatch.hpp"
+
+/// <summary>
+/// <para>Private Namespace for TPA generate.</para>
+/// <para>Not intended to be used directly.</para>
+/// </summary>
+namespace tpa_generate_private {
+
+    /// <summary>
+    /// <para>Scalar generate of [i, end), also used to finish the leftovers of the streaming kernels.</para>
+    /// </summary>
+    template<typename T, class GENERATOR>
+    inline void generate_scalar(size_t i, const size_t end, T* arr, const GENERATOR& g)
+    {
+        for (; i != end; ++i)
+        {
+            arr[i] = static_cast<T>(g());
+        }//End for
+    }//End of generate_scalar
+
+    /// <summary>
+    /// <para>Generates BYTES worth of values at a time into a staging vector which is written with a non-temporal store, bypassing the cache.</para>
+    /// <para>Streaming stores must be aligned so a scalar head is peeled to a BYTES boundary, if 'arr' can never reach one the scalar kernel is used.</para>
+    /// </summary>
+    template<size_t BYTES, typename T, class GENERATOR>
+    TPA_FORCE_INLINE void generate_stream(size_t i, const size_t end, T* arr, const GENERATOR& g)
+    {
+        using V = tpa::simd::vec<T, BYTES / sizeof(T)>;
+
+        const size_t head = tpa::simd::align_index<BYTES>(i, end, arr);
+        tpa_generate_private::generate_scalar(i, head, arr, g);
+
+        i = head;
+
+        if ((reinterpret_cast<uintptr_t>(arr + i) & (BYTES - 1uz)) == 0uz)
+        {
+            T staged[V::width];
+
+            for (; (i + V::width) <= end; i += V::width)
+            {
+                for (size_t k = 0uz; k != V::width; ++k)
+                {
+                    staged[k] = static_cast<T>(g());
+                }//End for
+
+                V::load(staged).store_stream(arr + i);
+            }//End for
+
+            tpa::simd::stream_fence();
+        }//End if
+
+        tpa_generate_private::generate_scalar(i, end, arr, g);
+    }//End of generate_stream
+
+#ifdef TPA_X86_64
+    template<typename T, class GENERATOR>
+    TPA_TARGET_SSE41 inline void generate_stream_sse41(size_t i, const size_t end, T* arr, const GENERATOR& g)
+    {
+        tpa_generate_private::generate_stream<16uz>(i, end, arr, g);
+    }//End of generate_stream_sse41
+
+    template<typename T, class GENERATOR>
+    TPA_TARGET_AVX2 inline void generate_stream_avx2(size_t i, const size_t end, T* arr, const GENERATOR& g)
+    {
+        tpa_generate_private::generate_stream<32uz>(i, end, arr, g);
+    }//End of generate_stream_avx2
+
+    template<typename T, class GENERATOR>
+    TPA_TARGET_AVX512 inline void generate_stream_avx512(size_t i, const size_t end, T* arr, const GENERATOR& g)
+    {
+        tpa_generate_private::generate_stream<64uz>(i, end, arr, g);
+    }//End of generate_stream_avx512
+#endif
+
+    /// <summary>
+    /// <para>Returns the streaming generate kernels for this hardware, built once per instantiation.</para>
+    /// <para>NEON has no non-temporal store intrinsic, ARM uses the scalar kernel.</para>
+    /// </summary>
+    template<typename T, class GENERATOR>
+    [[nodiscard]] inline auto generate_stream_kernels() noexcept
+    {
+        tpa::simd::kernel_table<void(size_t, const size_t, T*, const GENERATOR&)> table;
+        table.scalar = &tpa_generate_private::generate_scalar<T, GENERATOR>;
+
+#ifdef TPA_X86_64
+        table.sse41 = &tpa_generate_private::generate_stream_sse41<T, GENERATOR>;
+        table.avx2 = &tpa_generate_private::generate_stream_avx2<T, GENERATOR>;
+        table.avx512 = &tpa_generate_private::generate_stream_avx512<T, GENERATOR>;
+#endif
+
+        return table;
+    }//End of generate_stream_kernels
+}//End of namespace
 
 /// <summary>
 /// <para>Truly Parallel Algorithms</para>
@@ -46,14 +140,16 @@ namespace tpa {
     /// item_count is not specifed it will be set to the size of the container. </para>
     /// <para>All generated values are staticly cast to the value type of the container</para>
     /// <para>This parallel implementation utilizes multi-threading but not SIMD.</para>
+    /// <para>Outputs of at least 'stream_threshold' bytes are staged in vectors and written with non-temporal stores so that they do not evict the cache.</para>
     /// </summary>
     /// <typeparam name="CONTAINER"></typeparam>
     /// <typeparam name="GENERATOR"></typeparam>
     /// <param name="arr"></param>
     /// <param name="gen"></param>
     /// <param name="item_count"></param>
+    /// <param name="stream_threshold"> - optional defaults to tpa::simd::stream_min_bytes (the last level cache size)</param>
     template<typename CONTAINER, class GENERATOR>
-    inline constexpr void generate(CONTAINER& arr, const GENERATOR gen, size_t item_count = 0)
+    inline constexpr void generate(CONTAINER& arr, const GENERATOR gen, size_t item_count = 0, const size_t stream_threshold = tpa::simd::stream_min_bytes)
     requires tpa::util::contiguous_seqeunce<CONTAINER>
     {
         try
@@ -64,8 +160,12 @@ namespace tpa {
                 item_count = arr.size();
             }//End if
 
+            using T = CONTAINER::value_type;
+
             uint32_t complete = 0;
 
+            const bool stream = (item_count * sizeof(T)) >= stream_threshold;
+
             std::vector<std::pair<size_t, size_t>> sections;
             tpa::util::prepareThreading(sections, item_count);
 
@@ -76,13 +176,27 @@ namespace tpa {
 
             for (const auto& sec : sections)
             {
-                temp = tpa::tp->addTask([&arr, &gen, &sec]()
+                temp = tpa::tp->addTask([&arr, &gen, &sec, stream]()
                     {
                         const size_t beg = sec.first;
                         const size_t end = sec.second;
                         size_t i = beg;
 
                         const GENERATOR g = gen;
+#pragma region stream
+                        if constexpr (tpa::simd::is_vec_type<T>)
+                        {
+                            if (stream)
+                            {
+                                //Built on first use, not per call
+                                static const auto stream_kernels = tpa_generate_private::generate_stream_kernels<T, GENERATOR>();
+
+                                stream_kernels.resolve_for((end - i) * sizeof(T))(i, end, &arr[0], g);
+
+                                return 1u;
+                            }//End if
+                        }//End if
+#pragma endregion
 #pragma region generic      
                         for (; i != end; ++i)
                         {
@@ -211,17 +325,17 @@ namespace tpa {
                                 }//End if
                             }//End else
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512_ByteWord)
+                            if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
                             {
                                 const __m512i _two = _mm512_setr_epi8(
                                     2, 4, 6, 8, 10, 12, 14, 16,
                                     18, 20, 22, 24, 26, 28, 30, 32,
                                     34, 36, 38, 40, 42, 44, 46, 48,
                                     50, 52, 54, 56, 58, 60, 62, 64,
-                                    66, 68, 70, 72, 74, 78, 80, 82,
-                                    84, 86, 88, 90, 92, 94, 96, 98,
-                                    100,102,104,106,108,110,112,114,
-                                    116,118,120,122,124,126,128);
+                                    66, 68, 70, 72, 74, 76, 78, 80,
+                                    82, 84, 86, 88, 90, 92, 94, 96,
+                                    98, 100, 102, 104, 106, 108, 110, 112,
+                                    114, 116, 118, 120, 122, 124, 126, 128);
 
                                 __m512i _counter;
 
@@ -233,8 +347,8 @@ namespace tpa {
 
                                     _mm512_storeu_epi8(&arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2) [[likely]]
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [[likely]] [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _two = _mm256_setr_epi8(
                                     2, 4, 6, 8, 10, 12, 14, 16,
@@ -249,9 +363,9 @@ namespace tpa {
 
                                     _counter = _mm256_add_epi8(_counter, _two);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _counter);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                             T even_val = static_cast<T>((i * 2) + start);
 
@@ -282,17 +396,17 @@ namespace tpa {
                                 }//End if
                             }//End else
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512_ByteWord)
+                            if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
                             {
                                 const __m512i _two = _mm512_setr_epi8(
                                     2, 4, 6, 8, 10, 12, 14, 16,
                                     18, 20, 22, 24, 26, 28, 30, 32,
                                     34, 36, 38, 40, 42, 44, 46, 48,
                                     50, 52, 54, 56, 58, 60, 62, 64,
-                                    66, 68, 70, 72, 74, 78, 80, 82,
-                                    84, 86, 88, 90, 92, 94, 96, 98,
-                                    100, 102, 104, 106, 108, 110, 112, 114,
-                                    116, 118, 120, 122, 124, 126, 128);
+                                    66, 68, 70, 72, 74, 76, 78, 80,
+                                    82, 84, 86, 88, 90, 92, 94, 96,
+                                    98, 100, 102, 104, 106, 108, 110, 112,
+                                    114, 116, 118, 120, 122, 124, 126, 128);
 
                                 __m512i _counter;
 
@@ -304,8 +418,8 @@ namespace tpa {
 
                                     _mm512_storeu_epi8( &arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2) [[likely]]
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [[likely]] [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _two = _mm256_setr_epi8(
                                     2, 4, 6, 8, 10, 12, 14, 16,
@@ -320,9 +434,9 @@ namespace tpa {
 
                                     _counter = _mm256_add_epi8(_counter, _two);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _counter);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
 
                             T odd_val = static_cast<T>((i * 2) + start);
@@ -337,7 +451,7 @@ namespace tpa {
                         {
                             T val;
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512_ByteWord)
+                            if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
                             {
                                 const __m512i _adder =
                                     _mm512_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
@@ -354,10 +468,10 @@ namespace tpa {
 
                                     _Res = _mm512_add_epi8(_Val, _adder);
 
-                                    _mm256_storeu_epi8(&arr[i], _Res);
+                                    _mm512_storeu_epi8(&arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2) [[likely]]
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [[likely]] [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _adder =
                                     _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31);
@@ -372,9 +486,9 @@ namespace tpa {
 
                                     _Res = _mm256_add_epi8(_Val, _adder);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _Res);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                             for (; i != end; ++i)
                             {
@@ -414,7 +528,7 @@ namespace tpa {
                         else if constexpr (INSTR == tpa::gen::SECURE_RAND)
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasRD_RAND)
+                            if (tpa::hasRD_RAND) [&]() TPA_TARGET("rdrnd")
                             {
                                 uint16_t random = 0u;
                                 for (; i != end; ++i)
@@ -423,7 +537,7 @@ namespace tpa {
                                     arr[i] = static_cast<T>(arg1 + (random % ((arg2 + 1u) - arg1)));
                                 }
 
-                            }//End if
+                            }();//End if
                             else
                             {
                                 std::srand(std::time(NULL));
@@ -685,17 +799,17 @@ namespace tpa {
                                 }//End if
                             }//End else
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512_ByteWord)
+                            if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
                             {
                                 const __m512i _two = _mm512_setr_epi8(
                                     2, 4, 6, 8, 10, 12, 14, 16,
                                     18, 20, 22, 24, 26, 28, 30, 32,
                                     34, 36, 38, 40, 42, 44, 46, 48,
                                     50, 52, 54, 56, 58, 60, 62, 64,
-                                    66, 68, 70, 72, 74, 78, 80, 82,
-                                    84, 86, 88, 90, 92, 94, 96, 98,
-                                    100, 102, 104, 106, 108, 110, 112, 114,
-                                    116, 118, 120, 122, 124, 126, 128);
+                                    66, 68, 70, 72, 74, 76, 78, 80,
+                                    82, 84, 86, 88, 90, 92, 94, 96,
+                                    98, 100, 102, 104, 106, 108, 110, 112,
+                                    114, 116, 118, 120, 122, 124, 126, 128);
 
                                 __m512i _counter;
 
@@ -707,8 +821,8 @@ namespace tpa {
 
                                     _mm512_storeu_epi8(&arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _two = _mm256_setr_epi8(
                                     2, 4, 6, 8, 10, 12, 14, 16,
@@ -723,9 +837,9 @@ namespace tpa {
 
                                     _counter = _mm256_add_epi8(_counter, _two);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _counter);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
 
                             T even_val = static_cast<T>((i * 2) + start);
@@ -757,17 +871,17 @@ namespace tpa {
                                 }//End if
                             }//End else
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512_ByteWord)
+                            if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
                             {
                                 const __m512i _two = _mm512_setr_epi8(
                                     2, 4, 6, 8, 10, 12, 14, 16,
                                     18, 20, 22, 24, 26, 28, 30, 32,
                                     34, 36, 38, 40, 42, 44, 46, 48,
                                     50, 52, 54, 56, 58, 60, 62, 64,
-                                    66, 68, 70, 72, 74, 78, 80, 82,
-                                    84, 86, 88, 90, 92, 94, 96, 98,
-                                    100, 102, 104, 106, 108, 110, 112, 114,
-                                    116, 118, 120, 122, 124, 126, 128);
+                                    66, 68, 70, 72, 74, 76, 78, 80,
+                                    82, 84, 86, 88, 90, 92, 94, 96,
+                                    98, 100, 102, 104, 106, 108, 110, 112,
+                                    114, 116, 118, 120, 122, 124, 126, 128);
 
                                 __m512i _counter;
 
@@ -779,8 +893,8 @@ namespace tpa {
 
                                     _mm512_storeu_epi8(&arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _two = _mm256_setr_epi8(
                                     2, 4, 6, 8, 10, 12, 14, 16,
@@ -796,9 +910,9 @@ namespace tpa {
 
                                     _counter = _mm256_add_epi8(_counter, _two);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _counter);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
 
                             T odd_val = static_cast<T>((i * 2) + start);
@@ -813,7 +927,7 @@ namespace tpa {
                         {
                             T val;
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512_ByteWord)
+                            if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
                             {
                                 const __m512i _adder =
                                     _mm512_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
@@ -830,10 +944,10 @@ namespace tpa {
 
                                     _Res = _mm512_add_epi8(_Val, _adder);
 
-                                    _mm256_storeu_epi8(&arr[i], _Res);
+                                    _mm512_storeu_epi8(&arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _adder =
                                     _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31);
@@ -848,9 +962,9 @@ namespace tpa {
 
                                     _Res = _mm256_add_epi8(_Val, _adder);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _Res);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                             for (; i != end; ++i)
                             {
@@ -890,7 +1004,7 @@ namespace tpa {
                         else if constexpr (INSTR == tpa::gen::SECURE_RAND)
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasRD_RAND)
+                            if (tpa::hasRD_RAND) [&]() TPA_TARGET("rdrnd")
                             {
                                 uint16_t random = 0u;
                                 for (; i != end; ++i)
@@ -899,7 +1013,7 @@ namespace tpa {
                                     arr[i] = static_cast<T>(arg1 + (random % ((arg2 + 1u) - arg1)));
                                 }
 
-                            }//End if
+                            }();//End if
                             else
                             {
                                 std::srand(std::time(NULL));
@@ -1161,11 +1275,11 @@ namespace tpa {
                                 }//End if
                             }//End else
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512_ByteWord)
+                            if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
                             {
                                 const __m512i _two = _mm512_setr_epi16(2, 4, 6, 8, 10, 12, 14, 16,
                                    18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48,
-                                   50, 52, 54, 56, 58, 60, 64);
+                                   50, 52, 54, 56, 58, 60, 62, 64);
                                 __m512i _counter;
 
                                 for (; i+32 < end; i += 32)
@@ -1174,10 +1288,10 @@ namespace tpa {
 
                                     _counter = _mm512_add_epi16(_counter, _two);
 
-                                    _mm256_storeu_epi16(&arr[i], _counter);
+                                    _mm512_storeu_epi16(&arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _two = _mm256_setr_epi16(2, 4, 6, 8, 10, 12, 14, 16,
                                     18, 20, 22, 24, 26, 28, 30, 32);
@@ -1189,9 +1303,9 @@ namespace tpa {
 
                                     _counter = _mm256_add_epi16(_counter, _two);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _counter);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                             T even_val = static_cast<T>((i * 2) + start);
 
@@ -1222,11 +1336,11 @@ namespace tpa {
                                 }//End if
                             }//End else
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512_ByteWord)
+                            if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
                             {
                                 const __m512i _two = _mm512_setr_epi16(2, 4, 6, 8, 10, 12, 14, 16,
-                                    18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48,
-                                    50, 52, 54, 56, 58, 60, 64);
+                                   18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48,
+                                   50, 52, 54, 56, 58, 60, 62, 64);
                                 __m512i _counter;
 
                                 for (; i+32 < end; i += 32)
@@ -1237,8 +1351,8 @@ namespace tpa {
 
                                     _mm512_storeu_epi8(&arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _two = _mm256_setr_epi16(2, 4, 6, 8, 10, 12, 14, 16,
                                     18, 20, 22, 24, 26, 28, 30, 32);
@@ -1250,9 +1364,9 @@ namespace tpa {
 
                                     _counter = _mm256_add_epi16(_counter, _two);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _counter);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
 
                             T odd_val = static_cast<T>((i * 2) + start);
@@ -1267,30 +1381,25 @@ namespace tpa {
                         {
                             T val;
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512_ByteWord)
+                            if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
                             {
                                 const __m512i _adder =
                                     _mm512_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31);
 
-                                __m256i _Val, _Res;
+                                __m512i _Val, _Res;
 
                                 for (; i+32 < end; i += 32)
                                 {
                                     val = static_cast<T>(arg1 + i);
 
-                                    if ((i + 16) > end) [[unlikely]]
-                                    {
-                                        break;
-                                    }//End if
+                                    _Val = _mm512_set1_epi16(static_cast<int16_t>(val));
 
-                                    _Val = _mm256_set1_epi16(static_cast<int16_t>(val));
-
-                                    _Res = _mm256_add_epi16(_Val, _adder);
+                                    _Res = _mm512_add_epi16(_Val, _adder);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _Res);
+                                    _mm512_storeu_si512(&arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _adder =
                                     _mm256_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
@@ -1305,9 +1414,9 @@ namespace tpa {
 
                                     _Res = _mm256_add_epi16(_Val, _adder);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _Res);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                             for (; i != end; ++i)
                             {
@@ -1347,7 +1456,7 @@ namespace tpa {
                         else if constexpr (INSTR == tpa::gen::SECURE_RAND)
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasRD_RAND)
+                            if (tpa::hasRD_RAND) [&]() TPA_TARGET("rdrnd")
                             {
                                 uint16_t random = 0u;
                                 for (; i != end; ++i)
@@ -1356,7 +1465,7 @@ namespace tpa {
                                     arr[i] = static_cast<T>(arg1 + (random % ((arg2 + 1u) - arg1)));
                                 }
 
-                            }//End if
+                            }();//End if
                             else
                             {
                                 std::srand(std::time(NULL));
@@ -1381,7 +1490,7 @@ namespace tpa {
                             std::srand(std::time(nullptr));
                             std::mt19937_64 e(std::rand());
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
                             {
                                 constexpr uint16_t thirteen = 13u;
                                 constexpr uint16_t seven = 7u;
@@ -1392,7 +1501,8 @@ namespace tpa {
                                 const __m512i _one = _mm512_set1_epi16(1u);
                                 const __m512i _arg1 = _mm512_set1_epi16(static_cast<uint16_t>(arg1));
                                 const __m512i _arg2 = _mm512_set1_epi16(static_cast<uint16_t>(arg2));
-                                const __m512i _range = _mm512_sub_epi16(_mm512_add_epi16(_arg2, _one), _arg1);
+                                //'range' wraps to 0 when [arg1, arg2] is the full range of the type, every value is then already in range
+                                const tpa::simd::int_divider<uint16_t> _range_div((range != 0u) ? range : 1u);
 
                                 __m512i _temp = _mm512_setzero_si512();
                                 __m512i _res = _mm512_setzero_si512();
@@ -1444,13 +1554,13 @@ namespace tpa {
                                     _seed = _mm512_xor_si512(_seed, _temp);
 
                                     //_temp = tpa::util::_mm512_narrow_epi32(_seed, range);
-                                    _temp = _mm512_rem_epu16(_seed, _range);
+                                    _temp = (range != 0u) ? tpa::simd::_mm512_rem_magic(_seed, _range_div) : _seed;
                                     _res = _mm512_add_epi16(_temp, _arg1);
 
                                     _mm512_storeu_epi16(&arr[i], _res);
                                 }//End for
-                            }//End if
-                            else if (tpa::hasAVX2 && tpa::hasFMA)
+                            }();//End if
+                            else if (tpa::hasAVX2 && tpa::hasFMA) [&]() TPA_TARGET("avx2,fma")
                             {
                                 constexpr uint16_t thirteen = 13u;
                                 constexpr uint16_t seven = 7u;
@@ -1461,7 +1571,8 @@ namespace tpa {
                                 const __m256i _one = _mm256_set1_epi16(1u);
                                 const __m256i _arg1 = _mm256_set1_epi16(static_cast<uint16_t>(arg1));
                                 const __m256i _arg2 = _mm256_set1_epi16(static_cast<uint16_t>(arg2));
-                                const __m256i _range = _mm256_sub_epi16(_mm256_add_epi16(_arg2, _one), _arg1);
+                                //'range' wraps to 0 when [arg1, arg2] is the full range of the type, every value is then already in range
+                                const tpa::simd::int_divider<uint16_t> _range_div((range != 0u) ? range : 1u);
 
                                 __m256i _temp = _mm256_setzero_si256();
                                 __m256i _res = _mm256_setzero_si256();
@@ -1497,14 +1608,14 @@ namespace tpa {
                                     _seed = _mm256_xor_si256(_seed, _temp);
 
                                     //Narrow Range                                    
-                                    _temp = _mm256_rem_epu16(_seed, _range);
+                                    _temp = (range != 0u) ? tpa::simd::_mm256_rem_magic(_seed, _range_div) : _seed;
                                     _res = _mm256_add_epi16(_temp, _arg1);                                    
                                     //_temp = tpa::util::_mm256_narrow_epi32(_seed, range);
                                     //_res = _mm256_add_epi32(_temp, _arg1);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _res);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _res);
                                 }//End for
-                            }//End if
+                            }();//End if
                             else if (tpa::has_SSE2)
                             {
                                 constexpr uint16_t thirteen = 13u;
@@ -1516,7 +1627,8 @@ namespace tpa {
                                 const __m128i _one = _mm_set1_epi16(1u);
                                 const __m128i _arg1 = _mm_set1_epi16(static_cast<uint16_t>(arg1));
                                 const __m128i _arg2 = _mm_set1_epi16(static_cast<uint16_t>(arg2));
-                                const __m128i _range = _mm_sub_epi16(_mm_add_epi16(_arg2, _one), _arg1);
+                                //'range' wraps to 0 when [arg1, arg2] is the full range of the type, every value is then already in range
+                                const tpa::simd::int_divider<uint16_t> _range_div((range != 0u) ? range : 1u);
 
                                 __m128i _temp = _mm_setzero_si128();
                                 __m128i _res = _mm_setzero_si128();
@@ -1544,12 +1656,12 @@ namespace tpa {
                                     _seed = _mm_xor_si128(_seed, _temp);
 
                                     //Narrow Range                                    
-                                    _temp = _mm_rem_epu16(_seed, _range);
+                                    _temp = (range != 0u) ? tpa::simd::_mm_rem_magic(_seed, _range_div) : _seed;
                                     _res = _mm_add_epi16(_temp, _arg1);
                                     //_temp = tpa::util::_mm256_narrow_epi32(_seed, range);
                                     //_res = _mm256_add_epi32(_temp, _arg1);
 
-                                    _mm_store_si128((__m128i*) & arr[i], _res);
+                                    _mm_storeu_si128((__m128i*) & arr[i], _res);
                                 }//End for
                             }//End if
 #endif                            
@@ -1792,11 +1904,11 @@ namespace tpa {
                                 }//End if
                             }//End else
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512_ByteWord)
+                            if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
                             {
                                 const __m512i _two = _mm512_setr_epi16(2, 4, 6, 8, 10, 12, 14, 16,
-                                    18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48,
-                                    50, 52, 54, 56, 58, 60, 64);
+                                   18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48,
+                                   50, 52, 54, 56, 58, 60, 62, 64);
                                 __m512i _counter;
 
                                 for (; i + 32 < end; i += 32)
@@ -1805,10 +1917,10 @@ namespace tpa {
 
                                     _counter = _mm512_add_epi16(_counter, _two);
 
-                                    _mm256_storeu_epi16(&arr[i], _counter);
+                                    _mm512_storeu_epi16(&arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _two = _mm256_setr_epi16(2, 4, 6, 8, 10, 12, 14, 16,
                                     18, 20, 22, 24, 26, 28, 30, 32);
@@ -1820,9 +1932,9 @@ namespace tpa {
 
                                     _counter = _mm256_add_epi16(_counter, _two);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _counter);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
 
                             T even_val = static_cast<T>((i * 2) + start);
@@ -1853,11 +1965,11 @@ namespace tpa {
                                 }//End if
                             }//End else
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512_ByteWord)
+                            if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
                             {
                                 const __m512i _two = _mm512_setr_epi16(2, 4, 6, 8, 10, 12, 14, 16,
-                                    18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48,
-                                    50, 52, 54, 56, 58, 60, 64);
+                                   18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48,
+                                   50, 52, 54, 56, 58, 60, 62, 64);
                                 __m512i _counter;
 
                                 for (; i + 32 < end; i += 32)
@@ -1868,8 +1980,8 @@ namespace tpa {
 
                                     _mm512_storeu_epi8(&arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _two = _mm256_setr_epi16(2, 4, 6, 8, 10, 12, 14, 16,
                                     18, 20, 22, 24, 26, 28, 30, 32);
@@ -1881,9 +1993,9 @@ namespace tpa {
 
                                     _counter = _mm256_add_epi16(_counter, _two);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _counter);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                             T odd_val = static_cast<T>((i * 2) + start);
 
@@ -1897,30 +2009,25 @@ namespace tpa {
                         {
                             T val;
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512_ByteWord)
+                            if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
                             {
                                 const __m512i _adder =
                                     _mm512_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31);
 
-                                __m256i _Val, _Res;
+                                __m512i _Val, _Res;
 
                                 for (; i + 32 < end; i += 32)
                                 {
                                     val = static_cast<T>(arg1 + i);
 
-                                    if ((i + 16) > end) [[unlikely]]
-                                    {
-                                        break;
-                                    }//End if
+                                    _Val = _mm512_set1_epi16(static_cast<int16_t>(val));
 
-                                    _Val = _mm256_set1_epi16(static_cast<int16_t>(val));
+                                    _Res = _mm512_add_epi16(_Val, _adder);
 
-                                    _Res = _mm256_add_epi16(_Val, _adder);
-
-                                    _mm256_store_si256((__m256i*) & arr[i], _Res);
+                                    _mm512_storeu_si512(&arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _adder =
                                     _mm256_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
@@ -1935,9 +2042,9 @@ namespace tpa {
 
                                     _Res = _mm256_add_epi16(_Val, _adder);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _Res);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                             for (; i != end; ++i)
                             {
@@ -1977,7 +2084,7 @@ namespace tpa {
                         else if constexpr (INSTR == tpa::gen::SECURE_RAND)
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasRD_RAND)
+                            if (tpa::hasRD_RAND) [&]() TPA_TARGET("rdrnd")
                             {
                                 uint16_t random = 0u;
                                 for (; i != end; ++i)
@@ -1986,7 +2093,7 @@ namespace tpa {
                                     arr[i] = static_cast<T>(arg1 + (random % ((arg2 + 1u) - arg1)));
                                 }
 
-                            }//End if
+                            }();//End if
                             else
                             {
                                 std::srand(std::time(NULL));
@@ -2011,7 +2118,7 @@ namespace tpa {
                             std::srand(std::time(nullptr));
                             std::mt19937_64 e(std::rand());
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
                             {
                                 constexpr uint16_t thirteen = 13u;
                                 constexpr uint16_t seven = 7u;
@@ -2022,7 +2129,8 @@ namespace tpa {
                                 const __m512i _one = _mm512_set1_epi16(1u);
                                 const __m512i _arg1 = _mm512_set1_epi16(static_cast<uint16_t>(arg1));
                                 const __m512i _arg2 = _mm512_set1_epi16(static_cast<uint16_t>(arg2));
-                                const __m512i _range = _mm512_sub_epi16(_mm512_add_epi16(_arg2, _one), _arg1);
+                                //'range' wraps to 0 when [arg1, arg2] is the full range of the type, every value is then already in range
+                                const tpa::simd::int_divider<uint16_t> _range_div((range != 0u) ? range : 1u);
 
                                 __m512i _temp = _mm512_setzero_si512();
                                 __m512i _res = _mm512_setzero_si512();
@@ -2074,13 +2182,13 @@ namespace tpa {
                                     _seed = _mm512_xor_si512(_seed, _temp);
 
                                     //_temp = tpa::util::_mm512_narrow_epi32(_seed, range);
-                                    _temp = _mm512_rem_epu16(_seed, _range);
+                                    _temp = (range != 0u) ? tpa::simd::_mm512_rem_magic(_seed, _range_div) : _seed;
                                     _res = _mm512_add_epi16(_temp, _arg1);
 
                                     _mm512_storeu_epi16(&arr[i], _res);
                                 }//End for
-                            }//End if
-                            else if (tpa::hasAVX2 && tpa::hasFMA)
+                            }();//End if
+                            else if (tpa::hasAVX2 && tpa::hasFMA) [&]() TPA_TARGET("avx2,fma")
                             {
                                 constexpr uint16_t thirteen = 13u;
                                 constexpr uint16_t seven = 7u;
@@ -2091,7 +2199,8 @@ namespace tpa {
                                 const __m256i _one = _mm256_set1_epi16(1u);
                                 const __m256i _arg1 = _mm256_set1_epi16(static_cast<uint16_t>(arg1));
                                 const __m256i _arg2 = _mm256_set1_epi16(static_cast<uint16_t>(arg2));
-                                const __m256i _range = _mm256_sub_epi16(_mm256_add_epi16(_arg2, _one), _arg1);
+                                //'range' wraps to 0 when [arg1, arg2] is the full range of the type, every value is then already in range
+                                const tpa::simd::int_divider<uint16_t> _range_div((range != 0u) ? range : 1u);
 
                                 __m256i _temp = _mm256_setzero_si256();
                                 __m256i _res = _mm256_setzero_si256();
@@ -2127,14 +2236,14 @@ namespace tpa {
                                     _seed = _mm256_xor_si256(_seed, _temp);
 
                                     //Narrow Range                                    
-                                    _temp = _mm256_rem_epu16(_seed, _range);
+                                    _temp = (range != 0u) ? tpa::simd::_mm256_rem_magic(_seed, _range_div) : _seed;
                                     _res = _mm256_add_epi16(_temp, _arg1);
                                     //_temp = tpa::util::_mm256_narrow_epi32(_seed, range);
                                     //_res = _mm256_add_epi32(_temp, _arg1);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _res);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _res);
                                 }//End for
-                            }//End if
+                            }();//End if
                             else if (tpa::has_SSE2)
                             {
                                 constexpr uint16_t thirteen = 13u;
@@ -2146,7 +2255,8 @@ namespace tpa {
                                 const __m128i _one = _mm_set1_epi16(1u);
                                 const __m128i _arg1 = _mm_set1_epi16(static_cast<uint16_t>(arg1));
                                 const __m128i _arg2 = _mm_set1_epi16(static_cast<uint16_t>(arg2));
-                                const __m128i _range = _mm_sub_epi16(_mm_add_epi16(_arg2, _one), _arg1);
+                                //'range' wraps to 0 when [arg1, arg2] is the full range of the type, every value is then already in range
+                                const tpa::simd::int_divider<uint16_t> _range_div((range != 0u) ? range : 1u);
 
                                 __m128i _temp = _mm_setzero_si128();
                                 __m128i _res = _mm_setzero_si128();
@@ -2174,12 +2284,12 @@ namespace tpa {
                                     _seed = _mm_xor_si128(_seed, _temp);
 
                                     //Narrow Range                                    
-                                    _temp = _mm_rem_epu16(_seed, _range);
+                                    _temp = (range != 0u) ? tpa::simd::_mm_rem_magic(_seed, _range_div) : _seed;
                                     _res = _mm_add_epi16(_temp, _arg1);
                                     //_temp = tpa::util::_mm256_narrow_epi32(_seed, range);
                                     //_res = _mm256_add_epi32(_temp, _arg1);
 
-                                    _mm_store_si128((__m128i*) & arr[i], _res);
+                                    _mm_storeu_si128((__m128i*) & arr[i], _res);
                                 }//End for
                             }//End if
 #endif                            
@@ -2422,7 +2532,7 @@ namespace tpa {
                                 }//End if
                             }//End else
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
                                 const __m512i _twos = _mm512_setr_epi32(2, 4, 6, 8, 10, 12, 14, 16,
                                                                        18,20,22,24, 26, 28, 30, 32);
@@ -2434,10 +2544,10 @@ namespace tpa {
 
                                     _counter = _mm512_add_epi32(_counter, _twos);
 
-                                    _mm512_store_epi32( &arr[i], _counter);
+                                    _mm512_storeu_epi32( &arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _twos = _mm256_setr_epi32(2, 4, 6, 8, 10, 12, 14, 16);
                                 __m256i _counter;                             
@@ -2448,9 +2558,9 @@ namespace tpa {
 
                                     _counter = _mm256_add_epi32(_counter, _twos);
 
-                                    _mm256_store_si256((__m256i*) &arr[i], _counter);
+                                    _mm256_storeu_si256((__m256i*) &arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                             T even_val = static_cast<T>((i * 2) + start);
 
@@ -2481,7 +2591,7 @@ namespace tpa {
                                 }//End if
                             }//End else
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
                                 const __m512i _twos = _mm512_setr_epi32(2, 4, 6, 8, 10, 12, 14, 16,
                                     18, 20, 22, 24, 26, 28, 30, 32);
@@ -2493,10 +2603,10 @@ namespace tpa {
 
                                     _counter = _mm512_add_epi32(_counter, _twos);
 
-                                    _mm512_store_epi32(&arr[i], _counter);
+                                    _mm512_storeu_epi32(&arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _twos = _mm256_setr_epi32(2, 4, 6, 8, 10, 12, 14, 16);
                                 __m256i _counter;
@@ -2507,9 +2617,9 @@ namespace tpa {
 
                                     _counter = _mm256_add_epi32(_counter, _twos);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _counter);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                             T odd_val = static_cast<T>((i * 2) + start);
 
@@ -2523,7 +2633,7 @@ namespace tpa {
                         {
                             T val;
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
                                 const __m512i _adder = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7,
                                                                          8, 9,10,11,12,13,14,15);
@@ -2538,10 +2648,10 @@ namespace tpa {
 
                                     _Res = _mm512_add_epi32(_Val, _adder);
 
-                                    _mm512_store_epi32(&arr[i], _Res);
+                                    _mm512_storeu_epi32(&arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _adder = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
 
@@ -2555,9 +2665,9 @@ namespace tpa {
 
                                     _Res = _mm256_add_epi32(_Val, _adder);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _Res);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                             for (; i != end; ++i)
                             {
@@ -2597,7 +2707,7 @@ namespace tpa {
                         else if constexpr (INSTR == tpa::gen::SECURE_RAND)
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasRD_RAND)
+                            if (tpa::hasRD_RAND) [&]() TPA_TARGET("rdrnd")
                             {
                                 uint32_t random = 0u;
                                 for (; i != end; ++i)
@@ -2606,7 +2716,7 @@ namespace tpa {
                                     arr[i] = static_cast<T>(arg1 + (random % ((arg2 + 1u) - arg1)));
                                 }
 
-                            }//End if
+                            }();//End if
                             else
                             {
                                 std::srand(std::time(NULL));
@@ -2631,7 +2741,7 @@ namespace tpa {
                             std::srand(std::time(nullptr));
                             std::mt19937_64 e(std::rand());
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
                                 constexpr uint32_t thirteen = 13u;
                                 constexpr uint32_t seven = 7u;
@@ -2680,10 +2790,10 @@ namespace tpa {
                                     _temp = tpa::simd::_mm512_narrow_epi32(_seed, range);
                                     _res = _mm512_add_epi32(_temp, _arg1);
 
-                                    _mm512_store_epi32(&arr[i], _res);
+                                    _mm512_storeu_epi32(&arr[i], _res);
                                 }//End for
-                            }//End if
-                            else if (tpa::hasAVX2 && tpa::hasFMA)
+                            }();//End if
+                            else if (tpa::hasAVX2 && tpa::hasFMA) [&]() TPA_TARGET("avx2,fma")
                             {
                                 constexpr uint32_t thirteen = 13u;
                                 constexpr uint32_t seven = 7u;
@@ -2694,7 +2804,8 @@ namespace tpa {
                                 const __m256i _one = _mm256_set1_epi32(1u);
                                 const __m256i _arg1 = _mm256_set1_epi32(static_cast<uint32_t>(arg1));
                                 const __m256i _arg2 = _mm256_set1_epi32(static_cast<uint32_t>(arg2));   
-                                const __m256i _range = _mm256_sub_epi32(_mm256_add_epi32(_arg2, _one), _arg1);
+                                //'range' wraps to 0 when [arg1, arg2] is the full range of the type, every value is then already in range
+                                const tpa::simd::int_divider<uint32_t> _range_div((range != 0u) ? range : 1u);
                                
                                 __m256i _temp = _mm256_setzero_si256();
                                 __m256i _res = _mm256_setzero_si256();
@@ -2723,15 +2834,15 @@ namespace tpa {
 
                                     //Narrow Range
                                     /* SLOW!
-                                    _temp = _mm256_rem_epu32(_seed, _range);
+                                    _temp = (range != 0u) ? tpa::simd::_mm256_rem_magic(_seed, _range_div) : _seed;
                                     _res = _mm256_add_epi32(_temp, _arg1);
                                     */
                                     _temp = tpa::simd::_mm256_narrow_epi32(_seed, range);
                                     _res = _mm256_add_epi32(_temp, _arg1);
                                     
-                                    _mm256_store_si256((__m256i*) &arr[i], _res);
+                                    _mm256_storeu_si256((__m256i*) &arr[i], _res);
                                 }//End for
-                            }//End if
+                            }();//End if
                             else if (tpa::has_SSE2)
                             {
                                 constexpr uint32_t thirteen = 13u;
@@ -2769,7 +2880,7 @@ namespace tpa {
                                     _temp = tpa::simd::_mm_narrow_epi32(_seed, range);
                                     _res = _mm_add_epi32(_temp, _arg1);
 
-                                    _mm_store_si128((__m128i*) & arr[i], _res);
+                                    _mm_storeu_si128((__m128i*) & arr[i], _res);
                                 }//End for
                             }//End if
 #endif                            
@@ -3012,7 +3123,7 @@ namespace tpa {
                                 }//End if
                             }//End else
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
                                 const __m512i _twos = _mm512_setr_epi32(2, 4, 6, 8, 10, 12, 14, 16,
                                     18, 20, 22, 24, 26, 28, 30, 32);
@@ -3024,10 +3135,10 @@ namespace tpa {
 
                                     _counter = _mm512_add_epi32(_counter, _twos);
 
-                                    _mm512_store_epi32(&arr[i], _counter);
+                                    _mm512_storeu_epi32(&arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _two = _mm256_setr_epi32(2, 4, 6, 8, 10, 12, 14, 16);
                                 __m256i _counter;
@@ -3038,9 +3149,9 @@ namespace tpa {
 
                                     _counter = _mm256_add_epi32(_counter, _two);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _counter);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX
+                            }();//End if hasAVX
 #endif
                             T even_val = static_cast<T>((i * 2) + start);
 
@@ -3071,7 +3182,7 @@ namespace tpa {
                                 }//End if
                             }//End else
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
                                 const __m512i _twos = _mm512_setr_epi32(2, 4, 6, 8, 10, 12, 14, 16,
                                     18, 20, 22, 24, 26, 28, 30, 32);
@@ -3083,10 +3194,10 @@ namespace tpa {
 
                                     _counter = _mm512_add_epi32(_counter, _twos);
 
-                                    _mm512_store_epi32(&arr[i], _counter);
+                                    _mm512_storeu_epi32(&arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _two = _mm256_setr_epi32(2, 4, 6, 8, 10, 12, 14, 16);
                                 __m256i _counter;
@@ -3097,9 +3208,9 @@ namespace tpa {
 
                                     _counter = _mm256_add_epi32(_counter, _two);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _counter);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX
+                            }();//End if hasAVX
 #endif
 
                             T odd_val = static_cast<T>((i * 2) + start);
@@ -3114,7 +3225,7 @@ namespace tpa {
                         {
                             T val;
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
                                 const __m512i _adder = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7,
                                     8, 9, 10, 11, 12, 13, 14, 15);
@@ -3129,10 +3240,10 @@ namespace tpa {
 
                                     _Res = _mm512_add_epi32(_Val, _adder);
 
-                                    _mm512_store_epi32(&arr[i], _Res);
+                                    _mm512_storeu_epi32(&arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _adder = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
 
@@ -3146,9 +3257,9 @@ namespace tpa {
 
                                     _Res = _mm256_add_epi32(_Val, _adder);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _Res);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                             for (; i != end; ++i)
                             {
@@ -3188,7 +3299,7 @@ namespace tpa {
                         else if constexpr (INSTR == tpa::gen::SECURE_RAND)
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasRD_RAND)
+                            if (tpa::hasRD_RAND) [&]() TPA_TARGET("rdrnd")
                             {
                                 uint32_t random = 0u;
                                 for (; i != end; ++i)
@@ -3197,7 +3308,7 @@ namespace tpa {
                                     arr[i] = static_cast<T>(arg1 + (random % ((arg2 + 1u) - arg1)));
                                 }
 
-                            }//End if
+                            }();//End if
                             else
                             {
                                 std::srand(std::time(NULL));
@@ -3222,7 +3333,7 @@ namespace tpa {
                             std::srand(std::time(nullptr));
                             std::mt19937_64 e(std::rand());
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
                                 constexpr uint32_t thirteen = 13u;
                                 constexpr uint32_t seven = 7u;
@@ -3271,10 +3382,10 @@ namespace tpa {
                                     _temp = tpa::simd::_mm512_narrow_epi32(_seed, range);
                                     _res = _mm512_add_epi32(_temp, _arg1);
 
-                                    _mm512_store_epi32(&arr[i], _res);
+                                    _mm512_storeu_epi32(&arr[i], _res);
                                 }//End for
-                            }//End if
-                            else if (tpa::hasAVX2 && tpa::hasFMA)
+                            }();//End if
+                            else if (tpa::hasAVX2 && tpa::hasFMA) [&]() TPA_TARGET("avx2,fma")
                             {
                                 constexpr uint32_t thirteen = 13u;
                                 constexpr uint32_t seven = 7u;
@@ -3285,7 +3396,8 @@ namespace tpa {
                                 const __m256i _one = _mm256_set1_epi32(1u);
                                 const __m256i _arg1 = _mm256_set1_epi32(static_cast<uint32_t>(arg1));
                                 const __m256i _arg2 = _mm256_set1_epi32(static_cast<uint32_t>(arg2));
-                                const __m256i _range = _mm256_sub_epi32(_mm256_add_epi32(_arg2, _one), _arg1);
+                                //'range' wraps to 0 when [arg1, arg2] is the full range of the type, every value is then already in range
+                                const tpa::simd::int_divider<uint32_t> _range_div((range != 0u) ? range : 1u);
 
                                 __m256i _temp = _mm256_setzero_si256();
                                 __m256i _res = _mm256_setzero_si256();
@@ -3314,15 +3426,15 @@ namespace tpa {
 
                                     //Narrow Range
                                     /* SLOW!
-                                    _temp = _mm256_rem_epu32(_seed, _range);
+                                    _temp = (range != 0u) ? tpa::simd::_mm256_rem_magic(_seed, _range_div) : _seed;
                                     _res = _mm256_add_epi32(_temp, _arg1);
                                     */
                                     _temp = tpa::simd::_mm256_narrow_epi32(_seed, range);
                                     _res = _mm256_add_epi32(_temp, _arg1);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _res);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _res);
                                 }//End for
-                            }//End if
+                            }();//End if
                             else if (tpa::has_SSE2)
                             {
                                 constexpr uint32_t thirteen = 13u;
@@ -3360,7 +3472,7 @@ namespace tpa {
                                     _temp = tpa::simd::_mm_narrow_epi32(_seed, range);
                                     _res = _mm_add_epi32(_temp, _arg1);
 
-                                    _mm_store_si128((__m128i*) & arr[i], _res);
+                                    _mm_storeu_si128((__m128i*) & arr[i], _res);
                                 }//End for
                             }//End if
 #endif                            
@@ -3603,7 +3715,7 @@ namespace tpa {
                                 }//End if
                             }//End else
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
                                 const __m512i _two = _mm512_setr_epi64(2, 4, 6, 8,
                                                                        10,12,14,16);
@@ -3615,10 +3727,10 @@ namespace tpa {
 
                                     _counter = _mm512_add_epi64(_counter, _two);
 
-                                    _mm512_store_epi64(&arr[i], _counter);
+                                    _mm512_storeu_epi64(&arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _two = _mm256_setr_epi64x(2, 4, 6, 8);
                                 __m256i _counter;
@@ -3629,9 +3741,9 @@ namespace tpa {
 
                                     _counter = _mm256_add_epi64(_counter, _two);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _counter);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
 
                             T even_val = static_cast<T>((i * 2) + start);
@@ -3663,7 +3775,7 @@ namespace tpa {
                                 }//End if
                             }//End else
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
                                 const __m512i _two = _mm512_setr_epi64(2, 4, 6, 8,
                                                                        10, 12, 14, 16);
@@ -3675,10 +3787,10 @@ namespace tpa {
 
                                     _counter = _mm512_add_epi64(_counter, _two);
 
-                                    _mm512_store_epi64(&arr[i], _counter);
+                                    _mm512_storeu_epi64(&arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _two = _mm256_setr_epi64x(2, 4, 6, 8);
                                 __m256i _counter;
@@ -3689,9 +3801,9 @@ namespace tpa {
 
                                     _counter = _mm256_add_epi64(_counter, _two);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _counter);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                             T odd_val = static_cast<T>((i * 2) + start);
 
@@ -3705,7 +3817,7 @@ namespace tpa {
                         {
                             T val;
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
                                 const __m512i _adder = _mm512_setr_epi64(0, 1, 2, 3,
                                                                          4, 5, 6, 7);
@@ -3720,10 +3832,10 @@ namespace tpa {
 
                                     _Res = _mm512_add_epi64(_Val, _adder);
 
-                                    _mm512_store_epi64(&arr[i], _Res);
+                                    _mm512_storeu_epi64(&arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _adder = _mm256_setr_epi64x(0, 1, 2, 3);
 
@@ -3737,9 +3849,9 @@ namespace tpa {
 
                                     _Res = _mm256_add_epi64(_Val, _adder);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _Res);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                             for (; i != end; ++i)
                             {
@@ -3780,7 +3892,7 @@ namespace tpa {
                         else if constexpr (INSTR == tpa::gen::SECURE_RAND)
                         {
 #ifdef TPA_X86_64
-                        if (tpa::hasRD_RAND)
+                        if (tpa::hasRD_RAND) [&]() TPA_TARGET("rdrnd")
                         {
                             uint64_t random = 0ull;
                             for (; i != end; ++i)
@@ -3789,7 +3901,7 @@ namespace tpa {
                                 arr[i] = static_cast<T>(arg1 + (random % ((arg2 + 1ull) - arg1)));
                             }
 
-                        }//End if
+                        }();//End if
                         else
                         {
                             std::srand(std::time(NULL));
@@ -3816,7 +3928,7 @@ namespace tpa {
                             std::srand(std::time(nullptr));
                             std::mt19937_64 e(std::rand());
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512_DWQW)
+                            if (tpa::hasAVX512_DWQW) [&]() TPA_TARGET("avx512dq")
                             {
                                 constexpr uint64_t thirteen = 13ull;
                                 constexpr uint64_t seven = 7ull;
@@ -3857,10 +3969,10 @@ namespace tpa {
                                     _temp = tpa::simd::_mm512_narrow_epi64(_seed, range);
                                     _res = _mm512_add_epi64(_temp, _arg1);
 
-                                    _mm512_store_epi64(&arr[i], _res);
+                                    _mm512_storeu_epi64(&arr[i], _res);
                                 }//End for
-                            }//End if
-                            else if (tpa::hasAVX2 && tpa::hasFMA)
+                            }();//End if
+                            else if (tpa::hasAVX2 && tpa::hasFMA) [&]() TPA_TARGET("avx2,fma")
                             {
                                 constexpr uint64_t thirteen = 13ull;
                                 constexpr uint64_t seven = 7ull;
@@ -3871,7 +3983,8 @@ namespace tpa {
                                 const __m256i _one = _mm256_set1_epi64x(1ull);
                                 const __m256i _arg1 = _mm256_set1_epi64x(static_cast<uint64_t>(arg1));
                                 const __m256i _arg2 = _mm256_set1_epi64x(static_cast<uint64_t>(arg2));
-                                const __m256i _range = _mm256_sub_epi64(_mm256_add_epi64(_arg2, _one), _arg1);
+                                //'range' wraps to 0 when [arg1, arg2] is the full range of the type, every value is then already in range
+                                const tpa::simd::int_divider<uint64_t> _range_div((range != 0u) ? range : 1u);
 
                                 __m256i _temp = _mm256_setzero_si256();
                                 __m256i _res = _mm256_setzero_si256();
@@ -3896,15 +4009,15 @@ namespace tpa {
 
                                     //Narrow Range
                                     /* SLOW!
-                                    _temp = _mm256_rem_epu64(_seed, _range);
+                                    _temp = (range != 0u) ? tpa::simd::_mm256_rem_magic(_seed, _range_div) : _seed;
                                     _res = _mm256_add_epi64(_temp, _arg1);
                                     */
                                     _temp = tpa::simd::_mm256_narrow_epi64(_seed, range);
                                     _res = _mm256_add_epi64(_temp, _arg1);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _res);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _res);
                                 }//End for
-                            }//End if
+                            }();//End if
                             else if (tpa::has_SSE2)
                             {
                                 constexpr uint64_t thirteen = 13ull;
@@ -3940,7 +4053,7 @@ namespace tpa {
                                     _temp = tpa::simd::_mm_narrow_epi64(_seed, range);
                                     _res = _mm_add_epi64(_temp, _arg1);
 
-                                    _mm_store_si128((__m128i*) & arr[i], _res);
+                                    _mm_storeu_si128((__m128i*) & arr[i], _res);
                                 }//End for
                             }//End if
 #endif                            
@@ -4184,7 +4297,7 @@ namespace tpa {
                             }//End else
 
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
                                 const __m512i _two = _mm512_setr_epi64(2, 4, 6, 8,
                                     10, 12, 14, 16);
@@ -4196,10 +4309,10 @@ namespace tpa {
 
                                     _counter = _mm512_add_epi64(_counter, _two);
 
-                                    _mm512_store_epi64(&arr[i], _counter);
+                                    _mm512_storeu_epi64(&arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _two = _mm256_setr_epi64x(2, 4, 6, 8);
                                 __m256i _counter;
@@ -4210,9 +4323,9 @@ namespace tpa {
 
                                     _counter = _mm256_add_epi64(_counter, _two);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _counter);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
 
                             T even_val = static_cast<T>((i * 2) + start);
@@ -4244,7 +4357,7 @@ namespace tpa {
                                 }//End if
                             }//End else
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
                                 const __m512i _two = _mm512_setr_epi64(2, 4, 6, 8,
                                     10, 12, 14, 16);
@@ -4256,10 +4369,10 @@ namespace tpa {
 
                                     _counter = _mm512_add_epi64(_counter, _two);
 
-                                    _mm512_store_epi64(&arr[i], _counter);
+                                    _mm512_storeu_epi64(&arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _two = _mm256_setr_epi64x(2, 4, 6, 8);
                                 __m256i _counter;
@@ -4270,9 +4383,9 @@ namespace tpa {
 
                                     _counter = _mm256_add_epi64(_counter, _two);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _counter);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                             T odd_val = static_cast<T>((i * 2) + start);
 
@@ -4286,7 +4399,7 @@ namespace tpa {
                         {
                             T val;
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
                                 const __m512i _adder = _mm512_setr_epi64(0, 1, 2, 3,
                                     4, 5, 6, 7);
@@ -4301,10 +4414,10 @@ namespace tpa {
 
                                     _Res = _mm512_add_epi64(_Val, _adder);
 
-                                    _mm512_store_epi64(&arr[i], _Res);
+                                    _mm512_storeu_epi64(&arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _adder = _mm256_setr_epi64x(0, 1, 2, 3);
 
@@ -4318,9 +4431,9 @@ namespace tpa {
 
                                     _Res = _mm256_add_epi64(_Val, _adder);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _Res);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                             for (; i != end; ++i)
                             {
@@ -4361,7 +4474,7 @@ namespace tpa {
                         else if constexpr (INSTR == tpa::gen::SECURE_RAND)
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasRD_RAND)
+                            if (tpa::hasRD_RAND) [&]() TPA_TARGET("rdrnd")
                             {
                                 uint64_t random = 0ull;
                                 for (; i != end; ++i)
@@ -4370,7 +4483,7 @@ namespace tpa {
                                     arr[i] = static_cast<T>(arg1 + (random % ((arg2 + 1ull) - arg1)));
                                 }
 
-                            }//End if
+                            }();//End if
                             else
                             {
                                 std::srand(std::time(NULL));
@@ -4397,7 +4510,7 @@ namespace tpa {
                             std::srand(std::time(nullptr));
                             std::mt19937_64 e(std::rand());
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512_DWQW)
+                            if (tpa::hasAVX512_DWQW) [&]() TPA_TARGET("avx512dq")
                             {
                                 constexpr uint64_t thirteen = 13ull;
                                 constexpr uint64_t seven = 7ull;
@@ -4438,10 +4551,10 @@ namespace tpa {
                                     _temp = tpa::simd::_mm512_narrow_epi64(_seed, range);
                                     _res = _mm512_add_epi64(_temp, _arg1);
 
-                                    _mm512_store_epi64(&arr[i], _res);
+                                    _mm512_storeu_epi64(&arr[i], _res);
                                 }//End for
-                            }//End if
-                            else if (tpa::hasAVX2 && tpa::hasFMA)
+                            }();//End if
+                            else if (tpa::hasAVX2 && tpa::hasFMA) [&]() TPA_TARGET("avx2,fma")
                             {
                                 constexpr uint64_t thirteen = 13ull;
                                 constexpr uint64_t seven = 7ull;
@@ -4452,7 +4565,8 @@ namespace tpa {
                                 const __m256i _one = _mm256_set1_epi64x(1ull);
                                 const __m256i _arg1 = _mm256_set1_epi64x(static_cast<uint64_t>(arg1));
                                 const __m256i _arg2 = _mm256_set1_epi64x(static_cast<uint64_t>(arg2));
-                                const __m256i _range = _mm256_sub_epi64(_mm256_add_epi64(_arg2, _one), _arg1);
+                                //'range' wraps to 0 when [arg1, arg2] is the full range of the type, every value is then already in range
+                                const tpa::simd::int_divider<uint64_t> _range_div((range != 0u) ? range : 1u);
 
                                 __m256i _temp = _mm256_setzero_si256();
                                 __m256i _res = _mm256_setzero_si256();
@@ -4477,15 +4591,15 @@ namespace tpa {
 
                                     //Narrow Range
                                     /* SLOW!
-                                    _temp = _mm256_rem_epu64(_seed, _range);
+                                    _temp = (range != 0u) ? tpa::simd::_mm256_rem_magic(_seed, _range_div) : _seed;
                                     _res = _mm256_add_epi64(_temp, _arg1);
                                     */
                                     _temp = tpa::simd::_mm256_narrow_epi64(_seed, range);
                                     _res = _mm256_add_epi64(_temp, _arg1);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _res);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _res);
                                 }//End for
-                            }//End if
+                            }();//End if
                             else if (tpa::has_SSE2)
                             {
                                 constexpr uint64_t thirteen = 13ull;
@@ -4521,7 +4635,7 @@ namespace tpa {
                                     _temp = tpa::simd::_mm_narrow_epi64(_seed, range);
                                     _res = _mm_add_epi64(_temp, _arg1);
 
-                                    _mm_store_si128((__m128i*) & arr[i], _res);
+                                    _mm_storeu_si128((__m128i*) & arr[i], _res);
                                 }//End for
                             }//End if
 #endif                            
@@ -4765,9 +4879,9 @@ namespace tpa {
                             }//End else
 
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
-                                const __m512 _two = _mm512_setr_ps(2.0f, 4.0f, 6.0f, 8.0f, 10.0f, 12.0f, 14.0f, 16.0f, 18.0f, 20.0f, 22.0f, 24.0f, 24.0f, 26.0f, 28.0f, 30.0f, 32.0f);
+                                const __m512 _two = _mm512_setr_ps(2.0f, 4.0f, 6.0f, 8.0f, 10.0f, 12.0f, 14.0f, 16.0f, 18.0f, 20.0f, 22.0f, 24.0f, 26.0f, 28.0f, 30.0f, 32.0f);
                                 __m512 _counter;
 
                                 for (; i+16 < end; i += 16)
@@ -4776,10 +4890,10 @@ namespace tpa {
 
                                     _counter = _mm512_add_ps(_counter, _two);
 
-                                    _mm512_store_ps(&arr[i], _counter);
+                                    _mm512_storeu_ps(&arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
                             {
                                 const __m256 _two = _mm256_setr_ps(2.0f, 4.0f, 6.0f, 8.0f, 10.0f, 12.0f, 14.0f, 16.0f);
                                 __m256 _counter;
@@ -4790,9 +4904,9 @@ namespace tpa {
 
                                     _counter = _mm256_add_ps(_counter, _two);
 
-                                    _mm256_store_ps(&arr[i], _counter);
+                                    _mm256_storeu_ps(&arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX
+                            }();//End if hasAVX
 #endif
 
                             T even_val = static_cast<T>((i * 2) + start);
@@ -4824,9 +4938,9 @@ namespace tpa {
                                 }//End if
                             }//End else
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
-                                const __m512 _two = _mm512_setr_ps(2.0f, 4.0f, 6.0f, 8.0f, 10.0f, 12.0f, 14.0f, 16.0f, 18.0f, 20.0f, 22.0f, 24.0f, 24.0f, 26.0f, 28.0f, 30.0f, 32.0f);
+                                const __m512 _two = _mm512_setr_ps(2.0f, 4.0f, 6.0f, 8.0f, 10.0f, 12.0f, 14.0f, 16.0f, 18.0f, 20.0f, 22.0f, 24.0f, 26.0f, 28.0f, 30.0f, 32.0f);
                                 __m512 _counter;
 
                                 for (; i+16 < end; i += 16)
@@ -4835,10 +4949,10 @@ namespace tpa {
 
                                     _counter = _mm512_add_ps(_counter, _two);
 
-                                    _mm512_store_ps(&arr[i], _counter);
+                                    _mm512_storeu_ps(&arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX
-                            else if (tpa::hasAVX)
+                            }();//End if hasAVX
+                            else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
                             {
                                 const __m256 _two = _mm256_setr_ps(2.0f, 4.0f, 6.0f, 8.0f, 10.0f, 12.0f, 14.0f, 16.0f);
                                 __m256 _counter;
@@ -4849,9 +4963,9 @@ namespace tpa {
 
                                     _counter = _mm256_add_ps(_counter, _two);
 
-                                    _mm256_store_ps(&arr[i], _counter);
+                                    _mm256_storeu_ps(&arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX
+                            }();//End if hasAVX
 #endif
                             T odd_val = static_cast<T>((i * 2) + start);
 
@@ -4865,7 +4979,7 @@ namespace tpa {
                         {
                             T val;
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
                                 const __m512 _adder = _mm512_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f);
 
@@ -4879,10 +4993,10 @@ namespace tpa {
 
                                     _Res = _mm512_add_ps(_Val, _adder);
 
-                                    _mm512_store_ps(&arr[i], _Res);
+                                    _mm512_storeu_ps(&arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
                             {
                                 const __m256 _adder = _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7);
 
@@ -4896,9 +5010,9 @@ namespace tpa {
 
                                     _Res = _mm256_add_ps(_Val, _adder);
 
-                                    _mm256_store_ps(&arr[i], _Res);
+                                    _mm256_storeu_ps(&arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX
+                            }();//End if hasAVX
 #endif
                             for (; i != end; ++i)
                             {
@@ -4940,7 +5054,7 @@ namespace tpa {
                         else if constexpr (INSTR == tpa::gen::SECURE_RAND)
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasRD_RAND)
+                            if (tpa::hasRD_RAND) [&]() TPA_TARGET("rdrnd")
                             {
                                 uint32_t random = 0u;
                                 
@@ -4950,7 +5064,7 @@ namespace tpa {
                                     arr[i] = static_cast<T>(arg1 + (random % (arg2 + 1u) - arg1));
                                 }//End for
 
-                            }//End if
+                            }();//End if
                             else
                             {
                                 std::srand(std::time(NULL));
@@ -4979,7 +5093,7 @@ namespace tpa {
                             std::srand(std::time(nullptr));
                             std::mt19937_64 e(std::rand());
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
                                 constexpr uint32_t thirteen = 13u;
                                 constexpr uint32_t seven = 7u;
@@ -5031,10 +5145,10 @@ namespace tpa {
 
                                     _fres = _mm512_cvtepi32_ps(_res);
 
-                                    _mm512_store_ps(&arr[i], _fres);
+                                    _mm512_storeu_ps(&arr[i], _fres);
                                 }//End for
-                            }//End if
-                            else if (tpa::hasAVX2 && tpa::hasFMA)
+                            }();//End if
+                            else if (tpa::hasAVX2 && tpa::hasFMA) [&]() TPA_TARGET("avx2,fma")
                             {
                                 constexpr uint32_t thirteen = 13u;
                                 constexpr uint32_t seven = 7u;
@@ -5045,7 +5159,8 @@ namespace tpa {
                                 const __m256i _one = _mm256_set1_epi32(1u);
                                 const __m256i _arg1 = _mm256_set1_epi32(static_cast<uint32_t>(arg1));
                                 const __m256i _arg2 = _mm256_set1_epi32(static_cast<uint32_t>(arg2));
-                                const __m256i _range = _mm256_sub_epi32(_mm256_add_epi32(_arg2, _one), _arg1);
+                                //'range' wraps to 0 when [arg1, arg2] is the full range of the type, every value is then already in range
+                                const tpa::simd::int_divider<uint32_t> _range_div((range != 0u) ? range : 1u);
 
                                 __m256i _temp = _mm256_setzero_si256();
                                 __m256i _res = _mm256_setzero_si256();
@@ -5075,16 +5190,16 @@ namespace tpa {
 
                                     //Narrow Range
                                     /* SLOW!
-                                    _temp = _mm256_rem_epu32(_seed, _range);
+                                    _temp = (range != 0u) ? tpa::simd::_mm256_rem_magic(_seed, _range_div) : _seed;
                                     _res = _mm256_add_epi32(_temp, _arg1);
                                     */
                                     _temp = tpa::simd::_mm256_narrow_epi32(_seed, range);
                                     _res = _mm256_add_epi32(_temp, _arg1);
                                     _fres = _mm256_cvtepi32_ps(_res);
 
-                                    _mm256_store_ps(&arr[i], _fres);
+                                    _mm256_storeu_ps(&arr[i], _fres);
                                 }//End for
-                            }//End if
+                            }();//End if
                             else if (tpa::has_SSE2)
                             {
                                 constexpr uint32_t thirteen = 13u;
@@ -5124,7 +5239,7 @@ namespace tpa {
                                     _res = _mm_add_epi32(_temp, _arg1);
                                     _fres = _mm_cvtepi32_ps(_res);
 
-                                    _mm_store_ps(&arr[i], _fres);
+                                    _mm_storeu_ps(&arr[i], _fres);
                                 }//End for
                             }//End if
 #endif                            
@@ -5368,7 +5483,7 @@ namespace tpa {
                             }//End else
 
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
                                 const __m512d _two = _mm512_setr_pd(2.0, 4.0, 6.0, 8.0, 10.0, 12.0, 14.0, 16.0);
                                 __m512d _counter;
@@ -5379,10 +5494,10 @@ namespace tpa {
 
                                     _counter = _mm512_add_pd(_counter, _two);
 
-                                    _mm512_store_pd(&arr[i], _counter);
+                                    _mm512_storeu_pd(&arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
                             {            
                                 const __m256d _two = _mm256_setr_pd(2.0, 4.0, 6.0, 8.0);
                                 __m256d _counter;                                
@@ -5393,9 +5508,9 @@ namespace tpa {
 
                                     _counter = _mm256_add_pd(_counter, _two);
 
-                                    _mm256_store_pd(&arr[i], _counter);
+                                    _mm256_storeu_pd(&arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX
+                            }();//End if hasAVX
 #endif
 
                             T even_val = static_cast<T>((i * 2) + start);
@@ -5428,7 +5543,7 @@ namespace tpa {
                             }//End else
 
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
                                 const __m512d _two = _mm512_setr_pd(2.0, 4.0, 6.0, 8.0,
                                                                    10.0,12.0,14.0,16.0);
@@ -5440,10 +5555,10 @@ namespace tpa {
 
                                     _counter = _mm512_add_pd(_counter, _two);
 
-                                    _mm512_store_pd(&arr[i], _counter);
+                                    _mm512_storeu_pd(&arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX
-                            else if (tpa::hasAVX)
+                            }();//End if hasAVX
+                            else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
                             {
                                 const __m256d _two = _mm256_setr_pd(2.0, 4.0, 6.0, 8.0);
                                 __m256d _counter;
@@ -5454,9 +5569,9 @@ namespace tpa {
 
                                     _counter = _mm256_add_pd(_counter, _two);
 
-                                    _mm256_store_pd(&arr[i], _counter);
+                                    _mm256_storeu_pd(&arr[i], _counter);
                                 }//End for
-                            }//End if hasAVX
+                            }();//End if hasAVX
 #endif
                             T odd_val = static_cast<T>((i * 2) + start);
 
@@ -5470,11 +5585,11 @@ namespace tpa {
                         {
                             T val;
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
                                 const __m512d _adder = _mm512_setr_pd(0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0);
 
-                                __m256d _Val, _Res;
+                                __m512d _Val, _Res;
 
                                 for (; i+8 < end; i += 8)
                                 {
@@ -5484,10 +5599,10 @@ namespace tpa {
 
                                     _Res = _mm512_add_pd(_Val, _adder);
 
-                                    _mm512_store_pd(&arr[i], _Res);
+                                    _mm512_storeu_pd(&arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX
-                            else if (tpa::hasAVX)
+                            }();//End if hasAVX
+                            else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
                             {
                                 const __m256d _adder = _mm256_setr_pd(0, 1, 2, 3);
 
@@ -5501,9 +5616,9 @@ namespace tpa {
 
                                     _Res = _mm256_add_pd(_Val, _adder);
 
-                                    _mm256_store_pd(&arr[i], _Res);
+                                    _mm256_storeu_pd(&arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX
+                            }();//End if hasAVX
 #endif
                             for (; i != end; ++i)
                             {
@@ -5546,7 +5661,7 @@ namespace tpa {
                         else if constexpr (INSTR == tpa::gen::SECURE_RAND)
                         {
 #ifdef TPA_X86_64
-                        if (tpa::hasRD_RAND)
+                        if (tpa::hasRD_RAND) [&]() TPA_TARGET("rdrnd")
                         {
                             uint64_t random = 0ull;
 
@@ -5556,7 +5671,7 @@ namespace tpa {
                                 arr[i] = static_cast<T>(arg1 + (random % (arg2 + 1ull) - arg1));
                             }//End for
 
-                        }//End if
+                        }();//End if
                         else
                         {
                             std::srand(std::time(NULL));
@@ -5587,7 +5702,7 @@ namespace tpa {
                             std::srand(std::time(nullptr));
                             std::mt19937_64 e(std::rand());
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512_DWQW)
+                            if (tpa::hasAVX512_DWQW) [&]() TPA_TARGET("avx512dq")
                             {
                                 constexpr uint64_t thirteen = 13ull;
                                 constexpr uint64_t seven = 7ull;
@@ -5631,10 +5746,10 @@ namespace tpa {
 
                                     _fres = _mm512_cvtepi64_pd(_res);
 
-                                    _mm512_store_pd(&arr[i], _fres);
+                                    _mm512_storeu_pd(&arr[i], _fres);
                                 }//End for
-                                }//End if
-                            else if (tpa::hasAVX2 && tpa::hasFMA)
+                                }();//End if
+                            else if (tpa::hasAVX2 && tpa::hasFMA) [&]() TPA_TARGET("avx2,fma")
                             {
                                 constexpr uint64_t thirteen = 13ull;
                                 constexpr uint64_t seven = 7ull;
@@ -5645,7 +5760,8 @@ namespace tpa {
                                 const __m256i _one = _mm256_set1_epi64x(1ull );
                                 const __m256i _arg1 = _mm256_set1_epi64x(static_cast<uint64_t>(arg1));
                                 const __m256i _arg2 = _mm256_set1_epi64x(static_cast<uint64_t>(arg2));
-                                const __m256i _range = _mm256_sub_epi64(_mm256_add_epi64(_arg2, _one), _arg1);
+                                //'range' wraps to 0 when [arg1, arg2] is the full range of the type, every value is then already in range
+                                const tpa::simd::int_divider<uint64_t> _range_div((range != 0u) ? range : 1u);
 
                                 __m256i _temp = _mm256_setzero_si256();
                                 __m256i _res = _mm256_setzero_si256();
@@ -5671,16 +5787,16 @@ namespace tpa {
 
                                     //Narrow Range
                                     /* SLOW!
-                                    _temp = _mm256_rem_epu32(_seed, _range);
+                                    _temp = (range != 0u) ? tpa::simd::_mm256_rem_magic(_seed, _range_div) : _seed;
                                     _res = _mm256_add_epi32(_temp, _arg1);
                                     */
                                     _temp = tpa::simd::_mm256_narrow_epi64(_seed, range);
                                     _res = _mm256_add_epi64(_temp, _arg1);
                                     _fres = tpa::simd::_mm256_cvtepi64_pd(_res);
 
-                                    _mm256_store_pd(&arr[i], _fres);
+                                    _mm256_storeu_pd(&arr[i], _fres);
                                 }//End for
-                            }//End if
+                            }();//End if
                             else if (tpa::has_SSE2)
                             {
                                 constexpr uint64_t thirteen = 13ull;
@@ -5718,7 +5834,7 @@ namespace tpa {
                                     _res = _mm_add_epi64(_temp, _arg1);
                                     _fres = tpa::simd::_mm_cvtepi64_pd(_res);
 
-                                    _mm_store_pd(&arr[i], _fres);
+                                    _mm_storeu_pd(&arr[i], _fres);
                                 }//End for
                             }//End if
 #endif                            
@@ -6038,7 +6154,7 @@ namespace tpa {
                         else if constexpr (INSTR == tpa::gen::SECURE_RAND)
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasRD_RAND)
+                            if (tpa::hasRD_RAND) [&]() TPA_TARGET("rdrnd")
                             {
                                 uint64_t random = 0u;
                                 for (; i != end; ++i)
@@ -6047,7 +6163,7 @@ namespace tpa {
                                     arr[i] = static_cast<T>(arg1 + (random % ((arg2 + 1u) - arg1)));
                                 }
 
-                            }//End if
+                            }();//End if
                             else
                             {
                                 std::srand(std::time(NULL));
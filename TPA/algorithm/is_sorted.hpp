@@ -0,0 +1,229 @@
+#pragma once
+/*
+*	Truly Parallel Algorithms Library - Algorithm - is_sorted function
+*	By: David Aaron Braun
+*	2022-08-20
+*/
+
+/*
+*           Copyright David Aaron Braun 2021 - .
+*   Distributed under the Boost Software License, Version 1.0.
+*       (See accompanying file LICENSE_1_0.txt or copy at
+*           https://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include <utility>
+#include <mutex>
+#include <future>
+#include <iostream>
+
+#include <vector>
+
+#include "../_util.hpp"
+#include "../ThreadPool.hpp"
+#include "../excepts.hpp"
+#include "../size_t_lit.hpp"
+#include "../tpa_macros.hpp"
+#include "../predicates.hpp"
+#include "../tpa_concepts.hpp"
+#include "../InstructionSet.hpp"
+#include "../simd/simd.hpp"
+#include "../simd/vec.hpp"
+#include "../simd/dispatch.hpp"
+
+/// <summary>
+/// <para>Private Namespace for the TPA is_sorted kernels.</para>
+/// <para>Each kernel checks the pairs (arr[i], arr[i + 1]) for i in [beg, end) and returns false at the first pair where arr[i + 1] &lt; arr[i].</para>
+/// </summary>
+namespace tpa_is_sorted_private
+{
+    /// <summary>
+    /// <para>Compares a vector at i with the vector one element further on (two overlapping loads), W pairs at a time.</para>
+    /// </summary>
+    template<size_t W, typename T>
+    [[nodiscard]] TPA_FORCE_INLINE bool sorted_block(size_t& i, const size_t end, const T* arr) noexcept
+    {
+        using V = tpa::simd::vec<T, W>;
+
+        for (; (i + W) <= end; i += W)
+        {
+            tpa::simd::prefetch<V::bytes>(arr + i);
+
+            if ((V::load(arr + i + 1uz) < V::load(arr + i)).any())
+            {
+                return false;
+            }//End if
+        }//End for
+
+        return true;
+    }//End of sorted_block
+
+    template<typename T>
+    [[nodiscard]] inline bool sorted_scalar(size_t i, const size_t end, const T* arr) noexcept
+    {
+        for (; i != end; ++i)
+        {
+            if (arr[i + 1uz] < arr[i])
+            {
+                return false;
+            }//End if
+        }//End for
+
+        return true;
+    }//End of sorted_scalar
+
+#ifdef TPA_X86_64
+    template<typename T>
+    TPA_TARGET_SSE41 inline bool sorted_sse41(size_t i, const size_t end, const T* arr) noexcept
+    {
+        return tpa_is_sorted_private::sorted_block<16uz / sizeof(T)>(i, end, arr) && tpa_is_sorted_private::sorted_scalar(i, end, arr);
+    }//End of sorted_sse41
+
+    template<typename T>
+    TPA_TARGET_AVX2 inline bool sorted_avx2(size_t i, const size_t end, const T* arr) noexcept
+    {
+        return tpa_is_sorted_private::sorted_block<32uz / sizeof(T)>(i, end, arr) && tpa_is_sorted_private::sorted_scalar(i, end, arr);
+    }//End of sorted_avx2
+
+    template<typename T>
+    TPA_TARGET_AVX512 inline bool sorted_avx512(size_t i, const size_t end, const T* arr) noexcept
+    {
+        return tpa_is_sorted_private::sorted_block<64uz / sizeof(T)>(i, end, arr) && tpa_is_sorted_private::sorted_scalar(i, end, arr);
+    }//End of sorted_avx512
+#elif defined(TPA_NEON)
+    template<typename T>
+    inline bool sorted_neon(size_t i, const size_t end, const T* arr) noexcept
+    {
+        return tpa_is_sorted_private::sorted_block<16uz / sizeof(T)>(i, end, arr) && tpa_is_sorted_private::sorted_scalar(i, end, arr);
+    }//End of sorted_neon
+#endif
+
+    /// <summary>
+    /// <para>Returns the is_sorted kernels for T.</para>
+    /// </summary>
+    template<typename T>
+    [[nodiscard]] inline auto sorted_kernels() noexcept
+    {
+        tpa::simd::kernel_table<bool(size_t, const size_t, const T*)> table;
+        table.scalar = &tpa_is_sorted_private::sorted_scalar<T>;
+
+        if constexpr (tpa::simd::is_vec_type<T>)
+        {
+#ifdef TPA_X86_64
+            table.sse41 = &tpa_is_sorted_private::sorted_sse41<T>;
+            table.avx2 = &tpa_is_sorted_private::sorted_avx2<T>;
+            table.avx512 = &tpa_is_sorted_private::sorted_avx512<T>;
+#elif defined(TPA_NEON)
+            table.neon = &tpa_is_sorted_private::sorted_neon<T>;
+#endif
+        }//End if
+
+        return table;
+    }//End of sorted_kernels
+
+    /// <summary>
+    /// <para>Checks the 'count' - 1 adjacent pairs of 'arr' in parallel, every section also checks the pair that crosses into the next one.</para>
+    /// </summary>
+    template<typename T>
+    [[nodiscard]] inline bool sorted_threaded(const size_t count, const T* arr)
+    {
+        uint32_t complete = 0;
+        bool sorted = true;
+
+        std::vector<std::pair<size_t, size_t>> sections;
+        tpa::util::prepareThreading(sections, count - 1uz);
+
+        std::vector<std::shared_future<bool>> results;
+        results.reserve(tpa::nThreads);
+
+        std::shared_future<bool> temp;
+
+        //Built on first use, not per call
+        static const auto kernels = tpa_is_sorted_private::sorted_kernels<T>();
+
+        for (const auto& sec : sections)
+        {
+            //Launch lambda from multiple threads
+            temp = tpa::tp->addTask([&sec, arr]()
+                {
+                    return kernels.resolve_for((sec.second - sec.first) * sizeof(T))(sec.first, sec.second, arr);
+                });//End of lambda
+
+            results.emplace_back(std::move(temp));
+        }//End for
+
+        for (const auto& fut : results)
+        {
+            sorted = fut.get() && sorted;
+            complete += 1;
+        }//End for
+
+        //Check all threads completed
+        if (complete != tpa::nThreads)
+        {
+            throw tpa::exceptions::NotAllThreadsCompleted(complete);
+        }//End if
+
+        return sorted;
+    }//End of sorted_threaded
+}//End of namespace
+
+/// <summary>
+/// <para>Truly Parallel Algorithms</para>
+/// <para>By David Aaron Braun</para>
+/// <para>Version 0.1</para>
+/// </summary>
+namespace tpa {
+#pragma region generic
+
+	/// <summary>
+	/// <para>Returns true if the container is sorted in ascending order (no element is less than the one before it), as std::is_sorted.</para>
+	/// <para>This parallel implementation uses Multi-Threading and SIMD, comparing each vector with the vector loaded one element later.</para>
+	/// <para>Containers with fewer than 2 elements are sorted. If an exception is thrown, returns false.</para>
+	/// </summary>
+	/// <typeparam name="CONTAINER_T"></typeparam>
+	/// <typeparam name="T"></typeparam>
+	/// <param name="arr"></param>
+	/// <returns></returns>
+	template<class CONTAINER_T, typename T = CONTAINER_T::value_type>
+	[[nodiscard]] inline bool is_sorted(const CONTAINER_T& arr)
+	requires tpa::util::contiguous_seqeunce<CONTAINER_T> && std::is_arithmetic<T>::value
+	{
+        try
+        {
+            if (arr.size() < 2uz)
+            {
+                return true;
+            }//End if
+
+            return tpa_is_sorted_private::sorted_threaded(arr.size(), arr.data());
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::is_sorted(): " << ex.code()
+                << " " << ex.what() << "\n";
+            return false;
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::is_sorted(): " << ex.what() << "\n";
+            return false;
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::is_sorted(): " << ex.what() << "\n";
+            return false;
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::is_sorted(): unknown!\n";
+            return false;
+        }//End catch
+	}//End of is_sorted
+#pragma endregion
+}//End of namespace
@@ -0,0 +1,319 @@
+#pragma once
+/*
+*	Truly Parallel Algorithms Library - Algorithm - lower_bound_batch function
+*	By: David Aaron Braun
+*	2022-08-24
+*/
+
+/*
+*           Copyright David Aaron Braun 2021 - .
+*   Distributed under the Boost Software License, Version 1.0.
+*       (See accompanying file LICENSE_1_0.txt or copy at
+*           https://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include <utility>
+#include <mutex>
+#include <future>
+#include <iostream>
+#include <algorithm>
+#include <limits>
+
+#include <vector>
+
+#include "../_util.hpp"
+#include "../ThreadPool.hpp"
+#include "../excepts.hpp"
+#include "../size_t_lit.hpp"
+#include "../tpa_macros.hpp"
+#include "../tpa_concepts.hpp"
+#include "../InstructionSet.hpp"
+#include "../simd/simd.hpp"
+#include "../simd/vec.hpp"
+#include "../simd/dispatch.hpp"
+
+/// <summary>
+/// <para>Private Namespace for TPA lower_bound_batch.</para>
+/// <para>Every query runs the same branchless binary search, the probe lengths only depend on the size of the sorted array.
+/// Many queries are therefore searched in lock step so that their loads are independent and their cache misses overlap.</para>
+/// </summary>
+namespace tpa_lower_bound_private
+{
+    /// <summary>
+    /// <para>Number of queries the scalar kernel searches in lock step.</para>
+    /// </summary>
+    inline constexpr size_t interleave = 16uz;
+
+    /// <summary>
+    /// <para>Signed integer lanes as wide as T, used to hold the search positions of the SIMD kernels.</para>
+    /// </summary>
+    template<typename T>
+    using index_t = std::conditional_t<sizeof(T) == 4uz, int32_t, int64_t>;
+
+    /// <summary>
+    /// <para>Writes the lower bound in 'arr' of the 'G' queries starting at 'q' to 'out', 'n' must not be 0.</para>
+    /// <para>The half which can still hold the answer is picked with a multiply instead of a branch.</para>
+    /// </summary>
+    template<size_t G, typename T, typename O>
+    inline void search_group(const T* arr, const size_t n, const T* q, O* out)
+    {
+        size_t base[G] = {};
+
+        for (size_t len = n; len > 1uz; )
+        {
+            const size_t half = len / 2uz;
+
+            for (size_t g = 0uz; g != G; ++g)
+            {
+                base[g] += half * static_cast<size_t>(arr[base[g] + half] < q[g]);
+            }//End for
+
+            len -= half;
+        }//End for
+
+        for (size_t g = 0uz; g != G; ++g)
+        {
+            out[g] = static_cast<O>(base[g] + static_cast<size_t>(arr[base[g]] < q[g]));
+        }//End for
+    }//End of search_group
+
+    /// <summary>
+    /// <para>Writes the lower bound in 'arr' of the queries [i, end) to 'out', 'interleave' queries at a time.</para>
+    /// <para>Also used to finish the leftovers of the SIMD kernels.</para>
+    /// </summary>
+    template<typename T, typename O>
+    inline void search_scalar(size_t i, const size_t end, const T* arr, const size_t n, const T* q, O* out)
+    {
+        for (; (i + interleave) <= end; i += interleave)
+        {
+            tpa_lower_bound_private::search_group<interleave>(arr, n, q + i, out + i);
+        }//End for
+
+        for (; i != end; ++i)
+        {
+            tpa_lower_bound_private::search_group<1uz>(arr, n, q + i, out + i);
+        }//End for
+    }//End of search_scalar
+
+    /// <summary>
+    /// <para>Searches TPA_UNROLL vectors of queries in lock step with tpa::simd::gather, 'i' is advanced past the queries processed.</para>
+    /// <para>'n' must fit in index_t&lt;T&gt;.</para>
+    /// </summary>
+    template<size_t W, typename T, typename O>
+    TPA_FORCE_INLINE void search_block(size_t& i, const size_t end, const T* arr, const size_t n, const T* q, O* out)
+    {
+        using I = index_t<T>;
+        using V = tpa::simd::vec<T, W>;
+        using VI = tpa::simd::vec<I, W>;
+
+        constexpr size_t A = tpa::simd::unroll;
+        constexpr size_t step = W * A;
+
+        for (; (i + step) <= end; i += step)
+        {
+            V _q[A];
+            VI _base[A];
+
+            for (size_t a = 0uz; a < A; ++a)
+            {
+                _q[a] = V::load(q + i + (W * a));
+                _base[a] = VI(static_cast<I>(0));
+            }//End for
+
+            for (size_t len = n; len > 1uz; )
+            {
+                const size_t half = len / 2uz;
+                const VI _half(static_cast<I>(half));
+
+                for (size_t a = 0uz; a < A; ++a)
+                {
+                    const VI _probe = _base[a] + _half;
+                    _base[a] = tpa::simd::select(tpa::simd::mask_cast<I>(tpa::simd::gather(arr, _probe) < _q[a]), _probe, _base[a]);
+                }//End for
+
+                len -= half;
+            }//End for
+
+            for (size_t a = 0uz; a < A; ++a)
+            {
+                _base[a] = tpa::simd::select(tpa::simd::mask_cast<I>(tpa::simd::gather(arr, _base[a]) < _q[a]), _base[a] + VI(static_cast<I>(1)), _base[a]);
+
+                if constexpr (std::is_integral<O>::value && sizeof(O) == sizeof(I))
+                {
+                    _base[a].store(reinterpret_cast<I*>(out + i + (W * a)));
+                }//End if
+                else
+                {
+                    alignas(64) I lanes[W];
+                    _base[a].store(lanes);
+
+                    for (size_t k = 0uz; k != W; ++k)
+                    {
+                        out[i + (W * a) + k] = static_cast<O>(lanes[k]);
+                    }//End for
+                }//End else
+            }//End for
+        }//End for
+    }//End of search_block
+
+#ifdef TPA_X86_64
+    template<typename T, typename O>
+    TPA_TARGET_AVX2 inline void search_avx2(size_t i, const size_t end, const T* arr, const size_t n, const T* q, O* out)
+    {
+        tpa_lower_bound_private::search_block<32uz / sizeof(T)>(i, end, arr, n, q, out);
+        tpa_lower_bound_private::search_scalar(i, end, arr, n, q, out);
+    }//End of search_avx2
+
+    template<typename T, typename O>
+    TPA_TARGET_AVX512 inline void search_avx512(size_t i, const size_t end, const T* arr, const size_t n, const T* q, O* out)
+    {
+        tpa_lower_bound_private::search_block<64uz / sizeof(T)>(i, end, arr, n, q, out);
+        tpa_lower_bound_private::search_scalar(i, end, arr, n, q, out);
+    }//End of search_avx512
+#endif
+
+    /// <summary>
+    /// <para>Returns the lower_bound_batch kernels for T.</para>
+    /// <para>Only AVX2 and AVX-512 have gathers, and only for 32-bit and 64-bit lanes, everything else uses the interleaved scalar search which is faster than gathering lane by lane.</para>
+    /// </summary>
+    template<typename T, typename O>
+    [[nodiscard]] inline auto search_kernels() noexcept
+    {
+        tpa::simd::kernel_table<void(size_t, const size_t, const T*, const size_t, const T*, O*)> table;
+        table.scalar = &tpa_lower_bound_private::search_scalar<T, O>;
+
+        if constexpr (tpa::simd::is_vec_type<T> && sizeof(T) >= 4uz)
+        {
+#ifdef TPA_X86_64
+            table.avx2 = &tpa_lower_bound_private::search_avx2<T, O>;
+            table.avx512 = &tpa_lower_bound_private::search_avx512<T, O>;
+#endif
+        }//End if
+
+        return table;
+    }//End of search_kernels
+
+    /// <summary>
+    /// <para>Splits the 'm' queries across the thread pool and writes the lower bound of each in the 'n' sorted elements of 'arr' to 'out', 'n' must not be 0.</para>
+    /// </summary>
+    template<typename T, typename O>
+    inline void search_threaded(const T* arr, const size_t n, const T* q, const size_t m, O* out)
+    {
+        uint32_t complete = 0;
+
+        std::vector<std::pair<size_t, size_t>> sections;
+        tpa::util::prepareThreading(sections, m);
+
+        std::vector<std::shared_future<uint32_t>> results;
+        results.reserve(tpa::nThreads);
+
+        std::shared_future<uint32_t> temp;
+
+        //Built on first use, not per call
+        static const auto kernels = tpa_lower_bound_private::search_kernels<T, O>();
+
+        //The gather kernels hold positions in index_t<T>
+        const bool gathers = n <= static_cast<size_t>(std::numeric_limits<index_t<T>>::max());
+
+        for (const auto& sec : sections)
+        {
+            //Launch lambda from multiple threads
+            temp = tpa::tp->addTask([&sec, arr, n, q, out, gathers]()
+                {
+                    const auto kernel = gathers ? kernels.resolve_for((sec.second - sec.first) * sizeof(T)) : kernels.scalar;
+
+                    kernel(sec.first, sec.second, arr, n, q, out);
+
+                    return static_cast<uint32_t>(1);
+                });//End of lambda
+
+            results.emplace_back(std::move(temp));
+        }//End for
+
+        for (const auto& fut : results)
+        {
+            complete += fut.get();
+        }//End for
+
+        //Check all threads completed
+        if (complete != tpa::nThreads)
+        {
+            throw tpa::exceptions::NotAllThreadsCompleted(complete);
+        }//End if
+    }//End of search_threaded
+}//End of namespace
+
+/// <summary>
+/// <para>Truly Parallel Algorithms</para>
+/// <para>By David Aaron Braun</para>
+/// <para>Version 0.1</para>
+/// </summary>
+namespace tpa {
+#pragma region generic
+
+	/// <summary>
+	/// <para>Writes to 'out_indices' the index of the first element of 'sorted' which is not less than each element of 'queries', as std::lower_bound would.</para>
+	/// <para>'sorted' must be sorted in ascending order, the size of 'sorted' is written for queries greater than every element.</para>
+	/// <para>This parallel implementation uses Multi-Threading and SIMD, every thread runs a branchless binary search over many of its queries in lock step,
+	/// with AVX2 / AVX-512 gathers for 32-bit and 64-bit types.</para>
+	/// <para>'out_indices' must hold at least as many elements as 'queries', otherwise will throw an exception.</para>
+	/// </summary>
+	/// <typeparam name="SORTED_T"></typeparam>
+	/// <typeparam name="QUERIES_T"></typeparam>
+	/// <typeparam name="INDICES_T"></typeparam>
+	/// <typeparam name="T"></typeparam>
+	/// <param name="sorted"></param>
+	/// <param name="queries"></param>
+	/// <param name="out_indices"></param>
+	template<class SORTED_T, class QUERIES_T, class INDICES_T, typename T = SORTED_T::value_type>
+	inline void lower_bound_batch(const SORTED_T& sorted, const QUERIES_T& queries, INDICES_T& out_indices)
+	requires tpa::util::contiguous_seqeunce<SORTED_T> && tpa::util::contiguous_seqeunce<QUERIES_T> && tpa::util::contiguous_seqeunce<INDICES_T> && std::is_arithmetic<T>::value
+	{
+        try
+        {
+            static_assert(std::is_same<T, typename QUERIES_T::value_type>() == true, "Compile Error! The queries container must have the value type of the sorted container!");
+            static_assert(std::is_integral<typename INDICES_T::value_type>() == true, "Compile Error! The indices container must have an integral value type!");
+
+            if (out_indices.size() < queries.size())
+            {
+                throw tpa::exceptions::ArrayTooSmall();
+            }//End if
+
+            if (queries.empty())
+            {
+                return;
+            }//End if
+
+            if (sorted.empty())
+            {
+                std::fill(out_indices.begin(), out_indices.begin() + static_cast<std::ptrdiff_t>(queries.size()), static_cast<typename INDICES_T::value_type>(0));
+                return;
+            }//End if
+
+            tpa_lower_bound_private::search_threaded(sorted.data(), sorted.size(), queries.data(), queries.size(), out_indices.data());
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::lower_bound_batch(): " << ex.code()
+                << " " << ex.what() << "\n";
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::lower_bound_batch(): " << ex.what() << "\n";
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::lower_bound_batch(): " << ex.what() << "\n";
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::lower_bound_batch(): unknown!\n";
+        }//End catch
+	}//End of lower_bound_batch
+#pragma endregion
+}//End of namespace
@@ -31,6 +31,51 @@
 #include "../tpa_concepts.hpp"
 #include "../InstructionSet.hpp"
 #include "../simd/simd.hpp"
+#include "../simd/vec.hpp"
+
+/// <summary>
+/// <para>Private Namespace for the TPA max_element kernels.</para>
+/// </summary>
+namespace tpa_max_element_private
+{
+#ifdef TPA_NEON
+    /// <summary>
+    /// <para>Folds the largest element of [i, end) into 'res' with 128-bit NEON, 'i' is advanced past the elements processed.</para>
+    /// <para>tpa::simd::unroll independent accumulators hide the latency of the max instruction.</para>
+    /// </summary>
+    template<typename T>
+    inline void max_neon(size_t& i, const size_t end, const T* arr, T& res) noexcept
+    {
+        using V = tpa::simd::vec<T, 16uz / sizeof(T)>;
+        constexpr size_t step = V::width * tpa::simd::unroll;
+
+        if ((i + step) > end)
+        {
+            return;
+        }//End if
+
+        std::array<V, tpa::simd::unroll> _max;
+        _max.fill(V(res));
+
+        for (; (i + step) <= end; i += step)
+        {
+            tpa::simd::prefetch<step * sizeof(T)>(&arr[i]);
+
+            for (size_t u = 0uz; u < tpa::simd::unroll; ++u)
+            {
+                _max[u] = tpa::simd::max(_max[u], V::load(&arr[i + (V::width * u)]));
+            }//End for
+        }//End for
+
+        for (size_t u = 1uz; u < tpa::simd::unroll; ++u)
+        {
+            _max[0] = tpa::simd::max(_max[0], _max[u]);
+        }//End for
+
+        res = tpa::simd::reduce_max(_max[0]);
+    }//End of max_neon
+#endif
+}//End of namespace
 
 /// <summary>
 /// <para>Truly Parallel Algorithms</para>
@@ -88,7 +133,7 @@ namespace tpa {
                         if constexpr (std::is_same<T, int8_t>())
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512_ByteWord)
+                            if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
                             {
                                 __m512i _first, _second, _third, _forth, _max;
 
@@ -120,8 +165,8 @@ namespace tpa {
 #endif
                                     }//End for                                    
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 __m256i _first, _second, _third, _forth, _max;
 
@@ -133,10 +178,10 @@ namespace tpa {
                                     }//End if
 
                                     //Load Data
-                                    _first = _mm256_load_si256((__m256i*) & arr[i]);
-                                    _second = _mm256_load_si256((__m256i*) & arr[i + 32]);
-                                    _third = _mm256_load_si256((__m256i*) & arr[i + 64]);
-                                    _forth = _mm256_load_si256((__m256i*) & arr[i + 96]);
+                                    _first = _mm256_loadu_si256((__m256i*) & arr[i]);
+                                    _second = _mm256_loadu_si256((__m256i*) & arr[i + 32]);
+                                    _third = _mm256_loadu_si256((__m256i*) & arr[i + 64]);
+                                    _forth = _mm256_loadu_si256((__m256i*) & arr[i + 96]);
 
                                     //Compute max
                                     _max = _mm256_max_epi8(_first, _second);
@@ -153,7 +198,7 @@ namespace tpa {
 #endif
                                     }//End for                                    
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                         }//End if
 #pragma endregion
@@ -161,7 +206,7 @@ namespace tpa {
                         else if constexpr (std::is_same<T, uint8_t>())
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512_ByteWord)
+                            if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
                             {
                                 __m512i _first, _second, _third, _forth, _max;
 
@@ -193,8 +238,8 @@ namespace tpa {
 #endif
                                     }//End for                                    
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 __m256i _first, _second, _third, _forth, _max;
 
@@ -206,10 +251,10 @@ namespace tpa {
                                     }//End if
 
                                     //Load Data
-                                    _first = _mm256_load_si256((__m256i*) & arr[i]);
-                                    _second = _mm256_load_si256((__m256i*) & arr[i + 32]);
-                                    _third = _mm256_load_si256((__m256i*) & arr[i + 64]);
-                                    _forth = _mm256_load_si256((__m256i*) & arr[i + 96]);
+                                    _first = _mm256_loadu_si256((__m256i*) & arr[i]);
+                                    _second = _mm256_loadu_si256((__m256i*) & arr[i + 32]);
+                                    _third = _mm256_loadu_si256((__m256i*) & arr[i + 64]);
+                                    _forth = _mm256_loadu_si256((__m256i*) & arr[i + 96]);
 
                                     //Compute max
                                     _max = _mm256_max_epu8(_first, _second);
@@ -226,7 +271,7 @@ namespace tpa {
 #endif
                                     }//End for                                    
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                         }//End if
 #pragma endregion
@@ -234,7 +279,7 @@ namespace tpa {
                         else if constexpr (std::is_same<T, int16_t>())
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512_ByteWord)
+                            if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
                             {
                                 __m512i _first, _second, _third, _forth, _max;
 
@@ -266,8 +311,8 @@ namespace tpa {
 #endif
                                     }//End for                                    
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 __m256i _first, _second, _third, _forth, _max;
 
@@ -279,10 +324,10 @@ namespace tpa {
                                     }//End if
 
                                     //Load Data
-                                    _first = _mm256_load_si256((__m256i*) & arr[i]);
-                                    _second = _mm256_load_si256((__m256i*) & arr[i + 16]);
-                                    _third = _mm256_load_si256((__m256i*) & arr[i + 32]);
-                                    _forth = _mm256_load_si256((__m256i*) & arr[i + 48]);
+                                    _first = _mm256_loadu_si256((__m256i*) & arr[i]);
+                                    _second = _mm256_loadu_si256((__m256i*) & arr[i + 16]);
+                                    _third = _mm256_loadu_si256((__m256i*) & arr[i + 32]);
+                                    _forth = _mm256_loadu_si256((__m256i*) & arr[i + 48]);
 
                                     //Compute max
                                     _max = _mm256_max_epi16(_first, _second);
@@ -299,7 +344,7 @@ namespace tpa {
 #endif
                                     }//End for                                    
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                         }//End if
 #pragma endregion
@@ -307,7 +352,7 @@ namespace tpa {
                         else if constexpr (std::is_same<T, uint16_t>())
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512_ByteWord)
+                            if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
                             {
                                 __m512i _first, _second, _third, _forth, _max;
 
@@ -339,8 +384,8 @@ namespace tpa {
 #endif
                                     }//End for                                    
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 __m256i _first, _second, _third, _forth, _max;
 
@@ -352,10 +397,10 @@ namespace tpa {
                                     }//End if
 
                                     //Load Data
-                                    _first = _mm256_load_si256((__m256i*) & arr[i]);
-                                    _second = _mm256_load_si256((__m256i*) & arr[i + 16]);
-                                    _third = _mm256_load_si256((__m256i*) & arr[i + 32]);
-                                    _forth = _mm256_load_si256((__m256i*) & arr[i + 48]);
+                                    _first = _mm256_loadu_si256((__m256i*) & arr[i]);
+                                    _second = _mm256_loadu_si256((__m256i*) & arr[i + 16]);
+                                    _third = _mm256_loadu_si256((__m256i*) & arr[i + 32]);
+                                    _forth = _mm256_loadu_si256((__m256i*) & arr[i + 48]);
 
                                     //Compute max
                                     _max = _mm256_max_epu16(_first, _second);
@@ -372,7 +417,7 @@ namespace tpa {
 #endif
                                     }//End for                                    
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                         }//End if
 #pragma endregion
@@ -380,7 +425,7 @@ namespace tpa {
                         else if constexpr (std::is_same<T, int32_t>())
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
                                 __m512i _first, _second, _third, _forth, _max;
 
@@ -392,10 +437,10 @@ namespace tpa {
                                     }//End if
 
                                     //Load Data
-                                    _first = _mm512_load_epi32((__m512i*)&arr[i]);
-                                    _second = _mm512_load_epi32((__m512i*)&arr[i + 16]);
-                                    _third = _mm512_load_epi32((__m512i*)&arr[i + 32]);
-                                    _forth = _mm512_load_epi32((__m512i*)&arr[i + 48]);
+                                    _first = _mm512_loadu_epi32((__m512i*)&arr[i]);
+                                    _second = _mm512_loadu_epi32((__m512i*)&arr[i + 16]);
+                                    _third = _mm512_loadu_epi32((__m512i*)&arr[i + 32]);
+                                    _forth = _mm512_loadu_epi32((__m512i*)&arr[i + 48]);
 
                                     //Compute max
                                     _max = _mm512_max_epi32(_first, _second);
@@ -412,8 +457,8 @@ namespace tpa {
 #endif
                                     }//End for                                    
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 __m256i _first, _second, _third, _forth, _max;
 
@@ -425,10 +470,10 @@ namespace tpa {
                                     }//End if
 
                                     //Load Data
-                                    _first = _mm256_load_si256((__m256i*) & arr[i]);
-                                    _second = _mm256_load_si256((__m256i*) & arr[i + 8]);
-                                    _third = _mm256_load_si256((__m256i*) & arr[i + 16]);
-                                    _forth = _mm256_load_si256((__m256i*) & arr[i + 24]);
+                                    _first = _mm256_loadu_si256((__m256i*) & arr[i]);
+                                    _second = _mm256_loadu_si256((__m256i*) & arr[i + 8]);
+                                    _third = _mm256_loadu_si256((__m256i*) & arr[i + 16]);
+                                    _forth = _mm256_loadu_si256((__m256i*) & arr[i + 24]);
 
                                     //Compute max
                                     _max = _mm256_max_epi32(_first, _second);
@@ -445,7 +490,7 @@ namespace tpa {
 #endif
                                     }//End for                                    
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                         }//End if
 #pragma endregion
@@ -453,7 +498,7 @@ namespace tpa {
                         else if constexpr (std::is_same<T, uint32_t>())
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
                                 __m512i _first, _second, _third, _forth, _max;
 
@@ -465,10 +510,10 @@ namespace tpa {
                                     }//End if
 
                                     //Load Data
-                                    _first = _mm512_load_epi32((__m512i*)&arr[i]);
-                                    _second = _mm512_load_epi32((__m512i*)&arr[i + 16]);
-                                    _third = _mm512_load_epi32((__m512i*)&arr[i + 32]);
-                                    _forth = _mm512_load_epi32((__m512i*)&arr[i + 48]);
+                                    _first = _mm512_loadu_epi32((__m512i*)&arr[i]);
+                                    _second = _mm512_loadu_epi32((__m512i*)&arr[i + 16]);
+                                    _third = _mm512_loadu_epi32((__m512i*)&arr[i + 32]);
+                                    _forth = _mm512_loadu_epi32((__m512i*)&arr[i + 48]);
 
                                     //Compute max
                                     _max = _mm512_max_epu32(_first, _second);
@@ -485,8 +530,8 @@ namespace tpa {
 #endif
                                     }//End for                                    
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 __m256i _first, _second, _third, _forth, _max;
 
@@ -498,10 +543,10 @@ namespace tpa {
                                     }//End if
 
                                     //Load Data
-                                    _first = _mm256_load_si256((__m256i*) & arr[i]);
-                                    _second = _mm256_load_si256((__m256i*) & arr[i + 8]);
-                                    _third = _mm256_load_si256((__m256i*) & arr[i + 16]);
-                                    _forth = _mm256_load_si256((__m256i*) & arr[i + 24]);
+                                    _first = _mm256_loadu_si256((__m256i*) & arr[i]);
+                                    _second = _mm256_loadu_si256((__m256i*) & arr[i + 8]);
+                                    _third = _mm256_loadu_si256((__m256i*) & arr[i + 16]);
+                                    _forth = _mm256_loadu_si256((__m256i*) & arr[i + 24]);
 
                                     //Compute max
                                     _max = _mm256_max_epu32(_first, _second);
@@ -518,7 +563,7 @@ namespace tpa {
 #endif
                                     }//End for                                    
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                         }//End if
 #pragma endregion
@@ -526,7 +571,7 @@ namespace tpa {
                         else if constexpr (std::is_same<T, int64_t>())
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
                                 __m512i _first, _second, _third, _forth, _max;
 
@@ -538,10 +583,10 @@ namespace tpa {
                                     }//End if
 
                                     //Load Data
-                                    _first = _mm512_load_epi64((__m512i*)&arr[i]);
-                                    _second = _mm512_load_epi64((__m512i*)&arr[i + 8]);
-                                    _third = _mm512_load_epi64((__m512i*)&arr[i + 16]);
-                                    _forth = _mm512_load_epi64((__m512i*)&arr[i + 24]);
+                                    _first = _mm512_loadu_epi64((__m512i*)&arr[i]);
+                                    _second = _mm512_loadu_epi64((__m512i*)&arr[i + 8]);
+                                    _third = _mm512_loadu_epi64((__m512i*)&arr[i + 16]);
+                                    _forth = _mm512_loadu_epi64((__m512i*)&arr[i + 24]);
 
                                     //Compute max
                                     _max = _mm512_max_epi64(_first, _second);
@@ -558,8 +603,8 @@ namespace tpa {
 #endif
                                     }//End for                                    
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 __m256i _first, _second, _third, _forth, _max;
 
@@ -571,10 +616,10 @@ namespace tpa {
                                     }//End if
 
                                     //Load Data
-                                    _first = _mm256_load_si256((__m256i*) & arr[i]);
-                                    _second = _mm256_load_si256((__m256i*) & arr[i + 4]);
-                                    _third = _mm256_load_si256((__m256i*) & arr[i + 8]);
-                                    _forth = _mm256_load_si256((__m256i*) & arr[i + 12]);
+                                    _first = _mm256_loadu_si256((__m256i*) & arr[i]);
+                                    _second = _mm256_loadu_si256((__m256i*) & arr[i + 4]);
+                                    _third = _mm256_loadu_si256((__m256i*) & arr[i + 8]);
+                                    _forth = _mm256_loadu_si256((__m256i*) & arr[i + 12]);
 
                                     //Compute max
                                     _max = _mm256_castpd_si256(_mm256_max_pd(_mm256_castsi256_pd(_first), _mm256_castsi256_pd(_second)));
@@ -591,7 +636,7 @@ namespace tpa {
 #endif
                                     }//End for                                    
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                         }//End if
 #pragma endregion
@@ -599,7 +644,7 @@ namespace tpa {
                         else if constexpr (std::is_same<T, uint64_t>())
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
                                 __m512i _first, _second, _third, _forth, _max;
 
@@ -611,10 +656,10 @@ namespace tpa {
                                     }//End if
 
                                     //Load Data
-                                    _first = _mm512_load_epi64((__m512i*)&arr[i]);
-                                    _second = _mm512_load_epi64((__m512i*)&arr[i + 8]);
-                                    _third = _mm512_load_epi64((__m512i*)&arr[i + 16]);
-                                    _forth = _mm512_load_epi64((__m512i*)&arr[i + 24]);
+                                    _first = _mm512_loadu_epi64((__m512i*)&arr[i]);
+                                    _second = _mm512_loadu_epi64((__m512i*)&arr[i + 8]);
+                                    _third = _mm512_loadu_epi64((__m512i*)&arr[i + 16]);
+                                    _forth = _mm512_loadu_epi64((__m512i*)&arr[i + 24]);
 
                                     //Compute max
                                     _max = _mm512_max_epu64(_first, _second);
@@ -631,8 +676,8 @@ namespace tpa {
 #endif
                                     }//End for                                    
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX2)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 __m256i _first, _second, _third, _forth, _max;
 
@@ -644,10 +689,10 @@ namespace tpa {
                                     }//End if
 
                                     //Load Data
-                                    _first = _mm256_load_si256((__m256i*) & arr[i]);
-                                    _second = _mm256_load_si256((__m256i*) & arr[i + 4]);
-                                    _third = _mm256_load_si256((__m256i*) & arr[i + 8]);
-                                    _forth = _mm256_load_si256((__m256i*) & arr[i + 12]);
+                                    _first = _mm256_loadu_si256((__m256i*) & arr[i]);
+                                    _second = _mm256_loadu_si256((__m256i*) & arr[i + 4]);
+                                    _third = _mm256_loadu_si256((__m256i*) & arr[i + 8]);
+                                    _forth = _mm256_loadu_si256((__m256i*) & arr[i + 12]);
 
                                     //Compute max
                                     _max = _mm256_castpd_si256(_mm256_max_pd(_mm256_castsi256_pd(_first), _mm256_castsi256_pd(_second)));
@@ -664,7 +709,7 @@ namespace tpa {
 #endif
                                     }//End for                                    
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                         }//End if
 #pragma endregion
@@ -672,7 +717,7 @@ namespace tpa {
                         else if constexpr (std::is_same<T, float>())
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
                                 __m512 _first, _second, _third, _forth, _max;
 
@@ -684,10 +729,10 @@ namespace tpa {
                                     }//End if
 
                                     //Load Data
-                                    _first = _mm512_load_ps(&arr[i]);
-                                    _second = _mm512_load_ps(&arr[i + 16]);
-                                    _third = _mm512_load_ps(&arr[i + 32]);
-                                    _forth = _mm512_load_ps(&arr[i + 48]);
+                                    _first = _mm512_loadu_ps(&arr[i]);
+                                    _second = _mm512_loadu_ps(&arr[i + 16]);
+                                    _third = _mm512_loadu_ps(&arr[i + 32]);
+                                    _forth = _mm512_loadu_ps(&arr[i + 48]);
 
                                     //Compute max
                                     _max = _mm512_max_ps(_first, _second);
@@ -704,8 +749,8 @@ namespace tpa {
 #endif
                                     }//End for                                    
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
                             {
                                 __m256 _first, _second, _third, _forth, _max;
 
@@ -717,10 +762,10 @@ namespace tpa {
                                     }//End if
 
                                     //Load Data
-                                    _first = _mm256_load_ps(&arr[i]);
-                                    _second = _mm256_load_ps(&arr[i + 8]);
-                                    _third = _mm256_load_ps(&arr[i + 16]);
-                                    _forth = _mm256_load_ps(&arr[i + 24]);
+                                    _first = _mm256_loadu_ps(&arr[i]);
+                                    _second = _mm256_loadu_ps(&arr[i + 8]);
+                                    _third = _mm256_loadu_ps(&arr[i + 16]);
+                                    _forth = _mm256_loadu_ps(&arr[i + 24]);
 
                                     //Compute max
                                     _max = _mm256_max_ps(_first, _second);
@@ -737,7 +782,7 @@ namespace tpa {
 #endif
                                     }//End for                                    
                                 }//End for
-                            }//End if hasAVX
+                            }();//End if hasAVX
 #endif
                         }//End if
 #pragma endregion
@@ -745,7 +790,7 @@ namespace tpa {
                         else if constexpr (std::is_same<T, double>())
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512)
+                            if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                             {
                                 __m512d _first, _second, _third, _forth, _max;
 
@@ -757,10 +802,10 @@ namespace tpa {
                                     }//End if
 
                                     //Load Data
-                                    _first = _mm512_load_pd(&arr[i]);
-                                    _second = _mm512_load_pd(&arr[i + 8]);
-                                    _third = _mm512_load_pd(&arr[i + 16]);
-                                    _forth = _mm512_load_pd(&arr[i + 24]);
+                                    _first = _mm512_loadu_pd(&arr[i]);
+                                    _second = _mm512_loadu_pd(&arr[i + 8]);
+                                    _third = _mm512_loadu_pd(&arr[i + 16]);
+                                    _forth = _mm512_loadu_pd(&arr[i + 24]);
 
                                     //Compute max
                                     _max = _mm512_max_pd(_first, _second);
@@ -777,8 +822,8 @@ namespace tpa {
 #endif
                                     }//End for                                    
                                 }//End for
-                            }//End if hasAVX512
-                            else if (tpa::hasAVX)
+                            }();//End if hasAVX512
+                            else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
                             {
                                 __m256d _first, _second, _third, _forth, _max;
 
@@ -790,10 +835,10 @@ namespace tpa {
                                     }//End if
 
                                     //Load Data
-                                    _first = _mm256_load_pd(&arr[i]);
-                                    _second = _mm256_load_pd(&arr[i + 4]);
-                                    _third = _mm256_load_pd(&arr[i + 8]);
-                                    _forth = _mm256_load_pd(&arr[i + 12]);
+                                    _first = _mm256_loadu_pd(&arr[i]);
+                                    _second = _mm256_loadu_pd(&arr[i + 4]);
+                                    _third = _mm256_loadu_pd(&arr[i + 8]);
+                                    _forth = _mm256_loadu_pd(&arr[i + 12]);
 
                                     //Compute max
                                     _max = _mm256_max_pd(_first, _second);
@@ -810,10 +855,21 @@ namespace tpa {
 #endif
                                     }//End for                                    
                                 }//End for
-                            }//End if hasAVX
+                            }();//End if hasAVX
 #endif
                         }//End if
 #pragma endregion
+#pragma region neon
+#ifdef TPA_NEON
+                        if constexpr (tpa::simd::is_vec_type<T>)
+                        {
+                            if (tpa::hasNeon)
+                            {
+                                tpa_max_element_private::max_neon<T>(i, end, arr.data(), temp_max);
+                            }//End if
+                        }//End if
+#endif
+#pragma endregion
 #pragma region generic      
                         for (; i != end; ++i)
                         {                           
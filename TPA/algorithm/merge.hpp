@@ -0,0 +1,454 @@
+#pragma once
+/*
+*	Truly Parallel Algorithms Library - Algorithm - merge and multiway_merge functions
+*	By: David Aaron Braun
+*	2022-08-22
+*/
+
+/*
+*           Copyright David Aaron Braun 2021 - .
+*   Distributed under the Boost Software License, Version 1.0.
+*       (See accompanying file LICENSE_1_0.txt or copy at
+*           https://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include <utility>
+#include <mutex>
+#include <future>
+#include <iostream>
+#include <algorithm>
+
+#include <vector>
+
+#include "../_util.hpp"
+#include "../ThreadPool.hpp"
+#include "../excepts.hpp"
+#include "../size_t_lit.hpp"
+#include "../tpa_macros.hpp"
+#include "../predicates.hpp"
+#include "../tpa_concepts.hpp"
+
+/// <summary>
+/// <para>Private Namespace for TPA merge and multiway_merge.</para>
+/// <para>The output is split into one equal part per thread and each thread finds where its part starts in every input with a binary search (merge path),
+/// so the work is shared equally however the values are spread between the inputs.</para>
+/// <para>Merges are stable: of equal elements those of an earlier input come first.</para>
+/// </summary>
+namespace tpa_merge_private
+{
+    /// <summary>
+    /// <para>Returns how many of the first 'diag' elements of the merge of 'a' and 'b' come from 'a'.</para>
+    /// </summary>
+    template<typename T>
+    [[nodiscard]] inline size_t merge_path(const T* a, const size_t na, const T* b, const size_t nb, const size_t diag) noexcept
+    {
+        size_t lo = (diag > nb) ? (diag - nb) : 0uz;
+        size_t hi = tpa::util::min(diag, na);
+
+        while (lo < hi)
+        {
+            const size_t mid = lo + ((hi - lo) / 2uz);
+
+            if (b[diag - 1uz - mid] < a[mid])
+            {
+                hi = mid;
+            }//End if
+            else
+            {
+                lo = mid + 1uz;
+            }//End else
+        }//End while
+
+        return lo;
+    }//End of merge_path
+
+    /// <summary>
+    /// <para>Merges [i, ea) of 'a' and [j, eb) of 'b' to 'out' without branching on the data, then copies whichever input is left.</para>
+    /// </summary>
+    template<typename T>
+    inline void merge_section(const T* a, size_t i, const size_t ea, const T* b, size_t j, const size_t eb, T* out) noexcept
+    {
+        while (i != ea && j != eb)
+        {
+            const bool take_b = b[j] < a[i];
+
+            *out++ = take_b ? b[j] : a[i];
+            j += static_cast<size_t>(take_b);
+            i += static_cast<size_t>(!take_b);
+        }//End while
+
+        out = std::copy(a + i, a + ea, out);
+        std::copy(b + j, b + eb, out);
+    }//End of merge_section
+
+    /// <summary>
+    /// <para>Merges 'a' and 'b' to 'out' in parallel, thread t writes [t * n / nThreads, (t + 1) * n / nThreads) of the output.</para>
+    /// </summary>
+    template<typename T>
+    inline void merge_threaded(const T* a, const size_t na, const T* b, const size_t nb, T* out)
+    {
+        uint32_t complete = 0;
+
+        const size_t n = na + nb;
+
+        std::vector<std::shared_future<uint32_t>> results;
+        results.reserve(tpa::nThreads);
+
+        for (size_t t = 0uz; t != tpa::nThreads; ++t)
+        {
+            //Launch lambda from multiple threads
+            results.emplace_back(tpa::tp->addTask([a, na, b, nb, out, n, t]()
+                {
+                    const size_t beg = (t * n) / tpa::nThreads;
+                    const size_t end = ((t + 1uz) * n) / tpa::nThreads;
+
+                    const size_t ia = tpa_merge_private::merge_path(a, na, b, nb, beg);
+                    const size_t ea = tpa_merge_private::merge_path(a, na, b, nb, end);
+
+                    tpa_merge_private::merge_section(a, ia, ea, b, beg - ia, end - ea, out + beg);
+
+                    return static_cast<uint32_t>(1);
+                }));//End of lambda
+        }//End for
+
+        for (const auto& fut : results)
+        {
+            complete += fut.get();
+        }//End for
+
+        //Check all threads completed
+        if (complete != tpa::nThreads)
+        {
+            throw tpa::exceptions::NotAllThreadsCompleted(complete);
+        }//End if
+    }//End of merge_threaded
+
+    /// <summary>
+    /// <para>Returns, for every input, how many of the first 'rank' elements of the merge of all 'lists' come from it.</para>
+    /// <para>Elements are ordered by value, then by input, then by position, which makes the split exact with duplicates.
+    /// The largest remaining range of any input is halved every step by ranking its middle element, so it takes O(k log n) steps.</para>
+    /// </summary>
+    template<typename T>
+    [[nodiscard]] inline std::vector<size_t> multiway_split(const std::vector<std::pair<const T*, size_t>>& lists, const size_t rank)
+    {
+        const size_t k = lists.size();
+
+        std::vector<size_t> lo(k, 0uz);
+        std::vector<size_t> hi(k);
+        std::vector<size_t> less(k);
+
+        size_t sum_lo = 0uz;
+        for (size_t l = 0uz; l != k; ++l)
+        {
+            hi[l] = lists[l].second;
+        }//End for
+
+        while (sum_lo != rank)
+        {
+            //The input with the most undecided elements
+            size_t p = 0uz;
+            for (size_t l = 1uz; l != k; ++l)
+            {
+                if ((hi[l] - lo[l]) > (hi[p] - lo[p]))
+                {
+                    p = l;
+                }//End if
+            }//End for
+
+            const size_t pos = lo[p] + ((hi[p] - lo[p]) / 2uz);
+            const T pivot = lists[p].first[pos];
+
+            //Count the elements which come before the pivot, within the undecided range of each input
+            size_t before = 0uz;
+            for (size_t l = 0uz; l != k; ++l)
+            {
+                const T* first = lists[l].first + lo[l];
+                const T* last = lists[l].first + hi[l];
+
+                if (l < p)
+                {
+                    less[l] = static_cast<size_t>(std::upper_bound(first, last, pivot) - lists[l].first);
+                }//End if
+                else if (l > p)
+                {
+                    less[l] = static_cast<size_t>(std::lower_bound(first, last, pivot) - lists[l].first);
+                }//End if
+                else
+                {
+                    less[l] = pos;
+                }//End else
+
+                before += less[l];
+            }//End for
+
+            if (before < rank)
+            {
+                //The pivot and everything before it are in
+                sum_lo = 0uz;
+                for (size_t l = 0uz; l != k; ++l)
+                {
+                    lo[l] = (l == p) ? (pos + 1uz) : less[l];
+                    sum_lo += lo[l];
+                }//End for
+            }//End if
+            else
+            {
+                //The pivot and everything after it are out
+                for (size_t l = 0uz; l != k; ++l)
+                {
+                    hi[l] = less[l];
+                }//End for
+
+                if (before == rank)
+                {
+                    return hi;
+                }//End if
+            }//End else
+        }//End while
+
+        return lo;
+    }//End of multiway_split
+
+    /// <summary>
+    /// <para>Merges [beg[l], end[l]) of every input to 'out', with a heap of the heads of the inputs, ties go to the earlier input.</para>
+    /// </summary>
+    template<typename T>
+    inline void multiway_section(const std::vector<std::pair<const T*, size_t>>& lists, std::vector<size_t> beg, const std::vector<size_t>& end, T* out)
+    {
+        std::vector<size_t> live;
+        live.reserve(lists.size());
+
+        for (size_t l = 0uz; l != lists.size(); ++l)
+        {
+            if (beg[l] != end[l])
+            {
+                live.push_back(l);
+            }//End if
+        }//End for
+
+        if (live.empty())
+        {
+            return;
+        }//End if
+        else if (live.size() == 1uz)
+        {
+            const size_t l = live[0];
+            std::copy(lists[l].first + beg[l], lists[l].first + end[l], out);
+            return;
+        }//End if
+        else if (live.size() == 2uz)
+        {
+            const size_t l = live[0];
+            const size_t m = live[1];
+            tpa_merge_private::merge_section(lists[l].first, beg[l], end[l], lists[m].first, beg[m], end[m], out);
+            return;
+        }//End if
+
+        //Max-heap on "comes later", so the front is the next element
+        const auto later = [&lists, &beg](const size_t x, const size_t y)
+        {
+            const T vx = lists[x].first[beg[x]];
+            const T vy = lists[y].first[beg[y]];
+
+            return (vy < vx) || (!(vx < vy) && y < x);
+        };//End of lambda
+
+        std::make_heap(live.begin(), live.end(), later);
+
+        while (live.size() > 2uz)
+        {
+            std::pop_heap(live.begin(), live.end(), later);
+            const size_t l = live.back();
+
+            *out++ = lists[l].first[beg[l]++];
+
+            if (beg[l] == end[l])
+            {
+                live.pop_back();
+            }//End if
+            else
+            {
+                std::push_heap(live.begin(), live.end(), later);
+            }//End else
+        }//End while
+
+        //The last two merge without the heap
+        const size_t l = tpa::util::min(live[0], live[1]);
+        const size_t m = tpa::util::max(live[0], live[1]);
+        tpa_merge_private::merge_section(lists[l].first, beg[l], end[l], lists[m].first, beg[m], end[m], out);
+    }//End of multiway_section
+
+    /// <summary>
+    /// <para>Merges every input of 'lists' to 'out' in parallel, thread t writes [t * n / nThreads, (t + 1) * n / nThreads) of the output.</para>
+    /// </summary>
+    template<typename T>
+    inline void multiway_threaded(const std::vector<std::pair<const T*, size_t>>& lists, const size_t n, T* out)
+    {
+        uint32_t complete = 0;
+
+        std::vector<std::shared_future<uint32_t>> results;
+        results.reserve(tpa::nThreads);
+
+        for (size_t t = 0uz; t != tpa::nThreads; ++t)
+        {
+            //Launch lambda from multiple threads
+            results.emplace_back(tpa::tp->addTask([&lists, out, n, t]()
+                {
+                    const size_t beg = (t * n) / tpa::nThreads;
+                    const size_t end = ((t + 1uz) * n) / tpa::nThreads;
+
+                    tpa_merge_private::multiway_section(lists,
+                        tpa_merge_private::multiway_split(lists, beg),
+                        tpa_merge_private::multiway_split(lists, end),
+                        out + beg);
+
+                    return static_cast<uint32_t>(1);
+                }));//End of lambda
+        }//End for
+
+        for (const auto& fut : results)
+        {
+            complete += fut.get();
+        }//End for
+
+        //Check all threads completed
+        if (complete != tpa::nThreads)
+        {
+            throw tpa::exceptions::NotAllThreadsCompleted(complete);
+        }//End if
+    }//End of multiway_threaded
+}//End of namespace
+
+/// <summary>
+/// <para>Truly Parallel Algorithms</para>
+/// <para>By David Aaron Braun</para>
+/// <para>Version 0.1</para>
+/// </summary>
+namespace tpa {
+#pragma region generic
+
+	/// <summary>
+	/// <para>Merges the sorted containers 'a' and 'b' into the front of 'out', which is then sorted (as std::merge).</para>
+	/// <para>The merge is stable, of equal elements those of 'a' come first.</para>
+	/// <para>This parallel implementation uses Multi-Threading, every thread writes an equal share of the output, found with a binary search along its merge path,
+	/// and merges it without branching on the data.</para>
+	/// <para>If 'out' is smaller than 'a' and 'b' together, will throw an exception and leave it unchanged.</para>
+	/// </summary>
+	/// <typeparam name="CONTAINER_A"></typeparam>
+	/// <typeparam name="CONTAINER_B"></typeparam>
+	/// <typeparam name="CONTAINER_OUT"></typeparam>
+	/// <typeparam name="T"></typeparam>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <param name="out"></param>
+	template<class CONTAINER_A, class CONTAINER_B, class CONTAINER_OUT, typename T = CONTAINER_A::value_type>
+	inline void merge(const CONTAINER_A& a, const CONTAINER_B& b, CONTAINER_OUT& out)
+	requires tpa::util::contiguous_seqeunce<CONTAINER_A> && tpa::util::contiguous_seqeunce<CONTAINER_B> && tpa::util::contiguous_seqeunce<CONTAINER_OUT> && std::is_arithmetic<T>::value
+	{
+        try
+        {
+            static_assert(std::is_same<T, typename CONTAINER_B::value_type>() == true && std::is_same<T, typename CONTAINER_OUT::value_type>() == true,
+                "Compile Error! The containers must be of the same value type!");
+
+            if (out.size() < (a.size() + b.size()))
+            {
+                throw tpa::exceptions::ArrayTooSmall();
+            }//End if
+
+            if ((a.size() + b.size()) == 0uz)
+            {
+                return;
+            }//End if
+
+            tpa_merge_private::merge_threaded(a.data(), a.size(), b.data(), b.size(), out.data());
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::merge(): " << ex.code()
+                << " " << ex.what() << "\n";
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::merge(): " << ex.what() << "\n";
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::merge(): " << ex.what() << "\n";
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::merge(): unknown!\n";
+        }//End catch
+	}//End of merge
+
+	/// <summary>
+	/// <para>Merges every sorted container in 'lists' (e.g. a std::vector of std::span) into the front of 'out', which is then sorted.</para>
+	/// <para>The merge is stable, of equal elements those of an earlier container come first.</para>
+	/// <para>This parallel implementation uses Multi-Threading, every thread writes an equal share of the output, found by a multi-sequence selection over all the inputs,
+	/// and merges its part of the inputs with a heap of their heads.</para>
+	/// <para>If 'out' is smaller than all the inputs together, will throw an exception and leave it unchanged.</para>
+	/// </summary>
+	/// <typeparam name="LISTS_T"></typeparam>
+	/// <typeparam name="CONTAINER_OUT"></typeparam>
+	/// <typeparam name="T"></typeparam>
+	/// <param name="lists"></param>
+	/// <param name="out"></param>
+	template<class LISTS_T, class CONTAINER_OUT, typename T = CONTAINER_OUT::value_type>
+	inline void multiway_merge(const LISTS_T& lists, CONTAINER_OUT& out)
+	requires tpa::util::contiguous_seqeunce<typename LISTS_T::value_type> && tpa::util::contiguous_seqeunce<CONTAINER_OUT> && std::is_arithmetic<T>::value
+	{
+        try
+        {
+            static_assert(std::is_same<T, std::remove_cv_t<typename LISTS_T::value_type::value_type>>() == true, "Compile Error! The inputs and the output must be of the same value type!");
+
+            std::vector<std::pair<const T*, size_t>> inputs;
+            inputs.reserve(lists.size());
+
+            size_t n = 0uz;
+            for (const auto& list : lists)
+            {
+                inputs.emplace_back(list.data(), list.size());
+                n += list.size();
+            }//End for
+
+            if (out.size() < n)
+            {
+                throw tpa::exceptions::ArrayTooSmall();
+            }//End if
+
+            if (n == 0uz)
+            {
+                return;
+            }//End if
+
+            tpa_merge_private::multiway_threaded(inputs, n, out.data());
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::multiway_merge(): " << ex.code()
+                << " " << ex.what() << "\n";
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::multiway_merge(): " << ex.what() << "\n";
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::multiway_merge(): " << ex.what() << "\n";
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::multiway_merge(): unknown!\n";
+        }//End catch
+	}//End of multiway_merge
+#pragma endregion
+}//End of namespace
@@ -31,6 +31,121 @@
 #include "../tpa_concepts.hpp"
 #include "../InstructionSet.hpp"
 #include "../simd/simd.hpp"
+#include "../simd/vec.hpp"
+#include "../simd/dispatch.hpp"
+
+/// <summary>
+/// <para>Private Namespace for the TPA minmax_element kernels.</para>
+/// <para>Each kernel folds [beg, end) into 'lo' and 'hi' in a single pass, keeping vector min and max accumulators side by side.</para>
+/// </summary>
+namespace tpa_minmax_element_private
+{
+    /// <summary>
+    /// <para>Folds [i, end) into 'lo' and 'hi' with tpa::simd::vec&lt;T, W&gt;, 'i' is advanced past the elements processed.</para>
+    /// <para>tpa::simd::unroll independent pairs of accumulators hide the latency of the min and max instructions.</para>
+    /// </summary>
+    template<size_t W, typename T>
+    TPA_FORCE_INLINE void minmax_block(size_t& i, const size_t end, const T* arr, T& lo, T& hi) noexcept
+    {
+        using V = tpa::simd::vec<T, W>;
+        constexpr size_t step = W * tpa::simd::unroll;
+
+        if ((i + step) > end)
+        {
+            return;
+        }//End if
+
+        std::array<V, tpa::simd::unroll> _min;
+        std::array<V, tpa::simd::unroll> _max;
+        _min.fill(V(lo));
+        _max.fill(V(hi));
+
+        for (; (i + step) <= end; i += step)
+        {
+            tpa::simd::prefetch<step * sizeof(T)>(arr + i);
+
+            for (size_t u = 0uz; u < tpa::simd::unroll; ++u)
+            {
+                const V _val = V::load(arr + i + (W * u));
+
+                _min[u] = tpa::simd::min(_min[u], _val);
+                _max[u] = tpa::simd::max(_max[u], _val);
+            }//End for
+        }//End for
+
+        for (size_t u = 1uz; u < tpa::simd::unroll; ++u)
+        {
+            _min[0] = tpa::simd::min(_min[0], _min[u]);
+            _max[0] = tpa::simd::max(_max[0], _max[u]);
+        }//End for
+
+        lo = tpa::simd::reduce_min(_min[0]);
+        hi = tpa::simd::reduce_max(_max[0]);
+    }//End of minmax_block
+
+    /// <summary>
+    /// <para>Folds the elements [i, end) into 'lo' and 'hi' one at a time, also used to finish the leftovers of the SIMD kernels.</para>
+    /// </summary>
+    template<typename T>
+    inline void minmax_scalar(size_t i, const size_t end, const T* arr, T& lo, T& hi) noexcept
+    {
+        for (; i != end; ++i)
+        {
+            lo = tpa::util::min(lo, arr[i]);
+            hi = tpa::util::max(hi, arr[i]);
+        }//End for
+    }//End of minmax_scalar
+
+#ifdef TPA_X86_64
+    template<typename T>
+    TPA_TARGET_SSE41 inline void minmax_sse41(size_t i, const size_t end, const T* arr, T& lo, T& hi) noexcept
+    {
+        tpa_minmax_element_private::minmax_block<16uz / sizeof(T)>(i, end, arr, lo, hi);
+        tpa_minmax_element_private::minmax_scalar(i, end, arr, lo, hi);
+    }//End of minmax_sse41
+
+    template<typename T>
+    TPA_TARGET_AVX2 inline void minmax_avx2(size_t i, const size_t end, const T* arr, T& lo, T& hi) noexcept
+    {
+        tpa_minmax_element_private::minmax_block<32uz / sizeof(T)>(i, end, arr, lo, hi);
+        tpa_minmax_element_private::minmax_scalar(i, end, arr, lo, hi);
+    }//End of minmax_avx2
+
+    template<typename T>
+    TPA_TARGET_AVX512 inline void minmax_avx512(size_t i, const size_t end, const T* arr, T& lo, T& hi) noexcept
+    {
+        tpa_minmax_element_private::minmax_block<64uz / sizeof(T)>(i, end, arr, lo, hi);
+        tpa_minmax_element_private::minmax_scalar(i, end, arr, lo, hi);
+    }//End of minmax_avx512
+#elif defined(TPA_NEON)
+    template<typename T>
+    inline void minmax_neon(size_t i, const size_t end, const T* arr, T& lo, T& hi) noexcept
+    {
+        tpa_minmax_element_private::minmax_block<16uz / sizeof(T)>(i, end, arr, lo, hi);
+        tpa_minmax_element_private::minmax_scalar(i, end, arr, lo, hi);
+    }//End of minmax_neon
+#endif
+
+    /// <summary>
+    /// <para>Returns the minmax kernels for T.</para>
+    /// </summary>
+    template<typename T>
+    [[nodiscard]] inline auto minmax_kernels() noexcept
+    {
+        tpa::simd::kernel_table<void(size_t, const size_t, const T*, T&, T&)> table;
+        table.scalar = &tpa_minmax_element_private::minmax_scalar<T>;
+
+#ifdef TPA_X86_64
+        table.sse41 = &tpa_minmax_element_private::minmax_sse41<T>;
+        table.avx2 = &tpa_minmax_element_private::minmax_avx2<T>;
+        table.avx512 = &tpa_minmax_element_private::minmax_avx512<T>;
+#elif defined(TPA_NEON)
+        table.neon = &tpa_minmax_element_private::minmax_neon<T>;
+#endif
+
+        return table;
+    }//End of minmax_kernels
+}//End of namespace
 
 /// <summary>
 /// <para>Truly Parallel Algorithms</para>
@@ -42,7 +157,7 @@ namespace tpa {
 
 	/// <summary>
 	/// <para>Returns an std::pair of the smallest and largest elements of a container.</para>
-	/// <para>This parallel implentation uses Multi-Threading and SIMD.</para>
+	/// <para>This parallel implentation uses Multi-Threading and SIMD, the smallest and largest elements are found in a single pass.</para>
 	/// <para>The return type is the value_type of the container.</para>
     /// <para>If passing an container containing no elements, will throw an exception and return 0.</para>
 	/// </summary>
@@ -54,13 +169,109 @@ namespace tpa {
 	inline constexpr std::pair<T,T> minmax_element(const CONTAINER_T& arr) 
 	requires tpa::util::contiguous_seqeunce<CONTAINER_T>
 	{
-		return {tpa::min_element(arr), tpa::max_element(arr)};
+        try
+        {
+            uint32_t complete = 0;
+
+            //Guard against zero-element arrays
+            if (arr.size() == 0)
+            {
+                throw tpa::exceptions::EmptyArray();
+            }//End if
+
+            std::pair<T, T> res = { arr[0], arr[0] };
+
+            std::vector<std::pair<size_t, size_t>> sections;
+            tpa::util::prepareThreading(sections, arr.size());
+
+            std::vector<std::shared_future<std::pair<T, T>>> results;
+            results.reserve(tpa::nThreads);
+
+            std::shared_future<std::pair<T, T>> temp;
+
+            for (const auto& sec : sections)
+            {
+                temp = tpa::tp->addTask([&arr, &sec]()
+                    {
+                        const size_t beg = sec.first;
+                        const size_t end = sec.second;
+
+                        T temp_min = arr[beg];
+                        T temp_max = arr[beg];
+#pragma region simd
+                        if constexpr (tpa::simd::is_vec_type<T>)
+                        {
+                            //Built on first use, not per call
+                            static const auto kernels = tpa_minmax_element_private::minmax_kernels<T>();
+
+                            kernels.resolve_for((end - beg) * sizeof(T))(beg, end, arr.data(), temp_min, temp_max);
+                        }//End if
+#pragma endregion
+#pragma region generic
+                        else
+                        {
+                            for (size_t i = beg; i != end; ++i)
+                            {
+                                temp_min = tpa::util::min(temp_min, arr[i]);
+                                temp_max = tpa::util::max(temp_max, arr[i]);
+                            }//End for
+                        }//End else
+#pragma endregion
+                        return std::pair<T, T>(temp_min, temp_max);
+                    });//End of lambda
+
+                results.emplace_back(std::move(temp));
+            }//End for
+
+            for (const auto& fut : results)
+            {
+                const std::pair<T, T>& part = fut.get();
+
+                res.first = tpa::util::min(res.first, part.first);
+                res.second = tpa::util::max(res.second, part.second);
+                complete += 1;
+            }//End for
+
+            //Check all threads completed
+            if (complete != tpa::nThreads)
+            {
+                throw tpa::exceptions::NotAllThreadsCompleted(complete);
+            }//End if
+
+            //Finish
+            return res;
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::minmax_element(): " << ex.code()
+                << " " << ex.what() << "\n";
+            return { static_cast<T>(0), static_cast<T>(0) };
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::minmax_element(): " << ex.what() << "\n";
+            return { static_cast<T>(0), static_cast<T>(0) };
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::minmax_element(): " << ex.what() << "\n";
+            return { static_cast<T>(0), static_cast<T>(0) };
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::minmax_element(): unknown!\n";
+            return { static_cast<T>(0), static_cast<T>(0) };
+        }//End catch
 	}//End of minmax_element
 
 	/// <summary>
 	/// <para>Returns an std::pair of the smallest and largest elements of a container.</para>
 	/// <para>Requires 2 predicate functions 1 for min and 1 for max.</para>
-	/// <para>This parallel implementation uses Multi-Threading only.</para>
+	/// <para>This parallel implementation uses Multi-Threading only, both predicates are applied in a single pass.</para>
 	/// <para>The return type is the value_type of the container.</para>
 	/// <para>If passing an container containing no elements, will throw an exception and return 0.</para>
 	/// <para>IMPORTANT: This implementation is intended to be used with non-numeric custom classes, if your container's value_type is numeric, use the implementation without a predicate for a performance increase!</para>
@@ -75,7 +286,106 @@ namespace tpa {
 	inline constexpr std::pair<T,T> minmax_element(const CONTAINER_T& arr, const PRED min_p, const PRED2 max_p)
 	requires tpa::util::contiguous_seqeunce<CONTAINER_T>
 	{
-		return { tpa::min_element(arr, min_p), tpa::max_element(arr, max_p) };
+        try
+        {
+            uint32_t complete = 0;
+
+            //Guard against zero-element arrays
+            if (arr.size() == 0)
+            {
+                throw tpa::exceptions::EmptyArray();
+            }//End if
+
+            std::pair<T, T> res = { arr[0], arr[0] };
+
+            std::vector<std::pair<size_t, size_t>> sections;
+            tpa::util::prepareThreading(sections, arr.size());
+
+            std::vector<std::shared_future<std::pair<T, T>>> results;
+            results.reserve(tpa::nThreads);
+
+            std::shared_future<std::pair<T, T>> temp;
+
+            for (const auto& sec : sections)
+            {
+                temp = tpa::tp->addTask([&arr, &min_p, &max_p, &sec]()
+                    {
+                        const size_t beg = sec.first;
+                        const size_t end = sec.second;
+
+                        T temp_min = arr[beg];
+                        T temp_max = arr[beg];
+#pragma region generic
+                        for (size_t i = beg; i != end; ++i)
+                        {
+                            if (min_p(temp_min, arr[i]))
+                            {
+                                temp_min = arr[i];
+                            }//End if
+
+                            if (max_p(temp_max, arr[i]))
+                            {
+                                temp_max = arr[i];
+                            }//End if
+                        }//End for
+#pragma endregion
+                        return std::pair<T, T>(temp_min, temp_max);
+                    });//End of lambda
+
+                results.emplace_back(std::move(temp));
+            }//End for
+
+            for (const auto& fut : results)
+            {
+                const std::pair<T, T>& part = fut.get();
+
+                if (min_p(res.first, part.first))
+                {
+                    res.first = part.first;
+                }//End if
+
+                if (max_p(res.second, part.second))
+                {
+                    res.second = part.second;
+                }//End if
+
+                complete += 1;
+            }//End for
+
+            //Check all threads completed
+            if (complete != tpa::nThreads)
+            {
+                throw tpa::exceptions::NotAllThreadsCompleted(complete);
+            }//End if
+
+            //Finish
+            return res;
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::minmax_element(): " << ex.code()
+                << " " << ex.what() << "\n";
+            return { static_cast<T>(0), static_cast<T>(0) };
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::minmax_element(): " << ex.what() << "\n";
+            return { static_cast<T>(0), static_cast<T>(0) };
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::minmax_element(): " << ex.what() << "\n";
+            return { static_cast<T>(0), static_cast<T>(0) };
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::minmax_element(): unknown!\n";
+            return { static_cast<T>(0), static_cast<T>(0) };
+        }//End catch
 	}//End of minmax_element
 #pragma endregion
 }//End of namespace
@@ -0,0 +1,411 @@
+#pragma once
+/*
+*	Truly Parallel Algorithms Library - Algorithm - nth_element and partial_sort functions
+*	By: David Aaron Braun
+*	2022-08-21
+*/
+
+/*
+*           Copyright David Aaron Braun 2021 - .
+*   Distributed under the Boost Software License, Version 1.0.
+*       (See accompanying file LICENSE_1_0.txt or copy at
+*           https://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include <utility>
+#include <mutex>
+#include <future>
+#include <iostream>
+#include <algorithm>
+#include <random>
+
+#include <vector>
+
+#include "../_util.hpp"
+#include "../ThreadPool.hpp"
+#include "../excepts.hpp"
+#include "../size_t_lit.hpp"
+#include "../tpa_macros.hpp"
+#include "../predicates.hpp"
+#include "../tpa_concepts.hpp"
+#include "../InstructionSet.hpp"
+#include "../buffer.hpp"
+#include "../simd/vec.hpp"
+#include "../simd/dispatch.hpp"
+
+#include "sort.hpp"
+#include "copy_if.hpp"
+
+/// <summary>
+/// <para>Private Namespace for TPA nth_element and partial_sort.</para>
+/// <para>Selection runs on integers, floating-point numbers are selected as their radix keys (the order of tpa::sort) and mapped back.</para>
+/// </summary>
+namespace tpa_nth_element_private
+{
+    /// <summary>
+    /// <para>Above this many elements the selection narrows the range with parallel partition passes before the quickselect.</para>
+    /// </summary>
+    inline constexpr size_t threaded_limit = 1uz << 20;
+
+    /// <summary>
+    /// <para>The number of elements sampled to choose the pivots of a parallel pass.</para>
+    /// </summary>
+    inline constexpr size_t sample_size = 4096uz;
+
+    /// <summary>
+    /// <para>Quickselect of the integers 'arr' with the W lane partitions of the quicksort, only the part holding 'nth' is partitioned further.</para>
+    /// <para>Falls back to std::nth_element once 'depth' runs out.</para>
+    /// </summary>
+    template<size_t W, typename T>
+    TPA_FORCE_INLINE void select_block(T* arr, size_t n, size_t nth, size_t depth) noexcept
+    {
+        while (n > tpa_sort_private::network_size)
+        {
+            if (depth-- == 0uz)
+            {
+                std::nth_element(arr, arr + nth, arr + n);
+                return;
+            }//End if
+
+            const T pivot = tpa_sort_private::choose_pivot(arr, n);
+            size_t k = tpa_sort_private::partition_block<W, false>(arr, n, pivot);
+
+            if (k == 0uz)
+            {
+                //The pivot is the smallest element, split off everything equal to it
+                k = tpa_sort_private::partition_block<W, true>(arr, n, pivot);
+
+                if (nth < k)
+                {
+                    return;
+                }//End if
+
+                arr += k;
+                n -= k;
+                nth -= k;
+            }//End if
+            else if (nth < k)
+            {
+                n = k;
+            }//End if
+            else
+            {
+                arr += k;
+                n -= k;
+                nth -= k;
+            }//End else
+        }//End while
+
+        tpa_sort_private::network_sort(arr, n);
+    }//End of select_block
+
+    template<typename T>
+    inline void select_scalar(T* arr, const size_t n, const size_t nth) noexcept
+    {
+        tpa_nth_element_private::select_block<1uz>(arr, n, nth, tpa_sort_private::depth_limit(n));
+    }//End of select_scalar
+
+#ifdef TPA_X86_64
+    template<typename T>
+    TPA_TARGET_AVX2 inline void select_avx2(T* arr, const size_t n, const size_t nth) noexcept
+    {
+        tpa_nth_element_private::select_block<32uz / sizeof(T)>(arr, n, nth, tpa_sort_private::depth_limit(n));
+    }//End of select_avx2
+
+    template<typename T>
+    TPA_TARGET_AVX512 inline void select_avx512(T* arr, const size_t n, const size_t nth) noexcept
+    {
+        tpa_nth_element_private::select_block<64uz / sizeof(T)>(arr, n, nth, tpa_sort_private::depth_limit(n));
+    }//End of select_avx512
+#endif
+
+    /// <summary>
+    /// <para>Returns the quickselect kernels for the integer type T, registered as the quicksort kernels are.</para>
+    /// </summary>
+    template<typename T>
+    [[nodiscard]] inline auto select_kernels() noexcept
+    {
+        tpa::simd::kernel_table<void(T*, const size_t, const size_t)> table;
+        table.scalar = &tpa_nth_element_private::select_scalar<T>;
+#ifdef TPA_X86_64
+        if constexpr (sizeof(T) >= 4uz)
+        {
+            table.avx2 = &tpa_nth_element_private::select_avx2<T>;
+            table.avx512 = &tpa_nth_element_private::select_avx512<T>;
+        }//End if
+        else
+        {
+            if (tpa::hasAVX512_VBMI2)
+            {
+                table.avx512 = &tpa_nth_element_private::select_avx512<T>;
+            }//End if
+        }//End else
+#endif
+        return table;
+    }//End of select_kernels
+
+    /// <summary>
+    /// <para>Returns two pivots from a sorted random sample of 'arr' which bracket rank 'nth' with a margin, so that with high probability
+    /// the element of rank 'nth' lies between them and only a small fraction of the elements do.</para>
+    /// </summary>
+    template<typename T>
+    [[nodiscard]] inline std::pair<T, T> sample_pivots(const T* arr, const size_t n, const size_t nth)
+    {
+        constexpr size_t margin = 128uz;
+
+        //Fixed seed, the result of a selection does not depend on the pivots, only its speed does
+        std::minstd_rand gen(static_cast<uint32_t>(n));
+        std::uniform_int_distribution<size_t> pick(0uz, n - 1uz);
+
+        std::vector<T> sample(sample_size);
+        for (auto& s : sample)
+        {
+            s = arr[pick(gen)];
+        }//End for
+
+        std::sort(sample.begin(), sample.end());
+
+        const size_t r = static_cast<size_t>((static_cast<double>(nth) / static_cast<double>(n)) * static_cast<double>(sample_size));
+
+        return std::pair<T, T>(sample[(r > margin) ? (r - margin) : 0uz], sample[tpa::util::min(r + margin, sample_size - 1uz)]);
+    }//End of sample_pivots
+
+    /// <summary>
+    /// <para>Partitions [0, count) of 'src' into 'dst' with the compaction engine of copy_if, the elements matching 'filter' first, both parts in their original order.</para>
+    /// <para>Returns the number of matching elements.</para>
+    /// </summary>
+    template<typename T, typename FILTER>
+    [[nodiscard]] inline size_t partition_pass(const size_t count, const T* src, T* dst, const FILTER& filter)
+    {
+        size_t total = 0uz;
+
+        return tpa_copy_if_private::compact_threaded(count,
+            [src, &filter](const size_t beg, const size_t end) { return tpa_copy_if_private::count_section<true>(beg, end, src, filter); },
+            [&total](const size_t n) { total = n; },
+            [src, dst, &total, &filter](const size_t beg, const size_t end, const size_t offset)
+            {
+                tpa_copy_if_private::compact_section<true>(beg, end, src, dst + offset, filter);
+                tpa_copy_if_private::compact_section<false>(beg, end, src, dst + total + (beg - offset), filter);
+            });
+    }//End of partition_pass
+
+    /// <summary>
+    /// <para>Selection of the integers 'arr' so that arr[nth] holds the element of rank 'nth', nothing before it is greater and nothing after it is less.</para>
+    /// <para>Large ranges are split in three (less than p1, p1 to p2, greater than p2) by two parallel partition passes through a scratch buffer,
+    /// with p1 and p2 sampled around rank 'nth', until the part holding 'nth' is small enough for the quickselect.</para>
+    /// </summary>
+    template<typename T>
+    inline void select(T* arr, const size_t n, const size_t nth)
+    {
+        size_t lo = 0uz;
+        size_t hi = n;
+
+        if (n > threaded_limit)
+        {
+            std::vector<std::pair<size_t, size_t>> sections;
+            tpa::buffer<T> tmp(n);
+
+            while ((hi - lo) > threaded_limit)
+            {
+                const size_t len = hi - lo;
+                const auto [p1, p2] = tpa_nth_element_private::sample_pivots(arr + lo, len, nth - lo);
+
+                const tpa_copy_if_private::cond_filter<tpa::cond::LESS_THAN, T, T> less(p1, true);
+                const tpa_copy_if_private::cond_filter<tpa::cond::LESS_THAN_OR_EQUAL_TO, T, T> upto(p2, true);
+
+                //[lo, lo + nl) < p1 in tmp, the rest is split by <= p2 straight back into arr
+                const size_t nl = tpa_nth_element_private::partition_pass(len, arr + lo, tmp.data() + lo, less);
+                const size_t nm = tpa_nth_element_private::partition_pass(len - nl, tmp.data() + lo + nl, arr + lo + nl, upto);
+
+                if (nl != 0uz)
+                {
+                    tpa::util::prepareThreading(sections, nl);
+                    tpa_sort_private::for_sections(sections, [&](const size_t, const size_t beg, const size_t end)
+                        {
+                            std::copy(tmp.data() + lo + beg, tmp.data() + lo + end, arr + lo + beg);
+                        });
+                }//End if
+
+                if (nth < (lo + nl))
+                {
+                    hi = lo + nl;
+                }//End if
+                else if (nth < (lo + nl + nm))
+                {
+                    //Every element of the middle part is equal
+                    if (p1 == p2)
+                    {
+                        return;
+                    }//End if
+
+                    lo += nl;
+                    hi = lo + nm;
+                }//End if
+                else
+                {
+                    lo += nl + nm;
+                }//End else
+
+                //The sample missed, the quickselect copes with whatever is left
+                if ((hi - lo) == len)
+                {
+                    break;
+                }//End if
+            }//End while
+        }//End if
+
+        //Built on first use, not per call
+        static const auto kernels = tpa_nth_element_private::select_kernels<T>();
+
+        kernels.resolve_for((hi - lo) * sizeof(T))(arr + lo, hi - lo, nth - lo);
+    }//End of select
+
+    /// <summary>
+    /// <para>Calls fn(keys, n) on 'arr' itself for integers, for floating-point numbers on their radix keys which are mapped back afterwards.</para>
+    /// </summary>
+    template<typename T, typename FUNC>
+    inline void on_keys(T* arr, const size_t n, const FUNC& fn)
+    {
+        if constexpr (std::is_floating_point<T>::value)
+        {
+            using U = tpa_sort_private::radix_key<T>;
+
+            tpa::buffer<U> keys(n);
+
+            std::vector<std::pair<size_t, size_t>> sections;
+            tpa::util::prepareThreading(sections, n);
+
+            tpa_sort_private::for_sections(sections, [&](const size_t, const size_t beg, const size_t end)
+                {
+                    std::transform(arr + beg, arr + end, keys.data() + beg, [](const T x) { return tpa_sort_private::to_key(x); });
+                });
+
+            fn(keys.data(), n);
+
+            tpa_sort_private::for_sections(sections, [&](const size_t, const size_t beg, const size_t end)
+                {
+                    std::transform(keys.data() + beg, keys.data() + end, arr + beg, [](const U k) { return tpa_sort_private::from_key<T>(k); });
+                });
+        }//End if
+        else
+        {
+            fn(arr, n);
+        }//End else
+    }//End of on_keys
+}//End of namespace
+
+/// <summary>
+/// <para>Truly Parallel Algorithms</para>
+/// <para>By David Aaron Braun</para>
+/// <para>Version 0.1</para>
+/// </summary>
+namespace tpa {
+#pragma region generic
+
+	/// <summary>
+	/// <para>Rearranges the container so that arr[nth] is the element which would be there if the container were sorted,
+	/// no element before it is greater and no element after it is less (as std::nth_element).</para>
+	/// <para>This parallel implementation narrows large containers with Multi-Threaded SIMD partition passes around sampled pivots, then finishes with a SIMD quickselect.</para>
+	/// <para>Floating-point numbers are ordered as by tpa::sort: -0.0 before +0.0 and NaNs at the ends.</para>
+	/// <para>Large containers use a scratch buffer as large as the container. Does nothing if 'nth' is not less than the size of the container.</para>
+	/// </summary>
+	/// <typeparam name="CONTAINER_T"></typeparam>
+	/// <typeparam name="T"></typeparam>
+	/// <param name="arr"></param>
+	/// <param name="nth"></param>
+	template<class CONTAINER_T, typename T = CONTAINER_T::value_type>
+	inline void nth_element(CONTAINER_T& arr, const size_t nth)
+	requires tpa::util::contiguous_seqeunce<CONTAINER_T> && tpa::simd::is_vec_type<T>
+	{
+        try
+        {
+            if (nth >= arr.size())
+            {
+                return;
+            }//End if
+
+            tpa_nth_element_private::on_keys(arr.data(), arr.size(), [nth](auto* keys, const size_t n)
+                {
+                    tpa_nth_element_private::select(keys, n, nth);
+                });
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::nth_element(): " << ex.code()
+                << " " << ex.what() << "\n";
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::nth_element(): " << ex.what() << "\n";
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::nth_element(): " << ex.what() << "\n";
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::nth_element(): unknown!\n";
+        }//End catch
+	}//End of nth_element
+
+	/// <summary>
+	/// <para>Moves the 'count' smallest elements of the container to its front in ascending order, the order of the rest is unspecified (as std::partial_sort).</para>
+	/// <para>This parallel implementation is tpa::nth_element followed by tpa::sort of the front.</para>
+	/// <para>Floating-point numbers are ordered as by tpa::sort. Sorts the whole container if 'count' is not less than its size.</para>
+	/// </summary>
+	/// <typeparam name="CONTAINER_T"></typeparam>
+	/// <typeparam name="T"></typeparam>
+	/// <param name="arr"></param>
+	/// <param name="count"></param>
+	template<class CONTAINER_T, typename T = CONTAINER_T::value_type>
+	inline void partial_sort(CONTAINER_T& arr, const size_t count)
+	requires tpa::util::contiguous_seqeunce<CONTAINER_T> && tpa::simd::is_vec_type<T>
+	{
+        try
+        {
+            if (count == 0uz)
+            {
+                return;
+            }//End if
+
+            tpa_nth_element_private::on_keys(arr.data(), arr.size(), [count](auto* keys, const size_t n)
+                {
+                    const size_t front = tpa::util::min(count, n);
+
+                    if (front < n)
+                    {
+                        tpa_nth_element_private::select(keys, n, front - 1uz);
+                    }//End if
+
+                    tpa_sort_private::sort_range(keys, front);
+                });
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::partial_sort(): " << ex.code()
+                << " " << ex.what() << "\n";
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::partial_sort(): " << ex.what() << "\n";
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::partial_sort(): " << ex.what() << "\n";
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::partial_sort(): unknown!\n";
+        }//End catch
+	}//End of partial_sort
+#pragma endregion
+}//End of namespace
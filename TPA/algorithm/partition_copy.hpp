@@ -0,0 +1,207 @@
+#pragma once
+/*
+* Truly Parallel Algorithms Library - Algorithm - partition_copy function
+* By: David Aaron Braun
+* 2022-08-18
+* Parallel implementation of partition_copy
+*/
+
+/*
+*           Copyright David Aaron Braun 2021 - .
+*   Distributed under the Boost Software License, Version 1.0.
+*       (See accompanying file LICENSE_1_0.txt or copy at
+*           https://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include <utility>
+#include <iostream>
+#include <future>
+#include <vector>
+
+#include "../tpa.hpp"
+#include "../ThreadPool.hpp"
+#include "../_util.hpp"
+#include "../size_t_lit.hpp"
+#include "../tpa_macros.hpp"
+#include "../predicates.hpp"
+#include "../tpa_concepts.hpp"
+#include "../InstructionSet.hpp"
+
+#include "copy_if.hpp"
+
+/// <summary>
+/// <para>Private Namespace for TPA partition_copy.</para>
+/// </summary>
+namespace tpa_partition_copy_private
+{
+    /// <summary>
+    /// <para>Splits 'source' into 'dest_true' and 'dest_false' with the compaction engine of copy_if, one count pass and one write pass.</para>
+    /// <para>Section k writes its matches from the sum of the earlier matches and its other elements from its start minus that sum.</para>
+    /// </summary>
+    template<typename SOURCE, typename DEST, typename FILTER>
+    [[nodiscard]] inline std::pair<size_t, size_t> partition_threaded(const SOURCE& source, DEST& dest_true, DEST& dest_false, const FILTER& filter, const bool shrinkDest)
+    {
+        using T = SOURCE::value_type;
+
+        const size_t count = source.size();
+
+        const T* src = source.data();
+        T* out_true = dest_true.data();
+        T* out_false = dest_false.data();
+
+        const size_t total = tpa_copy_if_private::compact_threaded(count,
+            [src, &filter](const size_t beg, const size_t end) { return tpa_copy_if_private::count_section<true>(beg, end, src, filter); },
+            [&dest_true, &dest_false, count](const size_t n)
+            {
+                if (n > dest_true.size() || (count - n) > dest_false.size())
+                {
+                    throw tpa::exceptions::ArrayTooSmall();
+                }//End if
+            },
+            [src, out_true, out_false, &filter](const size_t beg, const size_t end, const size_t offset)
+            {
+                tpa_copy_if_private::compact_section<true>(beg, end, src, out_true + offset, filter);
+                tpa_copy_if_private::compact_section<false>(beg, end, src, out_false + (beg - offset), filter);
+            });
+
+        if constexpr (requires { dest_true.erase(dest_true.begin(), dest_true.end()); })
+        {
+            if (shrinkDest == true)
+            {
+                dest_true.erase(dest_true.begin() + total, dest_true.end());
+                dest_false.erase(dest_false.begin() + (count - total), dest_false.end());
+            }//End if
+        }//End if
+
+        return std::pair<size_t, size_t>(total, count - total);
+    }//End of partition_threaded
+}//End of namespace
+
+/// <summary>
+/// <para>Truly Parallel Algorithms</para>
+/// <para>By David Aaron Braun</para>
+/// <para>Version 0.1</para> 
+/// </summary>
+namespace tpa {
+#pragma region generic
+
+    /// <summary>
+    /// <para>Parallel Implementation of partition_copy taking a predicate function returning a bool, copying the elements of SOURCE which match the predicate to the front of DEST_TRUE and the others to the front of DEST_FALSE, both in their original order</para>
+    /// <para>Returns the number of elements copied to each, the destinations only need to be large enough to hold them.</para>
+    /// <para>Does not use SIMD</para>
+    /// </summary>
+    /// <typeparam name="SOURCE"></typeparam>
+    /// <typeparam name="DEST"></typeparam>
+    /// <typeparam name="N"></typeparam>
+    /// <param name="source"></param>
+    /// <param name="dest_true"></param>
+    /// <param name="dest_false"></param>
+    /// <param name="pred"></param>
+    /// <param name="shrinkDest"> - erase the elements of each destination past the ones copied, when it supports erase.</param>
+    /// <returns>The number of elements copied to dest_true and dest_false</returns>
+    template <typename SOURCE, typename DEST, typename N>
+    inline constexpr std::pair<size_t, size_t> partition_copy(
+        const SOURCE& source,
+        DEST& dest_true,
+        DEST& dest_false,
+        bool (*pred)(N),
+        bool shrinkDest = true
+    ) requires tpa::util::contiguous_seqeunce<SOURCE> && tpa::util::contiguous_seqeunce<DEST>
+    {
+        try
+        {
+            static_assert(std::is_same<typename SOURCE::value_type, typename DEST::value_type>() == true, "Compile Error! The source and destination container must be of the same value type!");
+
+            const tpa_copy_if_private::pred_filter<bool (*)(N)> filter{ pred };
+
+            return tpa_partition_copy_private::partition_threaded(source, dest_true, dest_false, filter, shrinkDest);
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::partition_copy(): " << ex.code()
+                << " " << ex.what() << "\n";
+            return std::pair<size_t, size_t>(0uz, 0uz);
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::partition_copy(): " << ex.what() << "\n";
+            return std::pair<size_t, size_t>(0uz, 0uz);
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::partition_copy(): " << ex.what() << "\n";
+            return std::pair<size_t, size_t>(0uz, 0uz);
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::partition_copy(): unknown!\n";
+            return std::pair<size_t, size_t>(0uz, 0uz);
+        }//End catch
+    }//End of partition_copy
+
+    /// <summary>
+    /// <para>Parallel Implementation of partition_copy using a constexpr predicate, copying the elements of SOURCE which match the condition to the front of DEST_TRUE and the others to the front of DEST_FALSE, both in their original order</para>
+    /// <para>Returns the number of elements copied to each, the destinations only need to be large enough to hold them.</para>
+    /// <para>The comparison conditions, EVEN and ODD are counted and left-packed with SIMD, see tpa::copy_if.</para>
+    /// </summary>
+    /// <typeparam name="SOURCE"></typeparam>
+    /// <typeparam name="DEST"></typeparam>
+    /// <typeparam name="P"></typeparam>
+    /// <param name="source"></param>
+    /// <param name="dest_true"></param>
+    /// <param name="dest_false"></param>
+    /// <param name="shrinkDest"> - erase the elements of each destination past the ones copied, when it supports erase.</param>
+    /// <param name="param"> -- Optional!  Only used by the conditions taking a parameter, see tpa::copy_if.</param>
+    /// <returns>The number of elements copied to dest_true and dest_false</returns>
+    template <tpa::cond COND, typename SOURCE, typename DEST, typename P = uint64_t>
+    inline constexpr std::pair<size_t, size_t> partition_copy(
+        const SOURCE& source,
+        DEST& dest_true,
+        DEST& dest_false,
+        bool shrinkDest = true,
+        P param = 0
+    ) requires tpa::util::contiguous_seqeunce<SOURCE> && tpa::util::contiguous_seqeunce<DEST>
+    {
+        try
+        {
+            static_assert(std::is_same<typename SOURCE::value_type, typename DEST::value_type>() == true, "Compile Error! The source and destination container must be of the same value type!");
+
+            using T = SOURCE::value_type;
+
+            const tpa_copy_if_private::cond_filter<COND, T, P> filter(param, true);
+
+            return tpa_partition_copy_private::partition_threaded(source, dest_true, dest_false, filter, shrinkDest);
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::partition_copy(): " << ex.code()
+                << " " << ex.what() << "\n";
+            return std::pair<size_t, size_t>(0uz, 0uz);
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::partition_copy(): " << ex.what() << "\n";
+            return std::pair<size_t, size_t>(0uz, 0uz);
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::partition_copy(): " << ex.what() << "\n";
+            return std::pair<size_t, size_t>(0uz, 0uz);
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::partition_copy(): unknown!\n";
+            return std::pair<size_t, size_t>(0uz, 0uz);
+        }//End catch
+    }//End of partition_copy
+#pragma endregion
+}//End of namespace
@@ -0,0 +1,165 @@
+#pragma once
+/*
+* Truly Parallel Algorithms Library - Algorithm - remove_if function
+* By: David Aaron Braun
+* 2022-08-18
+* Parallel implementation of remove_if
+*/
+
+/*
+*           Copyright David Aaron Braun 2021 - .
+*   Distributed under the Boost Software License, Version 1.0.
+*       (See accompanying file LICENSE_1_0.txt or copy at
+*           https://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include <utility>
+#include <iostream>
+#include <future>
+#include <vector>
+
+#include "../tpa.hpp"
+#include "../ThreadPool.hpp"
+#include "../_util.hpp"
+#include "../size_t_lit.hpp"
+#include "../tpa_macros.hpp"
+#include "../predicates.hpp"
+#include "../tpa_concepts.hpp"
+#include "../InstructionSet.hpp"
+
+#include "copy_if.hpp"
+
+/// <summary>
+/// <para>Truly Parallel Algorithms</para>
+/// <para>By David Aaron Braun</para>
+/// <para>Version 0.1</para> 
+/// </summary>
+namespace tpa {
+#pragma region generic
+
+    /// <summary>
+    /// <para>Parallel Implementation of remove_if taking a predicate function returning a bool, removing the elements of 'arr' which match the predicate and keeping the others at the front in their original order</para>
+    /// <para>Returns the number of elements kept, when 'shrinkArr' is false the elements past them are left in an unspecified state (as std::remove_if).</para>
+    /// <para>Does not use SIMD</para>
+    /// </summary>
+    /// <typeparam name="CONTAINER"></typeparam>
+    /// <typeparam name="N"></typeparam>
+    /// <param name="arr"></param>
+    /// <param name="pred"></param>
+    /// <param name="shrinkArr"> - erase the elements of 'arr' past the ones kept, when 'arr' supports erase.</param>
+    /// <returns>The number of elements kept</returns>
+    template <typename CONTAINER, typename N>
+    inline constexpr size_t remove_if(
+        CONTAINER& arr,
+        bool (*pred)(N),
+        bool shrinkArr = true
+    ) requires tpa::util::contiguous_seqeunce<CONTAINER>
+    {
+        try
+        {
+            const tpa_copy_if_private::pred_filter<bool (*)(N)> filter{ pred };
+
+            const size_t total = tpa_copy_if_private::remove_threaded(arr.size(), arr.data(), filter);
+
+            if constexpr (requires { arr.erase(arr.begin(), arr.end()); })
+            {
+                if (shrinkArr == true)
+                {
+                    arr.erase(arr.begin() + total, arr.end());
+                }//End if
+            }//End if
+
+            return total;
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::remove_if(): " << ex.code()
+                << " " << ex.what() << "\n";
+            return 0uz;
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::remove_if(): " << ex.what() << "\n";
+            return 0uz;
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::remove_if(): " << ex.what() << "\n";
+            return 0uz;
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::remove_if(): unknown!\n";
+            return 0uz;
+        }//End catch
+    }//End of remove_if
+
+    /// <summary>
+    /// <para>Parallel Implementation of remove_if using a constexpr predicate, removing the elements of 'arr' which match the condition and keeping the others at the front in their original order</para>
+    /// <para>Returns the number of elements kept, when 'shrinkArr' is false the elements past them are left in an unspecified state (as std::remove_if).</para>
+    /// <para>The comparison conditions, EVEN and ODD are left-packed with SIMD, see tpa::copy_if.</para>
+    /// </summary>
+    /// <typeparam name="CONTAINER"></typeparam>
+    /// <typeparam name="P"></typeparam>
+    /// <param name="arr"></param>
+    /// <param name="shrinkArr"> - erase the elements of 'arr' past the ones kept, when 'arr' supports erase.</param>
+    /// <param name="param"> -- Optional!  Only used by the conditions taking a parameter, see tpa::copy_if.</param>
+    /// <returns>The number of elements kept</returns>
+    template <tpa::cond COND, typename CONTAINER, typename P = uint64_t>
+    inline constexpr size_t remove_if(
+        CONTAINER& arr,
+        bool shrinkArr = true,
+        P param = 0
+    ) requires tpa::util::contiguous_seqeunce<CONTAINER>
+    {
+        try
+        {
+            using T = CONTAINER::value_type;
+
+            const tpa_copy_if_private::cond_filter<COND, T, P> filter(param, true);
+
+            const size_t total = tpa_copy_if_private::remove_threaded(arr.size(), arr.data(), filter);
+
+            if constexpr (requires { arr.erase(arr.begin(), arr.end()); })
+            {
+                if (shrinkArr == true)
+                {
+                    arr.erase(arr.begin() + total, arr.end());
+                }//End if
+            }//End if
+
+            return total;
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::remove_if(): " << ex.code()
+                << " " << ex.what() << "\n";
+            return 0uz;
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::remove_if(): " << ex.what() << "\n";
+            return 0uz;
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::remove_if(): " << ex.what() << "\n";
+            return 0uz;
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::remove_if(): unknown!\n";
+            return 0uz;
+        }//End catch
+    }//End of remove_if
+#pragma endregion
+}//End of namespace
@@ -0,0 +1,775 @@
+#pragma once
+/*
+*	Truly Parallel Algorithms Library - Algorithm - sort function
+*	By: David Aaron Braun
+*	2022-08-19
+*	Parallel LSD radix sort for integer and floating-point keys
+*/
+
+/*
+*           Copyright David Aaron Braun 2021 - .
+*   Distributed under the Boost Software License, Version 1.0.
+*       (See accompanying file LICENSE_1_0.txt or copy at
+*           https://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include <utility>
+#include <mutex>
+#include <future>
+#include <iostream>
+#include <algorithm>
+#include <numeric>
+#include <bit>
+#include <limits>
+
+#include <array>
+#include <vector>
+
+#include "../_util.hpp"
+#include "../ThreadPool.hpp"
+#include "../excepts.hpp"
+#include "../size_t_lit.hpp"
+#include "../tpa_macros.hpp"
+#include "../predicates.hpp"
+#include "../tpa_concepts.hpp"
+#include "../InstructionSet.hpp"
+#include "../buffer.hpp"
+#include "../simd/vec.hpp"
+#include "../simd/dispatch.hpp"
+
+/// <summary>
+/// <para>Private Namespace for the TPA radix sort.</para>
+/// <para>Keys are sorted 8 bits at a time from the least significant digit, every pass is stable so the whole sort is stable.</para>
+/// </summary>
+namespace tpa_sort_private
+{
+    /// <summary>
+    /// <para>Stands in for the values of a sort without a payload.</para>
+    /// </summary>
+    struct no_payload {};
+
+    inline constexpr size_t radix_bits = 8uz;
+    inline constexpr size_t radix = 1uz << radix_bits;
+
+    /// <summary>
+    /// <para>The unsigned integer with the same size as T, the type of the radix keys.</para>
+    /// </summary>
+    template<typename T>
+    using radix_key = std::conditional_t<sizeof(T) == 1uz, uint8_t, std::conditional_t<sizeof(T) == 2uz, uint16_t, std::conditional_t<sizeof(T) == 4uz, uint32_t, uint64_t>>>;
+
+    /// <summary>
+    /// <para>Maps 'x' to an unsigned key which sorts in the same order as 'x'.</para>
+    /// <para>Signed integers have their sign bit flipped, negative floating-point numbers have every bit flipped and positive ones only the sign bit.</para>
+    /// <para>-0.0 sorts before +0.0, NaNs sort after +infinity (or before -infinity when the sign bit is set).</para>
+    /// </summary>
+    template<typename T>
+    [[nodiscard]] inline radix_key<T> to_key(const T x) noexcept
+    {
+        using U = radix_key<T>;
+        constexpr U sign = static_cast<U>(U(1) << ((sizeof(T) * 8uz) - 1uz));
+
+        const U u = std::bit_cast<U>(x);
+
+        if constexpr (std::is_floating_point<T>::value)
+        {
+            //All ones when the sign bit is set, else only the sign bit
+            return static_cast<U>(u ^ (static_cast<U>(0u - static_cast<U>(u >> ((sizeof(T) * 8uz) - 1uz))) | sign));
+        }//End if
+        else if constexpr (std::is_signed<T>::value)
+        {
+            return static_cast<U>(u ^ sign);
+        }//End if
+        else
+        {
+            return u;
+        }//End else
+    }//End of to_key
+
+    /// <summary>
+    /// <para>Maps the radix key 'k' back to the value it was made from, the inverse of to_key.</para>
+    /// </summary>
+    template<typename T>
+    [[nodiscard]] inline T from_key(const radix_key<T> k) noexcept
+    {
+        using U = radix_key<T>;
+        constexpr U sign = static_cast<U>(U(1) << ((sizeof(T) * 8uz) - 1uz));
+
+        if constexpr (std::is_floating_point<T>::value)
+        {
+            //Keys of positive numbers have the sign bit set
+            return std::bit_cast<T>(static_cast<U>((k & sign) ? (k ^ sign) : static_cast<U>(~k)));
+        }//End if
+        else if constexpr (std::is_signed<T>::value)
+        {
+            return std::bit_cast<T>(static_cast<U>(k ^ sign));
+        }//End if
+        else
+        {
+            return k;
+        }//End else
+    }//End of from_key
+
+    /// <summary>
+    /// <para>Returns the digit of 'x' at 'shift'.</para>
+    /// </summary>
+    template<typename T>
+    [[nodiscard]] inline size_t digit(const T x, const uint32_t shift) noexcept
+    {
+        return static_cast<size_t>((tpa_sort_private::to_key(x) >> shift) & static_cast<radix_key<T>>(radix - 1uz));
+    }//End of digit
+
+    /// <summary>
+    /// <para>Counts the digits at 'shift' of [beg, end) into 'counts' (radix entries).</para>
+    /// </summary>
+    template<typename T>
+    inline void histogram(const T* src, const size_t beg, const size_t end, const uint32_t shift, size_t* counts) noexcept
+    {
+        std::fill(counts, counts + radix, 0uz);
+
+        for (size_t i = beg; i != end; ++i)
+        {
+            ++counts[tpa_sort_private::digit(src[i], shift)];
+        }//End for
+    }//End of histogram
+
+    /// <summary>
+    /// <para>Moves [beg, end) of 'src' (and 'vsrc') to 'dst' (and 'vdst') by the digit at 'shift', 'pos' holds the next output index of each digit and is advanced.</para>
+    /// <para>Elements are visited in order so equal digits keep their relative order, which is what makes every pass stable.</para>
+    /// </summary>
+    template<typename T, typename V>
+    inline void scatter(const T* src, const V* vsrc, T* dst, V* vdst, const size_t beg, const size_t end, const uint32_t shift, size_t* pos) noexcept
+    {
+        for (size_t i = beg; i != end; ++i)
+        {
+            const size_t p = pos[tpa_sort_private::digit(src[i], shift)]++;
+
+            dst[p] = src[i];
+            if constexpr (!std::is_same<V, tpa_sort_private::no_payload>::value)
+            {
+                vdst[p] = vsrc[i];
+            }//End if
+        }//End for
+    }//End of scatter
+
+    /// <summary>
+    /// <para>Runs fn(k, beg, end) for every section on the thread pool and waits for all of them.</para>
+    /// </summary>
+    template<typename FN>
+    inline void for_sections(const std::vector<std::pair<size_t, size_t>>& sections, const FN& fn)
+    {
+        uint32_t complete = 0;
+
+        std::vector<std::shared_future<uint32_t>> results;
+        results.reserve(sections.size());
+
+        for (size_t k = 0uz; k != sections.size(); ++k)
+        {
+            //Launch lambda from multiple threads
+            results.emplace_back(tpa::tp->addTask([&fn, &sec = sections[k], k]()
+                {
+                    fn(k, sec.first, sec.second);
+                    return static_cast<uint32_t>(1);
+                }));//End of lambda
+        }//End for
+
+        for (const auto& fut : results)
+        {
+            complete += fut.get();
+        }//End for
+
+        //Check all threads completed
+        if (complete != tpa::nThreads)
+        {
+            throw tpa::exceptions::NotAllThreadsCompleted(complete);
+        }//End if
+    }//End of for_sections
+
+    /// <summary>
+    /// <para>Stable LSD radix sort of 'keys' (and 'vals' alongside) of 'n' elements.</para>
+    /// <para>Every pass counts the digit per section in parallel, turns the counts into per section output positions (digit-major, section-minor, which keeps the pass stable)
+    /// and scatters every section in parallel. Passes where every key has the same digit are skipped.</para>
+    /// </summary>
+    template<typename T, typename V>
+    inline void radix_sort(T* keys, V* vals, const size_t n)
+    {
+        constexpr bool payload = !std::is_same<V, tpa_sort_private::no_payload>::value;
+
+        if (n < 2uz)
+        {
+            return;
+        }//End if
+
+        std::vector<std::pair<size_t, size_t>> sections;
+        tpa::util::prepareThreading(sections, n);
+
+        tpa::buffer<T> tmp(n);
+        tpa::buffer<std::conditional_t<payload, V, char>> vtmp(payload ? n : 0uz);
+
+        T* src = keys;
+        T* dst = tmp.data();
+        V* vsrc = vals;
+        V* vdst = nullptr;
+
+        if constexpr (payload)
+        {
+            vdst = vtmp.data();
+        }//End if
+
+        std::vector<size_t> counts(sections.size() * radix);
+
+        for (uint32_t shift = 0u; shift < static_cast<uint32_t>(sizeof(T) * 8uz); shift += static_cast<uint32_t>(radix_bits))
+        {
+            tpa_sort_private::for_sections(sections, [&](const size_t k, const size_t beg, const size_t end)
+                {
+                    tpa_sort_private::histogram(src, beg, end, shift, counts.data() + (k * radix));
+                });
+
+            //Exclusive scan, digit-major then section-minor
+            bool trivial = false;
+            size_t run = 0uz;
+            for (size_t b = 0uz; b != radix; ++b)
+            {
+                const size_t first = run;
+
+                for (size_t k = 0uz; k != sections.size(); ++k)
+                {
+                    const size_t c = counts[(k * radix) + b];
+                    counts[(k * radix) + b] = run;
+                    run += c;
+                }//End for
+
+                if ((run - first) == n)
+                {
+                    trivial = true;
+                }//End if
+            }//End for
+
+            //Every key has the same digit, nothing would move
+            if (trivial)
+            {
+                continue;
+            }//End if
+
+            tpa_sort_private::for_sections(sections, [&](const size_t k, const size_t beg, const size_t end)
+                {
+                    tpa_sort_private::scatter(src, vsrc, dst, vdst, beg, end, shift, counts.data() + (k * radix));
+                });
+
+            std::swap(src, dst);
+            std::swap(vsrc, vdst);
+        }//End for
+
+        //An odd number of passes leaves the result in the scratch buffers
+        if (src != keys)
+        {
+            tpa_sort_private::for_sections(sections, [&](const size_t, const size_t beg, const size_t end)
+                {
+                    std::copy(src + beg, src + end, keys + beg);
+                    if constexpr (payload)
+                    {
+                        std::copy(vsrc + beg, vsrc + end, vals + beg);
+                    }//End if
+                });
+        }//End if
+    }//End of radix_sort
+
+#pragma region quicksort
+    /// <summary>
+    /// <para>Ranges of at most this many elements are finished by the sorting network.</para>
+    /// </summary>
+    inline constexpr size_t network_size = 16uz;
+
+    /// <summary>
+    /// <para>Below this many elements tpa::sort uses the vectorized quicksort, the fixed cost of the radix passes does not pay off.</para>
+    /// <para>8-bit and 16-bit keys need only one or two radix passes, so they switch earlier, 64-bit keys need eight and switch later.</para>
+    /// </summary>
+    template<typename T>
+    inline constexpr size_t quicksort_limit = (sizeof(T) <= 2uz) ? (1uz << 11) : ((sizeof(T) == 4uz) ? (1uz << 13) : (1uz << 14));
+
+    /// <summary>
+    /// <para>The comparators of the bitonic sorting network for N (a power of 2) elements, each pair is (low, high).</para>
+    /// </summary>
+    template<size_t N>
+    inline constexpr auto bitonic_network = []()
+    {
+        constexpr size_t stages = static_cast<size_t>(std::bit_width(N) - 1);
+        std::array<std::pair<uint8_t, uint8_t>, (N / 2uz) * ((stages * (stages + 1uz)) / 2uz)> net{};
+
+        size_t c = 0uz;
+        for (size_t k = 2uz; k <= N; k <<= 1)
+        {
+            for (size_t j = k >> 1; j != 0uz; j >>= 1)
+            {
+                for (size_t i = 0uz; i != N; ++i)
+                {
+                    const size_t l = i ^ j;
+
+                    if (l > i)
+                    {
+                        //Ascending where bit k of i is clear, descending otherwise
+                        net[c++] = ((i & k) == 0uz) ?
+                            std::pair<uint8_t, uint8_t>(static_cast<uint8_t>(i), static_cast<uint8_t>(l)) :
+                            std::pair<uint8_t, uint8_t>(static_cast<uint8_t>(l), static_cast<uint8_t>(i));
+                    }//End if
+                }//End for
+            }//End for
+        }//End for
+
+        return net;
+    }();
+
+    /// <summary>
+    /// <para>Sorts 'n' (at most network_size) integers with a branchless bitonic sorting network, padding the unused slots with the largest value.</para>
+    /// </summary>
+    template<typename T>
+    inline void network_sort(T* arr, const size_t n) noexcept
+    {
+        const auto run = [arr, n]<size_t N>()
+        {
+            T x[N];
+
+            std::copy(arr, arr + n, x);
+            std::fill(x + n, x + N, std::numeric_limits<T>::max());
+
+            for (const auto& [lo, hi] : tpa_sort_private::bitonic_network<N>)
+            {
+                const T a = x[lo];
+                const T b = x[hi];
+
+                x[lo] = (b < a) ? b : a;
+                x[hi] = (b < a) ? a : b;
+            }//End for
+
+            std::copy(x, x + n, arr);
+        };//End of lambda
+
+        if (n < 2uz)
+        {
+            return;
+        }//End if
+        else if (n <= 4uz)
+        {
+            run.template operator()<4uz>();
+        }//End if
+        else if (n <= 8uz)
+        {
+            run.template operator()<8uz>();
+        }//End if
+        else
+        {
+            run.template operator()<network_size>();
+        }//End else
+    }//End of network_sort
+
+    /// <summary>
+    /// <para>Partitions 'arr' so that the elements less than 'pivot' (less than or equal to when LE = true) come first and returns how many there are.</para>
+    /// </summary>
+    template<bool LE, typename T>
+    [[nodiscard]] inline size_t partition_scalar(T* arr, const size_t n, const T pivot) noexcept
+    {
+        return static_cast<size_t>(std::partition(arr, arr + n, [pivot](const T x)
+            {
+                if constexpr (LE)
+                {
+                    return x <= pivot;
+                }//End if
+                else
+                {
+                    return x < pivot;
+                }//End else
+            }) - arr);
+    }//End of partition_scalar
+
+    /// <summary>
+    /// <para>Compress-stores the lanes of '_val' that belong left of '_pivot' to the front and the others to the back.</para>
+    /// </summary>
+    template<bool LE, typename T, size_t W>
+    TPA_FORCE_INLINE void place_block(T* arr, const tpa::simd::vec<T, W> _val, const tpa::simd::vec<T, W> _pivot, size_t& write_l, size_t& write_r) noexcept
+    {
+        const auto _m = LE ? (_val <= _pivot) : (_val < _pivot);
+
+        write_r -= W - _m.count();
+        tpa::simd::compress_store(_val, ~_m, arr + write_r);
+        write_l += tpa::simd::compress_store(_val, _m, arr + write_l);
+    }//End of place_block
+
+    /// <summary>
+    /// <para>The vectorized in-place partition: a vector from either end is kept aside, then every vector read is compress-stored to both ends at once,
+    /// the left elements to the front and the right elements to the back.</para>
+    /// <para>Reading from the side with less free space keeps at least one vector of room on both sides, so no unread element is overwritten.</para>
+    /// </summary>
+    template<size_t W, bool LE, typename T>
+    [[nodiscard]] TPA_FORCE_INLINE size_t partition_block(T* arr, const size_t n, const T pivot) noexcept
+    {
+        using V = tpa::simd::vec<T, W>;
+
+        if (W == 1uz || n < 2uz * W)
+        {
+            return tpa_sort_private::partition_scalar<LE>(arr, n, pivot);
+        }//End if
+
+        const V _pivot = V(pivot);
+        const V _first = V::load(arr);
+        const V _last = V::load(arr + n - W);
+
+        //Unread elements are [read_l, read_r), the left part is [0, write_l) and the right part [write_r, n)
+        size_t read_l = W;
+        size_t read_r = n - W;
+        size_t write_l = 0uz;
+        size_t write_r = n;
+
+        while ((read_r - read_l) >= W)
+        {
+            if ((read_l - write_l) <= (write_r - read_r))
+            {
+                const V _val = V::load(arr + read_l);
+                read_l += W;
+                tpa_sort_private::place_block<LE>(arr, _val, _pivot, write_l, write_r);
+            }//End if
+            else
+            {
+                read_r -= W;
+                tpa_sort_private::place_block<LE>(arr, V::load(arr + read_r), _pivot, write_l, write_r);
+            }//End else
+        }//End while
+
+        //Fewer than W left, read them all before writing into the gap
+        T rest[W];
+        const size_t r = read_r - read_l;
+        std::copy(arr + read_l, arr + read_r, rest);
+
+        for (size_t i = 0uz; i != r; ++i)
+        {
+            if (LE ? (rest[i] <= pivot) : (rest[i] < pivot))
+            {
+                arr[write_l++] = rest[i];
+            }//End if
+            else
+            {
+                arr[--write_r] = rest[i];
+            }//End else
+        }//End for
+
+        tpa_sort_private::place_block<LE>(arr, _first, _pivot, write_l, write_r);
+        tpa_sort_private::place_block<LE>(arr, _last, _pivot, write_l, write_r);
+
+        return write_l;
+    }//End of partition_block
+
+    /// <summary>
+    /// <para>Returns the median of 'a', 'b' and 'c'.</para>
+    /// </summary>
+    template<typename T>
+    [[nodiscard]] inline T median3(const T a, const T b, const T c) noexcept
+    {
+        return std::max(std::min(a, b), std::min(std::max(a, b), c));
+    }//End of median3
+
+    /// <summary>
+    /// <para>Picks the pivot of 'arr', the median of three medians of three spread over the range.</para>
+    /// </summary>
+    template<typename T>
+    [[nodiscard]] inline T choose_pivot(const T* arr, const size_t n) noexcept
+    {
+        const size_t s = n / 8uz;
+        const size_t m = n / 2uz;
+
+        return tpa_sort_private::median3(
+            tpa_sort_private::median3(arr[0], arr[s], arr[2uz * s]),
+            tpa_sort_private::median3(arr[m - s], arr[m], arr[m + s]),
+            tpa_sort_private::median3(arr[n - 1uz - (2uz * s)], arr[n - 1uz - s], arr[n - 1uz]));
+    }//End of choose_pivot
+
+    /// <summary>
+    /// <para>Quicksort of integer 'arr' with W lane partitions, recursing into the smaller part and looping on the larger one.</para>
+    /// <para>When the pivot is the smallest element, the elements equal to it are split off instead, so runs of duplicates finish in one pass.</para>
+    /// <para>Falls back to std::sort once 'depth' runs out, which bounds the worst case at O(n log n).</para>
+    /// <para>Recurses through the kernel 'recurse', so every level runs under the target of that kernel.</para>
+    /// </summary>
+    template<size_t W, typename T>
+    TPA_FORCE_INLINE void quicksort_block(T* arr, size_t n, size_t depth, void (*recurse)(T*, const size_t, const size_t) noexcept) noexcept
+    {
+        while (n > network_size)
+        {
+            if (depth-- == 0uz)
+            {
+                std::sort(arr, arr + n);
+                return;
+            }//End if
+
+            const T pivot = tpa_sort_private::choose_pivot(arr, n);
+            size_t k = tpa_sort_private::partition_block<W, false>(arr, n, pivot);
+
+            if (k == 0uz)
+            {
+                //Everything equal to the pivot is already in place
+                k = tpa_sort_private::partition_block<W, true>(arr, n, pivot);
+                arr += k;
+                n -= k;
+            }//End if
+            else if (k < (n - k))
+            {
+                recurse(arr, k, depth);
+                arr += k;
+                n -= k;
+            }//End if
+            else
+            {
+                recurse(arr + k, n - k, depth);
+                n = k;
+            }//End else
+        }//End while
+
+        tpa_sort_private::network_sort(arr, n);
+    }//End of quicksort_block
+
+    /// <summary>
+    /// <para>Returns the depth limit of the quicksort for 'n' elements.</para>
+    /// </summary>
+    [[nodiscard]] inline size_t depth_limit(const size_t n) noexcept
+    {
+        return 2uz * static_cast<size_t>(std::bit_width(n));
+    }//End of depth_limit
+
+    template<typename T>
+    inline void quicksort_scalar(T* arr, const size_t n, const size_t depth) noexcept
+    {
+        tpa_sort_private::quicksort_block<1uz>(arr, n, depth, &tpa_sort_private::quicksort_scalar<T>);
+    }//End of quicksort_scalar
+
+#ifdef TPA_X86_64
+    template<typename T>
+    TPA_TARGET_AVX2 inline void quicksort_avx2(T* arr, const size_t n, const size_t depth) noexcept
+    {
+        tpa_sort_private::quicksort_block<32uz / sizeof(T)>(arr, n, depth, &tpa_sort_private::quicksort_avx2<T>);
+    }//End of quicksort_avx2
+
+    template<typename T>
+    TPA_TARGET_AVX512 inline void quicksort_avx512(T* arr, const size_t n, const size_t depth) noexcept
+    {
+        tpa_sort_private::quicksort_block<64uz / sizeof(T)>(arr, n, depth, &tpa_sort_private::quicksort_avx512<T>);
+    }//End of quicksort_avx512
+#endif
+
+    /// <summary>
+    /// <para>Returns the quicksort kernels for the integer type T.</para>
+    /// <para>Only widths where tpa::simd::compress_store is a few instructions get a kernel (256-bit with 32-bit and 64-bit lanes, 512-bit with VBMI2 for 8-bit and 16-bit lanes),
+    /// elsewhere the lane by lane compress is slower than std::partition and the scalar kernel is used.</para>
+    /// </summary>
+    template<typename T>
+    [[nodiscard]] inline auto quicksort_kernels() noexcept
+    {
+        tpa::simd::kernel_table<void(T*, const size_t, const size_t) noexcept> table;
+        table.scalar = &tpa_sort_private::quicksort_scalar<T>;
+#ifdef TPA_X86_64
+        if constexpr (sizeof(T) >= 4uz)
+        {
+            table.avx2 = &tpa_sort_private::quicksort_avx2<T>;
+            table.avx512 = &tpa_sort_private::quicksort_avx512<T>;
+        }//End if
+        else
+        {
+            if (tpa::hasAVX512_VBMI2)
+            {
+                table.avx512 = &tpa_sort_private::quicksort_avx512<T>;
+            }//End if
+        }//End else
+#endif
+        return table;
+    }//End of quicksort_kernels
+
+    /// <summary>
+    /// <para>Sorts 'arr' with the vectorized quicksort.</para>
+    /// <para>Floating-point numbers are sorted as their radix keys and mapped back, which gives exactly the order of the radix sort (-0.0 before +0.0, NaNs at the ends).</para>
+    /// </summary>
+    template<typename T>
+    inline void quicksort(T* arr, const size_t n)
+    {
+        if constexpr (std::is_floating_point<T>::value)
+        {
+            using U = radix_key<T>;
+
+            tpa::buffer<U> keys(n);
+            std::transform(arr, arr + n, keys.data(), [](const T x) { return tpa_sort_private::to_key(x); });
+
+            tpa_sort_private::quicksort(keys.data(), n);
+
+            std::transform(keys.data(), keys.data() + n, arr, [](const U k) { return tpa_sort_private::from_key<T>(k); });
+        }//End if
+        else
+        {
+            //Built on first use, not per call
+            static const auto kernels = tpa_sort_private::quicksort_kernels<T>();
+
+            kernels.resolve_for(n * sizeof(T))(arr, n, tpa_sort_private::depth_limit(n));
+        }//End else
+    }//End of quicksort
+
+    /// <summary>
+    /// <para>Sorts 'arr', with the quicksort below quicksort_limit and the radix sort above it.</para>
+    /// </summary>
+    template<typename T>
+    inline void sort_range(T* arr, const size_t n)
+    {
+        if (n < tpa_sort_private::quicksort_limit<T>)
+        {
+            tpa_sort_private::quicksort(arr, n);
+        }//End if
+        else
+        {
+            tpa_sort_private::radix_sort(arr, static_cast<tpa_sort_private::no_payload*>(nullptr), n);
+        }//End else
+    }//End of sort_range
+#pragma endregion
+}//End of namespace
+
+/// <summary>
+/// <para>Truly Parallel Algorithms</para>
+/// <para>By David Aaron Braun</para>
+/// <para>Version 0.1</para>
+/// </summary>
+namespace tpa {
+#pragma region generic
+
+	/// <summary>
+	/// <para>Sorts the container in ascending order.</para>
+	/// <para>Large containers use a stable LSD radix sort using Multi-Threading, 8 bits of the key per pass with per-thread histograms and scatters.</para>
+	/// <para>Containers below a few thousand elements use a SIMD quicksort instead,
+	/// partitioning with compress-stores and finishing small ranges with a bitonic sorting network.</para>
+	/// <para>Floating-point keys are sorted by their bits: -0.0 before +0.0 and NaNs at the ends, both paths give the same order.</para>
+	/// <para>Uses a scratch buffer as large as the container.</para>
+	/// </summary>
+	/// <typeparam name="CONTAINER_T"></typeparam>
+	/// <typeparam name="T"></typeparam>
+	/// <param name="arr"></param>
+	template<class CONTAINER_T, typename T = CONTAINER_T::value_type>
+	inline void sort(CONTAINER_T& arr)
+	requires tpa::util::contiguous_seqeunce<CONTAINER_T> && tpa::simd::is_vec_type<T>
+	{
+        try
+        {
+            tpa_sort_private::sort_range(arr.data(), arr.size());
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::sort(): " << ex.code()
+                << " " << ex.what() << "\n";
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::sort(): " << ex.what() << "\n";
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::sort(): " << ex.what() << "\n";
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::sort(): unknown!\n";
+        }//End catch
+	}//End of sort
+
+	/// <summary>
+	/// <para>Sorts 'keys' in ascending order and applies the same permutation to 'values'.</para>
+	/// <para>The sort is stable, values of equal keys keep their relative order.</para>
+	/// <para>This parallel implementation is the radix sort of tpa::sort carrying the values alongside the keys.</para>
+	/// <para>If the containers are not the same size, will throw an exception and leave both unchanged.</para>
+	/// </summary>
+	/// <typeparam name="KEYS_T"></typeparam>
+	/// <typeparam name="VALUES_T"></typeparam>
+	/// <typeparam name="T"></typeparam>
+	/// <typeparam name="V"></typeparam>
+	/// <param name="keys"></param>
+	/// <param name="values"></param>
+	template<class KEYS_T, class VALUES_T, typename T = KEYS_T::value_type, typename V = VALUES_T::value_type>
+	inline void sort_by_key(KEYS_T& keys, VALUES_T& values)
+	requires tpa::util::contiguous_seqeunce<KEYS_T> && tpa::util::contiguous_seqeunce<VALUES_T> && tpa::simd::is_vec_type<T> && std::is_trivially_copyable<V>::value
+	{
+        try
+        {
+            if (keys.size() != values.size())
+            {
+                throw tpa::exceptions::MismatchedData();
+            }//End if
+
+            tpa_sort_private::radix_sort(keys.data(), values.data(), keys.size());
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::sort_by_key(): " << ex.code()
+                << " " << ex.what() << "\n";
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::sort_by_key(): " << ex.what() << "\n";
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::sort_by_key(): " << ex.what() << "\n";
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::sort_by_key(): unknown!\n";
+        }//End catch
+	}//End of sort_by_key
+
+	/// <summary>
+	/// <para>Returns the indices which would sort 'keys' in ascending order, equal keys keep their original order.</para>
+	/// <para>'keys' is not modified, the sort runs on a copy.</para>
+	/// <para>If an exception is thrown, returns an empty vector.</para>
+	/// </summary>
+	/// <typeparam name="CONTAINER_T"></typeparam>
+	/// <typeparam name="T"></typeparam>
+	/// <param name="keys"></param>
+	/// <returns></returns>
+	template<class CONTAINER_T, typename T = CONTAINER_T::value_type>
+	[[nodiscard]] inline std::vector<size_t> argsort(const CONTAINER_T& keys)
+	requires tpa::util::contiguous_seqeunce<CONTAINER_T> && tpa::simd::is_vec_type<T>
+	{
+        try
+        {
+            std::vector<T> copy(keys.begin(), keys.end());
+            std::vector<size_t> indices(keys.size());
+            std::iota(indices.begin(), indices.end(), 0uz);
+
+            tpa_sort_private::radix_sort(copy.data(), indices.data(), copy.size());
+
+            return indices;
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::argsort(): " << ex.code()
+                << " " << ex.what() << "\n";
+            return std::vector<size_t>();
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::argsort(): " << ex.what() << "\n";
+            return std::vector<size_t>();
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::argsort(): " << ex.what() << "\n";
+            return std::vector<size_t>();
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::argsort(): unknown!\n";
+            return std::vector<size_t>();
+        }//End catch
+	}//End of argsort
+#pragma endregion
+}//End of namespace
@@ -0,0 +1,393 @@
+#pragma once
+/*
+*	Truly Parallel Algorithms Library - Algorithm - top_k function
+*	By: David Aaron Braun
+*	2022-08-21
+*/
+
+/*
+*           Copyright David Aaron Braun 2021 - .
+*   Distributed under the Boost Software License, Version 1.0.
+*       (See accompanying file LICENSE_1_0.txt or copy at
+*           https://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include <utility>
+#include <mutex>
+#include <future>
+#include <iostream>
+#include <algorithm>
+#include <queue>
+#include <bit>
+
+#include <vector>
+
+#include "../_util.hpp"
+#include "../ThreadPool.hpp"
+#include "../excepts.hpp"
+#include "../size_t_lit.hpp"
+#include "../tpa_macros.hpp"
+#include "../predicates.hpp"
+#include "../tpa_concepts.hpp"
+#include "../InstructionSet.hpp"
+#include "../simd/simd.hpp"
+#include "../simd/vec.hpp"
+#include "../simd/dispatch.hpp"
+
+/// <summary>
+/// <para>Private Namespace for TPA top_k.</para>
+/// <para>Every thread keeps the candidates of its section with a threshold, only elements above it are looked at one by one.
+/// The candidate lists are then merged with a small heap. The input is read once and not modified.</para>
+/// </summary>
+namespace tpa_top_k_private
+{
+    /// <summary>
+    /// <para>Returns true if (value, index) 'a' ranks before 'b': the greater value first, the smaller index first between equal values.</para>
+    /// </summary>
+    template<typename T>
+    [[nodiscard]] inline bool ranks_before(const std::pair<T, size_t>& a, const std::pair<T, size_t>& b) noexcept
+    {
+        return (a.first > b.first) || (a.first == b.first && a.second < b.second);
+    }//End of ranks_before
+
+    /// <summary>
+    /// <para>The candidates of one section. Once 'k' are held, 'threshold' is the smallest of the best 'k' and only greater elements can still make it.</para>
+    /// <para>Candidates are appended up to twice 'k' and then pruned back to the best 'k', which raises the threshold.</para>
+    /// </summary>
+    template<typename T>
+    struct candidates
+    {
+        std::vector<std::pair<T, size_t>> items;
+        size_t k = 0uz;
+        size_t cap = 0uz;
+        T threshold{};
+        bool full = false;
+
+        explicit candidates(const size_t count) : k(count), cap(tpa::util::max(2uz * count, count + 256uz))
+        {
+            items.reserve(cap);
+        }//End constructor
+
+        inline void push(const T x, const size_t i)
+        {
+            items.emplace_back(x, i);
+
+            if (items.size() == cap)
+            {
+                prune();
+            }//End if
+        }//End of push
+
+        inline void prune()
+        {
+            std::nth_element(items.begin(), items.begin() + static_cast<std::ptrdiff_t>(k - 1uz), items.end(), &tpa_top_k_private::ranks_before<T>);
+            items.resize(k);
+
+            threshold = items[k - 1uz].first;
+            full = true;
+        }//End of prune
+    };//End of candidates
+
+    /// <summary>
+    /// <para>Adds the elements [i, end) to 'c' one at a time, NaNs are skipped. Also used to finish the leftovers of the SIMD kernels.</para>
+    /// </summary>
+    template<typename T>
+    inline void filter_scalar(size_t i, const size_t end, const T* arr, candidates<T>& c)
+    {
+        for (; i != end; ++i)
+        {
+            if (c.full ? (arr[i] > c.threshold) : (arr[i] == arr[i]))
+            {
+                c.push(arr[i], i);
+            }//End if
+        }//End for
+    }//End of filter_scalar
+
+    /// <summary>
+    /// <para>Compares TPA_UNROLL vectors at a time with the threshold and only looks at the lanes above it, 'i' is advanced past the elements processed.</para>
+    /// <para>Runs the scalar filter until 'c' holds 'k' candidates, as there is no threshold before that.</para>
+    /// </summary>
+    template<size_t W, typename T>
+    TPA_FORCE_INLINE void filter_block(size_t& i, const size_t end, const T* arr, candidates<T>& c)
+    {
+        using V = tpa::simd::vec<T, W>;
+
+        constexpr size_t A = tpa::simd::unroll;
+        constexpr size_t step = W * A;
+
+        while (!c.full && i != end)
+        {
+            tpa_top_k_private::filter_scalar(i, i + 1uz, arr, c);
+            ++i;
+
+            if (!c.full && c.items.size() == c.k)
+            {
+                c.prune();
+            }//End if
+        }//End while
+
+        V _threshold(c.threshold);
+
+        for (; (i + step) <= end; i += step)
+        {
+            tpa::simd::prefetch<step * sizeof(T)>(arr + i);
+
+            auto _any = V::load(arr + i) > _threshold;
+            for (size_t a = 1uz; a < A; ++a)
+            {
+                _any = _any | (V::load(arr + i + (W * a)) > _threshold);
+            }//End for
+
+            if (_any.none())
+            {
+                continue;
+            }//End if
+
+            for (size_t a = 0uz; a < A; ++a)
+            {
+                uint64_t bits = (V::load(arr + i + (W * a)) > _threshold).bits();
+
+                while (bits != 0ull)
+                {
+                    const size_t p = i + (W * a) + static_cast<size_t>(std::countr_zero(bits));
+                    bits &= bits - 1ull;
+
+                    c.push(arr[p], p);
+                }//End while
+            }//End for
+
+            //A prune may have raised it
+            _threshold = V(c.threshold);
+        }//End for
+    }//End of filter_block
+
+#ifdef TPA_X86_64
+    template<typename T>
+    TPA_TARGET_SSE41 inline void filter_sse41(size_t i, const size_t end, const T* arr, candidates<T>& c)
+    {
+        tpa_top_k_private::filter_block<16uz / sizeof(T)>(i, end, arr, c);
+        tpa_top_k_private::filter_scalar(i, end, arr, c);
+    }//End of filter_sse41
+
+    template<typename T>
+    TPA_TARGET_AVX2 inline void filter_avx2(size_t i, const size_t end, const T* arr, candidates<T>& c)
+    {
+        tpa_top_k_private::filter_block<32uz / sizeof(T)>(i, end, arr, c);
+        tpa_top_k_private::filter_scalar(i, end, arr, c);
+    }//End of filter_avx2
+
+    template<typename T>
+    TPA_TARGET_AVX512 inline void filter_avx512(size_t i, const size_t end, const T* arr, candidates<T>& c)
+    {
+        tpa_top_k_private::filter_block<64uz / sizeof(T)>(i, end, arr, c);
+        tpa_top_k_private::filter_scalar(i, end, arr, c);
+    }//End of filter_avx512
+#elif defined(TPA_NEON)
+    template<typename T>
+    inline void filter_neon(size_t i, const size_t end, const T* arr, candidates<T>& c)
+    {
+        tpa_top_k_private::filter_block<16uz / sizeof(T)>(i, end, arr, c);
+        tpa_top_k_private::filter_scalar(i, end, arr, c);
+    }//End of filter_neon
+#endif
+
+    /// <summary>
+    /// <para>Returns the top_k filter kernels for T.</para>
+    /// </summary>
+    template<typename T>
+    [[nodiscard]] inline auto filter_kernels() noexcept
+    {
+        tpa::simd::kernel_table<void(size_t, const size_t, const T*, candidates<T>&)> table;
+        table.scalar = &tpa_top_k_private::filter_scalar<T>;
+
+        if constexpr (tpa::simd::is_vec_type<T>)
+        {
+#ifdef TPA_X86_64
+            table.sse41 = &tpa_top_k_private::filter_sse41<T>;
+            table.avx2 = &tpa_top_k_private::filter_avx2<T>;
+            table.avx512 = &tpa_top_k_private::filter_avx512<T>;
+#elif defined(TPA_NEON)
+            table.neon = &tpa_top_k_private::filter_neon<T>;
+#endif
+        }//End if
+
+        return table;
+    }//End of filter_kernels
+
+    /// <summary>
+    /// <para>Filters every section of [0, count) in parallel, sorts the best 'k' candidates of each and merges the sections with a heap of their heads.</para>
+    /// <para>Returns up to 'k' (value, index) pairs in rank order.</para>
+    /// </summary>
+    template<typename T>
+    [[nodiscard]] inline std::vector<std::pair<T, size_t>> top_k_threaded(const size_t count, const T* arr, const size_t k)
+    {
+        uint32_t complete = 0;
+
+        std::vector<std::pair<size_t, size_t>> sections;
+        tpa::util::prepareThreading(sections, count);
+
+        std::vector<std::shared_future<std::vector<std::pair<T, size_t>>>> results;
+        results.reserve(tpa::nThreads);
+
+        std::shared_future<std::vector<std::pair<T, size_t>>> temp;
+
+        //Built on first use, not per call
+        static const auto kernels = tpa_top_k_private::filter_kernels<T>();
+
+        for (const auto& sec : sections)
+        {
+            //Launch lambda from multiple threads
+            temp = tpa::tp->addTask([&sec, arr, k]()
+                {
+                    candidates<T> c(k);
+
+                    kernels.resolve_for((sec.second - sec.first) * sizeof(T))(sec.first, sec.second, arr, c);
+
+                    if (c.items.size() > k)
+                    {
+                        c.prune();
+                    }//End if
+
+                    std::sort(c.items.begin(), c.items.end(), &tpa_top_k_private::ranks_before<T>);
+
+                    return std::move(c.items);
+                });//End of lambda
+
+            results.emplace_back(std::move(temp));
+        }//End for
+
+        std::vector<std::vector<std::pair<T, size_t>>> lists;
+        lists.reserve(results.size());
+
+        for (const auto& fut : results)
+        {
+            lists.push_back(fut.get());
+            complete += 1;
+        }//End for
+
+        //Check all threads completed
+        if (complete != tpa::nThreads)
+        {
+            throw tpa::exceptions::NotAllThreadsCompleted(complete);
+        }//End if
+
+        //Heap of (list, position) ordered by the element each one points to, the best on top
+        const auto worse = [&lists](const std::pair<size_t, size_t>& a, const std::pair<size_t, size_t>& b)
+        {
+            return tpa_top_k_private::ranks_before(lists[b.first][b.second], lists[a.first][a.second]);
+        };//End of lambda
+
+        std::priority_queue<std::pair<size_t, size_t>, std::vector<std::pair<size_t, size_t>>, decltype(worse)> heads(worse);
+
+        for (size_t t = 0uz; t != lists.size(); ++t)
+        {
+            if (!lists[t].empty())
+            {
+                heads.emplace(t, 0uz);
+            }//End if
+        }//End for
+
+        std::vector<std::pair<T, size_t>> best;
+        best.reserve(k);
+
+        while (best.size() != k && !heads.empty())
+        {
+            const auto [t, p] = heads.top();
+            heads.pop();
+
+            best.push_back(lists[t][p]);
+
+            if ((p + 1uz) != lists[t].size())
+            {
+                heads.emplace(t, p + 1uz);
+            }//End if
+        }//End while
+
+        return best;
+    }//End of top_k_threaded
+}//End of namespace
+
+/// <summary>
+/// <para>Truly Parallel Algorithms</para>
+/// <para>By David Aaron Braun</para>
+/// <para>Version 0.1</para>
+/// </summary>
+namespace tpa {
+#pragma region generic
+
+	/// <summary>
+	/// <para>Finds the 'k' largest elements of the container and writes them in descending order to 'out_values' and their indices to 'out_indices'.</para>
+	/// <para>Equal values are ranked by index, the first one first. NaNs are never selected. The container is not modified.</para>
+	/// <para>This parallel implementation uses Multi-Threading and SIMD, each thread compares its section with a rising threshold and only keeps the elements above it,
+	/// the candidates of the threads are merged with a heap.</para>
+	/// <para>Both outputs must hold at least the lesser of 'k' and the size of the container, otherwise will throw an exception and return 0.</para>
+	/// </summary>
+	/// <typeparam name="CONTAINER_T"></typeparam>
+	/// <typeparam name="VALUES_T"></typeparam>
+	/// <typeparam name="INDICES_T"></typeparam>
+	/// <typeparam name="T"></typeparam>
+	/// <param name="arr"></param>
+	/// <param name="k"></param>
+	/// <param name="out_values"></param>
+	/// <param name="out_indices"></param>
+	/// <returns>The number of elements written to each output</returns>
+	template<class CONTAINER_T, class VALUES_T, class INDICES_T, typename T = CONTAINER_T::value_type>
+	inline size_t top_k(const CONTAINER_T& arr, const size_t k, VALUES_T& out_values, INDICES_T& out_indices)
+	requires tpa::util::contiguous_seqeunce<CONTAINER_T> && tpa::util::contiguous_seqeunce<VALUES_T> && tpa::util::contiguous_seqeunce<INDICES_T> && std::is_arithmetic<T>::value
+	{
+        try
+        {
+            static_assert(std::is_same<T, typename VALUES_T::value_type>() == true, "Compile Error! The values container must have the value type of the source container!");
+            static_assert(std::is_integral<typename INDICES_T::value_type>() == true, "Compile Error! The indices container must have an integral value type!");
+
+            const size_t want = tpa::util::min(k, arr.size());
+
+            if (out_values.size() < want || out_indices.size() < want)
+            {
+                throw tpa::exceptions::ArrayTooSmall();
+            }//End if
+
+            if (want == 0uz)
+            {
+                return 0uz;
+            }//End if
+
+            const std::vector<std::pair<T, size_t>> best = tpa_top_k_private::top_k_threaded(arr.size(), arr.data(), want);
+
+            for (size_t i = 0uz; i != best.size(); ++i)
+            {
+                out_values[i] = best[i].first;
+                out_indices[i] = static_cast<typename INDICES_T::value_type>(best[i].second);
+            }//End for
+
+            return best.size();
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::top_k(): " << ex.code()
+                << " " << ex.what() << "\n";
+            return 0uz;
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::top_k(): " << ex.what() << "\n";
+            return 0uz;
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::top_k(): " << ex.what() << "\n";
+            return 0uz;
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::top_k(): unknown!\n";
+            return 0uz;
+        }//End catch
+	}//End of top_k
+#pragma endregion
+}//End of namespace
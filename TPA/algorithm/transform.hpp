@@ -0,0 +1,413 @@
+#pragma once
+/*
+* Truly Parallel Algorithms Library - Algorithm - transform function
+* By: David Aaron Braun
+* 2022-08-08
+* Parallel & vectorized implementation of transform using user supplied vector lambdas
+*/
+
+/*
+*           Copyright David Aaron Braun 2021 - .
+*   Distributed under the Boost Software License, Version 1.0.
+*       (See accompanying file LICENSE_1_0.txt or copy at
+*           https://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include <utility>
+#include <iostream>
+#include <future>
+#include <vector>
+
+#include "../tpa.hpp"
+#include "../ThreadPool.hpp"
+#include "../_util.hpp"
+#include "../size_t_lit.hpp"
+#include "../tpa_macros.hpp"
+#include "../predicates.hpp"
+#include "../tpa_concepts.hpp"
+#include "../InstructionSet.hpp"
+#include "../simd/simd.hpp"
+#include "../simd/vec.hpp"
+#include "../simd/dispatch.hpp"
+
+/// <summary>
+/// <para>Private Namespace for TPA transform.</para>
+/// <para>Runs a user supplied operation over a section, not intended to be used directly.</para>
+/// </summary>
+namespace tpa_transform_private {
+
+    /// <summary>
+    /// <para>Applies 'op' to the 'U' consecutive vectors starting at 'i', expanded at compile time so that the loads of each vector are independent.</para>
+    /// </summary>
+    template<size_t W, bool ALIGNED, size_t U, typename T, class OP, typename... SRC>
+    TPA_FORCE_INLINE void transform_step(const size_t i, T* dest, const OP& op, const SRC*... src)
+    {
+        using V = tpa::simd::vec<T, W>;
+
+        if constexpr (ALIGNED)
+        {
+            op(V::load_aligned(src + i)...).store_aligned(dest + i);
+        }//End if
+        else
+        {
+            op(V::load(src + i)...).store(dest + i);
+        }//End else
+
+        if constexpr (U > 1uz)
+        {
+            transform_step<W, ALIGNED, U - 1uz>(i + W, dest, op, src...);
+        }//End if
+    }//End of transform_step
+
+    /// <summary>
+    /// <para>Applies 'op' to tpa::simd::vec&lt;T, W&gt; loads of each source and stores the result, 'W' elements at a time.</para>
+    /// <para>ALIGNED loads and stores are used when 'dest + i' and every 'src + i' are known to be aligned to the vector size.</para>
+    /// <para>The SIMD loop handles tpa::simd::unroll vectors per iteration and prefetches each source tpa::simd::prefetch_distance bytes ahead.</para>
+    /// <para>Leaves 'i' at the first element which was not processed.</para>
+    /// </summary>
+    template<size_t W, bool ALIGNED = false, typename T, class OP, typename... SRC>
+    TPA_FORCE_INLINE void transform_block(size_t& i, const size_t end, T* dest, const OP& op, const SRC*... src)
+    {
+        if constexpr (W > 1uz && tpa::simd::unroll > 1uz)
+        {
+            constexpr size_t step = W * tpa::simd::unroll;
+
+            for (; (i + step) <= end; i += step)
+            {
+                (tpa::simd::prefetch<step * sizeof(T)>(src + i), ...);
+
+                transform_step<W, ALIGNED, tpa::simd::unroll>(i, dest, op, src...);
+            }//End for
+        }//End if
+
+        for (; (i + W) <= end; i += W)
+        {
+            transform_step<W, ALIGNED, 1uz>(i, dest, op, src...);
+        }//End for
+    }//End of transform_block
+
+    /// <summary>
+    /// <para>Applies 'op' to the elements [beg, end) with tpa::simd::vec&lt;T, 1&gt;, also used to finish the leftovers of the SIMD kernels.</para>
+    /// </summary>
+    template<typename T, class OP, typename... SRC>
+    inline void transform_scalar(const size_t beg, const size_t end, T* dest, const OP& op, const SRC*... src)
+    {
+        size_t i = beg;
+
+        transform_block<1uz>(i, end, dest, op, src...);
+    }//End of transform_scalar
+
+#ifdef TPA_X86_64
+    template<typename T, class OP, typename... SRC>
+    TPA_TARGET_SSE41 TPA_FLATTEN inline void transform_sse41(const size_t beg, const size_t end, T* dest, const OP& op, const SRC*... src)
+    {
+        size_t i = beg;
+
+        transform_block<16uz / sizeof(T)>(i, end, dest, op, src...);
+        transform_block<1uz>(i, end, dest, op, src...);
+    }//End of transform_sse41
+
+    /// <summary>
+    /// <para>ALIGNED = 'dest' and every source come from a tpa::util::aligned_sequence,</para>
+    /// <para>after peeling 'dest' to a 32-byte boundary the sources are on one too and every load and store uses the aligned form.</para>
+    /// </summary>
+    template<bool ALIGNED, typename T, class OP, typename... SRC>
+    TPA_TARGET_AVX2 TPA_FLATTEN inline void transform_avx2(const size_t beg, const size_t end, T* dest, const OP& op, const SRC*... src)
+    {
+        size_t i = beg;
+
+        //Peel to a 32-byte boundary of 'dest' so that every full store is aligned
+        transform_block<1uz>(i, tpa::simd::align_index<32uz>(i, end, dest), dest, op, src...);
+        transform_block<32uz / sizeof(T), ALIGNED>(i, end, dest, op, src...);
+        transform_block<1uz>(i, end, dest, op, src...);
+    }//End of transform_avx2
+
+    /// <summary>
+    /// <para>As transform_avx2 with a 64-byte boundary and a masked tail for floating-point types.</para>
+    /// </summary>
+    template<bool ALIGNED, typename T, class OP, typename... SRC>
+    TPA_TARGET_AVX512 TPA_FLATTEN inline void transform_avx512(const size_t beg, const size_t end, T* dest, const OP& op, const SRC*... src)
+    {
+        using V = tpa::simd::vec<T, 64uz / sizeof(T)>;
+
+        size_t i = beg;
+
+        //Peel to a 64-byte boundary of 'dest' so that every full store is aligned
+        transform_block<1uz>(i, tpa::simd::align_index<64uz>(i, end, dest), dest, op, src...);
+        transform_block<V::width, ALIGNED>(i, end, dest, op, src...);
+
+        if constexpr (std::is_floating_point<T>::value)
+        {
+            //Masked tail, the unused lanes are zero which floating-point operations do not trap on
+            if (i != end)
+            {
+                op(V::load_partial(src + i, end - i)...).store_partial(dest + i, end - i);
+            }//End if
+        }//End if
+        else
+        {
+            //Integer division is emulated lane by lane and would divide the unused lanes by zero
+            transform_block<1uz>(i, end, dest, op, src...);
+        }//End else
+    }//End of transform_avx512
+#elif defined(TPA_NEON)
+    template<typename T, class OP, typename... SRC>
+    TPA_FLATTEN inline void transform_neon(const size_t beg, const size_t end, T* dest, const OP& op, const SRC*... src)
+    {
+        size_t i = beg;
+
+        transform_block<16uz / sizeof(T)>(i, end, dest, op, src...);
+        transform_block<1uz>(i, end, dest, op, src...);
+    }//End of transform_neon
+#endif
+
+    /// <summary>
+    /// <para>Returns the transform kernels for this hardware, built once per instantiation.</para>
+    /// <para>ALIGNED selects kernels which use aligned loads and stores, only when every container satisfies tpa::util::aligned_sequence.</para>
+    /// </summary>
+    template<bool ALIGNED, typename T, class OP, typename... SRC>
+    [[nodiscard]] inline auto transform_kernels() noexcept
+    {
+        tpa::simd::kernel_table<void(const size_t, const size_t, T*, const OP&, const SRC*...)> table;
+        table.scalar = &tpa_transform_private::transform_scalar<T, OP, SRC...>;
+
+#ifdef TPA_X86_64
+        table.sse41 = &tpa_transform_private::transform_sse41<T, OP, SRC...>;
+        table.avx2 = &tpa_transform_private::transform_avx2<ALIGNED, T, OP, SRC...>;
+        table.avx512 = &tpa_transform_private::transform_avx512<ALIGNED, T, OP, SRC...>;
+#elif defined(TPA_NEON)
+        table.neon = &tpa_transform_private::transform_neon<T, OP, SRC...>;
+#endif
+
+        return table;
+    }//End of transform_kernels
+
+    /// <summary>
+    /// <para>Splits [0, count) across the thread pool and runs the transform kernel for this hardware on each section.</para>
+    /// <para>ALIGNED = 'dest' and every source are aligned to at least 64 bytes, see transform_kernels.</para>
+    /// </summary>
+    template<bool ALIGNED, typename T, class OP, typename... SRC>
+    inline void transform_threaded(const size_t count, T* dest, const OP& op, const SRC*... src)
+    {
+        uint32_t complete = 0;
+
+        std::vector<std::pair<size_t, size_t>> sections;
+        tpa::util::prepareThreading(sections, count);
+
+        std::vector<std::shared_future<uint32_t>> results;
+        results.reserve(tpa::nThreads);
+
+        std::shared_future<uint32_t> temp;
+
+        //Built on first use, not per call
+        static const auto kernels = tpa_transform_private::transform_kernels<ALIGNED, T, OP, SRC...>();
+
+        for (const auto& sec : sections)
+        {
+            //Launch lambda from multiple threads
+            temp = tpa::tp->addTask([&sec, dest, &op, src...]()
+                {
+                    kernels.resolve_for((sec.second - sec.first) * sizeof(T))(sec.first, sec.second, dest, op, src...);
+
+                    return static_cast<uint32_t>(1);
+                });//End of lambda
+
+            results.emplace_back(std::move(temp));
+        }//End for
+
+        for (const auto& fut : results)
+        {
+            complete += fut.get();
+        }//End for
+
+        //Check all threads completed
+        if (complete != tpa::nThreads)
+        {
+            throw tpa::exceptions::NotAllThreadsCompleted(complete);
+        }//End if
+    }//End of transform_threaded
+}//End of namespace
+
+/// <summary>
+/// <para>Truly Parallel Algorithms</para>
+/// <para>By David Aaron Braun</para>
+/// <para>Version 0.1</para>
+/// </summary>
+namespace tpa {
+
+    /// <summary>
+    /// <para>Applies the user supplied operation 'op' to every element of 'source' and stores the result in 'dest'.</para>
+    /// <para>'op' must be a generic lambda (or function object) taking and returning a tpa::simd::vec&lt;T, W&gt;, it is called once per vector of elements.</para>
+    /// <para>e.g. tpa::transform(a, b, [](const auto x) { return tpa::simd::sqrt(x * x + 1.0); });</para>
+    /// <para>Threading, ISA dispatch and tails are handled by TPA, the tail is passed to 'op' as tpa::simd::vec&lt;T, 1&gt;.</para>
+    /// <para>Containters of different value types are NOT allowed</para>
+    /// <para>Values are computed upto the size of the smaller container.</para>
+    /// </summary>
+    /// <typeparam name="CONTAINER_A"></typeparam>
+    /// <typeparam name="CONTAINER_B"></typeparam>
+    /// <typeparam name="OP"></typeparam>
+    /// <param name="source"></param>
+    /// <param name="dest"></param>
+    /// <param name="op"></param>
+    template<typename CONTAINER_A, typename CONTAINER_B, class OP>
+    inline constexpr void transform(const CONTAINER_A& source, CONTAINER_B& dest, const OP& op)
+        requires tpa::util::contiguous_seqeunce<CONTAINER_A> &&
+        tpa::util::contiguous_seqeunce<CONTAINER_B>
+    {
+        try
+        {
+            static_assert(std::is_same<typename CONTAINER_A::value_type, typename CONTAINER_B::value_type>() == true, "Compile Error! The source and destination container must be of the same value type!");
+
+            //Prevent overflow
+            const size_t smallest = tpa::util::min(source.size(), dest.size());
+
+            constexpr bool aligned = tpa::util::aligned_sequence<CONTAINER_A> && tpa::util::aligned_sequence<CONTAINER_B>;
+
+            tpa_transform_private::transform_threaded<aligned>(smallest, dest.data(), op, source.data());
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::transform(): " << ex.code()
+                << " " << ex.what() << "\n";
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::transform: " << ex.what() << "\n";
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::transform: " << ex.what() << "\n";
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::transform: unknown!\n";
+        }//End catch
+    }//End of transform()
+
+    /// <summary>
+    /// <para>Applies the user supplied binary operation 'op' to every pair of elements in 'source1' and 'source2' and stores the result in 'dest'.</para>
+    /// <para>'op' must be a generic lambda (or function object) taking two and returning one tpa::simd::vec&lt;T, W&gt;.</para>
+    /// <para>e.g. tpa::transform(a, b, c, [](const auto x, const auto y) { return tpa::simd::max(x, y) * 2; });</para>
+    /// <para>Threading, ISA dispatch and tails are handled by TPA, the tail is passed to 'op' as tpa::simd::vec&lt;T, 1&gt;.</para>
+    /// <para>Containters of different value types are NOT allowed</para>
+    /// <para>Values are computed upto the size of the smallest container.</para>
+    /// </summary>
+    /// <typeparam name="CONTAINER_A"></typeparam>
+    /// <typeparam name="CONTAINER_B"></typeparam>
+    /// <typeparam name="CONTAINER_C"></typeparam>
+    /// <typeparam name="OP"></typeparam>
+    /// <param name="source1"></param>
+    /// <param name="source2"></param>
+    /// <param name="dest"></param>
+    /// <param name="op"></param>
+    template<typename CONTAINER_A, typename CONTAINER_B, typename CONTAINER_C, class OP>
+    inline constexpr void transform(const CONTAINER_A& source1, const CONTAINER_B& source2, CONTAINER_C& dest, const OP& op)
+        requires tpa::util::contiguous_seqeunce<CONTAINER_A> &&
+        tpa::util::contiguous_seqeunce<CONTAINER_B> &&
+        tpa::util::contiguous_seqeunce<CONTAINER_C>
+    {
+        try
+        {
+            static_assert(std::is_same<typename CONTAINER_A::value_type, typename CONTAINER_C::value_type>() == true &&
+                std::is_same<typename CONTAINER_B::value_type, typename CONTAINER_C::value_type>() == true,
+                "Compile Error! The source and destination containers must be of the same value type!");
+
+            //Prevent overflow
+            const size_t smallest = tpa::util::min(tpa::util::min(source1.size(), source2.size()), dest.size());
+
+            constexpr bool aligned = tpa::util::aligned_sequence<CONTAINER_A> && tpa::util::aligned_sequence<CONTAINER_B> &&
+                tpa::util::aligned_sequence<CONTAINER_C>;
+
+            tpa_transform_private::transform_threaded<aligned>(smallest, dest.data(), op, source1.data(), source2.data());
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::transform(): " << ex.code()
+                << " " << ex.what() << "\n";
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::transform: " << ex.what() << "\n";
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::transform: " << ex.what() << "\n";
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::transform: unknown!\n";
+        }//End catch
+    }//End of transform()
+
+    /// <summary>
+    /// <para>Applies the user supplied ternary operation 'op' to every triple of elements in 'source1', 'source2' and 'source3' and stores the result in 'dest'.</para>
+    /// <para>'op' must be a generic lambda (or function object) taking three and returning one tpa::simd::vec&lt;T, W&gt;.</para>
+    /// <para>e.g. tpa::transform(a, b, c, d, [](const auto x, const auto y, const auto z) { return x * y + z; });</para>
+    /// <para>Threading, ISA dispatch and tails are handled by TPA, the tail is passed to 'op' as tpa::simd::vec&lt;T, 1&gt;.</para>
+    /// <para>Containters of different value types are NOT allowed</para>
+    /// <para>Values are computed upto the size of the smallest container.</para>
+    /// </summary>
+    /// <typeparam name="CONTAINER_A"></typeparam>
+    /// <typeparam name="CONTAINER_B"></typeparam>
+    /// <typeparam name="CONTAINER_C"></typeparam>
+    /// <typeparam name="CONTAINER_D"></typeparam>
+    /// <typeparam name="OP"></typeparam>
+    /// <param name="source1"></param>
+    /// <param name="source2"></param>
+    /// <param name="source3"></param>
+    /// <param name="dest"></param>
+    /// <param name="op"></param>
+    template<typename CONTAINER_A, typename CONTAINER_B, typename CONTAINER_C, typename CONTAINER_D, class OP>
+    inline constexpr void transform(const CONTAINER_A& source1, const CONTAINER_B& source2, const CONTAINER_C& source3, CONTAINER_D& dest, const OP& op)
+        requires tpa::util::contiguous_seqeunce<CONTAINER_A> &&
+        tpa::util::contiguous_seqeunce<CONTAINER_B> &&
+        tpa::util::contiguous_seqeunce<CONTAINER_C> &&
+        tpa::util::contiguous_seqeunce<CONTAINER_D>
+    {
+        try
+        {
+            static_assert(std::is_same<typename CONTAINER_A::value_type, typename CONTAINER_D::value_type>() == true &&
+                std::is_same<typename CONTAINER_B::value_type, typename CONTAINER_D::value_type>() == true &&
+                std::is_same<typename CONTAINER_C::value_type, typename CONTAINER_D::value_type>() == true,
+                "Compile Error! The source and destination containers must be of the same value type!");
+
+            //Prevent overflow
+            const size_t smallest = tpa::util::min(tpa::util::min(source1.size(), source2.size()), tpa::util::min(source3.size(), dest.size()));
+
+            constexpr bool aligned = tpa::util::aligned_sequence<CONTAINER_A> && tpa::util::aligned_sequence<CONTAINER_B> &&
+                tpa::util::aligned_sequence<CONTAINER_C> && tpa::util::aligned_sequence<CONTAINER_D>;
+
+            tpa_transform_private::transform_threaded<aligned>(smallest, dest.data(), op, source1.data(), source2.data(), source3.data());
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::transform(): " << ex.code()
+                << " " << ex.what() << "\n";
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::transform: " << ex.what() << "\n";
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::transform: " << ex.what() << "\n";
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::transform: unknown!\n";
+        }//End catch
+    }//End of transform()
+}//End of namespace
@@ -0,0 +1,434 @@
+#pragma once
+/*
+* Truly Parallel Algorithms Library - Aligned allocator and buffer
+* By: David Aaron Braun
+* 2022-08-14
+* Cache-line aligned, optionally huge page backed storage for large TPA workloads
+*/
+
+/*
+*           Copyright David Aaron Braun 2021 - .
+*   Distributed under the Boost Software License, Version 1.0.
+*       (See accompanying file LICENSE_1_0.txt or copy at
+*           https://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <limits>
+#include <memory>
+#include <iterator>
+#include <type_traits>
+#include <bit>
+#include <vector>
+#include <future>
+#include <utility>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include "tpa.hpp"
+#include "_util.hpp"
+#include "excepts.hpp"
+#include "size_t_lit.hpp"
+#include "tpa_macros.hpp"
+#include "tpa_concepts.hpp"
+
+/// <summary>
+/// <para>Truly Parallel Algorithms</para>
+/// <para>By David Aaron Braun</para>
+/// <para>Version 0.1</para>
+/// </summary>
+namespace tpa {
+
+	/// <summary>
+	/// <para>Page size requested by tpa::buffer.</para>
+	/// <para>STANDARD = The operating system's default pages (usually 4 KiB)</para>
+	/// <para>HUGE_PAGES = 2 MiB pages where the operating system provides them, otherwise STANDARD</para>
+	/// </summary>
+	enum class page_policy : uint8_t
+	{
+		STANDARD = 0,
+		HUGE_PAGES
+	};
+
+	/// <summary>
+	/// <para>A std::allocator replacement which aligns every allocation to ALIGN bytes (defaults to 1 cache line).</para>
+	/// <para>e.g. std::vector&lt;float, tpa::aligned_allocator&lt;float&gt;&gt; vec(1'000'000'000);</para>
+	/// <para>A std::vector using it with an ALIGN of at least 64 satisfies tpa::util::aligned_sequence.</para>
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	/// <typeparam name="ALIGN">A power of 2 no smaller than alignof(T)</typeparam>
+	template<typename T, size_t ALIGN = 64uz>
+	requires (std::has_single_bit(ALIGN) && ALIGN >= alignof(T))
+	class aligned_allocator
+	{
+	public:
+		using value_type = T;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+		using propagate_on_container_move_assignment = std::true_type;
+		using is_always_equal = std::true_type;
+
+		static constexpr size_t alignment = ALIGN;
+
+		template<typename U>
+		struct rebind
+		{
+			using other = aligned_allocator<U, ALIGN>;
+		};
+
+		constexpr aligned_allocator() noexcept = default;
+
+		template<typename U>
+		constexpr aligned_allocator(const aligned_allocator<U, ALIGN>&) noexcept {}
+
+		/// <summary>
+		/// <para>Allocates uninitialized storage for 'n' objects of type T aligned to ALIGN bytes.</para>
+		/// </summary>
+		/// <param name="n"></param>
+		/// <returns></returns>
+		[[nodiscard]] T* allocate(const size_t n)
+		{
+			if (n > (std::numeric_limits<size_t>::max() / sizeof(T))) [[unlikely]]
+			{
+				throw std::bad_array_new_length();
+			}//End if
+
+			return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{ ALIGN }));
+		}//End of allocate
+
+		/// <summary>
+		/// <para>Releases storage obtained from allocate().</para>
+		/// </summary>
+		/// <param name="p"></param>
+		/// <param name="n"></param>
+		void deallocate(T* p, const size_t n) noexcept
+		{
+			::operator delete(p, n * sizeof(T), std::align_val_t{ ALIGN });
+		}//End of deallocate
+
+		template<typename U>
+		[[nodiscard]] constexpr bool operator==(const aligned_allocator<U, ALIGN>&) const noexcept
+		{
+			return true;
+		}//End of operator==
+	};//End of aligned_allocator
+}//End of namespace
+
+/// <summary>
+/// <para>Private Namespace for TPA buffer.</para>
+/// <para>Not intended to be used directly.</para>
+/// </summary>
+namespace tpa_buffer_private {
+
+	/// <summary>
+	/// <para>Size of a huge page on x86-64 and ARM-64 Linux.</para>
+	/// </summary>
+	inline constexpr size_t huge_page_bytes = 2uz * 1024uz * 1024uz;
+
+	/// <summary>
+	/// <para>Buffers smaller than this are first-touched by the calling thread alone.</para>
+	/// </summary>
+	inline constexpr size_t parallel_touch_bytes = 1024uz * 1024uz;
+
+	/// <summary>
+	/// <para>Where the memory of a tpa::buffer came from, so that it is released the same way.</para>
+	/// </summary>
+	enum class origin : uint8_t
+	{
+		NONE = 0,
+		HEAP,		//operator new (align_val_t)
+		HUGETLB		//mmap (MAP_HUGETLB)
+	};
+
+	/// <summary>
+	/// <para>Allocates 'bytes' bytes aligned to 'align' bytes, using huge pages if 'policy' requests them and the operating system provides them.</para>
+	/// <para>On Linux MAP_HUGETLB is tried first, then transparent huge pages through madvise(MADV_HUGEPAGE).</para>
+	/// <para>Other platforms only align large requests to the huge page size.</para>
+	/// <para>Throws std::bad_alloc on failure.</para>
+	/// </summary>
+	/// <param name="bytes"></param>
+	/// <param name="align"></param>
+	/// <param name="policy"></param>
+	/// <param name="from">Set to where the memory came from</param>
+	/// <param name="reserved">Set to the number of bytes actually reserved</param>
+	/// <returns></returns>
+	[[nodiscard]] inline void* allocate(const size_t bytes, const size_t align, const tpa::page_policy policy, origin& from, size_t& reserved)
+	{
+#ifdef __linux__
+		if (policy == tpa::page_policy::HUGE_PAGES)
+		{
+			reserved = ((bytes + huge_page_bytes - 1uz) / huge_page_bytes) * huge_page_bytes;
+
+			void* p = mmap(nullptr, reserved, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+			if (p != MAP_FAILED)
+			{
+				from = origin::HUGETLB;
+				return p;
+			}//End if
+
+			//No reserved huge pages, ask for transparent huge pages instead
+			p = ::operator new(reserved, std::align_val_t{ huge_page_bytes });
+			madvise(p, reserved, MADV_HUGEPAGE);
+
+			from = origin::HEAP;
+			return p;
+		}//End if
+#endif
+		reserved = bytes;
+		from = origin::HEAP;
+
+		if (policy == tpa::page_policy::HUGE_PAGES && bytes >= huge_page_bytes)
+		{
+			//Align to the huge page size anyway, the system may still back it with large pages
+			return ::operator new(reserved, std::align_val_t{ huge_page_bytes });
+		}//End if
+
+		return ::operator new(reserved, std::align_val_t{ align });
+	}//End of allocate
+
+	/// <summary>
+	/// <para>Releases memory obtained from tpa_buffer_private::allocate().</para>
+	/// </summary>
+	/// <param name="p"></param>
+	/// <param name="align"></param>
+	/// <param name="policy"></param>
+	/// <param name="from"></param>
+	/// <param name="reserved"></param>
+	inline void release(void* p, const size_t align, const tpa::page_policy policy, const origin from, const size_t reserved) noexcept
+	{
+		if (p == nullptr)
+		{
+			return;
+		}//End if
+#ifdef __linux__
+		if (from == origin::HUGETLB)
+		{
+			munmap(p, reserved);
+			return;
+		}//End if
+
+		if (policy == tpa::page_policy::HUGE_PAGES)
+		{
+			::operator delete(p, std::align_val_t{ huge_page_bytes });
+			return;
+		}//End if
+#endif
+		if (policy == tpa::page_policy::HUGE_PAGES && reserved >= huge_page_bytes)
+		{
+			::operator delete(p, std::align_val_t{ huge_page_bytes });
+			return;
+		}//End if
+
+		::operator delete(p, std::align_val_t{ align });
+	}//End of release
+
+	/// <summary>
+	/// <para>Writes 'val' to [0, count) using the same sections as the TPA algorithms (tpa::util::prepareThreading).</para>
+	/// <para>The operating system maps each page on first write to the memory closest to the writing core, so every thread later finds its own section local.</para>
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	/// <param name="arr"></param>
+	/// <param name="count"></param>
+	/// <param name="val"></param>
+	template<typename T>
+	inline void first_touch(T* arr, const size_t count, const T val)
+	{
+		if ((count * sizeof(T)) < parallel_touch_bytes)
+		{
+			std::uninitialized_fill_n(arr, count, val);
+			return;
+		}//End if
+
+		uint32_t complete = 0;
+
+		std::vector<std::pair<size_t, size_t>> sections;
+		tpa::util::prepareThreading(sections, count);
+
+		std::vector<std::shared_future<uint32_t>> results;
+		results.reserve(tpa::nThreads);
+
+		std::shared_future<uint32_t> temp;
+
+		for (const auto& sec : sections)
+		{
+			temp = tpa::tp->addTask([arr, &val, &sec]()
+				{
+					std::uninitialized_fill(arr + sec.first, arr + sec.second, val);
+
+					return static_cast<uint32_t>(1);
+				});//End of lambda
+
+			results.emplace_back(std::move(temp));
+		}//End for
+
+		for (const auto& fut : results)
+		{
+			complete += fut.get();
+		}//End for
+
+		//Check all threads completed
+		if (complete != tpa::nThreads)
+		{
+			throw tpa::exceptions::NotAllThreadsCompleted(complete);
+		}//End if
+	}//End of first_touch
+}//End of namespace
+
+/// <summary>
+/// <para>Truly Parallel Algorithms</para>
+/// <para>By David Aaron Braun</para>
+/// <para>Version 0.1</para>
+/// </summary>
+namespace tpa {
+
+	/// <summary>
+	/// <para>A fixed size, contiguous array of T aligned to ALIGN bytes (defaults to 1 cache line), intended for very large inputs to the TPA algorithms.</para>
+	/// <para>Every element is written once at construction by the thread pool, in the same sections the algorithms use (parallel first-touch).</para>
+	/// <para>page_policy::HUGE_PAGES backs the buffer with 2 MiB pages where available which greatly reduces TLB misses on billion element inputs.</para>
+	/// <para>Satisfies tpa::util::contiguous_seqeunce and tpa::util::aligned_sequence, algorithms which detect the latter use aligned loads and stores.</para>
+	/// <para>Move only, the size is fixed at construction.</para>
+	/// </summary>
+	/// <typeparam name="T">A trivially copyable type</typeparam>
+	/// <typeparam name="ALIGN">A power of 2 no smaller than alignof(T)</typeparam>
+	template<typename T, size_t ALIGN = 64uz>
+	requires std::is_trivially_copyable<T>::value && (std::has_single_bit(ALIGN) && ALIGN >= alignof(T))
+	class buffer
+	{
+	public:
+		using value_type = T;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+		using reference = T&;
+		using const_reference = const T&;
+		using pointer = T*;
+		using const_pointer = const T*;
+		using iterator = T*;
+		using const_iterator = const T*;
+		using reverse_iterator = std::reverse_iterator<iterator>;
+		using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+		static constexpr size_t alignment = ALIGN;
+
+		constexpr buffer() noexcept = default;
+
+		/// <summary>
+		/// <para>Allocates 'count' value-initialized elements.</para>
+		/// </summary>
+		/// <param name="count"></param>
+		/// <param name="policy"></param>
+		explicit buffer(const size_t count, const tpa::page_policy policy = tpa::page_policy::STANDARD)
+			: buffer(count, T{}, policy) {}
+
+		/// <summary>
+		/// <para>Allocates 'count' elements set to 'val'.</para>
+		/// </summary>
+		/// <param name="count"></param>
+		/// <param name="val"></param>
+		/// <param name="policy"></param>
+		buffer(const size_t count, const T& val, const tpa::page_policy policy = tpa::page_policy::STANDARD)
+			: m_policy(policy)
+		{
+			if (count == 0uz)
+			{
+				return;
+			}//End if
+
+			if (count > (std::numeric_limits<size_t>::max() / sizeof(T))) [[unlikely]]
+			{
+				throw std::bad_array_new_length();
+			}//End if
+
+			m_data = static_cast<T*>(tpa_buffer_private::allocate(count * sizeof(T), ALIGN, policy, m_origin, m_reserved));
+			m_size = count;
+
+			try
+			{
+				tpa_buffer_private::first_touch(m_data, m_size, val);
+			}//End try
+			catch (...)
+			{
+				tpa_buffer_private::release(m_data, ALIGN, m_policy, m_origin, m_reserved);
+				throw;
+			}//End catch
+		}//End of constructor
+
+		buffer(const buffer&) = delete;
+		buffer& operator=(const buffer&) = delete;
+
+		buffer(buffer&& other) noexcept
+			: m_data(std::exchange(other.m_data, nullptr)),
+			m_size(std::exchange(other.m_size, 0uz)),
+			m_reserved(std::exchange(other.m_reserved, 0uz)),
+			m_origin(std::exchange(other.m_origin, tpa_buffer_private::origin::NONE)),
+			m_policy(other.m_policy) {}
+
+		buffer& operator=(buffer&& other) noexcept
+		{
+			if (this != &other)
+			{
+				tpa_buffer_private::release(m_data, ALIGN, m_policy, m_origin, m_reserved);
+
+				m_data = std::exchange(other.m_data, nullptr);
+				m_size = std::exchange(other.m_size, 0uz);
+				m_reserved = std::exchange(other.m_reserved, 0uz);
+				m_origin = std::exchange(other.m_origin, tpa_buffer_private::origin::NONE);
+				m_policy = other.m_policy;
+			}//End if
+
+			return *this;
+		}//End of operator=
+
+		~buffer()
+		{
+			tpa_buffer_private::release(m_data, ALIGN, m_policy, m_origin, m_reserved);
+		}//End of destructor
+
+		[[nodiscard]] constexpr T* data() noexcept { return m_data; }
+		[[nodiscard]] constexpr const T* data() const noexcept { return m_data; }
+
+		[[nodiscard]] constexpr size_t size() const noexcept { return m_size; }
+		[[nodiscard]] constexpr bool empty() const noexcept { return m_size == 0uz; }
+
+		[[nodiscard]] constexpr T& operator[](const size_t index) noexcept { return m_data[index]; }
+		[[nodiscard]] constexpr const T& operator[](const size_t index) const noexcept { return m_data[index]; }
+
+		[[nodiscard]] constexpr T& front() noexcept { return m_data[0]; }
+		[[nodiscard]] constexpr const T& front() const noexcept { return m_data[0]; }
+		[[nodiscard]] constexpr T& back() noexcept { return m_data[m_size - 1uz]; }
+		[[nodiscard]] constexpr const T& back() const noexcept { return m_data[m_size - 1uz]; }
+
+		[[nodiscard]] constexpr iterator begin() noexcept { return m_data; }
+		[[nodiscard]] constexpr const_iterator begin() const noexcept { return m_data; }
+		[[nodiscard]] constexpr const_iterator cbegin() const noexcept { return m_data; }
+		[[nodiscard]] constexpr iterator end() noexcept { return m_data + m_size; }
+		[[nodiscard]] constexpr const_iterator end() const noexcept { return m_data + m_size; }
+		[[nodiscard]] constexpr const_iterator cend() const noexcept { return m_data + m_size; }
+
+		[[nodiscard]] constexpr reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+		[[nodiscard]] constexpr const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+		[[nodiscard]] constexpr reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+		[[nodiscard]] constexpr const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+		/// <summary>
+		/// <para>Returns true if the buffer is backed by reserved huge pages (Linux MAP_HUGETLB).</para>
+		/// <para>Transparent huge pages are granted by the kernel later and are not reported.</para>
+		/// </summary>
+		/// <returns></returns>
+		[[nodiscard]] constexpr bool huge_pages() const noexcept
+		{
+			return m_origin == tpa_buffer_private::origin::HUGETLB;
+		}//End of huge_pages
+
+	private:
+		T* m_data = nullptr;
+		size_t m_size = 0uz;
+		size_t m_reserved = 0uz;
+		tpa_buffer_private::origin m_origin = tpa_buffer_private::origin::NONE;
+		tpa::page_policy m_policy = tpa::page_policy::STANDARD;
+	};//End of buffer
+}//End of namespace
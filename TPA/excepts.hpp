@@ -56,6 +56,8 @@ namespace tpa::error_codes {
 	const char* FP_Underflow = "Floating-Point Underflow!";
 
 	const char* FP_Overflow = "Floating-Point Overflow";
+
+	const char* DivideByZero = "Integer divide by zero!";
 }//End of namespace
 
 /// <summary>
@@ -72,12 +74,20 @@ namespace tpa::exceptions {
 	class FPExceptionDisabler
 	{
 	private:
+#if defined(_MSC_VER) && !defined(__INTEL_COMPILER)
 		unsigned int mOldValues;
+#else
+		fenv_t mOldValues;
+#endif
 	public:
 		FPExceptionDisabler()
 		{
+#if defined(_MSC_VER) && !defined(__INTEL_COMPILER)
 			_controlfp_s(&mOldValues, 0, 0);
 			_controlfp_s(0, _MCW_EM, _MCW_EM);
+#else
+			feholdexcept(&mOldValues);
+#endif
 		}//End constructor
 
 		FPExceptionDisabler(FPExceptionDisabler const&) = delete;
@@ -87,8 +97,13 @@ namespace tpa::exceptions {
 
 		~FPExceptionDisabler()
 		{
+#if defined(_MSC_VER) && !defined(__INTEL_COMPILER)
 			_clearfp();
 			_controlfp_s(0, mOldValues, _MCW_EM);
+#else
+			feclearexcept(FE_ALL_EXCEPT);
+			fesetenv(&mOldValues);
+#endif
 		}//End destructor
 	};//End class
 
@@ -274,6 +289,15 @@ namespace tpa::exceptions {
 		}
 	};
 
+	class DivideByZero : public std::exception
+	{
+	public:
+		virtual const char* what() const throw()
+		{
+			return tpa::error_codes::DivideByZero;
+		}
+	};
+
 	class MismatchedData : public std::exception
 	{
 	public:
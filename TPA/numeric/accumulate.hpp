@@ -30,6 +30,126 @@
 #include "../tpa_concepts.hpp"
 #include "../InstructionSet.hpp"
 #include "../simd/simd.hpp"
+#include "../simd/vec.hpp"
+
+/// <summary>
+/// <para>Private Namespace for the TPA accumulate kernels.</para>
+/// </summary>
+namespace tpa_accumulate_private
+{
+#ifdef TPA_NEON
+    /// <summary>
+    /// <para>Adds the elements of [i, end) to 'res' with 128-bit NEON, 'i' is advanced past the elements processed.</para>
+    /// <para>Integer vectors are summed with a widening reduction (ADDLV) so a single vector cannot overflow before it reaches RETURN_TYPE.</para>
+    /// </summary>
+    template<typename RETURN_TYPE, typename T>
+    requires tpa::simd::is_vec_type<T>
+    inline void accumulate_neon(size_t& i, const size_t end, const T* arr, RETURN_TYPE& res) noexcept
+    {
+        constexpr size_t W = 16uz / sizeof(T);
+
+        for (; (i + W) <= end; i += W)
+        {
+            if constexpr (std::is_same<T, float>::value)
+            {
+                res += static_cast<RETURN_TYPE>(vaddvq_f32(vld1q_f32(&arr[i])));
+            }//End if
+            else if constexpr (std::is_same<T, double>::value)
+            {
+                res += static_cast<RETURN_TYPE>(vaddvq_f64(vld1q_f64(&arr[i])));
+            }//End if
+            else if constexpr (sizeof(T) == 1uz && std::is_signed<T>::value)
+            {
+                res += static_cast<RETURN_TYPE>(vaddlvq_s8(vld1q_s8(reinterpret_cast<const int8_t*>(&arr[i]))));
+            }//End if
+            else if constexpr (sizeof(T) == 1uz)
+            {
+                res += static_cast<RETURN_TYPE>(vaddlvq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(&arr[i]))));
+            }//End if
+            else if constexpr (sizeof(T) == 2uz && std::is_signed<T>::value)
+            {
+                res += static_cast<RETURN_TYPE>(vaddlvq_s16(vld1q_s16(reinterpret_cast<const int16_t*>(&arr[i]))));
+            }//End if
+            else if constexpr (sizeof(T) == 2uz)
+            {
+                res += static_cast<RETURN_TYPE>(vaddlvq_u16(vld1q_u16(reinterpret_cast<const uint16_t*>(&arr[i]))));
+            }//End if
+            else if constexpr (sizeof(T) == 4uz && std::is_signed<T>::value)
+            {
+                res += static_cast<RETURN_TYPE>(vaddlvq_s32(vld1q_s32(reinterpret_cast<const int32_t*>(&arr[i]))));
+            }//End if
+            else if constexpr (sizeof(T) == 4uz)
+            {
+                res += static_cast<RETURN_TYPE>(vaddlvq_u32(vld1q_u32(reinterpret_cast<const uint32_t*>(&arr[i]))));
+            }//End if
+            else if constexpr (std::is_signed<T>::value)
+            {
+                res += static_cast<RETURN_TYPE>(vaddvq_s64(vld1q_s64(reinterpret_cast<const int64_t*>(&arr[i]))));
+            }//End if
+            else
+            {
+                res += static_cast<RETURN_TYPE>(vaddvq_u64(vld1q_u64(reinterpret_cast<const uint64_t*>(&arr[i]))));
+            }//End else
+        }//End for
+    }//End of accumulate_neon
+#endif
+#ifdef TPA_SVE
+    /// <summary>
+    /// <para>Adds the elements of [i, end) to 'res' with SVE at the hardware vector length, the last partial vector is predicated so 'i' always reaches 'end'.</para>
+    /// <para>Integer reductions (UADDV / SADDV) widen to 64 bits.</para>
+    /// </summary>
+    template<typename RETURN_TYPE, typename T>
+    requires tpa::simd::is_vec_type<T>
+    inline void accumulate_sve(size_t& i, const size_t end, const T* arr, RETURN_TYPE& res) noexcept
+    {
+        while (i < end)
+        {
+            if constexpr (std::is_same<T, float>::value)
+            {
+                const svbool_t pg = svwhilelt_b32_u64(i, end);
+                res += static_cast<RETURN_TYPE>(svaddv_f32(pg, svld1_f32(pg, &arr[i])));
+                i += svcntw();
+            }//End if
+            else if constexpr (std::is_same<T, double>::value)
+            {
+                const svbool_t pg = svwhilelt_b64_u64(i, end);
+                res += static_cast<RETURN_TYPE>(svaddv_f64(pg, svld1_f64(pg, &arr[i])));
+                i += svcntd();
+            }//End if
+            else if constexpr (sizeof(T) == 1uz)
+            {
+                const svbool_t pg = svwhilelt_b8_u64(i, end);
+                if constexpr (std::is_signed<T>::value) { res += static_cast<RETURN_TYPE>(svaddv_s8(pg, svld1_s8(pg, reinterpret_cast<const int8_t*>(&arr[i])))); }
+                else { res += static_cast<RETURN_TYPE>(svaddv_u8(pg, svld1_u8(pg, reinterpret_cast<const uint8_t*>(&arr[i])))); }
+                i += svcntb();
+            }//End if
+            else if constexpr (sizeof(T) == 2uz)
+            {
+                const svbool_t pg = svwhilelt_b16_u64(i, end);
+                if constexpr (std::is_signed<T>::value) { res += static_cast<RETURN_TYPE>(svaddv_s16(pg, svld1_s16(pg, reinterpret_cast<const int16_t*>(&arr[i])))); }
+                else { res += static_cast<RETURN_TYPE>(svaddv_u16(pg, svld1_u16(pg, reinterpret_cast<const uint16_t*>(&arr[i])))); }
+                i += svcnth();
+            }//End if
+            else if constexpr (sizeof(T) == 4uz)
+            {
+                const svbool_t pg = svwhilelt_b32_u64(i, end);
+                if constexpr (std::is_signed<T>::value) { res += static_cast<RETURN_TYPE>(svaddv_s32(pg, svld1_s32(pg, reinterpret_cast<const int32_t*>(&arr[i])))); }
+                else { res += static_cast<RETURN_TYPE>(svaddv_u32(pg, svld1_u32(pg, reinterpret_cast<const uint32_t*>(&arr[i])))); }
+                i += svcntw();
+            }//End if
+            else
+            {
+                const svbool_t pg = svwhilelt_b64_u64(i, end);
+                if constexpr (std::is_signed<T>::value) { res += static_cast<RETURN_TYPE>(svaddv_s64(pg, svld1_s64(pg, reinterpret_cast<const int64_t*>(&arr[i])))); }
+                else { res += static_cast<RETURN_TYPE>(svaddv_u64(pg, svld1_u64(pg, reinterpret_cast<const uint64_t*>(&arr[i])))); }
+                i += svcntd();
+            }//End else
+        }//End while
+
+        i = end;
+    }//End of accumulate_sve
+#endif
+}//End of namespace
 
 /// <summary>
 /// <para>Truly Parallel Algorithms</para>
@@ -177,7 +297,7 @@ namespace tpa
                         if constexpr (std::is_same<T, int8_t>())
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512_ByteWord)
+                            if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
                             {
                                 __m512i _sum;
 
@@ -189,20 +309,25 @@ namespace tpa
                                     //Store Result      
                                     temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm512_sum_epi8(_sum));
                                 }//End for
-                            }//End if
-                            else if (tpa::hasAVX2)
+
+                                //Masked tail instead of the scalar remainder
+                                _sum = tpa::simd::vec<T, 64uz / sizeof(T)>::load_partial(arr.data() + i, end - i).reg;
+                                temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm512_sum_epi8(_sum));
+                                i = end;
+                            }();//End if
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 __m256i _sum;
 
                                 for (; (i + 32uz) < end; i += 32uz)
                                 {         
                                     //Load Values
-                                    _sum = _mm256_load_si256((__m256i*) &arr[i]);                                    
+                                    _sum = _mm256_loadu_si256((__m256i*) &arr[i]);                                    
 
                                     //Store Result      
                                     temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm256_sum_epi8(_sum));
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
                             else if (tpa::has_SSE2)
                             {
                                 __m128i _sum;
@@ -210,7 +335,7 @@ namespace tpa
                                 for (; (i + 16uz) < end; i += 16uz)
                                 {
                                     //Load Values
-                                    _sum = _mm_load_si128((__m128i*) &arr[i]);
+                                    _sum = _mm_loadu_si128((__m128i*) &arr[i]);
 
                                     //Store Result      
                                     temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm_sum_epi8(_sum));
@@ -223,7 +348,7 @@ namespace tpa
                         else if constexpr (std::is_same<T, uint8_t>())
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512_ByteWord)
+                            if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
                             {
                                 __m512i _sum;
 
@@ -235,20 +360,25 @@ namespace tpa
                                     //Store Result      
                                     temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm512_sum_epi8(_sum));
                                 }//End for
-                            }//End if
-                            else if (tpa::hasAVX2)
+
+                                //Masked tail instead of the scalar remainder
+                                _sum = tpa::simd::vec<T, 64uz / sizeof(T)>::load_partial(arr.data() + i, end - i).reg;
+                                temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm512_sum_epi8(_sum));
+                                i = end;
+                            }();//End if
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 __m256i _sum;
 
                                 for (; (i + 32uz) < end; i += 32uz)
                                 {
                                     //Load Values
-                                    _sum = _mm256_load_si256((__m256i*) & arr[i]);
+                                    _sum = _mm256_loadu_si256((__m256i*) & arr[i]);
 
                                     //Store Result      
                                     temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm256_sum_epi8(_sum));
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
                             else if (tpa::has_SSE2)
                             {
                                 __m128i _sum;
@@ -256,7 +386,7 @@ namespace tpa
                                 for (; (i + 16uz) < end; i += 16uz)
                                 {
                                     //Load Values
-                                    _sum = _mm_load_si128((__m128i*) & arr[i]);
+                                    _sum = _mm_loadu_si128((__m128i*) & arr[i]);
 
                                     //Store Result      
                                     temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm_sum_epi8(_sum));
@@ -269,7 +399,7 @@ namespace tpa
                         else if constexpr (std::is_same<T, int16_t>())
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX512_ByteWord)
+                            if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
                             {
                                 __m512i _sum;
 
@@ -281,20 +411,25 @@ namespace tpa
                                     //Store Result      
                                     temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm512_sum_epi16(_sum));
                                 }//End for
-                            }//End if
-                            else if (tpa::hasAVX2)
+
+                                //Masked tail instead of the scalar remainder
+                                _sum = tpa::simd::vec<T, 64uz / sizeof(T)>::load_partial(arr.data() + i, end - i).reg;
+                                temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm512_sum_epi16(_sum));
+                                i = end;
+                            }();//End if
+                            else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 __m256i _sum;
 
                                 for (; (i + 16uz) < end; i += 16uz)
                                 {
                                     //Load Values
-                                    _sum = _mm256_load_si256((__m256i*) &arr[i]);
+                                    _sum = _mm256_loadu_si256((__m256i*) &arr[i]);
 
                                     //Store Result      
                                     temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm256_sum_epi16(_sum));
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
                             else if (tpa::has_SSE2)
                             {
                                 __m128i _sum;
@@ -302,7 +437,7 @@ namespace tpa
                                 for (; (i + 8uz) < end; i += 8uz)
                                 {
                                     //Load Values
-                                    _sum = _mm_load_si128((__m128i*) & arr[i]);
+                                    _sum = _mm_loadu_si128((__m128i*) & arr[i]);
 
                                     //Store Result      
                                     temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm_sum_epi16(_sum));
@@ -315,7 +450,7 @@ namespace tpa
                         else if constexpr (std::is_same<T, uint16_t>())
                         {
 #ifdef TPA_X86_64
-                        if (tpa::hasAVX512_ByteWord)
+                        if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
                         {
                             __m512i _sum;
 
@@ -327,20 +462,25 @@ namespace tpa
                                 //Store Result      
                                 temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm512_sum_epi16(_sum));
                             }//End for
-                        }//End if
-                        else if (tpa::hasAVX2)
+
+                            //Masked tail instead of the scalar remainder
+                            _sum = tpa::simd::vec<T, 64uz / sizeof(T)>::load_partial(arr.data() + i, end - i).reg;
+                            temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm512_sum_epi16(_sum));
+                            i = end;
+                        }();//End if
+                        else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                         {
                             __m256i _sum;
 
                             for (; (i + 16uz) < end; i += 16uz)
                             {
                                 //Load Values
-                                _sum = _mm256_load_si256((__m256i*) & arr[i]);
+                                _sum = _mm256_loadu_si256((__m256i*) & arr[i]);
 
                                 //Store Result      
                                 temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm256_sum_epi16(_sum));
                             }//End for
-                        }//End if hasAVX2
+                        }();//End if hasAVX2
                         else if (tpa::has_SSE2)
                         {
                             __m128i _sum;
@@ -348,7 +488,7 @@ namespace tpa
                             for (; (i + 8uz) < end; i += 8uz)
                             {
                                 //Load Values
-                                _sum = _mm_load_si128((__m128i*) & arr[i]);
+                                _sum = _mm_loadu_si128((__m128i*) & arr[i]);
 
                                 //Store Result      
                                 temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm_sum_epi16(_sum));
@@ -361,32 +501,37 @@ namespace tpa
                         else if constexpr (std::is_same<T, int32_t>())
                         {
 #ifdef TPA_X86_64
-                        if (tpa::hasAVX512)
+                        if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                         {
                             __m512i _sum;
 
                             for (; (i + 16uz) < end; i += 16uz)
                             {
                                 //Load Values
-                                _sum = _mm512_load_epi32(&arr[i]);
+                                _sum = _mm512_loadu_epi32(&arr[i]);
 
                                 //Store Result      
                                 temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm512_sum_epi32(_sum));
                             }//End for
-                        }//End if
-                        else if (tpa::hasAVX2)
+
+                            //Masked tail instead of the scalar remainder
+                            _sum = tpa::simd::vec<T, 64uz / sizeof(T)>::load_partial(arr.data() + i, end - i).reg;
+                            temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm512_sum_epi32(_sum));
+                            i = end;
+                        }();//End if
+                        else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                         {
                             __m256i _sum;
 
                             for (; (i + 8uz) < end; i += 8uz)
                             {
                                 //Load Values
-                                _sum = _mm256_load_si256((__m256i*) & arr[i]);
+                                _sum = _mm256_loadu_si256((__m256i*) & arr[i]);
 
                                 //Store Result      
                                 temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm256_sum_epi32(_sum));
                             }//End for
-                        }//End if hasAVX2
+                        }();//End if hasAVX2
                         else if (tpa::has_SSE2)
                         {
                             __m128i _sum;
@@ -394,7 +539,7 @@ namespace tpa
                             for (; (i + 4uz) < end; i += 4uz)
                             {
                                 //Load Values
-                                _sum = _mm_load_si128((__m128i*) & arr[i]);
+                                _sum = _mm_loadu_si128((__m128i*) & arr[i]);
 
                                 //Store Result      
                                 temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm_sum_epi32(_sum));
@@ -407,32 +552,37 @@ namespace tpa
                         else if constexpr (std::is_same<T, uint32_t>() == true)
                         {
 #ifdef TPA_X86_64
-                        if (tpa::hasAVX512)
+                        if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                         {
                             __m512i _sum;
 
                             for (; (i + 16uz) < end; i += 16uz)
                             {
                                 //Load Values
-                                _sum = _mm512_load_epi32(&arr[i]);
+                                _sum = _mm512_loadu_epi32(&arr[i]);
 
                                 //Store Result      
                                 temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm512_sum_epi32(_sum));
                             }//End for
-                        }//End if
-                        else if (tpa::hasAVX2)
+
+                            //Masked tail instead of the scalar remainder
+                            _sum = tpa::simd::vec<T, 64uz / sizeof(T)>::load_partial(arr.data() + i, end - i).reg;
+                            temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm512_sum_epi32(_sum));
+                            i = end;
+                        }();//End if
+                        else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                         {
                             __m256i _sum;
 
                             for (; (i + 8uz) < end; i += 8uz)
                             {
                                 //Load Values
-                                _sum = _mm256_load_si256((__m256i*) & arr[i]);
+                                _sum = _mm256_loadu_si256((__m256i*) & arr[i]);
 
                                 //Store Result      
                                 temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm256_sum_epi32(_sum));
                             }//End for
-                        }//End if hasAVX2
+                        }();//End if hasAVX2
                         else if (tpa::has_SSE2)
                         {
                             __m128i _sum;
@@ -440,7 +590,7 @@ namespace tpa
                             for (; (i + 4uz) < end; i += 4uz)
                             {
                                 //Load Values
-                                _sum = _mm_load_si128((__m128i*) & arr[i]);
+                                _sum = _mm_loadu_si128((__m128i*) & arr[i]);
 
                                 //Store Result      
                                 temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm_sum_epi32(_sum));
@@ -453,32 +603,37 @@ namespace tpa
                         else if constexpr (std::is_same<T, int64_t>())
                         {
 #ifdef TPA_X86_64
-                        if (tpa::hasAVX512)
+                        if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                         {
                             __m512i _sum;
 
                             for (; (i + 8uz) < end; i += 8uz)
                             {
                                 //Load Values
-                                _sum = _mm512_load_epi64(&arr[i]);
+                                _sum = _mm512_loadu_epi64(&arr[i]);
 
                                 //Store Result      
                                 temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm512_sum_epi64(_sum));
                             }//End for
-                        }//End if
-                        else if (tpa::hasAVX2)
+
+                            //Masked tail instead of the scalar remainder
+                            _sum = tpa::simd::vec<T, 64uz / sizeof(T)>::load_partial(arr.data() + i, end - i).reg;
+                            temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm512_sum_epi64(_sum));
+                            i = end;
+                        }();//End if
+                        else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                         {
                             __m256i _sum;
 
                             for (; (i + 4uz) < end; i += 4uz)
                             {
                                 //Load Values
-                                _sum = _mm256_load_si256((__m256i*) & arr[i]);
+                                _sum = _mm256_loadu_si256((__m256i*) & arr[i]);
 
                                 //Store Result      
                                 temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm256_sum_epi64(_sum));
                             }//End for
-                        }//End if hasAVX2
+                        }();//End if hasAVX2
                         else if (tpa::has_SSE2)
                         {
                             __m128i _sum;
@@ -486,7 +641,7 @@ namespace tpa
                             for (; (i + 2uz) < end; i += 2uz)
                             {
                                 //Load Values
-                                _sum = _mm_load_si128((__m128i*) & arr[i]);
+                                _sum = _mm_loadu_si128((__m128i*) & arr[i]);
 
                                 //Store Result      
                                 temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm_sum_epi64(_sum));
@@ -499,32 +654,37 @@ namespace tpa
                         else if constexpr (std::is_same<T, uint64_t>())
                         {
 #ifdef TPA_X86_64
-                        if (tpa::hasAVX512)
+                        if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                         {
                             __m512i _sum;
 
                             for (; (i + 8uz) < end; i += 8uz)
                             {
                                 //Load Values
-                                _sum = _mm512_load_epi64(&arr[i]);
+                                _sum = _mm512_loadu_epi64(&arr[i]);
 
                                 //Store Result      
                                 temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm512_sum_epi64(_sum));
                             }//End for
-                        }//End if
-                        else if (tpa::hasAVX2)
+
+                            //Masked tail instead of the scalar remainder
+                            _sum = tpa::simd::vec<T, 64uz / sizeof(T)>::load_partial(arr.data() + i, end - i).reg;
+                            temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm512_sum_epi64(_sum));
+                            i = end;
+                        }();//End if
+                        else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                         {
                             __m256i _sum;
 
                             for (; (i + 4uz) < end; i += 4uz)
                             {
                                 //Load Values
-                                _sum = _mm256_load_si256((__m256i*) & arr[i]);
+                                _sum = _mm256_loadu_si256((__m256i*) & arr[i]);
 
                                 //Store Result      
                                 temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm256_sum_epi64(_sum));
                             }//End for
-                        }//End if hasAVX2
+                        }();//End if hasAVX2
                         else if (tpa::has_SSE2)
                         {
                             __m128i _sum;
@@ -532,7 +692,7 @@ namespace tpa
                             for (; (i + 2uz) < end; i += 2uz)
                             {
                                 //Load Values
-                                _sum = _mm_load_si128((__m128i*) & arr[i]);
+                                _sum = _mm_loadu_si128((__m128i*) & arr[i]);
 
                                 //Store Result      
                                 temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm_sum_epi64(_sum));
@@ -545,32 +705,37 @@ namespace tpa
                     else if constexpr (std::is_same<T, float>())
                     {
 #ifdef TPA_X86_64
-                    if (tpa::hasAVX512)
+                    if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                     {
                         __m512 _sum;
 
                         for (; (i + 16uz) < end; i += 16uz)
                         {
                             //Load Values
-                            _sum = _mm512_load_ps(&arr[i]);
+                            _sum = _mm512_loadu_ps(&arr[i]);
 
                             //Store Result      
                             temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm512_sum_ps(_sum));
                         }//End for
-                    }//End if
-                    else if (tpa::hasAVX2)
+
+                        //Masked tail instead of the scalar remainder
+                        _sum = tpa::simd::vec<T, 64uz / sizeof(T)>::load_partial(arr.data() + i, end - i).reg;
+                        temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm512_sum_ps(_sum));
+                        i = end;
+                    }();//End if
+                    else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                     {
                         __m256 _sum;
 
                         for (; (i + 8uz) < end; i += 8uz)
                         {
                             //Load Values
-                            _sum = _mm256_load_ps(&arr[i]);
+                            _sum = _mm256_loadu_ps(&arr[i]);
 
                             //Store Result      
                             temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm256_sum_ps(_sum));
                         }//End for
-                    }//End if hasAVX2
+                    }();//End if hasAVX2
                     else if (tpa::has_SSE)
                     {
                         __m128 _sum;
@@ -578,7 +743,7 @@ namespace tpa
                         for (; (i + 4uz) < end; i += 4uz)
                         {
                             //Load Values
-                            _sum = _mm_load_ps( &arr[i]);
+                            _sum = _mm_loadu_ps( &arr[i]);
 
                             //Store Result      
                             temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm_sum_ps(_sum));
@@ -591,32 +756,37 @@ namespace tpa
                     else if constexpr (std::is_same<T, double>())
                     {
 #ifdef TPA_X86_64
-                    if (tpa::hasAVX512)
+                    if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
                     {
                         __m512d _sum;
 
                         for (; (i + 8uz) < end; i += 8uz)
                         {
                             //Load Values
-                            _sum = _mm512_load_pd(&arr[i]);
+                            _sum = _mm512_loadu_pd(&arr[i]);
 
                             //Store Result      
                             temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm512_sum_pd(_sum));
                         }//End for
-                    }//End if
-                    else if (tpa::hasAVX2)
+
+                        //Masked tail instead of the scalar remainder
+                        _sum = tpa::simd::vec<T, 64uz / sizeof(T)>::load_partial(arr.data() + i, end - i).reg;
+                        temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm512_sum_pd(_sum));
+                        i = end;
+                    }();//End if
+                    else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                     {
                         __m256d _sum;
 
                         for (; (i + 4uz) < end; i += 4uz)
                         {
                             //Load Values
-                            _sum = _mm256_load_pd(&arr[i]);
+                            _sum = _mm256_loadu_pd(&arr[i]);
 
                             //Store Result      
                             temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm256_sum_pd(_sum));
                         }//End for
-                    }//End if hasAVX2
+                    }();//End if hasAVX2
                     else if (tpa::has_SSE2)
                     {
                         __m128d _sum;
@@ -624,7 +794,7 @@ namespace tpa
                         for (; (i + 2uz) < end; i += 2uz)
                         {
                             //Load Values
-                            _sum = _mm_load_pd(&arr[i]);
+                            _sum = _mm_loadu_pd(&arr[i]);
 
                             //Store Result      
                             temp_val += static_cast<RETURN_TYPE>(tpa::simd::_mm_sum_pd(_sum));
@@ -633,6 +803,22 @@ namespace tpa
 #endif
                     }//End if
 #pragma endregion
+#pragma region neon
+#ifdef TPA_SVE
+                    if constexpr (tpa::simd::is_vec_type<T>)
+                    {
+                        tpa_accumulate_private::accumulate_sve<RETURN_TYPE, T>(i, end, arr.data(), temp_val);
+                    }//End if
+#elif defined(TPA_NEON)
+                    if constexpr (tpa::simd::is_vec_type<T>)
+                    {
+                        if (tpa::hasNeon)
+                        {
+                            tpa_accumulate_private::accumulate_neon<RETURN_TYPE, T>(i, end, arr.data(), temp_val);
+                        }//End if
+                    }//End if
+#endif
+#pragma endregion
 #pragma region generic      
                     for (; i != end; ++i)
                     {                    
@@ -0,0 +1,238 @@
+#pragma once
+/*
+* Truly Parallel Algorithms Library - Numeric - inner_product function
+* By: David Aaron Braun
+* 2022-08-12
+* Parallel implementation of inner_product
+*/
+
+/*
+*           Copyright David Aaron Braun 2021 - .
+*   Distributed under the Boost Software License, Version 1.0.
+*       (See accompanying file LICENSE_1_0.txt or copy at
+*           https://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <iostream>
+#include <future>
+#include <utility>
+#include <type_traits>
+#include <vector>
+
+#include "../tpa.hpp"
+#include "../excepts.hpp"
+#include "../size_t_lit.hpp"
+#include "../tpa_macros.hpp"
+#include "../tpa_concepts.hpp"
+#include "../InstructionSet.hpp"
+#include "../simd/simd.hpp"
+
+namespace tpa_inner_product_private
+{
+#ifdef TPA_X86_64
+    /// <summary>
+    /// <para>Adds the 16 32-bit lanes of 'x' to 'sum' without overflowing 32 bits.</para>
+    /// </summary>
+    inline void flush_epi32(__m512i& x, int64_t& sum) noexcept
+    {
+        sum += _mm512_reduce_add_epi64(_mm512_cvtepi32_epi64(_mm512_castsi512_si256(x)));
+        sum += _mm512_reduce_add_epi64(_mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(x, 1)));
+        x = _mm512_setzero_si512();
+    }//End of flush_epi32
+
+    /// <summary>
+    /// <para>Sum of a[i] * b[i] over [i, end) for 8-bit integers using AVX-512 VNNI (VPDPBUSD), 'i' is advanced past the elements processed.</para>
+    /// <para>VPDPBUSD multiplies unsigned by signed bytes, so one operand is offset by 128 and the offset is removed from the total afterwards.</para>
+    /// <para>Warning: This function is unsafe if called on a platform without AVX-512 BW and AVX-512 VNNI.</para>
+    /// </summary>
+    template<typename T>
+    requires std::is_same<T, int8_t>::value || std::is_same<T, uint8_t>::value
+    [[nodiscard]] inline int64_t dot_vnni(size_t& i, const size_t end, const T* a, const T* b) noexcept
+    {
+        //4 products of at most 255 * 128 per lane per step, flush well before 32-bit lanes can overflow
+        constexpr size_t flush_every = 8192uz;
+
+        const __m512i _bias = _mm512_set1_epi8(static_cast<char>(0x80));
+        const __m512i _ones = _mm512_set1_epi8(1);
+
+        __m512i _dot = _mm512_setzero_si512();
+        __m512i _offset = _mm512_setzero_si512();
+
+        int64_t dot = 0;
+        int64_t offset = 0;
+        size_t steps = 0uz;
+
+        for (; (i + 64uz) < end; i += 64uz)
+        {
+            const __m512i _a = _mm512_loadu_si512(&a[i]);
+            const __m512i _b = _mm512_loadu_si512(&b[i]);
+
+            if constexpr (std::is_same<T, int8_t>())
+            {
+                //(a + 128) * b - 128 * b
+                _dot = _mm512_dpbusd_epi32(_dot, _mm512_xor_si512(_a, _bias), _b);
+                _offset = _mm512_dpbusd_epi32(_offset, _ones, _b);
+            }//End if
+            else
+            {
+                //a * (b - 128) + 128 * a
+                _dot = _mm512_dpbusd_epi32(_dot, _a, _mm512_xor_si512(_b, _bias));
+                _offset = _mm512_add_epi64(_offset, _mm512_sad_epu8(_a, _mm512_setzero_si512()));
+            }//End else
+
+            if (++steps == flush_every) [[unlikely]]
+            {
+                tpa_inner_product_private::flush_epi32(_dot, dot);
+
+                if constexpr (std::is_same<T, int8_t>())
+                {
+                    tpa_inner_product_private::flush_epi32(_offset, offset);
+                }//End if
+
+                steps = 0uz;
+            }//End if
+        }//End for
+
+        tpa_inner_product_private::flush_epi32(_dot, dot);
+
+        if constexpr (std::is_same<T, int8_t>())
+        {
+            tpa_inner_product_private::flush_epi32(_offset, offset);
+            return dot - (offset * 128ll);
+        }//End if
+        else
+        {
+            offset = _mm512_reduce_add_epi64(_offset);
+            return dot + (offset * 128ll);
+        }//End else
+    }//End of dot_vnni
+#endif
+}//End of namespace
+
+/// <summary>
+/// <para>Truly Parallel Algorithms</para>
+/// <para>By David Aaron Braun</para>
+/// <para>Version 0.1</para>
+/// </summary>
+namespace tpa
+{
+    /// <summary>
+    /// <para>Computes the sum of the products of the elements of 'a' and 'b' (the dot product).</para>
+    /// <para>Only computes up to the size of the smallest container.</para>
+    /// <para>Products are computed and summed in RETURN_TYPE, except for 8-bit integers which are summed in 64 bits and then converted.</para>
+    /// <para>8-bit integers use AVX-512 VNNI where available.</para>
+    /// </summary>
+    /// <typeparam name="RETURN_TYPE"></typeparam>
+    /// <typeparam name="CONTAINER_A"></typeparam>
+    /// <typeparam name="CONTAINER_B"></typeparam>
+    /// <param name="a"></param>
+    /// <param name="b"></param>
+    /// <returns></returns>
+    template<typename RETURN_TYPE, typename CONTAINER_A, typename CONTAINER_B>
+    [[nodiscard]] inline RETURN_TYPE inner_product(const CONTAINER_A& a, const CONTAINER_B& b)
+    requires tpa::util::contiguous_seqeunce<CONTAINER_A> && tpa::util::contiguous_seqeunce<CONTAINER_B>
+    {
+        try
+        {
+            static_assert(std::is_same<typename CONTAINER_A::value_type, typename CONTAINER_B::value_type>(),
+                "Compile Error! The source containers must be of the same value type!");
+
+            using T = CONTAINER_A::value_type;
+            uint32_t complete = 0u;
+
+            RETURN_TYPE sum = 0;
+
+            const size_t smallest = tpa::util::min(a.size(), b.size());
+
+            std::vector<std::pair<size_t, size_t>> sections;
+            tpa::util::prepareThreading(sections, smallest);
+
+            std::vector<std::shared_future<RETURN_TYPE>> results;
+            results.reserve(tpa::nThreads);
+
+            std::shared_future<RETURN_TYPE> temp;
+
+            for (const auto& sec : sections)
+            {
+                temp = tpa::tp->addTask([&a, &b, &sec]()
+                {
+                    const size_t beg = sec.first;
+                    const size_t end = sec.second;
+                    size_t i = beg;
+
+                    RETURN_TYPE temp_val = 0;
+#pragma region byte
+                    if constexpr (std::is_same<T, int8_t>() || std::is_same<T, uint8_t>())
+                    {
+                        int64_t dot = 0;
+#ifdef TPA_X86_64
+                        if (tpa::hasAVX512_VNNI && tpa::hasAVX512_ByteWord)
+                        {
+                            dot = tpa_inner_product_private::dot_vnni<T>(i, end, &a[0], &b[0]);
+                        }//End if
+#endif
+                        for (; i != end; ++i)
+                        {
+                            dot += static_cast<int64_t>(a[i]) * static_cast<int64_t>(b[i]);
+                        }//End for
+
+                        temp_val = static_cast<RETURN_TYPE>(dot);
+                    }//End if
+#pragma endregion
+#pragma region generic
+                    else
+                    {
+                        for (; i != end; ++i)
+                        {
+                            temp_val += static_cast<RETURN_TYPE>(a[i]) * static_cast<RETURN_TYPE>(b[i]);
+                        }//End for
+                    }//End else
+#pragma endregion
+
+                    return temp_val;
+                });//End of lambda
+
+                results.emplace_back(std::move(temp));
+            }//End for
+
+            for (const auto& fut : results)
+            {
+                sum += fut.get();
+                complete += 1;
+            }//End for
+
+            //Check all threads completed
+            if (complete != tpa::nThreads)
+            {
+                throw tpa::exceptions::NotAllThreadsCompleted(complete);
+            }//End if
+
+            return sum;
+        }//End try
+        catch (const std::future_error& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::inner_product(): " << ex.code()
+                << " " << ex.what() << "\n";
+            return static_cast<RETURN_TYPE>(0);
+        }//End catch
+        catch (const std::bad_alloc& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::inner_product(): " << ex.what() << "\n";
+            return static_cast<RETURN_TYPE>(0);
+        }//End catch
+        catch (const std::exception& ex)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::inner_product(): " << ex.what() << "\n";
+            return static_cast<RETURN_TYPE>(0);
+        }//End catch
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+            std::cerr << "Exception thrown in tpa::inner_product(): unknown!\n";
+            return static_cast<RETURN_TYPE>(0);
+        }//End catch
+    }//End of inner_product
+}//End of namespace
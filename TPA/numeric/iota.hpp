@@ -28,6 +28,104 @@
 #include "../tpa_concepts.hpp"
 #include "../InstructionSet.hpp"
 #include "../simd/simd.hpp"
+#include "../simd/vec.hpp"
+#include "../simd/dispatch.hpp"
+
+/// <summary>
+/// <para>Private Namespace for TPA iota.</para>
+/// <para>Not intended to be used directly.</para>
+/// </summary>
+namespace tpa_iota_private {
+
+    /// <summary>
+    /// <para>Scalar iota of [i, end), also used to finish the leftovers of the streaming kernels.</para>
+    /// </summary>
+    template<typename T>
+    inline void iota_scalar(size_t i, const size_t end, T* arr, const T value) noexcept
+    {
+        for (; i != end; ++i)
+        {
+            arr[i] = static_cast<T>(value + i);
+        }//End for
+    }//End of iota_scalar
+
+    /// <summary>
+    /// <para>Writes value + index to [i, end) with BYTES-wide non-temporal stores, which bypass the cache and skip the read-for-ownership of each line.</para>
+    /// <para>Streaming stores must be aligned so a scalar head is peeled to a BYTES boundary, if 'arr' can never reach one the scalar kernel is used.</para>
+    /// </summary>
+    template<size_t BYTES, typename T>
+    TPA_FORCE_INLINE void iota_stream(size_t i, const size_t end, T* arr, const T value) noexcept
+    {
+        using V = tpa::simd::vec<T, BYTES / sizeof(T)>;
+
+        const size_t head = tpa::simd::align_index<BYTES>(i, end, arr);
+        tpa_iota_private::iota_scalar(i, head, arr, value);
+
+        i = head;
+
+        if ((reinterpret_cast<uintptr_t>(arr + i) & (BYTES - 1uz)) == 0uz)
+        {
+            T ramp[V::width];
+
+            for (size_t k = 0uz; k != V::width; ++k)
+            {
+                ramp[k] = static_cast<T>(k);
+            }//End for
+
+            const V _Ramp = V::load(ramp);
+
+            for (; (i + V::width) <= end; i += V::width)
+            {
+                (V(static_cast<T>(value + i)) + _Ramp).store_stream(arr + i);
+            }//End for
+
+            tpa::simd::stream_fence();
+        }//End if
+
+        tpa_iota_private::iota_scalar(i, end, arr, value);
+    }//End of iota_stream
+
+#ifdef TPA_X86_64
+    template<typename T>
+    TPA_TARGET_SSE41 inline void iota_stream_sse41(size_t i, const size_t end, T* arr, const T value) noexcept
+    {
+        tpa_iota_private::iota_stream<16uz>(i, end, arr, value);
+    }//End of iota_stream_sse41
+
+    template<typename T>
+    TPA_TARGET_AVX2 inline void iota_stream_avx2(size_t i, const size_t end, T* arr, const T value) noexcept
+    {
+        tpa_iota_private::iota_stream<32uz>(i, end, arr, value);
+    }//End of iota_stream_avx2
+
+    template<typename T>
+    TPA_TARGET_AVX512 inline void iota_stream_avx512(size_t i, const size_t end, T* arr, const T value) noexcept
+    {
+        tpa_iota_private::iota_stream<64uz>(i, end, arr, value);
+    }//End of iota_stream_avx512
+#endif
+
+    /// <summary>
+    /// <para>Returns the streaming iota kernels for this hardware, built once per value type.</para>
+    /// <para>NEON has no non-temporal store intrinsic, ARM writes through the cache with 128-bit stores.</para>
+    /// </summary>
+    template<typename T>
+    [[nodiscard]] inline auto iota_stream_kernels() noexcept
+    {
+        tpa::simd::kernel_table<void(size_t, const size_t, T*, const T)> table;
+        table.scalar = &tpa_iota_private::iota_scalar<T>;
+
+#ifdef TPA_X86_64
+        table.sse41 = &tpa_iota_private::iota_stream_sse41<T>;
+        table.avx2 = &tpa_iota_private::iota_stream_avx2<T>;
+        table.avx512 = &tpa_iota_private::iota_stream_avx512<T>;
+#elif defined(TPA_NEON)
+        table.neon = &tpa_iota_private::iota_stream<16uz, T>;
+#endif
+
+        return table;
+    }//End of iota_stream_kernels
+}//End of namespace
 
 /// <summary>
 /// <para>Truly Parallel Algorithms</para>
@@ -38,20 +136,24 @@ namespace tpa
 {
 #pragma region generic
     /// <summary>
-    /// Fills the range [first, last) with sequentially increasing values, starting with specified value and repetitively evaluating ++value.
+    /// <para>Fills the range [first, last) with sequentially increasing values, starting with specified value and repetitively evaluating ++value.</para>
+    /// <para>Containers of at least 'stream_threshold' bytes are written with non-temporal stores so that they do not evict the cache.</para>
     /// </summary>
     /// <typeparam name="CONTAINER_T"></typeparam>
     /// <typeparam name="T"></typeparam>
     /// <param name="CONTAINER_T"></param>
     /// <param name="value"></param>
+    /// <param name="stream_threshold"> - optional defaults to tpa::simd::stream_min_bytes (the last level cache size)</param>
     template <typename CONTAINER, typename T = CONTAINER::value_type>
-    inline constexpr void iota(CONTAINER& arr, const T value = 0)
+    inline constexpr void iota(CONTAINER& arr, const T value = 0, const size_t stream_threshold = tpa::simd::stream_min_bytes)
         requires tpa::util::contiguous_seqeunce<CONTAINER>
     {
         try
         {
             uint32_t complete = 0u;
 
+            const bool stream = (arr.size() * sizeof(T)) >= stream_threshold;
+
             std::vector<std::pair<size_t, size_t>> sections;
             tpa::util::prepareThreading(sections, arr.size());
 
@@ -62,18 +164,33 @@ namespace tpa
 
             for (const auto& sec : sections)
             {
-                temp = tpa::tp->addTask([&arr, &value, &sec]()
+                temp = tpa::tp->addTask([&arr, &value, &sec, stream]()
                     {
                         const size_t beg = sec.first;
                         const size_t end = sec.second;
                         size_t i = beg;
                         T val = 0;
 
+#pragma region stream
+                        if constexpr (tpa::simd::is_vec_type<T> && std::is_same<T, typename CONTAINER::value_type>::value)
+                        {
+                            if (stream)
+                            {
+                                //Built on first use, not per call
+                                static const auto stream_kernels = tpa_iota_private::iota_stream_kernels<T>();
+
+                                stream_kernels.resolve_for((end - i) * sizeof(T))(i, end, &arr[0], value);
+
+                                return static_cast<uint32_t>(1);
+                            }//End if
+                        }//End if
+#pragma endregion
+
 #pragma region byte
                         if constexpr (std::is_same<T, int8_t>())
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX2)
+                            if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _adder =
                                     _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31);
@@ -88,9 +205,9 @@ namespace tpa
 
                                     _Res = _mm256_add_epi8(_Val, _adder);
 
-                                    _mm256_store_si256((__m256i*) &arr[i], _Res);
+                                    _mm256_storeu_si256((__m256i*) &arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                         }//End if
 #pragma endregion
@@ -98,7 +215,7 @@ namespace tpa
                         else if constexpr (std::is_same<T, uint8_t>() == true)
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX2)
+                            if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _adder =
                                     _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31);
@@ -118,9 +235,9 @@ namespace tpa
 
                                     _Res = _mm256_add_epi8(_Val, _adder);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _Res);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                         }//End if
 #pragma endregion
@@ -128,7 +245,7 @@ namespace tpa
                         else if constexpr (std::is_same<T, int16_t>() == true)
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX2)
+                            if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _adder =
                                     _mm256_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
@@ -148,9 +265,9 @@ namespace tpa
 
                                     _Res = _mm256_add_epi16(_Val, _adder);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _Res);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                         }//End if
 #pragma endregion
@@ -158,7 +275,7 @@ namespace tpa
                         else if constexpr (std::is_same<T, uint16_t>() == true)
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX2)
+                            if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _adder =
                                     _mm256_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
@@ -178,9 +295,9 @@ namespace tpa
 
                                     _Res = _mm256_add_epi16(_Val, _adder);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _Res);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                         }//End if
 #pragma endregion
@@ -188,7 +305,7 @@ namespace tpa
                         else if constexpr (std::is_same<T, int32_t>() == true)
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX2)
+                            if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _adder =
                                     _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
@@ -208,9 +325,9 @@ namespace tpa
 
                                     _Res = _mm256_add_epi32(_Val, _adder);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _Res);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                         }//End if
 #pragma endregion
@@ -218,7 +335,7 @@ namespace tpa
                         else if constexpr (std::is_same<T, uint32_t>() == true)
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX2)
+                            if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _adder =
                                     _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
@@ -238,9 +355,9 @@ namespace tpa
 
                                     _Res = _mm256_add_epi32(_Val, _adder);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _Res);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                         }//End if
 #pragma endregion
@@ -248,7 +365,7 @@ namespace tpa
                         else if constexpr (std::is_same<T, int64_t>() == true)
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX2)
+                            if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _adder = _mm256_setr_epi64x(0ll, 1ll, 2ll, 3ll);
 
@@ -267,9 +384,9 @@ namespace tpa
 
                                     _Res = _mm256_add_epi64(_Val, _adder);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _Res);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _Res);
                                 }//End for
-                            }//End if has AVX2
+                            }();//End if has AVX2
 #endif
                         }//End if
 #pragma endregion
@@ -277,7 +394,7 @@ namespace tpa
                         else if constexpr (std::is_same<T, uint64_t>() == true)
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX2)
+                            if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
                             {
                                 const __m256i _adder = _mm256_setr_epi64x(0ull, 1ull, 2ull, 3ull);
 
@@ -296,9 +413,9 @@ namespace tpa
 
                                     _Res = _mm256_add_epi64(_Val, _adder);
 
-                                    _mm256_store_si256((__m256i*) & arr[i], _Res);
+                                    _mm256_storeu_si256((__m256i*) & arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX2
+                            }();//End if hasAVX2
 #endif
                         }//End if
 #pragma endregion
@@ -306,7 +423,7 @@ namespace tpa
                         else if constexpr (std::is_same<T, float>() == true)
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX)
+                            if (tpa::hasAVX) [&]() TPA_TARGET("avx")
                             {
                                 const __m256 _adder = _mm256_setr_ps(
                                     0.f,
@@ -333,9 +450,9 @@ namespace tpa
 
                                     _Res = _mm256_add_ps(_Val, _adder);
 
-                                    _mm256_store_ps(&arr[i], _Res);
+                                    _mm256_storeu_ps(&arr[i], _Res);
                                 }//End for
-                            }//Endf if hasAVX
+                            }();//Endf if hasAVX
 #endif
                         }//End if
 #pragma endregion
@@ -343,7 +460,7 @@ namespace tpa
                         else if constexpr (std::is_same<T, double>() == true)
                         {
 #ifdef TPA_X86_64
-                            if (tpa::hasAVX)
+                            if (tpa::hasAVX) [&]() TPA_TARGET("avx")
                             {
                                 const __m256d _adder = _mm256_setr_pd(
                                     0.0,
@@ -366,9 +483,9 @@ namespace tpa
 
                                     _Res = _mm256_add_pd(_Val, _adder);
 
-                                    _mm256_store_pd(&arr[i], _Res);
+                                    _mm256_storeu_pd(&arr[i], _Res);
                                 }//End for
-                            }//End if hasAVX
+                            }();//End if hasAVX
 #endif
                         }//End if
 #pragma endregion
@@ -21,7 +21,7 @@ namespace tpa
 	/// <summary>
 	/// Provides a list of valid SIMD arithmetic operation predicates.
 	/// </summary>
-	const enum class op {
+	enum class op {
 		ADD,
 		SUBTRACT,
 		MULTIPLY,
@@ -30,13 +30,15 @@ namespace tpa
 		MIN, //Functionally identical to tpa::compare<tpa::op::MIN>(...)
 		MAX, //Functionally identical to tpa::compare<tpa::op::MAX>(...)
 		AVERAGE,
-		POWER
+		POWER,
+		ADD_SAT, //Saturating add, clamps to the range of the type instead of wrapping
+		SUB_SAT  //Saturating subtract, clamps to the range of the type instead of wrapping
 	};//End of op
 
 	/// <summary>
 	/// Provides a list of valid SIMD bit wise operation predicates.
 	/// </summary>
-	const enum class bit {
+	enum class bit {
 		AND,
 		OR,
 		XOR,
@@ -46,7 +48,7 @@ namespace tpa
 	/// <summary>
 	/// Provides a list of valid SIMD bit modification operation predicates.
 	/// </summary>
-	const enum class bit_mod {
+	enum class bit_mod {
 		SET,					//Sets the specified bit to 1
 		SET_ALL,				//Sets all the bits to 1
 		CLEAR,					//Clears the specified bit to 0
@@ -75,7 +77,7 @@ namespace tpa
 		SET_LOWEST_CLEAR		//Sets the bit before the current lowest set to 1
 	};//End of bit_mod
 
-	const enum class bit_ext {
+	enum class bit_ext {
 		LOWEST_SET,		//Extracts the lowest set 1 bit
 		HIGHEST_SET,	//Extracts the highest set 1 bit
 		SPECIFIED,		//Extract the specified bit
@@ -86,7 +88,7 @@ namespace tpa
 	/// <summary>
 	/// Provides a list of valid SIMD bit shift and rotation operation predicates.
 	/// </summary>
-	const enum class bit_move {
+	enum class bit_move {
 		ROTATE_LEFT,			//Rotates bits left eg. 1110 -> 1101
 		ROTATE_RIGHT,			//Rotates bits right eg. 0011 -> 1001
 		SHIFT_LEFT,				//Shifts bits left eg. 1110 -> 1100
@@ -100,7 +102,7 @@ namespace tpa
 	/// <summary>
 	/// Provides a list of valid SIMD bit counting operation predicates.
 	/// </summary>
-	const enum class bit_count {
+	enum class bit_count {
 		POP_COUNT,
 		ONE_COUNT = POP_COUNT,
 		ZERO_COUNT,
@@ -116,7 +118,7 @@ namespace tpa
 	/// <summary>
 	/// Provides a list of valid SIMD Trigonometric predicate functions
 	/// </summary>
-	const enum class trig
+	enum class trig
 	{
 		SINE,
 		HYPERBOLIC_SINE,
@@ -137,7 +139,7 @@ namespace tpa
 	/// <summary>
 	/// Provides a list of valid root functions
 	/// </summary>
-	const enum class rt
+	enum class rt
 	{
 		SQUARE,
 		INVERSE_SQUARE,
@@ -150,7 +152,7 @@ namespace tpa
 	/// <summary>
 	/// Provides a list of units of emasure for angles 
 	/// </summary>
-	const enum class angle {
+	enum class angle {
 		DEGREES,
 		RADIANS
 	};//End of angle
@@ -159,7 +161,7 @@ namespace tpa
 	/// <para>Provides a list of valid floating-point SIMD rounding modes</para>
 	/// <para>Please note that some ARM CPUs do not support IEEE-754 rounding modes</para>
 	/// </summary>
-	const enum class rnd {
+	enum class rnd {
 #if defined(TPA_X86_64)
 		NEAREST_INT = _MM_FROUND_TO_NEAREST_INT,//SIMD eqivilant of FE_TONEAREST
 		DOWN = _MM_FROUND_TO_NEG_INF,//SIMD eqivilant of FE_DOWNWARD
@@ -181,7 +183,7 @@ namespace tpa
 	/// <summary>
 	/// Provides a list of valid SIMD comparison operation predicates.
 	/// </summary>
-	const enum class comp {
+	enum class comp {
 		EQUAL,
 		NOT_EQUAL,
 		LESS_THAN,
@@ -195,7 +197,7 @@ namespace tpa
 	/// <summary>
 	/// Provides a list of valid SIMD conditional predicates.
 	/// </summary>
-	const enum class cond {
+	enum class cond {
 		EVEN,
 		ODD,
 		PRIME,
@@ -219,7 +221,7 @@ namespace tpa
 	/// <summary>
 	/// Provides a list of valid SIMD generation predicates.
 	/// </summary>
-	const enum class gen
+	enum class gen
 	{
 		EVEN,	//Generates a sequence of even numbers starting at the specifed number in param
 		ODD,	//Generates a sequence of odd numbers starting at the specified number in param
@@ -251,7 +253,7 @@ namespace tpa
 	/// <summary>
 	/// Provides a list of valid sequences to generate
 	/// </summary>
-	const enum class seq {
+	enum class seq {
 		PRIME,
 		PARTITION_NUMBERS,
 		POWERS,
@@ -358,4 +360,12 @@ namespace tpa
 		CIRCULAR_PRIMES,
 		HOME_PRIMES
 	};//End of seq
+
+	/// <summary>
+	/// Provides a list of execution modes for functions which walk several containers at once.
+	/// </summary>
+	enum class exec {
+		LINEAR,//Each thread walks one contiguous section of every container
+		BLOCKED//The containers are split into L2-sized tiles (tpa::simd::tile_bytes) dealt round-robin to the threads, every thread finishes all streams of a tile before moving on
+	};//End of exec
 }//End of namespace
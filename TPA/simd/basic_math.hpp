@@ -31,12 +31,78 @@
 #include "../tpa_concepts.hpp"
 #include "../InstructionSet.hpp"
 #include "simd.hpp"
+#include "vec.hpp"
+#include "dispatch.hpp"
 
 #undef min
 #undef max
 #undef abs
 #undef pow
 
+#ifdef TPA_NEON
+/// <summary>
+/// <para>Private Namespace for the TPA basic math NEON kernels.</para>
+/// </summary>
+namespace tpa_basic_math_private
+{
+	/// <summary>
+	/// <para>True if tpa_basic_math_private::calculate_const_neon implements 'INSTR' for 'T'.</para>
+	/// <para>Integer division and averaging truncate towards zero in the scalar code and are left to it.</para>
+	/// </summary>
+	template<tpa::op INSTR, typename T>
+	inline constexpr bool has_calculate_const_neon = tpa::simd::is_vec_type<T> &&
+		(INSTR == tpa::op::ADD || INSTR == tpa::op::SUBTRACT || INSTR == tpa::op::MULTIPLY ||
+		INSTR == tpa::op::MIN || INSTR == tpa::op::MAX ||
+		(std::is_floating_point<T>::value && (INSTR == tpa::op::DIVIDE || INSTR == tpa::op::AVERAGE)));
+
+	/// <summary>
+	/// <para>dest[i] = source[i] INSTR val over [i, end) in 128-bit steps, 'i' is advanced past the elements processed.</para>
+	/// </summary>
+	template<tpa::op INSTR, typename T>
+	requires has_calculate_const_neon<INSTR, T>
+	inline void calculate_const_neon(size_t& i, const size_t end, const T* source, const T val, T* dest) noexcept
+	{
+		using V = tpa::simd::vec<T, 16uz / sizeof(T)>;
+
+		const V _val = V(val);
+
+		for (; (i + V::width) <= end; i += V::width)
+		{
+			const V _a = V::load(&source[i]);
+
+			if constexpr (INSTR == tpa::op::ADD)
+			{
+				(_a + _val).store(&dest[i]);
+			}//End if
+			else if constexpr (INSTR == tpa::op::SUBTRACT)
+			{
+				(_a - _val).store(&dest[i]);
+			}//End if
+			else if constexpr (INSTR == tpa::op::MULTIPLY)
+			{
+				(_a * _val).store(&dest[i]);
+			}//End if
+			else if constexpr (INSTR == tpa::op::DIVIDE)
+			{
+				(_a / _val).store(&dest[i]);
+			}//End if
+			else if constexpr (INSTR == tpa::op::MIN)
+			{
+				tpa::simd::min(_a, _val).store(&dest[i]);
+			}//End if
+			else if constexpr (INSTR == tpa::op::MAX)
+			{
+				tpa::simd::max(_a, _val).store(&dest[i]);
+			}//End if
+			else
+			{
+				((_a + _val) / static_cast<T>(2)).store(&dest[i]);
+			}//End else
+		}//End for
+	}//End of calculate_const_neon
+}//End of namespace
+#endif
+
 /// <summary>
 /// <para>Truly Parallel Algorithms</para>
 /// <para>SIMD Matrix Math Functions.</para>
@@ -47,7 +113,7 @@ namespace tpa
 {
 #pragma region generic
 	/// <summary>
-	/// <para>Computes math on 2 aligned containers storing the result in a 3rd aligned container.</para> 
+	/// <para>Computes math on 2 containers storing the result in a 3rd container.</para> 
 	/// <para> Containers of different types are allowed but not recomended.</para>
 	/// <para> Containers do not have to be a particular size</para>
 	/// <para> If passing 2 containers of different sizes, values will only be calculated up to the container with the smallest size, the destination container must be at least this large.</para> 
@@ -62,15 +128,19 @@ namespace tpa
 	/// <para>tpa::op::MAX</para>
 	/// <para>tpa::op::POW</para>
 	/// <para>tpa::op::AVERAGE</para>
+	/// <para>tpa::op::ADD_SAT</para>
+	/// <para>tpa::op::SUB_SAT</para>
 	/// </summary>
 	/// <param name="source1"></param>
 	/// <param name="source2"></param>
 	/// <param name="dest"></param>
+	/// <param name="mode">tpa::exec::LINEAR (default) or tpa::exec::BLOCKED to interleave the three streams in L2-sized tiles</param>
 	template<tpa::op INSTR, typename CONTAINER_A, typename CONTAINER_B, typename CONTAINER_C>
 	inline constexpr void calculate(
 		const CONTAINER_A& source1,
 		const CONTAINER_B& source2,
-		CONTAINER_C& dest)
+		CONTAINER_C& dest,
+		const tpa::exec mode = tpa::exec::LINEAR)
 		requires tpa::util::contiguous_seqeunce<CONTAINER_A> &&
 		tpa::util::contiguous_seqeunce<CONTAINER_B> &&
 		tpa::util::contiguous_seqeunce<CONTAINER_C>
@@ -88,2396 +158,2678 @@ namespace tpa
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::calculate(): " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::calculate will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
-			std::vector<std::pair<size_t, size_t>> sections;
-			tpa::util::prepareThreading(sections, smallest);
+			//tpa::exec::BLOCKED deals L2-sized tiles to the threads round-robin, tpa::exec::LINEAR gives each thread one contiguous section
+			std::vector<std::vector<std::pair<size_t, size_t>>> tiles;
+			tpa::util::prepareTiling(tiles, smallest, (mode == tpa::exec::BLOCKED) ? tpa::simd::tile_elements<T>(3uz) : 0uz);
+
+			//tpa::simd::runtime_avx512_policy may turn the 512-bit branches off for this input
+			const bool allow512 = tpa::simd::avx512_allowed(smallest * sizeof(T));
 
 			std::vector<std::shared_future<uint32_t>> results;
 			results.reserve(tpa::nThreads);
 
 			std::shared_future<uint32_t> temp;
 
-			for (const auto& sec : sections)
+			for (const auto& ranges : tiles)
 			{
 				//Launch lambda from multiple threads
-				temp = tpa::tp->addTask([&source1, &source2, &dest, &sec]()
+				temp = tpa::tp->addTask([&source1, &source2, &dest, &ranges, allow512]()
 					{
-						const size_t beg = sec.first;
-						const size_t end = sec.second;
-						size_t i = beg;
-#pragma region byte
-						if constexpr (std::is_same<T, int8_t>() && std::is_same<T2, int8_t>() && std::is_same<RES, int8_t>())
+						for (const auto& [beg, end] : ranges)
 						{
-#ifdef TPA_X86_64
-							if (tpa::hasAVX512_ByteWord)
+							size_t i = beg;
+#pragma region byte
+							if constexpr (std::is_same<T, int8_t>() && std::is_same<T2, int8_t>() && std::is_same<RES, int8_t>())
 							{
-								__m512i _Ai, _Bi, _DESTi;
-
-								for (; (i+64uz) < end; i += 64uz)
+#ifdef TPA_X86_64
+								if (allow512 && tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 								{
-									//Set Values
-									_Ai = _mm512_loadu_epi8((__m512i*)&source1[i]);
-									_Bi = _mm512_loadu_epi8((__m512i*)&source2[i]);
+									__m512i _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm512_add_epi8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm512_sub_epi8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
+									for (; (i+64uz) < end; i += 64uz)
 									{
+										//Set Values
+										_Ai = _mm512_loadu_epi8((__m512i*)&source1[i]);
+										_Bi = _mm512_loadu_epi8((__m512i*)&source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = _mm512_add_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm512_sub_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = _mm512_adds_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = _mm512_subs_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = tpa::simd::_mm512_mullo_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm512_div_epi8(_Ai, _Bi);
+											_DESTi = _mm512_div_epi8(_Ai, _Bi);
 #else
-										break;	
+											break;	
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm512_rem_epi8(_Ai, _Bi);
+											_DESTi = _mm512_rem_epi8(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = _mm512_min_epi8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = _mm512_max_epi8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											_DESTi = _mm512_min_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = _mm512_max_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
 #ifdef TPA_HAS_SVML
-										const __m512i _TWO = _mm512_set1_epi8(2);
+											const __m512i _TWO = _mm512_set1_epi8(2);
 
-										_DESTi = _mm512_add_epi8(_Ai, _Bi);
-										_DESTi = _mm512_div_epi8(_DESTi, _TWO);
+											_DESTi = _mm512_add_epi8(_Ai, _Bi);
+											_DESTi = _mm512_div_epi8(_DESTi, _TWO);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
-										}();
-									}//End else
-
-									//Store Result
-									_mm512_storeu_epi8((__m256i*) & dest[i], _DESTi);
-								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX2)
-							{
-								__m256i _Ai, _Bi, _DESTi;
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
+											}();
+										}//End else
 
-								for (; (i+32uz) < end; i += 32uz)
+										//Store Result
+										_mm512_storeu_epi8((__m256i*) & dest[i], _DESTi);
+									}//End for
+								}();//End if hasAVX512
+								else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 								{
-									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
-									_Bi = _mm256_load_si256((__m256i*) & source2[i]);
+									__m256i _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm256_add_epi8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm256_sub_epi8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										break;									
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
+									for (; (i+32uz) < end; i += 32uz)
 									{
+										//Set Values
+										_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
+										_Bi = _mm256_loadu_si256((__m256i*) & source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = _mm256_add_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm256_sub_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = _mm256_adds_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = _mm256_subs_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = tpa::simd::_mm256_mullo_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm256_div_epi8(_Ai, _Bi);
+											_DESTi = _mm256_div_epi8(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm256_rem_epi8(_Ai, _Bi);
+											_DESTi = _mm256_rem_epi8(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = _mm256_min_epi8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = _mm256_max_epi8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											_DESTi = _mm256_min_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = _mm256_max_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
 #ifdef TPA_HAS_SVML
-										const __m256i _TWO = _mm256_set1_epi8(2);
+											const __m256i _TWO = _mm256_set1_epi8(2);
 
-										_DESTi = _mm256_add_epi8(_Ai, _Bi);
-										_DESTi = _mm256_div_epi8(_DESTi, _TWO);
+											_DESTi = _mm256_add_epi8(_Ai, _Bi);
+											_DESTi = _mm256_div_epi8(_DESTi, _TWO);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
-										}();
-									}//End else
-
-									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
-								}//End for
-							}//End if hasAVX2
-							else if (tpa::has_SSE2)
-							{
-								__m128i _Ai, _Bi, _DESTi;
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
+											}();
+										}//End else
 
-								for (; (i + 16uz) < end; i += 16uz)
+										//Store Result
+										_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
+									}//End for
+								}();//End if hasAVX2
+								else if (tpa::has_SSE2)
 								{
-									//Set Values
-									_Ai = _mm_load_si128((__m128i*) & source1[i]);
-									_Bi = _mm_load_si128((__m128i*) & source2[i]);
+									__m128i _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm_add_epi8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm_sub_epi8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
+									for (; (i + 16uz) < end; i += 16uz)
 									{
+										//Set Values
+										_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
+										_Bi = _mm_loadu_si128((__m128i*) & source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = _mm_add_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm_sub_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = _mm_adds_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = _mm_subs_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = tpa::simd::_mm_mullo_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm_div_epi8(_Ai, _Bi);
+											_DESTi = _mm_div_epi8(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm_rem_epi8(_Ai, _Bi);
+											_DESTi = _mm_rem_epi8(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										if (tpa::has_SSE41) [[likely]]
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
 										{
-											_DESTi = _mm_min_epi8(_Ai, _Bi);
+											if (tpa::has_SSE41) [[likely]] [&]() TPA_TARGET("sse4.1")
+											{
+												_DESTi = _mm_min_epi8(_Ai, _Bi);
+											}();//End if
+											else
+											{
+												break;
+											}//End else
 										}//End if
-										else
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											if (tpa::has_SSE41) [[likely]] [&]() TPA_TARGET("sse4.1")
+											{
+												_DESTi = _mm_max_epi8(_Ai, _Bi);
+											}();//End if
+											else
+											{
+												break;
+											}//End else
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
 										{
+#ifdef TPA_HAS_SVML
+											const __m128i _TWO = _mm_set1_epi8(2);
+
+											_DESTi = _mm_add_epi8(_Ai, _Bi);
+											_DESTi = _mm_div_epi8(_DESTi, _TWO);
+#else
 											break;
-										}//End else
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										if (tpa::has_SSE41) [[likely]]
+#endif
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
 										{
-											_DESTi = _mm_max_epi8(_Ai, _Bi);
+											break;
 										}//End if
 										else
 										{
-											break;
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
+											}();
 										}//End else
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
-#ifdef TPA_HAS_SVML
-										const __m128i _TWO = _mm_set1_epi8(2);
 
-										_DESTi = _mm_add_epi8(_Ai, _Bi);
-										_DESTi = _mm_div_epi8(_DESTi, _TWO);
-#else
-										break;
-#endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
-										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
-										}();
-									}//End else
-
-									//Store Result
-									_mm_store_si128((__m128i*) & dest[i], _DESTi);
-								}//End for
-							}//End if has_SSE2
+										//Store Result
+										_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
+									}//End for
+								}//End if has_SSE2
 
 #elif defined(TPA_ARM)
-							if (tpa::hasNeon)
-							{
-								int8x16_t _Ai, _Bi, _DESTi;
-
-								for (; (i + 16uz) < end; i += 16uz)
+								if (tpa::hasNeon)
 								{
-									//Set Values
-									_Ai = vld1q_s8(&source1[i]);
-									_Bi = vld1q_s8(&source2[i]);
+									int8x16_t _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = vaddq_s8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = vsubq_s8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
+									for (; (i + 16uz) < end; i += 16uz)
 									{
-										_DESTi = vmulq_s8(_Ai, _Bi);;
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
-										break;
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = vminq_s8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = vmaxq_s8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
-										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
-										}();
-									}//End else
-
-									//Store Result
-									vst1q_s8(&dest[i], _DESTi);
-								}//End for
-							}//End if hasNEON
-#elif defined(TPA_ARM)
-if (tpa::hasNeon)
-{
-	int8x16_t _Ai, _Bi, _DESTi;
+										//Set Values
+										_Ai = vld1q_s8(&source1[i]);
+										_Bi = vld1q_s8(&source2[i]);
 
-	for (; (i + 16uz) < end; i += 16uz)
-	{
-		//Set Values
-		_Ai = vld1q_s8(&source1[i]);
-		_Bi = vld1q_s8(&source2[i]);
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = vaddq_s8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = vsubq_s8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = vqaddq_s8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = vqsubq_s8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = vmulq_s8(_Ai, _Bi);;
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
+											break;
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											_DESTi = vminq_s8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = vmaxq_s8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
+										{
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
+											}();
+										}//End else
 
-		//Calc
-		if constexpr (INSTR == tpa::op::ADD)
-		{
-			_DESTi = vaddq_s8(_Ai, _Bi);
-		}//End if
-		else if constexpr (INSTR == tpa::op::SUBTRACT)
-		{
-			_DESTi = vsubq_s8(_Ai, _Bi);
-		}//End if
-		else if constexpr (INSTR == tpa::op::MULTIPLY)
-		{
-			_DESTi = vmulq_s8(_Ai, _Bi);;
-		}//End if
-		else if constexpr (INSTR == tpa::op::DIVIDE)
-		{
-			break;
-		}//End if
-		else if constexpr (INSTR == tpa::op::MODULO)
-		{
-			break;
-		}//End if									
-		else if constexpr (INSTR == tpa::op::MIN)
-		{
-			_DESTi = vminq_s8(_Ai, _Bi);
-		}//End if
-		else if constexpr (INSTR == tpa::op::MAX)
-		{
-			_DESTi = vmaxq_s8(_Ai, _Bi);
-		}//End if
-		else if constexpr (INSTR == tpa::op::AVERAGE)
-		{
-			break;
-		}//End if
-		else if constexpr (INSTR == tpa::op::POWER)
-		{
-			break;
-		}//End if
-		else
-		{
-			[] <bool flag = false>()
-			{
-				static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
-			}();
-		}//End else
-
-		//Store Result
-		vst1q_s8(&dest[i], _DESTi);
-	}//End for
-}//End if hasNEON
+										//Store Result
+										vst1q_s8(&dest[i], _DESTi);
+									}//End for
+								}//End if hasNEON
 #endif
-						}//End if
+							}//End if
 
 #pragma endregion
 #pragma region unsigned byte
-						else if constexpr (std::is_same<T, uint8_t>() && std::is_same<T2, uint8_t>() && std::is_same<RES, uint8_t>())
-						{
-#ifdef TPA_X86_64
-							if (tpa::hasAVX512_ByteWord)
+							else if constexpr (std::is_same<T, uint8_t>() && std::is_same<T2, uint8_t>() && std::is_same<RES, uint8_t>())
 							{
-								__m512i _Ai, _Bi, _DESTi;
-
-								for (; (i+64uz) < end; i += 64uz)
+#ifdef TPA_X86_64
+								if (allow512 && tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 								{
-									//Set Values
-									_Ai = _mm512_loadu_epi8((__m512i*)&source1[i]);
-									_Bi = _mm512_loadu_epi8((__m512i*)&source2[i]);
+									__m512i _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm256_add_epi8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm512_sub_epi8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
+									for (; (i+64uz) < end; i += 64uz)
 									{
+										//Set Values
+										_Ai = _mm512_loadu_epi8((__m512i*)&source1[i]);
+										_Bi = _mm512_loadu_epi8((__m512i*)&source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = _mm512_add_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm512_sub_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = _mm512_adds_epu8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = _mm512_subs_epu8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = tpa::simd::_mm512_mullo_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm512_div_epu8(_Ai, _Bi);
+											_DESTi = _mm512_div_epu8(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm512_rem_epu8(_Ai, _Bi);
+											_DESTi = _mm512_rem_epu8(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = _mm512_min_epu8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = _mm512_max_epu8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
-										_DESTi = _mm512_avg_epu8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<uint8_t>).");
-										}();
-									}//End else
-
-									//Store Result
-									_mm512_storeu_epi8((__m256i*) & dest[i], _DESTi);
-								}//End for
-							}//End if has AVX512
-							else if (tpa::hasAVX2)
-							{
-								__m256i _Ai, _Bi, _DESTi;
+											_DESTi = _mm512_min_epu8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = _mm512_max_epu8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
+											_DESTi = _mm512_avg_epu8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
+										{
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<uint8_t>).");
+											}();
+										}//End else
 
-								for (; (i+32uz) < end; i += 32uz)
+										//Store Result
+										_mm512_storeu_epi8((__m256i*) & dest[i], _DESTi);
+									}//End for
+								}();//End if has AVX512
+								else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 								{
-									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
-									_Bi = _mm256_load_si256((__m256i*) & source2[i]);
+									__m256i _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm256_add_epi8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm256_sub_epi8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
+									for (; (i+32uz) < end; i += 32uz)
 									{
+										//Set Values
+										_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
+										_Bi = _mm256_loadu_si256((__m256i*) & source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = _mm256_add_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm256_sub_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = _mm256_adds_epu8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = _mm256_subs_epu8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = tpa::simd::_mm256_mullo_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm256_div_epu8(_Ai, _Bi);
+											_DESTi = _mm256_div_epu8(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm256_rem_epu8(_Ai, _Bi);
+											_DESTi = _mm256_rem_epu8(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = _mm256_min_epu8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = _mm256_max_epu8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
-										_DESTi = _mm256_avg_epu8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<uint8_t>).");
-										}();
-									}//End else
-
-									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
-								}//End for
-							}//End if has AVX2
-							else if (tpa::has_SSE2)
-							{
-								__m128i _Ai, _Bi, _DESTi;
+											_DESTi = _mm256_min_epu8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = _mm256_max_epu8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
+											_DESTi = _mm256_avg_epu8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
+										{
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<uint8_t>).");
+											}();
+										}//End else
 
-								for (; (i + 16uz) < end; i += 16uz)
+										//Store Result
+										_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
+									}//End for
+								}();//End if has AVX2
+								else if (tpa::has_SSE2)
 								{
-									//Set Values
-									_Ai = _mm_load_si128((__m128i*) & source1[i]);
-									_Bi = _mm_load_si128((__m128i*) & source2[i]);
+									__m128i _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm_add_epi8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm_sub_epi8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
+									for (; (i + 16uz) < end; i += 16uz)
 									{
+										//Set Values
+										_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
+										_Bi = _mm_loadu_si128((__m128i*) & source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = _mm_add_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm_sub_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = _mm_adds_epu8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = _mm_subs_epu8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = tpa::simd::_mm_mullo_epi8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm_div_epu8(_Ai, _Bi);
+											_DESTi = _mm_div_epu8(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm_rem_epu8(_Ai, _Bi);
+											_DESTi = _mm_rem_epu8(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = _mm_min_epu8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = _mm_max_epu8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
-										_DESTi = _mm_avg_epu8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
-										}();
-									}//End else
+											_DESTi = _mm_min_epu8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = _mm_max_epu8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
+											_DESTi = _mm_avg_epu8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
+										{
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
+											}();
+										}//End else
 
-									//Store Result
-									_mm_store_si128((__m128i*) & dest[i], _DESTi);
-								}//End for
-							}//End if has_SSE2
+										//Store Result
+										_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
+									}//End for
+								}//End if has_SSE2
 #elif defined(TPA_ARM)
-							if (tpa::hasNeon)
-							{
-								int8x16_t _Ai, _Bi, _DESTi;
-
-								for (; (i + 16uz) < end; i += 16uz)
+								if (tpa::hasNeon)
 								{
-									//Set Values
-									_Ai = vld1q_u8(&source1[i]);
-									_Bi = vld1q_u8(&source2[i]);
+									int8x16_t _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = vaddq_u8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = vsubq_u8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
+									for (; (i + 16uz) < end; i += 16uz)
 									{
-										_DESTi = vmulq_u8(_Ai, _Bi);;
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
-										break;
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = vminq_u8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = vmaxq_u8(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										//Set Values
+										_Ai = vld1q_u8(&source1[i]);
+										_Bi = vld1q_u8(&source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
-										}();
-									}//End else
+											_DESTi = vaddq_u8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = vsubq_u8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = vqaddq_u8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = vqsubq_u8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = vmulq_u8(_Ai, _Bi);;
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
+											break;
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											_DESTi = vminq_u8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = vmaxq_u8(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
+										{
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
+											}();
+										}//End else
 
-									//Store Result
-									vst1q_u8(&dest[i], _DESTi);
-								}//End for
-							}//End if hasNEON
+										//Store Result
+										vst1q_u8(&dest[i], _DESTi);
+									}//End for
+								}//End if hasNEON
 #endif			
-						}//End if
+							}//End if
 #pragma endregion
 #pragma region short
-						else if constexpr (std::is_same<T, int16_t>() && std::is_same<T2, int16_t>() && std::is_same<RES, int16_t>())
-						{
-#ifdef TPA_X86_64
-							if (tpa::hasAVX512_ByteWord)
+							else if constexpr (std::is_same<T, int16_t>() && std::is_same<T2, int16_t>() && std::is_same<RES, int16_t>())
 							{
-								__m512i _Ai, _Bi, _DESTi;
-
-								for (; (i+32uz) < end; i += 32uz)
+#ifdef TPA_X86_64
+								if (allow512 && tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 								{
-									//Set Values
-									_Ai = _mm512_loadu_epi16((__m512i*)&source1[i]);
-									_Bi = _mm512_loadu_epi16((__m512i*)&source2[i]);
+									__m512i _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm512_add_epi16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm512_sub_epi16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = _mm512_mullo_epi16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
+									for (; (i+32uz) < end; i += 32uz)
 									{
+										//Set Values
+										_Ai = _mm512_loadu_epi16((__m512i*)&source1[i]);
+										_Bi = _mm512_loadu_epi16((__m512i*)&source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = _mm512_add_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm512_sub_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = _mm512_adds_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = _mm512_subs_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = _mm512_mullo_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm512_div_epi16(_Ai, _Bi);
+											_DESTi = _mm512_div_epi16(_Ai, _Bi);
 #else 
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm512_rem_epi16(_Ai, _Bi);
+											_DESTi = _mm512_rem_epi16(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = _mm512_min_epi16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = _mm512_max_epi16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											_DESTi = _mm512_min_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = _mm512_max_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
 #ifdef TPA_HAS_SVML
-										const __m512i _TWO = _mm512_set1_epi16(2);
+											const __m512i _TWO = _mm512_set1_epi16(2);
 
-										_DESTi = _mm512_add_epi16(_Ai, _Bi);
-										_DESTi = _mm512_div_epi16(_DESTi, _TWO);
+											_DESTi = _mm512_add_epi16(_Ai, _Bi);
+											_DESTi = _mm512_div_epi16(_DESTi, _TWO);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int16_t>).");
-										}();
-									}//End else
-
-									//Store Result
-									_mm512_storeu_epi16((__m256i*) & dest[i], _DESTi);
-								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX2)
-							{
-								__m256i _Ai, _Bi, _DESTi;
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int16_t>).");
+											}();
+										}//End else
 
-								for (; (i+16uz) < end; i += 16uz)
+										//Store Result
+										_mm512_storeu_epi16((__m256i*) & dest[i], _DESTi);
+									}//End for
+								}();//End if hasAVX512
+								else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 								{
-									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
-									_Bi = _mm256_load_si256((__m256i*) & source2[i]);
+									__m256i _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm256_add_epi16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm256_sub_epi16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = _mm256_mullo_epi16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
+									for (; (i+16uz) < end; i += 16uz)
 									{
+										//Set Values
+										_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
+										_Bi = _mm256_loadu_si256((__m256i*) & source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = _mm256_add_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm256_sub_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = _mm256_adds_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = _mm256_subs_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = _mm256_mullo_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm256_div_epi16(_Ai, _Bi);
+											_DESTi = _mm256_div_epi16(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm256_rem_epi16(_Ai, _Bi);
+											_DESTi = _mm256_rem_epi16(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = _mm256_min_epi16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = _mm256_max_epi16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											_DESTi = _mm256_min_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = _mm256_max_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
 #ifdef TPA_HAS_SVML
-										const __m256i _TWO = _mm256_set1_epi16(2);
+											const __m256i _TWO = _mm256_set1_epi16(2);
 
-										_DESTi = _mm256_add_epi16(_Ai, _Bi);
-										_DESTi = _mm256_div_epi16(_DESTi, _TWO);
+											_DESTi = _mm256_add_epi16(_Ai, _Bi);
+											_DESTi = _mm256_div_epi16(_DESTi, _TWO);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int16_t>).");
-										}();
-									}//End else
-
-									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
-								}//End for
-							}//End if hasAVX2
-							else if (tpa::has_SSE2)
-							{
-								__m128i _Ai, _Bi, _DESTi;
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int16_t>).");
+											}();
+										}//End else
 
-								for (; (i + 8uz) < end; i += 8uz)
+										//Store Result
+										_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
+									}//End for
+								}();//End if hasAVX2
+								else if (tpa::has_SSE2)
 								{
-									//Set Values
-									_Ai = _mm_load_si128((__m128i*) & source1[i]);
-									_Bi = _mm_load_si128((__m128i*) & source2[i]);
+									__m128i _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm_add_epi16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm_sub_epi16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = _mm_mullo_epi16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
+									for (; (i + 8uz) < end; i += 8uz)
 									{
+										//Set Values
+										_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
+										_Bi = _mm_loadu_si128((__m128i*) & source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = _mm_add_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm_sub_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = _mm_adds_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = _mm_subs_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = _mm_mullo_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm_div_epi16(_Ai, _Bi);
+											_DESTi = _mm_div_epi16(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm_rem_epi16(_Ai, _Bi);
+											_DESTi = _mm_rem_epi16(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = _mm_min_epi16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = _mm_max_epi16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											_DESTi = _mm_min_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = _mm_max_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
 #ifdef TPA_HAS_SVML
-										const __m128i _TWO = _mm_set1_epi16(2);
+											const __m128i _TWO = _mm_set1_epi16(2);
 
-										_DESTi = _mm_add_epi16(_Ai, _Bi);
-										_DESTi = _mm_div_epi16(_DESTi, _TWO);
+											_DESTi = _mm_add_epi16(_Ai, _Bi);
+											_DESTi = _mm_div_epi16(_DESTi, _TWO);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
-										}();
-									}//End else
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
+											}();
+										}//End else
 
-									//Store Result
-									_mm_store_si128((__m128i*) & dest[i], _DESTi);
-								}//End for
-							}//End if has_SSE2
+										//Store Result
+										_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
+									}//End for
+								}//End if has_SSE2
 #elif defined(TPA_ARM)
-							if (tpa::hasNeon)
-							{
-								int16x8_t _Ai, _Bi, _DESTi;
-
-								for (; (i + 8uz) < end; i += 8uz)
+								if (tpa::hasNeon)
 								{
-									//Set Values
-									_Ai = vld1q_s16(&source1[i]);
-									_Bi = vld1q_s16(&source2[i]);
+									int16x8_t _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = vaddq_s16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = vsubq_s16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = vmulq_s16(_Ai, _Bi);;
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
-										break;
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
+									for (; (i + 8uz) < end; i += 8uz)
 									{
-										_DESTi = vminq_s16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = vmaxq_s16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										//Set Values
+										_Ai = vld1q_s16(&source1[i]);
+										_Bi = vld1q_s16(&source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
-										}();
-									}//End else
+											_DESTi = vaddq_s16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = vsubq_s16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = vqaddq_s16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = vqsubq_s16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = vmulq_s16(_Ai, _Bi);;
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
+											break;
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											_DESTi = vminq_s16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = vmaxq_s16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
+										{
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
+											}();
+										}//End else
 
-									//Store Result
-									vst1q_s16(&dest[i], _DESTi);
-								}//End for
-							}//End if hasNEON
+										//Store Result
+										vst1q_s16(&dest[i], _DESTi);
+									}//End for
+								}//End if hasNEON
 #endif						
-						}//End if
+							}//End if
 #pragma endregion
 #pragma region unsigned short
-						else if constexpr (std::is_same<T, uint16_t>() && std::is_same<T2, uint16_t>() && std::is_same<RES, uint16_t>())
-						{
-#ifdef TPA_X86_64
-							if (tpa::hasAVX512_ByteWord)
+							else if constexpr (std::is_same<T, uint16_t>() && std::is_same<T2, uint16_t>() && std::is_same<RES, uint16_t>())
 							{
-								__m512i _Ai, _Bi, _DESTi;
-
-								for (; (i+32uz) < end; i += 32uz)
+#ifdef TPA_X86_64
+								if (allow512 && tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 								{
-									//Set Values
-									_Ai = _mm512_loadu_epi16((__m512i*)&source1[i]);
-									_Bi = _mm512_loadu_epi16((__m512i*)&source2[i]);
+									__m512i _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm512_add_epi16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm512_sub_epi16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = _mm512_mullo_epi16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
+									for (; (i+32uz) < end; i += 32uz)
 									{
+										//Set Values
+										_Ai = _mm512_loadu_epi16((__m512i*)&source1[i]);
+										_Bi = _mm512_loadu_epi16((__m512i*)&source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = _mm512_add_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm512_sub_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = _mm512_adds_epu16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = _mm512_subs_epu16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = _mm512_mullo_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm512_div_epu16(_Ai, _Bi);
+											_DESTi = _mm512_div_epu16(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm512_rem_epu16(_Ai, _Bi);
+											_DESTi = _mm512_rem_epu16(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = _mm512_min_epu16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = _mm512_max_epu16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
-										_DESTi = _mm512_avg_epu16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<uint16_t>).");
-									}();
-								}//End else
-
-								//Store Result
-									_mm512_storeu_epi16((__m512i*)&dest[i], _DESTi);
-							}//End for
-						}//End if
-							else if (tpa::hasAVX2)
-							{
-								__m256i _Ai, _Bi, _DESTi;
+											_DESTi = _mm512_min_epu16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = _mm512_max_epu16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
+											_DESTi = _mm512_avg_epu16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
+										{
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<uint16_t>).");
+										}();
+									}//End else
 
-								for (; (i+16uz) < end; i += 16uz)
+									//Store Result
+										_mm512_storeu_epi16((__m512i*)&dest[i], _DESTi);
+								}//End for
+							}();//End if
+								else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 								{
-									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
-									_Bi = _mm256_load_si256((__m256i*) & source2[i]);
+									__m256i _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm256_add_epi16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm256_sub_epi16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = _mm256_mullo_epi16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
+									for (; (i+16uz) < end; i += 16uz)
 									{
+										//Set Values
+										_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
+										_Bi = _mm256_loadu_si256((__m256i*) & source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = _mm256_add_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm256_sub_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = _mm256_adds_epu16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = _mm256_subs_epu16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = _mm256_mullo_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm256_div_epu16(_Ai, _Bi);
+											_DESTi = _mm256_div_epu16(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm256_rem_epu16(_Ai, _Bi);
+											_DESTi = _mm256_rem_epu16(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = _mm256_min_epu16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = _mm256_max_epu16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
-										_DESTi = _mm256_avg_epu16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<uint16_t>).");
-										}();
-									}//End else
-
-									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
-								}//End for
-							}//End if hasAVX2
-							else if (tpa::has_SSE2)
-							{
-								__m128i _Ai, _Bi, _DESTi;
+											_DESTi = _mm256_min_epu16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = _mm256_max_epu16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
+											_DESTi = _mm256_avg_epu16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
+										{
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<uint16_t>).");
+											}();
+										}//End else
 
-								for (; (i + 8uz) < end; i += 8uz)
+										//Store Result
+										_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
+									}//End for
+								}();//End if hasAVX2
+								else if (tpa::has_SSE2)
 								{
-									//Set Values
-									_Ai = _mm_load_si128((__m128i*) & source1[i]);
-									_Bi = _mm_load_si128((__m128i*) & source2[i]);
+									__m128i _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm_add_epi16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm_sub_epi16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = _mm_mullo_epi16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
+									for (; (i + 8uz) < end; i += 8uz)
 									{
+										//Set Values
+										_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
+										_Bi = _mm_loadu_si128((__m128i*) & source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = _mm_add_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm_sub_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = _mm_adds_epu16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = _mm_subs_epu16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = _mm_mullo_epi16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm_div_epu16(_Ai, _Bi);
+											_DESTi = _mm_div_epu16(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm_rem_epu16(_Ai, _Bi);
+											_DESTi = _mm_rem_epu16(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										if (tpa::has_SSE41) [[likely]]
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
 										{
-											_DESTi = _mm_min_epu16(_Ai, _Bi);
+											if (tpa::has_SSE41) [[likely]] [&]() TPA_TARGET("sse4.1")
+											{
+												_DESTi = _mm_min_epu16(_Ai, _Bi);
+											}();//End if
+											else
+											{
+												break;
+											}//End else
 										}//End if
-										else
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											if (tpa::has_SSE41) [[likely]] [&]() TPA_TARGET("sse4.1")
+											{
+												_DESTi = _mm_max_epu16(_Ai, _Bi);
+											}();//End if
+											else
+											{
+												break;
+											}//End else
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
+											_DESTi = _mm_avg_epu16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
 										{
 											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
+											}();
 										}//End else
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
+
+										//Store Result
+										_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
+									}//End for
+								}//End if has_SSE2
+#elif defined(TPA_ARM)
+								if (tpa::hasNeon)
+								{
+									int16x8_t _Ai, _Bi, _DESTi;
+
+									for (; (i + 8uz) < end; i += 8uz)
 									{
-										if (tpa::has_SSE41) [[likely]]
+										//Set Values
+										_Ai = vld1q_u16(&source1[i]);
+										_Bi = vld1q_u16(&source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
 										{
-											_DESTi = _mm_max_epu16(_Ai, _Bi);
+											_DESTi = vaddq_u16(_Ai, _Bi);
 										}//End if
-										else
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = vsubq_u16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = vqaddq_u16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = vqsubq_u16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = vmulq_u16(_Ai, _Bi);;
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
 										{
 											break;
-										}//End else
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
-										_DESTi = _mm_avg_epu16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
-										}();
-									}//End else
+											break;
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											_DESTi = vminq_u16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = vmaxq_u16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
+										{
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
+											}();
+										}//End else
 
-									//Store Result
-									_mm_store_si128((__m128i*) & dest[i], _DESTi);
-								}//End for
-							}//End if has_SSE2
-#elif defined(TPA_ARM)
-							if (tpa::hasNeon)
+										//Store Result
+										vst1q_u16(&dest[i], _DESTi);
+									}//End for
+								}//End if hasNEON
+#endif												
+				}//End if
+#pragma endregion
+#pragma region int
+							else if constexpr (std::is_same<T, int32_t>() && std::is_same<T2, int32_t>() && std::is_same<RES, int32_t>())
 							{
-								int16x8_t _Ai, _Bi, _DESTi;
-
-								for (; (i + 8uz) < end; i += 8uz)
+#ifdef TPA_X86_64
+								if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 								{
-									//Set Values
-									_Ai = vld1q_u16(&source1[i]);
-									_Bi = vld1q_u16(&source2[i]);
+									__m512i _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = vaddq_u16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = vsubq_u16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = vmulq_u16(_Ai, _Bi);;
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
-										break;
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
+									for (; (i+16uz) < end; i += 16uz)
 									{
-										_DESTi = vminq_u16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = vmaxq_u16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										//Set Values
+										_Ai = _mm512_loadu_epi32((__m512i*)&source1[i]);
+										_Bi = _mm512_loadu_epi32((__m512i*)&source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = _mm512_add_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm512_sub_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = tpa::simd::_mm512_adds_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = tpa::simd::_mm512_subs_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = _mm512_mullo_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
-										}();
-									}//End else
-
-									//Store Result
-									vst1q_u16(&dest[i], _DESTi);
-								}//End for
-							}//End if hasNEON
-#endif												
-			}//End if
-#pragma endregion
-#pragma region int
-						else if constexpr (std::is_same<T, int32_t>() && std::is_same<T2, int32_t>() && std::is_same<RES, int32_t>())
-						{
-#ifdef TPA_X86_64
-							if (tpa::hasAVX512)
-							{
-								__m512i _Ai, _Bi, _DESTi;
-
-								for (; (i+16uz) < end; i += 16uz)
-								{
-									//Set Values
-									_Ai = _mm512_load_epi32((__m512i*)&source1[i]);
-									_Bi = _mm512_load_epi32((__m512i*)&source2[i]);
-
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm512_add_epi32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm512_sub_epi32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = _mm512_mullo_epi32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
-									{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm512_div_epi32(_Ai, _Bi);
+											_DESTi = _mm512_div_epi32(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm512_rem_epi32(_Ai, _Bi);
+											_DESTi = _mm512_rem_epi32(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = _mm512_min_epi32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = _mm512_max_epi32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											_DESTi = _mm512_min_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = _mm512_max_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
 #ifdef TPA_HAS_SVML
-										const __m256i _TWO = _mm256_set1_epi32(2);
+											const __m256i _TWO = _mm256_set1_epi32(2);
 
-										_DESTi = _mm512_add_epi32(_Ai, _Bi);
-										_DESTi = _mm512_div_epi32(_DESTi, _TWO);
+											_DESTi = _mm512_add_epi32(_Ai, _Bi);
+											_DESTi = _mm512_div_epi32(_DESTi, _TWO);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calc_vector<__UNDEFINED_PREDICATE__>(CONTAINER<int32_t>).");
-										}();
-									}//End else
-
-									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _DESTi);
-								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX2)
-							{
-								__m256i _Ai, _Bi, _DESTi;
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calc_vector<__UNDEFINED_PREDICATE__>(CONTAINER<int32_t>).");
+											}();
+										}//End else
 
-								for (; (i+8uz) < end; i += 8uz)
+										//Store Result
+										_mm512_storeu_epi32((__m512i*)&dest[i], _DESTi);
+									}//End for
+								}();//End if hasAVX512
+								else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 								{
-									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
-									_Bi = _mm256_load_si256((__m256i*) & source2[i]);
+									__m256i _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm256_add_epi32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm256_sub_epi32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = _mm256_mullo_epi32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
+									for (; (i+8uz) < end; i += 8uz)
 									{
+										//Set Values
+										_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
+										_Bi = _mm256_loadu_si256((__m256i*) & source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = _mm256_add_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm256_sub_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = tpa::simd::_mm256_adds_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = tpa::simd::_mm256_subs_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = _mm256_mullo_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm256_div_epi32(_Ai, _Bi);
+											_DESTi = _mm256_div_epi32(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm256_rem_epi32(_Ai, _Bi);
+											_DESTi = _mm256_rem_epi32(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = _mm256_min_epi32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = _mm256_max_epi32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
-										const __m256i _TWO = _mm256_set1_epi32(2);
-
-										_DESTi = _mm256_add_epi32(_Ai, _Bi);
-										_DESTi = _mm256_div_epi32(_DESTi, _TWO);
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calc_vector<__UNDEFINED_PREDICATE__>(CONTAINER<int32_t>).");
-										}();
-									}//End else
+											_DESTi = _mm256_min_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = _mm256_max_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
+											const __m256i _TWO = _mm256_set1_epi32(2);
 
-									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
-								}//End for
-							}//End if hasAVX2
-							else if (tpa::has_SSE2)
-							{
-								__m128i _Ai, _Bi, _DESTi;
+											_DESTi = _mm256_add_epi32(_Ai, _Bi);
+#ifdef TPA_HAS_SVML
+											_DESTi = _mm256_div_epi32(_DESTi, _TWO);
+#else
+											break;
+#endif
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
+										{
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calc_vector<__UNDEFINED_PREDICATE__>(CONTAINER<int32_t>).");
+											}();
+										}//End else
 
-								for (; (i + 4uz) < end; i += 4uz)
+										//Store Result
+										_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
+									}//End for
+								}();//End if hasAVX2
+								else if (tpa::has_SSE2)
 								{
-									//Set Values
-									_Ai = _mm_load_si128((__m128i*) & source1[i]);
-									_Bi = _mm_load_si128((__m128i*) & source2[i]);
+									__m128i _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm_add_epi32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm_sub_epi32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = tpa::simd::_mm_mul_epi32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
+									for (; (i + 4uz) < end; i += 4uz)
 									{
+										//Set Values
+										_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
+										_Bi = _mm_loadu_si128((__m128i*) & source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = _mm_add_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm_sub_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = tpa::simd::_mm_adds_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = tpa::simd::_mm_subs_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = tpa::simd::_mm_mul_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm_div_epi32(_Ai, _Bi);
+											_DESTi = _mm_div_epi32(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm_rem_epi32(_Ai, _Bi);
+											_DESTi = _mm_rem_epi32(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										if (tpa::has_SSE41) [[likely]]
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
 										{
-											_DESTi = _mm_min_epi32(_Ai, _Bi);
+											if (tpa::has_SSE41) [[likely]] [&]() TPA_TARGET("sse4.1")
+											{
+												_DESTi = _mm_min_epi32(_Ai, _Bi);
+											}();//End if
+											else
+											{
+												break;
+											}//End else
 										}//End if
-										else
-										{
-											break;
-										}//End else
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										if (tpa::has_SSE41) [[likely]]
+										else if constexpr (INSTR == tpa::op::MAX)
 										{
-											_DESTi = _mm_max_epi32(_Ai, _Bi);
+											if (tpa::has_SSE41) [[likely]] [&]() TPA_TARGET("sse4.1")
+											{
+												_DESTi = _mm_max_epi32(_Ai, _Bi);
+											}();//End if
+											else
+											{
+												break;
+											}//End else
 										}//End if
-										else
+										else if constexpr (INSTR == tpa::op::AVERAGE)
 										{
-											break;
-										}//End else
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
 #ifdef TPA_HAS_SVML
-										const __m128i _TWO = _mm_set1_epi32(2);
+											const __m128i _TWO = _mm_set1_epi32(2);
 
-										_DESTi = _mm_add_epi32(_Ai, _Bi);
-										_DESTi = _mm_div_epi32(_DESTi, _TWO);
+											_DESTi = _mm_add_epi32(_Ai, _Bi);
+											_DESTi = _mm_div_epi32(_DESTi, _TWO);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
-										}();
-									}//End else
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
+											}();
+										}//End else
 
-									//Store Result
-									_mm_store_si128((__m128i*) & dest[i], _DESTi);
-								}//End for
-							}//End if has_SSE2
+										//Store Result
+										_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
+									}//End for
+								}//End if has_SSE2
 #elif defined(TPA_ARM)
-							if (tpa::hasNeon)
-							{
-								int32x4_t _Ai, _Bi, _DESTi;
-
-								for (; (i + 4uz) < end; i += 4uz)
+								if (tpa::hasNeon)
 								{
-									//Set Values
-									_Ai = vld1q_s32(&source1[i]);
-									_Bi = vld1q_s32(&source2[i]);
+									int32x4_t _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
+									for (; (i + 4uz) < end; i += 4uz)
 									{
-										_DESTi = vaddq_s32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = vsubq_s32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = vmulq_s32(_Ai, _Bi);;
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
-										break;
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = vminq_s32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = vmaxq_s32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										//Set Values
+										_Ai = vld1q_s32(&source1[i]);
+										_Bi = vld1q_s32(&source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
-										}();
-									}//End else
+											_DESTi = vaddq_s32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = vsubq_s32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = vqaddq_s32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = vqsubq_s32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = vmulq_s32(_Ai, _Bi);;
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
+											break;
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											_DESTi = vminq_s32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = vmaxq_s32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
+										{
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
+											}();
+										}//End else
 
-									//Store Result
-									vst1q_s32(&dest[i], _DESTi);
-								}//End for
-							}//End if hasNEON
+										//Store Result
+										vst1q_s32(&dest[i], _DESTi);
+									}//End for
+								}//End if hasNEON
 #endif													
-						}//End if
+							}//End if
 #pragma endregion
 #pragma region unsigned int
-						else if constexpr (std::is_same<T, uint32_t>() && std::is_same<T2, uint32_t>() && std::is_same<RES, uint32_t>())
-						{
-#ifdef TPA_X86_64
-							if (tpa::hasAVX512)
+							else if constexpr (std::is_same<T, uint32_t>() && std::is_same<T2, uint32_t>() && std::is_same<RES, uint32_t>())
 							{
-								__m512i _Ai, _Bi, _DESTi;
-
-								for (; (i+16uz) < end; i += 16uz)
+#ifdef TPA_X86_64
+								if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 								{
-									//Set Values
-									_Ai = _mm512_load_epi32((__m512i*)&source1[i]);
-									_Bi = _mm512_load_epi32((__m512i*)&source2[i]);
+									__m512i _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm512_add_epi32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm512_sub_epi32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = _mm512_mullo_epi32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
+									for (; (i+16uz) < end; i += 16uz)
 									{
+										//Set Values
+										_Ai = _mm512_loadu_epi32((__m512i*)&source1[i]);
+										_Bi = _mm512_loadu_epi32((__m512i*)&source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = _mm512_add_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm512_sub_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = tpa::simd::_mm512_adds_epu32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = tpa::simd::_mm512_subs_epu32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = _mm512_mullo_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm512_div_epu32(_Ai, _Bi);
+											_DESTi = _mm512_div_epu32(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm512_rem_epu32(_Ai, _Bi);
+											_DESTi = _mm512_rem_epu32(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = _mm512_min_epu32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = _mm512_max_epu32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											_DESTi = _mm512_min_epu32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = _mm512_max_epu32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
 #ifdef TPA_HAS_SVML
-										const __m512i _TWO = _mm512_set1_epi32(2);
+											const __m512i _TWO = _mm512_set1_epi32(2);
 
-										_DESTi = _mm512_add_epi32(_Ai, _Bi);
-										_DESTi = _mm512_div_epu32(_DESTi, _TWO);
+											_DESTi = _mm512_add_epi32(_Ai, _Bi);
+											_DESTi = _mm512_div_epu32(_DESTi, _TWO);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calc_vector<__UNDEFINED_PREDICATE__>(CONTAINER<uint32_t>).");
-										}();
-									}//End else
-
-									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _DESTi);
-								}//End for
-							}//End if
-							else if (tpa::hasAVX2)
-							{
-								__m256i _Ai, _Bi, _DESTi;
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calc_vector<__UNDEFINED_PREDICATE__>(CONTAINER<uint32_t>).");
+											}();
+										}//End else
 
-								for (; (i+8uz) < end; i += 8uz)
+										//Store Result
+										_mm512_storeu_epi32((__m512i*)&dest[i], _DESTi);
+									}//End for
+								}();//End if
+								else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 								{
-									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
-									_Bi = _mm256_load_si256((__m256i*) & source2[i]);
+									__m256i _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm256_add_epi32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm256_sub_epi32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = _mm256_mullo_epi32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
+									for (; (i+8uz) < end; i += 8uz)
 									{
+										//Set Values
+										_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
+										_Bi = _mm256_loadu_si256((__m256i*) & source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = _mm256_add_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm256_sub_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = tpa::simd::_mm256_adds_epu32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = tpa::simd::_mm256_subs_epu32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = _mm256_mullo_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm256_div_epu32(_Ai, _Bi);
+											_DESTi = _mm256_div_epu32(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm256_rem_epu32(_Ai, _Bi);
+											_DESTi = _mm256_rem_epu32(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = _mm256_min_epu32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = _mm256_max_epu32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											_DESTi = _mm256_min_epu32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = _mm256_max_epu32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
 #ifdef TPA_HAS_SVML
-										const __m256i _TWO = _mm256_set1_epi32(2);
+											const __m256i _TWO = _mm256_set1_epi32(2);
 
-										_DESTi = _mm256_add_epi32(_Ai, _Bi);
-										_DESTi = _mm256_div_epu32(_DESTi, _TWO);
+											_DESTi = _mm256_add_epi32(_Ai, _Bi);
+											_DESTi = _mm256_div_epu32(_DESTi, _TWO);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calc_vector<__UNDEFINED_PREDICATE__>(CONTAINER<uint32_t>).");
-										}();
-									}//End else
-
-									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
-								}//End for
-							}//End if hasAVX2
-							else if (tpa::has_SSE2)
-							{
-								__m128i _Ai, _Bi, _DESTi;
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calc_vector<__UNDEFINED_PREDICATE__>(CONTAINER<uint32_t>).");
+											}();
+										}//End else
 
-								for (; (i + 4uz) < end; i += 4uz)
+										//Store Result
+										_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
+									}//End for
+								}();//End if hasAVX2
+								else if (tpa::has_SSE2)
 								{
-									//Set Values
-									_Ai = _mm_load_si128((__m128i*) & source1[i]);
-									_Bi = _mm_load_si128((__m128i*) & source2[i]);
+									__m128i _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm_add_epi32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm_sub_epi32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = _mm_mul_epu32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
+									for (; (i + 4uz) < end; i += 4uz)
 									{
+										//Set Values
+										_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
+										_Bi = _mm_loadu_si128((__m128i*) & source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = _mm_add_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm_sub_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = tpa::simd::_mm_adds_epu32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = tpa::simd::_mm_subs_epu32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = tpa::simd::_mm_mul_epi32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm_div_epu32(_Ai, _Bi);
+											_DESTi = _mm_div_epu32(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm_rem_epu32(_Ai, _Bi);
+											_DESTi = _mm_rem_epu32(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										if (tpa::has_SSE41) [[likely]]
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
 										{
-											_DESTi = _mm_min_epu32(_Ai, _Bi);
+											if (tpa::has_SSE41) [[likely]] [&]() TPA_TARGET("sse4.1")
+											{
+												_DESTi = _mm_min_epu32(_Ai, _Bi);
+											}();//End if
+											else
+											{
+												break;
+											}//End else
 										}//End if
-										else
-										{
-											break;
-										}//End else
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										if (tpa::has_SSE41) [[likely]]
+										else if constexpr (INSTR == tpa::op::MAX)
 										{
-											_DESTi = _mm_max_epu32(_Ai, _Bi);
+											if (tpa::has_SSE41) [[likely]] [&]() TPA_TARGET("sse4.1")
+											{
+												_DESTi = _mm_max_epu32(_Ai, _Bi);
+											}();//End if
+											else
+											{
+												break;
+											}//End else
 										}//End if
-										else
+										else if constexpr (INSTR == tpa::op::AVERAGE)
 										{
-											break;
-										}//End else
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
 #ifdef TPA_HAS_SVML
-										const __m128i _TWO = _mm_set1_epi32(2);
+											const __m128i _TWO = _mm_set1_epi32(2);
 
-										_DESTi = _mm_add_epi32(_Ai, _Bi);
-										_DESTi = _mm_div_epu32(_DESTi, _TWO);
+											_DESTi = _mm_add_epi32(_Ai, _Bi);
+											_DESTi = _mm_div_epu32(_DESTi, _TWO);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
-										}();
-									}//End else
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
+											}();
+										}//End else
 
-									//Store Result
-									_mm_store_si128((__m128i*) & dest[i], _DESTi);
-								}//End for
-							}//End if has_SSE2
+										//Store Result
+										_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
+									}//End for
+								}//End if has_SSE2
 #elif defined(TPA_ARM)
-							if (tpa::hasNeon)
-							{
-								int32x4_t _Ai, _Bi, _DESTi;
-
-								for (; (i + 4uz) < end; i += 4uz)
+								if (tpa::hasNeon)
 								{
-									//Set Values
-									_Ai = vld1q_u32(&source1[i]);
-									_Bi = vld1q_u32(&source2[i]);
+									int32x4_t _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = vaddq_u32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = vsubq_u32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = vmulq_u32(_Ai, _Bi);;
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
+									for (; (i + 4uz) < end; i += 4uz)
 									{
-										break;
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = vminq_u32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = vmaxq_u32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										//Set Values
+										_Ai = vld1q_u32(&source1[i]);
+										_Bi = vld1q_u32(&source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
-										}();
-									}//End else
+											_DESTi = vaddq_u32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = vsubq_u32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = vqaddq_u32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = vqsubq_u32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = vmulq_u32(_Ai, _Bi);;
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
+											break;
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											_DESTi = vminq_u32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = vmaxq_u32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
+										{
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
+											}();
+										}//End else
 
-									//Store Result
-									vst1q_u32(&dest[i], _DESTi);
-								}//End for
-							}//End if hasNEON
+										//Store Result
+										vst1q_u32(&dest[i], _DESTi);
+									}//End for
+								}//End if hasNEON
 #endif													
-						}//End if
+							}//End if
 #pragma endregion
 #pragma region long
-						else if constexpr (std::is_same<T, int64_t>() && std::is_same<T2, int64_t>() && std::is_same<RES, int64_t>())
-						{
-#ifdef TPA_X86_64
-							if (tpa::hasAVX512)
+							else if constexpr (std::is_same<T, int64_t>() && std::is_same<T2, int64_t>() && std::is_same<RES, int64_t>())
 							{
-								__m512i _Ai, _Bi, _DESTi;
-
-								for (; (i+8uz) < end; i += 8uz)
+#ifdef TPA_X86_64
+								if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 								{
-									//Set Values
-									_Ai = _mm512_load_epi64((__m512i*)&source1[i]);
-									_Bi = _mm512_load_epi64((__m512i*)&source2[i]);
+									__m512i _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm512_add_epi64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm512_sub_epi64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
+									for (; (i+8uz) < end; i += 8uz)
 									{
+										//Set Values
+										_Ai = _mm512_loadu_epi64((__m512i*)&source1[i]);
+										_Bi = _mm512_loadu_epi64((__m512i*)&source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = _mm512_add_epi64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm512_sub_epi64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = tpa::simd::_mm512_adds_epi64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = tpa::simd::_mm512_subs_epi64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
 #ifdef __AVX512DQ__
-										_DESTi = _mm512_mullo_epi64(_Ai, _Bi);
+											_DESTi = _mm512_mullo_epi64(_Ai, _Bi);
 #else
-										_DESTi = _mm512_mullox_epi64(_Ai, _Bi);
+											_DESTi = _mm512_mullox_epi64(_Ai, _Bi);
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm512_div_epi64(_Ai, _Bi);
+											_DESTi = _mm512_div_epi64(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm512_rem_epi64(_Ai, _Bi);
+											_DESTi = _mm512_rem_epi64(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = _mm512_min_epi64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = _mm512_max_epi64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											_DESTi = _mm512_min_epi64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = _mm512_max_epi64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
 #ifdef TPA_HAS_SVML
-										const __m512i _TWO = _mm512_set1_epi64(2);
+											const __m512i _TWO = _mm512_set1_epi64(2);
 
-										_DESTi = _mm512_add_epi64(_Ai, _Bi);
-										_DESTi = _mm512_div_epi64(_DESTi, _TWO);
+											_DESTi = _mm512_add_epi64(_Ai, _Bi);
+											_DESTi = _mm512_div_epi64(_DESTi, _TWO);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int64_t>).");
-										}();
-									}//End else
-
-									//Store Result
-									_mm512_store_epi64((__m256i*) & dest[i], _DESTi);
-								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX2)
-							{
-								__m256i _Ai, _Bi, _DESTi;
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int64_t>).");
+											}();
+										}//End else
 
-								for (; (i+4uz) < end; i += 4uz)
+										//Store Result
+										_mm512_storeu_epi64((__m256i*) & dest[i], _DESTi);
+									}//End for
+								}();//End if hasAVX512
+								else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 								{
-									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
-									_Bi = _mm256_load_si256((__m256i*) & source2[i]);
+									__m256i _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm256_add_epi64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm256_sub_epi64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{										
-										_DESTi = tpa::simd::_mm256_mul_epi64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
+									for (; (i+4uz) < end; i += 4uz)
 									{
+										//Set Values
+										_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
+										_Bi = _mm256_loadu_si256((__m256i*) & source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = _mm256_add_epi64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm256_sub_epi64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = tpa::simd::_mm256_adds_epi64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = tpa::simd::_mm256_subs_epi64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{										
+											_DESTi = tpa::simd::_mm256_mul_epi64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm256_div_epi64(_Ai, _Bi);
+											_DESTi = _mm256_div_epi64(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm256_rem_epi64(_Ai, _Bi);
+											_DESTi = _mm256_rem_epi64(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
-#ifdef TPA_HAS_SVML
-										const __m256i _TWO = _mm256_set1_epi64x(2);
-
-										_DESTi = _mm256_add_epi64(_Ai, _Bi);
-										_DESTi = _mm256_div_epi64(_DESTi, _TWO);
-#else
-										break;
-#endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int64_t>).");
-										}();
-									}//End else
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
+#ifdef TPA_HAS_SVML
+											const __m256i _TWO = _mm256_set1_epi64x(2);
 
-									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
-								}//End for
-							}//End if hasAVX2
-							else if (tpa::has_SSE2)
-							{
-								__m128i _Ai, _Bi, _DESTi;
+											_DESTi = _mm256_add_epi64(_Ai, _Bi);
+											_DESTi = _mm256_div_epi64(_DESTi, _TWO);
+#else
+											break;
+#endif
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
+										{
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int64_t>).");
+											}();
+										}//End else
 
-								for (; (i + 2uz) < end; i += 2uz)
+										//Store Result
+										_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
+									}//End for
+								}();//End if hasAVX2
+								else if (tpa::has_SSE2)
 								{
-									//Set Values
-									_Ai = _mm_load_si128((__m128i*) & source1[i]);
-									_Bi = _mm_load_si128((__m128i*) & source2[i]);
+									__m128i _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm_add_epi64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
+									for (; (i + 2uz) < end; i += 2uz)
 									{
-										_DESTi = _mm_sub_epi64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										if (tpa::has_SSE41) [[likely]]
+										//Set Values
+										_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
+										_Bi = _mm_loadu_si128((__m128i*) & source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = _mm_add_epi64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm_sub_epi64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = tpa::simd::_mm_adds_epi64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = tpa::simd::_mm_subs_epi64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
 										{
 											_DESTi = tpa::simd::_mm_mul_epi64(_Ai, _Bi);
 										}//End if
-										else
+										else if constexpr (INSTR == tpa::op::DIVIDE)
 										{
-											break;
-										}//End else
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
-									{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm_div_epi64(_Ai, _Bi);
+											_DESTi = _mm_div_epi64(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm_rem_epi64(_Ai, _Bi);
+											_DESTi = _mm_rem_epi64(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
 #ifdef TPA_HAS_SVML
-										const __m128i _TWO = _mm_set1_epi64x(2);
+											const __m128i _TWO = _mm_set1_epi64x(2);
 
-										_DESTi = _mm_add_epi64(_Ai, _Bi);
-										_DESTi = _mm_div_epi64(_DESTi, _TWO);
+											_DESTi = _mm_add_epi64(_Ai, _Bi);
+											_DESTi = _mm_div_epi64(_DESTi, _TWO);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
-										}();
-									}//End else
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
+											}();
+										}//End else
 
-									//Store Result
-									_mm_store_si128((__m128i*) & dest[i], _DESTi);
-								}//End for
-							}//End if has_SSE2
+										//Store Result
+										_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
+									}//End for
+								}//End if has_SSE2
 #elif defined(TPA_ARM)
-							if (tpa::hasNeon)
-							{
-								int64x2_t _Ai, _Bi, _DESTi;
-
-								for (; (i + 2uz) < end; i += 2uz)
+								if (tpa::hasNeon)
 								{
-									//Set Values
-									_Ai = vld1q_s64(&source1[i]);
-									_Bi = vld1q_s64(&source2[i]);
+									int64x2_t _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = vaddq_s64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = vsubq_s64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
+									for (; (i + 2uz) < end; i += 2uz)
 									{
-										break;
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										//Set Values
+										_Ai = vld1q_s64(&source1[i]);
+										_Bi = vld1q_s64(&source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
-										}();
-									}//End else
+											_DESTi = vaddq_s64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = vsubq_s64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = vqaddq_s64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = vqsubq_s64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
+											break;
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
+										{
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
+											}();
+										}//End else
 
-									//Store Result
-									vst1q_s64(&dest[i], _DESTi);
-								}//End for
-							}//End if hasNEON
+										//Store Result
+										vst1q_s64(&dest[i], _DESTi);
+									}//End for
+								}//End if hasNEON
 #endif													
-						}//End if
+							}//End if
 #pragma endregion
 #pragma region unsigned long
-						else if constexpr (std::is_same<T, uint64_t>() && std::is_same<T2, uint64_t>() && std::is_same<RES, uint64_t>())
-						{
-#ifdef TPA_X86_64
-							if (tpa::hasAVX512)
+							else if constexpr (std::is_same<T, uint64_t>() && std::is_same<T2, uint64_t>() && std::is_same<RES, uint64_t>())
 							{
-								__m512i _Ai, _Bi, _DESTi;
-
-								for (; (i+8uz) < end; i += 8uz)
+#ifdef TPA_X86_64
+								if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 								{
-									//Set Values
-									_Ai = _mm512_load_epi64((__m512i*)&source1[i]);
-									_Bi = _mm512_load_epi64((__m512i*)&source2[i]);
+									__m512i _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm512_add_epi64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm512_sub_epi64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
+									for (; (i+8uz) < end; i += 8uz)
 									{
+										//Set Values
+										_Ai = _mm512_loadu_epi64((__m512i*)&source1[i]);
+										_Bi = _mm512_loadu_epi64((__m512i*)&source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = _mm512_add_epi64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm512_sub_epi64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = tpa::simd::_mm512_adds_epu64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = tpa::simd::_mm512_subs_epu64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
 #ifdef __AVX512DQ__
-										_DESTi = _mm512_mullo_epi64(_Ai, _Bi);
+											_DESTi = _mm512_mullo_epi64(_Ai, _Bi);
 #else
-										_DESTi = _mm512_mullox_epi64(_Ai, _Bi);
+											_DESTi = _mm512_mullox_epi64(_Ai, _Bi);
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm512_div_epu64(_Ai, _Bi);
+											_DESTi = _mm512_div_epu64(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm512_rem_epu64(_Ai, _Bi);
+											_DESTi = _mm512_rem_epu64(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = _mm512_min_epu64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = _mm512_max_epu64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											_DESTi = _mm512_min_epu64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = _mm512_max_epu64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
 #ifdef TPA_HAS_SVML
-										const __m512i _TWO = _mm512_set1_epi64(2);
+											const __m512i _TWO = _mm512_set1_epi64(2);
 
-										_DESTi = _mm512_add_epi64(_Ai, _Bi);
-										_DESTi = _mm512_div_epu64(_DESTi, _TWO);
+											_DESTi = _mm512_add_epi64(_Ai, _Bi);
+											_DESTi = _mm512_div_epu64(_DESTi, _TWO);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<uint64_t>).");
-										}();
-									}//End else
-
-									//Store Result
-									_mm512_store_epi64((__m256i*) & dest[i], _DESTi);
-								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX2)
-							{
-								__m256i _Ai, _Bi, _DESTi;
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<uint64_t>).");
+											}();
+										}//End else
 
-								for (; (i+4uz) < end; i += 4uz)
+										//Store Result
+										_mm512_storeu_epi64((__m256i*) & dest[i], _DESTi);
+									}//End for
+								}();//End if hasAVX512
+								else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 								{
-									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
-									_Bi = _mm256_load_si256((__m256i*) & source2[i]);
+									__m256i _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm256_add_epi64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm256_sub_epi64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = tpa::simd::_mm256_mul_epi64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
+									for (; (i+4uz) < end; i += 4uz)
 									{
+										//Set Values
+										_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
+										_Bi = _mm256_loadu_si256((__m256i*) & source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = _mm256_add_epi64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm256_sub_epi64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = tpa::simd::_mm256_adds_epu64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = tpa::simd::_mm256_subs_epu64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = tpa::simd::_mm256_mul_epi64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm256_div_epu64(_Ai, _Bi);
+											_DESTi = _mm256_div_epu64(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm256_rem_epu64(_Ai, _Bi);
+											_DESTi = _mm256_rem_epu64(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
 #ifdef TPA_HAS_SVML
-										const __m256i _TWO = _mm256_set1_epi64x(2);
+											const __m256i _TWO = _mm256_set1_epi64x(2);
 
-										_DESTi = _mm256_add_epi64(_Ai, _Bi);
-										_DESTi = _mm256_div_epu64(_DESTi, _TWO);
+											_DESTi = _mm256_add_epi64(_Ai, _Bi);
+											_DESTi = _mm256_div_epu64(_DESTi, _TWO);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<uint64_t>).");
-										}();
-									}//End else
-
-									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
-								}//End for
-							}//End if hasAVX2
-							else if (tpa::has_SSE2)
-							{
-								__m128i _Ai, _Bi, _DESTi;
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<uint64_t>).");
+											}();
+										}//End else
 
-								for (; (i + 2uz) < end; i += 2uz)
+										//Store Result
+										_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
+									}//End for
+								}();//End if hasAVX2
+								else if (tpa::has_SSE2)
 								{
-									//Set Values
-									_Ai = _mm_load_si128((__m128i*) & source1[i]);
-									_Bi = _mm_load_si128((__m128i*) & source2[i]);
+									__m128i _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm_add_epi64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm_sub_epi64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
+									for (; (i + 2uz) < end; i += 2uz)
 									{
-										if (tpa::has_SSE41) [[likely]]
+										//Set Values
+										_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
+										_Bi = _mm_loadu_si128((__m128i*) & source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = _mm_add_epi64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm_sub_epi64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											if (tpa::has_SSE42) [[likely]] [&]() TPA_TARGET("sse4.2")
+											{
+												_DESTi = tpa::simd::_mm_adds_epu64(_Ai, _Bi);
+											}();//End if
+											else
+											{
+												break;
+											}//End else
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											if (tpa::has_SSE42) [[likely]] [&]() TPA_TARGET("sse4.2")
+											{
+												_DESTi = tpa::simd::_mm_subs_epu64(_Ai, _Bi);
+											}();//End if
+											else
+											{
+												break;
+											}//End else
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
 										{
 											_DESTi = tpa::simd::_mm_mul_epi64(_Ai, _Bi);
 										}//End if
-										else
+										else if constexpr (INSTR == tpa::op::DIVIDE)
 										{
-											break;
-										}//End else
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
-									{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm_div_epu64(_Ai, _Bi);
+											_DESTi = _mm_div_epu64(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
 #ifdef TPA_HAS_SVML
-										_DESTi = _mm_rem_epu64(_Ai, _Bi);
+											_DESTi = _mm_rem_epu64(_Ai, _Bi);
 #else
-										break;
+											break;
 #endif
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
 #ifdef TPA_HAS_SVML
-										const __m128i _TWO = _mm_set1_epi64x(2);
+											const __m128i _TWO = _mm_set1_epi64x(2);
 
-										_DESTi = _mm_add_epi64(_Ai, _Bi);
-										_DESTi = _mm_div_epu64(_DESTi, _TWO);
+											_DESTi = _mm_add_epi64(_Ai, _Bi);
+											_DESTi = _mm_div_epu64(_DESTi, _TWO);
 #else
-										break;
+											break;
 #endif
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
-										}();
-									}//End else
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
+											}();
+										}//End else
 
-									//Store Result
-									_mm_store_si128((__m128i*) & dest[i], _DESTi);
-								}//End for
-							}//End if has_SSE2
+										//Store Result
+										_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
+									}//End for
+								}//End if has_SSE2
 #elif defined(TPA_ARM)
-							if (tpa::hasNeon)
+								if (tpa::hasNeon)
+								{
+									int64x2_t _Ai, _Bi, _DESTi;
+
+									for (; (i + 2uz) < end; i += 2uz)
+									{
+										//Set Values
+										_Ai = vld1q_u64(&source1[i]);
+										_Bi = vld1q_u64(&source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
+										{
+											_DESTi = vaddq_u64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = vsubq_u64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = vqaddq_u64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = vqsubq_u64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
+											break;
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
+										{
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
+											}();
+										}//End else
+
+										//Store Result
+										vst1q_u64(&dest[i], _DESTi);
+									}//End for
+								}//End if hasNEON
+#endif								
+							}//End if
+#pragma endregion
+#pragma region half
+//'short float' (P0192) is not implemented by any compiler yet, define TPA_SHORT_FLOAT once it is
+#if defined(TPA_SHORT_FLOAT)
+							else if constexpr (std::is_same<T, short float>() && std::is_same<T2, short float>() && std::is_same<RES, short float>())
+							{
+#ifdef TPA_X86_64
+							if (allow512 && tpa::hasAVX512_FP16) [&]() TPA_TARGET("avx512fp16")
 							{
-								int64x2_t _Ai, _Bi, _DESTi;
+								__m512h _Ai, _Bi, _DESTi;
 
-								for (; (i + 2uz) < end; i += 2uz)
+								for (; (i + 32uz) < end; i += 32uz)
 								{
 									//Set Values
-									_Ai = vld1q_u64(&source1[i]);
-									_Bi = vld1q_u64(&source2[i]);
+									_Ai = _mm512_load_ph(&source1[i]);
+									_Bi = _mm512_load_ph(&source2[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::op::ADD)
 									{
-										_DESTi = vaddq_u64(_Ai, _Bi);
+										_DESTi = _mm512_add_ph(_Ai, _Bi);
 									}//End if
 									else if constexpr (INSTR == tpa::op::SUBTRACT)
 									{
-										_DESTi = vsubq_u64(_Ai, _Bi);
+										_DESTi = _mm512_sub_ph(_Ai, _Bi);
+									}//End if
+									else if constexpr (INSTR == tpa::op::ADD_SAT)
+									{
+										_DESTi = _mm512_add_ph(_Ai, _Bi);
+									}//End if
+									else if constexpr (INSTR == tpa::op::SUB_SAT)
+									{
+										_DESTi = _mm512_sub_ph(_Ai, _Bi);
 									}//End if
 									else if constexpr (INSTR == tpa::op::MULTIPLY)
 									{
-										break;
+										_DESTi = _mm512_mul_ph(_Ai, _Bi);
 									}//End if
 									else if constexpr (INSTR == tpa::op::DIVIDE)
 									{
-										break;
+										_DESTi = _mm512_div_ph(_Ai, _Bi);
 									}//End if
 									else if constexpr (INSTR == tpa::op::MODULO)
 									{
@@ -2485,11 +2837,11 @@ if (tpa::hasNeon)
 									}//End if									
 									else if constexpr (INSTR == tpa::op::MIN)
 									{
-										break;
+										_DESTi = _mm512_min_ph(_Ai, _Bi);
 									}//End if
 									else if constexpr (INSTR == tpa::op::MAX)
 									{
-										break;
+										_DESTi = _mm512_max_ph(_Ai, _Bi);
 									}//End if
 									else if constexpr (INSTR == tpa::op::AVERAGE)
 									{
@@ -2508,702 +2860,741 @@ if (tpa::hasNeon)
 									}//End else
 
 									//Store Result
-									vst1q_u64(&dest[i], _DESTi);
+									_mm512_store_ph(&dest[i], _DESTi);
 								}//End for
-							}//End if hasNEON
-#endif								
-						}//End if
-#pragma endregion
-#pragma region half
-#if !defined(_MSC_VER)
-						else if constexpr (std::is_same<T, short float>() && std::is_same<T2, short float>() && std::is_same<RES, short float>())
-						{
-#ifdef TPA_X86_64
-						if (tpa::hasAVX512_FP16)
-						{
-							__m512h _Ai, _Bi, _DESTi;
+							}();//End if hasAVX512-FP16
+#elif defined(TPA_ARM)
+								if (tpa::hasNeon)
+								{
+									float16x8_t _Ai, _Bi, _DESTi;
 
-							for (; (i + 32uz) < end; i += 32uz)
-							{
-								//Set Values
-								_Ai = _mm512_load_ph(&source1[i]);
-								_Bi = _mm512_load_ph(&source2[i]);
+									for (; (i + 8uz) < end; i += 8uz)
+									{
+										//Set Values
+										_Ai = vld1_f16(&source1[i]);
+										_Bi = vld1_f16(&source2[i]);
 
-								//Calc
-								if constexpr (INSTR == tpa::op::ADD)
-								{
-									_DESTi = _mm512_add_ph(_Ai, _Bi);
-								}//End if
-								else if constexpr (INSTR == tpa::op::SUBTRACT)
-								{
-									_DESTi = _mm512_sub_ph(_Ai, _Bi);
-								}//End if
-								else if constexpr (INSTR == tpa::op::MULTIPLY)
-								{
-									_DESTi = _mm512_mul_ph(_Ai, _Bi);
-								}//End if
-								else if constexpr (INSTR == tpa::op::DIVIDE)
-								{
-									_DESTi = _mm512_div_ph(_Ai, _Bi);
-								}//End if
-								else if constexpr (INSTR == tpa::op::MODULO)
-								{
-									break;
-								}//End if									
-								else if constexpr (INSTR == tpa::op::MIN)
-								{
-									_DESTi = _mm512_min_ph(_Ai, _Bi);
-								}//End if
-								else if constexpr (INSTR == tpa::op::MAX)
-								{
-									_DESTi = _mm512_max_ph(_Ai, _Bi);
-								}//End if
-								else if constexpr (INSTR == tpa::op::AVERAGE)
-								{
-									break;
-								}//End if
-								else if constexpr (INSTR == tpa::op::POWER)
-								{
-									break;
-								}//End if
-								else
-								{
-									[] <bool flag = false>()
-									{
-										static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
-									}();
-								}//End else
-
-								//Store Result
-								_mm512_store_ph(&dest[i], _DESTi);
-							}//End for
-						}//End if hasAVX512-FP16
-#elif defined(TPA_ARM)
-							if (tpa::hasNeon)
-							{
-								float16x8_t _Ai, _Bi, _DESTi;
-
-								for (; (i + 8uz) < end; i += 8uz)
-								{
-									//Set Values
-									_Ai = vld1_f16(&source1[i]);
-									_Bi = vld1_f16(&source2[i]);
-
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = vaddq_f16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = vsubq_f16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = vmulq_f16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
-									{
-										_DESTi = vdivq_f16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
-										break;
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = vminq_f16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = vmaxq_f16(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
-										}();
-									}//End else
+											_DESTi = vaddq_f16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = vsubq_f16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = vaddq_f16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = vsubq_f16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = vmulq_f16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
+											_DESTi = vdivq_f16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
+											break;
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											_DESTi = vminq_f16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = vmaxq_f16(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
+										{
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
+											}();
+										}//End else
 
-									//Store Result
-									vst1_f16(&dest[i], _DESTi);
-								}//End for
-							}//End if hasNEON
+										//Store Result
+										vst1_f16(&dest[i], _DESTi);
+									}//End for
+								}//End if hasNEON
 #endif
-						}//End if
+							}//End if
 #endif
 #pragma endregion
 #pragma region float
-						else if constexpr (std::is_same<T, float>() && std::is_same<T2, float>() && std::is_same<RES, float>())
-						{
-#ifdef TPA_X86_64
-							if (tpa::hasAVX512)
+							else if constexpr (std::is_same<T, float>() && std::is_same<T2, float>() && std::is_same<RES, float>())
 							{
-								__m512 _Ai, _Bi, _DESTi;
-
-								for (; (i+16uz) < end; i += 16uz)
+#ifdef TPA_X86_64
+								if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 								{
-									//Set Values
-									_Ai = _mm512_load_ps(&source1[i]);
-									_Bi = _mm512_load_ps(&source2[i]);
+									__m512 _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
+									for (; (i+16uz) < end; i += 16uz)
 									{
-										_DESTi = _mm512_add_ps(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm512_sub_ps(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = _mm512_mul_ps(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
-									{
-										_DESTi = _mm512_div_ps(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
-										break; //Use fmod
-									}//End if		
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = _mm512_min_ps(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = _mm512_max_ps(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
-										const __m512 _TWO = _mm512_set1_ps(2.0f);
+										//Set Values
+										_Ai = _mm512_loadu_ps(&source1[i]);
+										_Bi = _mm512_loadu_ps(&source2[i]);
 
-										_DESTi = _mm512_add_ps(_Ai, _Bi);
-										_DESTi = _mm512_div_ps(_DESTi, _TWO);
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										_DESTi = _mm512_pow_ps(_Ai, _Bi);
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<float>).");
-										}();
-									}//End else
+											_DESTi = _mm512_add_ps(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm512_sub_ps(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = _mm512_add_ps(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = _mm512_sub_ps(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = _mm512_mul_ps(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
+											_DESTi = _mm512_div_ps(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
+											break; //Use fmod
+										}//End if		
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											_DESTi = _mm512_min_ps(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = _mm512_max_ps(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
+											const __m512 _TWO = _mm512_set1_ps(2.0f);
 
-									//Store Result
-									_mm512_store_ps(&dest[i], _DESTi);
-								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX)
-							{
-								__m256 _Ai, _Bi, _DESTi;
+											_DESTi = _mm512_add_ps(_Ai, _Bi);
+											_DESTi = _mm512_div_ps(_DESTi, _TWO);
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
+										{
+#ifdef TPA_HAS_SVML
+											_DESTi = _mm512_pow_ps(_Ai, _Bi);
+#else
+											break;
+#endif
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<float>).");
+											}();
+										}//End else
 
-								for (; (i+8uz) < end; i += 8uz)
+										//Store Result
+										_mm512_storeu_ps(&dest[i], _DESTi);
+									}//End for
+								}();//End if hasAVX512
+								else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
 								{
-									//Set Values
-									_Ai = _mm256_load_ps(&source1[i]);
-									_Bi = _mm256_load_ps(&source2[i]);
+									__m256 _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm256_add_ps(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm256_sub_ps(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = _mm256_mul_ps(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
-									{
-										_DESTi = _mm256_div_ps(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
-										break; //Use fmod
-									}//End if	
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = _mm256_min_ps(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = _mm256_max_ps(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
+									for (; (i+8uz) < end; i += 8uz)
 									{
-										const __m256 _TWO = _mm256_set1_ps(2.0f);
+										//Set Values
+										_Ai = _mm256_loadu_ps(&source1[i]);
+										_Bi = _mm256_loadu_ps(&source2[i]);
 
-										_DESTi = _mm256_add_ps(_Ai, _Bi);
-										_DESTi = _mm256_div_ps(_DESTi, _TWO);
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										_DESTi = _mm256_pow_ps(_Ai, _Bi);
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<float>).");
-										}();
-									}//End else
+											_DESTi = _mm256_add_ps(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm256_sub_ps(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = _mm256_add_ps(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = _mm256_sub_ps(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = _mm256_mul_ps(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
+											_DESTi = _mm256_div_ps(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
+											break; //Use fmod
+										}//End if	
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											_DESTi = _mm256_min_ps(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = _mm256_max_ps(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
+											const __m256 _TWO = _mm256_set1_ps(2.0f);
 
-									//Store Result
-									_mm256_store_ps(&dest[i], _DESTi);
-								}//End for
-							}//End if hasAVX2
-							else if (tpa::has_SSE)
-							{
-								__m128 _Ai, _Bi, _DESTi;
+											_DESTi = _mm256_add_ps(_Ai, _Bi);
+											_DESTi = _mm256_div_ps(_DESTi, _TWO);
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
+										{
+#ifdef TPA_HAS_SVML
+											_DESTi = _mm256_pow_ps(_Ai, _Bi);
+#else
+											break;
+#endif
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<float>).");
+											}();
+										}//End else
 
-								for (; (i + 4uz) < end; i += 4uz)
+										//Store Result
+										_mm256_storeu_ps(&dest[i], _DESTi);
+									}//End for
+								}();//End if hasAVX2
+								else if (tpa::has_SSE)
 								{
-									//Set Values
-									_Ai = _mm_load_ps(&source1[i]);
-									_Bi = _mm_load_ps(&source2[i]);
+									__m128 _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm_add_ps(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm_sub_ps(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = _mm_mul_ps(_Ai, _Bi);						
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
-									{
-										_DESTi = _mm_div_ps(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
-										break;
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
+									for (; (i + 4uz) < end; i += 4uz)
 									{
-										_DESTi = _mm_min_ps(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = _mm_max_ps(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
-										const __m128i _TWO = _mm_set1_ps(2.0f);
+										//Set Values
+										_Ai = _mm_loadu_ps(&source1[i]);
+										_Bi = _mm_loadu_ps(&source2[i]);
 
-										_DESTi = _mm_add_ps(_Ai, _Bi);
-										_DESTi = _mm_div_ps(_DESTi, _TWO);
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										_DESTi = _mm_pow_ps(_Ai, _Bi);
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<float>).");
-										}();
-									}//End else
+											_DESTi = _mm_add_ps(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm_sub_ps(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = _mm_add_ps(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = _mm_sub_ps(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = _mm_mul_ps(_Ai, _Bi);						
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
+											_DESTi = _mm_div_ps(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
+											break;
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											_DESTi = _mm_min_ps(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = _mm_max_ps(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
+											const __m128 _TWO = _mm_set1_ps(2.0f);
 
-									//Store Result
-									_mm_store_ps(&dest[i], _DESTi);
-								}//End for
-							}//End if has_SSE
-#elif defined(TPA_ARM)
-							if (tpa::hasNeon)
-							{
-								float32x4_t _Ai, _Bi, _DESTi;
+											_DESTi = _mm_add_ps(_Ai, _Bi);
+											_DESTi = _mm_div_ps(_DESTi, _TWO);
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
+										{
+#ifdef TPA_HAS_SVML
+											_DESTi = _mm_pow_ps(_Ai, _Bi);
+#else
+											break;
+#endif
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<float>).");
+											}();
+										}//End else
 
-								for (; (i + 4uz) < end; i += 4uz)
+										//Store Result
+										_mm_storeu_ps(&dest[i], _DESTi);
+									}//End for
+								}//End if has_SSE
+#elif defined(TPA_ARM)
+								if (tpa::hasNeon)
 								{
-									//Set Values
-									_Ai = vld1q_f32(&source1[i]);
-									_Bi = vld1q_f32(&source2[i]);
+									float32x4_t _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = vaddq_f32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = vsubq_f32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = vmulq_f32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
-									{
-										_DESTi = vdivq_f32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
-										break;
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = vminq_f32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = vmaxq_f32(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										break;
-									}//End if
-									else
+									for (; (i + 4uz) < end; i += 4uz)
 									{
-										[] <bool flag = false>()
+										//Set Values
+										_Ai = vld1q_f32(&source1[i]);
+										_Bi = vld1q_f32(&source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
-										}();
-									}//End else
+											_DESTi = vaddq_f32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = vsubq_f32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = vaddq_f32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = vsubq_f32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = vmulq_f32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
+											_DESTi = vdivq_f32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
+											break;
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											_DESTi = vminq_f32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = vmaxq_f32(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
+										{
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
+											}();
+										}//End else
 
-									//Store Result
-									vst1q_f32(&dest[i], _DESTi);
-								}//End for
-							}//End if hasNEON
+										//Store Result
+										vst1q_f32(&dest[i], _DESTi);
+									}//End for
+								}//End if hasNEON
 #endif							
-						}//End if
+							}//End if
 #pragma endregion
 #pragma region double
-						else if constexpr (std::is_same<T, double>() && std::is_same<T2, double>() && std::is_same<RES, double>())
-						{
-#ifdef TPA_X86_64
-							if (tpa::hasAVX512)
+							else if constexpr (std::is_same<T, double>() && std::is_same<T2, double>() && std::is_same<RES, double>())
 							{
-								__m512d _Ai, _Bi, _DESTi;
-
-								for (; (i+8uz) < end; i += 8uz)
+#ifdef TPA_X86_64
+								if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 								{
-									//Set Values
-									_Ai = _mm512_load_pd(&source1[i]);
-									_Bi = _mm512_load_pd(&source2[i]);
+									__m512d _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
+									for (; (i+8uz) < end; i += 8uz)
 									{
-										_DESTi = _mm512_add_pd(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm512_sub_pd(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = _mm512_mul_pd(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
-									{
-										_DESTi = _mm512_div_pd(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
-										break; //Use fmod
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = _mm512_min_pd(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = _mm512_max_pd(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
-										const __m512d _TWO = _mm512_set1_pd(2.0);
+										//Set Values
+										_Ai = _mm512_loadu_pd(&source1[i]);
+										_Bi = _mm512_loadu_pd(&source2[i]);
 
-										_DESTi = _mm512_add_pd(_Ai, _Bi);
-										_DESTi = _mm512_div_pd(_DESTi, _TWO);
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										_DESTi = _mm512_pow_pd(_Ai, _Bi);
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<double>).");
-										}();
-									}//End else
+											_DESTi = _mm512_add_pd(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm512_sub_pd(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = _mm512_add_pd(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = _mm512_sub_pd(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = _mm512_mul_pd(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
+											_DESTi = _mm512_div_pd(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
+											break; //Use fmod
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											_DESTi = _mm512_min_pd(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = _mm512_max_pd(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
+											const __m512d _TWO = _mm512_set1_pd(2.0);
 
-									//Store Result
-									_mm512_store_pd(&dest[i], _DESTi);
-								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX)
-							{
-								__m256d _Ai, _Bi, _DESTi;
+											_DESTi = _mm512_add_pd(_Ai, _Bi);
+											_DESTi = _mm512_div_pd(_DESTi, _TWO);
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
+										{
+#ifdef TPA_HAS_SVML
+											_DESTi = _mm512_pow_pd(_Ai, _Bi);
+#else
+											break;
+#endif
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<double>).");
+											}();
+										}//End else
 
-								for (; (i+4uz) < end; i += 4uz)
+										//Store Result
+										_mm512_storeu_pd(&dest[i], _DESTi);
+									}//End for
+								}();//End if hasAVX512
+								else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
 								{
-									//Set Values
-									_Ai = _mm256_load_pd(&source1[i]);
-									_Bi = _mm256_load_pd(&source2[i]);
+									__m256d _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm256_add_pd(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm256_sub_pd(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = _mm256_mul_pd(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
-									{
-										_DESTi = _mm256_div_pd(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
-										break; //Use fmod
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = _mm256_min_pd(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = _mm256_max_pd(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
+									for (; (i+4uz) < end; i += 4uz)
 									{
-										const __m256d _TWO = _mm256_set1_pd(2.0);
+										//Set Values
+										_Ai = _mm256_loadu_pd(&source1[i]);
+										_Bi = _mm256_loadu_pd(&source2[i]);
 
-										_DESTi = _mm256_add_pd(_Ai, _Bi);
-										_DESTi = _mm256_div_pd(_DESTi, _TWO);
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										_DESTi = _mm256_pow_pd(_Ai, _Bi);
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<double>).");
-										}();
-									}//End else
+											_DESTi = _mm256_add_pd(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm256_sub_pd(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = _mm256_add_pd(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = _mm256_sub_pd(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = _mm256_mul_pd(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
+											_DESTi = _mm256_div_pd(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
+											break; //Use fmod
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											_DESTi = _mm256_min_pd(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = _mm256_max_pd(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
+											const __m256d _TWO = _mm256_set1_pd(2.0);
 
-									//Store Result
-									_mm256_store_pd(&dest[i], _DESTi);
-								}//End for
-							}//End if hasAVX
-							else if (tpa::has_SSE2)
-							{
-								__m128d _Ai, _Bi, _DESTi;
+											_DESTi = _mm256_add_pd(_Ai, _Bi);
+											_DESTi = _mm256_div_pd(_DESTi, _TWO);
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
+										{
+#ifdef TPA_HAS_SVML
+											_DESTi = _mm256_pow_pd(_Ai, _Bi);
+#else
+											break;
+#endif
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<double>).");
+											}();
+										}//End else
 
-								for (; (i + 2uz) < end; i += 2uz)
+										//Store Result
+										_mm256_storeu_pd(&dest[i], _DESTi);
+									}//End for
+								}();//End if hasAVX
+								else if (tpa::has_SSE2)
 								{
-									//Set Values
-									_Ai = _mm_load_pd(&source1[i]);
-									_Bi = _mm_load_pd(&source2[i]);
+									__m128d _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = _mm_add_pd(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = _mm_sub_pd(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = _mm_mul_pd(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
-									{
-										_DESTi = _mm_div_pd(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
-										break;
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
+									for (; (i + 2uz) < end; i += 2uz)
 									{
-										_DESTi = _mm_min_pd(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = _mm_max_pd(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
-										const __m128i _TWO = _mm_set1_pd(2.0);
+										//Set Values
+										_Ai = _mm_loadu_pd(&source1[i]);
+										_Bi = _mm_loadu_pd(&source2[i]);
 
-										_DESTi = _mm_add_pd(_Ai, _Bi);
-										_DESTi = _mm_div_pd(_DESTi, _TWO);
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
-									{
-										_DESTi = _mm_pow_pd(_Ai, _Bi);
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<double>).");
-										}();
-									}//End else
+											_DESTi = _mm_add_pd(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = _mm_sub_pd(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = _mm_add_pd(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = _mm_sub_pd(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = _mm_mul_pd(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
+											_DESTi = _mm_div_pd(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
+											break;
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											_DESTi = _mm_min_pd(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = _mm_max_pd(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
+											const __m128d _TWO = _mm_set1_pd(2.0);
 
-									//Store Result
-									_mm_store_pd(&dest[i], _DESTi);
-								}//End for
-							}//End if has_SSE2
-#elif defined(TPA_ARM)
-							if (tpa::hasNeon)
-							{
-								float64x2_t _Ai, _Bi, _DESTi;
+											_DESTi = _mm_add_pd(_Ai, _Bi);
+											_DESTi = _mm_div_pd(_DESTi, _TWO);
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
+										{
+#ifdef TPA_HAS_SVML
+											_DESTi = _mm_pow_pd(_Ai, _Bi);
+#else
+											break;
+#endif
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<double>).");
+											}();
+										}//End else
 
-								for (; (i + 2uz) < end; i += 2uz)
+										//Store Result
+										_mm_storeu_pd(&dest[i], _DESTi);
+									}//End for
+								}//End if has_SSE2
+#elif defined(TPA_ARM)
+								if (tpa::hasNeon)
 								{
-									//Set Values
-									_Ai = vld1q_f64(&source1[i]);
-									_Bi = vld1q_f64(&source2[i]);
+									float64x2_t _Ai, _Bi, _DESTi;
 
-									//Calc
-									if constexpr (INSTR == tpa::op::ADD)
-									{
-										_DESTi = vaddq_f64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::SUBTRACT)
-									{
-										_DESTi = vsubq_f64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MULTIPLY)
-									{
-										_DESTi = vmulq_f64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::DIVIDE)
-									{
-										_DESTi = vdivq_f64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MODULO)
-									{
-										break;
-									}//End if									
-									else if constexpr (INSTR == tpa::op::MIN)
-									{
-										_DESTi = vminq_f64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::MAX)
-									{
-										_DESTi = vmaxq_f64(_Ai, _Bi);
-									}//End if
-									else if constexpr (INSTR == tpa::op::AVERAGE)
-									{
-										break;
-									}//End if
-									else if constexpr (INSTR == tpa::op::POWER)
+									for (; (i + 2uz) < end; i += 2uz)
 									{
-										break;
-									}//End if
-									else
-									{
-										[] <bool flag = false>()
+										//Set Values
+										_Ai = vld1q_f64(&source1[i]);
+										_Bi = vld1q_f64(&source2[i]);
+
+										//Calc
+										if constexpr (INSTR == tpa::op::ADD)
 										{
-											static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
-										}();
-									}//End else
+											_DESTi = vaddq_f64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUBTRACT)
+										{
+											_DESTi = vsubq_f64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::ADD_SAT)
+										{
+											_DESTi = vaddq_f64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::SUB_SAT)
+										{
+											_DESTi = vsubq_f64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MULTIPLY)
+										{
+											_DESTi = vmulq_f64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::DIVIDE)
+										{
+											_DESTi = vdivq_f64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MODULO)
+										{
+											break;
+										}//End if									
+										else if constexpr (INSTR == tpa::op::MIN)
+										{
+											_DESTi = vminq_f64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::MAX)
+										{
+											_DESTi = vmaxq_f64(_Ai, _Bi);
+										}//End if
+										else if constexpr (INSTR == tpa::op::AVERAGE)
+										{
+											break;
+										}//End if
+										else if constexpr (INSTR == tpa::op::POWER)
+										{
+											break;
+										}//End if
+										else
+										{
+											[] <bool flag = false>()
+											{
+												static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<int8_t>).");
+											}();
+										}//End else
 
-									//Store Result
-									vst1q_f64(&dest[i], _DESTi);
-								}//End for
-							}//End if hasNEON
+										//Store Result
+										vst1q_f64(&dest[i], _DESTi);
+									}//End for
+								}//End if hasNEON
 #endif					
-						}//End if
+							}//End if
 #pragma endregion
 #pragma region generic
-						for (; i != end; ++i)
-						{
-							//Calc
-							if constexpr (INSTR == tpa::op::ADD)
-							{
-								dest[i] = static_cast<RES>(source1[i] + source2[i]);
-							}//End if
-							else if constexpr (INSTR == tpa::op::SUBTRACT)
-							{
-								dest[i] = static_cast<RES>(source1[i] - source2[i]);
-							}//End if
-							else if constexpr (INSTR == tpa::op::MULTIPLY)
-							{
-								dest[i] = static_cast<RES>(source1[i] * source2[i]);
-							}//End if
-							else if constexpr (INSTR == tpa::op::DIVIDE)
-							{
-								dest[i] = static_cast<RES>(source1[i] / source2[i]);
-							}//End if
-							else if constexpr (INSTR == tpa::op::MODULO)
+							for (; i != end; ++i)
 							{
-								if constexpr (std::is_floating_point<T>())
+								//Calc
+								if constexpr (INSTR == tpa::op::ADD)
+								{
+									dest[i] = static_cast<RES>(source1[i] + source2[i]);
+								}//End if
+								else if constexpr (INSTR == tpa::op::SUBTRACT)
+								{
+									dest[i] = static_cast<RES>(source1[i] - source2[i]);
+								}//End if
+								else if constexpr (INSTR == tpa::op::ADD_SAT)
+								{
+									dest[i] = static_cast<RES>(tpa::util::add_sat<T>(source1[i], static_cast<T>(source2[i])));
+								}//End if
+								else if constexpr (INSTR == tpa::op::SUB_SAT)
+								{
+									dest[i] = static_cast<RES>(tpa::util::sub_sat<T>(source1[i], static_cast<T>(source2[i])));
+								}//End if
+								else if constexpr (INSTR == tpa::op::MULTIPLY)
+								{
+									dest[i] = static_cast<RES>(source1[i] * source2[i]);
+								}//End if
+								else if constexpr (INSTR == tpa::op::DIVIDE)
+								{
+									dest[i] = static_cast<RES>(source1[i] / source2[i]);
+								}//End if
+								else if constexpr (INSTR == tpa::op::MODULO)
+								{
+									if constexpr (std::is_floating_point<T>())
+									{
+										dest[i] = static_cast<RES>(std::fmod(source1[i], source2[i]));
+									}//End if
+									else
+									{
+										dest[i] = static_cast<RES>(source1[i] % source2[i]);
+									}//End else
+								}//end if							
+								else if constexpr (INSTR == tpa::op::MIN)
+								{
+									dest[i] = static_cast<RES>(tpa::util::min(source1[i], source2[i]));
+								}//End if
+								else if constexpr (INSTR == tpa::op::MAX)
+								{
+									dest[i] = static_cast<RES>(tpa::util::max(source1[i], source2[i]));
+								}//End if
+								else if constexpr (INSTR == tpa::op::AVERAGE)
 								{
-									dest[i] = static_cast<RES>(std::fmod(source1[i], source2[i]));
+									dest[i] = static_cast<RES>((source1[i] + source2[i]) / static_cast<T>(2));
+								}//End if
+								else if constexpr (INSTR == tpa::op::POWER)
+								{
+									dest[i] = static_cast<RES>(tpa::util::pow(source1[i], source2[i]));
 								}//End if
 								else
 								{
-									dest[i] = static_cast<RES>(source1[i] % source2[i]);
+									[] <bool flag = false>()
+									{
+										static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<T>).");
+									}();
 								}//End else
-							}//end if							
-							else if constexpr (INSTR == tpa::op::MIN)
-							{
-								dest[i] = static_cast<RES>(tpa::util::min(source1[i], source2[i]));
-							}//End if
-							else if constexpr (INSTR == tpa::op::MAX)
-							{
-								dest[i] = static_cast<RES>(tpa::util::max(source1[i], source2[i]));
-							}//End if
-							else if constexpr (INSTR == tpa::op::AVERAGE)
-							{
-								dest[i] = static_cast<RES>((source1[i] + source2[i]) / static_cast<T>(2));
-							}//End if
-							else if constexpr (INSTR == tpa::op::POWER)
-							{
-								dest[i] = static_cast<RES>(tpa::util::pow(source1[i], source2[i]));
-							}//End if
-							else
-							{
-								[] <bool flag = false>()
-								{
-									static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::calculate<__UNDEFINED_PREDICATE__>(CONTAINER<T>).");
-								}();
-							}//End else
-						}//End for
+							}//End for
 #pragma endregion
+						}//End for
+
 						return static_cast<uint32_t>(1);
 					});//End of lambda
 
@@ -3222,14 +3613,6 @@ if (tpa::hasNeon)
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::calculate(): " << ex.what() << "\n";
-			std::cerr << "tpa::calculate will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -3254,7 +3637,7 @@ if (tpa::hasNeon)
 	}//End of calculate()
 
 	/// <summary>
-	/// <para>Computes matrix math on 2 aligned containers storing the result in a 3rd aligned container.</para> 
+	/// <para>Computes matrix math on 2 containers storing the result in a 3rd container.</para> 
 	/// <para> Containers of different types are allowed but not recomended.</para>
 	/// <para> Containers of different value types are NOT allowed</para>
 	/// <para> Containers do not have to be a particular size</para>
@@ -3270,6 +3653,8 @@ if (tpa::hasNeon)
 	/// <para>tpa::op::MAX</para>
 	/// <para>tpa::op::POW</para>
 	/// <para>tpa::op::AVERAGE</para>
+	/// <para>tpa::op::ADD_SAT</para>
+	/// <para>tpa::op::SUB_SAT</para>
 	/// </summary>
 	/// <param name="source1"></param>
 	/// <param name="source2"></param>
@@ -3293,13 +3678,18 @@ if (tpa::hasNeon)
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::calculate(): " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::calculate will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
 
+			//tpa::simd::runtime_avx512_policy may turn the 512-bit branches off for this input
+			const bool allow512 = tpa::simd::avx512_allowed(smallest * sizeof(T));
+
 			std::vector<std::shared_future<uint32_t>> results;
 			results.reserve(tpa::nThreads);
 
@@ -3308,7 +3698,7 @@ if (tpa::hasNeon)
 			for (const auto& sec : sections)
 			{
 				//Launch lambda from multiple threads
-				temp = tpa::tp->addTask([&source1, &val, &dest, &sec]()
+				temp = tpa::tp->addTask([&source1, &val, &dest, &sec, allow512]()
 					{
 						const size_t beg = sec.first;
 						const size_t end = sec.second;
@@ -3319,8 +3709,11 @@ if (tpa::hasNeon)
 #pragma region byte
 						if constexpr (std::is_same<T, int8_t>() && std::is_same<T2, int8_t>() && std::is_same<RES, int8_t>())
 						{
+							//Precomputed magic-number divisor, AVERAGE divides by 2
+							const tpa::simd::int_divider<int8_t> _Di = (INSTR == tpa::op::DIVIDE || INSTR == tpa::op::MODULO) ? _val : static_cast<int8_t>(2);
+
 #ifdef _M_AMD64
-							if (tpa::hasAVX512_ByteWord)
+							if (allow512 && tpa::hasAVX512_ByteWord)
 							{
 								__m512i _Ai, _DESTi;
 								const __m512i _Bi = _mm512_set1_epi8(_val);
@@ -3339,26 +3732,25 @@ if (tpa::hasNeon)
 									{
 										_DESTi = _mm512_sub_epi8(_Ai, _Bi);
 									}//End if
+									else if constexpr (INSTR == tpa::op::ADD_SAT)
+									{
+										_DESTi = _mm512_adds_epi8(_Ai, _Bi);
+									}//End if
+									else if constexpr (INSTR == tpa::op::SUB_SAT)
+									{
+										_DESTi = _mm512_subs_epi8(_Ai, _Bi);
+									}//End if
 									else if constexpr (INSTR == tpa::op::MULTIPLY)
 									{
-										int8_t d[64] = {};
-										for (size_t x = 0uz; x != 64uz; ++x)
-										{
-#ifdef _WIN32
-											d[x] = static_cast<int8_t>(_Ai.m512i_i8[x] * _Bi.m512i_i8[x]);
-#else
-											d[x] = static_cast<int8_t>(_Ai[x] * _Bi[x]);
-#endif
-										}//End for
-										_DESTi = _mm512_loadu_epi8((__m512i*)&d);
+										_DESTi = tpa::simd::_mm512_mullo_epi8(_Ai, _Bi);
 									}//End if
 									else if constexpr (INSTR == tpa::op::DIVIDE)
 									{
-										_DESTi = _mm512_div_epi8(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm512_div_magic(_Ai, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::MODULO)
 									{
-										_DESTi = _mm512_rem_epi8(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm512_rem_magic(_Ai, _Di);
 									}//End if									
 									else if constexpr (INSTR == tpa::op::MIN)
 									{
@@ -3370,10 +3762,8 @@ if (tpa::hasNeon)
 									}//End if
 									else if constexpr (INSTR == tpa::op::AVERAGE)
 									{
-										const __m512i _TWO = _mm512_set1_epi8(2);
-
 										_DESTi = _mm512_add_epi8(_Ai, _Bi);
-										_DESTi = _mm512_div_epi8(_DESTi, _TWO);
+										_DESTi = tpa::simd::_mm512_div_magic(_DESTi, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::POWER)
 									{
@@ -3399,7 +3789,7 @@ if (tpa::hasNeon)
 								for (; (i+32uz) < end; i += 32uz)
 								{
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::op::ADD)
@@ -3410,26 +3800,25 @@ if (tpa::hasNeon)
 									{
 										_DESTi = _mm256_sub_epi8(_Ai, _Bi);
 									}//End if
+									else if constexpr (INSTR == tpa::op::ADD_SAT)
+									{
+										_DESTi = _mm256_adds_epi8(_Ai, _Bi);
+									}//End if
+									else if constexpr (INSTR == tpa::op::SUB_SAT)
+									{
+										_DESTi = _mm256_subs_epi8(_Ai, _Bi);
+									}//End if
 									else if constexpr (INSTR == tpa::op::MULTIPLY)
 									{
-										int8_t d[32] = {};
-										for (size_t x = 0uz; x != 32uz; ++x)
-										{
-#ifdef _WIN32
-											d[x] = static_cast<int8_t>(_Ai.m256i_i8[x] * _Bi.m256i_i8[x]);
-#else
-											d[x] = static_cast<int8_t>(_Ai[x] * _Bi[x]);
-#endif
-										}//End for
-										_DESTi = _mm256_load_si256((__m256i*) & d);
+										_DESTi = tpa::simd::_mm256_mullo_epi8(_Ai, _Bi);
 									}//End if
 									else if constexpr (INSTR == tpa::op::DIVIDE)
 									{
-										_DESTi = _mm256_div_epi8(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm256_div_magic(_Ai, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::MODULO)
 									{
-										_DESTi = _mm256_rem_epi8(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm256_rem_magic(_Ai, _Di);
 									}//End if									
 									else if constexpr (INSTR == tpa::op::MIN)
 									{
@@ -3441,10 +3830,8 @@ if (tpa::hasNeon)
 									}//End if
 									else if constexpr (INSTR == tpa::op::AVERAGE)
 									{
-										const __m256i _TWO = _mm256_set1_epi8(2);
-
 										_DESTi = _mm256_add_epi8(_Ai, _Bi);
-										_DESTi = _mm256_div_epi8(_DESTi, _TWO);
+										_DESTi = tpa::simd::_mm256_div_magic(_DESTi, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::POWER)
 									{
@@ -3459,7 +3846,7 @@ if (tpa::hasNeon)
 									}//End else
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
 							}//End if hasAVX2
 							else if (tpa::has_SSE2)
@@ -3470,7 +3857,7 @@ if (tpa::hasNeon)
 							for (; (i + 16uz) < end; i += 16uz)
 							{
 								//Set Values
-								_Ai = _mm_load_si128((__m128i*) & source1[i]);
+								_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
 								
 								//Calc
 								if constexpr (INSTR == tpa::op::ADD)
@@ -3481,26 +3868,25 @@ if (tpa::hasNeon)
 								{
 									_DESTi = _mm_sub_epi8(_Ai, _Bi);
 								}//End if
+								else if constexpr (INSTR == tpa::op::ADD_SAT)
+								{
+									_DESTi = _mm_adds_epi8(_Ai, _Bi);
+								}//End if
+								else if constexpr (INSTR == tpa::op::SUB_SAT)
+								{
+									_DESTi = _mm_subs_epi8(_Ai, _Bi);
+								}//End if
 								else if constexpr (INSTR == tpa::op::MULTIPLY)
 								{
-									int8_t d[16] = {};
-									for (size_t x = 0uz; x != 16uz; ++x)
-									{
-#ifdef _WIN32
-										d[x] = static_cast<int8_t>(_Ai.m128i_i8[x] * _Bi.m128i_i8[x]);
-#else
-										d[x] = static_cast<int8_t>(_Ai[x] * _Bi[x]);
-#endif
-									}//End for
-									_DESTi = _mm_load_si128((__m128i*) & d);
+									_DESTi = tpa::simd::_mm_mullo_epi8(_Ai, _Bi);
 								}//End if
 								else if constexpr (INSTR == tpa::op::DIVIDE)
 								{
-									_DESTi = _mm_div_epi8(_Ai, _Bi);
+									_DESTi = tpa::simd::_mm_div_magic(_Ai, _Di);
 								}//End if
 								else if constexpr (INSTR == tpa::op::MODULO)
 								{
-									_DESTi = _mm_rem_epi8(_Ai, _Bi);
+									_DESTi = tpa::simd::_mm_rem_magic(_Ai, _Di);
 								}//End if									
 								else if constexpr (INSTR == tpa::op::MIN)
 								{
@@ -3526,10 +3912,8 @@ if (tpa::hasNeon)
 								}//End if
 								else if constexpr (INSTR == tpa::op::AVERAGE)
 								{
-									const __m128i _TWO = _mm_set1_epi8(2);
-
 									_DESTi = _mm_add_epi8(_Ai, _Bi);
-									_DESTi = _mm_div_epi8(_DESTi, _TWO);
+									_DESTi = tpa::simd::_mm_div_magic(_DESTi, _Di);
 								}//End if
 								else if constexpr (INSTR == tpa::op::POWER)
 								{
@@ -3544,7 +3928,7 @@ if (tpa::hasNeon)
 								}//End else
 
 								//Store Result
-								_mm_store_si128((__m128i*) & dest[i], _DESTi);
+								_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
 							}//End for
 							}//End if has_SSE2
 #endif
@@ -3554,8 +3938,11 @@ if (tpa::hasNeon)
 #pragma region unsigned byte
 						else if constexpr (std::is_same<T, uint8_t>() && std::is_same<T2, uint8_t>() && std::is_same<RES, uint8_t>())
 						{
+							//Precomputed magic-number divisor, AVERAGE divides by 2
+							const tpa::simd::int_divider<uint8_t> _Di = (INSTR == tpa::op::DIVIDE || INSTR == tpa::op::MODULO) ? _val : static_cast<uint8_t>(2);
+
 #ifdef _M_AMD64
-							if (tpa::hasAVX512_ByteWord)
+							if (allow512 && tpa::hasAVX512_ByteWord)
 							{
 								__m512i _Ai, _DESTi;
 								const __m512i _Bi = _mm512_set1_epi8(_val);
@@ -3574,26 +3961,25 @@ if (tpa::hasNeon)
 									{
 										_DESTi = _mm512_sub_epi8(_Ai, _Bi);
 									}//End if
+									else if constexpr (INSTR == tpa::op::ADD_SAT)
+									{
+										_DESTi = _mm512_adds_epu8(_Ai, _Bi);
+									}//End if
+									else if constexpr (INSTR == tpa::op::SUB_SAT)
+									{
+										_DESTi = _mm512_subs_epu8(_Ai, _Bi);
+									}//End if
 									else if constexpr (INSTR == tpa::op::MULTIPLY)
 									{
-										uint8_t d[64] = {};
-										for (size_t x = 0uz; x != 64uz; ++x)
-										{
-#ifdef _WIN32
-											d[x] = static_cast<uint8_t>(_Ai.m512i_u8[x] * _Bi.m512i_u8[x]);
-#else
-											d[x] = static_cast<uint8_t>(_Ai[x] * _Bi[x]);
-#endif
-										}//End for
-										_DESTi = _mm512_loadu_epi8((__m512i*)&d);
+										_DESTi = tpa::simd::_mm512_mullo_epi8(_Ai, _Bi);
 									}//End if
 									else if constexpr (INSTR == tpa::op::DIVIDE)
 									{
-										_DESTi = _mm512_div_epu8(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm512_div_magic(_Ai, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::MODULO)
 									{
-										_DESTi = _mm512_rem_epu8(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm512_rem_magic(_Ai, _Di);
 									}//End if									
 									else if constexpr (INSTR == tpa::op::MIN)
 									{
@@ -3631,7 +4017,7 @@ if (tpa::hasNeon)
 								for (; (i+32uz) < end; i += 32uz)
 								{
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::op::ADD)
@@ -3642,26 +4028,25 @@ if (tpa::hasNeon)
 									{
 										_DESTi = _mm256_sub_epi8(_Ai, _Bi);
 									}//End if
+									else if constexpr (INSTR == tpa::op::ADD_SAT)
+									{
+										_DESTi = _mm256_adds_epu8(_Ai, _Bi);
+									}//End if
+									else if constexpr (INSTR == tpa::op::SUB_SAT)
+									{
+										_DESTi = _mm256_subs_epu8(_Ai, _Bi);
+									}//End if
 									else if constexpr (INSTR == tpa::op::MULTIPLY)
 									{
-										uint8_t d[32] = {};
-										for (size_t x = 0uz; x != 32uz; ++x)
-										{
-#ifdef _WIN32
-											d[x] = static_cast<uint8_t>(_Ai.m256i_u8[x] * _Bi.m256i_u8[x]);
-#else
-											d[x] = static_cast<uint8_t>(_Ai[x] * _Bi[x]);
-#endif
-										}//End for
-										_DESTi = _mm256_load_si256((__m256i*) & d);
+										_DESTi = tpa::simd::_mm256_mullo_epi8(_Ai, _Bi);
 									}//End if
 									else if constexpr (INSTR == tpa::op::DIVIDE)
 									{
-										_DESTi = _mm256_div_epu8(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm256_div_magic(_Ai, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::MODULO)
 									{
-										_DESTi = _mm256_rem_epu8(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm256_rem_magic(_Ai, _Di);
 									}//End if									
 									else if constexpr (INSTR == tpa::op::MIN)
 									{
@@ -3688,7 +4073,7 @@ if (tpa::hasNeon)
 									}//End else
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
 							}//End if has AVX2
 							else if (tpa::has_SSE2)
@@ -3699,7 +4084,7 @@ if (tpa::hasNeon)
 							for (; (i + 16uz) < end; i += 16uz)
 							{
 								//Set Values
-								_Ai = _mm_load_si128((__m128i*) & source1[i]);
+								_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
 
 								//Calc
 								if constexpr (INSTR == tpa::op::ADD)
@@ -3710,26 +4095,25 @@ if (tpa::hasNeon)
 								{
 									_DESTi = _mm_sub_epi8(_Ai, _Bi);
 								}//End if
+								else if constexpr (INSTR == tpa::op::ADD_SAT)
+								{
+									_DESTi = _mm_adds_epu8(_Ai, _Bi);
+								}//End if
+								else if constexpr (INSTR == tpa::op::SUB_SAT)
+								{
+									_DESTi = _mm_subs_epu8(_Ai, _Bi);
+								}//End if
 								else if constexpr (INSTR == tpa::op::MULTIPLY)
 								{
-									int8_t d[16] = {};
-									for (size_t x = 0uz; x != 16uz; ++x)
-									{
-#ifdef _WIN32
-										d[x] = static_cast<int8_t>(_Ai.m128i_i8[x] * _Bi.m128i_i8[x]);
-#else
-										d[x] = static_cast<int8_t>(_Ai[x] * _Bi[x]);
-#endif
-									}//End for
-									_DESTi = _mm_load_si128((__m128i*) & d);
+									_DESTi = tpa::simd::_mm_mullo_epi8(_Ai, _Bi);
 								}//End if
 								else if constexpr (INSTR == tpa::op::DIVIDE)
 								{
-									_DESTi = _mm_div_epi8(_Ai, _Bi);
+									_DESTi = tpa::simd::_mm_div_magic(_Ai, _Di);
 								}//End if
 								else if constexpr (INSTR == tpa::op::MODULO)
 								{
-									_DESTi = _mm_rem_epi8(_Ai, _Bi);
+									_DESTi = tpa::simd::_mm_rem_magic(_Ai, _Di);
 								}//End if									
 								else if constexpr (INSTR == tpa::op::MIN)
 								{
@@ -3755,10 +4139,8 @@ if (tpa::hasNeon)
 								}//End if
 								else if constexpr (INSTR == tpa::op::AVERAGE)
 								{
-									const __m128i _TWO = _mm_set1_epi8(2);
-
 									_DESTi = _mm_add_epi8(_Ai, _Bi);
-									_DESTi = _mm_div_epi8(_DESTi, _TWO);
+									_DESTi = tpa::simd::_mm_div_magic(_DESTi, _Di);
 								}//End if
 								else if constexpr (INSTR == tpa::op::POWER)
 								{
@@ -3773,7 +4155,7 @@ if (tpa::hasNeon)
 								}//End else
 
 								//Store Result
-								_mm_store_si128((__m128i*) & dest[i], _DESTi);
+								_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
 							}//End for
 							}//End if has_SSE2
 #endif				
@@ -3782,8 +4164,11 @@ if (tpa::hasNeon)
 #pragma region short
 						else if constexpr (std::is_same<T, int16_t>() && std::is_same<T2, int16_t>() && std::is_same<RES, int16_t>())
 						{
+							//Precomputed magic-number divisor, AVERAGE divides by 2
+							const tpa::simd::int_divider<int16_t> _Di = (INSTR == tpa::op::DIVIDE || INSTR == tpa::op::MODULO) ? _val : static_cast<int16_t>(2);
+
 #ifdef _M_AMD64
-							if (tpa::hasAVX512_ByteWord)
+							if (allow512 && tpa::hasAVX512_ByteWord)
 							{
 								__m512i _Ai, _DESTi;
 								const __m512i _Bi = _mm512_set1_epi16(_val);
@@ -3802,17 +4187,25 @@ if (tpa::hasNeon)
 									{
 										_DESTi = _mm512_sub_epi16(_Ai, _Bi);
 									}//End if
+									else if constexpr (INSTR == tpa::op::ADD_SAT)
+									{
+										_DESTi = _mm512_adds_epi16(_Ai, _Bi);
+									}//End if
+									else if constexpr (INSTR == tpa::op::SUB_SAT)
+									{
+										_DESTi = _mm512_subs_epi16(_Ai, _Bi);
+									}//End if
 									else if constexpr (INSTR == tpa::op::MULTIPLY)
 									{
 										_DESTi = _mm512_mullo_epi16(_Ai, _Bi);
 									}//End if
 									else if constexpr (INSTR == tpa::op::DIVIDE)
 									{
-										_DESTi = _mm512_div_epi16(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm512_div_magic(_Ai, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::MODULO)
 									{
-										_DESTi = _mm512_rem_epi16(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm512_rem_magic(_Ai, _Di);
 									}//End if									
 									else if constexpr (INSTR == tpa::op::MIN)
 									{
@@ -3824,10 +4217,8 @@ if (tpa::hasNeon)
 									}//End if
 									else if constexpr (INSTR == tpa::op::AVERAGE)
 									{
-										const __m512i _TWO = _mm512_set1_epi16(2);
-
 										_DESTi = _mm512_add_epi16(_Ai, _Bi);
-										_DESTi = _mm512_div_epi16(_DESTi, _TWO);
+										_DESTi = tpa::simd::_mm512_div_magic(_DESTi, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::POWER)
 									{
@@ -3853,7 +4244,7 @@ if (tpa::hasNeon)
 								for (; (i+16uz) < end; i += 16uz)
 								{
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::op::ADD)
@@ -3864,17 +4255,25 @@ if (tpa::hasNeon)
 									{
 										_DESTi = _mm256_sub_epi16(_Ai, _Bi);
 									}//End if
+									else if constexpr (INSTR == tpa::op::ADD_SAT)
+									{
+										_DESTi = _mm256_adds_epi16(_Ai, _Bi);
+									}//End if
+									else if constexpr (INSTR == tpa::op::SUB_SAT)
+									{
+										_DESTi = _mm256_subs_epi16(_Ai, _Bi);
+									}//End if
 									else if constexpr (INSTR == tpa::op::MULTIPLY)
 									{
 										_DESTi = _mm256_mullo_epi16(_Ai, _Bi);
 									}//End if
 									else if constexpr (INSTR == tpa::op::DIVIDE)
 									{
-										_DESTi = _mm256_div_epi16(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm256_div_magic(_Ai, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::MODULO)
 									{
-										_DESTi = _mm256_rem_epi16(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm256_rem_magic(_Ai, _Di);
 									}//End if									
 									else if constexpr (INSTR == tpa::op::MIN)
 									{
@@ -3886,10 +4285,8 @@ if (tpa::hasNeon)
 									}//End if
 									else if constexpr (INSTR == tpa::op::AVERAGE)
 									{
-										const __m256i _TWO = _mm256_set1_epi16(2);
-
 										_DESTi = _mm256_add_epi16(_Ai, _Bi);
-										_DESTi = _mm256_div_epi16(_DESTi, _TWO);
+										_DESTi = tpa::simd::_mm256_div_magic(_DESTi, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::POWER)
 									{
@@ -3904,7 +4301,7 @@ if (tpa::hasNeon)
 									}//End else
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
 							}//End if hasAVX2
 							else if (tpa::has_SSE2)
@@ -3915,7 +4312,7 @@ if (tpa::hasNeon)
 							for (; (i + 8uz) < end; i += 8uz)
 							{
 								//Set Values
-								_Ai = _mm_load_si128((__m128i*) & source1[i]);
+								_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
 
 								//Calc
 								if constexpr (INSTR == tpa::op::ADD)
@@ -3926,17 +4323,25 @@ if (tpa::hasNeon)
 								{
 									_DESTi = _mm_sub_epi16(_Ai, _Bi);
 								}//End if
+								else if constexpr (INSTR == tpa::op::ADD_SAT)
+								{
+									_DESTi = _mm_adds_epi16(_Ai, _Bi);
+								}//End if
+								else if constexpr (INSTR == tpa::op::SUB_SAT)
+								{
+									_DESTi = _mm_subs_epi16(_Ai, _Bi);
+								}//End if
 								else if constexpr (INSTR == tpa::op::MULTIPLY)
 								{									
 									_DESTi = _mm_mullo_epi16(_Ai, _Bi);
 								}//End if
 								else if constexpr (INSTR == tpa::op::DIVIDE)
 								{
-									_DESTi = _mm_div_epi16(_Ai, _Bi);
+									_DESTi = tpa::simd::_mm_div_magic(_Ai, _Di);
 								}//End if
 								else if constexpr (INSTR == tpa::op::MODULO)
 								{
-									_DESTi = _mm_rem_epi16(_Ai, _Bi);
+									_DESTi = tpa::simd::_mm_rem_magic(_Ai, _Di);
 								}//End if									
 								else if constexpr (INSTR == tpa::op::MIN)
 								{
@@ -3948,10 +4353,8 @@ if (tpa::hasNeon)
 								}//End if
 								else if constexpr (INSTR == tpa::op::AVERAGE)
 								{
-									const __m128i _TWO = _mm_set1_epi16(2);
-
 									_DESTi = _mm_add_epi16(_Ai, _Bi);
-									_DESTi = _mm_div_epi16(_DESTi, _TWO);
+									_DESTi = tpa::simd::_mm_div_magic(_DESTi, _Di);
 								}//End if
 								else if constexpr (INSTR == tpa::op::POWER)
 								{
@@ -3966,7 +4369,7 @@ if (tpa::hasNeon)
 								}//End else
 
 								//Store Result
-								_mm_store_si128((__m128i*) & dest[i], _DESTi);
+								_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
 							}//End for
 							}//End if has_SSE2
 #endif							
@@ -3975,8 +4378,11 @@ if (tpa::hasNeon)
 #pragma region unsigned short
 						else if constexpr (std::is_same<T, uint16_t>() && std::is_same<T2, uint16_t>() && std::is_same<RES, uint16_t>())
 						{
+							//Precomputed magic-number divisor, AVERAGE divides by 2
+							const tpa::simd::int_divider<uint16_t> _Di = (INSTR == tpa::op::DIVIDE || INSTR == tpa::op::MODULO) ? _val : static_cast<uint16_t>(2);
+
 #ifdef _M_AMD64
-							if (tpa::hasAVX512_ByteWord)
+							if (allow512 && tpa::hasAVX512_ByteWord)
 							{
 								__m512i _Ai, _DESTi;
 								const __m512i _Bi = _mm512_set1_epi16(_val);
@@ -3995,17 +4401,25 @@ if (tpa::hasNeon)
 									{
 										_DESTi = _mm512_sub_epi16(_Ai, _Bi);
 									}//End if
+									else if constexpr (INSTR == tpa::op::ADD_SAT)
+									{
+										_DESTi = _mm512_adds_epu16(_Ai, _Bi);
+									}//End if
+									else if constexpr (INSTR == tpa::op::SUB_SAT)
+									{
+										_DESTi = _mm512_subs_epu16(_Ai, _Bi);
+									}//End if
 									else if constexpr (INSTR == tpa::op::MULTIPLY)
 									{
 										_DESTi = _mm512_mullo_epi16(_Ai, _Bi);
 									}//End if
 									else if constexpr (INSTR == tpa::op::DIVIDE)
 									{
-										_DESTi = _mm512_div_epu16(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm512_div_magic(_Ai, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::MODULO)
 									{
-										_DESTi = _mm512_rem_epu16(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm512_rem_magic(_Ai, _Di);
 									}//End if									
 									else if constexpr (INSTR == tpa::op::MIN)
 									{
@@ -4043,7 +4457,7 @@ if (tpa::hasNeon)
 								for (; (i+16uz) < end; i += 16uz)
 								{
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::op::ADD)
@@ -4054,17 +4468,25 @@ if (tpa::hasNeon)
 									{
 										_DESTi = _mm256_sub_epi16(_Ai, _Bi);
 									}//End if
+									else if constexpr (INSTR == tpa::op::ADD_SAT)
+									{
+										_DESTi = _mm256_adds_epu16(_Ai, _Bi);
+									}//End if
+									else if constexpr (INSTR == tpa::op::SUB_SAT)
+									{
+										_DESTi = _mm256_subs_epu16(_Ai, _Bi);
+									}//End if
 									else if constexpr (INSTR == tpa::op::MULTIPLY)
 									{
 										_DESTi = _mm256_mullo_epi16(_Ai, _Bi);
 									}//End if
 									else if constexpr (INSTR == tpa::op::DIVIDE)
 									{
-										_DESTi = _mm256_div_epu16(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm256_div_magic(_Ai, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::MODULO)
 									{
-										_DESTi = _mm256_rem_epu16(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm256_rem_magic(_Ai, _Di);
 									}//End if									
 									else if constexpr (INSTR == tpa::op::MIN)
 									{
@@ -4091,7 +4513,7 @@ if (tpa::hasNeon)
 									}//End else
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
 							}//End if hasAVX2
 							else if (tpa::has_SSE2)
@@ -4102,7 +4524,7 @@ if (tpa::hasNeon)
 							for (; (i + 8uz) < end; i += 8uz)
 							{
 								//Set Values
-								_Ai = _mm_load_si128((__m128i*) & source1[i]);
+								_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
 
 								//Calc
 								if constexpr (INSTR == tpa::op::ADD)
@@ -4113,17 +4535,25 @@ if (tpa::hasNeon)
 								{
 									_DESTi = _mm_sub_epi16(_Ai, _Bi);
 								}//End if
+								else if constexpr (INSTR == tpa::op::ADD_SAT)
+								{
+									_DESTi = _mm_adds_epu16(_Ai, _Bi);
+								}//End if
+								else if constexpr (INSTR == tpa::op::SUB_SAT)
+								{
+									_DESTi = _mm_subs_epu16(_Ai, _Bi);
+								}//End if
 								else if constexpr (INSTR == tpa::op::MULTIPLY)
 								{
 									_DESTi = _mm_mullo_epi16(_Ai, _Bi);
 								}//End if
 								else if constexpr (INSTR == tpa::op::DIVIDE)
 								{
-									_DESTi = _mm_div_epi16(_Ai, _Bi);
+									_DESTi = tpa::simd::_mm_div_magic(_Ai, _Di);
 								}//End if
 								else if constexpr (INSTR == tpa::op::MODULO)
 								{
-									_DESTi = _mm_rem_epi16(_Ai, _Bi);
+									_DESTi = tpa::simd::_mm_rem_magic(_Ai, _Di);
 								}//End if									
 								else if constexpr (INSTR == tpa::op::MIN)
 								{
@@ -4150,7 +4580,7 @@ if (tpa::hasNeon)
 								}//End else
 
 								//Store Result
-								_mm_store_si128((__m128i*) & dest[i], _DESTi);
+								_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
 							}//End for
 							}//End if has_SSE2
 #endif 							
@@ -4159,8 +4589,11 @@ if (tpa::hasNeon)
 #pragma region int
 						else if constexpr (std::is_same<T, int32_t>() && std::is_same<T2, int32_t>() && std::is_same<RES, int32_t>())
 						{
+							//Precomputed magic-number divisor, AVERAGE divides by 2
+							const tpa::simd::int_divider<int32_t> _Di = (INSTR == tpa::op::DIVIDE || INSTR == tpa::op::MODULO) ? _val : static_cast<int32_t>(2);
+
 #ifdef _M_AMD64
-							if (tpa::hasAVX512)
+							if (allow512 && tpa::hasAVX512)
 							{
 								__m512i _Ai, _DESTi;
 								const __m512i _Bi = _mm512_set1_epi32(_val);
@@ -4168,7 +4601,7 @@ if (tpa::hasNeon)
 								for (; (i+16uz) < end; i += 16uz)
 								{
 									//Set Values
-									_Ai = _mm512_load_epi32((__m512i*)&source1[i]);
+									_Ai = _mm512_loadu_epi32((__m512i*)&source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::op::ADD)
@@ -4179,17 +4612,25 @@ if (tpa::hasNeon)
 									{
 										_DESTi = _mm512_sub_epi32(_Ai, _Bi);
 									}//End if
+									else if constexpr (INSTR == tpa::op::ADD_SAT)
+									{
+										_DESTi = tpa::simd::_mm512_adds_epi32(_Ai, _Bi);
+									}//End if
+									else if constexpr (INSTR == tpa::op::SUB_SAT)
+									{
+										_DESTi = tpa::simd::_mm512_subs_epi32(_Ai, _Bi);
+									}//End if
 									else if constexpr (INSTR == tpa::op::MULTIPLY)
 									{
 										_DESTi = _mm512_mullo_epi32(_Ai, _Bi);
 									}//End if
 									else if constexpr (INSTR == tpa::op::DIVIDE)
 									{
-										_DESTi = _mm512_div_epi32(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm512_div_magic(_Ai, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::MODULO)
 									{
-										_DESTi = _mm512_rem_epi32(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm512_rem_magic(_Ai, _Di);
 									}//End if									
 									else if constexpr (INSTR == tpa::op::MIN)
 									{
@@ -4201,10 +4642,8 @@ if (tpa::hasNeon)
 									}//End if
 									else if constexpr (INSTR == tpa::op::AVERAGE)
 									{
-										const __m256i _TWO = _mm256_set1_epi32(2);
-
 										_DESTi = _mm512_add_epi32(_Ai, _Bi);
-										_DESTi = _mm512_div_epi32(_DESTi, _TWO);
+										_DESTi = tpa::simd::_mm512_div_magic(_DESTi, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::POWER)
 									{
@@ -4219,7 +4658,7 @@ if (tpa::hasNeon)
 									}//End else
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _DESTi);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _DESTi);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -4230,7 +4669,7 @@ if (tpa::hasNeon)
 								for (; (i+8uz) < end; i += 8uz)
 								{
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::op::ADD)
@@ -4241,17 +4680,25 @@ if (tpa::hasNeon)
 									{
 										_DESTi = _mm256_sub_epi32(_Ai, _Bi);
 									}//End if
+									else if constexpr (INSTR == tpa::op::ADD_SAT)
+									{
+										_DESTi = tpa::simd::_mm256_adds_epi32(_Ai, _Bi);
+									}//End if
+									else if constexpr (INSTR == tpa::op::SUB_SAT)
+									{
+										_DESTi = tpa::simd::_mm256_subs_epi32(_Ai, _Bi);
+									}//End if
 									else if constexpr (INSTR == tpa::op::MULTIPLY)
 									{
 										_DESTi = _mm256_mullo_epi32(_Ai, _Bi);
 									}//End if
 									else if constexpr (INSTR == tpa::op::DIVIDE)
 									{
-										_DESTi = _mm256_div_epi32(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm256_div_magic(_Ai, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::MODULO)
 									{
-										_DESTi = _mm256_rem_epi32(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm256_rem_magic(_Ai, _Di);
 									}//End if									
 									else if constexpr (INSTR == tpa::op::MIN)
 									{
@@ -4263,10 +4710,8 @@ if (tpa::hasNeon)
 									}//End if
 									else if constexpr (INSTR == tpa::op::AVERAGE)
 									{
-										const __m256i _TWO = _mm256_set1_epi32(2);
-
 										_DESTi = _mm256_add_epi32(_Ai, _Bi);
-										_DESTi = _mm256_div_epi32(_DESTi, _TWO);
+										_DESTi = tpa::simd::_mm256_div_magic(_DESTi, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::POWER)
 									{
@@ -4281,7 +4726,7 @@ if (tpa::hasNeon)
 									}//End else
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
 							}//End if hasAVX2
 							else if (tpa::has_SSE2)
@@ -4292,7 +4737,7 @@ if (tpa::hasNeon)
 							for (; (i + 4uz) < end; i += 4uz)
 							{
 								//Set Values
-								_Ai = _mm_load_si128((__m128i*) & source1[i]);
+								_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
 								
 								//Calc
 								if constexpr (INSTR == tpa::op::ADD)
@@ -4303,17 +4748,25 @@ if (tpa::hasNeon)
 								{
 									_DESTi = _mm_sub_epi32(_Ai, _Bi);
 								}//End if
+								else if constexpr (INSTR == tpa::op::ADD_SAT)
+								{
+									_DESTi = tpa::simd::_mm_adds_epi32(_Ai, _Bi);
+								}//End if
+								else if constexpr (INSTR == tpa::op::SUB_SAT)
+								{
+									_DESTi = tpa::simd::_mm_subs_epi32(_Ai, _Bi);
+								}//End if
 								else if constexpr (INSTR == tpa::op::MULTIPLY)
 								{
 									_DESTi = tpa::simd::_mm_mul_epi32(_Ai, _Bi);
 								}//End if
 								else if constexpr (INSTR == tpa::op::DIVIDE)
 								{
-									_DESTi = _mm_div_epi32(_Ai, _Bi);
+									_DESTi = tpa::simd::_mm_div_magic(_Ai, _Di);
 								}//End if
 								else if constexpr (INSTR == tpa::op::MODULO)
 								{
-									_DESTi = _mm_rem_epi32(_Ai, _Bi);
+									_DESTi = tpa::simd::_mm_rem_magic(_Ai, _Di);
 								}//End if									
 								else if constexpr (INSTR == tpa::op::MIN)
 								{
@@ -4339,10 +4792,8 @@ if (tpa::hasNeon)
 								}//End if
 								else if constexpr (INSTR == tpa::op::AVERAGE)
 								{
-									const __m128i _TWO = _mm_set1_epi32(2);
-
 									_DESTi = _mm_add_epi32(_Ai, _Bi);
-									_DESTi = _mm_div_epi32(_DESTi, _TWO);
+									_DESTi = tpa::simd::_mm_div_magic(_DESTi, _Di);
 								}//End if
 								else if constexpr (INSTR == tpa::op::POWER)
 								{
@@ -4357,7 +4808,7 @@ if (tpa::hasNeon)
 								}//End else
 
 								//Store Result
-								_mm_store_si128((__m128i*) & dest[i], _DESTi);
+								_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
 							}//End for
 							}//End if has_SSE2
 #endif							
@@ -4366,8 +4817,11 @@ if (tpa::hasNeon)
 #pragma region unsigned int
 						else if constexpr (std::is_same<T, uint32_t>() && std::is_same<T2, uint32_t>() && std::is_same<RES, uint32_t>())
 						{
+							//Precomputed magic-number divisor, AVERAGE divides by 2
+							const tpa::simd::int_divider<uint32_t> _Di = (INSTR == tpa::op::DIVIDE || INSTR == tpa::op::MODULO) ? _val : static_cast<uint32_t>(2);
+
 #ifdef _M_AMD64
-							if (tpa::hasAVX512)
+							if (allow512 && tpa::hasAVX512)
 							{
 								__m512i _Ai, _DESTi;
 								const __m512i _Bi = _mm512_set1_epi32(_val);
@@ -4375,7 +4829,7 @@ if (tpa::hasNeon)
 								for (; (i+16uz) < end; i += 16uz)
 								{
 									//Set Values
-									_Ai = _mm512_load_epi32((__m512i*)&source1[i]);
+									_Ai = _mm512_loadu_epi32((__m512i*)&source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::op::ADD)
@@ -4386,17 +4840,25 @@ if (tpa::hasNeon)
 									{
 										_DESTi = _mm512_sub_epi32(_Ai, _Bi);
 									}//End if
+									else if constexpr (INSTR == tpa::op::ADD_SAT)
+									{
+										_DESTi = tpa::simd::_mm512_adds_epu32(_Ai, _Bi);
+									}//End if
+									else if constexpr (INSTR == tpa::op::SUB_SAT)
+									{
+										_DESTi = tpa::simd::_mm512_subs_epu32(_Ai, _Bi);
+									}//End if
 									else if constexpr (INSTR == tpa::op::MULTIPLY)
 									{
 										_DESTi = _mm512_mullo_epi32(_Ai, _Bi);
 									}//End if
 									else if constexpr (INSTR == tpa::op::DIVIDE)
 									{
-										_DESTi = _mm512_div_epu32(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm512_div_magic(_Ai, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::MODULO)
 									{
-										_DESTi = _mm512_rem_epu32(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm512_rem_magic(_Ai, _Di);
 									}//End if									
 									else if constexpr (INSTR == tpa::op::MIN)
 									{
@@ -4408,10 +4870,8 @@ if (tpa::hasNeon)
 									}//End if
 									else if constexpr (INSTR == tpa::op::AVERAGE)
 									{
-										const __m512i _TWO = _mm512_set1_epi32(2);
-
 										_DESTi = _mm512_add_epi32(_Ai, _Bi);
-										_DESTi = _mm512_div_epu32(_DESTi, _TWO);
+										_DESTi = tpa::simd::_mm512_div_magic(_DESTi, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::POWER)
 									{
@@ -4426,7 +4886,7 @@ if (tpa::hasNeon)
 									}//End else
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _DESTi);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _DESTi);
 								}//End for
 							}//End if
 							else if (tpa::hasAVX2)
@@ -4437,7 +4897,7 @@ if (tpa::hasNeon)
 								for (; (i+8uz) < end; i += 8uz)
 								{
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::op::ADD)
@@ -4448,17 +4908,25 @@ if (tpa::hasNeon)
 									{
 										_DESTi = _mm256_sub_epi32(_Ai, _Bi);
 									}//End if
+									else if constexpr (INSTR == tpa::op::ADD_SAT)
+									{
+										_DESTi = tpa::simd::_mm256_adds_epu32(_Ai, _Bi);
+									}//End if
+									else if constexpr (INSTR == tpa::op::SUB_SAT)
+									{
+										_DESTi = tpa::simd::_mm256_subs_epu32(_Ai, _Bi);
+									}//End if
 									else if constexpr (INSTR == tpa::op::MULTIPLY)
 									{
 										_DESTi = _mm256_mullo_epi32(_Ai, _Bi);
 									}//End if
 									else if constexpr (INSTR == tpa::op::DIVIDE)
 									{
-										_DESTi = _mm256_div_epu32(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm256_div_magic(_Ai, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::MODULO)
 									{
-										_DESTi = _mm256_rem_epu32(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm256_rem_magic(_Ai, _Di);
 									}//End if									
 									else if constexpr (INSTR == tpa::op::MIN)
 									{
@@ -4470,10 +4938,8 @@ if (tpa::hasNeon)
 									}//End if
 									else if constexpr (INSTR == tpa::op::AVERAGE)
 									{
-										const __m256i _TWO = _mm256_set1_epi32(2);
-
 										_DESTi = _mm256_add_epi32(_Ai, _Bi);
-										_DESTi = _mm256_div_epu32(_DESTi, _TWO);
+										_DESTi = tpa::simd::_mm256_div_magic(_DESTi, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::POWER)
 									{
@@ -4488,7 +4954,7 @@ if (tpa::hasNeon)
 									}//End else
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
 							}//End if hasAVX2
 							else if (tpa::has_SSE2)
@@ -4499,7 +4965,7 @@ if (tpa::hasNeon)
 							for (; (i + 4uz) < end; i += 4uz)
 							{
 								//Set Values
-								_Ai = _mm_load_si128((__m128i*) & source1[i]);
+								_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
 
 								//Calc
 								if constexpr (INSTR == tpa::op::ADD)
@@ -4510,17 +4976,25 @@ if (tpa::hasNeon)
 								{
 									_DESTi = _mm_sub_epi32(_Ai, _Bi);
 								}//End if
+								else if constexpr (INSTR == tpa::op::ADD_SAT)
+								{
+									_DESTi = tpa::simd::_mm_adds_epu32(_Ai, _Bi);
+								}//End if
+								else if constexpr (INSTR == tpa::op::SUB_SAT)
+								{
+									_DESTi = tpa::simd::_mm_subs_epu32(_Ai, _Bi);
+								}//End if
 								else if constexpr (INSTR == tpa::op::MULTIPLY)
 								{
 									_DESTi = tpa::simd::_mm_mul_epi32(_Ai, _Bi);
 								}//End if
 								else if constexpr (INSTR == tpa::op::DIVIDE)
 								{
-									_DESTi = _mm_div_epi32(_Ai, _Bi);
+									_DESTi = tpa::simd::_mm_div_magic(_Ai, _Di);
 								}//End if
 								else if constexpr (INSTR == tpa::op::MODULO)
 								{
-									_DESTi = _mm_rem_epu32(_Ai, _Bi);
+									_DESTi = tpa::simd::_mm_rem_magic(_Ai, _Di);
 								}//End if									
 								else if constexpr (INSTR == tpa::op::MIN)
 								{
@@ -4546,10 +5020,8 @@ if (tpa::hasNeon)
 								}//End if
 								else if constexpr (INSTR == tpa::op::AVERAGE)
 								{
-									const __m128i _TWO = _mm_set1_epi32(2);
-
 									_DESTi = _mm_add_epi32(_Ai, _Bi);
-									_DESTi = _mm_div_epi32(_DESTi, _TWO);
+									_DESTi = tpa::simd::_mm_div_magic(_DESTi, _Di);
 								}//End if
 								else if constexpr (INSTR == tpa::op::POWER)
 								{
@@ -4564,7 +5036,7 @@ if (tpa::hasNeon)
 								}//End else
 
 								//Store Result
-								_mm_store_si128((__m128i*) & dest[i], _DESTi);
+								_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
 							}//End for
 							}//End if has_SSE2
 #endif							
@@ -4573,8 +5045,11 @@ if (tpa::hasNeon)
 #pragma region long
 						else if constexpr (std::is_same<T, int64_t>() && std::is_same<T2, int64_t>() && std::is_same<RES, int64_t>())
 						{
+							//Precomputed magic-number divisor, AVERAGE divides by 2
+							const tpa::simd::int_divider<int64_t> _Di = (INSTR == tpa::op::DIVIDE || INSTR == tpa::op::MODULO) ? _val : static_cast<int64_t>(2);
+
 #ifdef _M_AMD64
-							if (tpa::hasAVX512)
+							if (allow512 && tpa::hasAVX512)
 							{
 								__m512i _Ai, _DESTi;
 								const __m512i _Bi = _mm512_set1_epi64(_val);
@@ -4582,7 +5057,7 @@ if (tpa::hasNeon)
 								for (; (i+8uz) < end; i += 8uz)
 								{
 									//Set Values
-									_Ai = _mm512_load_epi64((__m512i*)&source1[i]);
+									_Ai = _mm512_loadu_epi64((__m512i*)&source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::op::ADD)
@@ -4593,6 +5068,14 @@ if (tpa::hasNeon)
 									{
 										_DESTi = _mm512_sub_epi64(_Ai, _Bi);
 									}//End if
+									else if constexpr (INSTR == tpa::op::ADD_SAT)
+									{
+										_DESTi = tpa::simd::_mm512_adds_epi64(_Ai, _Bi);
+									}//End if
+									else if constexpr (INSTR == tpa::op::SUB_SAT)
+									{
+										_DESTi = tpa::simd::_mm512_subs_epi64(_Ai, _Bi);
+									}//End if
 									else if constexpr (INSTR == tpa::op::MULTIPLY)
 									{
 #ifdef __AVX512DQ__
@@ -4603,11 +5086,11 @@ if (tpa::hasNeon)
 									}//End if
 									else if constexpr (INSTR == tpa::op::DIVIDE)
 									{
-										_DESTi = _mm512_div_epi64(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm512_div_magic(_Ai, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::MODULO)
 									{
-										_DESTi = _mm512_rem_epi64(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm512_rem_magic(_Ai, _Di);
 									}//End if									
 									else if constexpr (INSTR == tpa::op::MIN)
 									{
@@ -4619,10 +5102,8 @@ if (tpa::hasNeon)
 									}//End if
 									else if constexpr (INSTR == tpa::op::AVERAGE)
 									{
-										const __m512i _TWO = _mm512_set1_epi64(2);
-
 										_DESTi = _mm512_add_epi64(_Ai, _Bi);
-										_DESTi = _mm512_div_epi64(_DESTi, _TWO);
+										_DESTi = tpa::simd::_mm512_div_magic(_DESTi, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::POWER)
 									{
@@ -4637,7 +5118,7 @@ if (tpa::hasNeon)
 									}//End else
 
 									//Store Result
-									_mm512_store_epi64((__m256i*) & dest[i], _DESTi);
+									_mm512_storeu_epi64((__m256i*) & dest[i], _DESTi);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -4648,7 +5129,7 @@ if (tpa::hasNeon)
 								for (; (i+4uz) < end; i += 4uz)
 								{
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::op::ADD)
@@ -4659,17 +5140,25 @@ if (tpa::hasNeon)
 									{
 										_DESTi = _mm256_sub_epi64(_Ai, _Bi);
 									}//End if
+									else if constexpr (INSTR == tpa::op::ADD_SAT)
+									{
+										_DESTi = tpa::simd::_mm256_adds_epi64(_Ai, _Bi);
+									}//End if
+									else if constexpr (INSTR == tpa::op::SUB_SAT)
+									{
+										_DESTi = tpa::simd::_mm256_subs_epi64(_Ai, _Bi);
+									}//End if
 									else if constexpr (INSTR == tpa::op::MULTIPLY)
 									{										
 										_DESTi = tpa::simd::_mm256_mul_epi64(_Ai, _Bi);
 									}//End if
 									else if constexpr (INSTR == tpa::op::DIVIDE)
 									{
-										_DESTi = _mm256_div_epi64(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm256_div_magic(_Ai, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::MODULO)
 									{
-										_DESTi = _mm256_rem_epi64(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm256_rem_magic(_Ai, _Di);
 									}//End if									
 									else if constexpr (INSTR == tpa::op::MIN)
 									{
@@ -4681,10 +5170,8 @@ if (tpa::hasNeon)
 									}//End if
 									else if constexpr (INSTR == tpa::op::AVERAGE)
 									{
-										const __m256i _TWO = _mm256_set1_epi64x(2);
-
 										_DESTi = _mm256_add_epi64(_Ai, _Bi);
-										_DESTi = _mm256_div_epi64(_DESTi, _TWO);
+										_DESTi = tpa::simd::_mm256_div_magic(_DESTi, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::POWER)
 									{
@@ -4699,7 +5186,7 @@ if (tpa::hasNeon)
 									}//End else
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
 							}//End if hasAVX2
 							else if (tpa::has_SSE2)
@@ -4710,7 +5197,7 @@ if (tpa::hasNeon)
 							for (; (i + 2uz) < end; i += 2uz)
 							{
 								//Set Values
-								_Ai = _mm_load_si128((__m128i*) & source1[i]);
+								_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
 
 								//Calc
 								if constexpr (INSTR == tpa::op::ADD)
@@ -4721,17 +5208,25 @@ if (tpa::hasNeon)
 								{
 									_DESTi = _mm_sub_epi64(_Ai, _Bi);
 								}//End if
+								else if constexpr (INSTR == tpa::op::ADD_SAT)
+								{
+									_DESTi = tpa::simd::_mm_adds_epi64(_Ai, _Bi);
+								}//End if
+								else if constexpr (INSTR == tpa::op::SUB_SAT)
+								{
+									_DESTi = tpa::simd::_mm_subs_epi64(_Ai, _Bi);
+								}//End if
 								else if constexpr (INSTR == tpa::op::MULTIPLY)
 								{
 									_DESTi = tpa::simd::_mm_mul_epi64(_Ai, _Bi);
 								}//End if
 								else if constexpr (INSTR == tpa::op::DIVIDE)
 								{
-									_DESTi = _mm_div_epi64(_Ai, _Bi);
+									_DESTi = tpa::simd::_mm_div_magic(_Ai, _Di);
 								}//End if
 								else if constexpr (INSTR == tpa::op::MODULO)
 								{
-									_DESTi = _mm_rem_epi64(_Ai, _Bi);
+									_DESTi = tpa::simd::_mm_rem_magic(_Ai, _Di);
 								}//End if									
 								else if constexpr (INSTR == tpa::op::MIN)
 								{
@@ -4743,10 +5238,8 @@ if (tpa::hasNeon)
 								}//End if
 								else if constexpr (INSTR == tpa::op::AVERAGE)
 								{
-									const __m128i _TWO = _mm_set1_epi64x(2);
-
 									_DESTi = _mm_add_epi64(_Ai, _Bi);
-									_DESTi = _mm_div_epi64(_DESTi, _TWO);
+									_DESTi = tpa::simd::_mm_div_magic(_DESTi, _Di);
 								}//End if
 								else if constexpr (INSTR == tpa::op::POWER)
 								{
@@ -4761,7 +5254,7 @@ if (tpa::hasNeon)
 								}//End else
 
 								//Store Result
-								_mm_store_si128((__m128i*) & dest[i], _DESTi);
+								_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
 							}//End for
 							}//End if has_SSE2
 #endif							
@@ -4770,8 +5263,11 @@ if (tpa::hasNeon)
 #pragma region unsigned long
 						else if constexpr (std::is_same<T, uint64_t>() && std::is_same<T2, uint64_t>() && std::is_same<RES, uint64_t>())
 						{
+							//Precomputed magic-number divisor, AVERAGE divides by 2
+							const tpa::simd::int_divider<uint64_t> _Di = (INSTR == tpa::op::DIVIDE || INSTR == tpa::op::MODULO) ? _val : static_cast<uint64_t>(2);
+
 #ifdef _M_AMD64
-							if (tpa::hasAVX512)
+							if (allow512 && tpa::hasAVX512)
 							{
 								__m512i _Ai, _DESTi;
 								const __m512i _Bi = _mm512_set1_epi64(_val);
@@ -4779,7 +5275,7 @@ if (tpa::hasNeon)
 								for (; (i+8uz) < end; i += 8uz)
 								{
 									//Set Values
-									_Ai = _mm512_load_epi64((__m512i*)&source1[i]);
+									_Ai = _mm512_loadu_epi64((__m512i*)&source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::op::ADD)
@@ -4790,6 +5286,14 @@ if (tpa::hasNeon)
 									{
 										_DESTi = _mm512_sub_epi64(_Ai, _Bi);
 									}//End if
+									else if constexpr (INSTR == tpa::op::ADD_SAT)
+									{
+										_DESTi = tpa::simd::_mm512_adds_epu64(_Ai, _Bi);
+									}//End if
+									else if constexpr (INSTR == tpa::op::SUB_SAT)
+									{
+										_DESTi = tpa::simd::_mm512_subs_epu64(_Ai, _Bi);
+									}//End if
 									else if constexpr (INSTR == tpa::op::MULTIPLY)
 									{
 #ifdef __AVX512DQ__
@@ -4800,11 +5304,11 @@ if (tpa::hasNeon)
 									}//End if
 									else if constexpr (INSTR == tpa::op::DIVIDE)
 									{
-										_DESTi = _mm512_div_epu64(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm512_div_magic(_Ai, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::MODULO)
 									{
-										_DESTi = _mm512_rem_epu64(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm512_rem_magic(_Ai, _Di);
 									}//End if									
 									else if constexpr (INSTR == tpa::op::MIN)
 									{
@@ -4816,10 +5320,8 @@ if (tpa::hasNeon)
 									}//End if
 									else if constexpr (INSTR == tpa::op::AVERAGE)
 									{
-										const __m512i _TWO = _mm512_set1_epi64(2);
-
 										_DESTi = _mm512_add_epi64(_Ai, _Bi);
-										_DESTi = _mm512_div_epu64(_DESTi, _TWO);
+										_DESTi = tpa::simd::_mm512_div_magic(_DESTi, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::POWER)
 									{
@@ -4834,7 +5336,7 @@ if (tpa::hasNeon)
 									}//End else
 
 									//Store Result
-									_mm512_store_epi64((__m256i*) & dest[i], _DESTi);
+									_mm512_storeu_epi64((__m256i*) & dest[i], _DESTi);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -4845,7 +5347,7 @@ if (tpa::hasNeon)
 								for (; (i+4uz) < end; i += 4uz)
 								{
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::op::ADD)
@@ -4856,17 +5358,25 @@ if (tpa::hasNeon)
 									{
 										_DESTi = _mm256_sub_epi64(_Ai, _Bi);
 									}//End if
+									else if constexpr (INSTR == tpa::op::ADD_SAT)
+									{
+										_DESTi = tpa::simd::_mm256_adds_epu64(_Ai, _Bi);
+									}//End if
+									else if constexpr (INSTR == tpa::op::SUB_SAT)
+									{
+										_DESTi = tpa::simd::_mm256_subs_epu64(_Ai, _Bi);
+									}//End if
 									else if constexpr (INSTR == tpa::op::MULTIPLY)
 									{										
 										_DESTi = tpa::simd::_mm256_mul_epi64(_Ai, _Bi);
 									}//End if
 									else if constexpr (INSTR == tpa::op::DIVIDE)
 									{
-										_DESTi = _mm256_div_epu64(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm256_div_magic(_Ai, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::MODULO)
 									{
-										_DESTi = _mm256_rem_epu64(_Ai, _Bi);
+										_DESTi = tpa::simd::_mm256_rem_magic(_Ai, _Di);
 									}//End if									
 									else if constexpr (INSTR == tpa::op::MIN)
 									{
@@ -4878,10 +5388,8 @@ if (tpa::hasNeon)
 									}//End if
 									else if constexpr (INSTR == tpa::op::AVERAGE)
 									{
-										const __m256i _TWO = _mm256_set1_epi64x(2);
-
 										_DESTi = _mm256_add_epi64(_Ai, _Bi);
-										_DESTi = _mm256_div_epu64(_DESTi, _TWO);
+										_DESTi = tpa::simd::_mm256_div_magic(_DESTi, _Di);
 									}//End if
 									else if constexpr (INSTR == tpa::op::POWER)
 									{
@@ -4896,7 +5404,7 @@ if (tpa::hasNeon)
 									}//End else
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
 							}//End if hasAVX2
 							else if (tpa::has_SSE2)
@@ -4907,7 +5415,7 @@ if (tpa::hasNeon)
 							for (; (i + 2uz) < end; i += 2uz)
 							{
 								//Set Values
-								_Ai = _mm_load_si128((__m128i*) & source1[i]);
+								_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
 
 								//Calc
 								if constexpr (INSTR == tpa::op::ADD)
@@ -4918,17 +5426,39 @@ if (tpa::hasNeon)
 								{
 									_DESTi = _mm_sub_epi64(_Ai, _Bi);
 								}//End if
+								else if constexpr (INSTR == tpa::op::ADD_SAT)
+								{
+									if (tpa::has_SSE42) [[likely]]
+									{
+										_DESTi = tpa::simd::_mm_adds_epu64(_Ai, _Bi);
+									}//End if
+									else
+									{
+										break;
+									}//End else
+								}//End if
+								else if constexpr (INSTR == tpa::op::SUB_SAT)
+								{
+									if (tpa::has_SSE42) [[likely]]
+									{
+										_DESTi = tpa::simd::_mm_subs_epu64(_Ai, _Bi);
+									}//End if
+									else
+									{
+										break;
+									}//End else
+								}//End if
 								else if constexpr (INSTR == tpa::op::MULTIPLY)
 								{
 									_DESTi = tpa::simd::_mm_mul_epi64(_Ai, _Bi);
 								}//End if
 								else if constexpr (INSTR == tpa::op::DIVIDE)
 								{
-									_DESTi = _mm_div_epi64(_Ai, _Bi);
+									_DESTi = tpa::simd::_mm_div_magic(_Ai, _Di);
 								}//End if
 								else if constexpr (INSTR == tpa::op::MODULO)
 								{
-									_DESTi = _mm_rem_epu64(_Ai, _Bi);
+									_DESTi = tpa::simd::_mm_rem_magic(_Ai, _Di);
 								}//End if									
 								else if constexpr (INSTR == tpa::op::MIN)
 								{
@@ -4940,10 +5470,8 @@ if (tpa::hasNeon)
 								}//End if
 								else if constexpr (INSTR == tpa::op::AVERAGE)
 								{
-									const __m128i _TWO = _mm_set1_epi64x(2);
-
 									_DESTi = _mm_add_epi64(_Ai, _Bi);
-									_DESTi = _mm_div_epi64(_DESTi, _TWO);
+									_DESTi = tpa::simd::_mm_div_magic(_DESTi, _Di);
 								}//End if
 								else if constexpr (INSTR == tpa::op::POWER)
 								{
@@ -4958,7 +5486,7 @@ if (tpa::hasNeon)
 								}//End else
 
 								//Store Result
-								_mm_store_si128((__m128i*) & dest[i], _DESTi);
+								_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
 							}//End for
 							}//End if has_SSE2
 #endif							
@@ -4968,7 +5496,7 @@ if (tpa::hasNeon)
 						else if constexpr (std::is_same<T, float>() && std::is_same<T2, float>() && std::is_same<RES, float>())
 						{
 #ifdef _M_AMD64
-							if (tpa::hasAVX512)
+							if (allow512 && tpa::hasAVX512)
 							{
 								__m512 _Ai, _DESTi;
 								const __m512 _Bi = _mm512_set1_ps(_val);
@@ -4976,7 +5504,7 @@ if (tpa::hasNeon)
 								for (; (i+16uz) < end; i += 16uz)
 								{
 									//Set Values
-									_Ai = _mm512_load_ps(&source1[i]);
+									_Ai = _mm512_loadu_ps(&source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::op::ADD)
@@ -4987,6 +5515,14 @@ if (tpa::hasNeon)
 									{
 										_DESTi = _mm512_sub_ps(_Ai, _Bi);
 									}//End if
+									else if constexpr (INSTR == tpa::op::ADD_SAT)
+									{
+										_DESTi = _mm512_add_ps(_Ai, _Bi);
+									}//End if
+									else if constexpr (INSTR == tpa::op::SUB_SAT)
+									{
+										_DESTi = _mm512_sub_ps(_Ai, _Bi);
+									}//End if
 									else if constexpr (INSTR == tpa::op::MULTIPLY)
 									{
 										_DESTi = _mm512_mul_ps(_Ai, _Bi);
@@ -5027,7 +5563,7 @@ if (tpa::hasNeon)
 									}//End else
 
 									//Store Result
-									_mm512_store_ps(&dest[i], _DESTi);
+									_mm512_storeu_ps(&dest[i], _DESTi);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX)
@@ -5038,7 +5574,7 @@ if (tpa::hasNeon)
 								for (; (i+8uz) < end; i += 8uz)
 								{
 									//Set Values
-									_Ai = _mm256_load_ps(&source1[i]);
+									_Ai = _mm256_loadu_ps(&source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::op::ADD)
@@ -5049,6 +5585,14 @@ if (tpa::hasNeon)
 									{
 										_DESTi = _mm256_sub_ps(_Ai, _Bi);
 									}//End if
+									else if constexpr (INSTR == tpa::op::ADD_SAT)
+									{
+										_DESTi = _mm256_add_ps(_Ai, _Bi);
+									}//End if
+									else if constexpr (INSTR == tpa::op::SUB_SAT)
+									{
+										_DESTi = _mm256_sub_ps(_Ai, _Bi);
+									}//End if
 									else if constexpr (INSTR == tpa::op::MULTIPLY)
 									{
 										_DESTi = _mm256_mul_ps(_Ai, _Bi);
@@ -5089,7 +5633,7 @@ if (tpa::hasNeon)
 									}//End else
 
 									//Store Result
-									_mm256_store_ps(&dest[i], _DESTi);
+									_mm256_storeu_ps(&dest[i], _DESTi);
 								}//End for
 							}//End if hasAVX2
 							else if (tpa::has_SSE)
@@ -5100,7 +5644,7 @@ if (tpa::hasNeon)
 							for (; (i + 4) < end; i += 4)
 							{
 								//Set Values
-								_Ai = _mm_load_ps(&source1[i]);
+								_Ai = _mm_loadu_ps(&source1[i]);
 
 								//Calc
 								if constexpr (INSTR == tpa::op::ADD)
@@ -5111,6 +5655,14 @@ if (tpa::hasNeon)
 								{
 									_DESTi = _mm_sub_ps(_Ai, _Bi);
 								}//End if
+								else if constexpr (INSTR == tpa::op::ADD_SAT)
+								{
+									_DESTi = _mm_add_ps(_Ai, _Bi);
+								}//End if
+								else if constexpr (INSTR == tpa::op::SUB_SAT)
+								{
+									_DESTi = _mm_sub_ps(_Ai, _Bi);
+								}//End if
 								else if constexpr (INSTR == tpa::op::MULTIPLY)
 								{
 									_DESTi = _mm_mul_ps(_Ai, _Bi);
@@ -5151,7 +5703,7 @@ if (tpa::hasNeon)
 								}//End else
 
 								//Store Result
-								_mm_store_ps(&dest[i], _DESTi);
+								_mm_storeu_ps(&dest[i], _DESTi);
 							}//End for
 							}//End if has_SSE
 #endif						
@@ -5161,7 +5713,7 @@ if (tpa::hasNeon)
 						else if constexpr (std::is_same<T, double>() && std::is_same<T2, double>() && std::is_same<RES, double>())
 						{
 #ifdef _M_AMD64
-							if (tpa::hasAVX512)
+							if (allow512 && tpa::hasAVX512)
 							{
 								__m512d _Ai, _DESTi;
 								const __m512d _Bi = _mm512_set1_pd(_val);
@@ -5169,7 +5721,7 @@ if (tpa::hasNeon)
 								for (; (i+8uz) < end; i += 8uz)
 								{
 									//Set Values
-									_Ai = _mm512_load_pd(&source1[i]);
+									_Ai = _mm512_loadu_pd(&source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::op::ADD)
@@ -5180,6 +5732,14 @@ if (tpa::hasNeon)
 									{
 										_DESTi = _mm512_sub_pd(_Ai, _Bi);
 									}//End if
+									else if constexpr (INSTR == tpa::op::ADD_SAT)
+									{
+										_DESTi = _mm512_add_pd(_Ai, _Bi);
+									}//End if
+									else if constexpr (INSTR == tpa::op::SUB_SAT)
+									{
+										_DESTi = _mm512_sub_pd(_Ai, _Bi);
+									}//End if
 									else if constexpr (INSTR == tpa::op::MULTIPLY)
 									{
 										_DESTi = _mm512_mul_pd(_Ai, _Bi);
@@ -5220,7 +5780,7 @@ if (tpa::hasNeon)
 									}//End else
 
 									//Store Result
-									_mm512_store_pd(&dest[i], _DESTi);
+									_mm512_storeu_pd(&dest[i], _DESTi);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX)
@@ -5231,7 +5791,7 @@ if (tpa::hasNeon)
 								for (; (i+4uz) < end; i += 4uz)
 								{
 									//Set Values
-									_Ai = _mm256_load_pd(&source1[i]);
+									_Ai = _mm256_loadu_pd(&source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::op::ADD)
@@ -5242,6 +5802,14 @@ if (tpa::hasNeon)
 									{
 										_DESTi = _mm256_sub_pd(_Ai, _Bi);
 									}//End if
+									else if constexpr (INSTR == tpa::op::ADD_SAT)
+									{
+										_DESTi = _mm256_add_pd(_Ai, _Bi);
+									}//End if
+									else if constexpr (INSTR == tpa::op::SUB_SAT)
+									{
+										_DESTi = _mm256_sub_pd(_Ai, _Bi);
+									}//End if
 									else if constexpr (INSTR == tpa::op::MULTIPLY)
 									{
 										_DESTi = _mm256_mul_pd(_Ai, _Bi);
@@ -5282,7 +5850,7 @@ if (tpa::hasNeon)
 									}//End else
 
 									//Store Result
-									_mm256_store_pd(&dest[i], _DESTi);
+									_mm256_storeu_pd(&dest[i], _DESTi);
 								}//End for
 							}//End if hasAVX2
 							else if (tpa::has_SSE2)
@@ -5293,7 +5861,7 @@ if (tpa::hasNeon)
 							for (; (i + 2) < end; i += 2)
 							{
 								//Set Values
-								_Ai = _mm_load_pd(&source1[i]);
+								_Ai = _mm_loadu_pd(&source1[i]);
 
 								//Calc
 								if constexpr (INSTR == tpa::op::ADD)
@@ -5304,6 +5872,14 @@ if (tpa::hasNeon)
 								{
 									_DESTi = _mm_sub_pd(_Ai, _Bi);
 								}//End if
+								else if constexpr (INSTR == tpa::op::ADD_SAT)
+								{
+									_DESTi = _mm_add_pd(_Ai, _Bi);
+								}//End if
+								else if constexpr (INSTR == tpa::op::SUB_SAT)
+								{
+									_DESTi = _mm_sub_pd(_Ai, _Bi);
+								}//End if
 								else if constexpr (INSTR == tpa::op::MULTIPLY)
 								{
 									_DESTi = _mm_mul_pd(_Ai, _Bi);
@@ -5344,12 +5920,23 @@ if (tpa::hasNeon)
 								}//End else
 
 								//Store Result
-								_mm_store_pd(&dest[i], _DESTi);
+								_mm_storeu_pd(&dest[i], _DESTi);
 							}//End for
 							}//End if has_SSE2
 #endif						
 						}//End if
 #pragma endregion
+#pragma region neon
+#ifdef TPA_NEON
+						if constexpr (std::is_same<T, T2>() && std::is_same<T, RES>() && tpa_basic_math_private::has_calculate_const_neon<INSTR, T>)
+						{
+							if (tpa::hasNeon)
+							{
+								tpa_basic_math_private::calculate_const_neon<INSTR, T>(i, end, source1.data(), _val, dest.data());
+							}//End if
+						}//End if
+#endif
+#pragma endregion
 #pragma region generic
 						for (; i != end; ++i)
 						{
@@ -5362,6 +5949,14 @@ if (tpa::hasNeon)
 							{
 								dest[i] = static_cast<RES>(source1[i] - _val);
 							}//End if
+							else if constexpr (INSTR == tpa::op::ADD_SAT)
+							{
+								dest[i] = static_cast<RES>(tpa::util::add_sat<T>(source1[i], static_cast<T>(_val)));
+							}//End if
+							else if constexpr (INSTR == tpa::op::SUB_SAT)
+							{
+								dest[i] = static_cast<RES>(tpa::util::sub_sat<T>(source1[i], static_cast<T>(_val)));
+							}//End if
 							else if constexpr (INSTR == tpa::op::MULTIPLY)
 							{
 								dest[i] = static_cast<RES>(source1[i] * _val);
@@ -5424,14 +6019,6 @@ if (tpa::hasNeon)
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::calculate(): " << ex.what() << "\n";
-			std::cerr << "tpa::simd::calculate will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -5498,13 +6085,18 @@ if (tpa::hasNeon)
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::compare(): " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::compare will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
 
+			//tpa::simd::runtime_avx512_policy may turn the 512-bit branches off for this input
+			const bool allow512 = tpa::simd::avx512_allowed(smallest * sizeof(T));
+
 			std::vector<std::shared_future<uint32_t>> results;
 			results.reserve(tpa::nThreads);
 
@@ -5513,7 +6105,7 @@ if (tpa::hasNeon)
 			for (const auto& sec : sections)
 			{
 				//Launch lambda from multiple threads
-				temp = tpa::tp->addTask([&source1, &source2, &dest, &sec]()
+				temp = tpa::tp->addTask([&source1, &source2, &dest, &sec, allow512]()
 					{
 						const size_t beg = sec.first;
 						const size_t end = sec.second;
@@ -5522,7 +6114,7 @@ if (tpa::hasNeon)
 						if constexpr (std::is_same<T, int8_t>() == true)
 						{
 #ifdef _M_AMD64
-							if (tpa::hasAVX512_ByteWord)
+							if (allow512 && tpa::hasAVX512_ByteWord)
 							{
 								__m512i _Ai, _Bi, _dest;
 								__mmask64 _mask;
@@ -5602,8 +6194,8 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
-									_Bi = _mm256_load_si256((__m256i*) & source2[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
+									_Bi = _mm256_loadu_si256((__m256i*) & source2[i]);
 									_dest = _mm256_setzero_si256();
 									_mask = _mm256_setzero_si256();
 
@@ -5613,7 +6205,7 @@ if (tpa::hasNeon)
 										_mask = _mm256_cmpgt_epi8(_Ai, _Bi);
 										_dest = _mm256_and_si256(_Ai, _mask);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::GREATER_THAN_OR_EQUAL)
 									{
@@ -5622,45 +6214,45 @@ if (tpa::hasNeon)
 
 										_dest = _mm256_and_si256(_Ai, _mm256_or_si256(_mask, _dest));
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::LESS_THAN)
 									{
 										_mask = _mm256_cmpgt_epi8(_Bi, _Ai);
 										_dest = _mm256_and_si256(_Ai, _mask);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::LESS_THAN_OR_EQUAL)
 									{
 										_mask = _mm256_cmpgt_epi8(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::EQUAL)
 									{
 										_mask = _mm256_cmpeq_epi8(_Ai, _Bi);
 										_dest = _mm256_and_si256(_Ai, _mask);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::NOT_EQUAL)
 									{
 										_mask = _mm256_cmpeq_epi8(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm256_min_epi8(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm256_max_epi8(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else
 									{
@@ -5678,7 +6270,7 @@ if (tpa::hasNeon)
 						else if constexpr (std::is_same<T, uint8_t>() == true)
 						{
 #ifdef _M_AMD64
-							if (tpa::hasAVX512_ByteWord)
+							if (allow512 && tpa::hasAVX512_ByteWord)
 							{
 								__m512i _Ai, _Bi, _dest;
 								__mmask64 _mask;
@@ -5758,8 +6350,8 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
-									_Bi = _mm256_load_si256((__m256i*) & source2[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
+									_Bi = _mm256_loadu_si256((__m256i*) & source2[i]);
 									_dest = _mm256_setzero_si256();
 									_mask = _mm256_setzero_si256();
 
@@ -5769,7 +6361,7 @@ if (tpa::hasNeon)
 										_mask = _mm256_cmpgt_epi8(_Ai, _Bi);
 										_dest = _mm256_and_si256(_Ai, _mask);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::GREATER_THAN_OR_EQUAL)
 									{
@@ -5778,45 +6370,45 @@ if (tpa::hasNeon)
 
 										_dest = _mm256_and_si256(_Ai, _mm256_or_si256(_mask, _dest));
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::LESS_THAN)
 									{
 										_mask = _mm256_cmpgt_epi8(_Bi, _Ai);
 										_dest = _mm256_and_si256(_Ai, _mask);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::LESS_THAN_OR_EQUAL)
 									{
 										_mask = _mm256_cmpgt_epi8(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::EQUAL)
 									{
 										_mask = _mm256_cmpeq_epi8(_Ai, _Bi);
 										_dest = _mm256_and_si256(_Ai, _mask);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::NOT_EQUAL)
 									{
 										_mask = _mm256_cmpeq_epi8(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm256_min_epu8(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm256_max_epu8(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else
 									{
@@ -5834,7 +6426,7 @@ if (tpa::hasNeon)
 						else if constexpr (std::is_same<T, int16_t>() == true)
 						{
 #ifdef _M_AMD64
-							if (tpa::hasAVX512_ByteWord)
+							if (allow512 && tpa::hasAVX512_ByteWord)
 							{
 								__m512i _Ai, _Bi, _dest;
 								__mmask32 _mask;
@@ -5914,8 +6506,8 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
-									_Bi = _mm256_load_si256((__m256i*) & source2[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
+									_Bi = _mm256_loadu_si256((__m256i*) & source2[i]);
 									_dest = _mm256_setzero_si256();
 									_mask = _mm256_setzero_si256();
 
@@ -5925,7 +6517,7 @@ if (tpa::hasNeon)
 										_mask = _mm256_cmpgt_epi16(_Ai, _Bi);
 										_dest = _mm256_and_si256(_Ai, _mask);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::GREATER_THAN_OR_EQUAL)
 									{
@@ -5934,45 +6526,45 @@ if (tpa::hasNeon)
 
 										_dest = _mm256_and_si256(_Ai, _mm256_or_si256(_mask, _dest));
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::LESS_THAN)
 									{
 										_mask = _mm256_cmpgt_epi16(_Bi, _Ai);
 										_dest = _mm256_and_si256(_Ai, _mask);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::LESS_THAN_OR_EQUAL)
 									{
 										_mask = _mm256_cmpgt_epi16(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::EQUAL)
 									{
 										_mask = _mm256_cmpeq_epi16(_Ai, _Bi);
 										_dest = _mm256_and_si256(_Ai, _mask);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::NOT_EQUAL)
 									{
 										_mask = _mm256_cmpeq_epi16(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm256_min_epi16(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm256_max_epi16(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else
 									{
@@ -5990,7 +6582,7 @@ if (tpa::hasNeon)
 						else if constexpr (std::is_same<T, uint16_t>() == true)
 						{
 #ifdef _M_AMD64
-							if (tpa::hasAVX512_ByteWord)
+							if (allow512 && tpa::hasAVX512_ByteWord)
 							{
 								__m512i _Ai, _Bi, _dest;
 								__mmask32 _mask;
@@ -6070,8 +6662,8 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
-									_Bi = _mm256_load_si256((__m256i*) & source2[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
+									_Bi = _mm256_loadu_si256((__m256i*) & source2[i]);
 									_dest = _mm256_setzero_si256();
 									_mask = _mm256_setzero_si256();
 
@@ -6081,7 +6673,7 @@ if (tpa::hasNeon)
 										_mask = _mm256_cmpgt_epi16(_Ai, _Bi);
 										_dest = _mm256_and_si256(_Ai, _mask);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::GREATER_THAN_OR_EQUAL)
 									{
@@ -6090,45 +6682,45 @@ if (tpa::hasNeon)
 
 										_dest = _mm256_and_si256(_Ai, _mm256_or_si256(_mask, _dest));
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::LESS_THAN)
 									{
 										_mask = _mm256_cmpgt_epi16(_Bi, _Ai);
 										_dest = _mm256_and_si256(_Ai, _mask);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::LESS_THAN_OR_EQUAL)
 									{
 										_mask = _mm256_cmpgt_epi16(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::EQUAL)
 									{
 										_mask = _mm256_cmpeq_epi16(_Ai, _Bi);
 										_dest = _mm256_and_si256(_Ai, _mask);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::NOT_EQUAL)
 									{
 										_mask = _mm256_cmpeq_epi16(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm256_min_epu16(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm256_max_epu16(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else
 									{
@@ -6146,7 +6738,7 @@ if (tpa::hasNeon)
 						else if constexpr (std::is_same<T, int32_t>() == true)
 						{
 #ifdef _M_AMD64
-							if (tpa::hasAVX512)
+							if (allow512 && tpa::hasAVX512)
 							{
 								__m512i _Ai, _Bi, _dest;
 								__mmask16 _mask;
@@ -6159,8 +6751,8 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm512_load_epi32(&source1[i]);
-									_Bi = _mm512_load_epi32(&source2[i]);
+									_Ai = _mm512_loadu_epi32(&source1[i]);
+									_Bi = _mm512_loadu_epi32(&source2[i]);
 									_dest = _mm512_setzero_si512();
 									_mask = 0;
 
@@ -6198,12 +6790,12 @@ if (tpa::hasNeon)
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm512_min_epi32(_Ai, _Bi);
-										_mm512_store_epi32(&dest[i], _dest);
+										_mm512_storeu_epi32(&dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm512_max_epi32(_Ai, _Bi);
-										_mm512_store_epi32(&dest[i], _dest);
+										_mm512_storeu_epi32(&dest[i], _dest);
 									}//End if
 									else
 									{
@@ -6226,8 +6818,8 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
-									_Bi = _mm256_load_si256((__m256i*) & source2[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
+									_Bi = _mm256_loadu_si256((__m256i*) & source2[i]);
 									_dest = _mm256_setzero_si256();
 									_mask = _mm256_setzero_si256();
 
@@ -6243,7 +6835,7 @@ if (tpa::hasNeon)
 
 										_dest = _mm256_and_si256(_Ai, _mm256_or_si256(_mask, _dest));
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::LESS_THAN)
 									{
@@ -6254,7 +6846,7 @@ if (tpa::hasNeon)
 										_mask = _mm256_cmpgt_epi32(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::EQUAL)
 									{
@@ -6265,17 +6857,17 @@ if (tpa::hasNeon)
 										_mask = _mm256_cmpeq_epi32(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm256_min_epi32(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm256_max_epi32(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else
 									{
@@ -6293,7 +6885,7 @@ if (tpa::hasNeon)
 						else if constexpr (std::is_same<T, uint32_t>() == true)
 						{
 #ifdef _M_AMD64	
-							if (tpa::hasAVX512)
+							if (allow512 && tpa::hasAVX512)
 							{
 								__m512i _Ai, _Bi, _dest;
 								__mmask16 _mask;
@@ -6306,8 +6898,8 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm512_load_epi32(&source1[i]);
-									_Bi = _mm512_load_epi32(&source2[i]);
+									_Ai = _mm512_loadu_epi32(&source1[i]);
+									_Bi = _mm512_loadu_epi32(&source2[i]);
 									_dest = _mm512_setzero_si512();
 									_mask = 0;
 
@@ -6345,12 +6937,12 @@ if (tpa::hasNeon)
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm512_min_epu32(_Ai, _Bi);
-										_mm512_store_epi32(&dest[i], _dest);
+										_mm512_storeu_epi32(&dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm512_max_epu32(_Ai, _Bi);
-										_mm512_store_epi32(&dest[i], _dest);
+										_mm512_storeu_epi32(&dest[i], _dest);
 									}//End if
 									else
 									{
@@ -6373,8 +6965,8 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
-									_Bi = _mm256_load_si256((__m256i*) & source2[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
+									_Bi = _mm256_loadu_si256((__m256i*) & source2[i]);
 									_dest = _mm256_setzero_si256();
 									_mask = _mm256_setzero_si256();
 
@@ -6390,7 +6982,7 @@ if (tpa::hasNeon)
 
 										_dest = _mm256_and_si256(_Ai, _mm256_or_si256(_mask, _dest));
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::LESS_THAN)
 									{
@@ -6401,7 +6993,7 @@ if (tpa::hasNeon)
 										_mask = _mm256_cmpgt_epi32(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::EQUAL)
 									{
@@ -6412,17 +7004,17 @@ if (tpa::hasNeon)
 										_mask = _mm256_cmpeq_epi32(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm256_min_epi32(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm256_max_epi32(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else
 									{
@@ -6440,7 +7032,7 @@ if (tpa::hasNeon)
 						else if constexpr (std::is_same<T, int64_t>() == true)
 						{
 #ifdef _M_AMD64
-							if (tpa::hasAVX512)
+							if (allow512 && tpa::hasAVX512)
 							{
 								__m512i _Ai, _Bi, _dest;
 								__mmask8 _mask;
@@ -6453,8 +7045,8 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm512_load_epi64(&source1[i]);
-									_Bi = _mm512_load_epi64(&source2[i]);
+									_Ai = _mm512_loadu_epi64(&source1[i]);
+									_Bi = _mm512_loadu_epi64(&source2[i]);
 									_dest = _mm512_setzero_si512();
 									_mask = 0;
 
@@ -6492,12 +7084,12 @@ if (tpa::hasNeon)
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm512_min_epi64(_Ai, _Bi);
-										_mm512_store_epi64(&dest[i], _dest);
+										_mm512_storeu_epi64(&dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm512_max_epi64(_Ai, _Bi);
-										_mm512_store_epi64(&dest[i], _dest);
+										_mm512_storeu_epi64(&dest[i], _dest);
 									}//End if
 									else
 									{
@@ -6520,8 +7112,8 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
-									_Bi = _mm256_load_si256((__m256i*) & source2[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
+									_Bi = _mm256_loadu_si256((__m256i*) & source2[i]);
 									_dest = _mm256_setzero_si256();
 									_mask = _mm256_setzero_si256();
 
@@ -6537,7 +7129,7 @@ if (tpa::hasNeon)
 
 										_dest = _mm256_and_si256(_Ai, _mm256_or_si256(_mask, _dest));
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::LESS_THAN)
 									{
@@ -6548,7 +7140,7 @@ if (tpa::hasNeon)
 										_mask = _mm256_cmpgt_epi64(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::EQUAL)
 									{
@@ -6559,17 +7151,17 @@ if (tpa::hasNeon)
 										_mask = _mm256_cmpeq_epi64(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm256_min_epi64(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm256_max_epi64(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else
 									{
@@ -6587,7 +7179,7 @@ if (tpa::hasNeon)
 						else if constexpr (std::is_same<T, uint64_t>() == true)
 						{
 #ifdef _M_AMD64	
-							if (tpa::hasAVX512)
+							if (allow512 && tpa::hasAVX512)
 							{
 								__m512i _Ai, _Bi, _dest;
 								__mmask8 _mask;
@@ -6600,8 +7192,8 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm512_load_epi64(&source1[i]);
-									_Bi = _mm512_load_epi64(&source2[i]);
+									_Ai = _mm512_loadu_epi64(&source1[i]);
+									_Bi = _mm512_loadu_epi64(&source2[i]);
 									_dest = _mm512_setzero_si512();
 									_mask = 0;
 
@@ -6639,12 +7231,12 @@ if (tpa::hasNeon)
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm512_min_epu64(_Ai, _Bi);
-										_mm512_store_epi64(&dest[i], _dest);
+										_mm512_storeu_epi64(&dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm512_max_epu64(_Ai, _Bi);
-										_mm512_store_epi64(&dest[i], _dest);
+										_mm512_storeu_epi64(&dest[i], _dest);
 									}//End if
 									else
 									{
@@ -6667,8 +7259,8 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
-									_Bi = _mm256_load_si256((__m256i*) & source2[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
+									_Bi = _mm256_loadu_si256((__m256i*) & source2[i]);
 									_dest = _mm256_setzero_si256();
 									_mask = _mm256_setzero_si256();
 
@@ -6684,7 +7276,7 @@ if (tpa::hasNeon)
 
 										_dest = _mm256_and_si256(_Ai, _mm256_or_si256(_mask, _dest));
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::LESS_THAN)
 									{
@@ -6695,7 +7287,7 @@ if (tpa::hasNeon)
 										_mask = _mm256_cmpgt_epi64(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::EQUAL)
 									{
@@ -6706,17 +7298,17 @@ if (tpa::hasNeon)
 										_mask = _mm256_cmpeq_epi64(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm256_min_epu64(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm256_max_epu64(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else
 									{
@@ -6734,7 +7326,7 @@ if (tpa::hasNeon)
 						else if constexpr (std::is_same<T, float>() == true)
 						{
 #ifdef _M_AMD64			
-							if (tpa::hasAVX512)
+							if (allow512 && tpa::hasAVX512)
 							{
 								__m512 _Ai, _Bi, _dest;
 								__mmask16 _mask;
@@ -6747,8 +7339,8 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm512_load_ps(&source1[i]);
-									_Bi = _mm512_load_ps(&source2[i]);
+									_Ai = _mm512_loadu_ps(&source1[i]);
+									_Bi = _mm512_loadu_ps(&source2[i]);
 									_dest = _mm512_setzero_ps();
 									_mask = 0;
 
@@ -6786,12 +7378,12 @@ if (tpa::hasNeon)
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm512_min_ps(_Ai, _Bi);
-										_mm512_store_ps(&dest[i], _dest);
+										_mm512_storeu_ps(&dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm512_max_ps(_Ai, _Bi);
-										_mm512_store_ps(&dest[i], _dest);
+										_mm512_storeu_ps(&dest[i], _dest);
 									}//End if
 									else
 									{
@@ -6815,8 +7407,8 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_ps(&source1[i]);
-									_Bi = _mm256_load_ps(&source2[i]);
+									_Ai = _mm256_loadu_ps(&source1[i]);
+									_Bi = _mm256_loadu_ps(&source2[i]);
 
 									//Compare
 									if constexpr (INSTR == tpa::comp::GREATER_THAN)
@@ -6852,12 +7444,12 @@ if (tpa::hasNeon)
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_mask = _mm256_min_ps(_Ai, _Bi);
-										_mm256_store_ps(&dest[i], _mask);
+										_mm256_storeu_ps(&dest[i], _mask);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_mask = _mm256_max_ps(_Ai, _Bi);
-										_mm256_store_ps(&dest[i], _mask);
+										_mm256_storeu_ps(&dest[i], _mask);
 									}//End if
 									else
 									{
@@ -6875,7 +7467,7 @@ if (tpa::hasNeon)
 						else if constexpr (std::is_same<T, double>() == true)
 						{
 #ifdef _M_AMD64
-							if (tpa::hasAVX512)
+							if (allow512 && tpa::hasAVX512)
 							{
 								__m512d _Ai, _Bi, _dest;
 								__mmask8 _mask;
@@ -6888,8 +7480,8 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm512_load_pd(&source1[i]);
-									_Bi = _mm512_load_pd(&source2[i]);
+									_Ai = _mm512_loadu_pd(&source1[i]);
+									_Bi = _mm512_loadu_pd(&source2[i]);
 									_dest = _mm512_setzero_pd();
 									_mask = 0;
 
@@ -6927,12 +7519,12 @@ if (tpa::hasNeon)
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm512_min_pd(_Ai, _Bi);
-										_mm512_store_pd(&dest[i], _dest);
+										_mm512_storeu_pd(&dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm512_max_pd(_Ai, _Bi);
-										_mm512_store_pd(&dest[i], _dest);
+										_mm512_storeu_pd(&dest[i], _dest);
 									}//End if
 									else
 									{
@@ -6956,8 +7548,8 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_pd(&source1[i]);
-									_Bi = _mm256_load_pd(&source2[i]);
+									_Ai = _mm256_loadu_pd(&source1[i]);
+									_Bi = _mm256_loadu_pd(&source2[i]);
 
 									//Compare
 									if constexpr (INSTR == tpa::comp::GREATER_THAN)
@@ -6993,12 +7585,12 @@ if (tpa::hasNeon)
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_mask = _mm256_min_pd(_Ai, _Bi);
-										_mm256_store_pd(&dest[i], _mask);
+										_mm256_storeu_pd(&dest[i], _mask);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_mask = _mm256_max_pd(_Ai, _Bi);
-										_mm256_store_pd(&dest[i], _mask);
+										_mm256_storeu_pd(&dest[i], _mask);
 									}//End if
 									else
 									{
@@ -7093,14 +7685,6 @@ if (tpa::hasNeon)
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::compare(): " << ex.what() << "\n";
-			std::cerr << "tpa::simd::compare will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -7155,21 +7739,26 @@ if (tpa::hasNeon)
 		try
 		{
 			static_assert(
-				std::is_same<CONTAINER_A::value_type, T>() &&
-				std::is_same<CONTAINER_A::value_type, CONTAINER_C::value_type>(),
+				std::is_same<typename CONTAINER_A::value_type, T>() &&
+				std::is_same<typename CONTAINER_A::value_type, typename CONTAINER_C::value_type>(),
 				"Compile Error! The source and destination containers must be of the same value type!");
 
 			smallest = source1.size();
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::compare_const: " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::compare_const will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
 
+			//tpa::simd::runtime_avx512_policy may turn the 512-bit branches off for this input
+			const bool allow512 = tpa::simd::avx512_allowed(smallest * sizeof(T));
+
 			std::vector<std::shared_future<uint32_t>> results;
 			results.reserve(tpa::nThreads);
 
@@ -7178,7 +7767,7 @@ if (tpa::hasNeon)
 			for (const auto& sec : sections)
 			{
 				//Launch lambda from multiple threads
-				temp = tpa::tp->addTask([&source1, &val, &dest, &sec]()
+				temp = tpa::tp->addTask([&source1, &val, &dest, &sec, allow512]()
 					{
 						const size_t beg = sec.first;
 						const size_t end = sec.second;
@@ -7190,7 +7779,7 @@ if (tpa::hasNeon)
 						if constexpr (std::is_same<T, int8_t>() == true)
 						{
 #ifdef _M_AMD64
-							if (tpa::hasAVX512_ByteWord)
+							if (allow512 && tpa::hasAVX512_ByteWord)
 							{
 								__m512i _Ai, _Bi, _dest;
 								__mmask64 _mask;
@@ -7270,7 +7859,7 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 									_Bi = _mm256_set1_epi8(_val);
 									_dest = _mm256_setzero_si256();
 									_mask = _mm256_setzero_si256();
@@ -7281,7 +7870,7 @@ if (tpa::hasNeon)
 										_mask = _mm256_cmpgt_epi8(_Ai, _Bi);
 										_dest = _mm256_and_si256(_Ai, _mask);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::GREATER_THAN_OR_EQUAL)
 									{
@@ -7290,45 +7879,45 @@ if (tpa::hasNeon)
 
 										_dest = _mm256_and_si256(_Ai, _mm256_or_si256(_mask, _dest));
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::LESS_THAN)
 									{
 										_mask = _mm256_cmpgt_epi8(_Bi, _Ai);
 										_dest = _mm256_and_si256(_Ai, _mask);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::LESS_THAN_OR_EQUAL)
 									{
 										_mask = _mm256_cmpgt_epi8(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::EQUAL)
 									{
 										_mask = _mm256_cmpeq_epi8(_Ai, _Bi);
 										_dest = _mm256_and_si256(_Ai, _mask);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::NOT_EQUAL)
 									{
 										_mask = _mm256_cmpeq_epi8(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm256_min_epi8(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm256_max_epi8(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else
 									{
@@ -7346,7 +7935,7 @@ if (tpa::hasNeon)
 						else if constexpr (std::is_same<T, uint8_t>() == true)
 						{
 #ifdef _M_AMD64
-							if (tpa::hasAVX512_ByteWord)
+							if (allow512 && tpa::hasAVX512_ByteWord)
 							{
 								__m512i _Ai, _Bi, _dest;
 								__mmask64 _mask;
@@ -7426,7 +8015,7 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 									_Bi = _mm256_set1_epi8(_val);
 									_dest = _mm256_setzero_si256();
 									_mask = _mm256_setzero_si256();
@@ -7437,7 +8026,7 @@ if (tpa::hasNeon)
 										_mask = _mm256_cmpgt_epi8(_Ai, _Bi);
 										_dest = _mm256_and_si256(_Ai, _mask);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::GREATER_THAN_OR_EQUAL)
 									{
@@ -7446,45 +8035,45 @@ if (tpa::hasNeon)
 
 										_dest = _mm256_and_si256(_Ai, _mm256_or_si256(_mask, _dest));
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::LESS_THAN)
 									{
 										_mask = _mm256_cmpgt_epi8(_Bi, _Ai);
 										_dest = _mm256_and_si256(_Ai, _mask);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::LESS_THAN_OR_EQUAL)
 									{
 										_mask = _mm256_cmpgt_epi8(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::EQUAL)
 									{
 										_mask = _mm256_cmpeq_epi8(_Ai, _Bi);
 										_dest = _mm256_and_si256(_Ai, _mask);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::NOT_EQUAL)
 									{
 										_mask = _mm256_cmpeq_epi8(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm256_min_epu8(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm256_max_epu8(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else
 									{
@@ -7502,7 +8091,7 @@ if (tpa::hasNeon)
 						else if constexpr (std::is_same<T, int16_t>() == true)
 						{
 #ifdef _M_AMD64
-							if (tpa::hasAVX512_ByteWord)
+							if (allow512 && tpa::hasAVX512_ByteWord)
 							{
 								__m512i _Ai, _Bi, _dest;
 								__mmask32 _mask;
@@ -7582,7 +8171,7 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 									_Bi = _mm256_set1_epi16(_val);
 									_dest = _mm256_setzero_si256();
 									_mask = _mm256_setzero_si256();
@@ -7593,7 +8182,7 @@ if (tpa::hasNeon)
 										_mask = _mm256_cmpgt_epi16(_Ai, _Bi);
 										_dest = _mm256_and_si256(_Ai, _mask);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::GREATER_THAN_OR_EQUAL)
 									{
@@ -7602,45 +8191,45 @@ if (tpa::hasNeon)
 
 										_dest = _mm256_and_si256(_Ai, _mm256_or_si256(_mask, _dest));
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::LESS_THAN)
 									{
 										_mask = _mm256_cmpgt_epi16(_Bi, _Ai);
 										_dest = _mm256_and_si256(_Ai, _mask);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::LESS_THAN_OR_EQUAL)
 									{
 										_mask = _mm256_cmpgt_epi16(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::EQUAL)
 									{
 										_mask = _mm256_cmpeq_epi16(_Ai, _Bi);
 										_dest = _mm256_and_si256(_Ai, _mask);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::NOT_EQUAL)
 									{
 										_mask = _mm256_cmpeq_epi16(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm256_min_epi16(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm256_max_epi16(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else
 									{
@@ -7658,7 +8247,7 @@ if (tpa::hasNeon)
 						else if constexpr (std::is_same<T, uint16_t>() == true)
 						{
 #ifdef _M_AMD64
-							if (tpa::hasAVX512_ByteWord)
+							if (allow512 && tpa::hasAVX512_ByteWord)
 							{
 								__m512i _Ai, _Bi, _dest;
 								__mmask32 _mask;
@@ -7738,7 +8327,7 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 									_Bi = _mm256_set1_epi16(_val);
 									_dest = _mm256_setzero_si256();
 									_mask = _mm256_setzero_si256();
@@ -7749,7 +8338,7 @@ if (tpa::hasNeon)
 										_mask = _mm256_cmpgt_epi16(_Ai, _Bi);
 										_dest = _mm256_and_si256(_Ai, _mask);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::GREATER_THAN_OR_EQUAL)
 									{
@@ -7758,45 +8347,45 @@ if (tpa::hasNeon)
 
 										_dest = _mm256_and_si256(_Ai, _mm256_or_si256(_mask, _dest));
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::LESS_THAN)
 									{
 										_mask = _mm256_cmpgt_epi16(_Bi, _Ai);
 										_dest = _mm256_and_si256(_Ai, _mask);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::LESS_THAN_OR_EQUAL)
 									{
 										_mask = _mm256_cmpgt_epi16(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::EQUAL)
 									{
 										_mask = _mm256_cmpeq_epi16(_Ai, _Bi);
 										_dest = _mm256_and_si256(_Ai, _mask);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::NOT_EQUAL)
 									{
 										_mask = _mm256_cmpeq_epi16(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm256_min_epu16(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm256_max_epu16(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else
 									{
@@ -7814,7 +8403,7 @@ if (tpa::hasNeon)
 						else if constexpr (std::is_same<T, int32_t>() == true)
 						{
 #ifdef _M_AMD64
-							if (tpa::hasAVX512)
+							if (allow512 && tpa::hasAVX512)
 							{
 								__m512i _Ai, _Bi, _dest;
 								__mmask16 _mask;
@@ -7827,7 +8416,7 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm512_load_epi32(&source1[i]);
+									_Ai = _mm512_loadu_epi32(&source1[i]);
 									_Bi = _mm512_set1_epi32(_val);
 									_dest = _mm512_setzero_si512();
 									_mask = 0;
@@ -7866,12 +8455,12 @@ if (tpa::hasNeon)
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm512_min_epi32(_Ai, _Bi);
-										_mm512_store_epi32(&dest[i], _dest);
+										_mm512_storeu_epi32(&dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm512_max_epi32(_Ai, _Bi);
-										_mm512_store_epi32(&dest[i], _dest);
+										_mm512_storeu_epi32(&dest[i], _dest);
 									}//End if
 									else
 									{
@@ -7894,7 +8483,7 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 									_Bi = _mm256_set1_epi32(_val);
 									_dest = _mm256_setzero_si256();
 									_mask = _mm256_setzero_si256();
@@ -7912,7 +8501,7 @@ if (tpa::hasNeon)
 
 										_dest = _mm256_and_si256(_Ai, _mm256_or_si256(_mask, _dest));
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::LESS_THAN)
 									{
@@ -7924,7 +8513,7 @@ if (tpa::hasNeon)
 										_mask = _mm256_cmpgt_epi32(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::EQUAL)
 									{
@@ -7936,17 +8525,17 @@ if (tpa::hasNeon)
 										_mask = _mm256_cmpeq_epi32(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm256_min_epi32(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm256_max_epi32(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else
 									{
@@ -7964,7 +8553,7 @@ if (tpa::hasNeon)
 						else if constexpr (std::is_same<T, uint32_t>() == true)
 						{
 #ifdef _M_AMD64	
-							if (tpa::hasAVX512)
+							if (allow512 && tpa::hasAVX512)
 							{
 								__m512i _Ai, _Bi, _dest;
 								__mmask16 _mask;
@@ -7977,7 +8566,7 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm512_load_epi32(&source1[i]);
+									_Ai = _mm512_loadu_epi32(&source1[i]);
 									_Bi = _mm512_set1_epi32(_val);
 									_dest = _mm512_setzero_si512();
 									_mask = 0;
@@ -8016,12 +8605,12 @@ if (tpa::hasNeon)
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm512_min_epu32(_Ai, _Bi);
-										_mm512_store_epi32(&dest[i], _dest);
+										_mm512_storeu_epi32(&dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm512_max_epu32(_Ai, _Bi);
-										_mm512_store_epi32(&dest[i], _dest);
+										_mm512_storeu_epi32(&dest[i], _dest);
 									}//End if
 									else
 									{
@@ -8044,7 +8633,7 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 									_Bi = _mm256_set1_epi32(_val);
 									_dest = _mm256_setzero_si256();
 									_mask = _mm256_setzero_si256();
@@ -8061,7 +8650,7 @@ if (tpa::hasNeon)
 
 										_dest = _mm256_and_si256(_Ai, _mm256_or_si256(_mask, _dest));
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::LESS_THAN)
 									{
@@ -8072,7 +8661,7 @@ if (tpa::hasNeon)
 										_mask = _mm256_cmpgt_epi32(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::EQUAL)
 									{
@@ -8083,17 +8672,17 @@ if (tpa::hasNeon)
 										_mask = _mm256_cmpeq_epi32(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm256_min_epi32(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm256_max_epi32(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else
 									{
@@ -8111,7 +8700,7 @@ if (tpa::hasNeon)
 						else if constexpr (std::is_same<T, int64_t>() == true)
 						{
 #ifdef _M_AMD64
-							if (tpa::hasAVX512)
+							if (allow512 && tpa::hasAVX512)
 							{
 								__m512i _Ai, _Bi, _dest;
 								__mmask8 _mask;
@@ -8124,7 +8713,7 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm512_load_epi64(&source1[i]);
+									_Ai = _mm512_loadu_epi64(&source1[i]);
 									_Bi = _mm512_set1_epi64(_val);
 									_dest = _mm512_setzero_si512();
 									_mask = 0;
@@ -8163,12 +8752,12 @@ if (tpa::hasNeon)
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm512_min_epi64(_Ai, _Bi);
-										_mm512_store_epi64(&dest[i], _dest);
+										_mm512_storeu_epi64(&dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm512_max_epi64(_Ai, _Bi);
-										_mm512_store_epi64(&dest[i], _dest);
+										_mm512_storeu_epi64(&dest[i], _dest);
 									}//End if
 									else
 									{
@@ -8191,7 +8780,7 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 									_Bi = _mm256_set1_epi64x(_val);
 									_dest = _mm256_setzero_si256();
 									_mask = _mm256_setzero_si256();
@@ -8208,7 +8797,7 @@ if (tpa::hasNeon)
 
 										_dest = _mm256_and_si256(_Ai, _mm256_or_si256(_mask, _dest));
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::LESS_THAN)
 									{
@@ -8219,7 +8808,7 @@ if (tpa::hasNeon)
 										_mask = _mm256_cmpgt_epi64(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::EQUAL)
 									{
@@ -8230,17 +8819,17 @@ if (tpa::hasNeon)
 										_mask = _mm256_cmpeq_epi64(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm256_min_epi64(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm256_max_epi64(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else
 									{
@@ -8258,7 +8847,7 @@ if (tpa::hasNeon)
 						else if constexpr (std::is_same<T, uint64_t>() == true)
 						{
 #ifdef _M_AMD64	
-							if (tpa::hasAVX512)
+							if (allow512 && tpa::hasAVX512)
 							{
 								__m512i _Ai, _Bi, _dest;
 								__mmask8 _mask;
@@ -8271,7 +8860,7 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm512_load_epi64(&source1[i]);
+									_Ai = _mm512_loadu_epi64(&source1[i]);
 									_Bi = _mm512_set1_epi64(_val);
 									_dest = _mm512_setzero_si512();
 									_mask = 0;
@@ -8310,12 +8899,12 @@ if (tpa::hasNeon)
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm512_min_epu64(_Ai, _Bi);
-										_mm512_store_epi64(&dest[i], _dest);
+										_mm512_storeu_epi64(&dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm512_max_epu64(_Ai, _Bi);
-										_mm512_store_epi64(&dest[i], _dest);
+										_mm512_storeu_epi64(&dest[i], _dest);
 									}//End if
 									else
 									{
@@ -8338,7 +8927,7 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 									_Bi = _mm256_set1_epi64x(_val);
 									_dest = _mm256_setzero_si256();
 									_mask = _mm256_setzero_si256();
@@ -8355,7 +8944,7 @@ if (tpa::hasNeon)
 
 										_dest = _mm256_and_si256(_Ai, _mm256_or_si256(_mask, _dest));
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::LESS_THAN)
 									{
@@ -8366,7 +8955,7 @@ if (tpa::hasNeon)
 										_mask = _mm256_cmpgt_epi64(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::EQUAL)
 									{
@@ -8377,17 +8966,17 @@ if (tpa::hasNeon)
 										_mask = _mm256_cmpeq_epi64(_Ai, _Bi);
 										_dest = _mm256_andnot_si256(_mask, _Ai);
 
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm256_min_epu64(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm256_max_epu64(_Ai, _Bi);
-										_mm256_store_si256((__m256i*) & dest[i], _dest);
+										_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 									}//End if
 									else
 									{
@@ -8405,7 +8994,7 @@ if (tpa::hasNeon)
 						else if constexpr (std::is_same<T, float>() == true)
 						{
 #ifdef _M_AMD64			
-							if (tpa::hasAVX512)
+							if (allow512 && tpa::hasAVX512)
 							{
 								__m512 _Ai, _Bi, _dest;
 								__mmask16 _mask;
@@ -8418,7 +9007,7 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm512_load_ps(&source1[i]);
+									_Ai = _mm512_loadu_ps(&source1[i]);
 									_Bi = _mm512_set1_ps(_val);
 									_dest = _mm512_setzero_ps();
 									_mask = 0;
@@ -8457,12 +9046,12 @@ if (tpa::hasNeon)
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm512_min_ps(_Ai, _Bi);
-										_mm512_store_ps(&dest[i], _dest);
+										_mm512_storeu_ps(&dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm512_max_ps(_Ai, _Bi);
-										_mm512_store_ps(&dest[i], _dest);
+										_mm512_storeu_ps(&dest[i], _dest);
 									}//End if
 									else
 									{
@@ -8486,7 +9075,7 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_ps(&source1[i]);
+									_Ai = _mm256_loadu_ps(&source1[i]);
 									_Bi = _mm256_set1_ps(_val);
 
 									//Compare
@@ -8523,12 +9112,12 @@ if (tpa::hasNeon)
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_mask = _mm256_min_ps(_Ai, _Bi);
-										_mm256_store_ps(&dest[i], _mask);
+										_mm256_storeu_ps(&dest[i], _mask);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_mask = _mm256_max_ps(_Ai, _Bi);
-										_mm256_store_ps(&dest[i], _mask);
+										_mm256_storeu_ps(&dest[i], _mask);
 									}//End if
 									else
 									{
@@ -8546,7 +9135,7 @@ if (tpa::hasNeon)
 						else if constexpr (std::is_same<T, double>() == true)
 						{
 #ifdef _M_AMD64
-							if (tpa::hasAVX512)
+							if (allow512 && tpa::hasAVX512)
 							{
 								__m512d _Ai, _Bi, _dest;
 								__mmask8 _mask;
@@ -8559,7 +9148,7 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm512_load_pd(&source1[i]);
+									_Ai = _mm512_loadu_pd(&source1[i]);
 									_Bi = _mm512_set1_pd(_val);
 									_dest = _mm512_setzero_pd();
 									_mask = 0;
@@ -8598,12 +9187,12 @@ if (tpa::hasNeon)
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_dest = _mm512_min_pd(_Ai, _Bi);
-										_mm512_store_pd(&dest[i], _dest);
+										_mm512_storeu_pd(&dest[i], _dest);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_dest = _mm512_max_pd(_Ai, _Bi);
-										_mm512_store_pd(&dest[i], _dest);
+										_mm512_storeu_pd(&dest[i], _dest);
 									}//End if
 									else
 									{
@@ -8627,7 +9216,7 @@ if (tpa::hasNeon)
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_pd(&source1[i]);
+									_Ai = _mm256_loadu_pd(&source1[i]);
 									_Bi = _mm256_set1_pd(_val);
 
 									//Compare
@@ -8664,12 +9253,12 @@ if (tpa::hasNeon)
 									else if constexpr (INSTR == tpa::comp::MIN)
 									{
 										_mask = _mm256_min_pd(_Ai, _Bi);
-										_mm256_store_pd(&dest[i], _mask);
+										_mm256_storeu_pd(&dest[i], _mask);
 									}//End if
 									else if constexpr (INSTR == tpa::comp::MAX)
 									{
 										_mask = _mm256_max_pd(_Ai, _Bi);
-										_mm256_store_pd(&dest[i], _mask);
+										_mm256_storeu_pd(&dest[i], _mask);
 									}//End if
 									else
 									{
@@ -8765,14 +9354,6 @@ if (tpa::hasNeon)
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::compare_const: " << ex.what() << "\n";
-			std::cerr << "tpa::simd::compare_const will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -34,6 +34,46 @@
 #include "../InstructionSet.hpp"
 #include "simd.hpp"
 
+#if defined(TPA_X86_64) && !defined(_MSC_VER)
+/// <summary>
+/// <para>_BitScanForward, _BitScanReverse, _rotl64 and _rotr64 are MSVC intrinsics, these are the equivalents for other compilers.</para>
+/// <para>The 32-bit versions take 'unsigned int' as MSVC's 'unsigned long' is 32 bits wide.</para>
+/// </summary>
+inline unsigned char _BitScanForward(unsigned long* index, const unsigned int mask) noexcept
+{
+	*index = (mask != 0u) ? static_cast<unsigned long>(std::countr_zero(mask)) : 0ul;
+	return static_cast<unsigned char>(mask != 0u);
+}//End of _BitScanForward
+
+inline unsigned char _BitScanForward64(unsigned long* index, const unsigned long long mask) noexcept
+{
+	*index = (mask != 0ull) ? static_cast<unsigned long>(std::countr_zero(mask)) : 0ul;
+	return static_cast<unsigned char>(mask != 0ull);
+}//End of _BitScanForward64
+
+inline unsigned char _BitScanReverse(unsigned long* index, const unsigned int mask) noexcept
+{
+	*index = (mask != 0u) ? static_cast<unsigned long>(31 - std::countl_zero(mask)) : 0ul;
+	return static_cast<unsigned char>(mask != 0u);
+}//End of _BitScanReverse
+
+inline unsigned char _BitScanReverse64(unsigned long* index, const unsigned long long mask) noexcept
+{
+	*index = (mask != 0ull) ? static_cast<unsigned long>(63 - std::countl_zero(mask)) : 0ul;
+	return static_cast<unsigned char>(mask != 0ull);
+}//End of _BitScanReverse64
+
+inline unsigned long long _rotl64(const unsigned long long value, const int shift) noexcept
+{
+	return std::rotl(value, shift);
+}//End of _rotl64
+
+inline unsigned long long _rotr64(const unsigned long long value, const int shift) noexcept
+{
+	return std::rotr(value, shift);
+}//End of _rotr64
+#endif
+
 /// <summary>
 /// <para>Truly Parallel Algorithms</para>
 /// <para>Bit Manipulation Functions.</para>
@@ -941,13 +981,13 @@ namespace tpa::bit_manip
 		else if constexpr (std::is_same<T, int32_t>() || std::is_same<T, uint32_t>())
 		{
 #ifdef TPA_X86_64
-			if (tpa::hasBMI1)
+			if (tpa::hasBMI1) [&]() TPA_TARGET("bmi")
 			{
 				T lowest = _blsi_u32(x);
 				lowest = lowest >> (static_cast<T>(static_cast<uint32_t>(lowest >> 1u) > 0u));
 
 				x = x | lowest;
-			}//End if
+			}();//End if
 			else
 			{
 				T lowest (x & -x);
@@ -965,13 +1005,13 @@ namespace tpa::bit_manip
 		else if constexpr (std::is_same<T, int64_t>() || std::is_same<T, uint64_t>())
 		{
 #ifdef TPA_X86_64
-			if (tpa::hasBMI1)
+			if (tpa::hasBMI1) [&]() TPA_TARGET("bmi")
 			{
 				T lowest = _blsi_u64(x);
 				lowest = lowest >> (static_cast<T>(static_cast<uint64_t>(lowest >> 1ull) > 0ull));
 
 				x = x | lowest;
-			}//End if
+			}();//End if
 			else
 			{
 				T lowest = (x & -x);
@@ -992,13 +1032,13 @@ namespace tpa::bit_manip
 			uint32_t x_as_int = *reinterpret_cast<int32_t*>(&x);
 
 #ifdef TPA_X86_64
-			if (tpa::hasBMI1)
+			if (tpa::hasBMI1) [&]() TPA_TARGET("bmi")
 			{
 				lowest = _blsi_u32(x_as_int);
 				lowest = lowest >> (static_cast<uint32_t>(static_cast<uint32_t>(lowest >> 1u) > 0u));
 
 				x_as_int = x_as_int | lowest;
-			}//End if
+			}();//End if
 			else
 			{
 				lowest = x_as_int & -x_as_int;
@@ -1021,13 +1061,13 @@ namespace tpa::bit_manip
 			int64_t x_as_int = *reinterpret_cast<int64_t*>(&x);
 
 #ifdef TPA_X86_64
-			if (tpa::hasBMI1)
+			if (tpa::hasBMI1) [&]() TPA_TARGET("bmi")
 			{
 				lowest = _blsi_u64(x_as_int);
 				lowest = lowest >> (static_cast<uint64_t>(static_cast<uint64_t>(lowest >> 1ull) > 0ull));
 
 				x_as_int = x_as_int | lowest;
-			}//End if
+			}();//End if
 			else
 			{
 				lowest = x_as_int & -x_as_int;
@@ -1188,11 +1228,11 @@ namespace tpa::bit_manip
 			{
 				if constexpr (std::is_same<T, uint64_t>() || std::is_same<T, int64_t>())
 				{
-					return static_cast<uint64_t>(_mm_popcnt_u64(x));
+					return static_cast<uint64_t>([&]() TPA_TARGET("popcnt") { return _mm_popcnt_u64(x); }());
 				}//End if
 				else if constexpr (std::is_same<T, uint32_t>() || std::is_same<T, int32_t>())
 				{
-					return static_cast<uint64_t>(_mm_popcnt_u32(x));
+					return static_cast<uint64_t>([&]() TPA_TARGET("popcnt") { return _mm_popcnt_u32(x); }());
 				}//End else
 				else
 				{
@@ -1233,7 +1273,7 @@ namespace tpa::bit_manip
 #ifdef TPA_X86_64
 		if (tpa::hasPOPCNT)
 		{
-			return static_cast<uint64_t>(_mm_popcnt_u32(temp));
+			return static_cast<uint64_t>([&]() TPA_TARGET("popcnt") { return _mm_popcnt_u32(temp); }());
 		}//End if
 		else
 		{
@@ -1264,7 +1304,7 @@ namespace tpa::bit_manip
 #ifdef TPA_X86_64
 			if (tpa::hasPOPCNT)
 			{
-				return _mm_popcnt_u64(temp);
+				return [&]() TPA_TARGET("popcnt") { return _mm_popcnt_u64(temp); }();
 			}//End if
 			else
 			{
@@ -1316,7 +1356,7 @@ namespace tpa::bit_manip
 		{
 			if (tpa::hasLZCNT)
 			{
-				return _lzcnt_u64(x);
+				return [&]() TPA_TARGET("lzcnt") { return _lzcnt_u64(x); }();
 			}//End if
 			{
 				uint64_t y = 0ull;
@@ -1336,7 +1376,7 @@ namespace tpa::bit_manip
 		{
 			if (tpa::hasLZCNT)
 			{
-				return static_cast<uint64_t>(_lzcnt_u32(x));
+				return static_cast<uint64_t>([&]() TPA_TARGET("lzcnt") { return _lzcnt_u32(x); }());
 			}//End if
 			else
 			{
@@ -1381,7 +1421,7 @@ namespace tpa::bit_manip
 
 			if (tpa::hasLZCNT)
 			{
-				return _lzcnt_u64(temp);
+				return [&]() TPA_TARGET("lzcnt") { return _lzcnt_u64(temp); }();
 			}//End if
 			else
 			{
@@ -1403,7 +1443,7 @@ namespace tpa::bit_manip
 			int32_t temp = *reinterpret_cast<int32_t*>(&x);
 			if (tpa::hasLZCNT)
 			{
-				return static_cast<uint64_t>(_lzcnt_u32(temp));
+				return static_cast<uint64_t>([&]() TPA_TARGET("lzcnt") { return _lzcnt_u32(temp); }());
 			}//End if
 			else
 			{
@@ -1532,7 +1572,7 @@ namespace tpa::bit_manip
 		{
 			if (tpa::hasBMI1)
 			{
-				return _tzcnt_u64(x);
+				return [&]() TPA_TARGET("bmi") { return _tzcnt_u64(x); }();
 			}//End if
 			{
 				uint64_t count = 0ull;
@@ -1557,7 +1597,7 @@ namespace tpa::bit_manip
 		{
 			if (tpa::hasBMI1)
 			{
-				return static_cast<uint64_t>(_tzcnt_u32(x));
+				return static_cast<uint64_t>([&]() TPA_TARGET("bmi") { return _tzcnt_u32(x); }());
 			}//End if
 			else
 			{
@@ -1623,7 +1663,7 @@ namespace tpa::bit_manip
 
 			if (tpa::hasBMI1)
 			{
-				return _tzcnt_u64(temp);
+				return [&]() TPA_TARGET("bmi") { return _tzcnt_u64(temp); }();
 			}//End if
 			else
 			{
@@ -1651,7 +1691,7 @@ namespace tpa::bit_manip
 
 			if (tpa::hasBMI1)
 			{
-				return static_cast<uint64_t>(_tzcnt_u32(temp));
+				return static_cast<uint64_t>([&]() TPA_TARGET("bmi") { return _tzcnt_u32(temp); }());
 			}//End if
 			else
 			{
@@ -2124,7 +2164,7 @@ namespace tpa::bit_manip
 			temp = temp & -temp;
 
 			if ((temp & 0xffffffffll) != 0ll) index += 32ll;
-			if ((temp & 0xffff0000ll) != 0ll) index += 1ll6;
+			if ((temp & 0xffff0000ll) != 0ll) index += 16ll;
 			if ((temp & 0xff00ff00ll) != 0ll) index += 8ll;
 			if ((temp & 0xf0f0f0f0ll) != 0ll) index += 4ll;
 			if ((temp & 0xccccccccll) != 0ll) index += 2ll;
@@ -2169,11 +2209,11 @@ namespace tpa::bit_manip
 		}//End if
 		else if constexpr (std::is_same<T, float>())
 		{
-			x = *reinterpret_cast<float*>(*reinterpret_cast<int32_t*>(&x)) | static_cast<int32_t>(0b0101'0101'0101'0101'0101'0101'0101'0101);
+			x = std::bit_cast<float>(std::bit_cast<int32_t>(x) | static_cast<int32_t>(0b0101'0101'0101'0101'0101'0101'0101'0101));
 		}//End if
 		else if constexpr (std::is_same<T, double>())
 		{
-			x = *reinterpret_cast<double*>(*reinterpret_cast<int64_t*>(&x)) | static_cast<int64_t>(0b0101'0101'0101'0101'0101'0101'0101'0101'0101'0101'0101'0101'0101'0101'0101'0101);
+			x = std::bit_cast<double>(std::bit_cast<int64_t>(x) | static_cast<int64_t>(0b0101'0101'0101'0101'0101'0101'0101'0101'0101'0101'0101'0101'0101'0101'0101'0101));
 		}//End if
 		else
 		{
@@ -2211,11 +2251,11 @@ namespace tpa::bit_manip
 		}//End if
 		else if constexpr (std::is_same<T, float>())
 		{
-			x = *reinterpret_cast<float*>(*reinterpret_cast<int32_t*>(&x)) & static_cast<int32_t>(0b0101'0101'0101'0101'0101'0101'0101'0101);
+			x = std::bit_cast<float>(std::bit_cast<int32_t>(x) & static_cast<int32_t>(0b0101'0101'0101'0101'0101'0101'0101'0101));
 		}//End if
 		else if constexpr (std::is_same<T, double>())
 		{
-			x = *reinterpret_cast<double*>(*reinterpret_cast<int64_t*>(&x)) & static_cast<int64_t>(0b0101'0101'0101'0101'0101'0101'0101'0101'0101'0101'0101'0101'0101'0101'0101'0101);
+			x = std::bit_cast<double>(std::bit_cast<int64_t>(x) & static_cast<int64_t>(0b0101'0101'0101'0101'0101'0101'0101'0101'0101'0101'0101'0101'0101'0101'0101'0101));
 		}//End if
 		else
 		{
@@ -2398,11 +2438,11 @@ namespace tpa::bit_manip
 		}//End if
 		else if constexpr (std::is_same<T, float>())
 		{
-			x = *reinterpret_cast<float*>(*reinterpret_cast<int32_t*>(&x)) | static_cast<int32_t>(0b1010'1010'1010'1010'1010'1010'1010'1010);
+			x = std::bit_cast<float>(std::bit_cast<int32_t>(x) | static_cast<int32_t>(0b1010'1010'1010'1010'1010'1010'1010'1010));
 		}//End if
 		else if constexpr (std::is_same<T, double>())
 		{
-			x = *reinterpret_cast<double*>(*reinterpret_cast<int64_t*>(&x)) | static_cast<int64_t>(0b1010'1010'1010'1010'1010'1010'1010'1010'1010'1010'1010'1010'1010'1010'1010'1010);
+			x = std::bit_cast<double>(std::bit_cast<int64_t>(x) | static_cast<int64_t>(0b1010'1010'1010'1010'1010'1010'1010'1010'1010'1010'1010'1010'1010'1010'1010'1010));
 		}//End if
 		else
 		{
@@ -2441,11 +2481,11 @@ namespace tpa::bit_manip
 		}//End if
 		else if constexpr (std::is_same<T, float>())
 		{
-			x = *reinterpret_cast<float*>(*reinterpret_cast<int32_t*>(&x)) & static_cast<int32_t>(0b1010'1010'1010'1010'1010'1010'1010'1010);
+			x = std::bit_cast<float>(std::bit_cast<int32_t>(x) & static_cast<int32_t>(0b1010'1010'1010'1010'1010'1010'1010'1010));
 		}//End if
 		else if constexpr (std::is_same<T, double>())
 		{
-			x = *reinterpret_cast<double*>(*reinterpret_cast<int64_t*>(&x)) & static_cast<int64_t>(0b1010'1010'1010'1010'1010'1010'1010'1010'1010'1010'1010'1010'1010'1010'1010'1010);
+			x = std::bit_cast<double>(std::bit_cast<int64_t>(x) & static_cast<int64_t>(0b1010'1010'1010'1010'1010'1010'1010'1010'1010'1010'1010'1010'1010'1010'1010'1010));
 		}//End if
 		else
 		{
@@ -2483,11 +2523,11 @@ namespace tpa::bit_manip
 		}//End if
 		else if constexpr (std::is_same<T, float>())
 		{
-			x = *reinterpret_cast<float*>(*reinterpret_cast<int32_t*>(&x)) & static_cast<int32_t>(0b0111'1111'1111'1111'1111'1111'1111'1111);
+			x = std::bit_cast<float>(std::bit_cast<int32_t>(x) & static_cast<int32_t>(0b0111'1111'1111'1111'1111'1111'1111'1111));
 		}//End if
 		else if constexpr (std::is_same<T, double>())
 		{
-			x = *reinterpret_cast<double*>(*reinterpret_cast<int64_t*>(&x)) & static_cast<T>(0b0111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111);
+			x = std::bit_cast<double>(std::bit_cast<int64_t>(x) & static_cast<int64_t>(0b0111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111));
 		}//End if
 		else
 		{
@@ -2525,11 +2565,11 @@ namespace tpa::bit_manip
 		}//End if
 		else if constexpr (std::is_same<T, float>())
 		{
-			x = *reinterpret_cast<float*>(*reinterpret_cast<int32_t*>(&x)) & static_cast<int32_t>(0b1111'1111'1111'1111'1111'1111'1111'1110);
+			x = std::bit_cast<float>(std::bit_cast<int32_t>(x) & static_cast<int32_t>(0b1111'1111'1111'1111'1111'1111'1111'1110));
 		}//End if
 		else if constexpr (std::is_same<T, double>())
 		{
-			x = *reinterpret_cast<double*>(*reinterpret_cast<int64_t*>(&x)) & static_cast<T>(0b1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1110);
+			x = std::bit_cast<double>(std::bit_cast<int64_t>(x) & static_cast<int64_t>(0b1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1110));
 		}//End if
 		else
 		{
@@ -2567,11 +2607,11 @@ namespace tpa::bit_manip
 		}//End if
 		else if constexpr (std::is_same<T, float>())
 		{
-			x = *reinterpret_cast<float*>(*reinterpret_cast<int32_t*>(&x)) | static_cast<T>(0b1000'0000'0000'0000'0000'0000'0000'0000);
+			x = std::bit_cast<float>(std::bit_cast<int32_t>(x) | static_cast<int32_t>(0b1000'0000'0000'0000'0000'0000'0000'0000));
 		}//End if
 		else if constexpr (std::is_same<T, double>())
 		{
-			x = *reinterpret_cast<double*>(*reinterpret_cast<int64_t*>(&x)) | static_cast<T>(0b1000'0000'0000'0000'0000'0000'0000'0000'0000'0000'0000'0000'0000'0000'0000'0000);
+			x = std::bit_cast<double>(std::bit_cast<int64_t>(x) | static_cast<int64_t>(0b1000'0000'0000'0000'0000'0000'0000'0000'0000'0000'0000'0000'0000'0000'0000'0000));
 		}//End if
 		else
 		{
@@ -2609,11 +2649,11 @@ namespace tpa::bit_manip
 		}//End if
 		else if constexpr (std::is_same<T, float>())
 		{
-			x = *reinterpret_cast<float*>(*reinterpret_cast<int32_t*>(&x)) | static_cast<T>(0b0000'0000'0000'0000'0000'0000'0000'0001);
+			x = std::bit_cast<float>(std::bit_cast<int32_t>(x) | static_cast<int32_t>(0b0000'0000'0000'0000'0000'0000'0000'0001));
 		}//End if
 		else if constexpr (std::is_same<T, double>())
 		{
-			x = *reinterpret_cast<double*>(*reinterpret_cast<int64_t*>(&x)) | static_cast<T>(0b0000'0000'0000'0000'0000'0000'0000'0000'0000'0000'0000'0000'0000'0000'0000'0001);
+			x = std::bit_cast<double>(std::bit_cast<int64_t>(x) | static_cast<int64_t>(0b0000'0000'0000'0000'0000'0000'0000'0000'0000'0000'0000'0000'0000'0000'0000'0001));
 		}//End if
 		else
 		{
@@ -3000,7 +3040,7 @@ namespace tpa::bit_manip
 				{
 					uint32_t temp = 0u;
 					std::memmove(&temp, &x, sizeof(T));
-					return static_cast<T>(_bextr_u32(temp, static_cast<uint32_t>(start), static_cast<uint32_t>(len)));
+					return static_cast<T>([&]() TPA_TARGET("bmi") { return _bextr_u32(temp, static_cast<uint32_t>(start), static_cast<uint32_t>(len)); }());
 				}//End if
 				else
 				{
@@ -3013,7 +3053,7 @@ namespace tpa::bit_manip
 			{
 				if (tpa::hasBMI1)
 				{
-					return static_cast<T>(_bextr_u32(x, static_cast<uint32_t>(start), static_cast<uint32_t>(len)));
+					return static_cast<T>([&]() TPA_TARGET("bmi") { return _bextr_u32(x, static_cast<uint32_t>(start), static_cast<uint32_t>(len)); }());
 				}//End if
 				else
 				{
@@ -3026,7 +3066,7 @@ namespace tpa::bit_manip
 			{
 				if (tpa::hasBMI1)
 				{
-					return static_cast<T>(_bextr_u64(x, static_cast<uint32_t>(start), static_cast<uint32_t>(len)));
+					return static_cast<T>([&]() TPA_TARGET("bmi") { return _bextr_u64(x, static_cast<uint32_t>(start), static_cast<uint32_t>(len)); }());
 				}//End if
 				else
 				{
@@ -3041,7 +3081,7 @@ namespace tpa::bit_manip
 
 				if (tpa::hasBMI1)
 				{
-					temp = static_cast<T>(_bextr_u32(temp, static_cast<uint32_t>(start), static_cast<uint32_t>(len)));
+					temp = static_cast<T>([&]() TPA_TARGET("bmi") { return _bextr_u32(temp, static_cast<uint32_t>(start), static_cast<uint32_t>(len)); }());
 					return *reinterpret_cast<float*>(&temp);
 				}//End if
 				else
@@ -3059,7 +3099,7 @@ namespace tpa::bit_manip
 
 				if (tpa::hasBMI1)
 				{
-					temp = static_cast<T>(_bextr_u64(temp, static_cast<uint32_t>(start), static_cast<uint32_t>(len)));
+					temp = static_cast<T>([&]() TPA_TARGET("bmi") { return _bextr_u64(temp, static_cast<uint32_t>(start), static_cast<uint32_t>(len)); }());
 					return *reinterpret_cast<double*>(&temp);
 				}//End if
 				else
@@ -3503,7 +3543,7 @@ namespace bit_manip
 					if constexpr (std::is_same<T, int16_t>() || std::is_same<T, uint16_t>())
 					{						
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512_ByteWord)
+						if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 						{
 							const uint32_t p = static_cast<uint32_t>(pos);
 
@@ -3548,13 +3588,20 @@ namespace bit_manip
 								}//End if
 								else if constexpr (INSTR == tpa::bit_mod::REVERSE)
 								{
-									size_t bits = sizeof(T) * CHAR_BIT;
-									while(bits > 0uz)
-									{										
-										_DESTi = _mm512_or_si512(_mm512_slli_epi16(_DESTi, 1u), _mm512_and_si512(_source, _one));
-										_source = _mm512_srli_epi16(_source, 1u);
-										bits -= 1uz;
-									}//End while
+									if (tpa::hasGFNI && tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("gfni,avx512bw")
+									{
+										_DESTi = tpa::simd::_mm512_reverse_bits_epi16(_source);
+									}();//End if
+									else
+									{
+										size_t bits = sizeof(T) * CHAR_BIT;
+										while(bits > 0uz)
+										{
+											_DESTi = _mm512_or_si512(_mm512_slli_epi16(_DESTi, 1u), _mm512_and_si512(_source, _one));
+											_source = _mm512_srli_epi16(_source, 1u);
+											bits -= 1uz;
+										}//End while
+									}//End else
 								}//End if
 								else if constexpr (INSTR == tpa::bit_mod::SET_TRAILING_ZEROS)
 								{
@@ -3682,8 +3729,8 @@ namespace bit_manip
 								//Store Result
 								_mm512_storeu_epi16(&source[i], _DESTi);
 							}//End for
-						}//End if hasAVX512
-						else if (tpa::hasAVX2)
+						}();//End if hasAVX512
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							const int32_t p = static_cast<int32_t>(pos);							
 
@@ -3699,7 +3746,7 @@ namespace bit_manip
 							for (; (i + 16uz) < end; i += 16uz)
 							{
 								//Set Values
-								_source = _mm256_load_si256((__m256i*) &source[i]);
+								_source = _mm256_loadu_si256((__m256i*) &source[i]);
 
 								if constexpr (INSTR == tpa::bit_mod::SET)
 								{
@@ -3863,9 +3910,9 @@ namespace bit_manip
 								}//End else
 
 								//Store Result
-								_mm256_store_si256((__m256i*)&source[i], _DESTi);
+								_mm256_storeu_si256((__m256i*)&source[i], _DESTi);
 							}//End for
-						}//End if hasAVX2
+						}();//End if hasAVX2
 						else if (tpa::has_SSE2)
 						{
 							const int32_t p = static_cast<int32_t>(pos);
@@ -3882,7 +3929,7 @@ namespace bit_manip
 							for (; (i + 8uz) < end; i += 8uz)
 							{
 								//Set Values
-								_source = _mm_load_si128((__m128i*) & source[i]);
+								_source = _mm_loadu_si128((__m128i*) & source[i]);
 
 								if constexpr (INSTR == tpa::bit_mod::SET)
 								{
@@ -4046,7 +4093,7 @@ namespace bit_manip
 								}//End else
 
 								//Store Result
-								_mm_store_si128((__m128i*) & source[i], _DESTi);
+								_mm_storeu_si128((__m128i*) & source[i], _DESTi);
 							}//End for
 						}//End if has SSE2
 #endif
@@ -4056,7 +4103,7 @@ namespace bit_manip
 					else if constexpr (std::is_same<T, int32_t>() || std::is_same<T, uint32_t>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							const uint32_t p = static_cast<uint32_t>(pos);
 
@@ -4072,7 +4119,7 @@ namespace bit_manip
 							for (; (i + 16uz) < end; i += 16uz)
 							{
 								//Set Values
-								_source = _mm512_load_epi32(&source[i]);
+								_source = _mm512_loadu_epi32(&source[i]);
 
 								if constexpr (INSTR == tpa::bit_mod::SET)
 								{
@@ -4101,13 +4148,20 @@ namespace bit_manip
 								}//End if
 								else if constexpr (INSTR == tpa::bit_mod::REVERSE)
 								{
-									size_t bits = sizeof(T) * CHAR_BIT;
-									while (bits > 0uz)
+									if (tpa::hasGFNI && tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("gfni,avx512f,avx512bw")
 									{
-										_DESTi = _mm512_or_si512(_mm512_slli_epi32(_DESTi, 1u), _mm512_and_si512(_source, _one));
-										_source = _mm512_srli_epi32(_source, 1u);
-										bits -= 1uz;
-									}//End while
+										_DESTi = tpa::simd::_mm512_reverse_bits_epi32(_source);
+									}();//End if
+									else
+									{
+										size_t bits = sizeof(T) * CHAR_BIT;
+										while (bits > 0uz)
+										{
+											_DESTi = _mm512_or_si512(_mm512_slli_epi32(_DESTi, 1u), _mm512_and_si512(_source, _one));
+											_source = _mm512_srli_epi32(_source, 1u);
+											bits -= 1uz;
+										}//End while
+									}//End else
 								}//End if
 								else if constexpr (INSTR == tpa::bit_mod::SET_TRAILING_ZEROS)
 								{
@@ -4233,10 +4287,10 @@ namespace bit_manip
 								}//End else
 
 								//Store Result
-								_mm512_store_epi32(&source[i], _DESTi);
+								_mm512_storeu_epi32(&source[i], _DESTi);
 							}//End for
-						}//End if hasAVX512
-						else if (tpa::hasAVX2)
+						}();//End if hasAVX512
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							const int32_t p = static_cast<int32_t>(pos);
 
@@ -4252,7 +4306,7 @@ namespace bit_manip
 							for (; (i + 8uz) < end; i += 8uz)
 							{
 								//Set Values
-								_source = _mm256_load_si256((__m256i*) & source[i]);
+								_source = _mm256_loadu_si256((__m256i*) & source[i]);
 
 								if constexpr (INSTR == tpa::bit_mod::SET)
 								{
@@ -4416,9 +4470,9 @@ namespace bit_manip
 								}//End else
 
 								//Store Result
-								_mm256_store_si256((__m256i*) & source[i], _DESTi);
+								_mm256_storeu_si256((__m256i*) & source[i], _DESTi);
 							}//End for
-						}//End if hasAVX2
+						}();//End if hasAVX2
 						else if (tpa::has_SSE2)
 						{
 							const int32_t p = static_cast<int32_t>(pos);
@@ -4435,7 +4489,7 @@ namespace bit_manip
 							for (; (i + 4uz) < end; i += 4uz)
 							{
 								//Set Values
-								_source = _mm_load_si128((__m128i*) & source[i]);
+								_source = _mm_loadu_si128((__m128i*) & source[i]);
 
 								if constexpr (INSTR == tpa::bit_mod::SET)
 								{
@@ -4598,7 +4652,7 @@ namespace bit_manip
 								}//End else
 
 								//Store Result
-								_mm_store_si128((__m128i*) & source[i], _DESTi);
+								_mm_storeu_si128((__m128i*) & source[i], _DESTi);
 							}//End for
 						}//End if has SSE2
 #endif
@@ -4608,7 +4662,7 @@ namespace bit_manip
 					else if constexpr (std::is_same<T, int64_t>() || std::is_same<T, uint64_t>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							const uint32_t p = static_cast<uint32_t>(pos);
 
@@ -4624,7 +4678,7 @@ namespace bit_manip
 							for (; (i + 8uz) < end; i += 8uz)
 							{
 								//Set Values
-								_source = _mm512_load_epi64(&source[i]);
+								_source = _mm512_loadu_epi64(&source[i]);
 
 								if constexpr (INSTR == tpa::bit_mod::SET)
 								{
@@ -4652,13 +4706,20 @@ namespace bit_manip
 								}//End if
 								else if constexpr (INSTR == tpa::bit_mod::REVERSE)
 								{
-									size_t bits = sizeof(T) * CHAR_BIT;
-									while (bits > 0uz)
+									if (tpa::hasGFNI && tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("gfni,avx512f,avx512bw")
 									{
-										_DESTi = _mm512_or_si512(_mm512_slli_epi64(_DESTi, 1u), _mm512_and_si512(_source, _one));
-										_source = _mm512_srli_epi64(_source, 1u);
-										bits -= 1uz;
-									}//End while
+										_DESTi = tpa::simd::_mm512_reverse_bits_epi64(_source);
+									}();//End if
+									else
+									{
+										size_t bits = sizeof(T) * CHAR_BIT;
+										while (bits > 0uz)
+										{
+											_DESTi = _mm512_or_si512(_mm512_slli_epi64(_DESTi, 1u), _mm512_and_si512(_source, _one));
+											_source = _mm512_srli_epi64(_source, 1u);
+											bits -= 1uz;
+										}//End while
+									}//End else
 								}//End if
 								else if constexpr (INSTR == tpa::bit_mod::SET_TRAILING_ZEROS)
 								{
@@ -4784,10 +4845,10 @@ namespace bit_manip
 								}//End else
 
 								//Store Result
-								_mm512_store_epi64(&source[i], _DESTi);
+								_mm512_storeu_epi64(&source[i], _DESTi);
 							}//End for
-						}//End if hasAVX512
-						else if (tpa::hasAVX2)
+						}();//End if hasAVX512
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							const int32_t p = static_cast<int32_t>(pos);
 
@@ -4803,7 +4864,7 @@ namespace bit_manip
 							for (; (i + 4uz) < end; i += 4uz)
 							{
 								//Set Values
-								_source = _mm256_load_si256((__m256i*) & source[i]);
+								_source = _mm256_loadu_si256((__m256i*) & source[i]);
 
 								if constexpr (INSTR == tpa::bit_mod::SET)
 								{
@@ -4966,10 +5027,10 @@ namespace bit_manip
 								}//End else
 
 								//Store Result
-								_mm256_store_si256((__m256i*) & source[i], _DESTi);
+								_mm256_storeu_si256((__m256i*) & source[i], _DESTi);
 							}//End for
-						}//End if hasAVX2
-						else if (tpa::has_SSE42)
+						}();//End if hasAVX2
+						else if (tpa::has_SSE42) [&]() TPA_TARGET("sse4.2")
 						{
 							const int32_t p = static_cast<int32_t>(pos);
 
@@ -4985,7 +5046,7 @@ namespace bit_manip
 							for (; (i + 2uz) < end; i += 2uz)
 							{
 								//Set Values
-								_source = _mm_load_si128((__m128i*) & source[i]);
+								_source = _mm_loadu_si128((__m128i*) & source[i]);
 
 								if constexpr (INSTR == tpa::bit_mod::SET)
 								{
@@ -5148,9 +5209,9 @@ namespace bit_manip
 								}//End else
 
 								//Store Result
-								_mm_store_si128((__m128i*) & source[i], _DESTi);
+								_mm_storeu_si128((__m128i*) & source[i], _DESTi);
 							}//End for
-						}//End if has SSE2
+						}();//End if has SSE2
 #endif
 					}//End if
 #pragma endregion
@@ -5158,12 +5219,12 @@ namespace bit_manip
 					else if constexpr (std::is_same<T, float>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							const uint32_t p = static_cast<uint32_t>(pos);
 
 							__m512i _source = _mm512_setzero_si512();
-							__m512 _sourcef = _mm512_setzero_si512();
+							__m512 _sourcef = _mm512_setzero_ps();
 							__m512i _DESTi = _mm512_setzero_si512();
 							__m512i _temp = _mm512_setzero_si512();
 							const __m512i _zero = _mm512_setzero_si512();
@@ -5175,7 +5236,7 @@ namespace bit_manip
 							for (; (i + 16uz) < end; i += 16uz)
 							{
 								//Set Values
-								_sourcef = _mm512_load_ps(&source[i]);
+								_sourcef = _mm512_loadu_ps(&source[i]);
 								_source = _mm512_castps_si512(_sourcef);
 
 								if constexpr (INSTR == tpa::bit_mod::SET)
@@ -5205,13 +5266,20 @@ namespace bit_manip
 								}//End if
 								else if constexpr (INSTR == tpa::bit_mod::REVERSE)
 								{
-									size_t bits = sizeof(T) * CHAR_BIT;
-									while (bits > 0uz)
+									if (tpa::hasGFNI && tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("gfni,avx512f,avx512bw")
 									{
-										_DESTi = _mm512_or_si512(_mm512_slli_epi32(_DESTi, 1u), _mm512_and_si512(_source, _one));
-										_source = _mm512_srli_epi32(_source, 1u);
-										bits -= 1uz;
-									}//End while
+										_DESTi = tpa::simd::_mm512_reverse_bits_epi32(_source);
+									}();//End if
+									else
+									{
+										size_t bits = sizeof(T) * CHAR_BIT;
+										while (bits > 0uz)
+										{
+											_DESTi = _mm512_or_si512(_mm512_slli_epi32(_DESTi, 1u), _mm512_and_si512(_source, _one));
+											_source = _mm512_srli_epi32(_source, 1u);
+											bits -= 1uz;
+										}//End while
+									}//End else
 								}//End if
 								else if constexpr (INSTR == tpa::bit_mod::SET_TRAILING_ZEROS)
 								{
@@ -5337,15 +5405,15 @@ namespace bit_manip
 								}//End else
 
 								//Store Result
-								_mm512_store_ps(&source[i], _mm512_castsi512_ps(_DESTi));
+								_mm512_storeu_ps(&source[i], _mm512_castsi512_ps(_DESTi));
 							}//End for
-						}//End if hasAVX512
-						else if (tpa::hasAVX2)
+						}();//End if hasAVX512
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							const int32_t p = static_cast<int32_t>(pos);
 
 							__m256i _source = _mm256_setzero_si256();
-							__m256 _sourcef = _mm256_setzero_si256();
+							__m256 _sourcef = _mm256_setzero_ps();
 							__m256i _DESTi = _mm256_setzero_si256();
 							__m256i _temp = _mm256_setzero_si256();
 							const __m256i _zero = _mm256_setzero_si256();
@@ -5357,7 +5425,7 @@ namespace bit_manip
 							for (; (i + 8uz) < end; i += 8uz)
 							{
 								//Set Values
-								_sourcef = _mm256_load_ps(&source[i]);
+								_sourcef = _mm256_loadu_ps(&source[i]);
 								_source = _mm256_castps_si256(_sourcef);
 
 								if constexpr (INSTR == tpa::bit_mod::SET)
@@ -5522,15 +5590,15 @@ namespace bit_manip
 								}//End else
 
 								//Store Result
-								_mm256_store_ps(&source[i], _mm256_castsi256_ps(_DESTi));
+								_mm256_storeu_ps(&source[i], _mm256_castsi256_ps(_DESTi));
 							}//End for
-						}//End if hasAVX2
+						}();//End if hasAVX2
 						else if (tpa::has_SSE2)
 						{
 							const int32_t p = static_cast<int32_t>(pos);
 
 							__m128i _source = _mm_setzero_si128();
-							__m128 _sourcef = _mm_setzero_si128();
+							__m128 _sourcef = _mm_setzero_ps();
 							__m128i _DESTi = _mm_setzero_si128();
 							__m128i _temp = _mm_setzero_si128();
 							const __m128i _zero = _mm_setzero_si128();
@@ -5542,7 +5610,7 @@ namespace bit_manip
 							for (; (i + 4uz) < end; i += 4uz)
 							{
 								//Set Values
-								_sourcef = _mm_load_ps(&source[i]);
+								_sourcef = _mm_loadu_ps(&source[i]);
 								_source = _mm_castps_si128(_sourcef);
 
 								if constexpr (INSTR == tpa::bit_mod::SET)
@@ -5706,7 +5774,7 @@ namespace bit_manip
 								}//End else
 
 								//Store Result
-								_mm_store_ps(&source[i], _mm_castsi128_ps(_DESTi));
+								_mm_storeu_ps(&source[i], _mm_castsi128_ps(_DESTi));
 							}//End for
 						}//End if has SSE2
 #endif
@@ -5716,12 +5784,12 @@ namespace bit_manip
 					else if constexpr (std::is_same<T, double>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							const uint32_t p = static_cast<uint32_t>(pos);
 
 							__m512i _source = _mm512_setzero_si512();
-							__m512 _sourcef = _mm512_setzero_si512();
+							__m512d _sourcef = _mm512_setzero_pd();
 							__m512i _DESTi = _mm512_setzero_si512();
 							__m512i _temp = _mm512_setzero_si512();
 							const __m512i _zero = _mm512_setzero_si512();
@@ -5733,7 +5801,7 @@ namespace bit_manip
 							for (; (i + 8uz) < end; i += 8uz)
 							{
 								//Set Values
-								_sourcef = _mm512_load_pd(&source[i]);
+								_sourcef = _mm512_loadu_pd(&source[i]);
 								_source = _mm512_castpd_si512(_sourcef);
 
 								if constexpr (INSTR == tpa::bit_mod::SET)
@@ -5762,13 +5830,20 @@ namespace bit_manip
 								}//End if
 								else if constexpr (INSTR == tpa::bit_mod::REVERSE)
 								{
-									size_t bits = sizeof(T) * CHAR_BIT;
-									while (bits > 0uz)
+									if (tpa::hasGFNI && tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("gfni,avx512f,avx512bw")
 									{
-										_DESTi = _mm512_or_si512(_mm512_slli_epi64(_DESTi, 1u), _mm512_and_si512(_source, _one));
-										_source = _mm512_srli_epi64(_source, 1u);
-										bits -= 1uz;
-									}//End while
+										_DESTi = tpa::simd::_mm512_reverse_bits_epi64(_source);
+									}();//End if
+									else
+									{
+										size_t bits = sizeof(T) * CHAR_BIT;
+										while (bits > 0uz)
+										{
+											_DESTi = _mm512_or_si512(_mm512_slli_epi64(_DESTi, 1u), _mm512_and_si512(_source, _one));
+											_source = _mm512_srli_epi64(_source, 1u);
+											bits -= 1uz;
+										}//End while
+									}//End else
 								}//End if
 								else if constexpr (INSTR == tpa::bit_mod::SET_TRAILING_ZEROS)
 								{
@@ -5894,15 +5969,15 @@ namespace bit_manip
 								}//End else
 
 								//Store Result
-								_mm512_store_pd(&source[i], _mm512_castsi512_pd(_DESTi));
+								_mm512_storeu_pd(&source[i], _mm512_castsi512_pd(_DESTi));
 							}//End for
-						}//End if hasAVX512
-						else if (tpa::hasAVX2)
+						}();//End if hasAVX512
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							const int32_t p = static_cast<int32_t>(pos);
 
 							__m256i _source = _mm256_setzero_si256();
-							__m256 _sourcef = _mm256_setzero_si256();
+							__m256d _sourcef = _mm256_setzero_pd();
 							__m256i _DESTi = _mm256_setzero_si256();
 							__m256i _temp = _mm256_setzero_si256();
 							const __m256i _zero = _mm256_setzero_si256();
@@ -5914,7 +5989,7 @@ namespace bit_manip
 							for (; (i + 4uz) < end; i += 4uz)
 							{
 								//Set Values
-								_sourcef = _mm256_load_pd(&source[i]);
+								_sourcef = _mm256_loadu_pd(&source[i]);
 								_source = _mm256_castpd_si256(_sourcef);
 
 								if constexpr (INSTR == tpa::bit_mod::SET)
@@ -6078,15 +6153,15 @@ namespace bit_manip
 								}//End else
 
 								//Store Result
-								_mm256_store_pd(&source[i], _mm256_castsi256_pd(_DESTi));
+								_mm256_storeu_pd(&source[i], _mm256_castsi256_pd(_DESTi));
 							}//End for
-						}//End if hasAVX2
-						else if (tpa::has_SSE42)
+						}();//End if hasAVX2
+						else if (tpa::has_SSE42) [&]() TPA_TARGET("sse4.2")
 						{
 							const int32_t p = static_cast<int32_t>(pos);
 
 							__m128i _source = _mm_setzero_si128();
-							__m128 _sourcef = _mm_setzero_si128();
+							__m128d _sourcef = _mm_setzero_pd();
 							__m128i _DESTi = _mm_setzero_si128();
 							__m128i _temp = _mm_setzero_si128();
 							const __m128i _zero = _mm_setzero_si128();
@@ -6098,7 +6173,7 @@ namespace bit_manip
 							for (; (i + 2uz) < end; i += 2uz)
 							{
 								//Set Values
-								_sourcef = _mm_load_pd(&source[i]);
+								_sourcef = _mm_loadu_pd(&source[i]);
 								_source = _mm_castpd_si128(_sourcef);
 
 								if constexpr (INSTR == tpa::bit_mod::SET)
@@ -6262,9 +6337,9 @@ namespace bit_manip
 								}//End else
 
 								//Store Result
-								_mm_store_pd(&source[i], _mm_castsi128_pd(_DESTi));
+								_mm_storeu_pd(&source[i], _mm_castsi128_pd(_DESTi));
 							}//End for
-						}//End if has SSE2
+						}();//End if has SSE2
 #endif
 					}//End if
 #pragma endregion
@@ -6418,7 +6493,247 @@ namespace bit_manip
 	}//End of bit_modify
 
 	/// <summary>
-	/// <para>Performs bitwise operations on 2 aligned containers storing the result in a 3rd aligned container.</para> 
+	/// <para>Counts bits in each element of 'source' according to the specified instruction, storing each count in 'dest'.</para>
+	/// <para>The destination container must be at least as large as 'source', its value type may differ from the source.</para>
+	/// <para>Integral containers use AVX-512 BITALG (8-bit &amp; 16-bit) and AVX-512 VPOPCNTDQ (32-bit &amp; 64-bit) for tpa::bit_count::POP_COUNT and tpa::bit_count::ZERO_COUNT and AVX-512 CD for tpa::bit_count::LEADING_ZERO_COUNT (32-bit &amp; 64-bit) when the destination has the same value type.</para>
+	/// <para>Templated predicate takes 1 of these predicates: tpa::bit_count</para>
+	/// <para>---------------------------------------------------</para>
+	/// <para>tpa::bit_count::POP_COUNT / tpa::bit_count::ONE_COUNT</para>
+	/// <para>tpa::bit_count::ZERO_COUNT</para>
+	/// <para>tpa::bit_count::LEADING_ZERO_COUNT</para>
+	/// <para>tpa::bit_count::TRAILING_ZERO_COUNT</para>
+	/// <para>tpa::bit_count::LEADING_ONE_COUNT</para>
+	/// <para>tpa::bit_count::TRAILING_ONE_COUNT</para>
+	/// <para>tpa::bit_count::BIT_ISLAND_COUNT</para>
+	/// <para>tpa::bit_count::BIT_SCAN_FORWARD</para>
+	/// <para>tpa::bit_count::BIT_SCAN_REVERSE</para>
+	/// </summary>
+	/// <typeparam name="CONTAINER_A"></typeparam>
+	/// <typeparam name="CONTAINER_B"></typeparam>
+	/// <param name="source"></param>
+	/// <param name="dest"></param>
+	template<tpa::bit_count INSTR, typename CONTAINER_A, typename CONTAINER_B>
+	inline constexpr void bit_count(const CONTAINER_A& source, CONTAINER_B& dest)
+		requires tpa::util::contiguous_seqeunce<CONTAINER_A>&&
+		tpa::util::contiguous_seqeunce<CONTAINER_B>
+	{
+		uint32_t complete = 0u;
+		using T = CONTAINER_A::value_type;
+		using R = CONTAINER_B::value_type;
+
+		try
+		{
+			if (dest.size() < source.size())
+			{
+				throw tpa::exceptions::ArrayTooSmall();
+			}//End if
+
+			std::vector<std::pair<size_t, size_t>> sections;
+			tpa::util::prepareThreading(sections, source.size());
+
+			std::vector<std::shared_future<uint32_t>> results;
+			results.reserve(tpa::nThreads);
+
+			std::shared_future<uint32_t> temp;
+
+			for (const auto& sec : sections)
+			{
+				//Launch lambda from multiple threads
+				temp = tpa::tp->addTask([&source, &dest, &sec]()
+				{
+					const size_t beg = sec.first;
+					const size_t end = sec.second;
+					size_t i = beg;
+
+#pragma region simd
+#ifdef TPA_X86_64
+					if constexpr (std::is_integral<T>() && std::is_same<T, R>() && 
+						(INSTR == tpa::bit_count::POP_COUNT || INSTR == tpa::bit_count::ZERO_COUNT))
+					{
+						if constexpr (sizeof(T) == 1uz)
+						{
+							if (tpa::hasAVX512_BITALG && tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw,avx512bitalg")
+							{
+								const __m512i _bits = _mm512_set1_epi8(static_cast<int8_t>(8));
+
+								for (; (i + 64uz) < end; i += 64uz)
+								{
+									__m512i _count = _mm512_popcnt_epi8(_mm512_loadu_si512(&source[i]));
+
+									if constexpr (INSTR == tpa::bit_count::ZERO_COUNT)
+									{
+										_count = _mm512_sub_epi8(_bits, _count);
+									}//End if
+
+									_mm512_storeu_si512(&dest[i], _count);
+								}//End for
+							}();//End if
+						}//End if
+						else if constexpr (sizeof(T) == 2uz)
+						{
+							if (tpa::hasAVX512_BITALG && tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw,avx512bitalg")
+							{
+								const __m512i _bits = _mm512_set1_epi16(static_cast<int16_t>(16));
+
+								for (; (i + 32uz) < end; i += 32uz)
+								{
+									__m512i _count = _mm512_popcnt_epi16(_mm512_loadu_si512(&source[i]));
+
+									if constexpr (INSTR == tpa::bit_count::ZERO_COUNT)
+									{
+										_count = _mm512_sub_epi16(_bits, _count);
+									}//End if
+
+									_mm512_storeu_si512(&dest[i], _count);
+								}//End for
+							}();//End if
+						}//End if
+						else if constexpr (sizeof(T) == 4uz)
+						{
+							if (tpa::hasAVX512_VPOPCNTDQ) [&]() TPA_TARGET("avx512vpopcntdq")
+							{
+								const __m512i _bits = _mm512_set1_epi32(32);
+
+								for (; (i + 16uz) < end; i += 16uz)
+								{
+									__m512i _count = _mm512_popcnt_epi32(_mm512_loadu_si512(&source[i]));
+
+									if constexpr (INSTR == tpa::bit_count::ZERO_COUNT)
+									{
+										_count = _mm512_sub_epi32(_bits, _count);
+									}//End if
+
+									_mm512_storeu_si512(&dest[i], _count);
+								}//End for
+							}();//End if
+						}//End if
+						else if constexpr (sizeof(T) == 8uz)
+						{
+							if (tpa::hasAVX512_VPOPCNTDQ) [&]() TPA_TARGET("avx512vpopcntdq")
+							{
+								const __m512i _bits = _mm512_set1_epi64(64ll);
+
+								for (; (i + 8uz) < end; i += 8uz)
+								{
+									__m512i _count = _mm512_popcnt_epi64(_mm512_loadu_si512(&source[i]));
+
+									if constexpr (INSTR == tpa::bit_count::ZERO_COUNT)
+									{
+										_count = _mm512_sub_epi64(_bits, _count);
+									}//End if
+
+									_mm512_storeu_si512(&dest[i], _count);
+								}//End for
+							}();//End if
+						}//End if
+					}//End if
+					else if constexpr (std::is_integral<T>() && std::is_same<T, R>() && INSTR == tpa::bit_count::LEADING_ZERO_COUNT)
+					{
+						if constexpr (sizeof(T) == 4uz)
+						{
+							if (tpa::hasAVX512_CD) [&]() TPA_TARGET("avx512cd")
+							{
+								for (; (i + 16uz) < end; i += 16uz)
+								{
+									_mm512_storeu_si512(&dest[i], _mm512_lzcnt_epi32(_mm512_loadu_si512(&source[i])));
+								}//End for
+							}();//End if
+						}//End if
+						else if constexpr (sizeof(T) == 8uz)
+						{
+							if (tpa::hasAVX512_CD) [&]() TPA_TARGET("avx512cd")
+							{
+								for (; (i + 8uz) < end; i += 8uz)
+								{
+									_mm512_storeu_si512(&dest[i], _mm512_lzcnt_epi64(_mm512_loadu_si512(&source[i])));
+								}//End for
+							}();//End if
+						}//End if
+					}//End if
+#endif
+#pragma endregion
+#pragma region generic
+					for (; i < end; ++i)
+					{
+						T x = source[i];
+
+						if constexpr (INSTR == tpa::bit_count::POP_COUNT)
+						{
+							dest[i] = static_cast<R>(tpa::bit_manip::pop_count(x));
+						}//End if
+						else if constexpr (INSTR == tpa::bit_count::ZERO_COUNT)
+						{
+							dest[i] = static_cast<R>(tpa::bit_manip::zero_count(x));
+						}//End if
+						else if constexpr (INSTR == tpa::bit_count::LEADING_ZERO_COUNT)
+						{
+							dest[i] = static_cast<R>(tpa::bit_manip::leading_zero_count(x));
+						}//End if
+						else if constexpr (INSTR == tpa::bit_count::TRAILING_ZERO_COUNT)
+						{
+							dest[i] = static_cast<R>(tpa::bit_manip::trailing_zero_count(x));
+						}//End if
+						else if constexpr (INSTR == tpa::bit_count::LEADING_ONE_COUNT)
+						{
+							dest[i] = static_cast<R>(tpa::bit_manip::leading_one_count(x));
+						}//End if
+						else if constexpr (INSTR == tpa::bit_count::TRAILING_ONE_COUNT)
+						{
+							dest[i] = static_cast<R>(tpa::bit_manip::trailing_one_count(x));
+						}//End if
+						else if constexpr (INSTR == tpa::bit_count::BIT_ISLAND_COUNT)
+						{
+							dest[i] = static_cast<R>(tpa::bit_manip::bit_island_count(x));
+						}//End if
+						else if constexpr (INSTR == tpa::bit_count::BIT_SCAN_FORWARD)
+						{
+							dest[i] = static_cast<R>(tpa::bit_manip::bit_scan_forward(x));
+						}//End if
+						else if constexpr (INSTR == tpa::bit_count::BIT_SCAN_REVERSE)
+						{
+							dest[i] = static_cast<R>(tpa::bit_manip::bit_scan_reverse(x));
+						}//End if
+						else
+						{
+							[] <bool flag = false>()
+							{
+								static_assert(flag, " You have specifed an invalid SIMD instruction in tpa::simd::bit_manip::bit_count<__UNDEFINED_PREDICATE__>(CONTAINER<T>).");
+							}();
+						}//End else
+					}//End for
+#pragma endregion
+
+					return static_cast<uint32_t>(1);
+				});//End of lambda
+
+				results.emplace_back(std::move(temp));
+			}//End for
+
+			for (const auto& fut : results)
+			{
+				complete += fut.get();
+			}//End for
+
+			//Check all threads completed
+			if (complete != nThreads)
+			{
+				throw tpa::exceptions::NotAllThreadsCompleted(complete);
+			}//End if
+		}//End of try
+		catch (const std::exception& ex)
+		{
+			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+			std::cerr << "Exception thrown in tpa::bit_manip::bit_count: " << ex.what() << "\n";
+		}//End catch
+		catch (...)
+		{
+			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+			std::cerr << "Exception thrown in tpa::bit_manip::bit_count: unknown!\n";
+		}//End catch
+	}//End of bit_count
+
+	/// <summary>
+	/// <para>Performs bitwise operations on 2 containers storing the result in a 3rd container.</para> 
 	/// <para> Containers of different types are allowed but not recomended.</para>
 	/// <para> Containers of different value types are NOT allowed</para>
 	/// <para> Containers do not have to be a particular size</para>
@@ -6450,8 +6765,8 @@ namespace bit_manip
 		try
 		{
 			static_assert(
-				std::is_same<CONTAINER_A::value_type, CONTAINER_B::value_type>() &&
-				std::is_same<CONTAINER_A::value_type, CONTAINER_C::value_type>(),
+				std::is_same<typename CONTAINER_A::value_type, typename CONTAINER_B::value_type>() &&
+				std::is_same<typename CONTAINER_A::value_type, typename CONTAINER_C::value_type>(),
 				"Compile Error! The source and destination containers must be of the same value type!");
 
 			using T = CONTAINER_A::value_type;
@@ -6461,9 +6776,11 @@ namespace bit_manip
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::bitwise: " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::bitwise will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
@@ -6485,7 +6802,7 @@ namespace bit_manip
 						if constexpr (std::is_same<T, int8_t>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512_ByteWord)
+							if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 							{
 								__m512i _Ai, _Bi, _DESTi;
 
@@ -6523,16 +6840,16 @@ namespace bit_manip
 									//Store Result
 									_mm512_storeu_epi8((__m512i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX2)
+							}();//End if hasAVX512
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
 								__m256i _Ai, _Bi, _DESTi;
 
 								for (; (i+32) < end; i += 32)
 								{
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
-									_Bi = _mm256_load_si256((__m256i*) & source2[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
+									_Bi = _mm256_loadu_si256((__m256i*) & source2[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -6560,9 +6877,9 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX2
+							}();//End if hasAVX2
 							else if (tpa::has_SSE2)
 							{
 								__m128i _Ai, _Bi, _DESTi;
@@ -6570,8 +6887,8 @@ namespace bit_manip
 								for (; (i+16) < end; i += 16)
 								{
 									//Set Values
-									_Ai = _mm_load_si128((__m128i*) &source1[i]);
-									_Bi = _mm_load_si128((__m128i*) &source2[i]);
+									_Ai = _mm_loadu_si128((__m128i*) &source1[i]);
+									_Bi = _mm_loadu_si128((__m128i*) &source2[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -6599,7 +6916,7 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm_store_si128((__m256i*) & dest[i], _DESTi);
+									_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
 								}//End for
 							}//End if has_SSE2
 #endif
@@ -6610,7 +6927,7 @@ namespace bit_manip
 						else if constexpr (std::is_same<T, uint8_t>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512_ByteWord)
+							if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 							{
 								__m512i _Ai, _Bi, _DESTi;
 
@@ -6648,16 +6965,16 @@ namespace bit_manip
 									//Store Result
 									_mm512_storeu_epi8((__m512i*) & dest[i], _DESTi);
 								}//End for
-							}//End if has AVX512
-							else if (tpa::hasAVX2)
+							}();//End if has AVX512
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
 								__m256i _Ai, _Bi, _DESTi;
 
 								for (; (i+32) < end; i += 32)
 								{
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
-									_Bi = _mm256_load_si256((__m256i*) & source2[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
+									_Bi = _mm256_loadu_si256((__m256i*) & source2[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -6685,9 +7002,9 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if has AVX2
+							}();//End if has AVX2
 							else if (tpa::has_SSE2)
 							{
 								__m128i _Ai, _Bi, _DESTi;
@@ -6695,8 +7012,8 @@ namespace bit_manip
 								for (; (i + 16) < end; i += 16)
 								{
 									//Set Values
-									_Ai = _mm_load_si128((__m128i*) & source1[i]);
-									_Bi = _mm_load_si128((__m128i*) & source2[i]);
+									_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
+									_Bi = _mm_loadu_si128((__m128i*) & source2[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -6724,7 +7041,7 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm_store_si128((__m256i*) & dest[i], _DESTi);
+									_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
 								}//End for
 							}//End if has_SSE2
 #endif				
@@ -6734,7 +7051,7 @@ namespace bit_manip
 						else if constexpr (std::is_same<T, int16_t>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512_ByteWord)
+							if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 							{
 								__m512i _Ai, _Bi, _DESTi;
 
@@ -6772,16 +7089,16 @@ namespace bit_manip
 									//Store Result
 									_mm512_storeu_epi16(&dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX2)
+							}();//End if hasAVX512
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
 								__m256i _Ai, _Bi, _DESTi;
 
 								for (; (i+16) < end; i += 16)
 								{
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
-									_Bi = _mm256_load_si256((__m256i*) & source2[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
+									_Bi = _mm256_loadu_si256((__m256i*) & source2[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::bit::AND)
@@ -6809,9 +7126,9 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX2
+							}();//End if hasAVX2
 							else if (tpa::has_SSE2)
 							{
 								__m128i _Ai, _Bi, _DESTi;
@@ -6819,8 +7136,8 @@ namespace bit_manip
 								for (; (i + 8) < end; i += 8)
 								{
 									//Set Values
-									_Ai = _mm_load_si128((__m128i*) & source1[i]);
-									_Bi = _mm_load_si128((__m128i*) & source2[i]);
+									_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
+									_Bi = _mm_loadu_si128((__m128i*) & source2[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -6848,7 +7165,7 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm_store_si128((__m256i*) & dest[i], _DESTi);
+									_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
 								}//End for
 							}//End if has_SSE2
 #endif							
@@ -6858,7 +7175,7 @@ namespace bit_manip
 						else if constexpr (std::is_same<T, uint16_t>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512_ByteWord)
+							if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 							{
 								__m512i _Ai, _Bi, _DESTi;
 
@@ -6879,7 +7196,7 @@ namespace bit_manip
 									}//End if
 									else if constexpr (INSTR == tpa::bit::XOR)
 									{
-										_DESTi = _mm256_xor_si256(_Ai, _Bi);
+										_DESTi = _mm512_xor_si512(_Ai, _Bi);
 									}//End if
 									else if constexpr (INSTR == tpa::bit::AND_NOT)
 									{
@@ -6896,16 +7213,16 @@ namespace bit_manip
 									//Store Result
 									_mm512_storeu_epi16((__m512i*)&dest[i], _DESTi);
 								}//End for
-							}//End if
-							else if (tpa::hasAVX2)
+							}();//End if
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
 								__m256i _Ai, _Bi, _DESTi;
 
 								for (; (i+16) < end; i += 16)
 								{
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
-									_Bi = _mm256_load_si256((__m256i*) & source2[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
+									_Bi = _mm256_loadu_si256((__m256i*) & source2[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -6933,9 +7250,9 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX2
+							}();//End if hasAVX2
 							else if (tpa::has_SSE2)
 							{
 								__m128i _Ai, _Bi, _DESTi;
@@ -6943,8 +7260,8 @@ namespace bit_manip
 								for (; (i + 8) < end; i += 8)
 								{
 									//Set Values
-									_Ai = _mm_load_si128((__m128i*) & source1[i]);
-									_Bi = _mm_load_si128((__m128i*) & source2[i]);
+									_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
+									_Bi = _mm_loadu_si128((__m128i*) & source2[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -6972,7 +7289,7 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm_store_si128((__m256i*) & dest[i], _DESTi);
+									_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
 								}//End for
 							}//End if has_SSE2
 #endif 							
@@ -6982,15 +7299,15 @@ namespace bit_manip
 						else if constexpr (std::is_same<T, int32_t>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512)
+							if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 							{
 								__m512i _Ai, _Bi, _DESTi;
 
 								for (; (i+16) < end; i += 16)
 								{
 									//Set Values
-									_Ai = _mm512_load_epi32((__m512i*)&source1[i]);
-									_Bi = _mm512_load_epi32((__m512i*)&source2[i]);
+									_Ai = _mm512_loadu_epi32((__m512i*)&source1[i]);
+									_Bi = _mm512_loadu_epi32((__m512i*)&source2[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -7018,18 +7335,18 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _DESTi);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX2)
+							}();//End if hasAVX512
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
 								__m256i _Ai, _Bi, _DESTi;
 
 								for (; (i+8) < end; i += 8)
 								{
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
-									_Bi = _mm256_load_si256((__m256i*) & source2[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
+									_Bi = _mm256_loadu_si256((__m256i*) & source2[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -7057,9 +7374,9 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX2
+							}();//End if hasAVX2
 							else if (tpa::has_SSE2)
 							{
 								__m128i _Ai, _Bi, _DESTi;
@@ -7067,8 +7384,8 @@ namespace bit_manip
 								for (; (i + 4) < end; i += 4)
 								{
 									//Set Values
-									_Ai = _mm_load_si128((__m128i*) & source1[i]);
-									_Bi = _mm_load_si128((__m128i*) & source2[i]);
+									_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
+									_Bi = _mm_loadu_si128((__m128i*) & source2[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -7096,7 +7413,7 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm_store_si128((__m256i*) & dest[i], _DESTi);
+									_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
 								}//End for
 							}//End if has_SSE2
 #endif							
@@ -7106,15 +7423,15 @@ namespace bit_manip
 						else if constexpr (std::is_same<T, uint32_t>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512)
+							if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 							{
 								__m512i _Ai, _Bi, _DESTi;
 
 								for (; (i+16) < end; i += 16)
 								{
 									//Set Values
-									_Ai = _mm512_load_epi32((__m512i*)&source1[i]);
-									_Bi = _mm512_load_epi32((__m512i*)&source2[i]);
+									_Ai = _mm512_loadu_epi32((__m512i*)&source1[i]);
+									_Bi = _mm512_loadu_epi32((__m512i*)&source2[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -7142,18 +7459,18 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _DESTi);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _DESTi);
 								}//End for
-							}//End if
-							else if (tpa::hasAVX2)
+							}();//End if
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
 								__m256i _Ai, _Bi, _DESTi;
 
 								for (; (i+8) < end; i += 8)
 								{
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
-									_Bi = _mm256_load_si256((__m256i*) & source2[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
+									_Bi = _mm256_loadu_si256((__m256i*) & source2[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::bit::AND)
@@ -7181,9 +7498,9 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX2
+							}();//End if hasAVX2
 							else if (tpa::has_SSE2)
 							{
 								__m128i _Ai, _Bi, _DESTi;
@@ -7191,8 +7508,8 @@ namespace bit_manip
 								for (; (i + 4) < end; i += 4)
 								{
 									//Set Values
-									_Ai = _mm_load_si128((__m128i*) & source1[i]);
-									_Bi = _mm_load_si128((__m128i*) & source2[i]);
+									_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
+									_Bi = _mm_loadu_si128((__m128i*) & source2[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -7220,7 +7537,7 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm_store_si128((__m256i*) & dest[i], _DESTi);
+									_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
 								}//End for
 							}//End if has_SSE2
 #endif							
@@ -7230,15 +7547,15 @@ namespace bit_manip
 						else if constexpr (std::is_same<T, int64_t>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512)
+							if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 							{
 								__m512i _Ai, _Bi, _DESTi;
 
 								for (; (i+8) < end; i += 8)
 								{
 									//Set Values
-									_Ai = _mm512_load_epi64((__m512i*)&source1[i]);
-									_Bi = _mm512_load_epi64((__m512i*)&source2[i]);
+									_Ai = _mm512_loadu_epi64((__m512i*)&source1[i]);
+									_Bi = _mm512_loadu_epi64((__m512i*)&source2[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::bit::AND)
@@ -7266,18 +7583,18 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm512_store_epi64((__m256i*) & dest[i], _DESTi);
+									_mm512_storeu_epi64((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX2)
+							}();//End if hasAVX512
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
 								__m256i _Ai, _Bi, _DESTi;
 
 								for (; (i+4) < end; i += 4)
 								{
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
-									_Bi = _mm256_load_si256((__m256i*) & source2[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
+									_Bi = _mm256_loadu_si256((__m256i*) & source2[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::bit::AND)
@@ -7305,9 +7622,9 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX2
+							}();//End if hasAVX2
 							else if (tpa::has_SSE2)
 							{
 								__m128i _Ai, _Bi, _DESTi;
@@ -7315,8 +7632,8 @@ namespace bit_manip
 								for (; (i + 2) < end; i += 2)
 								{
 									//Set Values
-									_Ai = _mm_load_si128((__m128i*) & source1[i]);
-									_Bi = _mm_load_si128((__m128i*) & source2[i]);
+									_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
+									_Bi = _mm_loadu_si128((__m128i*) & source2[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -7344,7 +7661,7 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm_store_si128((__m256i*) & dest[i], _DESTi);
+									_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
 								}//End for
 							}//End if has_SSE2
 #endif							
@@ -7354,15 +7671,15 @@ namespace bit_manip
 						else if constexpr (std::is_same<T, uint64_t>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512)
+							if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 							{
 								__m512i _Ai, _Bi, _DESTi;
 
 								for (; (i+8) < end; i += 8)
 								{
 									//Set Values
-									_Ai = _mm512_load_epi64((__m512i*)&source1[i]);
-									_Bi = _mm512_load_epi64((__m512i*)&source2[i]);
+									_Ai = _mm512_loadu_epi64((__m512i*)&source1[i]);
+									_Bi = _mm512_loadu_epi64((__m512i*)&source2[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::bit::AND)
@@ -7390,18 +7707,18 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm512_store_epi64((__m256i*) & dest[i], _DESTi);
+									_mm512_storeu_epi64((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX2)
+							}();//End if hasAVX512
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
 								__m256i _Ai, _Bi, _DESTi;
 
 								for (; (i+4) < end; i += 4)
 								{			
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
-									_Bi = _mm256_load_si256((__m256i*) & source2[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
+									_Bi = _mm256_loadu_si256((__m256i*) & source2[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::bit::AND)
@@ -7429,9 +7746,9 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX2
+							}();//End if hasAVX2
 							else if (tpa::has_SSE2)
 							{
 								__m128i _Ai, _Bi, _DESTi;
@@ -7439,8 +7756,8 @@ namespace bit_manip
 								for (; (i + 2) < end; i += 2)
 								{
 									//Set Values
-									_Ai = _mm_load_si128((__m128i*) & source1[i]);
-									_Bi = _mm_load_si128((__m128i*) & source2[i]);
+									_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
+									_Bi = _mm_loadu_si128((__m128i*) & source2[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -7468,7 +7785,7 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm_store_si128((__m256i*) & dest[i], _DESTi);
+									_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
 								}//End for
 							}//End if has_SSE2
 #endif							
@@ -7478,15 +7795,15 @@ namespace bit_manip
 						else if constexpr (std::is_same<T, float>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512_DWQW)
+							if (tpa::hasAVX512_DWQW) [&]() TPA_TARGET("avx512dq")
 							{
 								__m512 _Ai, _Bi, _DESTi;
 
 								for (; (i+16) < end; i += 16)
 								{
 									//Set Values
-									_Ai = _mm512_load_ps(&source1[i]);
-									_Bi = _mm512_load_ps(&source2[i]);
+									_Ai = _mm512_loadu_ps(&source1[i]);
+									_Bi = _mm512_loadu_ps(&source2[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::bit::AND)
@@ -7514,18 +7831,18 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm512_store_ps(&dest[i], _DESTi);
+									_mm512_storeu_ps(&dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX)
+							}();//End if hasAVX512
+							else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
 							{
 								__m256 _Ai, _Bi, _DESTi;
 
 								for (; (i+8) < end; i += 8)
 								{
 									//Set Values
-									_Ai = _mm256_load_ps(&source1[i]);
-									_Bi = _mm256_load_ps(&source2[i]);
+									_Ai = _mm256_loadu_ps(&source1[i]);
+									_Bi = _mm256_loadu_ps(&source2[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::bit::AND)
@@ -7553,9 +7870,9 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm256_store_ps(&dest[i], _DESTi);
+									_mm256_storeu_ps(&dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX
+							}();//End if hasAVX
 							else if (tpa::has_SSE)
 							{
 								__m128 _Ai, _Bi, _DESTi;
@@ -7563,8 +7880,8 @@ namespace bit_manip
 								for (; (i+4) < end; i += 4)
 								{
 									//Set Values
-									_Ai = _mm_load_ps(&source1[i]);
-									_Bi = _mm_load_ps(&source2[i]);
+									_Ai = _mm_loadu_ps(&source1[i]);
+									_Bi = _mm_loadu_ps(&source2[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -7592,7 +7909,7 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm_store_ps(&dest[i], _DESTi);
+									_mm_storeu_ps(&dest[i], _DESTi);
 								}//End for
 							}//End if has_SSE
 #endif						
@@ -7602,15 +7919,15 @@ namespace bit_manip
 						else if constexpr (std::is_same<T, double>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512_DWQW)
+							if (tpa::hasAVX512_DWQW) [&]() TPA_TARGET("avx512dq")
 							{
 								__m512d _Ai, _Bi, _DESTi;
 
 								for (; (i+8) < end; i += 8)
 								{
 									//Set Values
-									_Ai = _mm512_load_pd(&source1[i]);
-									_Bi = _mm512_load_pd(&source2[i]);
+									_Ai = _mm512_loadu_pd(&source1[i]);
+									_Bi = _mm512_loadu_pd(&source2[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::bit::AND)
@@ -7638,18 +7955,18 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm512_store_pd(&dest[i], _DESTi);
+									_mm512_storeu_pd(&dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX)
+							}();//End if hasAVX512
+							else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
 							{
 								__m256d _Ai, _Bi, _DESTi;
 
 								for (; (i+4) < end; i += 4)
 								{
 									//Set Values
-									_Ai = _mm256_load_pd(&source1[i]);
-									_Bi = _mm256_load_pd(&source2[i]);
+									_Ai = _mm256_loadu_pd(&source1[i]);
+									_Bi = _mm256_loadu_pd(&source2[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::bit::AND)
@@ -7677,9 +7994,9 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm256_store_pd(&dest[i], _DESTi);
+									_mm256_storeu_pd(&dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX
+							}();//End if hasAVX
 							else if (tpa::has_SSE2)
 							{
 								__m128d _Ai, _Bi, _DESTi;
@@ -7687,8 +8004,8 @@ namespace bit_manip
 								for (; (i + 2) < end; i += 2)
 								{
 									//Set Values
-									_Ai = _mm_load_pd(&source1[i]);
-									_Bi = _mm_load_pd(&source2[i]);
+									_Ai = _mm_loadu_pd(&source1[i]);
+									_Bi = _mm_loadu_pd(&source2[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -7716,7 +8033,7 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm_store_pd(&dest[i], _DESTi);
+									_mm_storeu_pd(&dest[i], _DESTi);
 								}//End for
 							}//End if has_SSE2
 #endif						
@@ -7797,14 +8114,6 @@ namespace bit_manip
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::bitwise: " << ex.what() << "\n";
-			std::cerr << "tpa::simd::bitwise will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -7829,7 +8138,7 @@ namespace bit_manip
 	}//End of bitwise()
 
 	/// <summary>
-	/// <para>Performs bitwise operations on 1 aligned container and a constant value storing the result in a 2nd aligned container.</para> 
+	/// <para>Performs bitwise operations on 1 container and a constant value storing the result in a 2nd container.</para> 
 	/// <para> Containers of different types are allowed but not recomended.</para>
 	/// <para> Containers of different value types are NOT allowed</para>
 	/// <para> Containers do not have to be a particular size</para>
@@ -7860,8 +8169,8 @@ namespace bit_manip
 		try
 		{
 			static_assert(
-				std::is_same<CONTAINER_A::value_type, T>() &&
-				std::is_same<CONTAINER_A::value_type, CONTAINER_C::value_type>(),
+				std::is_same<typename CONTAINER_A::value_type, T>() &&
+				std::is_same<typename CONTAINER_A::value_type, typename CONTAINER_C::value_type>(),
 				"Compile Error! The source, destination containers and value must be of the same value type!");
 
 			//Determin the smallest container
@@ -7869,9 +8178,11 @@ namespace bit_manip
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::bitwise_const: " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::bitwise_const will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
@@ -7893,7 +8204,7 @@ namespace bit_manip
 						if constexpr (std::is_same<T, int8_t>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512_ByteWord)
+							if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 							{
 								__m512i _Ai, _DESTi;
 								const __m512i _Bi = _mm512_set1_epi8(val);
@@ -7931,8 +8242,8 @@ namespace bit_manip
 									//Store Result
 									_mm512_storeu_epi8((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX2)
+							}();//End if hasAVX512
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
 								__m256i _Ai, _DESTi;
 								const __m256i _Bi = _mm256_set1_epi8(val);
@@ -7940,7 +8251,7 @@ namespace bit_manip
 								for (; (i+32) < end; i += 32)
 								{
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -7968,9 +8279,9 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX2
+							}();//End if hasAVX2
 							else if (tpa::has_SSE2)
 							{
 								__m128i _Ai, _DESTi;
@@ -7979,7 +8290,7 @@ namespace bit_manip
 								for (; (i+16) < end; i += 16)
 								{
 									//Set Values
-									_Ai = _mm_load_si128((__m128i*) &source1[i]);
+									_Ai = _mm_loadu_si128((__m128i*) &source1[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -8007,7 +8318,7 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm_store_si128((__m128i*) & dest[i], _DESTi);
+									_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
 								}//End for
 							}//End if has_SSE2
 #endif
@@ -8018,7 +8329,7 @@ namespace bit_manip
 						else if constexpr (std::is_same<T, uint8_t>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512_ByteWord)
+							if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 							{
 								__m512i _Ai, _DESTi;
 								const __m512i _Bi = _mm512_set1_epi8(val);
@@ -8056,8 +8367,8 @@ namespace bit_manip
 									//Store Result
 									_mm512_storeu_epi8((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if has AVX512
-							else if (tpa::hasAVX2)
+							}();//End if has AVX512
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
 								__m256i _Ai, _DESTi;
 								const __m256i _Bi = _mm256_set1_epi8(val);
@@ -8065,7 +8376,7 @@ namespace bit_manip
 								for (; (i+32) < end; i += 32)
 								{
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -8093,9 +8404,9 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if has AVX2
+							}();//End if has AVX2
 							else if (tpa::has_SSE2)
 							{
 								__m128i _Ai, _DESTi;
@@ -8104,7 +8415,7 @@ namespace bit_manip
 								for (; (i + 16) < end; i += 16)
 								{
 									//Set Values
-									_Ai = _mm_load_si128((__m128i*) & source1[i]);
+									_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -8132,7 +8443,7 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm_store_si128((__m128i*) & dest[i], _DESTi);
+									_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
 								}//End for
 							}//End if has_SSE2
 #endif				
@@ -8142,7 +8453,7 @@ namespace bit_manip
 						else if constexpr (std::is_same<T, int16_t>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512_ByteWord)
+							if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 							{
 								__m512i _Ai, _DESTi;
 								const __m512i _Bi = _mm512_set1_epi16(val);
@@ -8180,8 +8491,8 @@ namespace bit_manip
 									//Store Result
 									_mm512_storeu_epi16((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX2)
+							}();//End if hasAVX512
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
 								__m256i _Ai, _DESTi;
 								const __m256i _Bi = _mm256_set1_epi16(val);
@@ -8189,7 +8500,7 @@ namespace bit_manip
 								for (; (i+16) < end; i += 16)
 								{
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::bit::AND)
@@ -8217,9 +8528,9 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX2
+							}();//End if hasAVX2
 							else if (tpa::has_SSE2)
 							{
 								__m128i _Ai, _DESTi;
@@ -8228,7 +8539,7 @@ namespace bit_manip
 								for (; (i + 8) < end; i += 8)
 								{
 									//Set Values
-									_Ai = _mm_load_si128((__m128i*) & source1[i]);
+									_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -8256,7 +8567,7 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm_store_si128((__m128i*) & dest[i], _DESTi);
+									_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
 								}//End for
 							}//End if has_SSE2
 #endif							
@@ -8266,7 +8577,7 @@ namespace bit_manip
 						else if constexpr (std::is_same<T, uint16_t>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512_ByteWord)
+							if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 							{
 								__m512i _Ai, _DESTi;
 								const __m512i _Bi = _mm512_set1_epi16(val);
@@ -8287,7 +8598,7 @@ namespace bit_manip
 									}//End if
 									else if constexpr (INSTR == tpa::bit::XOR)
 									{
-										_DESTi = _mm256_xor_si256(_Ai, _Bi);
+										_DESTi = _mm512_xor_si512(_Ai, _Bi);
 									}//End if
 									else if constexpr (INSTR == tpa::bit::AND_NOT)
 									{
@@ -8304,8 +8615,8 @@ namespace bit_manip
 									//Store Result
 									_mm512_storeu_epi16((__m512i*)&dest[i], _DESTi);
 								}//End for
-							}//End if
-							else if (tpa::hasAVX2)
+							}();//End if
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
 								__m256i _Ai, _DESTi;
 								const __m256i _Bi = _mm256_set1_epi16(val);
@@ -8313,7 +8624,7 @@ namespace bit_manip
 								for (; (i+16) < end; i += 16)
 								{
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -8341,9 +8652,9 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX2
+							}();//End if hasAVX2
 							else if (tpa::has_SSE2)
 							{
 								__m128i _Ai, _DESTi;
@@ -8352,7 +8663,7 @@ namespace bit_manip
 								for (; (i + 8) < end; i += 8)
 								{
 									//Set Values
-									_Ai = _mm_load_si128((__m128i*) & source1[i]);
+									_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -8380,7 +8691,7 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm_store_si128((__m128i*) & dest[i], _DESTi);
+									_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
 								}//End for
 							}//End if has_SSE2
 #endif 							
@@ -8390,7 +8701,7 @@ namespace bit_manip
 						else if constexpr (std::is_same<T, int32_t>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512)
+							if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 							{
 								__m512i _Ai, _DESTi;
 								const __m512i _Bi = _mm512_set1_epi32(val);
@@ -8398,7 +8709,7 @@ namespace bit_manip
 								for (; (i+16) < end; i += 16)
 								{
 									//Set Values
-									_Ai = _mm512_load_epi32((__m512i*)&source1[i]);
+									_Ai = _mm512_loadu_epi32((__m512i*)&source1[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -8426,10 +8737,10 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _DESTi);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX2)
+							}();//End if hasAVX512
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
 								__m256i _Ai, _DESTi;
 								const __m256i _Bi = _mm256_set1_epi32(val);
@@ -8437,7 +8748,7 @@ namespace bit_manip
 								for (; (i+8) < end; i += 8)
 								{
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -8465,9 +8776,9 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX2
+							}();//End if hasAVX2
 							else if (tpa::has_SSE2)
 							{
 								__m128i _Ai, _DESTi;
@@ -8476,7 +8787,7 @@ namespace bit_manip
 								for (; (i + 4) < end; i += 4)
 								{
 									//Set Values
-									_Ai = _mm_load_si128((__m128i*) & source1[i]);
+									_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -8504,7 +8815,7 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm_store_si128((__m128i*) & dest[i], _DESTi);
+									_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
 								}//End for
 							}//End if has_SSE2
 #endif							
@@ -8514,7 +8825,7 @@ namespace bit_manip
 						else if constexpr (std::is_same<T, uint32_t>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512)
+							if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 							{
 								__m512i _Ai, _DESTi;
 								const __m512i _Bi = _mm512_set1_epi32(val);
@@ -8522,7 +8833,7 @@ namespace bit_manip
 								for (; (i+16) < end; i += 16)
 								{
 									//Set Values
-									_Ai = _mm512_load_epi32((__m512i*)&source1[i]);
+									_Ai = _mm512_loadu_epi32((__m512i*)&source1[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -8550,10 +8861,10 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _DESTi);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _DESTi);
 								}//End for
-							}//End if
-							else if (tpa::hasAVX2)
+							}();//End if
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
 								__m256i _Ai, _DESTi;
 								const __m256i _Bi = _mm256_set1_epi32(val);
@@ -8561,7 +8872,7 @@ namespace bit_manip
 								for (; (i+8) < end; i += 8)
 								{
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::bit::AND)
@@ -8589,9 +8900,9 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX2
+							}();//End if hasAVX2
 							else if (tpa::has_SSE2)
 							{
 								__m128i _Ai, _DESTi;
@@ -8600,7 +8911,7 @@ namespace bit_manip
 								for (; (i + 4) < end; i += 4)
 								{
 									//Set Values
-									_Ai = _mm_load_si128((__m128i*) & source1[i]);
+									_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -8628,7 +8939,7 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm_store_si128((__m128i*) & dest[i], _DESTi);
+									_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
 								}//End for
 							}//End if has_SSE2
 #endif							
@@ -8638,7 +8949,7 @@ namespace bit_manip
 						else if constexpr (std::is_same<T, int64_t>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512)
+							if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 							{
 								__m512i _Ai, _DESTi;
 								const __m512i _Bi = _mm512_set1_epi64(val);
@@ -8646,7 +8957,7 @@ namespace bit_manip
 								for (; (i+8) < end; i += 8)
 								{
 									//Set Values
-									_Ai = _mm512_load_epi64((__m512i*)&source1[i]);
+									_Ai = _mm512_loadu_epi64((__m512i*)&source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::bit::AND)
@@ -8674,10 +8985,10 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm512_store_epi64((__m256i*) & dest[i], _DESTi);
+									_mm512_storeu_epi64((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX2)
+							}();//End if hasAVX512
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
 								__m256i _Ai, _DESTi;
 								const __m256i _Bi = _mm256_set1_epi64x(val);
@@ -8685,7 +8996,7 @@ namespace bit_manip
 								for (; (i+4) < end; i += 4)
 								{
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::bit::AND)
@@ -8713,9 +9024,9 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX2
+							}();//End if hasAVX2
 							else if (tpa::has_SSE2)
 							{
 								__m128i _Ai, _DESTi;
@@ -8724,7 +9035,7 @@ namespace bit_manip
 								for (; (i + 2) < end; i += 2)
 								{
 									//Set Values
-									_Ai = _mm_load_si128((__m128i*) & source1[i]);
+									_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -8752,7 +9063,7 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm_store_si128((__m128i*) & dest[i], _DESTi);
+									_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
 								}//End for
 							}//End if has_SSE2
 #endif							
@@ -8762,7 +9073,7 @@ namespace bit_manip
 						else if constexpr (std::is_same<T, uint64_t>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512)
+							if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 							{
 								__m512i _Ai, _DESTi;
 								const __m512i _Bi = _mm512_set1_epi64(val);
@@ -8770,7 +9081,7 @@ namespace bit_manip
 								for (; (i+8) < end; i += 8)
 								{
 									//Set Values
-									_Ai = _mm512_load_epi64((__m512i*)&source1[i]);
+									_Ai = _mm512_loadu_epi64((__m512i*)&source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::bit::AND)
@@ -8798,10 +9109,10 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm512_store_epi64((__m256i*) & dest[i], _DESTi);
+									_mm512_storeu_epi64((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX2)
+							}();//End if hasAVX512
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
 								__m256i _Ai, _DESTi;
 								const __m256i _Bi = _mm256_set1_epi64x(val);
@@ -8809,7 +9120,7 @@ namespace bit_manip
 								for (; (i+4) < end; i += 4)
 								{
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::bit::AND)
@@ -8837,9 +9148,9 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX2
+							}();//End if hasAVX2
 							else if (tpa::has_SSE2)
 							{
 								__m128i _Ai, _DESTi;
@@ -8848,7 +9159,7 @@ namespace bit_manip
 								for (; (i + 2) < end; i += 2)
 								{
 									//Set Values
-									_Ai = _mm_load_si128((__m128i*) & source1[i]);
+									_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -8876,7 +9187,7 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm_store_si128((__m128i*) & dest[i], _DESTi);
+									_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
 								}//End for
 							}//End if has_SSE2
 #endif							
@@ -8886,7 +9197,7 @@ namespace bit_manip
 						else if constexpr (std::is_same<T, float>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512_DWQW)
+							if (tpa::hasAVX512_DWQW) [&]() TPA_TARGET("avx512dq")
 							{
 								__m512 _Ai, _DESTi;
 								const __m512 _Bi = _mm512_set1_ps(val);
@@ -8894,7 +9205,7 @@ namespace bit_manip
 								for (; (i+16) < end; i += 16)
 								{
 									//Set Values
-									_Ai = _mm512_load_ps(&source1[i]);
+									_Ai = _mm512_loadu_ps(&source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::bit::AND)
@@ -8922,10 +9233,10 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm512_store_ps(&dest[i], _DESTi);
+									_mm512_storeu_ps(&dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX)
+							}();//End if hasAVX512
+							else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
 							{
 								__m256 _Ai, _DESTi;
 								const __m256 _Bi = _mm256_set1_ps(val);
@@ -8933,7 +9244,7 @@ namespace bit_manip
 								for (; (i+8) < end; i += 8)
 								{
 									//Set Values
-									_Ai = _mm256_load_ps(&source1[i]);
+									_Ai = _mm256_loadu_ps(&source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::bit::AND)
@@ -8961,9 +9272,9 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm256_store_ps(&dest[i], _DESTi);
+									_mm256_storeu_ps(&dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX
+							}();//End if hasAVX
 							else if (tpa::has_SSE)
 							{
 								__m128 _Ai, _DESTi;
@@ -8972,7 +9283,7 @@ namespace bit_manip
 								for (; (i + 4) < end; i += 4)
 								{
 									//Set Values
-									_Ai = _mm_load_ps(&source1[i]);
+									_Ai = _mm_loadu_ps(&source1[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -9000,7 +9311,7 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm_store_ps(&dest[i], _DESTi);
+									_mm_storeu_ps(&dest[i], _DESTi);
 								}//End for
 							}//End if has_SSE
 #endif						
@@ -9010,7 +9321,7 @@ namespace bit_manip
 						else if constexpr (std::is_same<T, double>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512_DWQW)
+							if (tpa::hasAVX512_DWQW) [&]() TPA_TARGET("avx512dq")
 							{
 								__m512d _Ai, _DESTi;
 								const __m512d _Bi = _mm512_set1_pd(val);
@@ -9018,7 +9329,7 @@ namespace bit_manip
 								for (; (i+8) < end; i += 8)
 								{
 									//Set Values
-									_Ai = _mm512_load_pd(&source1[i]);
+									_Ai = _mm512_loadu_pd(&source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::bit::AND)
@@ -9046,10 +9357,10 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm512_store_pd(&dest[i], _DESTi);
+									_mm512_storeu_pd(&dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX)
+							}();//End if hasAVX512
+							else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
 							{
 								__m256d _Ai, _DESTi;
 								const __m256d _Bi = _mm256_set1_pd(val);
@@ -9057,7 +9368,7 @@ namespace bit_manip
 								for (; (i+4) < end; i += 4)
 								{
 									//Set Values
-									_Ai = _mm256_load_pd(&source1[i]);
+									_Ai = _mm256_loadu_pd(&source1[i]);
 
 									//Calc
 									if constexpr (INSTR == tpa::bit::AND)
@@ -9085,9 +9396,9 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm256_store_pd(&dest[i], _DESTi);
+									_mm256_storeu_pd(&dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX2
+							}();//End if hasAVX2
 							else if (tpa::has_SSE2)
 							{
 								__m128d _Ai, _DESTi;
@@ -9096,7 +9407,7 @@ namespace bit_manip
 								for (; (i+2) < end; i += 2)
 								{
 									//Set Values
-									_Ai = _mm_load_pd(&source1[i]);
+									_Ai = _mm_loadu_pd(&source1[i]);
 
 									//Calc									
 									if constexpr (INSTR == tpa::bit::AND)
@@ -9124,7 +9435,7 @@ namespace bit_manip
 									}//End else
 
 									//Store Result
-									_mm_store_pd(&dest[i], _DESTi);
+									_mm_storeu_pd(&dest[i], _DESTi);
 								}//End for
 							}//End if has_SSE2
 #endif						
@@ -9205,14 +9516,6 @@ namespace bit_manip
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::bitwise_const: " << ex.what() << "\n";
-			std::cerr << "tpa::simd::bitwise_const will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -9264,8 +9567,8 @@ namespace bit_manip
 		try
 		{
 			static_assert(
-				std::is_same<CONTAINER_A::value_type, CONTAINER_B::value_type>() &&
-				std::is_same<CONTAINER_A::value_type, CONTAINER_C::value_type>(),
+				std::is_same<typename CONTAINER_A::value_type, typename CONTAINER_B::value_type>() &&
+				std::is_same<typename CONTAINER_A::value_type, typename CONTAINER_C::value_type>(),
 				"Compile Error! The source and destination containers must be of the same value type!");
 
 			using T = CONTAINER_A::value_type;
@@ -9275,9 +9578,11 @@ namespace bit_manip
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::bit_move: " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::bit_move will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
@@ -9300,7 +9605,7 @@ namespace bit_manip
 					if constexpr ((std::is_same<T, int16_t>()) || (std::is_same<T, uint16_t>()))
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512_ByteWord)
+						if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 						{
 							__m512i _Ai, _Bi, _DESTi;
 
@@ -9330,16 +9635,16 @@ namespace bit_manip
 								//Store Result
 								_mm512_storeu_epi16((__m256i*) & dest[i], _DESTi);
 							}//End for
-						}//End if hasAVX512
-						else if (tpa::hasAVX2)
+						}();//End if hasAVX512
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m256i _Ai, _Bi, _DESTi;
 
 							for (; (i + 16uz) < end; i += 16uz)
 							{
 								//Set Values
-								_Ai = _mm256_load_si256((__m256i*)&source1[i]);
-								_Bi = _mm256_load_si256((__m256i*)&source2[i]);
+								_Ai = _mm256_loadu_si256((__m256i*)&source1[i]);
+								_Bi = _mm256_loadu_si256((__m256i*)&source2[i]);
 
 								if constexpr (INSTR == tpa::bit_move::SHIFT_LEFT)
 								{
@@ -9360,9 +9665,9 @@ namespace bit_manip
 								}//End  if
 
 								//Store Result
-								_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+								_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 							}//End for
-						}//End if hasAVX2
+						}();//End if hasAVX2
 						else if (tpa::has_SSE2)
 						{
 							__m128i _Ai, _Bi, _DESTi;
@@ -9370,8 +9675,8 @@ namespace bit_manip
 							for (; (i + 8uz) < end; i += 8uz)
 							{
 								//Set Values
-								_Ai = _mm_load_si128((__m128i*) & source1[i]);
-								_Bi = _mm_load_si128((__m128i*) & source2[i]);
+								_Ai = _mm_loadu_si128((__m128i*) & source1[i]);
+								_Bi = _mm_loadu_si128((__m128i*) & source2[i]);
 
 								if constexpr (INSTR == tpa::bit_move::SHIFT_LEFT)
 								{
@@ -9392,7 +9697,7 @@ namespace bit_manip
 								}//End  if
 
 								//Store Result
-								_mm_store_si128((__m128i*) & dest[i], _DESTi);
+								_mm_storeu_si128((__m128i*) & dest[i], _DESTi);
 							}//End for
 						}//End if hasSSE2
 #endif							
@@ -9445,14 +9750,6 @@ namespace bit_manip
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::bit_move: " << ex.what() << "\n";
-			std::cerr << "tpa::simd::bit_move will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -9502,7 +9799,7 @@ namespace bit_manip
 		try
 		{
 			static_assert(
-				std::is_same<CONTAINER_A::value_type, CONTAINER_C::value_type>(),
+				std::is_same<typename CONTAINER_A::value_type, typename CONTAINER_C::value_type>(),
 				"Compile Error! The source and destination containers must be of the same value type!");
 
 			using T = CONTAINER_A::value_type;
@@ -9512,9 +9809,11 @@ namespace bit_manip
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::bit_move: " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::bit_move will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
@@ -9537,7 +9836,7 @@ namespace bit_manip
 						if constexpr (std::is_same<T, int16_t>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512_ByteWord)
+							if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 							{
 								__m512i _Ai, _DESTi;
 
@@ -9557,8 +9856,8 @@ namespace bit_manip
 									//Store Result
 									_mm512_storeu_epi16((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX512_BW
-							else if (tpa::hasAVX2)
+							}();//End if hasAVX512_BW
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
 								__m256i _Ai, _DESTi;
 
@@ -9570,15 +9869,15 @@ namespace bit_manip
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 
 									//Shift Right
 									_DESTi = _mm256_srli_epi16(_Ai, amount);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX2
+							}();//End if hasAVX2
 #endif							
 						}//End if
 #pragma endregion
@@ -9586,7 +9885,7 @@ namespace bit_manip
 						else if constexpr (std::is_same<T, uint16_t>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512_ByteWord)
+							if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 							{
 								__m512i _Ai, _DESTi;
 
@@ -9606,8 +9905,8 @@ namespace bit_manip
 									//Store Result
 									_mm512_storeu_epi16((__m512i*)&dest[i], _DESTi);
 								}//End for
-							}//End if has AVX512_BW				
-							else if (tpa::hasAVX2)
+							}();//End if has AVX512_BW				
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
 								__m256i _Ai, _DESTi;
 
@@ -9619,15 +9918,15 @@ namespace bit_manip
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 
 									//Shift Right
 									_DESTi = _mm256_srli_epi16(_Ai, amount);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX2
+							}();//End if hasAVX2
 #endif 							
 						}//End if
 #pragma endregion
@@ -9635,7 +9934,7 @@ namespace bit_manip
 						else if constexpr (std::is_same<T, int32_t>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512)
+							if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 							{
 								__m512i _Ai, _DESTi;
 
@@ -9647,16 +9946,16 @@ namespace bit_manip
 									}//End if
 
 									//Set Values
-									_Ai = _mm512_load_epi32((__m512i*)&source1[i]);
+									_Ai = _mm512_loadu_epi32((__m512i*)&source1[i]);
 
 									//Shift Right
 									_DESTi = _mm512_srli_epi32(_Ai, amount);
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _DESTi);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX2)
+							}();//End if hasAVX512
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
 								__m256i _Ai, _DESTi;
 
@@ -9668,15 +9967,15 @@ namespace bit_manip
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 
 									//Shift Right
 									_DESTi = _mm256_srli_epi32(_Ai, amount);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX2
+							}();//End if hasAVX2
 #endif							
 						}//End if
 #pragma endregion
@@ -9684,7 +9983,7 @@ namespace bit_manip
 						else if constexpr (std::is_same<T, uint32_t>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512)
+							if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 							{
 								__m512i _Ai, _DESTi;
 
@@ -9696,16 +9995,16 @@ namespace bit_manip
 									}//End if
 
 									//Set Values
-									_Ai = _mm512_load_epi32((__m512i*)&source1[i]);
+									_Ai = _mm512_loadu_epi32((__m512i*)&source1[i]);
 
 									//Shift Right
 									_DESTi = _mm512_srli_epi32(_Ai, amount);
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _DESTi);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _DESTi);
 								}//End for
-							}//End if
-							else if (tpa::hasAVX2)
+							}();//End if
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
 								__m256i _Ai, _DESTi;
 
@@ -9717,15 +10016,15 @@ namespace bit_manip
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 
 									//Shift Right
 									_DESTi = _mm256_srli_epi32(_Ai, amount);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX2
+							}();//End if hasAVX2
 #endif							
 						}//End if
 #pragma endregion
@@ -9733,7 +10032,7 @@ namespace bit_manip
 						else if constexpr (std::is_same<T, int64_t>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512)
+							if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 							{
 								__m512i _Ai, _DESTi;
 
@@ -9745,16 +10044,16 @@ namespace bit_manip
 									}//End if
 
 									//Set Values
-									_Ai = _mm512_load_epi64((__m512i*)&source1[i]);
+									_Ai = _mm512_loadu_epi64((__m512i*)&source1[i]);
 
 									//Shift Right
 									_DESTi = _mm512_srli_epi64(_Ai, amount);
 
 									//Store Result
-									_mm512_store_epi64((__m256i*) & dest[i], _DESTi);
+									_mm512_storeu_epi64((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX2)
+							}();//End if hasAVX512
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
 								__m256i _Ai, _DESTi;
 
@@ -9766,15 +10065,15 @@ namespace bit_manip
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 
 									//Shift Left
 									_DESTi = _mm256_srli_epi64(_Ai, amount);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX2
+							}();//End if hasAVX2
 #endif							
 						}//End if
 #pragma endregion
@@ -9782,7 +10081,7 @@ namespace bit_manip
 						else if constexpr (std::is_same<T, uint64_t>() == true)
 						{
 #ifdef TPA_X86_64
-							if (tpa::hasAVX512)
+							if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 							{
 								__m512i _Ai, _DESTi;
 
@@ -9795,16 +10094,16 @@ namespace bit_manip
 									}//End if
 
 									//Set Values
-									_Ai = _mm512_load_epi64((__m512i*)&source1[i]);
+									_Ai = _mm512_loadu_epi64((__m512i*)&source1[i]);
 
 									//Shift Right
 									_DESTi = _mm512_srli_epi64(_Ai, amount);
 
 									//Store Result
-									_mm512_store_epi64((__m256i*) & dest[i], _DESTi);
+									_mm512_storeu_epi64((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX2)
+							}();//End if hasAVX512
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
 								__m256i _Ai, _DESTi;
 
@@ -9817,15 +10116,15 @@ namespace bit_manip
 									}//End if
 
 									//Set Values
-									_Ai = _mm256_load_si256((__m256i*) & source1[i]);
+									_Ai = _mm256_loadu_si256((__m256i*) & source1[i]);
 
 									//Shift Left
 									_DESTi = _mm256_srli_epi64(_Ai, amount);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+									_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 								}//End for
-							}//End if hasAVX2
+							}();//End if hasAVX2
 #endif							
 						}//End if
 #pragma endregion
@@ -9854,14 +10153,6 @@ namespace bit_manip
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::bit_move: " << ex.what() << "\n";
-			std::cerr << "tpa::simd::bit_move will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -9908,7 +10199,7 @@ namespace bit_manip
 		try
 		{
 			static_assert(
-				std::is_same<CONTAINER_A::value_type, CONTAINER_B::value_type>(),
+				std::is_same<typename CONTAINER_A::value_type, typename CONTAINER_B::value_type>(),
 				"Compile Error! The source and destination containers must be of the same value type!");
 
 			using T = CONTAINER_A::value_type;
@@ -9918,9 +10209,11 @@ namespace bit_manip
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::bitwise_not: " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::bitwise_not will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
@@ -9943,7 +10236,7 @@ namespace bit_manip
 					if constexpr (std::is_same<T, int8_t>() == true)
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512_ByteWord)
+						if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 						{
 							__m512i _Ai, _DESTi;
 							const __m512i _max = _mm512_set1_epi8(static_cast<int8_t>(std::numeric_limits<uint8_t>::max()));
@@ -9964,8 +10257,8 @@ namespace bit_manip
 								//Store Result
 								_mm512_storeu_epi8(&dest[i], _DESTi);
 							}//End for
-						}//End if hasAVX512_BW
-						else if (tpa::hasAVX2)
+						}();//End if hasAVX512_BW
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m256i _Ai, _DESTi;
 							const __m256i _max = _mm256_set1_epi8(static_cast<int8_t>(std::numeric_limits<uint8_t>::max()));
@@ -9978,15 +10271,15 @@ namespace bit_manip
 								}//End if
 
 								//Set Values
-								_Ai = _mm256_load_si256((__m256i*) &source[i]);
+								_Ai = _mm256_loadu_si256((__m256i*) &source[i]);
 
 								//Bit Not
 								_DESTi = _mm256_xor_si256(_Ai, _max);
 
 								//Store Result
-								_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+								_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 							}//End for
-						}//End if hasAVX2
+						}();//End if hasAVX2
 #endif							
 					}//End if
 #pragma endregion
@@ -9994,7 +10287,7 @@ namespace bit_manip
 					else if constexpr (std::is_same<T, uint8_t>() == true)
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512_ByteWord)
+						if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 						{
 							__m512i _Ai, _DESTi;
 							const __m512i _max = _mm512_set1_epi8(std::numeric_limits<uint8_t>::max());
@@ -10015,8 +10308,8 @@ namespace bit_manip
 								//Store Result
 								_mm512_storeu_epi8(&dest[i], _DESTi);
 							}//End for
-						}//End if hasAVX512_BW
-						else if (tpa::hasAVX2)
+						}();//End if hasAVX512_BW
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m256i _Ai, _DESTi;
 							const __m256i _max = _mm256_set1_epi8(std::numeric_limits<uint8_t>::max());
@@ -10029,15 +10322,15 @@ namespace bit_manip
 								}//End if
 
 								//Set Values
-								_Ai = _mm256_load_si256((__m256i*) & source[i]);
+								_Ai = _mm256_loadu_si256((__m256i*) & source[i]);
 
 								//Bit Not
 								_DESTi = _mm256_xor_si256(_Ai, _max);
 
 								//Store Result
-								_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+								_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 							}//End for
-						}//End if hasAVX2
+						}();//End if hasAVX2
 #endif							
 					}//End if
 #pragma endregion
@@ -10045,7 +10338,7 @@ namespace bit_manip
 					else if constexpr (std::is_same<T, int16_t>() == true)
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512_ByteWord)
+						if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 						{
 							__m512i _Ai, _DESTi;
 							const __m512i _max = _mm512_set1_epi16(static_cast<int16_t>(std::numeric_limits<uint16_t>::max()));
@@ -10066,8 +10359,8 @@ namespace bit_manip
 								//Store Result
 								_mm512_storeu_epi16(&dest[i], _DESTi);
 							}//End for
-						}//End if hasAVX512_BW
-						else if (tpa::hasAVX2)
+						}();//End if hasAVX512_BW
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m256i _Ai, _DESTi;
 							const __m256i _max = _mm256_set1_epi16(static_cast<int16_t>(std::numeric_limits<uint16_t>::max()));
@@ -10080,15 +10373,15 @@ namespace bit_manip
 								}//End if
 
 								//Set Values
-								_Ai = _mm256_load_si256((__m256i*) & source[i]);
+								_Ai = _mm256_loadu_si256((__m256i*) & source[i]);
 
 								//Bit Not
 								_DESTi = _mm256_xor_si256(_Ai, _max);
 
 								//Store Result
-								_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+								_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 							}//End for
-						}//End if hasAVX2
+						}();//End if hasAVX2
 #endif							
 					}//End if
 #pragma endregion
@@ -10096,7 +10389,7 @@ namespace bit_manip
 					else if constexpr (std::is_same<T, uint16_t>() == true)
 					{
 #ifdef TPA_X86_64
-					if (tpa::hasAVX512_ByteWord)
+					if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 					{
 						__m512i _Ai, _DESTi;
 						const __m512i _max = _mm512_set1_epi16(std::numeric_limits<uint16_t>::max());
@@ -10117,8 +10410,8 @@ namespace bit_manip
 							//Store Result
 							_mm512_storeu_epi16(&dest[i], _DESTi);
 						}//End for
-					}//End if hasAVX512_BW
-					else if (tpa::hasAVX2)
+					}();//End if hasAVX512_BW
+					else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 					{
 						__m256i _Ai, _DESTi;
 						const __m256i _max = _mm256_set1_epi16(std::numeric_limits<uint16_t>::max());
@@ -10131,15 +10424,15 @@ namespace bit_manip
 							}//End if
 
 							//Set Values
-							_Ai = _mm256_load_si256((__m256i*) & source[i]);
+							_Ai = _mm256_loadu_si256((__m256i*) & source[i]);
 
 							//Bit Not
 							_DESTi = _mm256_xor_si256(_Ai, _max);
 
 							//Store Result
-							_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+							_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 						}//End for
-					}//End if hasAVX2
+					}();//End if hasAVX2
 #endif							
 					}//End if
 #pragma endregion
@@ -10147,7 +10440,7 @@ namespace bit_manip
 					else if constexpr (std::is_same<T, int32_t>() == true)
 					{
 #ifdef TPA_X86_64
-					if (tpa::hasAVX512)
+					if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 					{
 						__m512i _Ai, _DESTi;
 						const __m512i _max = _mm512_set1_epi32(static_cast<int32_t>(std::numeric_limits<uint32_t>::max()));
@@ -10168,8 +10461,8 @@ namespace bit_manip
 							//Store Result
 							_mm512_storeu_epi32(&dest[i], _DESTi);
 						}//End for
-					}//End if hasAVX512_BW
-					else if (tpa::hasAVX2)
+					}();//End if hasAVX512_BW
+					else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 					{
 						__m256i _Ai, _DESTi;
 						const __m256i _max = _mm256_set1_epi32(static_cast<int32_t>(std::numeric_limits<uint32_t>::max()));
@@ -10182,15 +10475,15 @@ namespace bit_manip
 							}//End if
 
 							//Set Values
-							_Ai = _mm256_load_si256((__m256i*) & source[i]);
+							_Ai = _mm256_loadu_si256((__m256i*) & source[i]);
 
 							//Bit Not
 							_DESTi = _mm256_xor_si256(_Ai, _max);
 
 							//Store Result
-							_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+							_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 						}//End for
-					}//End if hasAVX2
+					}();//End if hasAVX2
 #endif							
 					}//End if
 #pragma endregion
@@ -10198,7 +10491,7 @@ namespace bit_manip
 					else if constexpr (std::is_same<T, uint32_t>() == true)
 					{
 #ifdef TPA_X86_64
-					if (tpa::hasAVX512)
+					if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 					{
 						__m512i _Ai, _DESTi;
 						const __m512i _max = _mm512_set1_epi32(std::numeric_limits<uint32_t>::max());
@@ -10219,8 +10512,8 @@ namespace bit_manip
 							//Store Result
 							_mm512_storeu_epi32(&dest[i], _DESTi);
 						}//End for
-					}//End if hasAVX512_BW
-					else if (tpa::hasAVX2)
+					}();//End if hasAVX512_BW
+					else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 					{
 						__m256i _Ai, _DESTi;
 						const __m256i _max = _mm256_set1_epi32(std::numeric_limits<uint32_t>::max());
@@ -10233,15 +10526,15 @@ namespace bit_manip
 							}//End if
 
 							//Set Values
-							_Ai = _mm256_load_si256((__m256i*) & source[i]);
+							_Ai = _mm256_loadu_si256((__m256i*) & source[i]);
 
 							//Bit Not
 							_DESTi = _mm256_xor_si256(_Ai, _max);
 
 							//Store Result
-							_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+							_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 						}//End for
-					}//End if hasAVX2
+					}();//End if hasAVX2
 #endif							
 					}//End if
 #pragma endregion
@@ -10249,7 +10542,7 @@ namespace bit_manip
 					else if constexpr (std::is_same<T, int64_t>() == true)
 					{
 #ifdef TPA_X86_64
-					if (tpa::hasAVX512)
+					if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 					{
 						__m512i _Ai, _DESTi;
 						const __m512i _max = _mm512_set1_epi64(static_cast<int64_t>(std::numeric_limits<uint64_t>::max()));
@@ -10270,8 +10563,8 @@ namespace bit_manip
 							//Store Result
 							_mm512_storeu_epi64(&dest[i], _DESTi);
 						}//End for
-					}//End if hasAVX512_BW
-					else if (tpa::hasAVX2)
+					}();//End if hasAVX512_BW
+					else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 					{
 						__m256i _Ai, _DESTi;
 						const __m256i _max = _mm256_set1_epi64x(static_cast<int64_t>(std::numeric_limits<uint64_t>::max()));
@@ -10284,15 +10577,15 @@ namespace bit_manip
 							}//End if
 
 							//Set Values
-							_Ai = _mm256_load_si256((__m256i*) & source[i]);
+							_Ai = _mm256_loadu_si256((__m256i*) & source[i]);
 
 							//Bit Not
 							_DESTi = _mm256_xor_si256(_Ai, _max);
 
 							//Store Result
-							_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+							_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 						}//End for
-					}//End if hasAVX2
+					}();//End if hasAVX2
 #endif							
 					}//End if
 #pragma endregion
@@ -10300,7 +10593,7 @@ namespace bit_manip
 					else if constexpr (std::is_same<T, uint64_t>() == true)
 					{
 #ifdef TPA_X86_64
-					if (tpa::hasAVX512)
+					if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 					{
 						__m512i _Ai, _DESTi;
 						const __m512i _max = _mm512_set1_epi64(std::numeric_limits<uint64_t>::max());
@@ -10321,8 +10614,8 @@ namespace bit_manip
 							//Store Result
 							_mm512_storeu_epi64(&dest[i], _DESTi);
 						}//End for
-					}//End if hasAVX512_BW
-					else if (tpa::hasAVX2)
+					}();//End if hasAVX512_BW
+					else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 					{
 						__m256i _Ai, _DESTi;
 						const __m256i _max = _mm256_set1_epi64x(std::numeric_limits<uint64_t>::max());
@@ -10335,15 +10628,15 @@ namespace bit_manip
 							}//End if
 
 							//Set Values
-							_Ai = _mm256_load_si256((__m256i*) & source[i]);
+							_Ai = _mm256_loadu_si256((__m256i*) & source[i]);
 
 							//Bit Not
 							_DESTi = _mm256_xor_si256(_Ai, _max);
 
 							//Store Result
-							_mm256_store_si256((__m256i*) & dest[i], _DESTi);
+							_mm256_storeu_si256((__m256i*) & dest[i], _DESTi);
 						}//End for
-					}//End if hasAVX2
+					}();//End if hasAVX2
 #endif							
 					}//End if
 #pragma endregion
@@ -10351,7 +10644,7 @@ namespace bit_manip
 					else if constexpr (std::is_same<T, float>() == true)
 					{
 #ifdef TPA_X86_64
-					if (tpa::hasAVX512_DWQW)
+					if (tpa::hasAVX512_DWQW) [&]() TPA_TARGET("avx512dq")
 					{
 						__m512 _Ai, _DESTi;
 						const __m512 _max = _mm512_set1_ps(std::numeric_limits<float>::max());
@@ -10364,16 +10657,16 @@ namespace bit_manip
 							}//End if
 
 							//Set Values
-							_Ai = _mm512_load_ps(&source[i]);
+							_Ai = _mm512_loadu_ps(&source[i]);
 
 							//Bit Not
 							_DESTi = _mm512_xor_ps(_Ai, _max);
 
 							//Store Result
-							_mm512_store_ps(&dest[i], _DESTi);
+							_mm512_storeu_ps(&dest[i], _DESTi);
 						}//End for
-					}//End if hasAVX512_DWQW
-					else if (tpa::hasAVX)
+					}();//End if hasAVX512_DWQW
+					else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
 					{
 						__m256 _Ai, _DESTi;
 						const __m256 _max = _mm256_set1_ps(std::numeric_limits<float>::max());
@@ -10386,15 +10679,15 @@ namespace bit_manip
 							}//End if
 
 							//Set Values
-							_Ai = _mm256_load_ps(&source[i]);
+							_Ai = _mm256_loadu_ps(&source[i]);
 
 							//Bit Not
 							_DESTi = _mm256_xor_ps(_Ai, _max);
 
 							//Store Result
-							_mm256_store_ps(&dest[i], _DESTi);
+							_mm256_storeu_ps(&dest[i], _DESTi);
 						}//End for
-					}//End if hasAVX
+					}();//End if hasAVX
 #endif							
 					}//End if
 #pragma endregion
@@ -10402,7 +10695,7 @@ namespace bit_manip
 					else if constexpr (std::is_same<T, double>() == true)
 					{
 #ifdef TPA_X86_64
-					if (tpa::hasAVX512_DWQW)
+					if (tpa::hasAVX512_DWQW) [&]() TPA_TARGET("avx512dq")
 					{
 						__m512d _Ai, _DESTi;
 						const __m512d _max = _mm512_set1_pd(std::numeric_limits<double>::max());
@@ -10415,16 +10708,16 @@ namespace bit_manip
 							}//End if
 
 							//Set Values
-							_Ai = _mm512_load_pd(&source[i]);
+							_Ai = _mm512_loadu_pd(&source[i]);
 
 							//Bit Not
 							_DESTi = _mm512_xor_pd(_Ai, _max);
 
 							//Store Result
-							_mm512_store_pd(&dest[i], _DESTi);
+							_mm512_storeu_pd(&dest[i], _DESTi);
 						}//End for
-					}//End if hasAVX512_DWQW
-					else if (tpa::hasAVX)
+					}();//End if hasAVX512_DWQW
+					else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
 					{
 						__m256d _Ai, _DESTi;
 						const __m256d _max = _mm256_set1_pd(std::numeric_limits<double>::max());
@@ -10437,15 +10730,15 @@ namespace bit_manip
 							}//End if
 
 							//Set Values
-							_Ai = _mm256_load_pd(&source[i]);
+							_Ai = _mm256_loadu_pd(&source[i]);
 
 							//Bit Not
 							_DESTi = _mm256_xor_pd(_Ai, _max);
 
 							//Store Result
-							_mm256_store_pd(&dest[i], _DESTi);
+							_mm256_storeu_pd(&dest[i], _DESTi);
 						}//End for
-					}//End if hasAVX
+					}();//End if hasAVX
 #endif							
 					}//End if
 #pragma endregion
@@ -10481,14 +10774,6 @@ namespace bit_manip
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::bitwise_not: " << ex.what() << "\n";
-			std::cerr << "tpa::simd::bitwise_not will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -42,11 +42,130 @@
 #include "../tpa_concepts.hpp"
 #include "../InstructionSet.hpp"
 #include "simd.hpp"
+#include "dispatch.hpp"
 
 #undef floor
 #undef ceil
 #undef round
 
+#ifdef TPA_NEON
+/// <summary>
+/// <para>Private Namespace for the TPA static_convert NEON kernels.</para>
+/// </summary>
+namespace tpa_convert_private
+{
+	template<typename T, size_t SIZE, bool SIGNED>
+	inline constexpr bool is_int = std::is_integral<T>::value && !std::is_same<T, bool>::value && sizeof(T) == SIZE && std::is_signed<T>::value == SIGNED;
+
+	/// <summary>
+	/// <para>True if tpa_convert_private::convert_neon implements the conversion from FROM_T to TO_T.</para>
+	/// <para>32-bit integers &lt;-&gt; float, 64-bit integers &lt;-&gt; double, float &lt;-&gt; double and integer widening to twice the size with the same signedness.</para>
+	/// </summary>
+	template<typename FROM_T, typename TO_T>
+	inline constexpr bool has_convert_neon =
+		((is_int<FROM_T, 4uz, true> || is_int<FROM_T, 4uz, false>) && std::is_same<TO_T, float>::value) ||
+		((is_int<FROM_T, 8uz, true> || is_int<FROM_T, 8uz, false>) && std::is_same<TO_T, double>::value) ||
+		(std::is_same<FROM_T, float>::value && (is_int<TO_T, 4uz, true> || is_int<TO_T, 4uz, false> || std::is_same<TO_T, double>::value)) ||
+		(std::is_same<FROM_T, double>::value && (is_int<TO_T, 8uz, true> || is_int<TO_T, 8uz, false> || std::is_same<TO_T, float>::value)) ||
+		(std::is_integral<FROM_T>::value && !std::is_same<FROM_T, bool>::value && sizeof(FROM_T) <= 4uz &&
+			std::is_integral<TO_T>::value && sizeof(TO_T) == sizeof(FROM_T) * 2uz && std::is_signed<FROM_T>::value == std::is_signed<TO_T>::value);
+
+	/// <summary>
+	/// <para>dest[i] = static_cast&lt;TO_T&gt;(source[i]) over [i, end) with 128-bit NEON, 'i' is advanced past the elements processed.</para>
+	/// <para>Floating-point to integer conversions round with the current rounding mode (FRINTI) like the x86 kernels.</para>
+	/// </summary>
+	template<typename FROM_T, typename TO_T>
+	requires has_convert_neon<FROM_T, TO_T>
+	inline void convert_neon(size_t& i, const size_t end, const FROM_T* source, TO_T* dest) noexcept
+	{
+		//Elements per iteration, one 128-bit register of the narrower type
+		constexpr size_t W = 16uz / tpa::util::min(sizeof(FROM_T), sizeof(TO_T));
+
+		for (; (i + W) <= end; i += W)
+		{
+			if constexpr (std::is_same<TO_T, float>::value && std::is_same<FROM_T, double>::value)
+			{
+				vst1q_f32(&dest[i], vcvt_high_f32_f64(vcvt_f32_f64(vld1q_f64(&source[i])), vld1q_f64(&source[i + 2uz])));
+			}//End if
+			else if constexpr (std::is_same<TO_T, double>::value && std::is_same<FROM_T, float>::value)
+			{
+				const float32x4_t _from = vld1q_f32(&source[i]);
+				vst1q_f64(&dest[i], vcvt_f64_f32(vget_low_f32(_from)));
+				vst1q_f64(&dest[i + 2uz], vcvt_high_f64_f32(_from));
+			}//End if
+			else if constexpr (std::is_same<TO_T, float>::value && std::is_signed<FROM_T>::value)
+			{
+				vst1q_f32(&dest[i], vcvtq_f32_s32(vld1q_s32(reinterpret_cast<const int32_t*>(&source[i]))));
+			}//End if
+			else if constexpr (std::is_same<TO_T, float>::value)
+			{
+				vst1q_f32(&dest[i], vcvtq_f32_u32(vld1q_u32(reinterpret_cast<const uint32_t*>(&source[i]))));
+			}//End if
+			else if constexpr (std::is_same<TO_T, double>::value && std::is_signed<FROM_T>::value)
+			{
+				vst1q_f64(&dest[i], vcvtq_f64_s64(vld1q_s64(reinterpret_cast<const int64_t*>(&source[i]))));
+			}//End if
+			else if constexpr (std::is_same<TO_T, double>::value)
+			{
+				vst1q_f64(&dest[i], vcvtq_f64_u64(vld1q_u64(reinterpret_cast<const uint64_t*>(&source[i]))));
+			}//End if
+			else if constexpr (std::is_same<FROM_T, float>::value && std::is_signed<TO_T>::value)
+			{
+				vst1q_s32(reinterpret_cast<int32_t*>(&dest[i]), vcvtq_s32_f32(vrndiq_f32(vld1q_f32(&source[i]))));
+			}//End if
+			else if constexpr (std::is_same<FROM_T, float>::value)
+			{
+				vst1q_u32(reinterpret_cast<uint32_t*>(&dest[i]), vcvtq_u32_f32(vrndiq_f32(vld1q_f32(&source[i]))));
+			}//End if
+			else if constexpr (std::is_same<FROM_T, double>::value && std::is_signed<TO_T>::value)
+			{
+				vst1q_s64(reinterpret_cast<int64_t*>(&dest[i]), vcvtq_s64_f64(vrndiq_f64(vld1q_f64(&source[i]))));
+			}//End if
+			else if constexpr (std::is_same<FROM_T, double>::value)
+			{
+				vst1q_u64(reinterpret_cast<uint64_t*>(&dest[i]), vcvtq_u64_f64(vrndiq_f64(vld1q_f64(&source[i]))));
+			}//End if
+			else if constexpr (is_int<FROM_T, 1uz, true>)
+			{
+				const int8x16_t _from = vld1q_s8(reinterpret_cast<const int8_t*>(&source[i]));
+				vst1q_s16(reinterpret_cast<int16_t*>(&dest[i]), vmovl_s8(vget_low_s8(_from)));
+				vst1q_s16(reinterpret_cast<int16_t*>(&dest[i + 8uz]), vmovl_high_s8(_from));
+			}//End if
+			else if constexpr (is_int<FROM_T, 1uz, false>)
+			{
+				const uint8x16_t _from = vld1q_u8(reinterpret_cast<const uint8_t*>(&source[i]));
+				vst1q_u16(reinterpret_cast<uint16_t*>(&dest[i]), vmovl_u8(vget_low_u8(_from)));
+				vst1q_u16(reinterpret_cast<uint16_t*>(&dest[i + 8uz]), vmovl_high_u8(_from));
+			}//End if
+			else if constexpr (is_int<FROM_T, 2uz, true>)
+			{
+				const int16x8_t _from = vld1q_s16(reinterpret_cast<const int16_t*>(&source[i]));
+				vst1q_s32(reinterpret_cast<int32_t*>(&dest[i]), vmovl_s16(vget_low_s16(_from)));
+				vst1q_s32(reinterpret_cast<int32_t*>(&dest[i + 4uz]), vmovl_high_s16(_from));
+			}//End if
+			else if constexpr (is_int<FROM_T, 2uz, false>)
+			{
+				const uint16x8_t _from = vld1q_u16(reinterpret_cast<const uint16_t*>(&source[i]));
+				vst1q_u32(reinterpret_cast<uint32_t*>(&dest[i]), vmovl_u16(vget_low_u16(_from)));
+				vst1q_u32(reinterpret_cast<uint32_t*>(&dest[i + 4uz]), vmovl_high_u16(_from));
+			}//End if
+			else if constexpr (is_int<FROM_T, 4uz, true>)
+			{
+				const int32x4_t _from = vld1q_s32(reinterpret_cast<const int32_t*>(&source[i]));
+				vst1q_s64(reinterpret_cast<int64_t*>(&dest[i]), vmovl_s32(vget_low_s32(_from)));
+				vst1q_s64(reinterpret_cast<int64_t*>(&dest[i + 2uz]), vmovl_high_s32(_from));
+			}//End if
+			else
+			{
+				const uint32x4_t _from = vld1q_u32(reinterpret_cast<const uint32_t*>(&source[i]));
+				vst1q_u64(reinterpret_cast<uint64_t*>(&dest[i]), vmovl_u32(vget_low_u32(_from)));
+				vst1q_u64(reinterpret_cast<uint64_t*>(&dest[i + 2uz]), vmovl_high_u32(_from));
+			}//End else
+		}//End for
+	}//End of convert_neon
+}//End of namespace
+#endif
+
 namespace tpa{
 
 	/// <summary>
@@ -81,13 +200,18 @@ namespace tpa{
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::static_convert: " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::static_convert will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
 
+			//tpa::simd::runtime_avx512_policy may turn the 512-bit branches off for this input
+			const bool allow512 = tpa::simd::avx512_allowed(smallest * sizeof(FROM_T));
+
 			std::vector<std::shared_future<uint32_t>> results;
 			results.reserve(tpa::nThreads);
 
@@ -96,7 +220,7 @@ namespace tpa{
 			for (const auto& sec : sections)
 			{
 				//Launch lambda from multiple threads
-				temp = tpa::tp->addTask([&source, &dest, &sec]()
+				temp = tpa::tp->addTask([&source, &dest, &sec, allow512]()
 				{
 					const size_t beg = sec.first;
 					const size_t end = sec.second;
@@ -106,44 +230,44 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, int8_t>() && std::is_same<TO_T, int16_t>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512_ByteWord)
+						if (allow512 && tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 						{
 							__m256i _from;
 							__m512i _to;
 
 							for (; (i + 32uz) < end; i += 32uz)
 							{
-								_from = _mm256_load_si256((__m256i*) & source[i]);
+								_from = _mm256_loadu_si256((__m256i*) & source[i]);
 								_to = _mm512_cvtepi8_epi16(_from);
 
 								_mm512_storeu_epi16(&dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m128i _from;
 							__m256i _to;
 
 							for (; (i + 16uz) < end; i += 16uz)
 							{
-								_from = _mm_load_si128((__m128i*) &source[i]);
+								_from = _mm_loadu_si128((__m128i*) &source[i]);
 								_to = _mm256_cvtepi8_epi16(_from);
 
-								_mm256_store_si256((__m256i*) &dest[i], _to);
+								_mm256_storeu_si256((__m256i*) &dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::has_SSE41)
+						}();//End if
+						else if (tpa::has_SSE41) [&]() TPA_TARGET("sse4.1")
 						{
 							__m128i _from, _to;
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm_cvtepi8_epi16(_from);
 
-								_mm_store_si128((__m128i*) & dest[i], _to);
+								_mm_storeu_si128((__m128i*) & dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 #endif
 					}//End if
 #pragma endregion
@@ -151,44 +275,44 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, int8_t>() && std::is_same<TO_T, int32_t>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m128i _from;
 							__m512i _to;
 
 							for (; (i + 16uz) < end; i += 16uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm512_cvtepi8_epi32(_from);
 
-								_mm512_store_epi32(&dest[i], _to);
+								_mm512_storeu_epi32(&dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m128i _from;
 							__m256i _to;
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm256_cvtepi8_epi32(_from);
 
-								_mm256_store_si256((__m256i*) & dest[i], _to);
+								_mm256_storeu_si256((__m256i*) & dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::has_SSE41)
+						}();//End if
+						else if (tpa::has_SSE41) [&]() TPA_TARGET("sse4.1")
 						{
 							__m128i _from, _to;
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm_cvtepi8_epi32(_from);
 
-								_mm_store_si128((__m128i*) & dest[i], _to);
+								_mm_storeu_si128((__m128i*) & dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 #endif
 					}//End if
 #pragma endregion
@@ -196,44 +320,44 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, int8_t>() && std::is_same<TO_T, int64_t>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m128i _from;
 							__m512i _to;
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm512_cvtepi8_epi64(_from);
 
-								_mm512_store_epi64(&dest[i], _to);
+								_mm512_storeu_epi64(&dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m128i _from;
 							__m256i _to;
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm256_cvtepi8_epi64(_from);
 
-								_mm256_store_si256((__m256i*) & dest[i], _to);
+								_mm256_storeu_si256((__m256i*) & dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::has_SSE41)
+						}();//End if
+						else if (tpa::has_SSE41) [&]() TPA_TARGET("sse4.1")
 						{
 							__m128i _from, _to;
 
 							for (; (i + 2uz) < end; i += 2uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm_cvtepi8_epi64(_from);
 
-								_mm_store_si128((__m128i*) & dest[i], _to);
+								_mm_storeu_si128((__m128i*) & dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 #endif
 					}//End if
 #pragma endregion
@@ -241,7 +365,7 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, int8_t>() && std::is_same<TO_T, float>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m128i _from;
 							__m512i _to;
@@ -249,14 +373,14 @@ namespace tpa{
 
 							for (; (i + 16uz) < end; i += 16uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm512_cvtepi8_epi32(_from);
 								_tof = _mm512_cvtepi32_ps(_to);
 
-								_mm512_store_ps(&dest[i], _tof);
+								_mm512_storeu_ps(&dest[i], _tof);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m128i _from;
 							__m256i _to;
@@ -264,27 +388,27 @@ namespace tpa{
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm256_cvtepi8_epi32(_from);
 								_tof = _mm256_cvtepi32_ps(_to);
 
-								_mm256_store_ps(&dest[i], _tof);
+								_mm256_storeu_ps(&dest[i], _tof);
 							}//End for
-						}//End if
-						else if (tpa::has_SSE41)
+						}();//End if
+						else if (tpa::has_SSE41) [&]() TPA_TARGET("sse4.1")
 						{
 							__m128i _from, _to;
 							__m128 _tof;
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm_cvtepi8_epi32(_from);
 								_tof = _mm_cvtepi32_ps(_to);
 
-								_mm_store_ps(&dest[i], _tof);
+								_mm_storeu_ps(&dest[i], _tof);
 							}//End for
-						}//End if
+						}();//End if
 #endif
 					}//End if
 #pragma endregion
@@ -292,7 +416,7 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, int8_t>() && std::is_same<TO_T, double>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m128i _from;
 							__m512i _to;
@@ -301,20 +425,20 @@ namespace tpa{
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm512_cvtepi8_epi32(_from);
 
-								_first = _mm256_load_si256((__m256i*) &_to);
-								_second = _mm256_load_si256((__m256i*) &_to + 32);
+								_first = _mm256_loadu_si256((__m256i*) &_to);
+								_second = _mm256_loadu_si256((__m256i*) &_to + 32);
 
 								_tof = _mm512_cvtepi32_pd(_first);
-								_mm512_store_pd(&dest[i], _tof);
+								_mm512_storeu_pd(&dest[i], _tof);
 
 								_tof = _mm512_cvtepi32_pd(_second);
-								_mm512_store_pd(&dest[i+8], _tof);
+								_mm512_storeu_pd(&dest[i+8], _tof);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m128i _from, _first, _second;
 							__m256i _to;
@@ -322,39 +446,39 @@ namespace tpa{
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm_load_si128((__m128i*) &source[i]);
+								_from = _mm_loadu_si128((__m128i*) &source[i]);
 								_to = _mm256_cvtepi8_epi32(_from);
 
-								_first = _mm_load_si128((__m128i*) &_to);
-								_second = _mm_load_si128((__m128i*) &_to + 16);
+								_first = _mm_loadu_si128((__m128i*) &_to);
+								_second = _mm_loadu_si128((__m128i*) &_to + 16);
 
 								_tof = _mm256_cvtepi32_pd(_first);
-								_mm256_store_pd(&dest[i], _tof);
+								_mm256_storeu_pd(&dest[i], _tof);
 
 								_tof = _mm256_cvtepi32_pd(_second);
-								_mm256_store_pd(&dest[i+4], _tof);
+								_mm256_storeu_pd(&dest[i+4], _tof);
 							}//End for
-						}//End if
-						else if (tpa::has_SSE41)
+						}();//End if
+						else if (tpa::has_SSE41) [&]() TPA_TARGET("sse4.1")
 						{
 							__m128i _from, _to, _low, _high;
 							__m128d _tof;
 
 							for (; (i + 2uz) < end; i += 2uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm_cvtepi8_epi32(_from);
 
-								_low = _mm_load_si128((__m128i*) & _to);
-								_high = _mm_load_si128((__m128i*) & _to + 8);
+								_low = _mm_loadu_si128((__m128i*) & _to);
+								_high = _mm_loadu_si128((__m128i*) & _to + 8);
 
 								_tof = _mm_cvtepi32_pd(_low);
-								_mm_store_pd(&dest[i], _tof);
+								_mm_storeu_pd(&dest[i], _tof);
 
 								_tof = _mm_cvtepi32_pd(_high);
-								_mm_store_pd(&dest[i+2], _tof);
+								_mm_storeu_pd(&dest[i+2], _tof);
 							}//End for
-						}//End if
+						}();//End if
 #endif
 					}//End if
 #pragma endregion
@@ -362,44 +486,44 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, uint8_t>() && (std::is_same<TO_T, int16_t>() || std::is_same<TO_T, uint16_t>()))
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512_ByteWord)
+						if (allow512 && tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 						{
 							__m256i _from;
 							__m512i _to;
 
 							for (; (i + 32uz) < end; i += 32uz)
 							{
-								_from = _mm256_load_si256((__m256i*) & source[i]);
+								_from = _mm256_loadu_si256((__m256i*) & source[i]);
 								_to = _mm512_cvtepu8_epi16(_from);
 
 								_mm512_storeu_epi16(&dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m128i _from;
 							__m256i _to;
 
 							for (; (i + 16uz) < end; i += 16uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm256_cvtepu8_epi16(_from);
 
-								_mm256_store_si256((__m256i*) & dest[i], _to);
+								_mm256_storeu_si256((__m256i*) & dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::has_SSE41)
+						}();//End if
+						else if (tpa::has_SSE41) [&]() TPA_TARGET("sse4.1")
 						{
 							__m128i _from, _to;
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm_cvtepu8_epi16(_from);
 
-								_mm_store_si128((__m128i*) & dest[i], _to);
+								_mm_storeu_si128((__m128i*) & dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 #endif
 					}//End if
 #pragma endregion
@@ -407,44 +531,44 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, int8_t>() && (std::is_same<TO_T, int32_t>() || std::is_same<TO_T, uint32_t>()))
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m128i _from;
 							__m512i _to;
 
 							for (; (i + 16uz) < end; i += 16uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm512_cvtepu8_epi32(_from);
 
-								_mm512_store_epi32(&dest[i], _to);
+								_mm512_storeu_epi32(&dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m128i _from;
 							__m256i _to;
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm256_cvtepu8_epi32(_from);
 
-								_mm256_store_si256((__m256i*) & dest[i], _to);
+								_mm256_storeu_si256((__m256i*) & dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::has_SSE41)
+						}();//End if
+						else if (tpa::has_SSE41) [&]() TPA_TARGET("sse4.1")
 						{
 							__m128i _from, _to;
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm_cvtepu8_epi32(_from);
 
-								_mm_store_si128((__m128i*) & dest[i], _to);
+								_mm_storeu_si128((__m128i*) & dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 #endif
 					}//End if
 #pragma endregion
@@ -452,44 +576,44 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, int8_t>() && (std::is_same<TO_T, int64_t>() || std::is_same<TO_T, uint64_t>()))
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m128i _from;
 							__m512i _to;
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm512_cvtepu8_epi64(_from);
 
-								_mm512_store_epi64(&dest[i], _to);
+								_mm512_storeu_epi64(&dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m128i _from;
 							__m256i _to;
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm256_cvtepu8_epi64(_from);
 
-								_mm256_store_si256((__m256i*) & dest[i], _to);
+								_mm256_storeu_si256((__m256i*) & dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::has_SSE41)
+						}();//End if
+						else if (tpa::has_SSE41) [&]() TPA_TARGET("sse4.1")
 						{
 							__m128i _from, _to;
 
 							for (; (i + 2uz) < end; i += 2uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm_cvtepu8_epi64(_from);
 
-								_mm_store_si128((__m128i*) & dest[i], _to);
+								_mm_storeu_si128((__m128i*) & dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 #endif
 					}//End if
 #pragma endregion
@@ -497,7 +621,7 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, uint8_t>() && std::is_same<TO_T, float>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m128i _from;
 							__m512i _to;
@@ -505,14 +629,14 @@ namespace tpa{
 
 							for (; (i + 16uz) < end; i += 16uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm512_cvtepu8_epi32(_from);
 								_tof = _mm512_cvtepi32_ps(_to);
 
-								_mm512_store_ps(&dest[i], _tof);
+								_mm512_storeu_ps(&dest[i], _tof);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m128i _from;
 							__m256i _to;
@@ -520,27 +644,27 @@ namespace tpa{
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm256_cvtepu8_epi32(_from);
 								_tof = _mm256_cvtepi32_ps(_to);
 
-								_mm256_store_ps(&dest[i], _tof);
+								_mm256_storeu_ps(&dest[i], _tof);
 							}//End for
-						}//End if
-						else if (tpa::has_SSE41)
+						}();//End if
+						else if (tpa::has_SSE41) [&]() TPA_TARGET("sse4.1")
 						{
 							__m128i _from, _to;
 							__m128 _tof;
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm_cvtepu8_epi32(_from);
 								_tof = _mm_cvtepi32_ps(_to);
 
-								_mm_store_ps(&dest[i], _tof);
+								_mm_storeu_ps(&dest[i], _tof);
 							}//End for
-						}//End if
+						}();//End if
 #endif
 					}//End if
 #pragma endregion
@@ -548,7 +672,7 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, uint8_t>() && std::is_same<TO_T, double>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m128i _from;
 							__m512i _to;
@@ -557,20 +681,20 @@ namespace tpa{
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm512_cvtepu8_epi32(_from);
 
-								_first = _mm256_load_si256((__m256i*) & _to);
-								_second = _mm256_load_si256((__m256i*) & _to + 32);
+								_first = _mm256_loadu_si256((__m256i*) & _to);
+								_second = _mm256_loadu_si256((__m256i*) & _to + 32);
 
 								_tof = _mm512_cvtepi32_pd(_first);
-								_mm512_store_pd(&dest[i], _tof);
+								_mm512_storeu_pd(&dest[i], _tof);
 
 								_tof = _mm512_cvtepi32_pd(_second);
-								_mm512_store_pd(&dest[i + 8], _tof);
+								_mm512_storeu_pd(&dest[i + 8], _tof);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m128i _from, _first, _second;
 							__m256i _to;
@@ -578,39 +702,39 @@ namespace tpa{
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm256_cvtepu8_epi32(_from);
 
-								_first = _mm_load_si128((__m128i*) & _to);
-								_second = _mm_load_si128((__m128i*) & _to + 16);
+								_first = _mm_loadu_si128((__m128i*) & _to);
+								_second = _mm_loadu_si128((__m128i*) & _to + 16);
 
 								_tof = _mm256_cvtepi32_pd(_first);
-								_mm256_store_pd(&dest[i], _tof);
+								_mm256_storeu_pd(&dest[i], _tof);
 
 								_tof = _mm256_cvtepi32_pd(_second);
-								_mm256_store_pd(&dest[i + 4], _tof);
+								_mm256_storeu_pd(&dest[i + 4], _tof);
 							}//End for
-						}//End if
-						else if (tpa::has_SSE41)
+						}();//End if
+						else if (tpa::has_SSE41) [&]() TPA_TARGET("sse4.1")
 						{
 							__m128i _from, _to, _low, _high;
 							__m128d _tof;
 
 							for (; (i + 2uz) < end; i += 2uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm_cvtepu8_epi32(_from);
 
-								_low = _mm_load_si128((__m128i*) & _to);
-								_high = _mm_load_si128((__m128i*) & _to + 8);
+								_low = _mm_loadu_si128((__m128i*) & _to);
+								_high = _mm_loadu_si128((__m128i*) & _to + 8);
 
 								_tof = _mm_cvtepi32_pd(_low);
-								_mm_store_pd(&dest[i], _tof);
+								_mm_storeu_pd(&dest[i], _tof);
 
 								_tof = _mm_cvtepi32_pd(_high);
-								_mm_store_pd(&dest[i + 2], _tof);
+								_mm_storeu_pd(&dest[i + 2], _tof);
 							}//End for
-						}//End if
+						}();//End if
 #endif
 					}//End if
 #pragma endregion
@@ -618,7 +742,7 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, int16_t>() && std::is_same<TO_T, int8_t>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512_ByteWord)
+						if (allow512 && tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 						{
 							__m256i _to;
 							__m512i _from;
@@ -628,9 +752,9 @@ namespace tpa{
 								_from = _mm512_loadu_epi16(&source[i]);
 								_to = _mm512_cvtepi16_epi8(_from);
 
-								_mm256_store_si256((__m256*) & dest[i], _to);
+								_mm256_storeu_si256((__m256i*) & dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 #endif
 					}//End if
 #pragma endregion
@@ -638,44 +762,44 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, int16_t>() && std::is_same<TO_T, int32_t>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m256i _from;
 							__m512i _to;
 
 							for (; (i + 16uz) < end; i += 16uz)
 							{
-								_from = _mm256_load_si256((__m256i*) & source[i]);
+								_from = _mm256_loadu_si256((__m256i*) & source[i]);
 								_to = _mm512_cvtepi16_epi32(_from);
 
-								_mm512_store_epi32(&dest[i], _to);
+								_mm512_storeu_epi32(&dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m128i _from;
 							__m256i _to;
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm256_cvtepi16_epi32(_from);
 
-								_mm256_store_si256((__m256i*) & dest[i], _to);
+								_mm256_storeu_si256((__m256i*) & dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::has_SSE41)
+						}();//End if
+						else if (tpa::has_SSE41) [&]() TPA_TARGET("sse4.1")
 						{
 							__m128i _from, _to;
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm_cvtepi16_epi32(_from);
 
-								_mm_store_si128((__m128i*) & dest[i], _to);
+								_mm_storeu_si128((__m128i*) & dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 #endif
 					}//End if
 #pragma endregion
@@ -683,44 +807,44 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, int16_t>() && std::is_same<TO_T, int64_t>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m128i _from;
 							__m512i _to;
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm512_cvtepi16_epi64(_from);
 
-								_mm512_store_epi64(&dest[i], _to);
+								_mm512_storeu_epi64(&dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m128i _from;
 							__m256i _to;
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm256_cvtepi16_epi64(_from);
 
-								_mm256_store_si256((__m256i*) & dest[i], _to);
+								_mm256_storeu_si256((__m256i*) & dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::has_SSE41)
+						}();//End if
+						else if (tpa::has_SSE41) [&]() TPA_TARGET("sse4.1")
 						{
 							__m128i _from, _to;
 
 							for (; (i + 2uz) < end; i += 2uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm_cvtepi16_epi64(_from);
 
-								_mm_store_si128((__m128i*) & dest[i], _to);
+								_mm_storeu_si128((__m128i*) & dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 #endif
 					}//End if
 #pragma endregion
@@ -728,7 +852,7 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, int16_t>() && std::is_same<TO_T, float>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m256i _from;
 							__m512i _to;
@@ -736,14 +860,14 @@ namespace tpa{
 
 							for (; (i + 16uz) < end; i += 16uz)
 							{
-								_from = _mm256_load_si256((__m256i*) & source[i]);
+								_from = _mm256_loadu_si256((__m256i*) & source[i]);
 								_to = _mm512_cvtepi16_epi32(_from);
 								_tof = _mm512_cvtepi32_ps(_to);
 
-								_mm512_store_ps(&dest[i], _tof);
+								_mm512_storeu_ps(&dest[i], _tof);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m128i _from;
 							__m256i _to;
@@ -751,27 +875,27 @@ namespace tpa{
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm256_cvtepi16_epi32(_from);
 								_tof = _mm256_cvtepi32_ps(_to);
 
-								_mm256_store_ps(&dest[i], _tof);
+								_mm256_storeu_ps(&dest[i], _tof);
 							}//End for
-						}//End if
-						else if (tpa::has_SSE41)
+						}();//End if
+						else if (tpa::has_SSE41) [&]() TPA_TARGET("sse4.1")
 						{
 							__m128i _from, _to;
 							__m128 _tof;
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm_cvtepi16_epi32(_from);
 								_tof = _mm_cvtepi32_ps(_to);
 
-								_mm_store_ps(&dest[i], _tof);
+								_mm_storeu_ps(&dest[i], _tof);
 							}//End for
-						}//End if
+						}();//End if
 #endif
 					}//End if
 #pragma endregion
@@ -779,7 +903,7 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, int16_t>() && std::is_same<TO_T, double>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m256i _from, _first, _second;
 							__m512i _to;
@@ -787,19 +911,19 @@ namespace tpa{
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm256_load_si256((__m256i*) & source[i]);
+								_from = _mm256_loadu_si256((__m256i*) & source[i]);
 								_to = _mm512_cvtepi16_epi32(_from);
 
-								_first = _mm256_load_si256((__m256i*) &_to);
+								_first = _mm256_loadu_si256((__m256i*) &_to);
 								_tof = _mm512_cvtepi32_pd(_first);
-								_mm512_store_pd(&dest[i], _tof);
+								_mm512_storeu_pd(&dest[i], _tof);
 
-								_second = _mm256_load_si256((__m256i*) &_to + 32);
+								_second = _mm256_loadu_si256((__m256i*) &_to + 32);
 								_tof = _mm512_cvtepi32_pd(_first);
-								_mm512_store_pd(&dest[i+8], _tof);
+								_mm512_storeu_pd(&dest[i+8], _tof);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m128i _from, _first, _second;
 							__m256i _to;
@@ -807,32 +931,32 @@ namespace tpa{
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm256_cvtepi16_epi32(_from);
 
-								_first = _mm_load_si128((__m128i*) &_to);
+								_first = _mm_loadu_si128((__m128i*) &_to);
 								_tof = _mm256_cvtepi32_pd(_first);
-								_mm256_store_pd(&dest[i], _tof);
+								_mm256_storeu_pd(&dest[i], _tof);
 
-								_second = _mm_load_si128((__m128i*) &_to + 16);
+								_second = _mm_loadu_si128((__m128i*) &_to + 16);
 								_tof = _mm256_cvtepi32_pd(_first);
-								_mm256_store_pd(&dest[i+4], _tof);
+								_mm256_storeu_pd(&dest[i+4], _tof);
 							}//End for
-						}//End if
-						else if (tpa::has_SSE41)
+						}();//End if
+						else if (tpa::has_SSE41) [&]() TPA_TARGET("sse4.1")
 						{
 							__m128i _from, _to;
 							__m128d _tof;
 
 							for (; (i + 2uz) < end; i += 2uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm_cvtepi16_epi32(_from);
 								_tof = _mm_cvtepi32_pd(_to);
 
-								_mm_store_pd(&dest[i], _tof);
+								_mm_storeu_pd(&dest[i], _tof);
 							}//End for
-						}//End if
+						}();//End if
 #endif
 					}//End if
 #pragma endregion
@@ -840,44 +964,44 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, uint16_t>() && (std::is_same<TO_T, int32_t>() || std::is_same<TO_T, uint32_t>()))
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m256i _from;
 							__m512i _to;
 
 							for (; (i + 16uz) < end; i += 16uz)
 							{
-								_from = _mm256_load_si256((__m256i*) & source[i]);
+								_from = _mm256_loadu_si256((__m256i*) & source[i]);
 								_to = _mm512_cvtepu16_epi32(_from);
 
-								_mm512_store_epi32(&dest[i], _to);
+								_mm512_storeu_epi32(&dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m128i _from;
 							__m256i _to;
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm256_cvtepu16_epi32(_from);
 
-								_mm256_store_si256((__m256i*) & dest[i], _to);
+								_mm256_storeu_si256((__m256i*) & dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::has_SSE41)
+						}();//End if
+						else if (tpa::has_SSE41) [&]() TPA_TARGET("sse4.1")
 						{
 							__m128i _from, _to;
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm_cvtepu16_epi32(_from);
 
-								_mm_store_si128((__m128i*) & dest[i], _to);
+								_mm_storeu_si128((__m128i*) & dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 #endif
 					}//End if
 #pragma endregion
@@ -885,44 +1009,44 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, uint16_t>() && (std::is_same<TO_T, int64_t>() || std::is_same<TO_T, uint64_t>()))
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m128i _from;
 							__m512i _to;
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm512_cvtepu16_epi64(_from);
 
-								_mm512_store_epi64(&dest[i], _to);
+								_mm512_storeu_epi64(&dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m128i _from;
 							__m256i _to;
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm256_cvtepu16_epi64(_from);
 
-								_mm256_store_si256((__m256i*) & dest[i], _to);
+								_mm256_storeu_si256((__m256i*) & dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::has_SSE41)
+						}();//End if
+						else if (tpa::has_SSE41) [&]() TPA_TARGET("sse4.1")
 						{
 							__m128i _from, _to;
 
 							for (; (i + 2uz) < end; i += 2uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm_cvtepu8_epi64(_from);
 
-								_mm_store_si128((__m128i*) & dest[i], _to);
+								_mm_storeu_si128((__m128i*) & dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 #endif
 					}//End if
 #pragma endregion
@@ -930,7 +1054,7 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, uint16_t>() && std::is_same<TO_T, float>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m256i _from;
 							__m512i _to;
@@ -938,14 +1062,14 @@ namespace tpa{
 
 							for (; (i + 16uz) < end; i += 16uz)
 							{
-								_from = _mm256_load_si256((__m256i*) & source[i]);
+								_from = _mm256_loadu_si256((__m256i*) & source[i]);
 								_to = _mm512_cvtepu16_epi32(_from);
 								_tof = _mm512_cvtepi32_ps(_to);
 
-								_mm512_store_ps(&dest[i], _tof);
+								_mm512_storeu_ps(&dest[i], _tof);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m128i _from;
 							__m256i _to;
@@ -953,27 +1077,27 @@ namespace tpa{
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm256_cvtepu16_epi32(_from);
 								_tof = _mm256_cvtepi32_ps(_to);
 
-								_mm256_store_ps(&dest[i], _tof);
+								_mm256_storeu_ps(&dest[i], _tof);
 							}//End for
-						}//End if
-						else if (tpa::has_SSE41)
+						}();//End if
+						else if (tpa::has_SSE41) [&]() TPA_TARGET("sse4.1")
 						{
 							__m128i _from, _to;
 							__m128 _tof;
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm_cvtepu16_epi32(_from);
 								_tof = _mm_cvtepi32_ps(_to);
 
-								_mm_store_ps(&dest[i], _tof);
+								_mm_storeu_ps(&dest[i], _tof);
 							}//End for
-						}//End if
+						}();//End if
 #endif
 					}//End if
 #pragma endregion
@@ -981,7 +1105,7 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, uint16_t>() && std::is_same<TO_T, double>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m256i _from, _first, _second;
 							__m512i _to;
@@ -989,19 +1113,19 @@ namespace tpa{
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm256_load_si256((__m256i*) & source[i]);
+								_from = _mm256_loadu_si256((__m256i*) & source[i]);
 								_to = _mm512_cvtepu16_epi32(_from);
 
-								_first = _mm256_load_si256((__m256i*) & _to);
+								_first = _mm256_loadu_si256((__m256i*) & _to);
 								_tof = _mm512_cvtepi32_pd(_first);
-								_mm512_store_pd(&dest[i], _tof);
+								_mm512_storeu_pd(&dest[i], _tof);
 
-								_second = _mm256_load_si256((__m256i*) & _to + 32);
+								_second = _mm256_loadu_si256((__m256i*) & _to + 32);
 								_tof = _mm512_cvtepi32_pd(_first);
-								_mm512_store_pd(&dest[i + 8], _tof);
+								_mm512_storeu_pd(&dest[i + 8], _tof);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m128i _from, _first, _second;
 							__m256i _to;
@@ -1009,32 +1133,32 @@ namespace tpa{
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm256_cvtepu16_epi32(_from);
 
-								_first = _mm_load_si128((__m128i*) & _to);
+								_first = _mm_loadu_si128((__m128i*) & _to);
 								_tof = _mm256_cvtepi32_pd(_first);
-								_mm256_store_pd(&dest[i], _tof);
+								_mm256_storeu_pd(&dest[i], _tof);
 
-								_second = _mm_load_si128((__m128i*) & _to + 16);
+								_second = _mm_loadu_si128((__m128i*) & _to + 16);
 								_tof = _mm256_cvtepi32_pd(_first);
-								_mm256_store_pd(&dest[i + 4], _tof);
+								_mm256_storeu_pd(&dest[i + 4], _tof);
 							}//End for
-						}//End if
-						else if (tpa::has_SSE41)
+						}();//End if
+						else if (tpa::has_SSE41) [&]() TPA_TARGET("sse4.1")
 						{
 							__m128i _from, _to;
 							__m128d _tof;
 
 							for (; (i + 2uz) < end; i += 2uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm_cvtepu16_epi32(_from);
 								_tof = _mm_cvtepi32_pd(_to);
 
-								_mm_store_pd(&dest[i], _tof);
+								_mm_storeu_pd(&dest[i], _tof);
 							}//End for
-						}//End if
+						}();//End if
 #endif
 					}//End if
 #pragma endregion
@@ -1042,19 +1166,19 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, int32_t>() && std::is_same<TO_T, int8_t>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m128i _to;
 							__m512i _from;
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm512_load_epi32(&source[i]);
+								_from = _mm512_loadu_epi32(&source[i]);
 								_to = _mm512_cvtepi32_epi8(_from);
 
-								_mm_store_si128((__m128*) &dest[i], _to);
+								_mm_storeu_si128((__m128i*) &dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 #endif
 					}//End if
 #pragma endregion
@@ -1062,19 +1186,19 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, int32_t>() && std::is_same<TO_T, int16_t>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m256i _to;
 							__m512i _from;
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm512_load_epi32(&source[i]);
+								_from = _mm512_loadu_epi32(&source[i]);
 								_to = _mm512_cvtepi32_epi16(_from);
 
-								_mm256_store_si256((__m256*) &dest[i], _to);
+								_mm256_storeu_si256((__m256i*) &dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 #endif
 					}//End if
 #pragma endregion
@@ -1082,44 +1206,44 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, int32_t>() && std::is_same<TO_T, int64_t>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m256i _from;
 							__m512i _to;
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm256_load_si256((__m256i*) & source[i]);
+								_from = _mm256_loadu_si256((__m256i*) & source[i]);
 								_to = _mm512_cvtepi32_epi64(_from);
 
-								_mm512_store_epi64(&dest[i], _to);
+								_mm512_storeu_epi64(&dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m128i _from;
 							__m256i _to;
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm256_cvtepi32_epi64(_from);
 
-								_mm256_store_si256((__m256i*) & dest[i], _to);
+								_mm256_storeu_si256((__m256i*) & dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::has_SSE41)
+						}();//End if
+						else if (tpa::has_SSE41) [&]() TPA_TARGET("sse4.1")
 						{
 							__m128i _from, _to;
 
 							for (; (i + 2uz) < end; i += 2uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm_cvtepi32_epi64(_from);
 
-								_mm_store_si128((__m128i*) & dest[i], _to);
+								_mm_storeu_si128((__m128i*) & dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 #endif
 					}//End if
 #pragma endregion
@@ -1127,32 +1251,32 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, int32_t>() && std::is_same<TO_T, float>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m512i _from;
 							__m512 _to;
 
 							for (; (i + 16uz) < end; i += 16uz)
 							{
-								_from = _mm512_load_epi32(&source[i]);
+								_from = _mm512_loadu_epi32(&source[i]);
 								_to = _mm512_cvtepi32_ps(_from);
 
-								_mm512_store_ps(&dest[i], _to);
+								_mm512_storeu_ps(&dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m256i _from;
 							__m256 _to;
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm256_load_si256((__m256i*) & source[i]);
+								_from = _mm256_loadu_si256((__m256i*) & source[i]);
 								_to = _mm256_cvtepi32_ps(_from);
 
-								_mm256_store_ps(&dest[i], _to);
+								_mm256_storeu_ps(&dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 						else if (tpa::has_SSE2)
 						{
 							__m128i _from;
@@ -1160,10 +1284,10 @@ namespace tpa{
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm_cvtepi32_ps(_from);
 
-								_mm_store_ps(&dest[i], _to);
+								_mm_storeu_ps(&dest[i], _to);
 							}//End for
 						}//End if
 #endif
@@ -1173,32 +1297,32 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, int32_t>() && std::is_same<TO_T, double>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m256i _from;
 							__m512d _to;
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm256_load_si256((__m256i*) & source[i]);
+								_from = _mm256_loadu_si256((__m256i*) & source[i]);
 								_to = _mm512_cvtepi32_pd(_from);
 
-								_mm512_store_pd(&dest[i], _to);
+								_mm512_storeu_pd(&dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m128i _from;
 							__m256d _to;
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm256_cvtepi32_pd(_from);
 
-								_mm256_store_pd(&dest[i], _to);
+								_mm256_storeu_pd(&dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 						else if (tpa::has_SSE2)
 						{
 							__m128i _from;
@@ -1206,10 +1330,10 @@ namespace tpa{
 
 							for (; (i + 2uz) < end; i += 2uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm_cvtepi32_pd(_from);
 
-								_mm_store_pd(&dest[i], _to);
+								_mm_storeu_pd(&dest[i], _to);
 							}//End for
 						}//End if
 #endif
@@ -1219,44 +1343,44 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, uint32_t>() && std::is_same<TO_T, int64_t>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m256i _from;
 							__m512i _to;
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm256_load_si256((__m256i*) & source[i]);
+								_from = _mm256_loadu_si256((__m256i*) & source[i]);
 								_to = _mm512_cvtepu32_epi64(_from);
 
-								_mm512_store_epi64(&dest[i], _to);
+								_mm512_storeu_epi64(&dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m128i _from;
 							__m256i _to;
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm256_cvtepu32_epi64(_from);
 
-								_mm256_store_si256((__m256i*) & dest[i], _to);
+								_mm256_storeu_si256((__m256i*) & dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::has_SSE41)
+						}();//End if
+						else if (tpa::has_SSE41) [&]() TPA_TARGET("sse4.1")
 						{
 							__m128i _from, _to;
 
 							for (; (i + 2uz) < end; i += 2uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm_cvtepu32_epi64(_from);
 
-								_mm_store_si128((__m128i*) & dest[i], _to);
+								_mm_storeu_si128((__m128i*) & dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 #endif
 					}//End if
 #pragma endregion
@@ -1264,32 +1388,32 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, uint32_t>() && std::is_same<TO_T, float>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m512i _from;
 							__m512 _to;
 
 							for (; (i + 16uz) < end; i += 16uz)
 							{
-								_from = _mm512_load_epi32(&source[i]);
+								_from = _mm512_loadu_epi32(&source[i]);
 								_to = _mm512_cvtepu32_ps(_from);
 
-								_mm512_store_ps(&dest[i], _to);
+								_mm512_storeu_ps(&dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m256i _from;
 							__m256 _to;
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm256_load_si256((__m256i*) & source[i]);
+								_from = _mm256_loadu_si256((__m256i*) & source[i]);
 								_to = _mm256_cvtepi32_ps(_from);
 
-								_mm256_store_ps(&dest[i], _to);
+								_mm256_storeu_ps(&dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 						else if (tpa::has_SSE2)
 						{
 							__m128i _from;
@@ -1297,10 +1421,10 @@ namespace tpa{
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm_cvtepi32_ps(_from);
 
-								_mm_store_ps(&dest[i], _to);
+								_mm_storeu_ps(&dest[i], _to);
 							}//End for
 						}//End if
 #endif
@@ -1310,32 +1434,32 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, uint32_t>() && std::is_same<TO_T, double>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m256i _from;
 							__m512d _to;
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm256_load_si256((__m256i*) & source[i]);
+								_from = _mm256_loadu_si256((__m256i*) & source[i]);
 								_to = _mm512_cvtepu32_pd(_from);
 
-								_mm512_store_pd(&dest[i], _to);
+								_mm512_storeu_pd(&dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m128i _from;
 							__m256d _to;
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm256_cvtepi32_pd(_from);
 
-								_mm256_store_pd(&dest[i], _to);
+								_mm256_storeu_pd(&dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 						else if (tpa::has_SSE2)
 						{
 							__m128i _from;
@@ -1343,10 +1467,10 @@ namespace tpa{
 
 							for (; (i + 2uz) < end; i += 2uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = _mm_cvtepi32_pd(_from);
 
-								_mm_store_pd(&dest[i], _to);
+								_mm_storeu_pd(&dest[i], _to);
 							}//End for
 						}//End if
 #endif
@@ -1356,19 +1480,19 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, int64_t>() && std::is_same<TO_T, int8_t>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m128i _to;
 							__m512i _from;
 
 							for (; (i + 2uz) < end; i += 2uz)
 							{
-								_from = _mm512_load_epi64(&source[i]);
+								_from = _mm512_loadu_epi64(&source[i]);
 								_to = _mm512_cvtepi64_epi8(_from);
 
-								_mm_store_si128((__m128*) & dest[i], _to);
+								_mm_storeu_si128((__m128i*) & dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 #endif
 					}//End if
 #pragma endregion
@@ -1376,19 +1500,19 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, int64_t>() && std::is_same<TO_T, int16_t>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m128i _to;
 							__m512i _from;
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm512_load_epi32(&source[i]);
+								_from = _mm512_loadu_epi32(&source[i]);
 								_to = _mm512_cvtepi64_epi16(_from);
 
-								_mm_store_si128((__m128*) &dest[i], _to);
+								_mm_storeu_si128((__m128i*) &dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 #endif
 					}//End if
 #pragma endregion
@@ -1396,19 +1520,19 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, int64_t>() && std::is_same<TO_T, int32_t>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m256i _to;
 							__m512i _from;
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm512_load_epi64(&source[i]);
+								_from = _mm512_loadu_epi64(&source[i]);
 								_to = _mm512_cvtepi64_epi32(_from);
 
-								_mm512_store_epi32(&dest[i], _to);
+								_mm512_storeu_epi32(&dest[i], _to);
 							}//End for
-						}//End if						
+						}();//End if						
 #endif
 					}//End if
 #pragma endregion
@@ -1416,19 +1540,19 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, int64_t>() && std::is_same<TO_T, float>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512_DWQW)
+						if (allow512 && tpa::hasAVX512_DWQW) [&]() TPA_TARGET("avx512dq")
 						{
 							__m512i _from;
 							__m256 _to;
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm512_load_epi64(&source[i]);
+								_from = _mm512_loadu_epi64(&source[i]);
 								_to = _mm512_cvtepi64_ps(_from);
 
-								_mm512_store_ps(&dest[i], _to);
+								_mm512_storeu_ps(&dest[i], _to);
 							}//End for
-						}//End if						
+						}();//End if						
 #endif
 					}//End if
 #pragma endregion
@@ -1436,32 +1560,32 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, int64_t>() && std::is_same<TO_T, double>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512_DWQW)
+						if (allow512 && tpa::hasAVX512_DWQW) [&]() TPA_TARGET("avx512dq")
 						{
 							__m512i _from;
 							__m512d _to;
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm512_load_epi64(&source[i]);
+								_from = _mm512_loadu_epi64(&source[i]);
 								_to = _mm512_cvtepi64_pd(_from);
 
-								_mm512_store_pd(&dest[i], _to);
+								_mm512_storeu_pd(&dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m256i _from;
 							__m256d _to;
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm256_load_si256((__m256i*) & source[i]);
+								_from = _mm256_loadu_si256((__m256i*) & source[i]);
 								_to = tpa::simd::_mm256_cvtepi64_pd(_from);
 
-								_mm256_store_pd(&dest[i], _to);
+								_mm256_storeu_pd(&dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 						else if (tpa::has_SSE2)
 						{
 							__m128i _from;
@@ -1469,10 +1593,10 @@ namespace tpa{
 
 							for (; (i + 2uz) < end; i += 2uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = tpa::simd::_mm_cvtepi64_pd(_from);
 
-								_mm_store_pd(&dest[i], _to);
+								_mm_storeu_pd(&dest[i], _to);
 							}//End for
 						}//End if
 #endif
@@ -1482,32 +1606,32 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, uint64_t>() && std::is_same<TO_T, double>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512_DWQW)
+						if (allow512 && tpa::hasAVX512_DWQW) [&]() TPA_TARGET("avx512dq")
 						{
 							__m512i _from;
 							__m512d _to;
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm512_load_epi64(&source[i]);
+								_from = _mm512_loadu_epi64(&source[i]);
 								_to = _mm512_cvtepu64_pd(_from);
 
-								_mm512_store_pd(&dest[i], _to);
+								_mm512_storeu_pd(&dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m256i _from;
 							__m256d _to;
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm256_load_si256((__m256i*) & source[i]);
+								_from = _mm256_loadu_si256((__m256i*) & source[i]);
 								_to = tpa::simd::_mm256_cvtepu64_pd(_from);
 
-								_mm256_store_pd(&dest[i], _to);
+								_mm256_storeu_pd(&dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 						else if (tpa::has_SSE2)
 						{
 							__m128i _from;
@@ -1515,10 +1639,10 @@ namespace tpa{
 
 							for (; (i + 2uz) < end; i += 2uz)
 							{
-								_from = _mm_load_si128((__m128i*) & source[i]);
+								_from = _mm_loadu_si128((__m128i*) & source[i]);
 								_to = tpa::simd::_mm_cvtepu64_pd(_from);
 
-								_mm_store_pd(&dest[i], _to);
+								_mm_storeu_pd(&dest[i], _to);
 							}//End for
 						}//End if
 #endif
@@ -1528,32 +1652,32 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, float>() && std::is_same<TO_T, int32_t>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m512i _to;
 							__m512 _from;
 
 							for (; (i + 16uz) < end; i += 16uz)
 							{
-								_from = _mm512_load_ps(&source[i]);
+								_from = _mm512_loadu_ps(&source[i]);
 								_to = _mm512_cvtps_epi32(_from);
 
-								_mm512_store_epi32(&dest[i], _to);
+								_mm512_storeu_epi32(&dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX)
+						}();//End if
+						else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
 						{
 							__m256i _to;
 							__m256 _from;
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm256_load_ps(&source[i]);
+								_from = _mm256_loadu_ps(&source[i]);
 								_to = _mm256_cvtps_epi32(_from);
 
-								_mm256_store_si256((__m256i*)& dest[i], _to);
+								_mm256_storeu_si256((__m256i*)& dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 						else if (tpa::has_SSE2)
 						{
 							__m128 _from;
@@ -1561,10 +1685,10 @@ namespace tpa{
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm_load_ps(&source[i]);
+								_from = _mm_loadu_ps(&source[i]);
 								_to = _mm_cvtps_epi32(_from);
 
-								_mm_store_si128((__m128i*) &dest[i], _to);
+								_mm_storeu_si128((__m128i*) &dest[i], _to);
 							}//End for
 						}//End if
 #endif
@@ -1574,43 +1698,43 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, float>() && std::is_same<TO_T, int64_t>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 						{
 							__m512i _to;
 							__m512 _from;
 
 							for (; (i + 16uz) < end; i += 16uz)
 							{
-								_from = _mm512_load_ps(&source[i]);
+								_from = _mm512_loadu_ps(&source[i]);
 								_to = _mm512_cvtps_epu32(_from);
 
-								_mm512_store_epi32(&dest[i], _to);
+								_mm512_storeu_epi32(&dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX)
+						}();//End if
+						else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
 						{
 							__m256i _to;
 							__m256 _from;
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm256_load_ps(&source[i]);
+								_from = _mm256_loadu_ps(&source[i]);
 								_to = _mm256_cvtps_epi32(_from);
 
-								_mm256_store_si256((__m256i*) & dest[i], _to);
+								_mm256_storeu_si256((__m256i*) & dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 						else if (tpa::has_SSE2)
 						{
-							__m128i _from;
-							__m128d _to;
+							__m128 _from;
+							__m128i _to;
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm_load_ps(&source[i]);
+								_from = _mm_loadu_ps(&source[i]);
 								_to = _mm_cvtps_epi32(_from);
 
-								_mm_store_si128((__m128*) & dest[i], _to);
+								_mm_storeu_si128((__m128i*) & dest[i], _to);
 							}//End for
 						}//End if
 #endif
@@ -1620,32 +1744,32 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, double>() && std::is_same<TO_T, int64_t>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512_DWQW)
+						if (allow512 && tpa::hasAVX512_DWQW) [&]() TPA_TARGET("avx512dq")
 						{
 							__m512i _to;
 							__m512d _from;
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm512_load_pd(&source[i]);
+								_from = _mm512_loadu_pd(&source[i]);
 								_to = _mm512_cvtpd_epi64(_from);
 
-								_mm512_store_epi64(&dest[i], _to);
+								_mm512_storeu_epi64(&dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m256i _to;
 							__m256d _from;
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm256_load_pd(& source[i]);
+								_from = _mm256_loadu_pd(& source[i]);
 								_to = tpa::simd::_mm256_cvtpd_epi64(_from);
 
-								_mm256_store_si256((__m256i*)& dest[i], _to);
+								_mm256_storeu_si256((__m256i*)& dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 						else if (tpa::has_SSE2)
 						{
 							__m128i _to;
@@ -1653,10 +1777,10 @@ namespace tpa{
 
 							for (; (i + 2uz) < end; i += 2uz)
 							{
-								_from = _mm_load_pd(&source[i]);
+								_from = _mm_loadu_pd(&source[i]);
 								_to = tpa::simd::_mm_cvtpd_epi64(_from);
 
-								_mm_store_si128((__m128i*)& dest[i], _to);
+								_mm_storeu_si128((__m128i*)& dest[i], _to);
 							}//End for
 						}//End if
 #endif
@@ -1666,32 +1790,32 @@ namespace tpa{
 					if constexpr (std::is_same<FROM_T, double>() && std::is_same<TO_T, uint64_t>())
 					{
 #ifdef TPA_X86_64
-						if (tpa::hasAVX512_DWQW)
+						if (allow512 && tpa::hasAVX512_DWQW) [&]() TPA_TARGET("avx512dq")
 						{
 							__m512i _to;
 							__m512d _from;
 
 							for (; (i + 8uz) < end; i += 8uz)
 							{
-								_from = _mm512_load_pd(&source[i]);
+								_from = _mm512_loadu_pd(&source[i]);
 								_to = _mm512_cvtpd_epu64(_from);
 
-								_mm512_store_epi64(&dest[i], _to);
+								_mm512_storeu_epi64(&dest[i], _to);
 							}//End for
-						}//End if
-						else if (tpa::hasAVX2)
+						}();//End if
+						else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 						{
 							__m256i _to;
 							__m256d _from;
 
 							for (; (i + 4uz) < end; i += 4uz)
 							{
-								_from = _mm256_load_pd(&source[i]);
+								_from = _mm256_loadu_pd(&source[i]);
 								_to = tpa::simd::_mm256_cvtpd_epu64(_from);
 
-								_mm256_store_si256((__m256i*) &dest[i], _to);
+								_mm256_storeu_si256((__m256i*) &dest[i], _to);
 							}//End for
-						}//End if
+						}();//End if
 						else if (tpa::has_SSE2)
 						{
 							__m128i _to;
@@ -1699,16 +1823,27 @@ namespace tpa{
 
 							for (; (i + 2uz) < end; i += 2uz)
 							{
-								_from = _mm_load_pd(&source[i]);
+								_from = _mm_loadu_pd(&source[i]);
 								_to = tpa::simd::_mm_cvtpd_epu64(_from);
 
-								_mm_store_si128((__m128i*) &dest[i], _to);
+								_mm_storeu_si128((__m128i*) &dest[i], _to);
 							}//End for
 						}//End if
 #endif
 					}//End if
 #pragma endregion
 
+#pragma region neon
+#ifdef TPA_NEON
+					if constexpr (tpa_convert_private::has_convert_neon<FROM_T, TO_T>)
+					{
+						if (tpa::hasNeon)
+						{
+							tpa_convert_private::convert_neon<FROM_T, TO_T>(i, end, source.data(), dest.data());
+						}//End if
+					}//End if
+#endif
+#pragma endregion
 #pragma region generic
 					for (; i < end; ++i)
 					{
@@ -1734,14 +1869,6 @@ namespace tpa{
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::static_convert: " << ex.what() << "\n";
-			std::cerr << "tpa::simd::static_convert will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -0,0 +1,366 @@
+#pragma once
+/*
+*	Runtime kernel dispatch for TPA Library
+*	By: David Aaron Braun
+*	2022-08-09
+*	Selects the best kernel for the host once instead of on every call
+*/
+
+/*
+*           Copyright David Aaron Braun 2021 - .
+*   Distributed under the Boost Software License, Version 1.0.
+*       (See accompanying file LICENSE_1_0.txt or copy at
+*           https://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include <cstdint>
+#include <cstdlib>
+#include <string_view>
+
+#include "../size_t_lit.hpp"
+#include "../tpa_macros.hpp"
+#include "../InstructionSet.hpp"
+#include "../topology.hpp"
+
+/// <summary>
+/// TPA SIMD Utility Functions
+/// </summary>
+namespace tpa::simd {
+
+	/// <summary>
+	/// <para>Instruction set tiers which TPA compiles kernels for, ordered from least to most capable.</para>
+	/// <para>SSE41 = SSE4.1 &amp; SSE4.2</para>
+	/// <para>AVX2 = AVX, AVX2 &amp; FMA</para>
+	/// <para>AVX512 = AVX-512 F, BW, DQ &amp; VL</para>
+	/// <para>NEON = ARM NEON (128-bit)</para>
+	/// </summary>
+	enum class isa : uint8_t
+	{
+		SCALAR = 0,
+		SSE41,
+		AVX2,
+		AVX512,
+		NEON
+	};
+
+	/// <summary>
+	/// <para>Returns the most capable tpa::simd::isa supported by this hardware.</para>
+	/// <para>Prefer tpa::simd::runtime_isa which is resolved once at startup.</para>
+	/// </summary>
+	/// <returns></returns>
+	[[nodiscard]] inline isa detect_isa() noexcept
+	{
+#ifdef TPA_X86_64
+		if (tpa::hasAVX512 && tpa::hasAVX512_ByteWord && tpa::hasAVX512_DWQW && tpa::hasAVX512_VL)
+		{
+			return isa::AVX512;
+		}//End if
+		else if (tpa::hasAVX2 && tpa::hasFMA)
+		{
+			return isa::AVX2;
+		}//End if
+		else if (tpa::has_SSE41 && tpa::has_SSE42)
+		{
+			return isa::SSE41;
+		}//End if
+#elif defined(TPA_NEON)
+		if (tpa::hasNeon)
+		{
+			return isa::NEON;
+		}//End if
+#endif
+		return isa::SCALAR;
+	}//End of detect_isa
+
+	/// <summary>
+	/// <para>The most capable tpa::simd::isa supported by this hardware, resolved once per program.</para>
+	/// </summary>
+	inline const isa runtime_isa = tpa::simd::detect_isa();
+
+	/// <summary>
+	/// <para>How TPA chooses between the 512-bit and 256-bit kernels on hardware with AVX-512.</para>
+	/// <para>AUTO = 256-bit on CPUs which down-clock for AVX-512 and for small inputs, otherwise 512-bit</para>
+	/// <para>ALWAYS = Always use 512-bit kernels</para>
+	/// <para>NEVER = Always use 256-bit kernels</para>
+	/// <para>Set with the environment variable TPA_AVX512 = auto | always | never</para>
+	/// </summary>
+	enum class avx512_policy : uint8_t
+	{
+		AUTO = 0,
+		ALWAYS,
+		NEVER
+	};
+
+	/// <summary>
+	/// <para>Returns true if this CPU lowers its clock speed while running 512-bit instructions (AVX-512 frequency licenses).</para>
+	/// <para>Short bursts of 512-bit work on these CPUs slow down the scalar code which follows them.</para>
+	/// <para>Intel Skylake-SP/X, Cascade Lake, Cooper Lake, Cannon Lake, Ice Lake, Tiger Lake &amp; Rocket Lake.</para>
+	/// </summary>
+	/// <returns></returns>
+	[[nodiscard]] inline bool avx512_downclocks() noexcept
+	{
+#ifdef TPA_X86_64
+		if (!tpa::runtime_instruction_set.IsIntel() || tpa::runtime_instruction_set.Family() != 0x6u)
+		{
+			return false;
+		}//End if
+
+		switch (tpa::runtime_instruction_set.Model())
+		{
+		case 0x55u://Skylake-SP/X, Cascade Lake, Cooper Lake
+		case 0x66u://Cannon Lake
+		case 0x6Au://Ice Lake-SP
+		case 0x6Cu://Ice Lake-D
+		case 0x7Du://Ice Lake
+		case 0x7Eu://Ice Lake
+		case 0x8Cu://Tiger Lake
+		case 0x8Du://Tiger Lake
+		case 0xA7u://Rocket Lake
+			return true;
+		default:
+			return false;
+		}//End switch
+#else
+		return false;
+#endif
+	}//End of avx512_downclocks
+
+	/// <summary>
+	/// <para>Reads tpa::simd::avx512_policy from the environment variable TPA_AVX512.</para>
+	/// <para>Accepts always, on, 1 or 512 and never, off, 0 or 256, anything else is AUTO.</para>
+	/// </summary>
+	/// <returns></returns>
+	[[nodiscard]] inline avx512_policy read_avx512_policy() noexcept
+	{
+#ifdef _MSC_VER
+#pragma warning(suppress : 4996)
+#endif
+		const char* env = std::getenv("TPA_AVX512");
+
+		if (env == nullptr)
+		{
+			return avx512_policy::AUTO;
+		}//End if
+
+		const std::string_view v = env;
+
+		if (v == "always" || v == "ALWAYS" || v == "on" || v == "1" || v == "512")
+		{
+			return avx512_policy::ALWAYS;
+		}//End if
+		else if (v == "never" || v == "NEVER" || v == "off" || v == "0" || v == "256")
+		{
+			return avx512_policy::NEVER;
+		}//End if
+
+		return avx512_policy::AUTO;
+	}//End of read_avx512_policy
+
+	/// <summary>
+	/// <para>Reads the smallest input in bytes which uses 512-bit kernels under avx512_policy::AUTO from the environment variable TPA_AVX512_MIN_BYTES.</para>
+	/// <para>Defaults to 32 KiB, inputs smaller than this finish before the wider vectors pay for themselves.</para>
+	/// </summary>
+	/// <returns></returns>
+	[[nodiscard]] inline size_t read_avx512_min_bytes() noexcept
+	{
+#ifdef _MSC_VER
+#pragma warning(suppress : 4996)
+#endif
+		const char* env = std::getenv("TPA_AVX512_MIN_BYTES");
+
+		if (env == nullptr || *env == '\0')
+		{
+			return 32768uz;
+		}//End if
+
+		return static_cast<size_t>(std::strtoull(env, nullptr, 10));
+	}//End of read_avx512_min_bytes
+
+	/// <summary>
+	/// <para>The tpa::simd::avx512_policy for this program, read once at startup.</para>
+	/// </summary>
+	inline const avx512_policy runtime_avx512_policy = tpa::simd::read_avx512_policy();
+
+	/// <summary>
+	/// <para>Inputs smaller than this many bytes use 256-bit kernels under avx512_policy::AUTO.</para>
+	/// </summary>
+	inline const size_t avx512_min_bytes = tpa::simd::read_avx512_min_bytes();
+
+	/// <summary>
+	/// <para>True if this CPU down-clocks for AVX-512, detected once at startup.</para>
+	/// </summary>
+	inline const bool runtime_avx512_downclocks = tpa::simd::avx512_downclocks();
+
+	/// <summary>
+	/// <para>Reads the smallest destination in bytes which TPA writes with non-temporal (streaming) stores from the environment variable TPA_STREAM_MIN_BYTES.</para>
+	/// <para>Defaults to the size of the last level cache reported by tpa::cpu::topology(), a larger destination would evict all of it anyway. 32 MiB if the cache size is unknown.</para>
+	/// </summary>
+	/// <returns></returns>
+	[[nodiscard]] inline size_t read_stream_min_bytes() noexcept
+	{
+#ifdef _MSC_VER
+#pragma warning(suppress : 4996)
+#endif
+		const char* env = std::getenv("TPA_STREAM_MIN_BYTES");
+
+		if (env == nullptr || *env == '\0')
+		{
+			const tpa::cpu::cache* llc = tpa::cpu::topology().last_level_cache();
+
+			return (llc != nullptr && llc->size != 0uz) ? llc->size : 32uz * 1024uz * 1024uz;
+		}//End if
+
+		return static_cast<size_t>(std::strtoull(env, nullptr, 10));
+	}//End of read_stream_min_bytes
+
+	/// <summary>
+	/// <para>Destinations of at least this many bytes are written with non-temporal stores which bypass the cache.</para>
+	/// <para>This is the default of the 'stream_threshold' parameter of tpa::copy, tpa::fill, tpa::iota and tpa::generate.</para>
+	/// <para>Pass 0 to always stream or SIZE_MAX to never stream.</para>
+	/// </summary>
+	inline const size_t stream_min_bytes = tpa::simd::read_stream_min_bytes();
+
+	/// <summary>
+	/// <para>Reads the size in bytes of a tile of tpa::exec::BLOCKED from the environment variable TPA_TILE_BYTES.</para>
+	/// <para>Defaults to half of the L2 cache reported by tpa::cpu::topology() so that every stream of a tile fits next to what the hardware prefetchers bring in. 256 KiB if the cache size is unknown.</para>
+	/// </summary>
+	/// <returns></returns>
+	[[nodiscard]] inline size_t read_tile_bytes() noexcept
+	{
+#ifdef _MSC_VER
+#pragma warning(suppress : 4996)
+#endif
+		const char* env = std::getenv("TPA_TILE_BYTES");
+
+		if (env == nullptr || *env == '\0')
+		{
+			const tpa::cpu::cache* l2 = tpa::cpu::topology().data_cache(2u);
+
+			return (l2 != nullptr && l2->size != 0uz) ? (l2->size / 2uz) : 256uz * 1024uz;
+		}//End if
+
+		return static_cast<size_t>(std::strtoull(env, nullptr, 10));
+	}//End of read_tile_bytes
+
+	/// <summary>
+	/// <para>The bytes of all streams together which one tile of tpa::exec::BLOCKED covers.</para>
+	/// </summary>
+	inline const size_t tile_bytes = tpa::simd::read_tile_bytes();
+
+	/// <summary>
+	/// <para>Returns the number of elements in a tile of tpa::exec::BLOCKED when 'streams' containers of T are read or written together.</para>
+	/// <para>Always a non-zero multiple of 64 elements so that tiles of an aligned container start on a 64-byte boundary.</para>
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	/// <param name="streams"></param>
+	/// <returns></returns>
+	template<typename T>
+	[[nodiscard]] inline size_t tile_elements(const size_t streams) noexcept
+	{
+		const size_t n = (tile_bytes / (streams * sizeof(T))) / 64uz * 64uz;
+
+		return (n != 0uz) ? n : 64uz;
+	}//End of tile_elements
+
+	/// <summary>
+	/// <para>Returns true if tpa::simd::runtime_avx512_policy allows 512-bit instructions for an input of 'bytes' bytes.</para>
+	/// <para>The hand-written kernels which test the tpa::hasAVX512 flags themselves (calculate, compare, exp and static_convert) also test this, so TPA_AVX512 applies to them as well.</para>
+	/// </summary>
+	/// <param name="bytes"></param>
+	/// <returns></returns>
+	[[nodiscard]] inline bool avx512_allowed(const size_t bytes) noexcept
+	{
+		switch (tpa::simd::runtime_avx512_policy)
+		{
+		case avx512_policy::ALWAYS:
+			return true;
+		case avx512_policy::NEVER:
+			return false;
+		default:
+			return !tpa::simd::runtime_avx512_downclocks && bytes >= tpa::simd::avx512_min_bytes;
+		}//End switch
+	}//End of avx512_allowed
+
+	/// <summary>
+	/// <para>Returns the tpa::simd::isa to use for an input of 'bytes' bytes.</para>
+	/// <para>Identical to tpa::simd::runtime_isa except on AVX-512 hardware, where tpa::simd::runtime_avx512_policy may select the 256-bit (AVX2) kernels instead.</para>
+	/// </summary>
+	/// <param name="bytes"></param>
+	/// <returns></returns>
+	[[nodiscard]] inline isa preferred_isa(const size_t bytes) noexcept
+	{
+		if (tpa::simd::runtime_isa != isa::AVX512)
+		{
+			return tpa::simd::runtime_isa;
+		}//End if
+
+		return tpa::simd::avx512_allowed(bytes) ? isa::AVX512 : isa::AVX2;
+	}//End of preferred_isa
+
+	/// <summary>
+	/// <para>Table of function pointers, one per tpa::simd::isa, for a single kernel.</para>
+	/// <para>Missing entries (nullptr) fall back to the next less capable entry, 'scalar' must always be provided.</para>
+	/// <para>Build the table once and keep it, then resolve it per call, e.g.</para>
+	/// <para>static const auto kernels = tpa::simd::kernel_table&lt;void(size_t, size_t, T*)&gt;{ .scalar = &amp;k_scalar, .avx2 = &amp;k_avx2 };</para>
+	/// <para>kernels.resolve_for((end - beg) * sizeof(T))(beg, end, arr);</para>
+	/// <para>Mark each kernel with TPA_TARGET_SSE41, TPA_TARGET_AVX2 or TPA_TARGET_AVX512 so that GCC and Clang compile it for that instruction set.</para>
+	/// </summary>
+	/// <typeparam name="FN">A function type, e.g. void(size_t, size_t, float*)</typeparam>
+	template<typename FN>
+	requires std::is_function<FN>::value
+	struct kernel_table
+	{
+		FN* scalar = nullptr;
+		FN* sse41 = nullptr;
+		FN* avx2 = nullptr;
+		FN* avx512 = nullptr;
+		FN* neon = nullptr;
+
+		/// <summary>
+		/// <para>Returns the kernel for tpa::simd::runtime_isa.</para>
+		/// </summary>
+		/// <returns></returns>
+		[[nodiscard]] constexpr FN* resolve() const noexcept
+		{
+			return resolve(tpa::simd::runtime_isa);
+		}//End of resolve
+
+		/// <summary>
+		/// <para>Returns the kernel for an input of 'bytes' bytes, see tpa::simd::preferred_isa.</para>
+		/// </summary>
+		/// <param name="bytes"></param>
+		/// <returns></returns>
+		[[nodiscard]] FN* resolve_for(const size_t bytes) const noexcept
+		{
+			return resolve(tpa::simd::preferred_isa(bytes));
+		}//End of resolve_for
+
+		/// <summary>
+		/// <para>Returns the kernel for 'level' or the best kernel below it.</para>
+		/// </summary>
+		/// <param name="level"></param>
+		/// <returns></returns>
+		[[nodiscard]] constexpr FN* resolve(const isa level) const noexcept
+		{
+			if (level == isa::NEON && neon != nullptr)
+			{
+				return neon;
+			}//End if
+			if (level >= isa::AVX512 && level != isa::NEON && avx512 != nullptr)
+			{
+				return avx512;
+			}//End if
+			if (level >= isa::AVX2 && level != isa::NEON && avx2 != nullptr)
+			{
+				return avx2;
+			}//End if
+			if (level >= isa::SSE41 && level != isa::NEON && sse41 != nullptr)
+			{
+				return sse41;
+			}//End if
+
+			return scalar;
+		}//End of resolve
+	};//End of kernel_table
+}//End of namespace
@@ -33,6 +33,7 @@
 #include "../tpa_concepts.hpp"
 #include "../InstructionSet.hpp"
 #include "simd.hpp"
+#include "dispatch.hpp"
 
 #undef min
 #undef max
@@ -87,13 +88,18 @@ namespace tpa{
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::exp: " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::exp will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
 
+			//tpa::simd::runtime_avx512_policy may turn the 512-bit branches off for this input
+			const bool allow512 = tpa::simd::avx512_allowed(smallest * sizeof(T));
+
 			std::vector<std::shared_future<uint32_t>> results;
 			results.reserve(tpa::nThreads);
 
@@ -102,7 +108,7 @@ namespace tpa{
 			for (const auto& sec : sections)
 			{
 				//Launch lambda from multiple threads
-				temp = tpa::tp->addTask([&source, &dest, &sec]()
+				temp = tpa::tp->addTask([&source, &dest, &sec, allow512]()
 					{
 						const size_t beg = sec.first;
 						const size_t end = sec.second;
@@ -111,44 +117,44 @@ namespace tpa{
 #pragma region float
 			if constexpr (std::is_same<T, float>() && std::is_same<RES, float>())
 			{
-#ifdef TPA_X86_64
-				if (tpa::hasAVX512)
+#if defined(TPA_X86_64) && defined(TPA_HAS_SVML)
+				if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 				{
 					__m512 _num;
 
 					for (; (i + 16) < end; i += 16)
 					{
-						_num = _mm512_load_ps(&source[i]);
+						_num = _mm512_loadu_ps(&source[i]);
 
 						_num = _mm512_exp_ps(_num);
 
-						_mm512_store_ps(&dest[i], _num);
+						_mm512_storeu_ps(&dest[i], _num);
 					}//End for
-				}//End if hasAVX512
-				else if (tpa::hasAVX)
+				}();//End if hasAVX512
+				else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
 				{
 					__m256 _num;
 
 					for (; (i + 8) < end; i += 8)
 					{
-						_num = _mm256_load_ps(&source[i]);
+						_num = _mm256_loadu_ps(&source[i]);
 
 						_num = _mm256_exp_ps(_num);
 
-						_mm256_store_ps(&dest[i], _num);
+						_mm256_storeu_ps(&dest[i], _num);
 					}//End for
-				}//End if hasAVX
+				}();//End if hasAVX
 				else if (tpa::has_SSE)
 				{
 					__m128 _num;
 
 					for (; (i + 4) < end; i += 4)
 					{
-						_num = _mm_load_ps(&source[i]);
+						_num = _mm_loadu_ps(&source[i]);
 
 						_num = _mm_exp_ps(_num);
 
-						_mm_store_ps(&dest[i], _num);
+						_mm_storeu_ps(&dest[i], _num);
 					}//End for
 				}//End if has_SSE
 #endif
@@ -157,44 +163,44 @@ namespace tpa{
 #pragma region double
 			if constexpr (std::is_same<T, double>() && std::is_same<RES, double>())
 			{
-#ifdef TPA_X86_64
-				if (tpa::hasAVX512)
+#if defined(TPA_X86_64) && defined(TPA_HAS_SVML)
+				if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 				{
 					__m512d _num;
 
 					for (; (i + 8) < end; i += 8)
 					{
-						_num = _mm512_load_pd(&source[i]);
+						_num = _mm512_loadu_pd(&source[i]);
 
 						_num = _mm512_exp_pd(_num);
 
-						_mm512_store_pd(&dest[i], _num);
+						_mm512_storeu_pd(&dest[i], _num);
 					}//End for
-				}//End if hasAVX512
-				else if (tpa::hasAVX)
+				}();//End if hasAVX512
+				else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
 				{
 					__m256d _num;
 
 					for (; (i + 4) < end; i += 4)
 					{
-						_num = _mm256_load_pd(&source[i]);
+						_num = _mm256_loadu_pd(&source[i]);
 
 						_num = _mm256_exp_pd(_num);
 
-						_mm256_store_pd(&dest[i], _num);
+						_mm256_storeu_pd(&dest[i], _num);
 					}//End for
-				}//End if hasAVX
+				}();//End if hasAVX
 				else if (tpa::has_SSE2)
 				{
 					__m128d _num;
 
 					for (; (i + 2) < end; i += 2)
 					{
-						_num = _mm_load_pd(&source[i]);
+						_num = _mm_loadu_pd(&source[i]);
 
 						_num = _mm_exp_pd(_num);
 
-						_mm_store_pd(&dest[i], _num);
+						_mm_storeu_pd(&dest[i], _num);
 					}//End for
 				}//End if has_SSE
 #endif
@@ -225,14 +231,6 @@ namespace tpa{
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::exp: " << ex.what() << "\n";
-			std::cerr << "tpa::simd::exp will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -289,13 +287,18 @@ namespace tpa{
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::exp2: " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::exp2 will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
 
+			//tpa::simd::runtime_avx512_policy may turn the 512-bit branches off for this input
+			const bool allow512 = tpa::simd::avx512_allowed(smallest * sizeof(T));
+
 			std::vector<std::shared_future<uint32_t>> results;
 			results.reserve(tpa::nThreads);
 
@@ -304,7 +307,7 @@ namespace tpa{
 			for (const auto& sec : sections)
 			{
 				//Launch lambda from multiple threads
-				temp = tpa::tp->addTask([&source, &dest, &sec]()
+				temp = tpa::tp->addTask([&source, &dest, &sec, allow512]()
 					{
 						const size_t beg = sec.first;
 						const size_t end = sec.second;
@@ -313,44 +316,44 @@ namespace tpa{
 #pragma region float
 						if constexpr (std::is_same<T, float>() && std::is_same<RES, float>())
 						{
-#ifdef TPA_X86_64
-							if (tpa::hasAVX512)
+#if defined(TPA_X86_64) && defined(TPA_HAS_SVML)
+							if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 							{
 								__m512 _num;
 
 								for (; (i + 16) < end; i += 16)
 								{
-									_num = _mm512_load_ps(&source[i]);
+									_num = _mm512_loadu_ps(&source[i]);
 
 									_num = _mm512_exp2_ps(_num);
 
-									_mm512_store_ps(&dest[i], _num);
+									_mm512_storeu_ps(&dest[i], _num);
 								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX)
+							}();//End if hasAVX512
+							else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
 							{
 								__m256 _num;
 
 								for (; (i + 8) < end; i += 8)
 								{
-									_num = _mm256_load_ps(&source[i]);
+									_num = _mm256_loadu_ps(&source[i]);
 
 									_num = _mm256_exp2_ps(_num);
 
-									_mm256_store_ps(&dest[i], _num);
+									_mm256_storeu_ps(&dest[i], _num);
 								}//End for
-							}//End if hasAVX
+							}();//End if hasAVX
 							else if (tpa::has_SSE)
 							{
 								__m128 _num;
 
 								for (; (i + 4) < end; i += 4)
 								{
-									_num = _mm_load_ps(&source[i]);
+									_num = _mm_loadu_ps(&source[i]);
 
 									_num = _mm_exp2_ps(_num);
 
-									_mm_store_ps(&dest[i], _num);
+									_mm_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End if has_SSE
 #endif
@@ -359,44 +362,44 @@ namespace tpa{
 #pragma region double
 						if constexpr (std::is_same<T, double>() && std::is_same<RES, double>())
 						{
-#ifdef TPA_X86_64
-							if (tpa::hasAVX512)
+#if defined(TPA_X86_64) && defined(TPA_HAS_SVML)
+							if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 							{
 								__m512d _num;
 
 								for (; (i + 8) < end; i += 8)
 								{
-									_num = _mm512_load_pd(&source[i]);
+									_num = _mm512_loadu_pd(&source[i]);
 
 									_num = _mm512_exp2_pd(_num);
 
-									_mm512_store_pd(&dest[i], _num);
+									_mm512_storeu_pd(&dest[i], _num);
 								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX)
+							}();//End if hasAVX512
+							else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
 							{
 								__m256d _num;
 
 								for (; (i + 4) < end; i += 4)
 								{
-									_num = _mm256_load_pd(&source[i]);
+									_num = _mm256_loadu_pd(&source[i]);
 
 									_num = _mm256_exp2_pd(_num);
 
-									_mm256_store_pd(&dest[i], _num);
+									_mm256_storeu_pd(&dest[i], _num);
 								}//End for
-							}//End if hasAVX
+							}();//End if hasAVX
 							else if (tpa::has_SSE2)
 							{
 								__m128d _num;
 
 								for (; (i + 2) < end; i += 2)
 								{
-									_num = _mm_load_pd(&source[i]);
+									_num = _mm_loadu_pd(&source[i]);
 
 									_num = _mm_exp2_pd(_num);
 
-									_mm_store_pd(&dest[i], _num);
+									_mm_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End if has_SSE
 #endif
@@ -427,14 +430,6 @@ namespace tpa{
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::exp2: " << ex.what() << "\n";
-			std::cerr << "tpa::simd::exp2 will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -491,13 +486,18 @@ namespace tpa{
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::exp10: " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::exp10 will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
 
+			//tpa::simd::runtime_avx512_policy may turn the 512-bit branches off for this input
+			const bool allow512 = tpa::simd::avx512_allowed(smallest * sizeof(T));
+
 			std::vector<std::shared_future<uint32_t>> results;
 			results.reserve(tpa::nThreads);
 
@@ -506,7 +506,7 @@ namespace tpa{
 			for (const auto& sec : sections)
 			{
 				//Launch lambda from multiple threads
-				temp = tpa::tp->addTask([&source, &dest, &sec]()
+				temp = tpa::tp->addTask([&source, &dest, &sec, allow512]()
 					{
 						const size_t beg = sec.first;
 						const size_t end = sec.second;
@@ -515,44 +515,44 @@ namespace tpa{
 #pragma region float
 						if constexpr (std::is_same<T, float>() && std::is_same<RES, float>())
 						{
-#ifdef TPA_X86_64
-							if (tpa::hasAVX512)
+#if defined(TPA_X86_64) && defined(TPA_HAS_SVML)
+							if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 							{
 								__m512 _num;
 
 								for (; (i + 16) < end; i += 16)
 								{
-									_num = _mm512_load_ps(&source[i]);
+									_num = _mm512_loadu_ps(&source[i]);
 
 									_num = _mm512_exp10_ps(_num);
 
-									_mm512_store_ps(&dest[i], _num);
+									_mm512_storeu_ps(&dest[i], _num);
 								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX)
+							}();//End if hasAVX512
+							else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
 							{
 								__m256 _num;
 
 								for (; (i + 8) < end; i += 8)
 								{
-									_num = _mm256_load_ps(&source[i]);
+									_num = _mm256_loadu_ps(&source[i]);
 
 									_num = _mm256_exp10_ps(_num);
 
-									_mm256_store_ps(&dest[i], _num);
+									_mm256_storeu_ps(&dest[i], _num);
 								}//End for
-							}//End if hasAVX
+							}();//End if hasAVX
 							else if (tpa::has_SSE)
 							{
 								__m128 _num;
 
 								for (; (i + 4) < end; i += 4)
 								{
-									_num = _mm_load_ps(&source[i]);
+									_num = _mm_loadu_ps(&source[i]);
 
 									_num = _mm_exp10_ps(_num);
 
-									_mm_store_ps(&dest[i], _num);
+									_mm_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End if has_SSE
 #endif
@@ -561,44 +561,44 @@ namespace tpa{
 #pragma region double
 						if constexpr (std::is_same<T, double>() && std::is_same<RES, double>())
 						{
-#ifdef TPA_X86_64
-							if (tpa::hasAVX512)
+#if defined(TPA_X86_64) && defined(TPA_HAS_SVML)
+							if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 							{
 								__m512d _num;
 
 								for (; (i + 8) < end; i += 8)
 								{
-									_num = _mm512_load_pd(&source[i]);
+									_num = _mm512_loadu_pd(&source[i]);
 
 									_num = _mm512_exp10_pd(_num);
 
-									_mm512_store_pd(&dest[i], _num);
+									_mm512_storeu_pd(&dest[i], _num);
 								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX)
+							}();//End if hasAVX512
+							else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
 							{
 								__m256d _num;
 
 								for (; (i + 4) < end; i += 4)
 								{
-									_num = _mm256_load_pd(&source[i]);
+									_num = _mm256_loadu_pd(&source[i]);
 
 									_num = _mm256_exp10_pd(_num);
 
-									_mm256_store_pd(&dest[i], _num);
+									_mm256_storeu_pd(&dest[i], _num);
 								}//End for
-							}//End if hasAVX
+							}();//End if hasAVX
 							else if (tpa::has_SSE2)
 							{
 								__m128d _num;
 
 								for (; (i + 2) < end; i += 2)
 								{
-									_num = _mm_load_pd(&source[i]);
+									_num = _mm_loadu_pd(&source[i]);
 
 									_num = _mm_exp10_pd(_num);
 
-									_mm_store_pd(&dest[i], _num);
+									_mm_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End if has_SSE
 #endif
@@ -629,14 +629,6 @@ namespace tpa{
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::exp10: " << ex.what() << "\n";
-			std::cerr << "tpa::simd::exp10 will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -693,13 +685,18 @@ namespace tpa{
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::expm1: " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::expm1 will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
 
+			//tpa::simd::runtime_avx512_policy may turn the 512-bit branches off for this input
+			const bool allow512 = tpa::simd::avx512_allowed(smallest * sizeof(T));
+
 			std::vector<std::shared_future<uint32_t>> results;
 			results.reserve(tpa::nThreads);
 
@@ -708,7 +705,7 @@ namespace tpa{
 			for (const auto& sec : sections)
 			{
 				//Launch lambda from multiple threads
-				temp = tpa::tp->addTask([&source, &dest, &sec]()
+				temp = tpa::tp->addTask([&source, &dest, &sec, allow512]()
 					{
 						const size_t beg = sec.first;
 						const size_t end = sec.second;
@@ -717,44 +714,44 @@ namespace tpa{
 #pragma region float
 						if constexpr (std::is_same<T, float>() && std::is_same<RES, float>())
 						{
-#ifdef TPA_X86_64
-							if (tpa::hasAVX512)
+#if defined(TPA_X86_64) && defined(TPA_HAS_SVML)
+							if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 							{
 								__m512 _num;
 
 								for (; (i + 16) < end; i += 16)
 								{
-									_num = _mm512_load_ps(&source[i]);
+									_num = _mm512_loadu_ps(&source[i]);
 
 									_num = _mm512_expm1_ps(_num);
 
-									_mm512_store_ps(&dest[i], _num);
+									_mm512_storeu_ps(&dest[i], _num);
 								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX)
+							}();//End if hasAVX512
+							else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
 							{
 								__m256 _num;
 
 								for (; (i + 8) < end; i += 8)
 								{
-									_num = _mm256_load_ps(&source[i]);
+									_num = _mm256_loadu_ps(&source[i]);
 
 									_num = _mm256_expm1_ps(_num);
 
-									_mm256_store_ps(&dest[i], _num);
+									_mm256_storeu_ps(&dest[i], _num);
 								}//End for
-							}//End if hasAVX
+							}();//End if hasAVX
 							else if (tpa::has_SSE)
 							{
 								__m128 _num;
 
 								for (; (i + 4) < end; i += 4)
 								{
-									_num = _mm_load_ps(&source[i]);
+									_num = _mm_loadu_ps(&source[i]);
 
 									_num = _mm_expm1_ps(_num);
 
-									_mm_store_ps(&dest[i], _num);
+									_mm_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End if has_SSE
 #endif
@@ -763,44 +760,44 @@ namespace tpa{
 #pragma region double
 						if constexpr (std::is_same<T, double>() && std::is_same<RES, double>())
 						{
-#ifdef TPA_X86_64
-							if (tpa::hasAVX512)
+#if defined(TPA_X86_64) && defined(TPA_HAS_SVML)
+							if (allow512 && tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 							{
 								__m512d _num;
 
 								for (; (i + 8) < end; i += 8)
 								{
-									_num = _mm512_load_pd(&source[i]);
+									_num = _mm512_loadu_pd(&source[i]);
 
 									_num = _mm512_expm1_pd(_num);
 
-									_mm512_store_pd(&dest[i], _num);
+									_mm512_storeu_pd(&dest[i], _num);
 								}//End for
-							}//End if hasAVX512
-							else if (tpa::hasAVX)
+							}();//End if hasAVX512
+							else if (tpa::hasAVX) [&]() TPA_TARGET("avx")
 							{
 								__m256d _num;
 
 								for (; (i + 4) < end; i += 4)
 								{
-									_num = _mm256_load_pd(&source[i]);
+									_num = _mm256_loadu_pd(&source[i]);
 
 									_num = _mm256_expm1_pd(_num);
 
-									_mm256_store_pd(&dest[i], _num);
+									_mm256_storeu_pd(&dest[i], _num);
 								}//End for
-							}//End if hasAVX
+							}();//End if hasAVX
 							else if (tpa::has_SSE2)
 							{
 								__m128d _num;
 
 								for (; (i + 2) < end; i += 2)
 								{
-									_num = _mm_load_pd(&source[i]);
+									_num = _mm_loadu_pd(&source[i]);
 
 									_num = _mm_expm1_pd(_num);
 
-									_mm_store_pd(&dest[i], _num);
+									_mm_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End if has_SSE
 #endif
@@ -831,14 +828,6 @@ namespace tpa{
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::expm1: " << ex.what() << "\n";
-			std::cerr << "tpa::simd::expm1 will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
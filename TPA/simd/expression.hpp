@@ -0,0 +1,687 @@
+#pragma once
+/*
+*	Lazy element-wise expressions for TPA Library
+*	By: David Aaron Braun
+*	2022-08-06
+*	Builds a single fused kernel from chained element-wise operations
+*/
+
+/*
+*           Copyright David Aaron Braun 2021 - .
+*   Distributed under the Boost Software License, Version 1.0.
+*       (See accompanying file LICENSE_1_0.txt or copy at
+*           https://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include <concepts>
+#include <utility>
+#include <mutex>
+#include <future>
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <cmath>
+
+#include "../tpa.hpp"
+#include "../_util.hpp"
+#include "../ThreadPool.hpp"
+#include "../excepts.hpp"
+#include "../size_t_lit.hpp"
+#include "../tpa_macros.hpp"
+#include "../predicates.hpp"
+#include "../tpa_concepts.hpp"
+#include "../InstructionSet.hpp"
+#include "simd.hpp"
+#include "vec.hpp"
+#include "dispatch.hpp"
+
+#undef min
+#undef max
+#undef abs
+#undef sqrt
+
+/// <summary>
+/// <para>Private Namespace for TPA expression templates.</para>
+/// <para>Nodes and operators used to build fused kernels, not intended to be used directly.</para>
+/// </summary>
+namespace tpa_expr_private {
+
+#pragma region operations
+	/// <summary>
+	/// <para>Element-wise addition.</para>
+	/// <para>Every operation is applied to either a single value_type or a tpa::simd::vec of value_type.</para>
+	/// </summary>
+	struct add_op
+	{
+		template<typename V>
+		TPA_FORCE_INLINE static V apply(const V a, const V b) noexcept { return static_cast<V>(a + b); }
+	};//End of add_op
+
+	/// <summary>
+	/// Element-wise subtraction
+	/// </summary>
+	struct subtract_op
+	{
+		template<typename V>
+		TPA_FORCE_INLINE static V apply(const V a, const V b) noexcept { return static_cast<V>(a - b); }
+	};//End of subtract_op
+
+	/// <summary>
+	/// Element-wise multiplication
+	/// </summary>
+	struct multiply_op
+	{
+		template<typename V>
+		TPA_FORCE_INLINE static V apply(const V a, const V b) noexcept { return static_cast<V>(a * b); }
+	};//End of multiply_op
+
+	/// <summary>
+	/// Element-wise division
+	/// </summary>
+	struct divide_op
+	{
+		template<typename V>
+		TPA_FORCE_INLINE static V apply(const V a, const V b) noexcept { return static_cast<V>(a / b); }
+	};//End of divide_op
+
+	/// <summary>
+	/// Element-wise minimum
+	/// </summary>
+	struct min_op
+	{
+		template<typename V>
+		TPA_FORCE_INLINE static V apply(const V a, const V b) noexcept
+		{
+			if constexpr (std::is_arithmetic<V>::value)
+			{
+				return static_cast<V>(tpa::util::min(a, b));
+			}//End if
+			else
+			{
+				return tpa::simd::min(a, b);
+			}//End else
+		}//End of apply
+	};//End of min_op
+
+	/// <summary>
+	/// Element-wise maximum
+	/// </summary>
+	struct max_op
+	{
+		template<typename V>
+		TPA_FORCE_INLINE static V apply(const V a, const V b) noexcept
+		{
+			if constexpr (std::is_arithmetic<V>::value)
+			{
+				return static_cast<V>(tpa::util::max(a, b));
+			}//End if
+			else
+			{
+				return tpa::simd::max(a, b);
+			}//End else
+		}//End of apply
+	};//End of max_op
+
+	/// <summary>
+	/// Element-wise negation
+	/// </summary>
+	struct negate_op
+	{
+		template<typename V>
+		TPA_FORCE_INLINE static V apply(const V a) noexcept { return static_cast<V>(-a); }
+	};//End of negate_op
+
+	/// <summary>
+	/// Element-wise absolute value
+	/// </summary>
+	struct abs_op
+	{
+		template<typename V>
+		TPA_FORCE_INLINE static V apply(const V a) noexcept
+		{
+			if constexpr (std::is_arithmetic<V>::value)
+			{
+				return static_cast<V>(tpa::util::abs(a));
+			}//End if
+			else
+			{
+				return tpa::simd::abs(a);
+			}//End else
+		}//End of apply
+	};//End of abs_op
+
+	/// <summary>
+	/// Element-wise square root
+	/// </summary>
+	struct sqrt_op
+	{
+		template<typename V>
+		TPA_FORCE_INLINE static V apply(const V a) noexcept
+		{
+			if constexpr (std::is_arithmetic<V>::value)
+			{
+				return static_cast<V>(tpa::util::sqrt(a));
+			}//End if
+			else
+			{
+				return tpa::simd::sqrt(a);
+			}//End else
+		}//End of apply
+	};//End of sqrt_op
+#pragma endregion
+
+#pragma region nodes
+	/// <summary>
+	/// Tag type inherited by every expression node
+	/// </summary>
+	struct node {};
+
+	template<typename E>
+	/// <summary>
+	/// <para>concept expression requires:</para>
+	/// <para>The type to be a TPA expression node</para>
+	/// </summary>
+	concept expression = std::is_base_of<node, std::remove_cvref_t<E>>::value;
+
+	template<typename C>
+	/// <summary>
+	/// <para>concept container requires:</para>
+	/// <para>A contiguous container with an arithmetic value_type and a data() member</para>
+	/// </summary>
+	concept container = (!expression<C>) && requires(const C & c) {
+		typename C::value_type;
+		{c.size()} -> std::convertible_to<std::size_t>;
+		{c.data()} -> std::convertible_to<const typename C::value_type*>;
+	} && std::is_arithmetic<typename C::value_type>::value;
+
+	template<typename X>
+	/// <summary>
+	/// <para>concept operand requires:</para>
+	/// <para>An expression node, a contiguous container or an arithmetic scalar</para>
+	/// </summary>
+	concept operand = expression<X> || container<X> || std::is_arithmetic<X>::value;
+
+	/// <summary>
+	/// <para>Leaf node referencing the data of a contiguous container.</para>
+	/// <para>The container is not copied and must outlive the expression.</para>
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	template<typename T>
+	struct terminal : node
+	{
+		using value_type = T;
+
+		const T* data;
+		size_t count;
+
+		template<typename C>
+		explicit constexpr terminal(const C& cont) noexcept : data(cont.data()), count(cont.size()) {}
+
+		constexpr size_t size() const noexcept { return count; }
+
+		constexpr T operator[](const size_t i) const noexcept { return data[i]; }
+
+		template<size_t W>
+		TPA_FORCE_INLINE tpa::simd::vec<T, W> packet(const size_t i) const noexcept { return tpa::simd::vec<T, W>::load(data + i); }
+
+		template<size_t BYTES>
+		inline void prefetch(const size_t i) const noexcept { tpa::simd::prefetch<BYTES>(data + i); }
+	};//End of terminal
+
+	/// <summary>
+	/// <para>Leaf node holding a single value broadcast to every element.</para>
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	template<typename T>
+	struct scalar : node
+	{
+		using value_type = T;
+
+		T val;
+
+		explicit constexpr scalar(const T v) noexcept : val(v) {}
+
+		constexpr size_t size() const noexcept { return std::numeric_limits<size_t>::max(); }
+
+		constexpr T operator[](const size_t) const noexcept { return val; }
+
+		template<size_t W>
+		TPA_FORCE_INLINE tpa::simd::vec<T, W> packet(const size_t) const noexcept { return tpa::simd::vec<T, W>(val); }
+
+		template<size_t BYTES>
+		inline void prefetch(const size_t) const noexcept {}
+	};//End of scalar
+
+	/// <summary>
+	/// <para>Node applying OP to the result of two sub-expressions.</para>
+	/// </summary>
+	/// <typeparam name="OP"></typeparam>
+	/// <typeparam name="L"></typeparam>
+	/// <typeparam name="R"></typeparam>
+	template<typename OP, typename L, typename R>
+	struct binary : node
+	{
+		using value_type = L::value_type;
+
+		L lhs;
+		R rhs;
+
+		constexpr binary(const L& l, const R& r) noexcept : lhs(l), rhs(r) {}
+
+		constexpr size_t size() const noexcept { return tpa::util::min(lhs.size(), rhs.size()); }
+
+		constexpr value_type operator[](const size_t i) const noexcept { return OP::apply(lhs[i], rhs[i]); }
+
+		template<size_t W>
+		TPA_FORCE_INLINE tpa::simd::vec<value_type, W> packet(const size_t i) const noexcept { return OP::apply(lhs.template packet<W>(i), rhs.template packet<W>(i)); }
+
+		template<size_t BYTES>
+		inline void prefetch(const size_t i) const noexcept { lhs.template prefetch<BYTES>(i); rhs.template prefetch<BYTES>(i); }
+	};//End of binary
+
+	/// <summary>
+	/// <para>Node applying OP to the result of a single sub-expression.</para>
+	/// </summary>
+	/// <typeparam name="OP"></typeparam>
+	/// <typeparam name="E"></typeparam>
+	template<typename OP, typename E>
+	struct unary : node
+	{
+		using value_type = E::value_type;
+
+		E arg;
+
+		explicit constexpr unary(const E& e) noexcept : arg(e) {}
+
+		constexpr size_t size() const noexcept { return arg.size(); }
+
+		constexpr value_type operator[](const size_t i) const noexcept { return OP::apply(arg[i]); }
+
+		template<size_t W>
+		TPA_FORCE_INLINE tpa::simd::vec<value_type, W> packet(const size_t i) const noexcept { return OP::apply(arg.template packet<W>(i)); }
+
+		template<size_t BYTES>
+		inline void prefetch(const size_t i) const noexcept { arg.template prefetch<BYTES>(i); }
+	};//End of unary
+#pragma endregion
+
+#pragma region evaluation
+	/// <summary>
+	/// <para>Evaluates the 'U' consecutive packets starting at 'i' into 'dest', expanded at compile time.</para>
+	/// </summary>
+	template<size_t W, size_t U, typename EXPR, typename T>
+	TPA_FORCE_INLINE void evaluate_step(const size_t i, const EXPR& expression, T* dest) noexcept
+	{
+		expression.template packet<W>(i).store(dest + i);
+
+		if constexpr (U > 1uz)
+		{
+			evaluate_step<W, U - 1uz>(i + W, expression, dest);
+		}//End if
+	}//End of evaluate_step
+
+	/// <summary>
+	/// <para>Evaluates 'W' elements of the expression at a time into 'dest'.</para>
+	/// <para>The SIMD loop evaluates tpa::simd::unroll packets per iteration and prefetches every terminal tpa::simd::prefetch_distance bytes ahead.</para>
+	/// <para>Leaves 'i' at the first element which was not evaluated.</para>
+	/// </summary>
+	template<size_t W, typename EXPR, typename T>
+	TPA_FORCE_INLINE void evaluate_block(size_t& i, const size_t end, const EXPR& expression, T* dest) noexcept
+	{
+		if constexpr (W > 1uz && tpa::simd::unroll > 1uz)
+		{
+			constexpr size_t step = W * tpa::simd::unroll;
+
+			for (; (i + step) <= end; i += step)
+			{
+				expression.template prefetch<step * sizeof(T)>(i);
+
+				evaluate_step<W, tpa::simd::unroll>(i, expression, dest);
+			}//End for
+		}//End if
+
+		for (; (i + W) <= end; i += W)
+		{
+			evaluate_step<W, 1uz>(i, expression, dest);
+		}//End for
+	}//End of evaluate_block
+
+	/// <summary>
+	/// <para>Evaluates the elements [i, end) one at a time, also used to finish the leftovers of the SIMD kernels.</para>
+	/// </summary>
+	template<typename EXPR, typename T>
+	inline void evaluate_scalar(size_t i, const size_t end, const EXPR& expression, T* dest) noexcept
+	{
+		for (; i != end; ++i)
+		{
+			dest[i] = static_cast<T>(expression[i]);
+		}//End for
+	}//End of evaluate_scalar
+
+#ifdef TPA_X86_64
+	template<typename EXPR, typename T>
+	TPA_TARGET_SSE41 inline void evaluate_sse41(size_t i, const size_t end, const EXPR& expression, T* dest) noexcept
+	{
+		tpa_expr_private::evaluate_block<16uz / sizeof(T)>(i, end, expression, dest);
+		tpa_expr_private::evaluate_scalar(i, end, expression, dest);
+	}//End of evaluate_sse41
+
+	template<typename EXPR, typename T>
+	TPA_TARGET_AVX2 inline void evaluate_avx2(size_t i, const size_t end, const EXPR& expression, T* dest) noexcept
+	{
+		//Peel to a 32-byte boundary of 'dest' so that every full store is aligned
+		const size_t head = tpa::simd::align_index<32uz>(i, end, dest);
+		tpa_expr_private::evaluate_scalar(i, head, expression, dest);
+
+		i = head;
+		tpa_expr_private::evaluate_block<32uz / sizeof(T)>(i, end, expression, dest);
+		tpa_expr_private::evaluate_scalar(i, end, expression, dest);
+	}//End of evaluate_avx2
+
+	template<typename EXPR, typename T>
+	TPA_TARGET_AVX512 inline void evaluate_avx512(size_t i, const size_t end, const EXPR& expression, T* dest) noexcept
+	{
+		//Peel to a 64-byte boundary of 'dest' so that every full store is aligned
+		const size_t head = tpa::simd::align_index<64uz>(i, end, dest);
+		tpa_expr_private::evaluate_scalar(i, head, expression, dest);
+
+		i = head;
+		tpa_expr_private::evaluate_block<64uz / sizeof(T)>(i, end, expression, dest);
+		tpa_expr_private::evaluate_scalar(i, end, expression, dest);
+	}//End of evaluate_avx512
+#elif defined(TPA_NEON)
+	template<typename EXPR, typename T>
+	inline void evaluate_neon(size_t i, const size_t end, const EXPR& expression, T* dest) noexcept
+	{
+		tpa_expr_private::evaluate_block<16uz / sizeof(T)>(i, end, expression, dest);
+		tpa_expr_private::evaluate_scalar(i, end, expression, dest);
+	}//End of evaluate_neon
+#endif
+
+	/// <summary>
+	/// <para>Returns the evaluation kernels for this hardware, built once per expression type.</para>
+	/// </summary>
+	template<typename EXPR, typename T>
+	[[nodiscard]] inline auto evaluate_kernels() noexcept
+	{
+		tpa::simd::kernel_table<void(size_t, const size_t, const EXPR&, T*)> table;
+		table.scalar = &tpa_expr_private::evaluate_scalar<EXPR, T>;
+
+#ifdef TPA_X86_64
+		table.sse41 = &tpa_expr_private::evaluate_sse41<EXPR, T>;
+		table.avx2 = &tpa_expr_private::evaluate_avx2<EXPR, T>;
+		table.avx512 = &tpa_expr_private::evaluate_avx512<EXPR, T>;
+#elif defined(TPA_NEON)
+		table.neon = &tpa_expr_private::evaluate_neon<EXPR, T>;
+#endif
+
+		return table;
+	}//End of evaluate_kernels
+#pragma endregion
+
+#pragma region construction
+	/// <summary>
+	/// <para>Resolves the value_type of an operand, scalars have no value type of their own (void).</para>
+	/// </summary>
+	/// <typeparam name="X"></typeparam>
+	template<typename X>
+	struct operand_type { using type = void; };
+
+	template<typename X> requires expression<X> || container<X>
+	struct operand_type<X> { using type = X::value_type; };
+
+	/// <summary>
+	/// <para>Wraps an operand as an expression node of value type T.</para>
+	/// <para>Scalars are converted to T, containers are referenced, expressions are copied.</para>
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	/// <typeparam name="X"></typeparam>
+	/// <param name="x"></param>
+	/// <returns></returns>
+	template<typename T, typename X>
+	inline constexpr auto wrap(const X& x) noexcept
+	{
+		if constexpr (expression<X>)
+		{
+			return x;
+		}//End if
+		else if constexpr (container<X>)
+		{
+			return tpa_expr_private::terminal<T>(x);
+		}//End if
+		else
+		{
+			return tpa_expr_private::scalar<T>(static_cast<T>(x));
+		}//End else
+	}//End of wrap
+
+	/// <summary>
+	/// <para>Builds a binary node, scalars take on the value type of the other operand.</para>
+	/// </summary>
+	/// <typeparam name="OP"></typeparam>
+	/// <typeparam name="L"></typeparam>
+	/// <typeparam name="R"></typeparam>
+	/// <param name="lhs"></param>
+	/// <param name="rhs"></param>
+	/// <returns></returns>
+	template<typename OP, typename L, typename R>
+	inline constexpr auto make_binary(const L& lhs, const R& rhs) noexcept
+	{
+		using LT = operand_type<L>::type;
+		using RT = operand_type<R>::type;
+		using T = std::conditional_t<std::is_void<LT>::value, RT, LT>;
+
+		static_assert(std::is_void<LT>::value || std::is_void<RT>::value || std::is_same<LT, RT>::value,
+			"Compile Error! Both sides of a TPA expression must have the same value type!");
+
+		const auto l = tpa_expr_private::wrap<T>(lhs);
+		const auto r = tpa_expr_private::wrap<T>(rhs);
+
+		return tpa_expr_private::binary<OP, std::remove_cv_t<decltype(l)>, std::remove_cv_t<decltype(r)>>(l, r);
+	}//End of make_binary
+
+	/// <summary>
+	/// <para>Callable object for a unary operation.</para>
+	/// <para>May be called directly 'tpa::ex::sqrt(e)' or piped 'e | tpa::ex::sqrt'.</para>
+	/// </summary>
+	/// <typeparam name="OP"></typeparam>
+	template<typename OP>
+	struct unary_fn
+	{
+		template<typename X> requires expression<X> || container<X>
+		inline constexpr auto operator()(const X& x) const noexcept
+		{
+			const auto e = tpa_expr_private::wrap<typename X::value_type>(x);
+			return tpa_expr_private::unary<OP, std::remove_cv_t<decltype(e)>>(e);
+		}//End operator()
+	};//End of unary_fn
+
+	template<typename L, typename R> requires (expression<L> || expression<R>) && operand<L> && operand<R>
+	inline constexpr auto operator+(const L& lhs, const R& rhs) noexcept { return tpa_expr_private::make_binary<add_op>(lhs, rhs); }
+
+	template<typename L, typename R> requires (expression<L> || expression<R>) && operand<L> && operand<R>
+	inline constexpr auto operator-(const L& lhs, const R& rhs) noexcept { return tpa_expr_private::make_binary<subtract_op>(lhs, rhs); }
+
+	template<typename L, typename R> requires (expression<L> || expression<R>) && operand<L> && operand<R>
+	inline constexpr auto operator*(const L& lhs, const R& rhs) noexcept { return tpa_expr_private::make_binary<multiply_op>(lhs, rhs); }
+
+	template<typename L, typename R> requires (expression<L> || expression<R>) && operand<L> && operand<R>
+	inline constexpr auto operator/(const L& lhs, const R& rhs) noexcept { return tpa_expr_private::make_binary<divide_op>(lhs, rhs); }
+
+	template<typename E> requires expression<E>
+	inline constexpr auto operator-(const E& e) noexcept { return tpa_expr_private::unary<negate_op, E>(e); }
+
+	template<typename E, typename OP> requires expression<E>
+	inline constexpr auto operator|(const E& e, const unary_fn<OP>& fn) noexcept { return fn(e); }
+#pragma endregion
+}//End of namespace
+
+/// <summary>
+/// <para>Truly Parallel Algorithms</para>
+/// <para>Lazy expression functions usable in a TPA expression.</para>
+/// <para>By David Aaron Braun</para>
+/// <para>Version 0.1</para>
+/// </summary>
+namespace tpa::ex {
+
+	/// <summary>
+	/// <para>Square root, use as 'e | tpa::ex::sqrt' or 'tpa::ex::sqrt(e)'</para>
+	/// </summary>
+	inline constexpr tpa_expr_private::unary_fn<tpa_expr_private::sqrt_op> sqrt{};
+
+	/// <summary>
+	/// <para>Absolute value, use as 'e | tpa::ex::abs' or 'tpa::ex::abs(e)'</para>
+	/// </summary>
+	inline constexpr tpa_expr_private::unary_fn<tpa_expr_private::abs_op> abs{};
+
+	/// <summary>
+	/// <para>Negation, use as 'e | tpa::ex::negate' or '-e'</para>
+	/// </summary>
+	inline constexpr tpa_expr_private::unary_fn<tpa_expr_private::negate_op> negate{};
+
+	/// <summary>
+	/// <para>Element-wise minimum of two operands, at least one of which must be an expression.</para>
+	/// </summary>
+	template<typename L, typename R> requires (tpa_expr_private::expression<L> || tpa_expr_private::expression<R>) && tpa_expr_private::operand<L> && tpa_expr_private::operand<R>
+	inline constexpr auto min(const L& lhs, const R& rhs) noexcept
+	{
+		return tpa_expr_private::make_binary<tpa_expr_private::min_op>(lhs, rhs);
+	}//End of min
+
+	/// <summary>
+	/// <para>Element-wise maximum of two operands, at least one of which must be an expression.</para>
+	/// </summary>
+	template<typename L, typename R> requires (tpa_expr_private::expression<L> || tpa_expr_private::expression<R>) && tpa_expr_private::operand<L> && tpa_expr_private::operand<R>
+	inline constexpr auto max(const L& lhs, const R& rhs) noexcept
+	{
+		return tpa_expr_private::make_binary<tpa_expr_private::max_op>(lhs, rhs);
+	}//End of max
+}//End of namespace
+
+/// <summary>
+/// <para>Truly Parallel Algorithms</para>
+/// <para>By David Aaron Braun</para>
+/// <para>Version 0.1</para>
+/// </summary>
+namespace tpa {
+
+	/// <summary>
+	/// <para>Begins a lazy expression over a contiguous container.</para>
+	/// <para>No work is done until the expression is passed to tpa::evaluate, the container is referenced not copied.</para>
+	/// <para>e.g. tpa::evaluate(tpa::expr(a) * b + 3.0 | tpa::ex::sqrt, dest);</para>
+	/// </summary>
+	/// <typeparam name="CONTAINER"></typeparam>
+	/// <param name="cont"></param>
+	/// <returns></returns>
+	template<typename CONTAINER>
+	inline constexpr auto expr(const CONTAINER& cont) noexcept
+		requires tpa_expr_private::container<CONTAINER>
+	{
+		return tpa_expr_private::terminal<typename CONTAINER::value_type>(cont);
+	}//End of expr
+
+	/// <summary>
+	/// <para>Evaluates a lazy expression built with tpa::expr into the destination container.</para>
+	/// <para>Every operation in the expression is fused into a single kernel, each element is read once and written once and no temporary containers are created.</para>
+	/// <para>Uses Multi-Threading and SIMD where available.</para>
+	/// <para>SIMD (tpa::simd::vec) is used for expressions whose destination has the same value type, all other destinations use the scalar kernel.</para>
+	/// <para>Values are computed upto the size of the smallest container referenced by the expression or the destination container, whichever is smaller.</para>
+	/// </summary>
+	/// <typeparam name="EXPR"></typeparam>
+	/// <typeparam name="CONTAINER"></typeparam>
+	/// <param name="expression"></param>
+	/// <param name="dest"></param>
+	template<typename EXPR, typename CONTAINER>
+	inline constexpr void evaluate(
+		const EXPR& expression,
+		CONTAINER& dest)
+		requires tpa_expr_private::expression<EXPR> &&
+		tpa::util::contiguous_seqeunce<CONTAINER>
+	{
+		try
+		{
+			using T = EXPR::value_type;
+			using RES = CONTAINER::value_type;
+
+			uint32_t complete = 0;
+
+			//Prevent overflow
+			const size_t smallest = tpa::util::min(expression.size(), static_cast<size_t>(dest.size()));
+
+			std::vector<std::pair<size_t, size_t>> sections;
+			tpa::util::prepareThreading(sections, smallest);
+
+			std::vector<std::shared_future<uint32_t>> results;
+			results.reserve(tpa::nThreads);
+
+			std::shared_future<uint32_t> temp;
+
+			for (const auto& sec : sections)
+			{
+				//Launch lambda from multiple threads
+				temp = tpa::tp->addTask([&expression, &dest, &sec]()
+					{
+						const size_t beg = sec.first;
+						const size_t end = sec.second;
+						size_t i = beg;
+
+#pragma region simd
+						if constexpr (std::is_same<T, RES>() && tpa::simd::is_vec_type<T>)
+						{
+							//Built on first use, not per call
+							static const auto kernels = tpa_expr_private::evaluate_kernels<EXPR, T>();
+
+							kernels.resolve_for((end - i) * sizeof(T))(i, end, expression, &dest[0]);
+						}//End if
+#pragma endregion
+#pragma region generic
+						else
+						{
+							for (; i != end; ++i)
+							{
+								dest[i] = static_cast<RES>(expression[i]);
+							}//End for
+						}//End else
+#pragma endregion
+
+						return static_cast<uint32_t>(1);
+					});//End of lambda
+
+				results.emplace_back(std::move(temp));
+			}//End for
+
+			for (const auto& fut : results)
+			{
+				complete += fut.get();
+			}//End for
+
+			//Check all threads completed
+			if (complete != tpa::nThreads)
+			{
+				throw tpa::exceptions::NotAllThreadsCompleted(complete);
+			}//End if
+		}//End try
+		catch (const std::future_error& ex)
+		{
+			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+			std::cerr << "Exception thrown in tpa::evaluate(): " << ex.code()
+				<< " " << ex.what() << "\n";
+		}//End catch
+		catch (const std::bad_alloc& ex)
+		{
+			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+			std::cerr << "Exception thrown in tpa::evaluate: " << ex.what() << "\n";
+		}//End catch
+		catch (const std::exception& ex)
+		{
+			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+			std::cerr << "Exception thrown in tpa::evaluate: " << ex.what() << "\n";
+		}//End catch
+		catch (...)
+		{
+			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+			std::cerr << "Exception thrown in tpa::evaluate: unknown!\n";
+		}//End catch
+	}//End of evaluate()
+}//End of namespace
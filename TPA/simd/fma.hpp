@@ -31,6 +31,80 @@
 #include "../tpa_concepts.hpp"
 #include "../InstructionSet.hpp"
 #include "simd.hpp"
+#include "vec.hpp"
+#include "dispatch.hpp"
+
+#ifdef TPA_NEON
+/// <summary>
+/// <para>Private Namespace for the TPA fma NEON kernels.</para>
+/// <para>Each kernel processes [i, end) in 128-bit steps and advances 'i' past the elements processed, the caller finishes the remainder.</para>
+/// </summary>
+namespace tpa_fma_private
+{
+	/// <summary>
+	/// <para>dest[i] = (a[i] * b[i]) + c[i]</para>
+	/// </summary>
+	template<typename T>
+	inline void fma_neon(size_t& i, const size_t end, const T* a, const T* b, const T* c, T* dest) noexcept
+	{
+		using V = tpa::simd::vec<T, 16uz / sizeof(T)>;
+
+		for (; (i + V::width) <= end; i += V::width)
+		{
+			tpa::simd::fma(V::load(&a[i]), V::load(&b[i]), V::load(&c[i])).store(&dest[i]);
+		}//End for
+	}//End of fma_neon
+
+	/// <summary>
+	/// <para>dest[i] = (a[i] * b[i]) + c</para>
+	/// </summary>
+	template<typename T>
+	inline void fma_const_add_neon(size_t& i, const size_t end, const T* a, const T* b, const T c, T* dest) noexcept
+	{
+		using V = tpa::simd::vec<T, 16uz / sizeof(T)>;
+
+		const V _c = V(c);
+
+		for (; (i + V::width) <= end; i += V::width)
+		{
+			tpa::simd::fma(V::load(&a[i]), V::load(&b[i]), _c).store(&dest[i]);
+		}//End for
+	}//End of fma_const_add_neon
+
+	/// <summary>
+	/// <para>dest[i] = (a[i] * b) + c[i]</para>
+	/// </summary>
+	template<typename T>
+	inline void fma_const_multiply_neon(size_t& i, const size_t end, const T* a, const T b, const T* c, T* dest) noexcept
+	{
+		using V = tpa::simd::vec<T, 16uz / sizeof(T)>;
+
+		const V _b = V(b);
+
+		for (; (i + V::width) <= end; i += V::width)
+		{
+			tpa::simd::fma(V::load(&a[i]), _b, V::load(&c[i])).store(&dest[i]);
+		}//End for
+	}//End of fma_const_multiply_neon
+
+	/// <summary>
+	/// <para>dest[i] = (a[i] * b) + c</para>
+	/// </summary>
+	template<typename T>
+	inline void fma_const_multiply_add_neon(size_t& i, const size_t end, const T* a, const T b, const T c, T* dest) noexcept
+	{
+		using V = tpa::simd::vec<T, 16uz / sizeof(T)>;
+
+		const V _b = V(b);
+		const V _c = V(c);
+
+		for (; (i + V::width) <= end; i += V::width)
+		{
+			tpa::simd::fma(V::load(&a[i]), _b, _c).store(&dest[i]);
+		}//End for
+	}//End of fma_const_multiply_add_neon
+}//End of namespace
+#endif
 
 /// <summary>
 /// <para>Truly Parallel Algorithms</para>
@@ -54,12 +128,14 @@ namespace tpa{
 	/// <param name="arr_b"></param>
 	/// <param name="arr_c"></param>
 	/// <param name="dest"></param>
+	/// <param name="mode">tpa::exec::LINEAR (default) or tpa::exec::BLOCKED to interleave the four streams in L2-sized tiles</param>
 	template<class CONTAINER_A, class CONTAINER_B, class CONTAINER_C, class C_DEST>
 	inline constexpr void fma(
 		const CONTAINER_A& arr_a,
 		const CONTAINER_B& arr_b,
 		const CONTAINER_C& arr_c,
-		C_DEST& dest)
+		C_DEST& dest,
+		const tpa::exec mode = tpa::exec::LINEAR)
 		requires tpa::util::contiguous_seqeunce<CONTAINER_A> &&
 		tpa::util::contiguous_seqeunce<CONTAINER_B> &&
 		tpa::util::contiguous_seqeunce<CONTAINER_C> &&
@@ -72,9 +148,9 @@ namespace tpa{
 		{
 
 			static_assert(
-			std::is_same<CONTAINER_A::value_type, CONTAINER_B::value_type>() &&
-			std::is_same<CONTAINER_A::value_type, CONTAINER_C::value_type>() &&
-			std::is_same<CONTAINER_A::value_type, C_DEST::value_type>(),
+			std::is_same<typename CONTAINER_A::value_type, typename CONTAINER_B::value_type>() &&
+			std::is_same<typename CONTAINER_A::value_type, typename CONTAINER_C::value_type>() &&
+			std::is_same<typename CONTAINER_A::value_type, typename C_DEST::value_type>(),
 			"Compile Error! All the source and destination containers must be of the same value_type!");
 
 			using T = CONTAINER_A::value_type;
@@ -85,641 +161,656 @@ namespace tpa{
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::fma(): " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::fma will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
 
-		recover:
-
-			std::vector<std::pair<size_t, size_t>> sections;
-			tpa::util::prepareThreading(sections, smallest);
+			//tpa::exec::BLOCKED deals L2-sized tiles to the threads round-robin, tpa::exec::LINEAR gives each thread one contiguous section
+			std::vector<std::vector<std::pair<size_t, size_t>>> tiles;
+			tpa::util::prepareTiling(tiles, smallest, (mode == tpa::exec::BLOCKED) ? tpa::simd::tile_elements<T>(4uz) : 0uz);
 
 			std::vector<std::shared_future<uint32_t>> results;
 			results.reserve(tpa::nThreads);
 
 			std::shared_future<uint32_t> temp;
 
-			for (const auto& sec : sections)
+			for (const auto& ranges : tiles)
 			{
 				//Launch lambda from multiple threads
-				temp = tpa::tp->addTask([&arr_a, &arr_b, &arr_c, &dest, &sec]()
+				temp = tpa::tp->addTask([&arr_a, &arr_b, &arr_c, &dest, &ranges]()
 					{
-						const size_t beg = sec.first;
-						const size_t end = sec.second;
-						size_t i = beg;
+						for (const auto& [beg, end] : ranges)
+						{
+							size_t i = beg;
 
 #pragma region byte
-					if constexpr (std::is_same<T, int8_t>())
-					{
-#ifdef TPA_X86_64
-						if (tpa::hasAVX512_ByteWord)
+						if constexpr (std::is_same<T, int8_t>())
 						{
-							__m512i _a, _b, _c, _dest;
-
-							for (; i < end; i += 64)
+#ifdef TPA_X86_64
+							if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 							{
-								if ((i + 64) > end) [[unlikely]]
+								__m512i _a, _b, _c, _dest;
+
+								for (; i < end; i += 64)
 								{
-									break;
-								}//End if
+									if ((i + 64) > end) [[unlikely]]
+									{
+										break;
+									}//End if
 
-								//Load
-								_a = _mm512_loadu_epi8((__m512i*)&arr_a[i]);
-								_b = _mm512_loadu_epi8((__m512i*)&arr_b[i]);
-								_c = _mm512_loadu_epi8((__m512i*)&arr_c[i]);
+									//Load
+									_a = _mm512_loadu_epi8((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi8((__m512i*)&arr_b[i]);
+									_c = _mm512_loadu_epi8((__m512i*)&arr_c[i]);
 
-								//Perform FMA (a * b) + c
-								int8_t d[64] = {};
-								for (size_t x = 0; x < 64; ++x)
-								{
+									//Perform FMA (a * b) + c
+									int8_t d[64] = {};
+									for (size_t x = 0; x < 64; ++x)
+									{
 #ifdef _MSC_VER
-									d[x] = static_cast<int8_t>(_a.m512i_i8[x] * _b.m512i_i8[x]);
+										d[x] = static_cast<int8_t>(_a.m512i_i8[x] * _b.m512i_i8[x]);
 #else
-									d[x] = static_cast<int8_t>(_a[x] * _b[x]);
+										d[x] = static_cast<int8_t>(_a[x] * _b[x]);
 #endif
-								}//End for
-								_dest = _mm512_loadu_epi8((__m256i*) & d);
-
-								_dest = _mm512_add_epi8(_dest, _c);
+									}//End for
+									_dest = _mm512_loadu_epi8((__m256i*) & d);
 
-								//Store Result
-								_mm512_storeu_epi8((__m512i*)&dest[i], _dest);
-							}//End for
-						}//End if hasAVX512
-						else if (tpa::hasAVX2)
-						{
-							__m256i _a, _b, _c, _dest;
+									_dest = _mm512_add_epi8(_dest, _c);
 
-							for (; i < end; i += 32)
+									//Store Result
+									_mm512_storeu_epi8((__m512i*)&dest[i], _dest);
+								}//End for
+							}();//End if hasAVX512
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
-								if ((i + 32) > end) [[unlikely]]
+								__m256i _a, _b, _c, _dest;
+
+								for (; i < end; i += 32)
 								{
-									break;
-								}//End if
+									if ((i + 32) > end) [[unlikely]]
+									{
+										break;
+									}//End if
 
-								//Load
-								_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-								_b = _mm256_load_si256((__m256i*) & arr_b[i]);
-								_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									//Load
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
-								//Perform FMA (a * b) + c	
-								int8_t d[32] = {};
-								for (size_t x = 0; x < 32; ++x)
-								{
+									//Perform FMA (a * b) + c	
+									int8_t d[32] = {};
+									for (size_t x = 0; x < 32; ++x)
+									{
 #ifdef _MSC_VER
-									d[x] = static_cast<int8_t>(_a.m256i_u8[x] * _b.m256i_u8[x]);
+										d[x] = static_cast<int8_t>(_a.m256i_u8[x] * _b.m256i_u8[x]);
 #else
-									d[x] = static_cast<int8_t>(_a[x] * _b[x]);
+										d[x] = static_cast<int8_t>(_a[x] * _b[x]);
 #endif
-								}//End for
-								_dest = _mm256_load_si256((__m256i*) & d);
+									}//End for
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
-								_dest = _mm256_add_epi8(_dest, _c);
+									_dest = _mm256_add_epi8(_dest, _c);
 
-								//Store Result
-								_mm256_store_si256((__m256i*) & dest[i], _dest);
-							}//End for
-						}//End if hasAVX2
+									//Store Result
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
+								}//End for
+							}();//End if hasAVX2
 #endif
-					}//End if
+						}//End if
 #pragma endregion
 #pragma region unsigned byte
-					else if constexpr (std::is_same<T, uint8_t>())
-					{
-#ifdef TPA_X86_64
-						if (tpa::hasAVX512_ByteWord)
+						else if constexpr (std::is_same<T, uint8_t>())
 						{
-							__m512i _a, _b, _c, _dest;
-
-							for (; i < end; i += 64)
+#ifdef TPA_X86_64
+							if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 							{
-								if ((i + 64) > end) [[unlikely]]
+								__m512i _a, _b, _c, _dest;
+
+								for (; i < end; i += 64)
 								{
-									break;
-								}//End if
+									if ((i + 64) > end) [[unlikely]]
+									{
+										break;
+									}//End if
 
-								//Load
-								_a = _mm512_loadu_epi8((__m512i*)&arr_a[i]);
-								_b = _mm512_loadu_epi8((__m512i*)&arr_b[i]);
-								_c = _mm512_loadu_epi8((__m512i*)&arr_c[i]);
+									//Load
+									_a = _mm512_loadu_epi8((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi8((__m512i*)&arr_b[i]);
+									_c = _mm512_loadu_epi8((__m512i*)&arr_c[i]);
 
-								//Perform FMA (a * b) + c
-								uint8_t d[64] = {};
-								for (size_t x = 0; x < 64; ++x)
-								{
+									//Perform FMA (a * b) + c
+									uint8_t d[64] = {};
+									for (size_t x = 0; x < 64; ++x)
+									{
 #ifdef _MSC_VER
-									d[x] = static_cast<uint8_t>(_a.m512i_u8[x] * _b.m512i_u8[x]);
+										d[x] = static_cast<uint8_t>(_a.m512i_u8[x] * _b.m512i_u8[x]);
 #else
-									d[x] = static_cast<uint8_t>(_a[x] * _b[x]);
+										d[x] = static_cast<uint8_t>(_a[x] * _b[x]);
 #endif
-								}//End for
-								_dest = _mm512_loadu_epi8((__m256i*) & d);
-
-								_dest = _mm512_add_epi8(_dest, _c);
+									}//End for
+									_dest = _mm512_loadu_epi8((__m256i*) & d);
 
-								//Store Result
-								_mm512_storeu_epi8((__m512i*)&dest[i], _dest);
-							}//End for
-						}//End if hasAVX512
-						else if (tpa::hasAVX2)
-						{
-							__m256i _a, _b, _c, _dest;
+									_dest = _mm512_add_epi8(_dest, _c);
 
-							for (; i < end; i += 32)
+									//Store Result
+									_mm512_storeu_epi8((__m512i*)&dest[i], _dest);
+								}//End for
+							}();//End if hasAVX512
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
-								if ((i + 32) > end) [[unlikely]]
+								__m256i _a, _b, _c, _dest;
+
+								for (; i < end; i += 32)
 								{
-									break;
-								}//End if
+									if ((i + 32) > end) [[unlikely]]
+									{
+										break;
+									}//End if
 
-								//Load
-								_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-								_b = _mm256_load_si256((__m256i*) & arr_b[i]);
-								_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									//Load
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
-								//Perform FMA (a * b) + c	
-								uint8_t d[32] = {};
-								for (size_t x = 0; x < 32; ++x)
-								{
+									//Perform FMA (a * b) + c	
+									uint8_t d[32] = {};
+									for (size_t x = 0; x < 32; ++x)
+									{
 #ifdef _MSC_VER
-									d[x] = static_cast<uint8_t>(_a.m256i_u8[x] * _b.m256i_u8[x]);
+										d[x] = static_cast<uint8_t>(_a.m256i_u8[x] * _b.m256i_u8[x]);
 #else
-									d[x] = static_cast<uint8_t>(_a[x] * _b[x]);
+										d[x] = static_cast<uint8_t>(_a[x] * _b[x]);
 #endif
-								}//End for
-								_dest = _mm256_load_si256((__m256i*) & d);
+									}//End for
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
-								_dest = _mm256_add_epi8(_dest, _c);
+									_dest = _mm256_add_epi8(_dest, _c);
 
-								//Store Result
-								_mm256_store_si256((__m256i*) & dest[i], _dest);
-							}//End for
-						}//End if hasAVX2
+									//Store Result
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
+								}//End for
+							}();//End if hasAVX2
 #endif
-					}//End if
+						}//End if
 #pragma endregion
 #pragma region short
-					else if constexpr (std::is_same<T, int16_t>())
-					{
-#ifdef TPA_X86_64
-						if (tpa::hasAVX512_ByteWord)
+						else if constexpr (std::is_same<T, int16_t>())
 						{
-							__m512i _a, _b, _c, _dest;
-
-							for (; i < end; i += 32)
+#ifdef TPA_X86_64
+							if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 							{
-								if ((i + 32) > end) [[unlikely]]
+								__m512i _a, _b, _c, _dest;
+
+								for (; i < end; i += 32)
 								{
-									break;
-								}//End if
+									if ((i + 32) > end) [[unlikely]]
+									{
+										break;
+									}//End if
 
-								//Load
-								_a = _mm512_loadu_epi16((__m512i*)&arr_a[i]);
-								_b = _mm512_loadu_epi16((__m512i*)&arr_b[i]);
-								_c = _mm512_loadu_epi16((__m512i*)&arr_c[i]);
+									//Load
+									_a = _mm512_loadu_epi16((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi16((__m512i*)&arr_b[i]);
+									_c = _mm512_loadu_epi16((__m512i*)&arr_c[i]);
 
-								//Perform FMA (a * b) + c
-								_dest = _mm512_mullo_epi16(_a, _b);
-								_dest = _mm512_add_epi16(_dest, _c);
+									//Perform FMA (a * b) + c
+									_dest = _mm512_mullo_epi16(_a, _b);
+									_dest = _mm512_add_epi16(_dest, _c);
 
-								//Store Result
-								_mm512_storeu_epi16((__m512i*)&dest[i], _dest);
-							}//End for
-						}//End if hasAVX512
-						else if (tpa::hasAVX2)
-						{
-							__m256i _a, _b, _c, _dest;
-
-							for (; i < end; i += 16)
+									//Store Result
+									_mm512_storeu_epi16((__m512i*)&dest[i], _dest);
+								}//End for
+							}();//End if hasAVX512
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
-								if ((i + 16) > end) [[unlikely]]
+								__m256i _a, _b, _c, _dest;
+
+								for (; i < end; i += 16)
 								{
-									break;
-								}//End if
+									if ((i + 16) > end) [[unlikely]]
+									{
+										break;
+									}//End if
 
-								//Load
-								_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-								_b = _mm256_load_si256((__m256i*) & arr_b[i]);
-								_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									//Load
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
-								//Perform FMA (a * b) + c	
-								_dest = _mm256_mullo_epi16(_a, _b);
-								_dest = _mm256_add_epi16(_dest, _c);
+									//Perform FMA (a * b) + c	
+									_dest = _mm256_mullo_epi16(_a, _b);
+									_dest = _mm256_add_epi16(_dest, _c);
 
-								//Store Result
-								_mm256_store_si256((__m256i*) & dest[i], _dest);
-							}//End for
-						}//End if hasAVX2
+									//Store Result
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
+								}//End for
+							}();//End if hasAVX2
 #endif
-					}//End if
+						}//End if
 #pragma endregion
 #pragma region unsigned short
-					else if constexpr (std::is_same<T, uint16_t>())
-					{
-#ifdef TPA_X86_64
-						if (tpa::hasAVX512_ByteWord)
+						else if constexpr (std::is_same<T, uint16_t>())
 						{
-							__m512i _a, _b, _c, _dest;
-
-							for (; i < end; i += 32)
+#ifdef TPA_X86_64
+							if (tpa::hasAVX512_ByteWord) [&]() TPA_TARGET("avx512bw")
 							{
-								if ((i + 32) > end) [[unlikely]]
-								{
-									break;
-								}//End if
+								__m512i _a, _b, _c, _dest;
 
-								//Load
-								_a = _mm512_loadu_epi16((__m512i*)&arr_a[i]);
-								_b = _mm512_loadu_epi16((__m512i*)&arr_b[i]);
-								_c = _mm512_loadu_epi16((__m512i*)&arr_c[i]);
+								for (; i < end; i += 32)
+								{
+									if ((i + 32) > end) [[unlikely]]
+									{
+										break;
+									}//End if
 
-								//Perform FMA (a * b) + c
-								_dest = _mm512_mullo_epi16(_a, _b);
-								_dest = _mm512_add_epi16(_dest, _c);
+									//Load
+									_a = _mm512_loadu_epi16((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi16((__m512i*)&arr_b[i]);
+									_c = _mm512_loadu_epi16((__m512i*)&arr_c[i]);
 
-								//Store Result
-								_mm512_storeu_epi16((__m512i*)&dest[i], _dest);
-							}//End for
-						}//End if hasAVX512
-						else if (tpa::hasAVX2)
-						{
-							__m256i _a, _b, _c, _dest;
+									//Perform FMA (a * b) + c
+									_dest = _mm512_mullo_epi16(_a, _b);
+									_dest = _mm512_add_epi16(_dest, _c);
 
-							for (; i < end; i += 16)
+									//Store Result
+									_mm512_storeu_epi16((__m512i*)&dest[i], _dest);
+								}//End for
+							}();//End if hasAVX512
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
-								if ((i + 16) > end) [[unlikely]]
+								__m256i _a, _b, _c, _dest;
+
+								for (; i < end; i += 16)
 								{
-									break;
-								}//End if
+									if ((i + 16) > end) [[unlikely]]
+									{
+										break;
+									}//End if
 
-								//Load
-								_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-								_b = _mm256_load_si256((__m256i*) & arr_b[i]);
-								_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									//Load
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
-								//Perform FMA (a * b) + c	
-								_dest = _mm256_mullo_epi16(_a, _b);
-								_dest = _mm256_add_epi16(_dest, _c);
+									//Perform FMA (a * b) + c	
+									_dest = _mm256_mullo_epi16(_a, _b);
+									_dest = _mm256_add_epi16(_dest, _c);
 
-								//Store Result
-								_mm256_store_si256((__m256i*) & dest[i], _dest);
-							}//End for
-						}//End if hasAVX2
+									//Store Result
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
+								}//End for
+							}();//End if hasAVX2
 #endif
-					}//End if
+						}//End if
 #pragma endregion
 #pragma region int
-					else if constexpr (std::is_same<T, int32_t>())
-					{
-#ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						else if constexpr (std::is_same<T, int32_t>())
 						{
-							__m512i _a, _b, _c, _dest;
-
-							for (; i < end; i += 16)
+#ifdef TPA_X86_64
+							if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 							{
-								if ((i + 16) > end) [[unlikely]]
-								{
-									break;
-								}//End if
+								__m512i _a, _b, _c, _dest;
 
-								//Load
-								_a = _mm512_load_epi32((__m512i*)&arr_a[i]);
-								_b = _mm512_load_epi32((__m512i*)&arr_b[i]);
-								_c = _mm512_load_epi32((__m512i*)&arr_c[i]);
+								for (; i < end; i += 16)
+								{
+									if ((i + 16) > end) [[unlikely]]
+									{
+										break;
+									}//End if
 
-								//Perform FMA (a * b) + c
-								_dest = _mm512_mullo_epi32(_a, _b);
-								_dest = _mm512_add_epi32(_dest, _c);
+									//Load
+									_a = _mm512_loadu_epi32((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi32((__m512i*)&arr_b[i]);
+									_c = _mm512_loadu_epi32((__m512i*)&arr_c[i]);
 
-								//Store Result
-								_mm512_store_epi32((__m512i*)&dest[i], _dest);
-							}//End for
-						}//End if hasAVX512
-						else if (tpa::hasAVX2)
-						{
-							__m256i _a, _b, _c, _dest;
+									//Perform FMA (a * b) + c
+									_dest = _mm512_mullo_epi32(_a, _b);
+									_dest = _mm512_add_epi32(_dest, _c);
 
-							for (; i < end; i += 8)
+									//Store Result
+									_mm512_storeu_epi32((__m512i*)&dest[i], _dest);
+								}//End for
+							}();//End if hasAVX512
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
-								if ((i + 8) > end) [[unlikely]]
+								__m256i _a, _b, _c, _dest;
+
+								for (; i < end; i += 8)
 								{
-									break;
-								}//End if
+									if ((i + 8) > end) [[unlikely]]
+									{
+										break;
+									}//End if
 
-								//Load
-								_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-								_b = _mm256_load_si256((__m256i*) & arr_b[i]);
-								_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									//Load
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
-								//Perform FMA (a * b) + c	
-								_dest = _mm256_mullo_epi32(_a, _b);
-								_dest = _mm256_add_epi32(_dest, _c);
+									//Perform FMA (a * b) + c	
+									_dest = _mm256_mullo_epi32(_a, _b);
+									_dest = _mm256_add_epi32(_dest, _c);
 
-								//Store Result
-								_mm256_store_si256((__m256i*) & dest[i], _dest);
-							}//End for
-						}//End if hasAVX2
+									//Store Result
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
+								}//End for
+							}();//End if hasAVX2
 #endif
-					}//End if
+						}//End if
 #pragma endregion
 #pragma region unsigned int
-					else if constexpr (std::is_same<T, uint32_t>())
-					{
-#ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						else if constexpr (std::is_same<T, uint32_t>())
 						{
-							__m512i _a, _b, _c, _dest;
-
-							for (; i < end; i += 16)
+#ifdef TPA_X86_64
+							if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 							{
-								if ((i + 16) > end) [[unlikely]]
-								{
-									break;
-								}//End if
+								__m512i _a, _b, _c, _dest;
 
-								//Load
-								_a = _mm512_load_epi32((__m512i*)&arr_a[i]);
-								_b = _mm512_load_epi32((__m512i*)&arr_b[i]);
-								_c = _mm512_load_epi32((__m512i*)&arr_c[i]);
+								for (; i < end; i += 16)
+								{
+									if ((i + 16) > end) [[unlikely]]
+									{
+										break;
+									}//End if
 
-								//Perform FMA (a * b) + c
-								_dest = _mm512_mullo_epi32(_a, _b);
-								_dest = _mm512_add_epi32(_dest, _c);
+									//Load
+									_a = _mm512_loadu_epi32((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi32((__m512i*)&arr_b[i]);
+									_c = _mm512_loadu_epi32((__m512i*)&arr_c[i]);
 
-								//Store Result
-								_mm512_store_epi32((__m512i*)&dest[i], _dest);
-							}//End for
-						}//End if hasAVX512
-						else if (tpa::hasAVX2)
-						{
-							__m256i _a, _b, _c, _dest;
+									//Perform FMA (a * b) + c
+									_dest = _mm512_mullo_epi32(_a, _b);
+									_dest = _mm512_add_epi32(_dest, _c);
 
-							for (; i < end; i += 8)
+									//Store Result
+									_mm512_storeu_epi32((__m512i*)&dest[i], _dest);
+								}//End for
+							}();//End if hasAVX512
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
-								if ((i + 8) > end) [[unlikely]]
+								__m256i _a, _b, _c, _dest;
+
+								for (; i < end; i += 8)
 								{
-									break;
-								}//End if
+									if ((i + 8) > end) [[unlikely]]
+									{
+										break;
+									}//End if
 
-								//Load
-								_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-								_b = _mm256_load_si256((__m256i*) & arr_b[i]);
-								_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									//Load
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
-								//Perform FMA (a * b) + c	
-								_dest = _mm256_mullo_epi32(_a,_b);
-								_dest = _mm256_add_epi32(_dest, _c);
+									//Perform FMA (a * b) + c	
+									_dest = _mm256_mullo_epi32(_a,_b);
+									_dest = _mm256_add_epi32(_dest, _c);
 
-								//Store Result
-								_mm256_store_si256((__m256i*) & dest[i], _dest);
-							}//End for
-						}//End if hasAVX2
+									//Store Result
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
+								}//End for
+							}();//End if hasAVX2
 #endif
-					}//End if
+						}//End if
 #pragma endregion
 #pragma region long
-					else if constexpr (std::is_same<T, int64_t>())
-					{
-#ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						else if constexpr (std::is_same<T, int64_t>())
 						{
-							__m512i _a, _b, _c, _dest;
-
-							for (; i < end; i += 8)
+#ifdef TPA_X86_64
+							if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 							{
-								if ((i + 8) > end) [[unlikely]]
-								{
-									break;
-								}//End if
+								__m512i _a, _b, _c, _dest;
 
-								//Load
-								_a = _mm512_load_epi64((__m512i*)&arr_a[i]);
-								_b = _mm512_load_epi64((__m512i*)&arr_b[i]);
-								_c = _mm512_load_epi64((__m512i*)&arr_c[i]);
+								for (; i < end; i += 8)
+								{
+									if ((i + 8) > end) [[unlikely]]
+									{
+										break;
+									}//End if
 
-								//Perform FMA (a * b) + c								
-								_dest = _mm512_mullox_epi64(_a, _b);
-								_dest = _mm512_add_epi64(_dest, _c);
+									//Load
+									_a = _mm512_loadu_epi64((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi64((__m512i*)&arr_b[i]);
+									_c = _mm512_loadu_epi64((__m512i*)&arr_c[i]);
 
-								//Store Result
-								_mm512_store_epi64((__m512i*)&dest[i], _dest);
-							}//End for
-						}//End if hasAVX512
-						else if (tpa::hasAVX2)
-						{
-							__m256i _a, _b, _c, _dest;
+									//Perform FMA (a * b) + c								
+									_dest = _mm512_mullox_epi64(_a, _b);
+									_dest = _mm512_add_epi64(_dest, _c);
 
-							for (; i < end; i += 4)
+									//Store Result
+									_mm512_storeu_epi64((__m512i*)&dest[i], _dest);
+								}//End for
+							}();//End if hasAVX512
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
-								if ((i + 4) > end) [[unlikely]]
+								__m256i _a, _b, _c, _dest;
+
+								for (; i < end; i += 4)
 								{
-									break;
-								}//End if
+									if ((i + 4) > end) [[unlikely]]
+									{
+										break;
+									}//End if
 
-								//Load
-								_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-								_b = _mm256_load_si256((__m256i*) & arr_b[i]);
-								_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									//Load
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
-								//Perform FMA (a * b) + c								
-								int64_t d[4] = {};
-								for (size_t x = 0; x < 4; ++x)
-								{
+									//Perform FMA (a * b) + c								
+									int64_t d[4] = {};
+									for (size_t x = 0; x < 4; ++x)
+									{
 #ifdef _WIN32
-									d[x] = _a.m256i_i64[x] * _b.m256i_i64[x];
+										d[x] = _a.m256i_i64[x] * _b.m256i_i64[x];
 #else
-									d[x] = static_cast<int64_t>(_a[x] * _b[x]);
+										d[x] = static_cast<int64_t>(_a[x] * _b[x]);
 #endif
 
-								}//End for
-								_dest = _mm256_load_si256((__m256i*) & d);
-								
-								_dest = _mm256_add_epi64(_dest, _c);
+									}//End for
+									_dest = _mm256_loadu_si256((__m256i*) & d);
+									
+									_dest = _mm256_add_epi64(_dest, _c);
 
-								//Store Result
-								_mm256_store_si256((__m256i*) & dest[i], _dest);
-							}//End for
-						}//End if hasAVX2
+									//Store Result
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
+								}//End for
+							}();//End if hasAVX2
 #endif
-					}//End if
+						}//End if
 #pragma endregion
 #pragma region unsigned long
-					else if constexpr (std::is_same<T, uint64_t>())
-					{
-#ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						else if constexpr (std::is_same<T, uint64_t>())
 						{
-							__m512i _a, _b, _c, _dest;
-
-							for (; i < end; i += 8)
-							{
-								if ((i + 8) > end) [[unlikely]]
-								{
-									break;
-								}//End if
+#ifdef TPA_X86_64
+							if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
+							{
+								__m512i _a, _b, _c, _dest;
 
-								//Load
-								_a = _mm512_load_epi64((__m512i*)&arr_a[i]);
-								_b = _mm512_load_epi64((__m512i*)&arr_b[i]);
-								_c = _mm512_load_epi64((__m512i*)&arr_c[i]);
+								for (; i < end; i += 8)
+								{
+									if ((i + 8) > end) [[unlikely]]
+									{
+										break;
+									}//End if
 
-								//Perform FMA (a * b) + c
-								_dest = _mm512_mullox_epi64(_a, _b);
-								_dest = _mm512_add_epi64(_dest, _c);
+									//Load
+									_a = _mm512_loadu_epi64((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi64((__m512i*)&arr_b[i]);
+									_c = _mm512_loadu_epi64((__m512i*)&arr_c[i]);
 
-								//Store Result
-								_mm512_store_epi64((__m512i*)&dest[i], _dest);
-							}//End for
-						}//End if hasAVX512
-						else if (tpa::hasAVX2)
-						{
-							__m256i _a, _b, _c, _dest;
+									//Perform FMA (a * b) + c
+									_dest = _mm512_mullox_epi64(_a, _b);
+									_dest = _mm512_add_epi64(_dest, _c);
 
-							for (; i < end; i += 4)
+									//Store Result
+									_mm512_storeu_epi64((__m512i*)&dest[i], _dest);
+								}//End for
+							}();//End if hasAVX512
+							else if (tpa::hasAVX2) [&]() TPA_TARGET("avx2")
 							{
-								if ((i + 4) > end) [[unlikely]]
+								__m256i _a, _b, _c, _dest;
+
+								for (; i < end; i += 4)
 								{
-									break;
-								}//End if
+									if ((i + 4) > end) [[unlikely]]
+									{
+										break;
+									}//End if
 
-								//Load
-								_a = _mm256_load_si256((__m256i*) &arr_a[i]);
-								_b = _mm256_load_si256((__m256i*) &arr_b[i]);
-								_c = _mm256_load_si256((__m256i*) &arr_c[i]);
+									//Load
+									_a = _mm256_loadu_si256((__m256i*) &arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) &arr_b[i]);
+									_c = _mm256_loadu_si256((__m256i*) &arr_c[i]);
 
-								//Perform FMA (a * b) + c
-								uint64_t d[4] = {};
-								for (size_t x = 0; x < 4; ++x)
-								{
+									//Perform FMA (a * b) + c
+									uint64_t d[4] = {};
+									for (size_t x = 0; x < 4; ++x)
+									{
 #ifdef _WIN32
-									d[x] = _a.m256i_u64[x] * _b.m256i_u64[x];
+										d[x] = _a.m256i_u64[x] * _b.m256i_u64[x];
 #else
-									d[x] = static_cast<uint64_t>(_a[x] * _b[x]);
+										d[x] = static_cast<uint64_t>(_a[x] * _b[x]);
 #endif
-								}//End for
-								_dest = _mm256_load_si256((__m256i*) &d);
+									}//End for
+									_dest = _mm256_loadu_si256((__m256i*) &d);
 
-								_dest = _mm256_add_epi64(_dest, _c);
+									_dest = _mm256_add_epi64(_dest, _c);
 
-								//Store Result
-								_mm256_store_si256((__m256i*) &dest[i], _dest);
-							}//End for
-						}//End if hasAVX2
+									//Store Result
+									_mm256_storeu_si256((__m256i*) &dest[i], _dest);
+								}//End for
+							}();//End if hasAVX2
 #endif
-					}//End if
+						}//End if
 #pragma endregion
 #pragma region float
-					else if constexpr (std::is_same<T, float>())
-					{
-#ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						else if constexpr (std::is_same<T, float>())
 						{
-							__m512 _a, _b, _c, _dest;
-
-							for (; i < end; i += 16)
+#ifdef TPA_X86_64
+							if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 							{
-								if ((i + 16) > end) [[unlikely]]
-								{
-									break;
-								}//End if
+								__m512 _a, _b, _c, _dest;
 
-								//Load
-								_a = _mm512_load_ps(&arr_a[i]);
-								_b = _mm512_load_ps(&arr_b[i]);
-								_c = _mm512_load_ps(&arr_c[i]);
+								for (; i < end; i += 16)
+								{
+									if ((i + 16) > end) [[unlikely]]
+									{
+										break;
+									}//End if
 
-								//Perform FMA (a * b) + c
-								_dest = _mm512_fmadd_ps(_a, _b, _c);
+									//Load
+									_a = _mm512_loadu_ps(&arr_a[i]);
+									_b = _mm512_loadu_ps(&arr_b[i]);
+									_c = _mm512_loadu_ps(&arr_c[i]);
 
-								//Store Result
-								_mm512_store_ps(&dest[i], _dest);
-							}//End for
-						}//End if hasAVX512
-						else if (tpa::hasFMA && tpa::hasAVX)
-						{
-							__m256 _a, _b, _c, _dest;
+									//Perform FMA (a * b) + c
+									_dest = _mm512_fmadd_ps(_a, _b, _c);
 
-							for (; i < end; i += 8)
+									//Store Result
+									_mm512_storeu_ps(&dest[i], _dest);
+								}//End for
+							}();//End if hasAVX512
+							else if (tpa::hasFMA && tpa::hasAVX) [&]() TPA_TARGET("avx,fma")
 							{
-								if ((i + 8) > end) [[unlikely]]
+								__m256 _a, _b, _c, _dest;
+
+								for (; i < end; i += 8)
 								{
-									break;
-								}//End if
+									if ((i + 8) > end) [[unlikely]]
+									{
+										break;
+									}//End if
 
-								//Load
-								_a = _mm256_load_ps(&arr_a[i]);
-								_b = _mm256_load_ps(&arr_b[i]);
-								_c = _mm256_load_ps(&arr_c[i]);
+									//Load
+									_a = _mm256_loadu_ps(&arr_a[i]);
+									_b = _mm256_loadu_ps(&arr_b[i]);
+									_c = _mm256_loadu_ps(&arr_c[i]);
 
-								//Perform FMA (a * b) + c
-								_dest = _mm256_fmadd_ps(_a, _b, _c);
+									//Perform FMA (a * b) + c
+									_dest = _mm256_fmadd_ps(_a, _b, _c);
 
-								//Store Result
-								_mm256_store_ps(&dest[i], _dest);
-							}//End for
-						}//End if hasFMA
+									//Store Result
+									_mm256_storeu_ps(&dest[i], _dest);
+								}//End for
+							}();//End if hasFMA
 #endif
-					}//End if
+						}//End if
 #pragma endregion
 #pragma region double
-					else if constexpr (std::is_same<T, double>())
-					{
-#ifdef TPA_X86_64
-						if (tpa::hasAVX512)
+						else if constexpr (std::is_same<T, double>())
 						{
-							__m512d _a, _b, _c, _dest;
-
-							for (; i < end; i += 8)
+#ifdef TPA_X86_64
+							if (tpa::hasAVX512) [&]() TPA_TARGET("avx512f")
 							{
-								if ((i + 8) > end) [[unlikely]]
-								{
-									break;
-								}//End if
+								__m512d _a, _b, _c, _dest;
 
-								//Load
-								_a = _mm512_load_pd(&arr_a[i]);
-								_b = _mm512_load_pd(&arr_b[i]);
-								_c = _mm512_load_pd(&arr_c[i]);
+								for (; i < end; i += 8)
+								{
+									if ((i + 8) > end) [[unlikely]]
+									{
+										break;
+									}//End if
 
-								//Perform FMA (a * b) + c
-								_dest = _mm512_fmadd_pd(_a, _b, _c);
+									//Load
+									_a = _mm512_loadu_pd(&arr_a[i]);
+									_b = _mm512_loadu_pd(&arr_b[i]);
+									_c = _mm512_loadu_pd(&arr_c[i]);
 
-								//Store Result
-								_mm512_store_pd(&dest[i], _dest);
-							}//End for
-						}//End if hasAVX512
-						else if (tpa::hasFMA && tpa::hasAVX)
-						{
-							__m256d _a, _b, _c, _dest;
+									//Perform FMA (a * b) + c
+									_dest = _mm512_fmadd_pd(_a, _b, _c);
 
-							for (; i < end; i += 4)
+									//Store Result
+									_mm512_storeu_pd(&dest[i], _dest);
+								}//End for
+							}();//End if hasAVX512
+							else if (tpa::hasFMA && tpa::hasAVX) [&]() TPA_TARGET("avx,fma")
 							{
-								if ((i + 4) > end) [[unlikely]]
+								__m256d _a, _b, _c, _dest;
+
+								for (; i < end; i += 4)
 								{
-									break;
-								}//End if
+									if ((i + 4) > end) [[unlikely]]
+									{
+										break;
+									}//End if
 
-								//Load
-								_a = _mm256_load_pd(&arr_a[i]);
-								_b = _mm256_load_pd(&arr_b[i]);
-								_c = _mm256_load_pd(&arr_c[i]);
+									//Load
+									_a = _mm256_loadu_pd(&arr_a[i]);
+									_b = _mm256_loadu_pd(&arr_b[i]);
+									_c = _mm256_loadu_pd(&arr_c[i]);
 
-								//Perform FMA (a * b) + c
-								_dest = _mm256_fmadd_pd(_a, _b, _c);
+									//Perform FMA (a * b) + c
+									_dest = _mm256_fmadd_pd(_a, _b, _c);
 
-								//Store Result
-								_mm256_store_pd(&dest[i], _dest);
-							}//End for
-						}//End if hasFMA
+									//Store Result
+									_mm256_storeu_pd(&dest[i], _dest);
+								}//End for
+							}();//End if hasFMA
+#endif
+						}//End if
+#pragma endregion
+#pragma region neon
+#ifdef TPA_NEON
+						if constexpr (tpa::simd::is_vec_type<T>)
+						{
+							if (tpa::hasNeon)
+							{
+								tpa_fma_private::fma_neon<T>(i, end, arr_a.data(), arr_b.data(), arr_c.data(), dest.data());
+							}//End if
+						}//End if
 #endif
-					}//End if
 #pragma endregion
 #pragma region generic
-					for (; i < end; ++i)
-					{
-						dest[i] = static_cast<T>((arr_a[i] * arr_b[i]) + arr_c[i]);
-					}//End for
+						for (; i < end; ++i)
+						{
+							dest[i] = static_cast<T>((arr_a[i] * arr_b[i]) + arr_c[i]);
+						}//End for
 #pragma endregion
+						}//End for
+
 					return static_cast<uint32_t>(1);
 				});//End of lambda
 
@@ -737,14 +828,6 @@ namespace tpa{
 				throw tpa::exceptions::NotAllThreadsCompleted(complete);
 			}//End if
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::fma(): " << ex.what() << "\n";
-			std::cerr << "tpa::fma will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -799,9 +882,9 @@ namespace tpa{
 		{
 
 			static_assert(
-				std::is_same<CONTAINER_A::value_type, CONTAINER_B::value_type>() &&
-				std::is_same<CONTAINER_A::value_type, T>() &&
-				std::is_same<CONTAINER_A::value_type, C_DEST::value_type>(),
+				std::is_same<typename CONTAINER_A::value_type, typename CONTAINER_B::value_type>() &&
+				std::is_same<typename CONTAINER_A::value_type, T>() &&
+				std::is_same<typename CONTAINER_A::value_type, typename C_DEST::value_type>(),
 				"Compile Error! All the source and destination containers and the constant val must be of the same value_type!");
 
 			//Determin the smallest container
@@ -809,11 +892,12 @@ namespace tpa{
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::fma_const_add(): " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::fma_const_add will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
 
-		recover:
-
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
 
@@ -884,8 +968,8 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
 
 									//Perform FMA (a * b) + c	
 									int8_t d[32] = {};
@@ -897,12 +981,12 @@ namespace tpa{
 										d[x] = static_cast<int8_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi8(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -959,8 +1043,8 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
 
 									//Perform FMA (a * b) + c	
 									uint8_t d[32] = {};
@@ -972,12 +1056,12 @@ namespace tpa{
 										d[x] = static_cast<uint8_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi8(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -1024,15 +1108,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi16(_a, _b);
 									_dest = _mm256_add_epi16(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -1079,15 +1163,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi16(_a, _b);
 									_dest = _mm256_add_epi16(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -1110,15 +1194,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi32((__m512i*)&arr_a[i]);
-									_b = _mm512_load_epi32((__m512i*)&arr_b[i]);
+									_a = _mm512_loadu_epi32((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi32((__m512i*)&arr_b[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullo_epi32(_a, _b);
 									_dest = _mm512_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -1134,15 +1218,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi32(_a, _b);
 									_dest = _mm256_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -1165,15 +1249,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi32((__m512i*)&arr_a[i]);
-									_b = _mm512_load_epi32((__m512i*)&arr_b[i]);
+									_a = _mm512_loadu_epi32((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi32((__m512i*)&arr_b[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullo_epi32(_a, _b);
 									_dest = _mm512_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -1189,15 +1273,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi32(_a, _b);
 									_dest = _mm256_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -1220,21 +1304,21 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi64((__m512i*)&arr_a[i]);
-									_b = _mm512_load_epi64((__m512i*)&arr_b[i]);
+									_a = _mm512_loadu_epi64((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi64((__m512i*)&arr_b[i]);
 
 									//Perform FMA (a * b) + c								
 									_dest = _mm512_mullox_epi64(_a, _b);
 									_dest = _mm512_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi64((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi64((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
 							{
 								__m256i _a, _b, _dest;
-								const __m256i _c = _mm256_set1_epi64(const_val);
+								const __m256i _c = _mm256_set1_epi64x(const_val);
 
 								for (; i < end; i += 4)
 								{
@@ -1244,8 +1328,8 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
 
 									//Perform FMA (a * b) + c								
 									int64_t d[4] = {};
@@ -1257,12 +1341,12 @@ namespace tpa{
 										d[x] = static_cast<int64_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -1285,21 +1369,21 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi64((__m512i*)&arr_a[i]);
-									_b = _mm512_load_epi64((__m512i*)&arr_b[i]);
+									_a = _mm512_loadu_epi64((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi64((__m512i*)&arr_b[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullox_epi64(_a, _b);
 									_dest = _mm512_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi64((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi64((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
 							{
 								__m256i _a, _b, _dest;
-								const __m256i _c = _mm256_set1_epi64(const_val);
+								const __m256i _c = _mm256_set1_epi64x(const_val);
 
 								for (; i < end; i += 4)
 								{
@@ -1309,8 +1393,8 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
 
 									//Perform FMA (a * b) + c
 									uint64_t d[4] = {};
@@ -1322,12 +1406,12 @@ namespace tpa{
 										d[x] = static_cast<uint64_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -1350,14 +1434,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_ps(&arr_a[i]);
-									_b = _mm512_load_ps(&arr_b[i]);
+									_a = _mm512_loadu_ps(&arr_a[i]);
+									_b = _mm512_loadu_ps(&arr_b[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_fmadd_ps(_a, _b, _c);
 
 									//Store Result
-									_mm512_store_ps(&dest[i], _dest);
+									_mm512_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasFMA && tpa::hasAVX)
@@ -1373,14 +1457,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_ps(&arr_a[i]);
-									_b = _mm256_load_ps(&arr_b[i]);
+									_a = _mm256_loadu_ps(&arr_a[i]);
+									_b = _mm256_loadu_ps(&arr_b[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm256_fmadd_ps(_a, _b, _c);
 
 									//Store Result
-									_mm256_store_ps(&dest[i], _dest);
+									_mm256_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End if hasFMA
 #endif
@@ -1403,14 +1487,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_pd(&arr_a[i]);
-									_b = _mm512_load_pd(&arr_b[i]);
+									_a = _mm512_loadu_pd(&arr_a[i]);
+									_b = _mm512_loadu_pd(&arr_b[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_fmadd_pd(_a, _b, _c);
 
 									//Store Result
-									_mm512_store_pd(&dest[i], _dest);
+									_mm512_storeu_pd(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasFMA && tpa::hasAVX)
@@ -1426,19 +1510,30 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_pd(&arr_a[i]);
-									_b = _mm256_load_pd(&arr_b[i]);
+									_a = _mm256_loadu_pd(&arr_a[i]);
+									_b = _mm256_loadu_pd(&arr_b[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm256_fmadd_pd(_a, _b, _c);
 
 									//Store Result
-									_mm256_store_pd(&dest[i], _dest);
+									_mm256_storeu_pd(&dest[i], _dest);
 								}//End for
 							}//End if hasFMA
 #endif
 						}//End if
 #pragma endregion
+#pragma region neon
+#ifdef TPA_NEON
+						if constexpr (tpa::simd::is_vec_type<T>)
+						{
+							if (tpa::hasNeon)
+							{
+								tpa_fma_private::fma_const_add_neon<T>(i, end, arr_a.data(), arr_b.data(), const_val, dest.data());
+							}//End if
+						}//End if
+#endif
+#pragma endregion
 #pragma region generic
 						for (; i < end; ++i)
 						{
@@ -1462,14 +1557,6 @@ namespace tpa{
 				throw tpa::exceptions::NotAllThreadsCompleted(complete);
 			}//End if
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::fma_const_add(): " << ex.what() << "\n";
-			std::cerr << "tpa::fma_const_add will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -1524,9 +1611,9 @@ namespace tpa{
 		{
 
 			static_assert(
-				std::is_same<CONTAINER_A::value_type, T>() &&
-				std::is_same<CONTAINER_A::value_type, CONTAINER_C::value_type>() &&
-				std::is_same<CONTAINER_A::value_type, C_DEST::value_type>(),
+				std::is_same<typename CONTAINER_A::value_type, T>() &&
+				std::is_same<typename CONTAINER_A::value_type, typename CONTAINER_C::value_type>() &&
+				std::is_same<typename CONTAINER_A::value_type, typename C_DEST::value_type>(),
 				"Compile Error! All the source and destination containers and the constant value must be of the same value_type!");
 
 			//Determin the smallest container
@@ -1534,11 +1621,12 @@ namespace tpa{
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::fma_const_multiply(): " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::fma will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
 
-		recover:
-
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
 
@@ -1609,8 +1697,8 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									int8_t d[32] = {};
@@ -1622,12 +1710,12 @@ namespace tpa{
 										d[x] = static_cast<int8_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi8(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -1684,8 +1772,8 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									uint8_t d[32] = {};
@@ -1697,12 +1785,12 @@ namespace tpa{
 										d[x] = static_cast<uint8_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi8(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -1749,15 +1837,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi16(_a, _b);
 									_dest = _mm256_add_epi16(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -1804,15 +1892,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi16(_a, _b);
 									_dest = _mm256_add_epi16(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -1835,15 +1923,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi32((__m512i*)&arr_a[i]);
-									_c = _mm512_load_epi32((__m512i*)&arr_c[i]);
+									_a = _mm512_loadu_epi32((__m512i*)&arr_a[i]);
+									_c = _mm512_loadu_epi32((__m512i*)&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullo_epi32(_a, _b);
 									_dest = _mm512_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -1859,15 +1947,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi32(_a, _b);
 									_dest = _mm256_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -1890,15 +1978,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi32((__m512i*)&arr_a[i]);
-									_c = _mm512_load_epi32((__m512i*)&arr_c[i]);
+									_a = _mm512_loadu_epi32((__m512i*)&arr_a[i]);
+									_c = _mm512_loadu_epi32((__m512i*)&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullo_epi32(_a, _b);
 									_dest = _mm512_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -1914,15 +2002,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi32(_a, _b);
 									_dest = _mm256_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -1945,15 +2033,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi64((__m512i*)&arr_a[i]);
-									_c = _mm512_load_epi64((__m512i*)&arr_c[i]);
+									_a = _mm512_loadu_epi64((__m512i*)&arr_a[i]);
+									_c = _mm512_loadu_epi64((__m512i*)&arr_c[i]);
 
 									//Perform FMA (a * b) + c								
 									_dest = _mm512_mullox_epi64(_a, _b);
 									_dest = _mm512_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi64((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi64((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -1969,8 +2057,8 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c								
 									int64_t d[4] = {};
@@ -1982,12 +2070,12 @@ namespace tpa{
 										d[x] = static_cast<int64_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -2010,15 +2098,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi64((__m512i*)&arr_a[i]);
-									_c = _mm512_load_epi64((__m512i*)&arr_c[i]);
+									_a = _mm512_loadu_epi64((__m512i*)&arr_a[i]);
+									_c = _mm512_loadu_epi64((__m512i*)&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullox_epi64(_a, _b);
 									_dest = _mm512_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi64((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi64((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -2034,8 +2122,8 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									uint64_t d[4] = {};
@@ -2047,12 +2135,12 @@ namespace tpa{
 										d[x] = static_cast<uint64_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -2075,14 +2163,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_ps(&arr_a[i]);
-									_c = _mm512_load_ps(&arr_c[i]);
+									_a = _mm512_loadu_ps(&arr_a[i]);
+									_c = _mm512_loadu_ps(&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_fmadd_ps(_a, _b, _c);
 
 									//Store Result
-									_mm512_store_ps(&dest[i], _dest);
+									_mm512_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasFMA && tpa::hasAVX)
@@ -2098,14 +2186,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_ps(&arr_a[i]);
-									_c = _mm256_load_ps(&arr_c[i]);
+									_a = _mm256_loadu_ps(&arr_a[i]);
+									_c = _mm256_loadu_ps(&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm256_fmadd_ps(_a, _b, _c);
 
 									//Store Result
-									_mm256_store_ps(&dest[i], _dest);
+									_mm256_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End if hasFMA
 #endif
@@ -2128,14 +2216,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_pd(&arr_a[i]);
-									_c = _mm512_load_pd(&arr_c[i]);
+									_a = _mm512_loadu_pd(&arr_a[i]);
+									_c = _mm512_loadu_pd(&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_fmadd_pd(_a, _b, _c);
 
 									//Store Result
-									_mm512_store_pd(&dest[i], _dest);
+									_mm512_storeu_pd(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasFMA && tpa::hasAVX)
@@ -2151,19 +2239,30 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_pd(&arr_a[i]);
-									_c = _mm256_load_pd(&arr_c[i]);
+									_a = _mm256_loadu_pd(&arr_a[i]);
+									_c = _mm256_loadu_pd(&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm256_fmadd_pd(_a, _b, _c);
 
 									//Store Result
-									_mm256_store_pd(&dest[i], _dest);
+									_mm256_storeu_pd(&dest[i], _dest);
 								}//End for
 							}//End if hasFMA
 #endif
 						}//End if
 #pragma endregion
+#pragma region neon
+#ifdef TPA_NEON
+						if constexpr (tpa::simd::is_vec_type<T>)
+						{
+							if (tpa::hasNeon)
+							{
+								tpa_fma_private::fma_const_multiply_neon<T>(i, end, arr_a.data(), const_val, arr_c.data(), dest.data());
+							}//End if
+						}//End if
+#endif
+#pragma endregion
 #pragma region generic
 						for (; i < end; ++i)
 						{
@@ -2187,14 +2286,6 @@ namespace tpa{
 				throw tpa::exceptions::NotAllThreadsCompleted(complete);
 			}//End if
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::fma_const_multiply(): " << ex.what() << "\n";
-			std::cerr << "tpa::fma will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -2248,15 +2339,13 @@ namespace tpa{
 		{
 
 			static_assert(
-				std::is_same<CONTAINER_A::value_type, T>() &&
-				std::is_same<CONTAINER_A::value_type, C_DEST::value_type>(),
+				std::is_same<typename CONTAINER_A::value_type, T>() &&
+				std::is_same<typename CONTAINER_A::value_type, typename C_DEST::value_type>(),
 				"Compile Error! All the source and destination containers and the constant value must be of the same value_type!");
 
 			//Determin the smallest container
 			smallest = tpa::util::min(arr_a.size(), dest.size());
 
-		recover:
-
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
 
@@ -2329,7 +2418,7 @@ namespace tpa{
 								}//End if
 
 								//Load
-								_a = _mm256_load_si256((__m256i*) & arr_a[i]);
+								_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
 
 								//Perform FMA (a * b) + c	
 								int8_t d[32] = {};
@@ -2341,12 +2430,12 @@ namespace tpa{
 									d[x] = static_cast<int8_t>(_a[x] * _b[x]);
 #endif
 								}//End for
-								_dest = _mm256_load_si256((__m256i*) & d);
+								_dest = _mm256_loadu_si256((__m256i*) & d);
 
 								_dest = _mm256_add_epi8(_dest, _c);
 
 								//Store Result
-								_mm256_store_si256((__m256i*) & dest[i], _dest);
+								_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 							}//End for
 						}//End if hasAVX2
 #endif
@@ -2404,7 +2493,7 @@ namespace tpa{
 								}//End if
 
 								//Load
-								_a = _mm256_load_si256((__m256i*) & arr_a[i]);
+								_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
 
 								//Perform FMA (a * b) + c	
 								uint8_t d[32] = {};
@@ -2416,12 +2505,12 @@ namespace tpa{
 									d[x] = static_cast<uint8_t>(_a[x] * _b[x]);
 #endif
 								}//End for
-								_dest = _mm256_load_si256((__m256i*) & d);
+								_dest = _mm256_loadu_si256((__m256i*) & d);
 
 								_dest = _mm256_add_epi8(_dest, _c);
 
 								//Store Result
-								_mm256_store_si256((__m256i*) & dest[i], _dest);
+								_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 							}//End for
 						}//End if hasAVX2
 #endif
@@ -2469,14 +2558,14 @@ namespace tpa{
 								}//End if
 
 								//Load
-								_a = _mm256_load_si256((__m256i*) & arr_a[i]);
+								_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
 
 								//Perform FMA (a * b) + c	
 								_dest = _mm256_mullo_epi16(_a, _b);
 								_dest = _mm256_add_epi16(_dest, _c);
 
 								//Store Result
-								_mm256_store_si256((__m256i*) & dest[i], _dest);
+								_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 							}//End for
 						}//End if hasAVX2
 #endif
@@ -2524,14 +2613,14 @@ namespace tpa{
 								}//End if
 
 								//Load
-								_a = _mm256_load_si256((__m256i*) & arr_a[i]);
+								_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
 
 								//Perform FMA (a * b) + c	
 								_dest = _mm256_mullo_epi16(_a, _b);
 								_dest = _mm256_add_epi16(_dest, _c);
 
 								//Store Result
-								_mm256_store_si256((__m256i*) & dest[i], _dest);
+								_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 							}//End for
 						}//End if hasAVX2
 #endif
@@ -2555,14 +2644,14 @@ namespace tpa{
 								}//End if
 
 								//Load
-								_a = _mm512_load_epi32((__m512i*)&arr_a[i]);
+								_a = _mm512_loadu_epi32((__m512i*)&arr_a[i]);
 
 								//Perform FMA (a * b) + c
 								_dest = _mm512_mullo_epi32(_a, _b);
 								_dest = _mm512_add_epi32(_dest, _c);
 
 								//Store Result
-								_mm512_store_epi32((__m512i*)&dest[i], _dest);
+								_mm512_storeu_epi32((__m512i*)&dest[i], _dest);
 							}//End for
 						}//End if hasAVX512
 						else if (tpa::hasAVX2)
@@ -2579,14 +2668,14 @@ namespace tpa{
 								}//End if
 
 								//Load
-								_a = _mm256_load_si256((__m256i*) & arr_a[i]);
+								_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
 
 								//Perform FMA (a * b) + c	
 								_dest = _mm256_mullo_epi32(_a, _b);
 								_dest = _mm256_add_epi32(_dest, _c);
 
 								//Store Result
-								_mm256_store_si256((__m256i*) & dest[i], _dest);
+								_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 							}//End for
 						}//End if hasAVX2
 #endif
@@ -2610,14 +2699,14 @@ namespace tpa{
 								}//End if
 
 								//Load
-								_a = _mm512_load_epi32((__m512i*)&arr_a[i]);
+								_a = _mm512_loadu_epi32((__m512i*)&arr_a[i]);
 
 								//Perform FMA (a * b) + c
 								_dest = _mm512_mullo_epi32(_a, _b);
 								_dest = _mm512_add_epi32(_dest, _c);
 
 								//Store Result
-								_mm512_store_epi32((__m512i*)&dest[i], _dest);
+								_mm512_storeu_epi32((__m512i*)&dest[i], _dest);
 							}//End for
 						}//End if hasAVX512
 						else if (tpa::hasAVX2)
@@ -2634,14 +2723,14 @@ namespace tpa{
 								}//End if
 
 								//Load
-								_a = _mm256_load_si256((__m256i*) & arr_a[i]);
+								_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
 
 								//Perform FMA (a * b) + c	
 								_dest = _mm256_mullo_epi32(_a, _b);
 								_dest = _mm256_add_epi32(_dest, _c);
 
 								//Store Result
-								_mm256_store_si256((__m256i*) & dest[i], _dest);
+								_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 							}//End for
 						}//End if hasAVX2
 #endif
@@ -2665,14 +2754,14 @@ namespace tpa{
 								}//End if
 
 								//Load
-								_a = _mm512_load_epi64((__m512i*)&arr_a[i]);
+								_a = _mm512_loadu_epi64((__m512i*)&arr_a[i]);
 
 								//Perform FMA (a * b) + c								
 								_dest = _mm512_mullox_epi64(_a, _b);
 								_dest = _mm512_add_epi64(_dest, _c);
 
 								//Store Result
-								_mm512_store_epi64((__m512i*)&dest[i], _dest);
+								_mm512_storeu_epi64((__m512i*)&dest[i], _dest);
 							}//End for
 						}//End if hasAVX512
 						else if (tpa::hasFMA && tpa::hasAVX2)
@@ -2689,7 +2778,7 @@ namespace tpa{
 								}//End if
 
 								//Load
-								_a = _mm256_load_si256((__m256i*) & arr_a[i]);
+								_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
 
 								//Perform FMA (a * b) + c								
 								int64_t d[4] = {};
@@ -2701,12 +2790,12 @@ namespace tpa{
 									d[x] = static_cast<int64_t>(_a[x] * _b[x]);
 #endif
 								}//End for
-								_dest = _mm256_load_si256((__m256i*) & d);
+								_dest = _mm256_loadu_si256((__m256i*) & d);
 
 								_dest = _mm256_add_epi64(_dest, _c);
 
 								//Store Result
-								_mm256_store_si256((__m256i*) & dest[i], _dest);
+								_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 							}//End for
 						}//End if hasAVX2
 #endif
@@ -2730,14 +2819,14 @@ namespace tpa{
 								}//End if
 
 								//Load
-								_a = _mm512_load_epi64((__m512i*)&arr_a[i]);
+								_a = _mm512_loadu_epi64((__m512i*)&arr_a[i]);
 
 								//Perform FMA (a * b) + c
 								_dest = _mm512_mullox_epi64(_a, _b);
 								_dest = _mm512_add_epi64(_dest, _c);
 
 								//Store Result
-								_mm512_store_epi64((__m512i*)&dest[i], _dest);
+								_mm512_storeu_epi64((__m512i*)&dest[i], _dest);
 							}//End for
 						}//End if hasAVX512
 						else if (tpa::hasAVX2)
@@ -2754,7 +2843,7 @@ namespace tpa{
 								}//End if
 
 								//Load
-								_a = _mm256_load_si256((__m256i*) & arr_a[i]);
+								_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
 
 								//Perform FMA (a * b) + c
 								uint64_t d[4] = {};
@@ -2766,12 +2855,12 @@ namespace tpa{
 									d[x] = static_cast<uint64_t>(_a[x] * _b[x]);
 #endif
 								}//End for
-								_dest = _mm256_load_si256((__m256i*) & d);
+								_dest = _mm256_loadu_si256((__m256i*) & d);
 
 								_dest = _mm256_add_epi64(_dest, _c);
 
 								//Store Result
-								_mm256_store_si256((__m256i*) & dest[i], _dest);
+								_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 							}//End for
 						}//End if hasFMA
 #endif
@@ -2795,13 +2884,13 @@ namespace tpa{
 								}//End if
 
 								//Load
-								_a = _mm512_load_ps(&arr_a[i]);
+								_a = _mm512_loadu_ps(&arr_a[i]);
 
 								//Perform FMA (a * b) + c
 								_dest = _mm512_fmadd_ps(_a, _b, _c);
 
 								//Store Result
-								_mm512_store_ps(&dest[i], _dest);
+								_mm512_storeu_ps(&dest[i], _dest);
 							}//End for
 						}//End if hasAVX512
 						else if (tpa::hasFMA && tpa::hasAVX)
@@ -2818,13 +2907,13 @@ namespace tpa{
 								}//End if
 
 								//Load
-								_a = _mm256_load_ps(&arr_a[i]);
+								_a = _mm256_loadu_ps(&arr_a[i]);
 
 								//Perform FMA (a * b) + c
 								_dest = _mm256_fmadd_ps(_a, _b, _c);
 
 								//Store Result
-								_mm256_store_ps(&dest[i], _dest);
+								_mm256_storeu_ps(&dest[i], _dest);
 							}//End for
 						}//End if hasFMA
 #endif
@@ -2848,13 +2937,13 @@ namespace tpa{
 								}//End if
 
 								//Load
-								_a = _mm512_load_pd(&arr_a[i]);
+								_a = _mm512_loadu_pd(&arr_a[i]);
 
 								//Perform FMA (a * b) + c
 								_dest = _mm512_fmadd_pd(_a, _b, _c);
 
 								//Store Result
-								_mm512_store_pd(&dest[i], _dest);
+								_mm512_storeu_pd(&dest[i], _dest);
 							}//End for
 						}//End if hasAVX512
 						else if (tpa::hasFMA && tpa::hasAVX)
@@ -2871,18 +2960,29 @@ namespace tpa{
 								}//End if
 
 								//Load
-								_a = _mm256_load_pd(&arr_a[i]);
+								_a = _mm256_loadu_pd(&arr_a[i]);
 
 								//Perform FMA (a * b) + c
 								_dest = _mm256_fmadd_pd(_a, _b, _c);
 
 								//Store Result
-								_mm256_store_pd(&dest[i], _dest);
+								_mm256_storeu_pd(&dest[i], _dest);
 							}//End for
 						}//End if hasFMA
 #endif
 					}//End if
 #pragma endregion
+#pragma region neon
+#ifdef TPA_NEON
+					if constexpr (tpa::simd::is_vec_type<T>)
+					{
+						if (tpa::hasNeon)
+						{
+							tpa_fma_private::fma_const_multiply_add_neon<T>(i, end, arr_a.data(), const_val, const_val_c, dest.data());
+						}//End if
+					}//End if
+#endif
+#pragma endregion
 #pragma region generic
 					for (; i < end; ++i)
 					{
@@ -2906,14 +3006,6 @@ namespace tpa{
 				throw tpa::exceptions::NotAllThreadsCompleted(complete);
 			}//End if
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::fma_const_multiply_add(): " << ex.what() << "\n";
-			std::cerr << "tpa::fma_const_multiply_add will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -3042,9 +3134,9 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									int8_t d[32] = {};
@@ -3056,12 +3148,12 @@ namespace tpa{
 										d[x] = static_cast<int8_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi8(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -3117,9 +3209,9 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									uint8_t d[32] = {};
@@ -3131,12 +3223,12 @@ namespace tpa{
 										d[x] = static_cast<uint8_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi8(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -3182,16 +3274,16 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi16(_a, _b);
 									_dest = _mm256_add_epi16(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -3237,16 +3329,16 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi16(_a, _b);
 									_dest = _mm256_add_epi16(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -3268,16 +3360,16 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi32((__m512i*)&arr_a[i]);
-									_b = _mm512_load_epi32((__m512i*)&arr_b[i]);
-									_c = _mm512_load_epi32((__m512i*)&arr_c[i]);
+									_a = _mm512_loadu_epi32((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi32((__m512i*)&arr_b[i]);
+									_c = _mm512_loadu_epi32((__m512i*)&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullo_epi32(_a, _b);
 									_dest = _mm512_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -3292,16 +3384,16 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi32(_a, _b);
 									_dest = _mm256_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -3323,16 +3415,16 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi32((__m512i*)&arr_a[i]);
-									_b = _mm512_load_epi32((__m512i*)&arr_b[i]);
-									_c = _mm512_load_epi32((__m512i*)&arr_c[i]);
+									_a = _mm512_loadu_epi32((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi32((__m512i*)&arr_b[i]);
+									_c = _mm512_loadu_epi32((__m512i*)&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullo_epi32(_a, _b);
 									_dest = _mm512_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -3347,16 +3439,16 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi32(_a, _b);
 									_dest = _mm256_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -3378,16 +3470,16 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi64((__m512i*)&arr_a[i]);
-									_b = _mm512_load_epi64((__m512i*)&arr_b[i]);
-									_c = _mm512_load_epi64((__m512i*)&arr_c[i]);
+									_a = _mm512_loadu_epi64((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi64((__m512i*)&arr_b[i]);
+									_c = _mm512_loadu_epi64((__m512i*)&arr_c[i]);
 
 									//Perform FMA (a * b) + c								
 									_dest = _mm512_mullox_epi64(_a, _b);
 									_dest = _mm512_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi64((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi64((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -3402,9 +3494,9 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c								
 									int64_t d[4] = {};
@@ -3417,12 +3509,12 @@ namespace tpa{
 #endif
 
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -3444,16 +3536,16 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi64((__m512i*)&arr_a[i]);
-									_b = _mm512_load_epi64((__m512i*)&arr_b[i]);
-									_c = _mm512_load_epi64((__m512i*)&arr_c[i]);
+									_a = _mm512_loadu_epi64((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi64((__m512i*)&arr_b[i]);
+									_c = _mm512_loadu_epi64((__m512i*)&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullox_epi64(_a, _b);
 									_dest = _mm512_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi64((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi64((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -3468,9 +3560,9 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									uint64_t d[4] = {};
@@ -3482,12 +3574,12 @@ namespace tpa{
 										d[x] = static_cast<uint64_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -3509,15 +3601,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_ps(&arr_a[i]);
-									_b = _mm512_load_ps(&arr_b[i]);
-									_c = _mm512_load_ps(&arr_c[i]);
+									_a = _mm512_loadu_ps(&arr_a[i]);
+									_b = _mm512_loadu_ps(&arr_b[i]);
+									_c = _mm512_loadu_ps(&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_fmadd_ps(_a, _b, _c);
 
 									//Store Result
-									_mm512_store_ps(&dest[i], _dest);
+									_mm512_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasFMA && tpa::hasAVX)
@@ -3532,15 +3624,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_ps(&arr_a[i]);
-									_b = _mm256_load_ps(&arr_b[i]);
-									_c = _mm256_load_ps(&arr_c[i]);
+									_a = _mm256_loadu_ps(&arr_a[i]);
+									_b = _mm256_loadu_ps(&arr_b[i]);
+									_c = _mm256_loadu_ps(&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm256_fmadd_ps(_a, _b, _c);
 
 									//Store Result
-									_mm256_store_ps(&dest[i], _dest);
+									_mm256_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End if hasFMA
 #endif
@@ -3562,15 +3654,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_pd(&arr_a[i]);
-									_b = _mm512_load_pd(&arr_b[i]);
-									_c = _mm512_load_pd(&arr_c[i]);
+									_a = _mm512_loadu_pd(&arr_a[i]);
+									_b = _mm512_loadu_pd(&arr_b[i]);
+									_c = _mm512_loadu_pd(&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_fmadd_pd(_a, _b, _c);
 
 									//Store Result
-									_mm512_store_pd(&dest[i], _dest);
+									_mm512_storeu_pd(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasFMA && tpa::hasAVX)
@@ -3585,20 +3677,31 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_pd(&arr_a[i]);
-									_b = _mm256_load_pd(&arr_b[i]);
-									_c = _mm256_load_pd(&arr_c[i]);
+									_a = _mm256_loadu_pd(&arr_a[i]);
+									_b = _mm256_loadu_pd(&arr_b[i]);
+									_c = _mm256_loadu_pd(&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm256_fmadd_pd(_a, _b, _c);
 
 									//Store Result
-									_mm256_store_pd(&dest[i], _dest);
+									_mm256_storeu_pd(&dest[i], _dest);
 								}//End for
 							}//End if hasFMA
 #endif
 						}//End if
 #pragma endregion
+#pragma region neon
+#ifdef TPA_NEON
+						if constexpr (tpa::simd::is_vec_type<T>)
+						{
+							if (tpa::hasNeon)
+							{
+								tpa_fma_private::fma_neon<T>(i, end, arr_a.data(), arr_b.data(), arr_c.data(), dest.data());
+							}//End if
+						}//End if
+#endif
+#pragma endregion
 #pragma region generic
 						for (; i < end; ++i)
 						{
@@ -3745,8 +3848,8 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
 
 									//Perform FMA (a * b) + c	
 									int8_t d[32] = {};
@@ -3758,12 +3861,12 @@ namespace tpa{
 										d[x] = static_cast<int8_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi8(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -3820,8 +3923,8 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
 
 									//Perform FMA (a * b) + c	
 									uint8_t d[32] = {};
@@ -3833,12 +3936,12 @@ namespace tpa{
 										d[x] = static_cast<int8_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi8(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -3885,15 +3988,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi16(_a, _b);
 									_dest = _mm256_add_epi16(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -3940,15 +4043,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi16(_a, _b);
 									_dest = _mm256_add_epi16(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -3971,15 +4074,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi32((__m512i*)&arr_a[i]);
-									_b = _mm512_load_epi32((__m512i*)&arr_b[i]);
+									_a = _mm512_loadu_epi32((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi32((__m512i*)&arr_b[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullo_epi32(_a, _b);
 									_dest = _mm512_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -3995,15 +4098,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi32(_a, _b);
 									_dest = _mm256_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -4026,15 +4129,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi32((__m512i*)&arr_a[i]);
-									_b = _mm512_load_epi32((__m512i*)&arr_b[i]);
+									_a = _mm512_loadu_epi32((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi32((__m512i*)&arr_b[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullo_epi32(_a, _b);
 									_dest = _mm512_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -4050,15 +4153,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi32(_a, _b);
 									_dest = _mm256_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -4081,21 +4184,21 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi64((__m512i*)&arr_a[i]);
-									_b = _mm512_load_epi64((__m512i*)&arr_b[i]);
+									_a = _mm512_loadu_epi64((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi64((__m512i*)&arr_b[i]);
 
 									//Perform FMA (a * b) + c								
 									_dest = _mm512_mullox_epi64(_a, _b);
 									_dest = _mm512_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi64((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi64((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
 							{
 								__m256i _a, _b, _dest;
-								const __m256i _c = _mm256_set1_epi64(const_val);
+								const __m256i _c = _mm256_set1_epi64x(const_val);
 
 								for (; i < end; i += 4)
 								{
@@ -4105,8 +4208,8 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
 
 									//Perform FMA (a * b) + c								
 									int64_t d[4] = {};
@@ -4118,12 +4221,12 @@ namespace tpa{
 										d[x] = static_cast<int64_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -4146,21 +4249,21 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi64((__m512i*)&arr_a[i]);
-									_b = _mm512_load_epi64((__m512i*)&arr_b[i]);
+									_a = _mm512_loadu_epi64((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi64((__m512i*)&arr_b[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullox_epi64(_a, _b);
 									_dest = _mm512_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi64((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi64((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
 							{
 								__m256i _a, _b, _dest;
-								const __m256i _c = _mm256_set1_epi64(const_val);
+								const __m256i _c = _mm256_set1_epi64x(const_val);
 
 								for (; i < end; i += 4)
 								{
@@ -4170,8 +4273,8 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
 
 									//Perform FMA (a * b) + c
 									uint64_t d[4] = {};
@@ -4183,12 +4286,12 @@ namespace tpa{
 										d[x] = static_cast<uint64_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -4211,14 +4314,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_ps(&arr_a[i]);
-									_b = _mm512_load_ps(&arr_b[i]);
+									_a = _mm512_loadu_ps(&arr_a[i]);
+									_b = _mm512_loadu_ps(&arr_b[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_fmadd_ps(_a, _b, _c);
 
 									//Store Result
-									_mm512_store_ps(&dest[i], _dest);
+									_mm512_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasFMA && tpa::hasAVX)
@@ -4234,14 +4337,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_ps(&arr_a[i]);
-									_b = _mm256_load_ps(&arr_b[i]);
+									_a = _mm256_loadu_ps(&arr_a[i]);
+									_b = _mm256_loadu_ps(&arr_b[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm256_fmadd_ps(_a, _b, _c);
 
 									//Store Result
-									_mm256_store_ps(&dest[i], _dest);
+									_mm256_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End if hasFMA
 #endif
@@ -4264,14 +4367,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_pd(&arr_a[i]);
-									_b = _mm512_load_pd(&arr_b[i]);
+									_a = _mm512_loadu_pd(&arr_a[i]);
+									_b = _mm512_loadu_pd(&arr_b[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_fmadd_pd(_a, _b, _c);
 
 									//Store Result
-									_mm512_store_pd(&dest[i], _dest);
+									_mm512_storeu_pd(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasFMA && tpa::hasAVX)
@@ -4287,19 +4390,30 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_pd(&arr_a[i]);
-									_b = _mm256_load_pd(&arr_b[i]);
+									_a = _mm256_loadu_pd(&arr_a[i]);
+									_b = _mm256_loadu_pd(&arr_b[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm256_fmadd_pd(_a, _b, _c);
 
 									//Store Result
-									_mm256_store_pd(&dest[i], _dest);
+									_mm256_storeu_pd(&dest[i], _dest);
 								}//End for
 							}//End if hasFMA
 #endif
 						}//End if
 #pragma endregion
+#pragma region neon
+#ifdef TPA_NEON
+						if constexpr (tpa::simd::is_vec_type<T>)
+						{
+							if (tpa::hasNeon)
+							{
+								tpa_fma_private::fma_const_add_neon<T>(i, end, arr_a.data(), arr_b.data(), const_val, dest.data());
+							}//End if
+						}//End if
+#endif
+#pragma endregion
 #pragma region generic
 						for (; i < end; ++i)
 						{
@@ -4447,8 +4561,8 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									int8_t d[32] = {};
@@ -4460,12 +4574,12 @@ namespace tpa{
 										d[x] = static_cast<int8_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi8(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -4522,8 +4636,8 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									uint8_t d[32] = {};
@@ -4535,12 +4649,12 @@ namespace tpa{
 										d[x] = static_cast<uint8_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi8(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -4587,15 +4701,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi16(_a, _b);
 									_dest = _mm256_add_epi16(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -4642,15 +4756,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi16(_a, _b);
 									_dest = _mm256_add_epi16(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -4673,15 +4787,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi32((__m512i*)&arr_a[i]);
-									_c = _mm512_load_epi32((__m512i*)&arr_c[i]);
+									_a = _mm512_loadu_epi32((__m512i*)&arr_a[i]);
+									_c = _mm512_loadu_epi32((__m512i*)&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullo_epi32(_a, _b);
 									_dest = _mm512_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -4697,15 +4811,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi32(_a, _b);
 									_dest = _mm256_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -4728,15 +4842,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi32((__m512i*)&arr_a[i]);
-									_c = _mm512_load_epi32((__m512i*)&arr_c[i]);
+									_a = _mm512_loadu_epi32((__m512i*)&arr_a[i]);
+									_c = _mm512_loadu_epi32((__m512i*)&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullo_epi32(_a, _b);
 									_dest = _mm512_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -4752,15 +4866,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi32(_a, _b);
 									_dest = _mm256_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -4783,15 +4897,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi64((__m512i*)&arr_a[i]);
-									_c = _mm512_load_epi64((__m512i*)&arr_c[i]);
+									_a = _mm512_loadu_epi64((__m512i*)&arr_a[i]);
+									_c = _mm512_loadu_epi64((__m512i*)&arr_c[i]);
 
 									//Perform FMA (a * b) + c								
 									_dest = _mm512_mullox_epi64(_a, _b);
 									_dest = _mm512_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi64((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi64((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -4807,8 +4921,8 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c								
 									int64_t d[4] = {};
@@ -4820,12 +4934,12 @@ namespace tpa{
 										d[x] = static_cast<int64_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -4848,15 +4962,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi64((__m512i*)&arr_a[i]);
-									_c = _mm512_load_epi64((__m512i*)&arr_c[i]);
+									_a = _mm512_loadu_epi64((__m512i*)&arr_a[i]);
+									_c = _mm512_loadu_epi64((__m512i*)&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullox_epi64(_a, _b);
 									_dest = _mm512_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi64((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi64((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -4872,8 +4986,8 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									uint64_t d[4] = {};
@@ -4885,12 +4999,12 @@ namespace tpa{
 										d[x] = static_cast<uint64_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -4913,14 +5027,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_ps(&arr_a[i]);
-									_c = _mm512_load_ps(&arr_c[i]);
+									_a = _mm512_loadu_ps(&arr_a[i]);
+									_c = _mm512_loadu_ps(&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_fmadd_ps(_a, _b, _c);
 
 									//Store Result
-									_mm512_store_ps(&dest[i], _dest);
+									_mm512_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasFMA && tpa::hasAVX)
@@ -4936,14 +5050,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_ps(&arr_a[i]);
-									_c = _mm256_load_ps(&arr_c[i]);
+									_a = _mm256_loadu_ps(&arr_a[i]);
+									_c = _mm256_loadu_ps(&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm256_fmadd_ps(_a, _b, _c);
 
 									//Store Result
-									_mm256_store_ps(&dest[i], _dest);
+									_mm256_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End if hasFMA
 #endif
@@ -4966,14 +5080,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_pd(&arr_a[i]);
-									_c = _mm512_load_pd(&arr_c[i]);
+									_a = _mm512_loadu_pd(&arr_a[i]);
+									_c = _mm512_loadu_pd(&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_fmadd_pd(_a, _b, _c);
 
 									//Store Result
-									_mm512_store_pd(&dest[i], _dest);
+									_mm512_storeu_pd(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasFMA && tpa::hasAVX)
@@ -4989,19 +5103,30 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_pd(&arr_a[i]);
-									_c = _mm256_load_pd(&arr_c[i]);
+									_a = _mm256_loadu_pd(&arr_a[i]);
+									_c = _mm256_loadu_pd(&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm256_fmadd_pd(_a, _b, _c);
 
 									//Store Result
-									_mm256_store_pd(&dest[i], _dest);
+									_mm256_storeu_pd(&dest[i], _dest);
 								}//End for
 							}//End if hasFMA
 #endif
 						}//End if
 #pragma endregion
+#pragma region neon
+#ifdef TPA_NEON
+						if constexpr (tpa::simd::is_vec_type<T>)
+						{
+							if (tpa::hasNeon)
+							{
+								tpa_fma_private::fma_const_multiply_neon<T>(i, end, arr_a.data(), const_val, arr_c.data(), dest.data());
+							}//End if
+						}//End if
+#endif
+#pragma endregion
 #pragma region generic
 						for (; i < end; ++i)
 						{
@@ -5144,7 +5269,7 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
 
 									//Perform FMA (a * b) + c	
 									int8_t d[32] = {};
@@ -5156,12 +5281,12 @@ namespace tpa{
 										d[x] = static_cast<int8_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi8(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -5219,7 +5344,7 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
 
 									//Perform FMA (a * b) + c	
 									uint8_t d[32] = {};
@@ -5231,12 +5356,12 @@ namespace tpa{
 										d[x] = static_cast<uint8_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi8(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -5284,14 +5409,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi16(_a, _b);
 									_dest = _mm256_add_epi16(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -5339,14 +5464,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi16(_a, _b);
 									_dest = _mm256_add_epi16(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -5370,14 +5495,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi32((__m512i*)&arr_a[i]);
+									_a = _mm512_loadu_epi32((__m512i*)&arr_a[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullo_epi32(_a, _b);
 									_dest = _mm512_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -5394,14 +5519,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi32(_a, _b);
 									_dest = _mm256_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -5425,14 +5550,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi32((__m512i*)&arr_a[i]);
+									_a = _mm512_loadu_epi32((__m512i*)&arr_a[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullo_epi32(_a, _b);
 									_dest = _mm512_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -5449,14 +5574,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi32(_a, _b);
 									_dest = _mm256_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -5480,14 +5605,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi64((__m512i*)&arr_a[i]);
+									_a = _mm512_loadu_epi64((__m512i*)&arr_a[i]);
 
 									//Perform FMA (a * b) + c								
 									_dest = _mm512_mullox_epi64(_a, _b);
 									_dest = _mm512_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi64((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi64((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasFMA && tpa::hasAVX2)
@@ -5504,7 +5629,7 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
 
 									//Perform FMA (a * b) + c								
 									int64_t d[4] = {};
@@ -5516,12 +5641,12 @@ namespace tpa{
 										d[x] = static_cast<int64_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -5545,14 +5670,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi64((__m512i*)&arr_a[i]);
+									_a = _mm512_loadu_epi64((__m512i*)&arr_a[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullox_epi64(_a, _b);
 									_dest = _mm512_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi64((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi64((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -5569,7 +5694,7 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
 
 									//Perform FMA (a * b) + c
 									uint64_t d[4] = {};
@@ -5581,12 +5706,12 @@ namespace tpa{
 										d[x] = static_cast<uint64_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasFMA
 #endif
@@ -5610,13 +5735,13 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_ps(&arr_a[i]);
+									_a = _mm512_loadu_ps(&arr_a[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_fmadd_ps(_a, _b, _c);
 
 									//Store Result
-									_mm512_store_ps(&dest[i], _dest);
+									_mm512_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasFMA && tpa::hasAVX)
@@ -5633,13 +5758,13 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_ps(&arr_a[i]);
+									_a = _mm256_loadu_ps(&arr_a[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm256_fmadd_ps(_a, _b, _c);
 
 									//Store Result
-									_mm256_store_ps(&dest[i], _dest);
+									_mm256_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End if hasFMA
 #endif
@@ -5663,13 +5788,13 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_pd(&arr_a[i]);
+									_a = _mm512_loadu_pd(&arr_a[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_fmadd_pd(_a, _b, _c);
 
 									//Store Result
-									_mm512_store_pd(&dest[i], _dest);
+									_mm512_storeu_pd(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasFMA && tpa::hasAVX)
@@ -5686,18 +5811,29 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_pd(&arr_a[i]);
+									_a = _mm256_loadu_pd(&arr_a[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm256_fmadd_pd(_a, _b, _c);
 
 									//Store Result
-									_mm256_store_pd(&dest[i], _dest);
+									_mm256_storeu_pd(&dest[i], _dest);
 								}//End for
 							}//End if hasFMA
 #endif
 						}//End if
 #pragma endregion
+#pragma region neon
+#ifdef TPA_NEON
+						if constexpr (tpa::simd::is_vec_type<T>)
+						{
+							if (tpa::hasNeon)
+							{
+								tpa_fma_private::fma_const_multiply_add_neon<T>(i, end, arr_a.data(), const_val, const_val_c, dest.data());
+							}//End if
+						}//End if
+#endif
+#pragma endregion
 #pragma region generic
 						for (; i < end; ++i)
 						{
@@ -5849,9 +5985,9 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									int8_t d[32] = {};
@@ -5863,12 +5999,12 @@ namespace tpa{
 										d[x] = static_cast<int8_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi8(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -5924,9 +6060,9 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									uint8_t d[32] = {};
@@ -5938,12 +6074,12 @@ namespace tpa{
 										d[x] = static_cast<uint8_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi8(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -5989,16 +6125,16 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi16(_a, _b);
 									_dest = _mm256_add_epi16(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -6044,16 +6180,16 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi16(_a, _b);
 									_dest = _mm256_add_epi16(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -6075,16 +6211,16 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi32((__m512i*)&arr_a[i]);
-									_b = _mm512_load_epi32((__m512i*)&arr_b[i]);
-									_c = _mm512_load_epi32((__m512i*)&arr_c[i]);
+									_a = _mm512_loadu_epi32((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi32((__m512i*)&arr_b[i]);
+									_c = _mm512_loadu_epi32((__m512i*)&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullo_epi32(_a, _b);
 									_dest = _mm512_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -6099,16 +6235,16 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi32(_a, _b);
 									_dest = _mm256_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -6130,16 +6266,16 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi32((__m512i*)&arr_a[i]);
-									_b = _mm512_load_epi32((__m512i*)&arr_b[i]);
-									_c = _mm512_load_epi32((__m512i*)&arr_c[i]);
+									_a = _mm512_loadu_epi32((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi32((__m512i*)&arr_b[i]);
+									_c = _mm512_loadu_epi32((__m512i*)&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullo_epi32(_a, _b);
 									_dest = _mm512_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -6154,16 +6290,16 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi32(_a, _b);
 									_dest = _mm256_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -6185,16 +6321,16 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi64((__m512i*)&arr_a[i]);
-									_b = _mm512_load_epi64((__m512i*)&arr_b[i]);
-									_c = _mm512_load_epi64((__m512i*)&arr_c[i]);
+									_a = _mm512_loadu_epi64((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi64((__m512i*)&arr_b[i]);
+									_c = _mm512_loadu_epi64((__m512i*)&arr_c[i]);
 
 									//Perform FMA (a * b) + c								
 									_dest = _mm512_mullox_epi64(_a, _b);
 									_dest = _mm512_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi64((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi64((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -6209,9 +6345,9 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c								
 									int64_t d[4] = {};
@@ -6224,12 +6360,12 @@ namespace tpa{
 #endif
 
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -6251,16 +6387,16 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi64((__m512i*)&arr_a[i]);
-									_b = _mm512_load_epi64((__m512i*)&arr_b[i]);
-									_c = _mm512_load_epi64((__m512i*)&arr_c[i]);
+									_a = _mm512_loadu_epi64((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi64((__m512i*)&arr_b[i]);
+									_c = _mm512_loadu_epi64((__m512i*)&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullox_epi64(_a, _b);
 									_dest = _mm512_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi64((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi64((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -6275,9 +6411,9 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									uint64_t d[4] = {};
@@ -6289,12 +6425,12 @@ namespace tpa{
 										d[x] = static_cast<uint64_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -6316,15 +6452,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_ps(&arr_a[i]);
-									_b = _mm512_load_ps(&arr_b[i]);
-									_c = _mm512_load_ps(&arr_c[i]);
+									_a = _mm512_loadu_ps(&arr_a[i]);
+									_b = _mm512_loadu_ps(&arr_b[i]);
+									_c = _mm512_loadu_ps(&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_fmadd_ps(_a, _b, _c);
 
 									//Store Result
-									_mm512_store_ps(&dest[i], _dest);
+									_mm512_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasFMA && tpa::hasAVX)
@@ -6339,15 +6475,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_ps(&arr_a[i]);
-									_b = _mm256_load_ps(&arr_b[i]);
-									_c = _mm256_load_ps(&arr_c[i]);
+									_a = _mm256_loadu_ps(&arr_a[i]);
+									_b = _mm256_loadu_ps(&arr_b[i]);
+									_c = _mm256_loadu_ps(&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm256_fmadd_ps(_a, _b, _c);
 
 									//Store Result
-									_mm256_store_ps(&dest[i], _dest);
+									_mm256_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End if hasFMA
 #endif
@@ -6369,15 +6505,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_pd(&arr_a[i]);
-									_b = _mm512_load_pd(&arr_b[i]);
-									_c = _mm512_load_pd(&arr_c[i]);
+									_a = _mm512_loadu_pd(&arr_a[i]);
+									_b = _mm512_loadu_pd(&arr_b[i]);
+									_c = _mm512_loadu_pd(&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_fmadd_pd(_a, _b, _c);
 
 									//Store Result
-									_mm512_store_pd(&dest[i], _dest);
+									_mm512_storeu_pd(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasFMA && tpa::hasAVX)
@@ -6392,20 +6528,31 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_pd(&arr_a[i]);
-									_b = _mm256_load_pd(&arr_b[i]);
-									_c = _mm256_load_pd(&arr_c[i]);
+									_a = _mm256_loadu_pd(&arr_a[i]);
+									_b = _mm256_loadu_pd(&arr_b[i]);
+									_c = _mm256_loadu_pd(&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm256_fmadd_pd(_a, _b, _c);
 
 									//Store Result
-									_mm256_store_pd(&dest[i], _dest);
+									_mm256_storeu_pd(&dest[i], _dest);
 								}//End for
 							}//End if hasFMA
 #endif
 						}//End if
 #pragma endregion
+#pragma region neon
+#ifdef TPA_NEON
+						if constexpr (tpa::simd::is_vec_type<T>)
+						{
+							if (tpa::hasNeon)
+							{
+								tpa_fma_private::fma_neon<T>(i, end, arr_a.data(), arr_b.data(), arr_c.data(), dest.data());
+							}//End if
+						}//End if
+#endif
+#pragma endregion
 #pragma region generic
 						for (; i < end; ++i)
 						{
@@ -6554,8 +6701,8 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
 
 									//Perform FMA (a * b) + c	
 									int8_t d[32] = {};
@@ -6567,12 +6714,12 @@ namespace tpa{
 										d[x] = static_cast<int8_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi8(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -6629,8 +6776,8 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
 
 									//Perform FMA (a * b) + c	
 									uint8_t d[32] = {};
@@ -6642,12 +6789,12 @@ namespace tpa{
 										d[x] = static_cast<uint8_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi8(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -6694,15 +6841,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi16(_a, _b);
 									_dest = _mm256_add_epi16(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -6749,15 +6896,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi16(_a, _b);
 									_dest = _mm256_add_epi16(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -6780,15 +6927,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi32((__m512i*)&arr_a[i]);
-									_b = _mm512_load_epi32((__m512i*)&arr_b[i]);
+									_a = _mm512_loadu_epi32((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi32((__m512i*)&arr_b[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullo_epi32(_a, _b);
 									_dest = _mm512_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -6804,15 +6951,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi32(_a, _b);
 									_dest = _mm256_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -6835,15 +6982,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi32((__m512i*)&arr_a[i]);
-									_b = _mm512_load_epi32((__m512i*)&arr_b[i]);
+									_a = _mm512_loadu_epi32((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi32((__m512i*)&arr_b[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullo_epi32(_a, _b);
 									_dest = _mm512_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -6859,15 +7006,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi32(_a, _b);
 									_dest = _mm256_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -6890,21 +7037,21 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi64((__m512i*)&arr_a[i]);
-									_b = _mm512_load_epi64((__m512i*)&arr_b[i]);
+									_a = _mm512_loadu_epi64((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi64((__m512i*)&arr_b[i]);
 
 									//Perform FMA (a * b) + c								
 									_dest = _mm512_mullox_epi64(_a, _b);
 									_dest = _mm512_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi64((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi64((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
 							{
 								__m256i _a, _b, _dest;
-								const __m256i _c = _mm256_set1_epi64(const_val);
+								const __m256i _c = _mm256_set1_epi64x(const_val);
 
 								for (; i < end; i += 4)
 								{
@@ -6914,8 +7061,8 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
 
 									//Perform FMA (a * b) + c								
 									int64_t d[4] = {};
@@ -6927,12 +7074,12 @@ namespace tpa{
 										d[x] = static_cast<int64_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -6955,21 +7102,21 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi64((__m512i*)&arr_a[i]);
-									_b = _mm512_load_epi64((__m512i*)&arr_b[i]);
+									_a = _mm512_loadu_epi64((__m512i*)&arr_a[i]);
+									_b = _mm512_loadu_epi64((__m512i*)&arr_b[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullox_epi64(_a, _b);
 									_dest = _mm512_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi64((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi64((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
 							{
 								__m256i _a, _b, _dest;
-								const __m256i _c = _mm256_set1_epi64(const_val);
+								const __m256i _c = _mm256_set1_epi64x(const_val);
 
 								for (; i < end; i += 4)
 								{
@@ -6979,8 +7126,8 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_b = _mm256_load_si256((__m256i*) & arr_b[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_b = _mm256_loadu_si256((__m256i*) & arr_b[i]);
 
 									//Perform FMA (a * b) + c
 									uint64_t d[4] = {};
@@ -6992,12 +7139,12 @@ namespace tpa{
 										d[x] = static_cast<uint64_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -7020,14 +7167,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_ps(&arr_a[i]);
-									_b = _mm512_load_ps(&arr_b[i]);
+									_a = _mm512_loadu_ps(&arr_a[i]);
+									_b = _mm512_loadu_ps(&arr_b[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_fmadd_ps(_a, _b, _c);
 
 									//Store Result
-									_mm512_store_ps(&dest[i], _dest);
+									_mm512_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasFMA && tpa::hasAVX)
@@ -7043,14 +7190,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_ps(&arr_a[i]);
-									_b = _mm256_load_ps(&arr_b[i]);
+									_a = _mm256_loadu_ps(&arr_a[i]);
+									_b = _mm256_loadu_ps(&arr_b[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm256_fmadd_ps(_a, _b, _c);
 
 									//Store Result
-									_mm256_store_ps(&dest[i], _dest);
+									_mm256_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End if hasFMA
 #endif
@@ -7073,14 +7220,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_pd(&arr_a[i]);
-									_b = _mm512_load_pd(&arr_b[i]);
+									_a = _mm512_loadu_pd(&arr_a[i]);
+									_b = _mm512_loadu_pd(&arr_b[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_fmadd_pd(_a, _b, _c);
 
 									//Store Result
-									_mm512_store_pd(&dest[i], _dest);
+									_mm512_storeu_pd(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasFMA && tpa::hasAVX)
@@ -7096,19 +7243,30 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_pd(&arr_a[i]);
-									_b = _mm256_load_pd(&arr_b[i]);
+									_a = _mm256_loadu_pd(&arr_a[i]);
+									_b = _mm256_loadu_pd(&arr_b[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm256_fmadd_pd(_a, _b, _c);
 
 									//Store Result
-									_mm256_store_pd(&dest[i], _dest);
+									_mm256_storeu_pd(&dest[i], _dest);
 								}//End for
 							}//End if hasFMA
 #endif
 						}//End if
 #pragma endregion
+#pragma region neon
+#ifdef TPA_NEON
+						if constexpr (tpa::simd::is_vec_type<T>)
+						{
+							if (tpa::hasNeon)
+							{
+								tpa_fma_private::fma_const_add_neon<T>(i, end, arr_a.data(), arr_b.data(), const_val, dest.data());
+							}//End if
+						}//End if
+#endif
+#pragma endregion
 #pragma region generic
 						for (; i < end; ++i)
 						{
@@ -7257,8 +7415,8 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									int8_t d[32] = {};
@@ -7270,12 +7428,12 @@ namespace tpa{
 										d[x] = static_cast<int8_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi8(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -7332,8 +7490,8 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									uint8_t d[32] = {};
@@ -7345,12 +7503,12 @@ namespace tpa{
 										d[x] = static_cast<uint8_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi8(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -7397,15 +7555,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi16(_a, _b);
 									_dest = _mm256_add_epi16(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -7452,15 +7610,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi16(_a, _b);
 									_dest = _mm256_add_epi16(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -7483,15 +7641,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi32((__m512i*)&arr_a[i]);
-									_c = _mm512_load_epi32((__m512i*)&arr_c[i]);
+									_a = _mm512_loadu_epi32((__m512i*)&arr_a[i]);
+									_c = _mm512_loadu_epi32((__m512i*)&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullo_epi32(_a, _b);
 									_dest = _mm512_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -7507,15 +7665,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi32(_a, _b);
 									_dest = _mm256_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -7538,15 +7696,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi32((__m512i*)&arr_a[i]);
-									_c = _mm512_load_epi32((__m512i*)&arr_c[i]);
+									_a = _mm512_loadu_epi32((__m512i*)&arr_a[i]);
+									_c = _mm512_loadu_epi32((__m512i*)&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullo_epi32(_a, _b);
 									_dest = _mm512_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -7562,15 +7720,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi32(_a, _b);
 									_dest = _mm256_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -7593,15 +7751,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi64((__m512i*)&arr_a[i]);
-									_c = _mm512_load_epi64((__m512i*)&arr_c[i]);
+									_a = _mm512_loadu_epi64((__m512i*)&arr_a[i]);
+									_c = _mm512_loadu_epi64((__m512i*)&arr_c[i]);
 
 									//Perform FMA (a * b) + c								
 									_dest = _mm512_mullox_epi64(_a, _b);
 									_dest = _mm512_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi64((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi64((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -7617,8 +7775,8 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c								
 									int64_t d[4] = {};
@@ -7630,12 +7788,12 @@ namespace tpa{
 										d[x] = static_cast<int64_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -7658,15 +7816,15 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi64((__m512i*)&arr_a[i]);
-									_c = _mm512_load_epi64((__m512i*)&arr_c[i]);
+									_a = _mm512_loadu_epi64((__m512i*)&arr_a[i]);
+									_c = _mm512_loadu_epi64((__m512i*)&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullox_epi64(_a, _b);
 									_dest = _mm512_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi64((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi64((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -7682,8 +7840,8 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
-									_c = _mm256_load_si256((__m256i*) & arr_c[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
+									_c = _mm256_loadu_si256((__m256i*) & arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									uint64_t d[4] = {};
@@ -7695,12 +7853,12 @@ namespace tpa{
 										d[x] = static_cast<uint64_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -7723,14 +7881,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_ps(&arr_a[i]);
-									_c = _mm512_load_ps(&arr_c[i]);
+									_a = _mm512_loadu_ps(&arr_a[i]);
+									_c = _mm512_loadu_ps(&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_fmadd_ps(_a, _b, _c);
 
 									//Store Result
-									_mm512_store_ps(&dest[i], _dest);
+									_mm512_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasFMA && tpa::hasAVX)
@@ -7746,14 +7904,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_ps(&arr_a[i]);
-									_c = _mm256_load_ps(&arr_c[i]);
+									_a = _mm256_loadu_ps(&arr_a[i]);
+									_c = _mm256_loadu_ps(&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm256_fmadd_ps(_a, _b, _c);
 
 									//Store Result
-									_mm256_store_ps(&dest[i], _dest);
+									_mm256_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End if hasFMA
 #endif
@@ -7776,14 +7934,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_pd(&arr_a[i]);
-									_c = _mm512_load_pd(&arr_c[i]);
+									_a = _mm512_loadu_pd(&arr_a[i]);
+									_c = _mm512_loadu_pd(&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_fmadd_pd(_a, _b, _c);
 
 									//Store Result
-									_mm512_store_pd(&dest[i], _dest);
+									_mm512_storeu_pd(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasFMA && tpa::hasAVX)
@@ -7799,19 +7957,30 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_pd(&arr_a[i]);
-									_c = _mm256_load_pd(&arr_c[i]);
+									_a = _mm256_loadu_pd(&arr_a[i]);
+									_c = _mm256_loadu_pd(&arr_c[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm256_fmadd_pd(_a, _b, _c);
 
 									//Store Result
-									_mm256_store_pd(&dest[i], _dest);
+									_mm256_storeu_pd(&dest[i], _dest);
 								}//End for
 							}//End if hasFMA
 #endif
 						}//End if
 #pragma endregion
+#pragma region neon
+#ifdef TPA_NEON
+						if constexpr (tpa::simd::is_vec_type<T>)
+						{
+							if (tpa::hasNeon)
+							{
+								tpa_fma_private::fma_const_multiply_neon<T>(i, end, arr_a.data(), const_val, arr_c.data(), dest.data());
+							}//End if
+						}//End if
+#endif
+#pragma endregion
 #pragma region generic
 						for (; i < end; ++i)
 						{
@@ -7959,7 +8128,7 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
 
 									//Perform FMA (a * b) + c	
 									int8_t d[32] = {};
@@ -7971,12 +8140,12 @@ namespace tpa{
 										d[x] = static_cast<int8_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi8(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -8034,7 +8203,7 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
 
 									//Perform FMA (a * b) + c	
 									uint8_t d[32] = {};
@@ -8046,12 +8215,12 @@ namespace tpa{
 										d[x] = static_cast<uint8_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi8(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -8099,14 +8268,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi16(_a, _b);
 									_dest = _mm256_add_epi16(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -8154,14 +8323,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi16(_a, _b);
 									_dest = _mm256_add_epi16(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -8185,14 +8354,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi32((__m512i*)&arr_a[i]);
+									_a = _mm512_loadu_epi32((__m512i*)&arr_a[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullo_epi32(_a, _b);
 									_dest = _mm512_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -8209,14 +8378,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi32(_a, _b);
 									_dest = _mm256_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -8240,14 +8409,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi32((__m512i*)&arr_a[i]);
+									_a = _mm512_loadu_epi32((__m512i*)&arr_a[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullo_epi32(_a, _b);
 									_dest = _mm512_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi32((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi32((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -8264,14 +8433,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
 
 									//Perform FMA (a * b) + c	
 									_dest = _mm256_mullo_epi32(_a, _b);
 									_dest = _mm256_add_epi32(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -8295,14 +8464,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi64((__m512i*)&arr_a[i]);
+									_a = _mm512_loadu_epi64((__m512i*)&arr_a[i]);
 
 									//Perform FMA (a * b) + c								
 									_dest = _mm512_mullox_epi64(_a, _b);
 									_dest = _mm512_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi64((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi64((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasFMA && tpa::hasAVX2)
@@ -8319,7 +8488,7 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
 
 									//Perform FMA (a * b) + c								
 									int64_t d[4] = {};
@@ -8331,12 +8500,12 @@ namespace tpa{
 										d[x] = static_cast<int64_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX2
 #endif
@@ -8360,14 +8529,14 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_epi64((__m512i*)&arr_a[i]);
+									_a = _mm512_loadu_epi64((__m512i*)&arr_a[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_mullox_epi64(_a, _b);
 									_dest = _mm512_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm512_store_epi64((__m512i*)&dest[i], _dest);
+									_mm512_storeu_epi64((__m512i*)&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX2)
@@ -8384,7 +8553,7 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_si256((__m256i*) & arr_a[i]);
+									_a = _mm256_loadu_si256((__m256i*) & arr_a[i]);
 
 									//Perform FMA (a * b) + c
 									uint64_t d[4] = {};
@@ -8396,12 +8565,12 @@ namespace tpa{
 										d[x] = static_cast<uint64_t>(_a[x] * _b[x]);
 #endif
 									}//End for
-									_dest = _mm256_load_si256((__m256i*) & d);
+									_dest = _mm256_loadu_si256((__m256i*) & d);
 
 									_dest = _mm256_add_epi64(_dest, _c);
 
 									//Store Result
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasFMA
 #endif
@@ -8425,13 +8594,13 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_ps(&arr_a[i]);
+									_a = _mm512_loadu_ps(&arr_a[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_fmadd_ps(_a, _b, _c);
 
 									//Store Result
-									_mm512_store_ps(&dest[i], _dest);
+									_mm512_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasFMA && tpa::hasAVX)
@@ -8448,13 +8617,13 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_ps(&arr_a[i]);
+									_a = _mm256_loadu_ps(&arr_a[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm256_fmadd_ps(_a, _b, _c);
 
 									//Store Result
-									_mm256_store_ps(&dest[i], _dest);
+									_mm256_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End if hasFMA
 #endif
@@ -8478,13 +8647,13 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm512_load_pd(&arr_a[i]);
+									_a = _mm512_loadu_pd(&arr_a[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm512_fmadd_pd(_a, _b, _c);
 
 									//Store Result
-									_mm512_store_pd(&dest[i], _dest);
+									_mm512_storeu_pd(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasFMA && tpa::hasAVX)
@@ -8501,18 +8670,29 @@ namespace tpa{
 									}//End if
 
 									//Load
-									_a = _mm256_load_pd(&arr_a[i]);
+									_a = _mm256_loadu_pd(&arr_a[i]);
 
 									//Perform FMA (a * b) + c
 									_dest = _mm256_fmadd_pd(_a, _b, _c);
 
 									//Store Result
-									_mm256_store_pd(&dest[i], _dest);
+									_mm256_storeu_pd(&dest[i], _dest);
 								}//End for
 							}//End if hasFMA
 #endif
 						}//End if
 #pragma endregion
+#pragma region neon
+#ifdef TPA_NEON
+						if constexpr (tpa::simd::is_vec_type<T>)
+						{
+							if (tpa::hasNeon)
+							{
+								tpa_fma_private::fma_const_multiply_add_neon<T>(i, end, arr_a.data(), const_val, const_val_c, dest.data());
+							}//End if
+						}//End if
+#endif
+#pragma endregion
 #pragma region generic
 						for (; i < end; ++i)
 						{
@@ -98,9 +98,11 @@ namespace tpa{
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::log: " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::log will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
@@ -129,11 +131,11 @@ namespace tpa{
 
 								for (; (i + 16) < end; i += 16)
 								{
-									_num = _mm512_load_ps(&source[i]);
+									_num = _mm512_loadu_ps(&source[i]);
 
 									_num = _mm512_log_ps(_num);
 
-									_mm512_store_ps(&dest[i], _num);
+									_mm512_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX)
@@ -142,11 +144,11 @@ namespace tpa{
 
 								for (; (i + 8) < end; i += 8)
 								{
-									_num = _mm256_load_ps(&source[i]);
+									_num = _mm256_loadu_ps(&source[i]);
 
 									_num = _mm256_log_ps(_num);
 
-									_mm256_store_ps(&dest[i], _num);
+									_mm256_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End if hasAVX
 							else if (tpa::has_SSE)
@@ -155,11 +157,11 @@ namespace tpa{
 
 								for (; (i + 4) < end; i += 4)
 								{
-									_num = _mm_load_ps(&source[i]);
+									_num = _mm_loadu_ps(&source[i]);
 
 									_num = _mm_log_ps(_num);
 
-									_mm_store_ps(&dest[i], _num);
+									_mm_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End if has_SSE
 #endif
@@ -175,11 +177,11 @@ namespace tpa{
 
 								for (; (i + 8) < end; i += 8)
 								{
-									_num = _mm512_load_pd(&source[i]);
+									_num = _mm512_loadu_pd(&source[i]);
 
 									_num = _mm512_log_pd(_num);
 
-									_mm512_store_pd(&dest[i], _num);
+									_mm512_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX)
@@ -188,11 +190,11 @@ namespace tpa{
 
 								for (; (i + 4) < end; i += 4)
 								{
-									_num = _mm256_load_pd(&source[i]);
+									_num = _mm256_loadu_pd(&source[i]);
 
 									_num = _mm256_log_pd(_num);
 
-									_mm256_store_pd(&dest[i], _num);
+									_mm256_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End if hasAVX
 							else if (tpa::has_SSE2)
@@ -201,11 +203,11 @@ namespace tpa{
 
 								for (; (i + 2) < end; i += 2)
 								{
-									_num = _mm_load_pd(&source[i]);
+									_num = _mm_loadu_pd(&source[i]);
 
 									_num = _mm_log_pd(_num);
 
-									_mm_store_pd(&dest[i], _num);
+									_mm_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End if has_SSE
 #endif
@@ -236,14 +238,6 @@ namespace tpa{
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::log: " << ex.what() << "\n";
-			std::cerr << "tpa::simd::log will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -300,9 +294,11 @@ namespace tpa{
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::log2: " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::log2 will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
@@ -331,11 +327,11 @@ namespace tpa{
 
 								for (; (i + 16) < end; i += 16)
 								{
-									_num = _mm512_load_ps(&source[i]);
+									_num = _mm512_loadu_ps(&source[i]);
 
 									_num = _mm512_log2_ps(_num);
 
-									_mm512_store_ps(&dest[i], _num);
+									_mm512_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX)
@@ -344,11 +340,11 @@ namespace tpa{
 
 								for (; (i + 8) < end; i += 8)
 								{
-									_num = _mm256_load_ps(&source[i]);
+									_num = _mm256_loadu_ps(&source[i]);
 
 									_num = _mm256_log2_ps(_num);
 
-									_mm256_store_ps(&dest[i], _num);
+									_mm256_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End if hasAVX
 							else if (tpa::has_SSE)
@@ -357,11 +353,11 @@ namespace tpa{
 
 								for (; (i + 4) < end; i += 4)
 								{
-									_num = _mm_load_ps(&source[i]);
+									_num = _mm_loadu_ps(&source[i]);
 
 									_num = _mm_log2_ps(_num);
 
-									_mm_store_ps(&dest[i], _num);
+									_mm_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End if has_SSE
 #endif
@@ -377,11 +373,11 @@ namespace tpa{
 
 								for (; (i + 8) < end; i += 8)
 								{
-									_num = _mm512_load_pd(&source[i]);
+									_num = _mm512_loadu_pd(&source[i]);
 
 									_num = _mm512_log2_pd(_num);
 
-									_mm512_store_pd(&dest[i], _num);
+									_mm512_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX)
@@ -390,11 +386,11 @@ namespace tpa{
 
 								for (; (i + 4) < end; i += 4)
 								{
-									_num = _mm256_load_pd(&source[i]);
+									_num = _mm256_loadu_pd(&source[i]);
 
 									_num = _mm256_log2_pd(_num);
 
-									_mm256_store_pd(&dest[i], _num);
+									_mm256_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End if hasAVX
 							else if (tpa::has_SSE2)
@@ -403,11 +399,11 @@ namespace tpa{
 
 								for (; (i + 2) < end; i += 2)
 								{
-									_num = _mm_load_pd(&source[i]);
+									_num = _mm_loadu_pd(&source[i]);
 
 									_num = _mm_log2_pd(_num);
 
-									_mm_store_pd(&dest[i], _num);
+									_mm_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End if has_SSE
 #endif
@@ -438,14 +434,6 @@ namespace tpa{
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::log2: " << ex.what() << "\n";
-			std::cerr << "tpa::simd::log2 will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -502,9 +490,11 @@ namespace tpa{
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::log10: " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::log10 will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
@@ -533,11 +523,11 @@ namespace tpa{
 
 								for (; (i + 16) < end; i += 16)
 								{
-									_num = _mm512_load_ps(&source[i]);
+									_num = _mm512_loadu_ps(&source[i]);
 
 									_num = _mm512_log10_ps(_num);
 
-									_mm512_store_ps(&dest[i], _num);
+									_mm512_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX)
@@ -546,11 +536,11 @@ namespace tpa{
 
 								for (; (i + 8) < end; i += 8)
 								{
-									_num = _mm256_load_ps(&source[i]);
+									_num = _mm256_loadu_ps(&source[i]);
 
 									_num = _mm256_log10_ps(_num);
 
-									_mm256_store_ps(&dest[i], _num);
+									_mm256_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End if hasAVX
 							else if (tpa::has_SSE)
@@ -559,11 +549,11 @@ namespace tpa{
 
 								for (; (i + 4) < end; i += 4)
 								{
-									_num = _mm_load_ps(&source[i]);
+									_num = _mm_loadu_ps(&source[i]);
 
 									_num = _mm_log10_ps(_num);
 
-									_mm_store_ps(&dest[i], _num);
+									_mm_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End if has_SSE
 #endif
@@ -579,11 +569,11 @@ namespace tpa{
 
 								for (; (i + 8) < end; i += 8)
 								{
-									_num = _mm512_load_pd(&source[i]);
+									_num = _mm512_loadu_pd(&source[i]);
 
 									_num = _mm512_log10_pd(_num);
 
-									_mm512_store_pd(&dest[i], _num);
+									_mm512_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX)
@@ -592,11 +582,11 @@ namespace tpa{
 
 								for (; (i + 4) < end; i += 4)
 								{
-									_num = _mm256_load_pd(&source[i]);
+									_num = _mm256_loadu_pd(&source[i]);
 
 									_num = _mm256_log10_pd(_num);
 
-									_mm256_store_pd(&dest[i], _num);
+									_mm256_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End if hasAVX
 							else if (tpa::has_SSE2)
@@ -605,11 +595,11 @@ namespace tpa{
 
 								for (; (i + 2) < end; i += 2)
 								{
-									_num = _mm_load_pd(&source[i]);
+									_num = _mm_loadu_pd(&source[i]);
 
 									_num = _mm_log10_pd(_num);
 
-									_mm_store_pd(&dest[i], _num);
+									_mm_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End if has_SSE
 #endif
@@ -640,14 +630,6 @@ namespace tpa{
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::log10: " << ex.what() << "\n";
-			std::cerr << "tpa::simd::log10 will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -704,9 +686,11 @@ namespace tpa{
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::log1p: " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::log1p will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
@@ -735,11 +719,11 @@ namespace tpa{
 
 								for (; (i + 16) < end; i += 16)
 								{
-									_num = _mm512_load_ps(&source[i]);
+									_num = _mm512_loadu_ps(&source[i]);
 
 									_num = _mm512_log1p_ps(_num);
 
-									_mm512_store_ps(&dest[i], _num);
+									_mm512_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX)
@@ -748,11 +732,11 @@ namespace tpa{
 
 								for (; (i + 8) < end; i += 8)
 								{
-									_num = _mm256_load_ps(&source[i]);
+									_num = _mm256_loadu_ps(&source[i]);
 
 									_num = _mm256_log1p_ps(_num);
 
-									_mm256_store_ps(&dest[i], _num);
+									_mm256_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End if hasAVX
 							else if (tpa::has_SSE)
@@ -761,11 +745,11 @@ namespace tpa{
 
 								for (; (i + 4) < end; i += 4)
 								{
-									_num = _mm_load_ps(&source[i]);
+									_num = _mm_loadu_ps(&source[i]);
 
 									_num = _mm_log1p_ps(_num);
 
-									_mm_store_ps(&dest[i], _num);
+									_mm_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End if has_SSE
 #endif
@@ -781,11 +765,11 @@ namespace tpa{
 
 								for (; (i + 8) < end; i += 8)
 								{
-									_num = _mm512_load_pd(&source[i]);
+									_num = _mm512_loadu_pd(&source[i]);
 
 									_num = _mm512_log1p_pd(_num);
 
-									_mm512_store_pd(&dest[i], _num);
+									_mm512_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX)
@@ -794,11 +778,11 @@ namespace tpa{
 
 								for (; (i + 4) < end; i += 4)
 								{
-									_num = _mm256_load_pd(&source[i]);
+									_num = _mm256_loadu_pd(&source[i]);
 
 									_num = _mm256_log1p_pd(_num);
 
-									_mm256_store_pd(&dest[i], _num);
+									_mm256_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End if hasAVX
 							else if (tpa::has_SSE2)
@@ -807,11 +791,11 @@ namespace tpa{
 
 								for (; (i + 2) < end; i += 2)
 								{
-									_num = _mm_load_pd(&source[i]);
+									_num = _mm_loadu_pd(&source[i]);
 
 									_num = _mm_log1p_pd(_num);
 
-									_mm_store_pd(&dest[i], _num);
+									_mm_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End if has_SSE
 #endif
@@ -842,14 +826,6 @@ namespace tpa{
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::log1p: " << ex.what() << "\n";
-			std::cerr << "tpa::simd::log1p will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -906,9 +882,11 @@ namespace tpa{
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::logb: " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::logb will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
@@ -937,11 +915,11 @@ namespace tpa{
 
 								for (; (i + 16) < end; i += 16)
 								{
-									_num = _mm512_load_ps(&source[i]);
+									_num = _mm512_loadu_ps(&source[i]);
 
 									_num = _mm512_logb_ps(_num);
 
-									_mm512_store_ps(&dest[i], _num);
+									_mm512_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX)
@@ -950,11 +928,11 @@ namespace tpa{
 
 								for (; (i + 8) < end; i += 8)
 								{
-									_num = _mm256_load_ps(&source[i]);
+									_num = _mm256_loadu_ps(&source[i]);
 
 									_num = _mm256_logb_ps(_num);
 
-									_mm256_store_ps(&dest[i], _num);
+									_mm256_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End if hasAVX
 							else if (tpa::has_SSE)
@@ -963,11 +941,11 @@ namespace tpa{
 
 								for (; (i + 4) < end; i += 4)
 								{
-									_num = _mm_load_ps(&source[i]);
+									_num = _mm_loadu_ps(&source[i]);
 
 									_num = _mm_logb_ps(_num);
 
-									_mm_store_ps(&dest[i], _num);
+									_mm_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End if has_SSE
 #endif
@@ -983,11 +961,11 @@ namespace tpa{
 
 								for (; (i + 8) < end; i += 8)
 								{
-									_num = _mm512_load_pd(&source[i]);
+									_num = _mm512_loadu_pd(&source[i]);
 
 									_num = _mm512_logb_pd(_num);
 
-									_mm512_store_pd(&dest[i], _num);
+									_mm512_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX)
@@ -996,11 +974,11 @@ namespace tpa{
 
 								for (; (i + 4) < end; i += 4)
 								{
-									_num = _mm256_load_pd(&source[i]);
+									_num = _mm256_loadu_pd(&source[i]);
 
 									_num = _mm256_logb_pd(_num);
 
-									_mm256_store_pd(&dest[i], _num);
+									_mm256_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End if hasAVX
 							else if (tpa::has_SSE2)
@@ -1009,11 +987,11 @@ namespace tpa{
 
 								for (; (i + 2) < end; i += 2)
 								{
-									_num = _mm_load_pd(&source[i]);
+									_num = _mm_loadu_pd(&source[i]);
 
 									_num = _mm_logb_pd(_num);
 
-									_mm_store_pd(&dest[i], _num);
+									_mm_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End if has_SSE
 #endif
@@ -1044,14 +1022,6 @@ namespace tpa{
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::logb: " << ex.what() << "\n";
-			std::cerr << "tpa::simd::logb will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -92,9 +92,11 @@ namespace tpa{
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::root: " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::root will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
@@ -126,7 +128,7 @@ namespace tpa{
 							for (; i+16 < end; i += 16)
 							{
 								//Set Values
-								_DESTi = _mm512_load_ps(&source[i]);
+								_DESTi = _mm512_loadu_ps(&source[i]);
 
 								//Calc
 								if constexpr (INSTR == tpa::rt::SQUARE)
@@ -166,7 +168,7 @@ namespace tpa{
 								}//End else
 
 								//Store Result
-								_mm512_store_ps(&dest[i], _DESTi);
+								_mm512_storeu_ps(&dest[i], _DESTi);
 							}//End for
 						}//End if hasAVX512
 						else if (tpa::hasAVX) [[likely]]
@@ -176,7 +178,7 @@ namespace tpa{
 							for (; i+8 < end; i += 8)
 							{		
 								//Set Values
-								_DESTi = _mm256_load_ps(&source[i]);
+								_DESTi = _mm256_loadu_ps(&source[i]);
 
 								//Calc
 								if constexpr (INSTR == tpa::rt::SQUARE)
@@ -212,7 +214,7 @@ namespace tpa{
 								}//End else
 
 								//Store Result
-								_mm256_store_ps(&dest[i], _DESTi);
+								_mm256_storeu_ps(&dest[i], _DESTi);
 							}//End for
 						}//End if hasAVX
 						else if (tpa::has_SSE) [[likely]]
@@ -222,7 +224,7 @@ namespace tpa{
 							for (; (i + 4) < end; i += 4)
 							{
 								//Set Values
-								_DESTi = _mm_load_ps(&source[i]);
+								_DESTi = _mm_loadu_ps(&source[i]);
 
 								//Calc
 								if constexpr (INSTR == tpa::rt::SQUARE)
@@ -258,7 +260,7 @@ namespace tpa{
 								}//End else
 
 								//Store Result
-								_mm_store_ps(&dest[i], _DESTi);
+								_mm_storeu_ps(&dest[i], _DESTi);
 							}//End for
 						}//End if hasSSE
 #endif						
@@ -276,7 +278,7 @@ namespace tpa{
 							for (; i+8 < end; i += 8)
 							{
 								//Set Values
-								_DESTi = _mm512_load_pd(&source[i]);
+								_DESTi = _mm512_loadu_pd(&source[i]);
 
 								//Calc
 								if constexpr (INSTR == tpa::rt::SQUARE)
@@ -316,7 +318,7 @@ namespace tpa{
 								}//End else
 
 								//Store Result
-								_mm512_store_pd(&dest[i], _DESTi);
+								_mm512_storeu_pd(&dest[i], _DESTi);
 							}//End for
 						}//End if hasAVX512
 						else if (tpa::hasAVX) [[likely]]
@@ -326,7 +328,7 @@ namespace tpa{
 							for (; i+4 < end; i += 4)
 							{
 								//Set Values
-								_DESTi = _mm256_load_pd(&source[i]);
+								_DESTi = _mm256_loadu_pd(&source[i]);
 
 								//Calc
 								if constexpr (INSTR == tpa::rt::SQUARE)
@@ -362,7 +364,7 @@ namespace tpa{
 								}//End else
 
 								//Store Result
-								_mm256_store_pd(&dest[i], _DESTi);
+								_mm256_storeu_pd(&dest[i], _DESTi);
 							}//End for
 						}//End if hasAVX
 						else if (tpa::has_SSE2) [[likely]]
@@ -372,7 +374,7 @@ namespace tpa{
 							for (; (i + 2) < end; i += 2)
 							{
 								//Set Values
-								_DESTi = _mm_load_pd(&source[i]);
+								_DESTi = _mm_loadu_pd(&source[i]);
 
 								//Calc
 								if constexpr (INSTR == tpa::rt::SQUARE)
@@ -408,7 +410,7 @@ namespace tpa{
 								}//End else
 
 								//Store Result
-								_mm_store_pd(&dest[i], _DESTi);
+								_mm_storeu_pd(&dest[i], _DESTi);
 							}//End for
 						}//End if hasSSE2
 #endif						
@@ -469,14 +471,6 @@ namespace tpa{
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::root: " << ex.what() << "\n";
-			std::cerr << "tpa::simd::root will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
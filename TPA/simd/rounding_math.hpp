@@ -106,9 +106,11 @@ namespace tpa{
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::abs: " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::abs will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
@@ -150,11 +152,11 @@ namespace tpa{
 
 							for (; (i+32) < end; i += 32)
 							{
-								_num = _mm256_load_si256((__m256i*) & source[i]);
+								_num = _mm256_loadu_si256((__m256i*) & source[i]);
 
 								_num = _mm256_abs_epi8(_num);
 
-								_mm256_store_si256((__m256i*) & dest[i], _num);
+								_mm256_storeu_si256((__m256i*) & dest[i], _num);
 							}//End for
 						}//End if hasAVX2
 						else if (tpa::has_SSSE3)
@@ -163,11 +165,11 @@ namespace tpa{
 
 							for (; (i + 16) < end; i += 16)
 							{
-								_num = _mm_load_si128(&source[i]);
+								_num = _mm_loadu_si128(&source[i]);
 
 								_num = _mm_abs_epi8(_num);
 
-								_mm_store_si128((__m128i*) &dest[i], _num);
+								_mm_storeu_si128((__m128i*) &dest[i], _num);
 							}//End for
 						}//End if has SSSE3
 #endif
@@ -196,11 +198,11 @@ namespace tpa{
 
 							for (; (i+32) < end; i += 32)
 							{
-								_num = _mm256_load_si256((__m256i*) & source[i]);
+								_num = _mm256_loadu_si256((__m256i*) & source[i]);
 
 								_num = _mm256_abs_epi8(_num);
 
-								_mm256_store_si256((__m256i*) & dest[i], _num);
+								_mm256_storeu_si256((__m256i*) & dest[i], _num);
 							}//End for
 						}//End if hasAVX2
 						else if (tpa::has_SSSE3)
@@ -209,11 +211,11 @@ namespace tpa{
 
 							for (; (i + 16) < end; i += 16)
 							{
-								_num = _mm_load_si128(&source[i]);
+								_num = _mm_loadu_si128(&source[i]);
 
 								_num = _mm_abs_epi8(_num);
 
-								_mm_store_si128((__m128i*) & dest[i], _num);
+								_mm_storeu_si128((__m128i*) & dest[i], _num);
 							}//End for
 						}//End if has SSSE3
 #endif
@@ -242,11 +244,11 @@ namespace tpa{
 
 							for (; (i+16) < end; i += 16)
 							{
-								_num = _mm256_load_si256((__m256i*) & source[i]);
+								_num = _mm256_loadu_si256((__m256i*) & source[i]);
 
 								_num = _mm256_abs_epi16(_num);
 
-								_mm256_store_si256((__m256i*) & dest[i], _num);
+								_mm256_storeu_si256((__m256i*) & dest[i], _num);
 							}//End for
 						}//End if hasAVX2
 						else if (tpa::has_SSSE3)
@@ -255,11 +257,11 @@ namespace tpa{
 
 							for (; (i + 8) < end; i += 8)
 							{
-								_num = _mm_load_si128(&source[i]);
+								_num = _mm_loadu_si128(&source[i]);
 
 								_num = _mm_abs_epi16(_num);
 
-								_mm_store_si128((__m128i*) & dest[i], _num);
+								_mm_storeu_si128((__m128i*) & dest[i], _num);
 							}//End for
 						}//End if has SSSE3
 #endif
@@ -288,11 +290,11 @@ namespace tpa{
 
 							for (; (i+16) < end; i += 16)
 							{
-								_num = _mm256_load_si256((__m256i*) & source[i]);
+								_num = _mm256_loadu_si256((__m256i*) & source[i]);
 
 								_num = _mm256_abs_epi16(_num);
 
-								_mm256_store_si256((__m256i*) & dest[i], _num);
+								_mm256_storeu_si256((__m256i*) & dest[i], _num);
 							}//End for
 						}//End if hasAVX2
 						else if (tpa::has_SSSE3)
@@ -301,11 +303,11 @@ namespace tpa{
 
 							for (; (i + 8) < end; i += 8)
 							{
-								_num = _mm_load_si128(&source[i]);
+								_num = _mm_loadu_si128(&source[i]);
 
 								_num = _mm_abs_epi16(_num);
 
-								_mm_store_si128((__m128i*) & dest[i], _num);
+								_mm_storeu_si128((__m128i*) & dest[i], _num);
 							}//End for
 						}//End if has SSSE3
 #endif
@@ -321,11 +323,11 @@ namespace tpa{
 
 							for (; (i+16) < end; i += 16)
 							{
-								_num = _mm512_load_epi32(&source[i]);
+								_num = _mm512_loadu_epi32(&source[i]);
 
 								_num = _mm512_abs_epi32(_num);
 
-								_mm512_store_epi32(&dest[i], _num);
+								_mm512_storeu_epi32(&dest[i], _num);
 							}//End for
 						}//End if hasAVX512
 						else if (tpa::hasAVX2)
@@ -334,11 +336,11 @@ namespace tpa{
 
 							for (; (i+8) < end; i += 8)
 							{
-								_num = _mm256_load_si256((__m256i*)&source[i]);
+								_num = _mm256_loadu_si256((__m256i*)&source[i]);
 
 								_num = _mm256_abs_epi32(_num);
 
-								_mm256_store_si256((__m256i*)&dest[i], _num);
+								_mm256_storeu_si256((__m256i*)&dest[i], _num);
 							}//End for
 						}//End if hasAVX2
 						else if (tpa::has_SSSE3)
@@ -347,11 +349,11 @@ namespace tpa{
 
 							for (; (i + 4) < end; i += 4)
 							{
-								_num = _mm_load_si128(&source[i]);
+								_num = _mm_loadu_si128(&source[i]);
 
 								_num = _mm_abs_epi32(_num);
 
-								_mm_store_si128((__m128i*) & dest[i], _num);
+								_mm_storeu_si128((__m128i*) & dest[i], _num);
 							}//End for
 						}//End if has SSSE3
 #endif
@@ -367,11 +369,11 @@ namespace tpa{
 
 							for (; (i+16) < end; i += 16)
 							{
-								_num = _mm512_load_epi32(&source[i]);
+								_num = _mm512_loadu_epi32(&source[i]);
 
 								_num = _mm512_abs_epi32(_num);
 
-								_mm512_store_epi32(&dest[i], _num);
+								_mm512_storeu_epi32(&dest[i], _num);
 							}//End for
 						}//End if hasAVX512
 						else if (tpa::hasAVX2)
@@ -380,11 +382,11 @@ namespace tpa{
 
 							for (; (i+8) < end; i += 8)
 							{
-								_num = _mm256_load_si256((__m256i*) &source[i]);
+								_num = _mm256_loadu_si256((__m256i*) &source[i]);
 
 								_num = _mm256_abs_epi32(_num);
 
-								_mm256_store_si256((__m256i*)&dest[i], _num);
+								_mm256_storeu_si256((__m256i*)&dest[i], _num);
 							}//End for
 						}//End if hasAVX2
 						else if (tpa::has_SSSE3)
@@ -393,11 +395,11 @@ namespace tpa{
 
 							for (; (i + 4) < end; i += 4)
 							{
-								_num = _mm_load_si128(&source[i]);
+								_num = _mm_loadu_si128(&source[i]);
 
 								_num = _mm_abs_epi32(_num);
 
-								_mm_store_si128((__m128i*) & dest[i], _num);
+								_mm_storeu_si128((__m128i*) & dest[i], _num);
 							}//End for
 						}//End if has SSSE3
 #endif
@@ -413,11 +415,11 @@ namespace tpa{
 
 							for (; (i+8) < end; i += 8)
 							{
-								_num = _mm512_load_epi64(&source[i]);
+								_num = _mm512_loadu_epi64(&source[i]);
 
 								_num = _mm512_abs_epi64(_num);
 
-								_mm512_store_epi64(&dest[i], _num);
+								_mm512_storeu_epi64(&dest[i], _num);
 							}//End for
 						}//End if hasAVX512
 #endif
@@ -433,11 +435,11 @@ namespace tpa{
 
 							for (; (i+8) < end; i += 8)
 							{
-								_num = _mm512_load_epi64(&source[i]);
+								_num = _mm512_loadu_epi64(&source[i]);
 
 								_num = _mm512_abs_epi64(_num);
 
-								_mm512_store_epi64(&dest[i], _num);
+								_mm512_storeu_epi64(&dest[i], _num);
 							}//End for
 						}//End if hasAVX512
 #endif
@@ -453,11 +455,11 @@ namespace tpa{
 
 							for (; (i+16) < end; i += 16)
 							{
-								_num = _mm512_load_ps(&source[i]);
+								_num = _mm512_loadu_ps(&source[i]);
 
 								_num = _mm512_abs_ps(_num);
 
-								_mm512_store_ps(&dest[i], _num);
+								_mm512_storeu_ps(&dest[i], _num);
 							}//End for
 						}//End if hasAVX512
 						else if (tpa::hasAVX)
@@ -466,11 +468,11 @@ namespace tpa{
 
 							for (; (i + 8) < end; i += 8)
 							{
-								_num = _mm256_load_ps(&source[i]);
+								_num = _mm256_loadu_ps(&source[i]);
 
 								_num = tpa::simd::_mm256_abs_ps(_num);
 
-								_mm256_store_ps(&dest[i], _num);
+								_mm256_storeu_ps(&dest[i], _num);
 							}//End for
 						}//End if hasAVX
 						else if (tpa::has_SSE)
@@ -479,11 +481,11 @@ namespace tpa{
 
 							for (; (i + 4) < end; i += 4)
 							{
-								_num = _mm_load_ps(&source[i]);
+								_num = _mm_loadu_ps(&source[i]);
 
 								_num = tpa::simd::_mm_abs_ps(_num);
 
-								_mm_store_ps(&dest[i], _num);
+								_mm_storeu_ps(&dest[i], _num);
 							}//End for
 						}//End if has_SSE
 #endif
@@ -499,11 +501,11 @@ namespace tpa{
 
 							for (; (i+8) < end; i += 8)
 							{
-								_num = _mm512_load_pd(&source[i]);
+								_num = _mm512_loadu_pd(&source[i]);
 
 								_num = _mm512_abs_pd(_num);
 
-								_mm512_store_pd(&dest[i], _num);								
+								_mm512_storeu_pd(&dest[i], _num);								
 							}//End for
 						}//End if hasAVX512
 						else if (tpa::hasAVX)
@@ -512,11 +514,11 @@ namespace tpa{
 
 							for (; (i + 4) < end; i += 4)
 							{
-								_num = _mm256_load_pd(&source[i]);
+								_num = _mm256_loadu_pd(&source[i]);
 
 								_num = tpa::simd::_mm256_abs_pd(_num);
 
-								_mm256_store_pd(&dest[i], _num);
+								_mm256_storeu_pd(&dest[i], _num);
 							}//End for
 						}//End if hasAVX
 						else if (tpa::has_SSE2)
@@ -525,11 +527,11 @@ namespace tpa{
 
 							for (; (i + 2) < end; i += 2)
 							{
-								_num = _mm_load_pd(&source[i]);
+								_num = _mm_loadu_pd(&source[i]);
 
 								_num = tpa::simd::_mm_abs_pd(_num);
 
-								_mm_store_pd(&dest[i], _num);
+								_mm_storeu_pd(&dest[i], _num);
 							}//End for
 						}//End if has_SSE2
 #endif
@@ -560,14 +562,6 @@ namespace tpa{
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::abs: " << ex.what() << "\n";
-			std::cerr << "tpa::simd::abs will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -627,9 +621,11 @@ namespace tpa{
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::floor: " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::floor will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
@@ -657,11 +653,11 @@ namespace tpa{
 
 					for (; (i+16) < end; i += 16)
 					{
-						_num = _mm512_load_ps(&source[i]);
+						_num = _mm512_loadu_ps(&source[i]);
 
 						_num = _mm512_floor_ps(_num);
 
-						_mm512_store_ps(&dest[i], _num);
+						_mm512_storeu_ps(&dest[i], _num);
 					}//End for
 				}//End if hasAVX512
 				else if (tpa::hasAVX)
@@ -670,11 +666,11 @@ namespace tpa{
 
 					for (; (i+8) < end; i += 8)
 					{
-						_num = _mm256_load_ps(&source[i]);
+						_num = _mm256_loadu_ps(&source[i]);
 
 						_num = _mm256_floor_ps(_num);
 
-						_mm256_store_ps(&dest[i], _num);
+						_mm256_storeu_ps(&dest[i], _num);
 					}//End for
 				}//End if hasAVX
 				else if (tpa::has_SSE41)
@@ -683,11 +679,11 @@ namespace tpa{
 
 					for (; (i + 4) < end; i += 4)
 					{
-						_num = _mm_load_ps(&source[i]);
+						_num = _mm_loadu_ps(&source[i]);
 
 						_num = _mm_floor_ps(_num);
 
-						_mm_store_ps(&dest[i], _num);
+						_mm_storeu_ps(&dest[i], _num);
 					}//End for
 				}//End if has_SSE4.1
 #endif
@@ -704,11 +700,11 @@ namespace tpa{
 
 					 for (; (i + 16) < end; i += 16)
 					 {
-						 _num = _mm512_load_ps(&source[i]);
+						 _num = _mm512_loadu_ps(&source[i]);
 
 						 _dest = _mm512_cvt_roundps_epi32(_num, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
 
-						 _mm512_store_epi32(&dest[i], _dest);
+						 _mm512_storeu_epi32(&dest[i], _dest);
 					 }//End for
 				 }//End if hasAVX512
 				 else if (tpa::hasAVX)
@@ -718,11 +714,11 @@ namespace tpa{
 
 					 for (; (i + 8) < end; i += 8)
 					 {
-						 _num = _mm256_load_ps(&source[i]);
+						 _num = _mm256_loadu_ps(&source[i]);
 
 						 _dest = _mm256_cvtps_epi32(_mm256_floor_ps(_num));
 
-						 _mm256_store_si256((__m256i*)&dest[i], _dest);
+						 _mm256_storeu_si256((__m256i*)&dest[i], _dest);
 					 }//End for
 				 }//End if hasAVX
 				 else if (tpa::has_SSE41)
@@ -732,11 +728,11 @@ namespace tpa{
 
 					 for (; (i + 4) < end; i += 4)
 					 {
-						 _num = _mm_load_ps(&source[i]);
+						 _num = _mm_loadu_ps(&source[i]);
 
 						 _dest = _mm_cvtps_epi32(_mm_floor_ps(_num));
 
-						 _mm_store_si128((__m128i*)&dest[i], _dest);
+						 _mm_storeu_si128((__m128i*)&dest[i], _dest);
 					 }//End for
 				 }//End if has_SSE4.1
 #endif
@@ -753,11 +749,11 @@ namespace tpa{
 
 					 for (; (i + 16) < end; i += 16)
 					 {
-						 _num = _mm512_load_ps(&source[i]);
+						 _num = _mm512_loadu_ps(&source[i]);
 
 						 _dest = _mm512_cvt_roundps_epu32(_num, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
 
-						 _mm512_store_epi32(&dest[i], _dest);
+						 _mm512_storeu_epi32(&dest[i], _dest);
 					 }//End for
 				 }//End if hasAVX512	
 #endif
@@ -773,11 +769,11 @@ namespace tpa{
 
 							for (; (i+8) < end; i += 8)
 							{
-								_num = _mm512_load_pd(&source[i]);
+								_num = _mm512_loadu_pd(&source[i]);
 
 								_num = _mm512_floor_pd(_num);
 
-								_mm512_store_pd(&dest[i], _num);
+								_mm512_storeu_pd(&dest[i], _num);
 							}//End for
 						}//End if hasAVX512
 						else if (tpa::hasAVX)
@@ -786,11 +782,11 @@ namespace tpa{
 
 							for (; (i+4) < end; i += 4)
 							{
-								_num = _mm256_load_pd(&source[i]);
+								_num = _mm256_loadu_pd(&source[i]);
 
 								_num = _mm256_floor_pd(_num);
 
-								_mm256_store_pd(&dest[i], _num);
+								_mm256_storeu_pd(&dest[i], _num);
 							}//End for
 						}//End if hasAVX
 						else if (tpa::has_SSE41)
@@ -799,11 +795,11 @@ namespace tpa{
 
 							for (; (i + 2) < end; i += 2)
 							{
-								_num = _mm_load_pd(&source[i]);
+								_num = _mm_loadu_pd(&source[i]);
 
 								_num = _mm_floor_pd(_num);
 
-								_mm_store_pd(&dest[i], _num);
+								_mm_storeu_pd(&dest[i], _num);
 							}//End for
 						}//End if has_SSE4.1
 #endif
@@ -820,11 +816,11 @@ namespace tpa{
 
 					 for (; (i + 8) < end; i += 8)
 					 {
-						 _num = _mm512_load_pd(&source[i]);
+						 _num = _mm512_loadu_pd(&source[i]);
 
 						 _dest = _mm512_cvt_roundpd_epi64(_num, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
 
-						 _mm512_store_epi64(&dest[i], _dest);
+						 _mm512_storeu_epi64(&dest[i], _dest);
 					 }//End for
 				 }//End if hasAVX512	
 #endif
@@ -841,11 +837,11 @@ namespace tpa{
 
 					 for (; (i + 8) < end; i += 8)
 					 {
-						 _num = _mm512_load_pd(&source[i]);
+						 _num = _mm512_loadu_pd(&source[i]);
 
 						 _dest = _mm512_cvt_roundpd_epu64(_num, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
 
-						 _mm512_store_epi64(&dest[i], _dest);
+						 _mm512_storeu_epi64(&dest[i], _dest);
 					 }//End for
 				 }//End if hasAVX512	
 #endif
@@ -883,14 +879,6 @@ namespace tpa{
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::floor: " << ex.what() << "\n";
-			std::cerr << "tpa::simd::floor will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -950,9 +938,11 @@ namespace tpa{
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::ceil: " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::ceil will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
@@ -980,11 +970,11 @@ namespace tpa{
 
 								for (; (i+16) < end; i += 16)
 								{
-									_num = _mm512_load_ps(&source[i]);
+									_num = _mm512_loadu_ps(&source[i]);
 
 									_num = _mm512_ceil_ps(_num);
 
-									_mm512_store_ps(&dest[i], _num);
+									_mm512_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX)
@@ -993,11 +983,11 @@ namespace tpa{
 
 								for (; (i+8) < end; i += 8)
 								{
-									_num = _mm256_load_ps(&source[i]);
+									_num = _mm256_loadu_ps(&source[i]);
 
 									_num = _mm256_ceil_ps(_num);
 
-									_mm256_store_ps(&dest[i], _num);
+									_mm256_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End if hasAVX
 							else if (tpa::has_SSE41)
@@ -1006,11 +996,11 @@ namespace tpa{
 
 								for (; (i + 4) < end; i += 4)
 								{
-									_num = _mm_load_ps(&source[i]);
+									_num = _mm_loadu_ps(&source[i]);
 
 									_num = _mm_ceil_ps(_num);
 
-									_mm_store_ps(&dest[i], _num);
+									_mm_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End if has_SSE4.1
 #endif
@@ -1027,11 +1017,11 @@ namespace tpa{
 
 								for (; (i + 16) < end; i += 16)
 								{
-									_num = _mm512_load_ps(&source[i]);
+									_num = _mm512_loadu_ps(&source[i]);
 
 									_dest = _mm512_cvt_roundps_epi32(_num, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
 
-									_mm512_store_epi32(&dest[i], _dest);
+									_mm512_storeu_epi32(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX)
@@ -1041,11 +1031,11 @@ namespace tpa{
 
 								for (; (i + 8) < end; i += 8)
 								{
-									_num = _mm256_load_ps(&source[i]);
+									_num = _mm256_loadu_ps(&source[i]);
 
 									_dest = _mm256_cvtps_epi32(_mm256_ceil_ps(_num));
 
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if hasAVX
 							else if (tpa::has_SSE41)
@@ -1055,11 +1045,11 @@ namespace tpa{
 
 								for (; (i + 4) < end; i += 4)
 								{
-									_num = _mm_load_ps(&source[i]);
+									_num = _mm_loadu_ps(&source[i]);
 
 									_dest = _mm_cvtps_epi32(_mm_ceil_ps(_num));
 
-									_mm_store_si128((__m128i*) & dest[i], _dest);
+									_mm_storeu_si128((__m128i*) & dest[i], _dest);
 								}//End for
 							}//End if has_SSE4.1
 #endif
@@ -1076,11 +1066,11 @@ namespace tpa{
 
 								for (; (i + 16) < end; i += 16)
 								{
-									_num = _mm512_load_ps(&source[i]);
+									_num = _mm512_loadu_ps(&source[i]);
 
 									_dest = _mm512_cvt_roundps_epu32(_num, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
 
-									_mm512_store_epi32(&dest[i], _dest);
+									_mm512_storeu_epi32(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512	
 #endif
@@ -1096,11 +1086,11 @@ namespace tpa{
 
 								for (; (i+8) < end; i += 8)
 								{
-									_num = _mm512_load_pd(&source[i]);
+									_num = _mm512_loadu_pd(&source[i]);
 
 									_num = _mm512_ceil_pd(_num);
 
-									_mm512_store_pd(&dest[i], _num);
+									_mm512_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX)
@@ -1109,11 +1099,11 @@ namespace tpa{
 
 								for (; (i+4) < end; i += 4)
 								{
-									_num = _mm256_load_pd(&source[i]);
+									_num = _mm256_loadu_pd(&source[i]);
 
 									_num = _mm256_ceil_pd(_num);
 
-									_mm256_store_pd(&dest[i], _num);
+									_mm256_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End if hasAVX
 							else if (tpa::has_SSE41)
@@ -1122,11 +1112,11 @@ namespace tpa{
 
 								for (; (i + 2) < end; i += 2)
 								{
-									_num = _mm_load_pd(&source[i]);
+									_num = _mm_loadu_pd(&source[i]);
 
 									_num = _mm_ceil_pd(_num);
 
-									_mm_store_pd(&dest[i], _num);
+									_mm_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End if has_SSE4.1
 #endif
@@ -1143,11 +1133,11 @@ namespace tpa{
 
 								for (; (i + 8) < end; i += 8)
 								{
-									_num = _mm512_load_pd(&source[i]);
+									_num = _mm512_loadu_pd(&source[i]);
 
 									_dest = _mm512_cvt_roundpd_epi64(_num, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
 
-									_mm512_store_epi64(&dest[i], _dest);
+									_mm512_storeu_epi64(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512	
 #endif
@@ -1164,11 +1154,11 @@ namespace tpa{
 
 								for (; (i + 8) < end; i += 8)
 								{
-									_num = _mm512_load_pd(&source[i]);
+									_num = _mm512_loadu_pd(&source[i]);
 
 									_dest = _mm512_cvt_roundpd_epu64(_num, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
 
-									_mm512_store_epi64(&dest[i], _dest);
+									_mm512_storeu_epi64(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512	
 #endif
@@ -1206,14 +1196,6 @@ namespace tpa{
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::ceil: " << ex.what() << "\n";
-			std::cerr << "tpa::simd::ceil will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -1294,9 +1276,11 @@ namespace tpa{
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::round: " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::round will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
@@ -1327,11 +1311,11 @@ namespace tpa{
 
 								for (; (i+16) < end; i += 16)
 								{
-									_num = _mm512_load_ps(&source[i]);
+									_num = _mm512_loadu_ps(&source[i]);
 
 									_num = _mm512_roundscale_round_ps(_num, (int8_t)MODE, _MM_FROUND_NO_EXC);
 
-									_mm512_store_ps(&dest[i], _num);
+									_mm512_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End if no_fp_ex
 							else
@@ -1340,11 +1324,11 @@ namespace tpa{
 
 								for (; (i+16) < end; i += 16)
 								{
-									_num = _mm512_load_ps(&source[i]);
+									_num = _mm512_loadu_ps(&source[i]);
 
 									_num = _mm512_roundscale_ps(_num, (int8_t)MODE);
 
-									_mm512_store_ps(&dest[i], _num);
+									_mm512_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End if
 						}//End if hasAVX512
@@ -1356,11 +1340,11 @@ namespace tpa{
 
 								for (; (i+8) < end; i += 8)
 								{
-									_num = _mm256_load_ps(&source[i]);
+									_num = _mm256_loadu_ps(&source[i]);
 
 									_num = _mm256_round_ps(_num, (int8_t)MODE | _MM_FROUND_NO_EXC);
 
-									_mm256_store_ps(&dest[i], _num);
+									_mm256_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End if no_fp_ex
 							else
@@ -1369,11 +1353,11 @@ namespace tpa{
 
 								for (; (i+8) < end; i += 8)
 								{
-									_num = _mm256_load_ps(&source[i]);
+									_num = _mm256_loadu_ps(&source[i]);
 
 									_num = _mm256_round_ps(_num, (int8_t)MODE);
 
-									_mm256_store_ps(&dest[i], _num);
+									_mm256_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End else
 						}//End if hasAVX
@@ -1385,11 +1369,11 @@ namespace tpa{
 
 								for (; (i + 4) < end; i += 4)
 								{
-									_num = _mm_load_ps(&source[i]);
+									_num = _mm_loadu_ps(&source[i]);
 
 									_num = _mm_round_ps(_num, (int8_t)MODE | _MM_FROUND_NO_EXC);
 
-									_mm_store_ps(&dest[i], _num);
+									_mm_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End if no_fp_ex
 							else
@@ -1398,11 +1382,11 @@ namespace tpa{
 
 								for (; (i + 4) < end; i += 4)
 								{
-									_num = _mm_load_ps(&source[i]);
+									_num = _mm_loadu_ps(&source[i]);
 
 									_num = _mm_round_ps(_num, (int8_t)MODE);
 
-									_mm_store_ps(&dest[i], _num);
+									_mm_storeu_ps(&dest[i], _num);
 								}//End for
 							}//End else
 						}//End if has_SSE4.1
@@ -1422,11 +1406,11 @@ namespace tpa{
 
 								for (; (i + 16) < end; i += 16)
 								{
-									_num = _mm512_load_ps(&source[i]);
+									_num = _mm512_loadu_ps(&source[i]);
 
 									_dest = _mm512_cvt_roundps_epi32(_num, (int8_t)MODE | _MM_FROUND_NO_EXC);
 
-									_mm512_store_epi32(&dest[i], _dest);
+									_mm512_storeu_epi32(&dest[i], _dest);
 								}//End for
 							}//End if no except
 							else
@@ -1436,11 +1420,11 @@ namespace tpa{
 
 								for (; (i + 16) < end; i += 16)
 								{
-									_num = _mm512_load_ps(&source[i]);
+									_num = _mm512_loadu_ps(&source[i]);
 
 									_dest = _mm512_cvt_roundps_epi32(_num, (int8_t)MODE);
 
-									_mm512_store_epi32(&dest[i], _dest);
+									_mm512_storeu_epi32(&dest[i], _dest);
 								}//End for
 							}//End else
 						}//End if hasAVX512
@@ -1453,11 +1437,11 @@ namespace tpa{
 
 								for (; (i + 8) < end; i += 8)
 								{
-									_num = _mm256_load_ps(&source[i]);
+									_num = _mm256_loadu_ps(&source[i]);
 
 									_dest = _mm256_cvtps_epi32(_mm256_round_ps(_num, (int8_t)MODE | _MM_FROUND_NO_EXC));
 
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End if no except
 							else
@@ -1467,11 +1451,11 @@ namespace tpa{
 
 								for (; (i + 8) < end; i += 8)
 								{
-									_num = _mm256_load_ps(&source[i]);
+									_num = _mm256_loadu_ps(&source[i]);
 
 									_dest = _mm256_cvtps_epi32(_mm256_round_ps(_num, (int8_t)MODE));
 
-									_mm256_store_si256((__m256i*) & dest[i], _dest);
+									_mm256_storeu_si256((__m256i*) & dest[i], _dest);
 								}//End for
 							}//End else
 						}//End if hasAVX
@@ -1484,11 +1468,11 @@ namespace tpa{
 
 								for (; (i + 4) < end; i += 4)
 								{
-									_num = _mm_load_ps(&source[i]);
+									_num = _mm_loadu_ps(&source[i]);
 
 									_dest = _mm_cvtps_epi32(_mm_round_ps(_num, (int8_t)MODE | _MM_FROUND_NO_EXC));
 
-									_mm_store_si128((__m128i*) & dest[i], _dest);
+									_mm_storeu_si128((__m128i*) & dest[i], _dest);
 								}//End for
 							}//End if no except
 							else
@@ -1498,11 +1482,11 @@ namespace tpa{
 
 								for (; (i + 4) < end; i += 4)
 								{
-									_num = _mm_load_ps(&source[i]);
+									_num = _mm_loadu_ps(&source[i]);
 
 									_dest = _mm_cvtps_epi32(_mm_round_ps(_num, (int8_t)MODE));
 
-									_mm_store_si128((__m128i*) & dest[i], _dest);
+									_mm_storeu_si128((__m128i*) & dest[i], _dest);
 								}//End for
 							}//End else
 						}//End if has_SSE4.1
@@ -1522,11 +1506,11 @@ namespace tpa{
 
 								for (; (i + 16) < end; i += 16)
 								{
-									_num = _mm512_load_ps(&source[i]);
+									_num = _mm512_loadu_ps(&source[i]);
 
 									_dest = _mm512_cvt_roundps_epu32(_num, (int8_t)MODE | _MM_FROUND_NO_EXC);
 
-									_mm512_store_epi32(&dest[i], _dest);
+									_mm512_storeu_epi32(&dest[i], _dest);
 								}//End for
 							}//End if no except
 							else
@@ -1536,11 +1520,11 @@ namespace tpa{
 
 								for (; (i + 16) < end; i += 16)
 								{
-									_num = _mm512_load_ps(&source[i]);
+									_num = _mm512_loadu_ps(&source[i]);
 
 									_dest = _mm512_cvt_roundps_epu32(_num, (int8_t)MODE);
 
-									_mm512_store_epi32(&dest[i], _dest);
+									_mm512_storeu_epi32(&dest[i], _dest);
 								}//End for
 							}//End else
 						}//End if hasAVX512	
@@ -1559,11 +1543,11 @@ namespace tpa{
 
 								for (; (i+8) < end; i += 8)
 								{
-									_num = _mm512_load_pd(&source[i]);
+									_num = _mm512_loadu_pd(&source[i]);
 
 									_num = _mm512_roundscale_round_pd(_num, (int8_t)MODE, _MM_FROUND_NO_EXC);
 
-									_mm512_store_pd(&dest[i], _num);
+									_mm512_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End if no_fp_ex
 							else
@@ -1572,11 +1556,11 @@ namespace tpa{
 
 								for (; (i+8) < end; i += 8)
 								{
-									_num = _mm512_load_pd(&source[i]);
+									_num = _mm512_loadu_pd(&source[i]);
 
 									_num = _mm512_roundscale_pd(_num, (int8_t)MODE);
 
-									_mm512_store_pd(&dest[i], _num);
+									_mm512_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End if
 						}//End if hasAVX512
@@ -1588,11 +1572,11 @@ namespace tpa{
 
 								for (; (i+4) < end; i += 4)
 								{
-									_num = _mm256_load_pd(&source[i]);
+									_num = _mm256_loadu_pd(&source[i]);
 
 									_num = _mm256_round_pd(_num, (int8_t)MODE | _MM_FROUND_NO_EXC);
 
-									_mm256_store_pd(&dest[i], _num);
+									_mm256_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End if no_fp_ex
 							else
@@ -1601,11 +1585,11 @@ namespace tpa{
 
 								for (; (i+4) < end; i += 4)
 								{
-									_num = _mm256_load_pd(&source[i]);
+									_num = _mm256_loadu_pd(&source[i]);
 
 									_num = _mm256_round_pd(_num, (int8_t)MODE);
 
-									_mm256_store_pd(&dest[i], _num);
+									_mm256_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End else
 						}//End if hasAVX
@@ -1617,11 +1601,11 @@ namespace tpa{
 
 								for (; (i + 2) < end; i += 2)
 								{
-									_num = _mm_load_pd(&source[i]);
+									_num = _mm_loadu_pd(&source[i]);
 
 									_num = _mm_round_pd(_num, (int8_t)MODE | _MM_FROUND_NO_EXC);
 
-									_mm_store_pd(&dest[i], _num);
+									_mm_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End if no_fp_ex
 							else
@@ -1630,11 +1614,11 @@ namespace tpa{
 
 								for (; (i + 2) < end; i += 2)
 								{
-									_num = _mm_load_pd(&source[i]);
+									_num = _mm_loadu_pd(&source[i]);
 
 									_num = _mm_round_pd(_num, (int8_t)MODE);
 
-									_mm_store_pd(&dest[i], _num);
+									_mm_storeu_pd(&dest[i], _num);
 								}//End for
 							}//End else
 						}//End if has_SSE4.1
@@ -1654,11 +1638,11 @@ namespace tpa{
 
 								for (; (i + 8) < end; i += 8)
 								{
-									_num = _mm512_load_pd(&source[i]);
+									_num = _mm512_loadu_pd(&source[i]);
 
 									_dest = _mm512_cvt_roundpd_epi64(_num, (int8_t)MODE | _MM_FROUND_NO_EXC);
 
-									_mm512_store_epi64(&dest[i], _dest);
+									_mm512_storeu_epi64(&dest[i], _dest);
 								}//End for
 							}//End if no except
 							else
@@ -1668,11 +1652,11 @@ namespace tpa{
 
 								for (; (i + 8) < end; i += 8)
 								{
-									_num = _mm512_load_pd(&source[i]);
+									_num = _mm512_loadu_pd(&source[i]);
 
 									_dest = _mm512_cvt_roundpd_epi64(_num, (int8_t)MODE);
 
-									_mm512_store_epi64(&dest[i], _dest);
+									_mm512_storeu_epi64(&dest[i], _dest);
 								}//End for
 							}//End else
 						}//End if hasAVX512	
@@ -1692,11 +1676,11 @@ namespace tpa{
 
 								for (; (i + 8) < end; i += 8)
 								{
-									_num = _mm512_load_pd(&source[i]);
+									_num = _mm512_loadu_pd(&source[i]);
 
 									_dest = _mm512_cvt_roundpd_epu64(_num, (int8_t)MODE | _MM_FROUND_NO_EXC);
 
-									_mm512_store_epi64(&dest[i], _dest);
+									_mm512_storeu_epi64(&dest[i], _dest);
 								}//End for
 							}//End if no except
 							else
@@ -1706,11 +1690,11 @@ namespace tpa{
 
 								for (; (i + 8) < end; i += 8)
 								{
-									_num = _mm512_load_pd(&source[i]);
+									_num = _mm512_loadu_pd(&source[i]);
 
 									_dest = _mm512_cvt_roundpd_epu64(_num, (int8_t)MODE);
 
-									_mm512_store_epi64(&dest[i], _dest);
+									_mm512_storeu_epi64(&dest[i], _dest);
 								}//End for
 							}//End else
 						}//End if hasAVX512	
@@ -1771,14 +1755,6 @@ namespace tpa{
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::round: " << ex.what() << "\n";
-			std::cerr << "tpa::simd::round will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -1848,9 +1824,11 @@ namespace tpa{
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::round_nearest: " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::round_nearest will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
@@ -1907,7 +1885,7 @@ namespace tpa{
 
 							for (; (i+32) < end; i += 32)
 							{
-								_num = _mm256_load_si256((__m256i*) & source[i]);
+								_num = _mm256_loadu_si256((__m256i*) & source[i]);
 
 								_num = _mm256_add_epi8(_num, _half);
 								_num = _mm256_div_epi8(_num, _mult);
@@ -1921,9 +1899,9 @@ namespace tpa{
 									d[x] = static_cast<int8_t>(_num[x] * _mult[x]);
 #endif
 								}//End for
-								_num = _mm256_load_si256((__m256i*) &d);
+								_num = _mm256_loadu_si256((__m256i*) &d);
 
-								_mm256_store_si256((__m256i*) & dest[i], _num);
+								_mm256_storeu_si256((__m256i*) & dest[i], _num);
 							}//End for
 						}//End if hasAVX2
 #endif
@@ -1968,7 +1946,7 @@ namespace tpa{
 
 							for (; (i+32) < end; i += 32)
 							{
-								_num = _mm256_load_si256((__m256i*) & source[i]);
+								_num = _mm256_loadu_si256((__m256i*) & source[i]);
 
 								_num = _mm256_add_epi8(_num, _half);
 								_num = _mm256_div_epu8(_num, _mult);
@@ -1982,9 +1960,9 @@ namespace tpa{
 									d[x] = static_cast<uint8_t>(_num[x] * _mult[x]);
 #endif
 								}//End for
-								_num = _mm256_load_si256((__m256i*) & d);
+								_num = _mm256_loadu_si256((__m256i*) & d);
 
-								_mm256_store_si256((__m256i*) & dest[i], _num);
+								_mm256_storeu_si256((__m256i*) & dest[i], _num);
 							}//End for
 						}//End if hasAVX2
 #endif
@@ -2019,13 +1997,13 @@ namespace tpa{
 
 							for (; (i+16) < end; i += 16)
 							{
-								_num = _mm256_load_si256((__m256i*) & source[i]);
+								_num = _mm256_loadu_si256((__m256i*) & source[i]);
 
 								_num = _mm256_add_epi16(_num, _half);
 								_num = _mm256_div_epi16(_num, _mult);
 								_num = _mm256_mullo_epi16(_num, _mult);
 
-								_mm256_store_si256((__m256i*) & dest[i], _num);
+								_mm256_storeu_si256((__m256i*) & dest[i], _num);
 							}//End for
 						}//End if hasAVX2
 #endif
@@ -2060,13 +2038,13 @@ namespace tpa{
 
 							for (; (i+16) < end; i += 16)
 							{
-								_num = _mm256_load_si256((__m256i*) & source[i]);
+								_num = _mm256_loadu_si256((__m256i*) & source[i]);
 
 								_num = _mm256_add_epi16(_num, _half);
 								_num = _mm256_div_epu16(_num, _mult);
 								_num = _mm256_mullo_epi16(_num, _mult);
 
-								_mm256_store_si256((__m256i*) & dest[i], _num);
+								_mm256_storeu_si256((__m256i*) & dest[i], _num);
 							}//End for
 						}//End if hasAVX2
 #endif
@@ -2084,13 +2062,13 @@ namespace tpa{
 
 							for (; (i+16) < end; i += 16)
 							{
-								_num = _mm512_load_epi32(&source[i]);
+								_num = _mm512_loadu_epi32(&source[i]);
 
 								_num = _mm512_add_epi32(_num, _half);
 								_num = _mm512_div_epi32(_num, _mult);
 								_num = _mm512_mullo_epi32(_num, _mult);
 
-								_mm512_store_epi32(&dest[i], _num);
+								_mm512_storeu_epi32(&dest[i], _num);
 							}//End for
 						}//End if hasAVX512
 						else if (tpa::hasAVX2)
@@ -2101,13 +2079,13 @@ namespace tpa{
 
 							for (; (i+8) < end; i += 8)
 							{
-								_num = _mm256_load_si256((__m256i*)&source[i]);
+								_num = _mm256_loadu_si256((__m256i*)&source[i]);
 								
 								_num = _mm256_add_epi32(_num, _half);
 								_num = _mm256_div_epi32(_num, _mult);
 								_num = _mm256_mullo_epi32(_num, _mult);
 
-								_mm256_store_si256((__m256i*)&dest[i], _num);
+								_mm256_storeu_si256((__m256i*)&dest[i], _num);
 							}//End for
 						}//End if hasAVX2
 #endif
@@ -2125,13 +2103,13 @@ namespace tpa{
 
 							for (; (i+16) < end; i += 16)
 							{
-								_num = _mm512_load_epi32(&source[i]);
+								_num = _mm512_loadu_epi32(&source[i]);
 
 								_num = _mm512_add_epi32(_num, _half);
 								_num = _mm512_div_epu32(_num, _mult);
 								_num = _mm512_mullo_epi32(_num, _mult);
 
-								_mm512_store_epi32(&dest[i], _num);
+								_mm512_storeu_epi32(&dest[i], _num);
 							}//End for
 						}//End if hasAVX512
 						else if (tpa::hasAVX2)
@@ -2142,13 +2120,13 @@ namespace tpa{
 
 							for (; (i+8) < end; i += 8)
 							{
-								_num = _mm256_load_si256((__m256i*) & source[i]);
+								_num = _mm256_loadu_si256((__m256i*) & source[i]);
 
 								_num = _mm256_add_epi32(_num, _half);
 								_num = _mm256_div_epu32(_num, _mult);
 								_num = _mm256_mullo_epi32(_num, _mult);
 
-								_mm256_store_si256((__m256i*) & dest[i], _num);
+								_mm256_storeu_si256((__m256i*) & dest[i], _num);
 							}//End for
 						}//End if hasAVX2
 #endif
@@ -2166,13 +2144,13 @@ namespace tpa{
 
 							for (; (i+8) < end; i += 8)
 							{
-								_num = _mm512_load_epi64(&source[i]);
+								_num = _mm512_loadu_epi64(&source[i]);
 
 								_num = _mm512_add_epi64(_num, _half);
 								_num = _mm512_div_epi64(_num, _mult);
 								_num = _mm512_mullox_epi64(_num, _mult);
 
-								_mm512_store_epi64(&dest[i], _num);
+								_mm512_storeu_epi64(&dest[i], _num);
 							}//End for
 						}//End if hasAVX512
 						else if (tpa::hasAVX2)
@@ -2183,13 +2161,13 @@ namespace tpa{
 
 							for (; (i+4) < end; i += 4)
 							{
-								_num = _mm256_load_si256((__m256i*) & source[i]);
+								_num = _mm256_loadu_si256((__m256i*) & source[i]);
 
 								_num = _mm256_add_epi64(_num, _half);
 								_num = _mm256_div_epi64(_num, _mult);								
 								_num = tpa::simd::_mm256_mul_epi64(_num, _mult);
 
-								_mm256_store_si256((__m256i*) & dest[i], _num);
+								_mm256_storeu_si256((__m256i*) & dest[i], _num);
 							}//End for
 						}//End if hasAVX2
 #endif
@@ -2207,13 +2185,13 @@ namespace tpa{
 
 						for (; (i+8) < end; i += 8)
 						{
-							_num = _mm512_load_epi64(&source[i]);
+							_num = _mm512_loadu_epi64(&source[i]);
 
 							_num = _mm512_add_epi64(_num, _half);
 							_num = _mm512_div_epu64(_num, _mult);
 							_num = _mm512_mullox_epi64(_num, _mult);
 
-							_mm512_store_epi64(&dest[i], _num);
+							_mm512_storeu_epi64(&dest[i], _num);
 						}//End for
 					}//End if hasAVX512
 					else if (tpa::hasAVX2)
@@ -2224,13 +2202,13 @@ namespace tpa{
 
 						for (; (i+4) < end; i += 4)
 						{
-							_num = _mm256_load_si256((__m256i*) & source[i]);
+							_num = _mm256_loadu_si256((__m256i*) & source[i]);
 
 							_num = _mm256_add_epi64(_num, _half);
 							_num = _mm256_div_epu64(_num, _mult);
 							_num = tpa::simd::_mm256_mul_epi64(_num, _mult);
 
-							_mm256_store_si256((__m256i*) & dest[i], _num);
+							_mm256_storeu_si256((__m256i*) & dest[i], _num);
 						}//End for
 					}//End if hasAVX2
 #endif
@@ -2249,7 +2227,7 @@ namespace tpa{
 
 						for (; (i+16) < end; i += 16)
 						{
-							_num = _mm512_load_ps(&source[i]);
+							_num = _mm512_loadu_ps(&source[i]);
 							_num = _mm512_roundscale_ps(_num, _MM_FROUND_FLOOR | _MM_FROUND_NO_EXC);
 
 							_num = _mm512_add_ps(_num, _half);
@@ -2257,7 +2235,7 @@ namespace tpa{
 							_num = _mm512_roundscale_ps(_num, _MM_FROUND_FLOOR | _MM_FROUND_NO_EXC);
 							_num = _mm512_mul_ps(_num, _mult);
 
-							_mm512_store_ps(&dest[i], _num);
+							_mm512_storeu_ps(&dest[i], _num);
 						}//End for
 					}//End if hasAVX512
 					else if (tpa::hasAVX)
@@ -2268,7 +2246,7 @@ namespace tpa{
 
 						for (; (i+8) < end; i += 8)
 						{
-							_num = _mm256_load_ps(&source[i]);
+							_num = _mm256_loadu_ps(&source[i]);
 							_num = _mm256_round_ps(_num, _MM_FROUND_FLOOR | _MM_FROUND_NO_EXC);
 
 							_num = _mm256_add_ps(_num, _half);
@@ -2276,7 +2254,7 @@ namespace tpa{
 							_num = _mm256_round_ps(_num, _MM_FROUND_FLOOR | _MM_FROUND_NO_EXC);
 							_num = _mm256_mul_ps(_num, _mult);
 														
-							_mm256_store_ps(&dest[i], _num);
+							_mm256_storeu_ps(&dest[i], _num);
 						}//End for
 					}//End if hasAVX
 					else if (tpa::has_SSE41)
@@ -2287,7 +2265,7 @@ namespace tpa{
 
 						for (; (i + 4) < end; i += 4)
 						{
-							_num = _mm_load_ps(&source[i]);
+							_num = _mm_loadu_ps(&source[i]);
 							_num = _mm_round_ps(_num, _MM_FROUND_FLOOR | _MM_FROUND_NO_EXC);
 
 							_num = _mm_add_ps(_num, _half);
@@ -2295,7 +2273,7 @@ namespace tpa{
 							_num = _mm_round_ps(_num, _MM_FROUND_FLOOR | _MM_FROUND_NO_EXC);
 							_num = _mm_mul_ps(_num, _mult);
 
-							_mm_store_ps(&dest[i], _num);
+							_mm_storeu_ps(&dest[i], _num);
 						}//End for
 					}//End if has_SSE4.1
 #endif
@@ -2315,7 +2293,7 @@ namespace tpa{
 
 						for (; (i + 16) < end; i += 16)
 						{
-							_num = _mm512_load_ps(&source[i]);
+							_num = _mm512_loadu_ps(&source[i]);
 							_num = _mm512_roundscale_ps(_num, _MM_FROUND_FLOOR | _MM_FROUND_NO_EXC);
 
 							_num = _mm512_add_ps(_num, _half);
@@ -2325,7 +2303,7 @@ namespace tpa{
 
 							_res = _mm512_cvtps_epi32(_num);
 
-							_mm512_store_epi32(&dest[i], _res);
+							_mm512_storeu_epi32(&dest[i], _res);
 						}//End for
 					}//End if hasAVX512
 					else if (tpa::hasAVX)
@@ -2337,7 +2315,7 @@ namespace tpa{
 
 						for (; (i + 8) < end; i += 8)
 						{
-							_num = _mm256_load_ps(&source[i]);
+							_num = _mm256_loadu_ps(&source[i]);
 							_num = _mm256_round_ps(_num, _MM_FROUND_FLOOR | _MM_FROUND_NO_EXC);
 
 							_num = _mm256_add_ps(_num, _half);
@@ -2347,7 +2325,7 @@ namespace tpa{
 
 							_res = _mm256_cvtps_epi32(_num);
 
-							_mm256_store_si256((__m256i*)&dest[i], _res);
+							_mm256_storeu_si256((__m256i*)&dest[i], _res);
 						}//End for
 					}//End if hasAVX
 					else if (tpa::has_SSE41)
@@ -2359,7 +2337,7 @@ namespace tpa{
 
 						for (; (i + 4) < end; i += 4)
 						{
-							_num = _mm_load_ps(&source[i]);
+							_num = _mm_loadu_ps(&source[i]);
 							_num = _mm_round_ps(_num, _MM_FROUND_FLOOR | _MM_FROUND_NO_EXC);
 
 							_num = _mm_add_ps(_num, _half);
@@ -2369,7 +2347,7 @@ namespace tpa{
 
 							_res = _mm_cvtps_epi32(_num);
 
-							_mm_store_si128((__m128i*)&dest[i], _res);
+							_mm_storeu_si128((__m128i*)&dest[i], _res);
 						}//End for
 					}//End if has_SSE4.1
 #endif
@@ -2389,7 +2367,7 @@ namespace tpa{
 
 						for (; (i + 16) < end; i += 16)
 						{
-							_num = _mm512_load_ps(&source[i]);
+							_num = _mm512_loadu_ps(&source[i]);
 							_num = _mm512_roundscale_ps(_num, _MM_FROUND_FLOOR | _MM_FROUND_NO_EXC);
 
 							_num = _mm512_add_ps(_num, _half);
@@ -2399,7 +2377,7 @@ namespace tpa{
 
 							_res = _mm512_cvtps_epu32(_num);
 
-							_mm512_store_epi32(&dest[i], _res);
+							_mm512_storeu_epi32(&dest[i], _res);
 						}//End for
 					}//End if hasAVX512					
 #endif
@@ -2418,7 +2396,7 @@ namespace tpa{
 
 						for (; (i + 8) < end; i += 8)
 						{
-							_num = _mm512_load_pd(&source[i]);
+							_num = _mm512_loadu_pd(&source[i]);
 							_num = _mm512_roundscale_pd(_num, _MM_FROUND_FLOOR | _MM_FROUND_NO_EXC);
 
 							_num = _mm512_add_pd(_num, _half);
@@ -2426,7 +2404,7 @@ namespace tpa{
 							_num = _mm512_roundscale_pd(_num, _MM_FROUND_FLOOR | _MM_FROUND_NO_EXC);
 							_num = _mm512_mul_pd(_num, _mult);
 
-							_mm512_store_pd(&dest[i], _num);
+							_mm512_storeu_pd(&dest[i], _num);
 						}//End for
 					}//End if hasAVX512
 					else if (tpa::hasAVX)
@@ -2437,7 +2415,7 @@ namespace tpa{
 
 						for (; (i + 4) < end; i += 4)
 						{
-							_num = _mm256_load_pd(&source[i]);
+							_num = _mm256_loadu_pd(&source[i]);
 							_num = _mm256_round_pd(_num, _MM_FROUND_FLOOR | _MM_FROUND_NO_EXC);
 
 							_num = _mm256_add_pd(_num, _half);
@@ -2445,7 +2423,7 @@ namespace tpa{
 							_num = _mm256_round_pd(_num, _MM_FROUND_FLOOR | _MM_FROUND_NO_EXC);
 							_num = _mm256_mul_pd(_num, _mult);
 
-							_mm256_store_pd(&dest[i], _num);
+							_mm256_storeu_pd(&dest[i], _num);
 						}//End for
 					}//End if hasAVX
 					else if (tpa::has_SSE41)
@@ -2456,7 +2434,7 @@ namespace tpa{
 
 						for (; (i + 2) < end; i += 2)
 						{
-							_num = _mm_load_pd(&source[i]);
+							_num = _mm_loadu_pd(&source[i]);
 							_num = _mm_round_pd(_num, _MM_FROUND_FLOOR | _MM_FROUND_NO_EXC);
 
 							_num = _mm_add_pd(_num, _half);
@@ -2464,7 +2442,7 @@ namespace tpa{
 							_num = _mm_round_pd(_num, _MM_FROUND_FLOOR | _MM_FROUND_NO_EXC);
 							_num = _mm_mul_pd(_num, _mult);
 
-							_mm_store_pd(&dest[i], _num);
+							_mm_storeu_pd(&dest[i], _num);
 						}//End for
 					}//End if has_SSE4.1
 #endif
@@ -2484,7 +2462,7 @@ namespace tpa{
 
 							for (; (i + 8) < end; i += 8)
 							{
-								_num = _mm512_load_pd(&source[i]);
+								_num = _mm512_loadu_pd(&source[i]);
 								_num = _mm512_roundscale_pd(_num, _MM_FROUND_FLOOR | _MM_FROUND_NO_EXC);
 
 								_num = _mm512_add_pd(_num, _half);
@@ -2494,7 +2472,7 @@ namespace tpa{
 
 								_res = _mm512_cvtpd_epi64(_num);
 
-								_mm512_store_epi64(&dest[i], _res);
+								_mm512_storeu_epi64(&dest[i], _res);
 							}//End for
 						}//End if hasAVX512	
 #endif
@@ -2514,7 +2492,7 @@ namespace tpa{
 
 						for (; (i + 8) < end; i += 8)
 						{
-							_num = _mm512_load_pd(&source[i]);
+							_num = _mm512_loadu_pd(&source[i]);
 							_num = _mm512_roundscale_pd(_num, _MM_FROUND_FLOOR | _MM_FROUND_NO_EXC);
 
 							_num = _mm512_add_pd(_num, _half);
@@ -2524,7 +2502,7 @@ namespace tpa{
 
 							_res = _mm512_cvtpd_epu64(_num);
 
-							_mm512_store_epu64(&dest[i], _res);
+							_mm512_storeu_epi64(&dest[i], _res);
 						}//End for
 					}//End if hasAVX512	
 #endif
@@ -2555,14 +2533,6 @@ namespace tpa{
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::round_nearest: " << ex.what() << "\n";
-			std::cerr << "tpa::simd::round_nearest will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
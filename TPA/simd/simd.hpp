@@ -35,6 +35,26 @@
 #include "../predicates.hpp"
 #include "../InstructionSet.hpp"
 
+#if defined(TPA_X86_64) && !defined(_MSC_VER) && !defined(__INTEL_COMPILER)
+/// <summary>
+/// <para>_mm512_setr_epi16 is only provided by MSVC and ICC, sets the elements in reverse order of _mm512_set_epi16</para>
+/// </summary>
+/// <returns></returns>
+[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_setr_epi16(short e0, short e1, short e2, short e3, short e4, short e5, short e6, short e7, short e8, short e9, short e10, short e11, short e12, short e13, short e14, short e15, short e16, short e17, short e18, short e19, short e20, short e21, short e22, short e23, short e24, short e25, short e26, short e27, short e28, short e29, short e30, short e31) noexcept
+{
+	return _mm512_set_epi16(e31, e30, e29, e28, e27, e26, e25, e24, e23, e22, e21, e20, e19, e18, e17, e16, e15, e14, e13, e12, e11, e10, e9, e8, e7, e6, e5, e4, e3, e2, e1, e0);
+}//End of _mm512_setr_epi16
+
+/// <summary>
+/// <para>_mm512_setr_epi8 is only provided by MSVC and ICC, sets the elements in reverse order of _mm512_set_epi8</para>
+/// </summary>
+/// <returns></returns>
+[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_setr_epi8(char e0, char e1, char e2, char e3, char e4, char e5, char e6, char e7, char e8, char e9, char e10, char e11, char e12, char e13, char e14, char e15, char e16, char e17, char e18, char e19, char e20, char e21, char e22, char e23, char e24, char e25, char e26, char e27, char e28, char e29, char e30, char e31, char e32, char e33, char e34, char e35, char e36, char e37, char e38, char e39, char e40, char e41, char e42, char e43, char e44, char e45, char e46, char e47, char e48, char e49, char e50, char e51, char e52, char e53, char e54, char e55, char e56, char e57, char e58, char e59, char e60, char e61, char e62, char e63) noexcept
+{
+	return _mm512_set_epi8(e63, e62, e61, e60, e59, e58, e57, e56, e55, e54, e53, e52, e51, e50, e49, e48, e47, e46, e45, e44, e43, e42, e41, e40, e39, e38, e37, e36, e35, e34, e33, e32, e31, e30, e29, e28, e27, e26, e25, e24, e23, e22, e21, e20, e19, e18, e17, e16, e15, e14, e13, e12, e11, e10, e9, e8, e7, e6, e5, e4, e3, e2, e1, e0);
+}//End of _mm512_setr_epi8
+#endif
+
 /// <summary>
 /// TPA SIMD Utility Functions
 /// </summary>
@@ -525,7 +545,7 @@ namespace tpa::simd {
 	///</summary>
 	/// <param name="x"></param>
 	/// <returns>__m256i</returns>
-	[[nodiscard]] inline __m256i _mm256_not_si256(const __m256i& x) noexcept
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_not_si256(const __m256i& x) noexcept
 	{
 		return _mm256_xor_si256(x, _mm256_set1_epi64x(-1LL));
 	}//End of _mm256_not_si256
@@ -538,7 +558,7 @@ namespace tpa::simd {
 	///</summary>
 	/// <param name="x"></param>
 	/// <returns>__m512i</returns>
-	[[nodiscard]] inline __m512i _mm512_not_si512(const __m512i& x) noexcept
+	[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_not_si512(const __m512i& x) noexcept
 	{
 		return _mm512_xor_si512(x, _mm512_set1_epi64(-1LL));
 	}//End of _mm512_not_si512
@@ -583,7 +603,7 @@ namespace tpa::simd {
 	///</summary>
 	/// <param name="x"></param>
 	/// <returns>__m256i</returns>
-	[[nodiscard]] inline __m256i _mm256_exthsb_epi16(const __m256i& x) noexcept
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_exthsb_epi16(const __m256i& x) noexcept
 	{		
 		const __m256i _one = _mm256_set1_epi16(static_cast<int16_t>(1));
 
@@ -615,7 +635,7 @@ namespace tpa::simd {
 	///</summary>
 	/// <param name="x"></param>
 	/// <returns>__m512i</returns>
-	[[nodiscard]] inline __m512i _mm512_exthsb_epi16(const __m512i& x) noexcept
+	[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_exthsb_epi16(const __m512i& x) noexcept
 	{
 		const __m512i _one = _mm512_set1_epi16(static_cast<int16_t>(1));
 
@@ -680,7 +700,7 @@ namespace tpa::simd {
 	///</summary>
 	/// <param name="x"></param>
 	/// <returns>__m256i</returns>
-	[[nodiscard]] inline __m256i _mm256_exthsb_epi32(const __m256i& x) noexcept
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_exthsb_epi32(const __m256i& x) noexcept
 	{
 		const __m256i _one = _mm256_set1_epi16(1);
 
@@ -713,7 +733,7 @@ namespace tpa::simd {
 	///</summary>
 	/// <param name="x"></param>
 	/// <returns>__m512i</returns>
-	[[nodiscard]] inline __m512i _mm512_exthsb_epi32(const __m512i& x) noexcept
+	[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_exthsb_epi32(const __m512i& x) noexcept
 	{
 		const __m512i _one = _mm512_set1_epi32(1);
 
@@ -780,7 +800,7 @@ namespace tpa::simd {
 	///</summary>
 	/// <param name="x"></param>
 	/// <returns>__m256i</returns>
-	[[nodiscard]] inline __m256i _mm256_exthsb_epi64(const __m256i& x) noexcept
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_exthsb_epi64(const __m256i& x) noexcept
 	{
 		const __m256i _one = _mm256_set1_epi64x(1ll);
 
@@ -814,7 +834,7 @@ namespace tpa::simd {
 	///</summary>
 	/// <param name="x"></param>
 	/// <returns>__m512i</returns>
-	[[nodiscard]] inline __m512i _mm512_exthsb_epi64(const __m512i& x) noexcept
+	[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_exthsb_epi64(const __m512i& x) noexcept
 	{
 		const __m512i _one = _mm512_set1_epi64(1ll);
 
@@ -907,7 +927,7 @@ namespace tpa::simd {
 	///</summary>
 	/// <param name="x"></param>
 	/// <returns>__m256i</returns>
-	[[nodiscard]] inline __m256i _mm256_lzset_epi16(const __m256i& x) noexcept
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_lzset_epi16(const __m256i& x) noexcept
 	{
 		__m256i _mask = _mm256_or_si256(x, _mm256_srli_epi16(x, 1));
 
@@ -926,7 +946,7 @@ namespace tpa::simd {
 	///</summary>
 	/// <param name="x"></param>
 	/// <returns>__m256i</returns>
-	[[nodiscard]] inline __m256i _mm256_lzset_epi32(const __m256i& x) noexcept
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_lzset_epi32(const __m256i& x) noexcept
 	{
 		__m256i _mask = _mm256_or_si256(x, _mm256_srli_epi32(x, 1));
 
@@ -942,11 +962,11 @@ namespace tpa::simd {
 	///<para> Set leading zeros of 64-bit integers in an __m128i.</para>
 	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
 	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
-	/// <para>Warning: This function is unsafe if called on a platform without SSE2.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX2.</para>
 	///</summary>
 	/// <param name="x"></param>
 	/// <returns>__m256i</returns>
-	[[nodiscard]] inline __m256i _mm256_lzset_epi64(const __m256i& x) noexcept
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_lzset_epi64(const __m256i& x) noexcept
 	{
 		__m256i _mask = _mm256_or_si256(x, _mm256_srli_epi64(x, 1));
 
@@ -967,7 +987,7 @@ namespace tpa::simd {
 	///</summary>
 	/// <param name="x"></param>
 	/// <returns>__m512i</returns>
-	[[nodiscard]] inline __m512i _mm512_lzset_epi16(const __m512i& x) noexcept
+	[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_lzset_epi16(const __m512i& x) noexcept
 	{
 		__m512i _mask = _mm512_or_si512(x, _mm512_srli_epi16(x, 1));
 
@@ -986,7 +1006,7 @@ namespace tpa::simd {
 	///</summary>
 	/// <param name="x"></param>
 	/// <returns>__m512i</returns>
-	[[nodiscard]] inline __m512i _mm512_lzset_epi32(const __m512i& x) noexcept
+	[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_lzset_epi32(const __m512i& x) noexcept
 	{
 		__m512i _mask = _mm512_or_si512(x, _mm512_srli_epi32(x, 1));
 
@@ -1006,7 +1026,7 @@ namespace tpa::simd {
 	///</summary>
 	/// <param name="x"></param>
 	/// <returns>__m512i</returns>
-	[[nodiscard]] inline __m512i _mm512_lzset_epi64(const __m512i& x) noexcept
+	[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_lzset_epi64(const __m512i& x) noexcept
 	{
 		__m512i _mask = _mm512_or_si512(x, _mm512_srli_epi64(x, 1));
 
@@ -1088,7 +1108,7 @@ namespace tpa::simd {
 	/// <param name="a"></param>
 	/// <param name="b"></param>
 	/// <returns>__m128i</returns>
-	[[nodiscard]] inline __m128i _mm_cmpneq_epi64(const __m128i& a, const __m128i& b) noexcept
+	[[nodiscard]] TPA_TARGET_SSE41 inline __m128i _mm_cmpneq_epi64(const __m128i& a, const __m128i& b) noexcept
 	{
 		const __m128i _NEG_ONE = _mm_set1_epi64x(static_cast<int64_t>(-1));
 		__m128i _mask = _mm_setzero_si128();
@@ -1108,7 +1128,7 @@ namespace tpa::simd {
 	/// <param name="a"></param>
 	/// <param name="b"></param>
 	/// <returns>__m256i</returns>
-	[[nodiscard]] inline __m256i _mm256_cmpneq_epi8(const __m256i& a, const __m256i& b) noexcept
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_cmpneq_epi8(const __m256i& a, const __m256i& b) noexcept
 	{
 		const __m256i _NEG_ONE = _mm256_set1_epi8(static_cast<int8_t>(-1));
 		__m256i _mask = _mm256_setzero_si256();
@@ -1128,7 +1148,7 @@ namespace tpa::simd {
 	/// <param name="a"></param>
 	/// <param name="b"></param>
 	/// <returns>__m256i</returns>
-	[[nodiscard]] inline __m256i _mm256_cmpneq_epi16(const __m256i& a, const __m256i& b) noexcept
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_cmpneq_epi16(const __m256i& a, const __m256i& b) noexcept
 	{
 		const __m256i _NEG_ONE = _mm256_set1_epi16(static_cast<int16_t>(-1));
 		__m256i _mask = _mm256_setzero_si256();
@@ -1148,7 +1168,7 @@ namespace tpa::simd {
 	/// <param name="a"></param>
 	/// <param name="b"></param>
 	/// <returns>__m256i</returns>
-	[[nodiscard]] inline __m256i _mm256_cmpneq_epi32(const __m256i& a, const __m256i& b) noexcept
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_cmpneq_epi32(const __m256i& a, const __m256i& b) noexcept
 	{
 		const __m256i _NEG_ONE = _mm256_set1_epi32(-1);
 		__m256i _mask = _mm256_setzero_si256();
@@ -1163,12 +1183,12 @@ namespace tpa::simd {
 	///<para> Compares 64-bit integers in an __m256i for not equality.</para>
 	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
 	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
-	/// <para>Warning: This function is unsafe if called on a platform without SSE4.1.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX2.</para>
 	///</summary>
 	/// <param name="a"></param>
 	/// <param name="b"></param>
 	/// <returns>__m256i</returns>
-	[[nodiscard]] inline __m256i _mm256_cmpneq_epi64(const __m256i& a, const __m256i& b) noexcept
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_cmpneq_epi64(const __m256i& a, const __m256i& b) noexcept
 	{
 		const __m256i _NEG_ONE = _mm256_set1_epi64x(static_cast<int64_t>(-1));
 		__m256i _mask = _mm256_setzero_si256();
@@ -1188,7 +1208,7 @@ namespace tpa::simd {
 	/// <param name="a"></param>
 	/// <param name="count"></param>
 	/// <returns>__m256i</returns>
-	[[nodiscard]] inline __m256i _mm256_sllv_epi8(const __m256i& a, const __m256i& count) 
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_sllv_epi8(const __m256i& a, const __m256i& count) 
 	{
 		const __m256i mask_hi = _mm256_set1_epi32(0xFF00FF00);
 		const __m256i multiplier_lut = _mm256_set_epi8(0, 0, 0, 0, 0, 0, 0, 0, 128, 64, 32, 16, 8, 4, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 128, 64, 32, 16, 8, 4, 2, 1);
@@ -1214,7 +1234,7 @@ namespace tpa::simd {
 	/// <param name="a"></param>
 	/// <param name="count"></param>
 	/// <returns>__m256i</returns>
-	[[nodiscard]] inline __m256i _mm256_srlv_epi8(const __m256i& a, const __m256i& count) 
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_srlv_epi8(const __m256i& a, const __m256i& count) 
 	{
 		const __m256i mask_hi = _mm256_set1_epi32(0xFF00FF00);
 		const __m256i multiplier_lut = _mm256_set_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 4, 8, 16, 32, 64, 128, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 4, 8, 16, 32, 64, 128);
@@ -1243,7 +1263,7 @@ namespace tpa::simd {
 	/// <param name="a"></param>
 	/// <param name="count"></param>
 	/// <returns>__m128i</returns>
-	[[nodiscard]] inline __m128i _mm_sllv_epi16(const __m128i& a, const __m128i& count)
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m128i _mm_sllv_epi16(const __m128i& a, const __m128i& count)
 	{
 		const __m128i mask = _mm_set1_epi32(0xffff0000);
 
@@ -1262,7 +1282,7 @@ namespace tpa::simd {
 	/// <param name="a"></param>
 	/// <param name="count"></param>
 	/// <returns>__m256i</returns>
-	[[nodiscard]] inline __m256i _mm256_sllv_epi16(const __m256i& a, const __m256i& count) 
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_sllv_epi16(const __m256i& a, const __m256i& count) 
 	{
 		const __m256i mask = _mm256_set1_epi32(0xffff0000);
 
@@ -1281,7 +1301,7 @@ namespace tpa::simd {
 	/// <param name="a"></param>
 	/// <param name="count"></param>
 	/// <returns>__m128i</returns>
-	[[nodiscard]] inline __m128i _mm_srlv_epi16(const __m128i& a, const __m128i& count)
+	[[nodiscard]] TPA_TARGET_SSE41 inline __m128i _mm_srlv_epi16(const __m128i& a, const __m128i& count)
 	{
 		const __m128i mask = _mm_set1_epi32(0x0000ffff);
 
@@ -1300,7 +1320,7 @@ namespace tpa::simd {
 	/// <param name="a"></param>
 	/// <param name="count"></param>
 	/// <returns>__m256i</returns>
-	[[nodiscard]] inline __m256i _mm256_srlv_epi16(const __m256i& a, const __m256i& count) 
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_srlv_epi16(const __m256i& a, const __m256i& count) 
 	{
 		const __m256i mask = _mm256_set1_epi32(0x0000ffff);
 
@@ -1345,7 +1365,7 @@ namespace tpa::simd {
 	///</summary>
 	/// <param name="x"></param>
 	/// <returns>__m256i</returns>
-	[[nodiscard]] inline __m256i _mm256_bsf_epi16(__m256i x) noexcept
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_bsf_epi16(__m256i x) noexcept
 	{
 		const __m256i x0000 = _mm256_setzero_si256();
 		const __m256i x5555 = _mm256_set1_epi16(0x5555);
@@ -1372,7 +1392,7 @@ namespace tpa::simd {
 	///</summary>
 	/// <param name="x"></param>
 	/// <returns>__m512i</returns>
-	[[nodiscard]] inline __m512i _mm512_bsf_epi16(__m512i x) noexcept
+	[[nodiscard]] TPA_TARGET(TPA_ISA_AVX512 ",avx512bitalg") inline __m512i _mm512_bsf_epi16(__m512i x) noexcept
 	{
 		const __m512i _one = _mm512_set1_epi16(static_cast<int16_t>(1));
 
@@ -1438,7 +1458,7 @@ namespace tpa::simd {
 	///</summary>
 	/// <param name="x"></param>
 	/// <returns>__m256i</returns>
-	[[nodiscard]] inline __m256i _mm256_bsf_epi32(const __m256i& x) noexcept
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_bsf_epi32(const __m256i& x) noexcept
 	{
 		const __m256i xFFFF = _mm256_set1_epi32(0xffff0000);
 		const __m256i xFF00 = _mm256_set1_epi32(0xff00ff00);
@@ -1485,11 +1505,11 @@ namespace tpa::simd {
 	///<para> Returns the indexes of the lowest set bits of 32-bit integers in an __m512i.</para>
 	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
 	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
-	/// <para>Warning: This function is unsafe if called on a platform without AVX-512, AVX-512 BW and AVX-512 Bit Algorithms (BITALG).</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX-512 and AVX-512 VPOPCNTDQ.</para>
 	///</summary>
 	/// <param name="x"></param>
 	/// <returns>__m512i</returns>
-	[[nodiscard]] inline __m512i _mm512_bsf_epi32(__m512i x) noexcept
+	[[nodiscard]] TPA_TARGET(TPA_ISA_AVX512 ",avx512vpopcntdq") inline __m512i _mm512_bsf_epi32(__m512i x) noexcept
 	{
 		const __m512i _one = _mm512_set1_epi32(1);
 
@@ -1561,7 +1581,7 @@ namespace tpa::simd {
 	///</summary>
 	/// <param name="x"></param>
 	/// <returns>__m256i</returns>
-	[[nodiscard]] inline __m256i _mm256_bsf_epi64(const __m256i& x) noexcept
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_bsf_epi64(const __m256i& x) noexcept
 	{
 		const __m256i xFFFFx = _mm256_set1_epi64x(0xffffffffll);
 		const __m256i xFFFF = _mm256_set1_epi64x(0xffff0000ll);
@@ -1614,11 +1634,11 @@ namespace tpa::simd {
 	///<para> Returns the indexes of the lowest set bits of 32-bit integers in an __m512i.</para>
 	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
 	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
-	/// <para>Warning: This function is unsafe if called on a platform without AVX-512, AVX-512 BW and AVX-512 Bit Algorithms (BITALG).</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX-512 and AVX-512 VPOPCNTDQ.</para>
 	///</summary>
 	/// <param name="x"></param>
 	/// <returns>__m512i</returns>
-	[[nodiscard]] inline __m512i _mm512_bsf_epi64(__m512i x) noexcept
+	[[nodiscard]] TPA_TARGET(TPA_ISA_AVX512 ",avx512vpopcntdq") inline __m512i _mm512_bsf_epi64(__m512i x) noexcept
 	{
 		const __m512i _one = _mm512_set1_epi64(1ll);
 
@@ -1626,49 +1646,102 @@ namespace tpa::simd {
 	}//End of _mm512_bsf_epi64
 
 	///<summary>
-	///<para> Multiply Packed 64-Bit Integers (Signed and Unsigned) in 'a' by 'b' and returns 'product' using AVX2</para>
+	///<para> Reverses the order of the bits in each 8-bit integer in an __m512i.</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX-512 and GFNI.</para>
+	///</summary>
+	/// <param name="x"></param>
+	/// <returns>__m512i</returns>
+	[[nodiscard]] TPA_TARGET(TPA_ISA_AVX512 ",gfni") inline __m512i _mm512_reverse_bits_epi8(const __m512i& x) noexcept
+	{
+		return _mm512_gf2p8affine_epi64_epi8(x, _mm512_set1_epi64(0x8040201008040201ll), 0);
+	}//End of _mm512_reverse_bits_epi8
+
+	///<summary>
+	///<para> Reverses the order of the bits in each 16-bit integer in an __m512i.</para>
+	///<para>Each byte is reversed with a single GF2P8AFFINEQB and the bytes are then swapped with VPSHUFB.</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX-512, AVX-512 BW and GFNI.</para>
+	///</summary>
+	/// <param name="x"></param>
+	/// <returns>__m512i</returns>
+	[[nodiscard]] TPA_TARGET(TPA_ISA_AVX512 ",gfni") inline __m512i _mm512_reverse_bits_epi16(const __m512i& x) noexcept
+	{
+		const __m512i _bytes = _mm512_gf2p8affine_epi64_epi8(x, _mm512_set1_epi64(0x8040201008040201ll), 0);
+
+		return _mm512_shuffle_epi8(_bytes, _mm512_broadcast_i32x4(_mm_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1)));
+	}//End of _mm512_reverse_bits_epi16
+
+	///<summary>
+	///<para> Reverses the order of the bits in each 32-bit integer in an __m512i.</para>
+	///<para>Each byte is reversed with a single GF2P8AFFINEQB and the bytes are then swapped with VPSHUFB.</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX-512, AVX-512 BW and GFNI.</para>
+	///</summary>
+	/// <param name="x"></param>
+	/// <returns>__m512i</returns>
+	[[nodiscard]] TPA_TARGET(TPA_ISA_AVX512 ",gfni") inline __m512i _mm512_reverse_bits_epi32(const __m512i& x) noexcept
+	{
+		const __m512i _bytes = _mm512_gf2p8affine_epi64_epi8(x, _mm512_set1_epi64(0x8040201008040201ll), 0);
+
+		return _mm512_shuffle_epi8(_bytes, _mm512_broadcast_i32x4(_mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3)));
+	}//End of _mm512_reverse_bits_epi32
+
+	///<summary>
+	///<para> Reverses the order of the bits in each 64-bit integer in an __m512i.</para>
+	///<para>Each byte is reversed with a single GF2P8AFFINEQB and the bytes are then swapped with VPSHUFB.</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX-512, AVX-512 BW and GFNI.</para>
+	///</summary>
+	/// <param name="x"></param>
+	/// <returns>__m512i</returns>
+	[[nodiscard]] TPA_TARGET(TPA_ISA_AVX512 ",gfni") inline __m512i _mm512_reverse_bits_epi64(const __m512i& x) noexcept
+	{
+		const __m512i _bytes = _mm512_gf2p8affine_epi64_epi8(x, _mm512_set1_epi64(0x8040201008040201ll), 0);
+
+		return _mm512_shuffle_epi8(_bytes, _mm512_broadcast_i32x4(_mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7)));
+	}//End of _mm512_reverse_bits_epi64
+
+	///<summary>
+	///<para> Multiply Packed 64-Bit Integers (Signed and Unsigned) in 'a' by 'b' and returns the low 64 bits of 'product' using AVX2</para>
+	///<para>Built from three 32 x 32 => 64-bit multiplies, avoids the slow _mm256_mullo_epi32.</para>
 	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
 	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
 	/// <para>Warning: This function is unsafe if called on a platform without AVX2.</para>
-	///<para>This function is based on Agner Fog's Vector Class Library: </para>
-	/// <see href="https://www.agner.org/optimize/#vectorclass">VCL</see>
 	///</summary>
 	/// <param name="a"></param>
 	/// <param name="b"></param>
 	/// <returns>__m256i</returns>
-	[[nodiscard]] inline __m256i _mm256_mul_epi64(const __m256i& a, const __m256i& b) noexcept
-	{
-		const __m256i bswap = _mm256_shuffle_epi32(b, 0xB1);		// swap H<->L
-		const __m256i prodlh = _mm256_mullo_epi32(a, bswap);		// 32 bit L*H products
-		const __m256i zero = _mm256_setzero_si256();				// 0
-		const __m256i prodlh2 = _mm256_hadd_epi32(prodlh, zero);    // a0Lb0H+a0Hb0L,a1Lb1H+a1Hb1L,0,0
-		const __m256i prodlh3 = _mm256_shuffle_epi32(prodlh2, 0x73);// 0, a0Lb0H+a0Hb0L, 0, a1Lb1H+a1Hb1L
-		const __m256i prodll = _mm256_mul_epu32(a, b);              // a0Lb0L,a1Lb1L, 64 bit unsigned products
-		const __m256i prod = _mm256_add_epi64(prodll, prodlh3);     // a0Lb0L+(a0Lb0H+a0Hb0L)<<32, a1Lb1L+(a1Lb1H+a1Hb1L)<<32
-		return  prod;
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_mul_epi64(const __m256i& a, const __m256i& b) noexcept
+	{
+		const __m256i prodll = _mm256_mul_epu32(a, b);											// aL*bL, 64 bit unsigned products
+		const __m256i prodlh = _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32));					// aL*bH
+		const __m256i prodhl = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b);					// aH*bL
+		const __m256i cross = _mm256_slli_epi64(_mm256_add_epi64(prodlh, prodhl), 32);			// (aL*bH + aH*bL) << 32
+		return _mm256_add_epi64(prodll, cross);
 	}//End of _mm256_mul_epi64
 
 	///<summary>
-	///<para> Multiply Packed 64-Bit Integers (Signed and Unsigned) in 'a' by 'b' and returns 'product' using SSE4.1</para>
+	///<para> Multiply Packed 64-Bit Integers (Signed and Unsigned) in 'a' by 'b' and returns the low 64 bits of 'product' using SSE2</para>
+	///<para>Built from three 32 x 32 => 64-bit multiplies, avoids the slow _mm_mullo_epi32.</para>
 	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
 	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
-	/// <para>Warning: This function is unsafe if called on a platform without SSE4.1.</para>
-	///<para>This function is based on Agner Fog's Vector Class Library: </para>
-	/// <see href="https://www.agner.org/optimize/#vectorclass">VCL</see>
+	/// <para>Warning: This function is unsafe if called on a platform without SSE2.</para>
 	///</summary>
 	/// <param name="a"></param>
 	/// <param name="b"></param>
 	/// <returns>__m128i</returns>
 	[[nodiscard]] inline __m128i _mm_mul_epi64(const __m128i& a, const __m128i& b) noexcept
 	{
-		const __m128i bswap = _mm_shuffle_epi32(b, 0xB1);       // b0H,b0L,b1H,b1L (swap H<->L)
-		const __m128i prodlh = _mm_mullo_epi32(a, bswap);       // a0Lb0H,a0Hb0L,a1Lb1H,a1Hb1L, 32 bit L*H products
-		const __m128i zero = _mm_setzero_si128();                // 0
-		const __m128i prodlh2 = _mm_hadd_epi32(prodlh, zero);    // a0Lb0H+a0Hb0L,a1Lb1H+a1Hb1L,0,0
-		const __m128i prodlh3 = _mm_shuffle_epi32(prodlh2, 0x73);// 0, a0Lb0H+a0Hb0L, 0, a1Lb1H+a1Hb1L
-		const __m128i prodll = _mm_mul_epu32(a, b);             // a0Lb0L,a1Lb1L, 64 bit unsigned products
-		const __m128i prod = _mm_add_epi64(prodll, prodlh3);    // a0Lb0L+(a0Lb0H+a0Hb0L)<<32, a1Lb1L+(a1Lb1H+a1Hb1L)<<32
-		return  prod;
+		const __m128i prodll = _mm_mul_epu32(a, b);										// aL*bL, 64 bit unsigned products
+		const __m128i prodlh = _mm_mul_epu32(a, _mm_srli_epi64(b, 32));					// aL*bH
+		const __m128i prodhl = _mm_mul_epu32(_mm_srli_epi64(a, 32), b);					// aH*bL
+		const __m128i cross = _mm_slli_epi64(_mm_add_epi64(prodlh, prodhl), 32);			// (aL*bH + aH*bL) << 32
+		return _mm_add_epi64(prodll, cross);
 	}//End of _mm_mul_epi64
 
 	///<summary>
@@ -1689,603 +1762,1901 @@ namespace tpa::simd {
 	}//End of _mm_mul_epi32
 
 	///<summary>
-	///<para> Computes the absolute value of floats stored in 'x' using SSE</para>
+	///<para> Multiply Packed 8-Bit Integers (Signed and Unsigned) in 'a' by 'b' and return the low 8 bits of each product using SSE2</para>
 	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
 	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
-	/// <para>Warning: This function is unsafe if called on a platform without SSE.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without SSE2.</para>
 	///</summary>
-	/// <param name="x"></param>
-	/// <returns>__m128</returns>
-	[[nodiscard]] inline __m128 _mm_abs_ps(const __m128& x) noexcept
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m128i</returns>
+	[[nodiscard]] inline __m128i _mm_mullo_epi8(const __m128i& a, const __m128i& b) noexcept
 	{
-		constexpr __m128 sign_mask = { -0.0f, -0.0f, -0.0f, -0.0f };
-		return _mm_andnot_ps(sign_mask, x);
-	}//End of _mm_abs_ps
+		const __m128i lo_mask = _mm_set1_epi16(0x00FF);
+		const __m128i even = _mm_and_si128(_mm_mullo_epi16(a, b), lo_mask);
+		const __m128i odd = _mm_slli_epi16(_mm_mullo_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8)), 8);
+		return _mm_or_si128(even, odd);
+	}//End of _mm_mullo_epi8
 
 	///<summary>
-	///<para> Computes the absolute value of doubles stored in 'x' using SSE2</para>
+	///<para> Multiply Packed 8-Bit Integers (Signed and Unsigned) in 'a' by 'b' and return the low 8 bits of each product using AVX2</para>
 	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
 	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
-	/// <para>Warning: This function is unsafe if called on a platform without SSE2.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX2.</para>
 	///</summary>
-	/// <param name="x"></param>
-	/// <returns>__m128d</returns>
-	[[nodiscard]] inline __m128d _mm_abs_pd(const __m128d& x) noexcept
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m256i</returns>
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_mullo_epi8(const __m256i& a, const __m256i& b) noexcept
 	{
-		constexpr __m128d sign_mask = { -0.0, -0.0 };
-		return _mm_andnot_pd(sign_mask, x);
-	}//End of _mm_abs_pd
+		const __m256i lo_mask = _mm256_set1_epi16(0x00FF);
+		const __m256i even = _mm256_and_si256(_mm256_mullo_epi16(a, b), lo_mask);
+		const __m256i odd = _mm256_slli_epi16(_mm256_mullo_epi16(_mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8)), 8);
+		return _mm256_or_si256(even, odd);
+	}//End of _mm256_mullo_epi8
 
 	///<summary>
-	///<para> Computes the absolute value of floats stored in 'x' using AVX</para>
+	///<para> Multiply Packed 8-Bit Integers (Signed and Unsigned) in 'a' by 'b' and return the low 8 bits of each product using AVX-512BW</para>
 	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
 	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
-	/// <para>Warning: This function is unsafe if called on a platform without AVX.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX-512BW.</para>
 	///</summary>
-	/// <param name="x"></param>
-	/// <returns>__m256</returns>
-	[[nodiscard]] inline __m256 _mm256_abs_ps(const __m256& x) noexcept
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m512i</returns>
+	[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_mullo_epi8(const __m512i& a, const __m512i& b) noexcept
 	{
-		constexpr __m256 sign_mask = { -0.0f, -0.0f, -0.0f, -0.0f, -0.0f, -0.0f, -0.0f, -0.0f };
-		return _mm256_andnot_ps(sign_mask, x);
-	}//End of _mm256_abs_ps
+		const __m512i lo_mask = _mm512_set1_epi16(0x00FF);
+		const __m512i even = _mm512_and_si512(_mm512_mullo_epi16(a, b), lo_mask);
+		const __m512i odd = _mm512_slli_epi16(_mm512_mullo_epi16(_mm512_srli_epi16(a, 8), _mm512_srli_epi16(b, 8)), 8);
+		return _mm512_or_si512(even, odd);
+	}//End of _mm512_mullo_epi8
 
 	///<summary>
-	///<para> Computes the absolute value of doubles stored in 'x' using AVX</para>
+	///<para> Add Packed Signed 32-Bit Integers in 'a' and 'b' with saturation using SSE2</para>
 	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
 	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
-	/// <para>Warning: This function is unsafe if called on a platform without AVX.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without SSE2.</para>
 	///</summary>
-	/// <param name="x"></param>
-	/// <returns>__m256d</returns>
-	[[nodiscard]] inline __m256d _mm256_abs_pd(const __m256d& x) noexcept
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m128i</returns>
+	[[nodiscard]] inline __m128i _mm_adds_epi32(const __m128i& a, const __m128i& b) noexcept
 	{
-		constexpr __m256d sign_mask = { -0.0, -0.0, -0.0, -0.0 };
-		return _mm256_andnot_pd(sign_mask, x);
-	}//End of _mm256_abs_pd
+		const __m128i sum = _mm_add_epi32(a, b);
+		//Sign bit of 'overflow' is set where the result wrapped around
+		const __m128i overflow = _mm_and_si128(_mm_xor_si128(a, sum), _mm_xor_si128(b, sum));
+		const __m128i mask = _mm_srai_epi32(overflow, 31);
+		const __m128i saturated = _mm_xor_si128(_mm_srai_epi32(a, 31), _mm_set1_epi32(INT32_MAX));
+		return _mm_or_si128(_mm_andnot_si128(mask, sum), _mm_and_si128(mask, saturated));
+	}//End of _mm_adds_epi32
 
 	///<summary>
-	/// <para>Converts packed uint64_t in 'x' to packed doubles</para>
-	/// <para>Full Range Supported.</para>
-	/// <para>Requires SSE4.1 at runtime.</para>
-	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	///<para> Subtract Packed Signed 32-Bit Integers in 'a' and 'b' with saturation using SSE2</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without SSE2.</para>
 	///</summary>
-	/// <param name="x"></param>
-	/// <returns>__m128d</returns>
-	[[nodiscard]] inline __m128d _mm_cvtepu64_pd(const __m128i& x) noexcept
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m128i</returns>
+	[[nodiscard]] inline __m128i _mm_subs_epi32(const __m128i& a, const __m128i& b) noexcept
 	{
-		__m128i xH = _mm_srli_epi64(x, 32ll);
-		xH = _mm_or_si128(xH, _mm_castpd_si128(_mm_set1_pd(19342813113834066795298816.0)));          //  2^84
-		__m128i xL = _mm_blend_epi16(x, _mm_castpd_si128(_mm_set1_pd(0x0010000000000000)), 0xcc);   //  2^52
-		__m128d f = _mm_sub_pd(_mm_castsi128_pd(xH), _mm_set1_pd(19342813118337666422669312.));     //  2^84 + 2^52
-
-		return _mm_add_pd(f, _mm_castsi128_pd(xL));
-	}//End of _mm_cvtepu64_pd
+		const __m128i diff = _mm_sub_epi32(a, b);
+		//Sign bit of 'overflow' is set where the result wrapped around
+		const __m128i overflow = _mm_and_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, diff));
+		const __m128i mask = _mm_srai_epi32(overflow, 31);
+		const __m128i saturated = _mm_xor_si128(_mm_srai_epi32(a, 31), _mm_set1_epi32(INT32_MAX));
+		return _mm_or_si128(_mm_andnot_si128(mask, diff), _mm_and_si128(mask, saturated));
+	}//End of _mm_subs_epi32
 
 	///<summary>
-	/// <para>Converts packed uint64_t in 'x' to packed doubles</para>
-	/// <para>Full Range Supported.</para>
-	/// <para>Requires AVX2 at runtime.</para>
-	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	///<para> Add Packed Unsigned 32-Bit Integers in 'a' and 'b' with saturation using SSE2</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without SSE2.</para>
 	///</summary>
-	/// <param name="x"></param>
-	/// <returns>__m256d</returns>
-	[[nodiscard]] inline __m256d _mm256_cvtepu64_pd(const __m256i& x) noexcept
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m128i</returns>
+	[[nodiscard]] inline __m128i _mm_adds_epu32(const __m128i& a, const __m128i& b) noexcept
 	{
-		__m256i xH = _mm256_srli_epi64(x, 32ll);
-		xH = _mm256_or_si256(xH, _mm256_castpd_si256(_mm256_set1_pd(19342813113834066795298816.0)));          //  2^84
-		__m256i xL = _mm256_blend_epi16(x, _mm256_castpd_si256(_mm256_set1_pd(0x0010000000000000)), 0xcc);   //  2^52
-		__m256d f = _mm256_sub_pd(_mm256_castsi256_pd(xH), _mm256_set1_pd(19342813118337666422669312.));     //  2^84 + 2^52
-
-		return _mm256_add_pd(f, _mm256_castsi256_pd(xL));
-	}//End of _mm256_cvtepu64_pd
+		const __m128i sign_bit = _mm_set1_epi32(static_cast<int32_t>(0x80000000));
+		const __m128i sum = _mm_add_epi32(a, b);
+		//The sum wrapped around where it is smaller than 'a', compare as signed after flipping the sign bit
+		const __m128i mask = _mm_cmpgt_epi32(_mm_xor_si128(a, sign_bit), _mm_xor_si128(sum, sign_bit));
+		return _mm_or_si128(sum, mask);
+	}//End of _mm_adds_epu32
 
 	///<summary>
-	/// <para>Converts packed int64_t in 'x' to packed doubles</para>
-	/// <para>Full Range Supported.</para>
-	/// <para>Requires SSE4.1 at runtime.</para>
-	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	///<para> Subtract Packed Unsigned 32-Bit Integers in 'a' and 'b' with saturation using SSE2</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without SSE2.</para>
 	///</summary>
-	/// <param name="x"></param>
-	/// <returns>__m128d</returns>
-	[[nodiscard]] inline __m128d _mm_cvtepi64_pd(const __m128i& x) noexcept
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m128i</returns>
+	[[nodiscard]] inline __m128i _mm_subs_epu32(const __m128i& a, const __m128i& b) noexcept
 	{
-		__m128i xH = _mm_srai_epi32(x, 16);
-		xH = _mm_blend_epi16(xH, _mm_setzero_si128(), 0x33);
-		xH = _mm_add_epi64(xH, _mm_castpd_si128(_mm_set1_pd(442721857769029238784.)));              //  3*2^67
-		__m128i xL = _mm_blend_epi16(x, _mm_castpd_si128(_mm_set1_pd(0x0010000000000000)), 0x88);   //  2^52
-		__m128d f = _mm_sub_pd(_mm_castsi128_pd(xH), _mm_set1_pd(442726361368656609280.));          //  3*2^67 + 2^52
-
-		return _mm_add_pd(f, _mm_castsi128_pd(xL));
-	}//End of _mm_cvtepi64_pd
+		const __m128i sign_bit = _mm_set1_epi32(static_cast<int32_t>(0x80000000));
+		const __m128i diff = _mm_sub_epi32(a, b);
+		//Clamp to 0 where 'b' > 'a', compare as signed after flipping the sign bit
+		const __m128i mask = _mm_cmpgt_epi32(_mm_xor_si128(b, sign_bit), _mm_xor_si128(a, sign_bit));
+		return _mm_andnot_si128(mask, diff);
+	}//End of _mm_subs_epu32
 
 	///<summary>
-	/// <para>Converts packed int64_t in 'x' to packed doubles</para>
-	/// <para>Full Range Supported.</para>
-	/// <para>Requires AVX2 at runtime.</para>
-	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	///<para> Add Packed Signed 32-Bit Integers in 'a' and 'b' with saturation using AVX2</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX2.</para>
 	///</summary>
-	/// <param name="x"></param>
-	/// <returns>__m256d</returns>
-	[[nodiscard]] inline __m256d _mm256_cvtepi64_pd(const __m256i& x) noexcept
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m256i</returns>
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_adds_epi32(const __m256i& a, const __m256i& b) noexcept
 	{
-		__m256i xH = _mm256_srai_epi32(x, 16);
-		xH = _mm256_blend_epi16(xH, _mm256_setzero_si256(), 0x33);
-		xH = _mm256_add_epi64(xH, _mm256_castpd_si256(_mm256_set1_pd(442721857769029238784.0)));              //  3*2^67
-		__m256i xL = _mm256_blend_epi16(x, _mm256_castpd_si256(_mm256_set1_pd(0x0010000000000000)), 0x88);   //  2^52
-		__m256d f = _mm256_sub_pd(_mm256_castsi256_pd(xH), _mm256_set1_pd(442726361368656609280.0));          //  3*2^67 + 2^52
-
-		return _mm256_add_pd(f, _mm256_castsi256_pd(xL));
-	}//End of _mm256_cvtepi64_pd
+		const __m256i sum = _mm256_add_epi32(a, b);
+		//Sign bit of 'overflow' is set where the result wrapped around
+		const __m256i overflow = _mm256_and_si256(_mm256_xor_si256(a, sum), _mm256_xor_si256(b, sum));
+		const __m256i mask = _mm256_srai_epi32(overflow, 31);
+		const __m256i saturated = _mm256_xor_si256(_mm256_srai_epi32(a, 31), _mm256_set1_epi32(INT32_MAX));
+		return _mm256_or_si256(_mm256_andnot_si256(mask, sum), _mm256_and_si256(mask, saturated));
+	}//End of _mm256_adds_epi32
 
 	///<summary>
-	/// <para>Converts packed doubles in 'x' to packed int64_t</para>
-	/// <para>Range: [0, 2^51]</para>
-	/// <para>Requires SSE2 at runtime.</para>
-	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	///<para> Subtract Packed Signed 32-Bit Integers in 'a' and 'b' with saturation using AVX2</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX2.</para>
 	///</summary>
-	/// <param name="x"></param>
-	/// <returns>__m128i</returns>
-	[[nodiscard]] inline __m128i _mm_cvtpd_epu64(__m128d& x) noexcept
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m256i</returns>
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_subs_epi32(const __m256i& a, const __m256i& b) noexcept
 	{
-		x = _mm_add_pd(x, _mm_set1_pd(0x0010000000000000));
-		return _mm_xor_si128(
-			_mm_castpd_si128(x),
-			_mm_castpd_si128(_mm_set1_pd(0x0010000000000000))
-		);
-	}//End of _mm_cvtpd_epu64
+		const __m256i diff = _mm256_sub_epi32(a, b);
+		//Sign bit of 'overflow' is set where the result wrapped around
+		const __m256i overflow = _mm256_and_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, diff));
+		const __m256i mask = _mm256_srai_epi32(overflow, 31);
+		const __m256i saturated = _mm256_xor_si256(_mm256_srai_epi32(a, 31), _mm256_set1_epi32(INT32_MAX));
+		return _mm256_or_si256(_mm256_andnot_si256(mask, diff), _mm256_and_si256(mask, saturated));
+	}//End of _mm256_subs_epi32
 
 	///<summary>
-	/// <para>Converts packed doubles in 'x' to packed uint64_t</para>
-	/// <para>Range: [0, 2^51]</para>
-	/// <para>Requires AVX2 at runtime.</para>
-	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	///<para> Add Packed Unsigned 32-Bit Integers in 'a' and 'b' with saturation using AVX2</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX2.</para>
 	///</summary>
-	/// <param name="x"></param>
-	/// <returns>__m256d</returns>
-	[[nodiscard]] inline __m256i _mm256_cvtpd_epu64(__m256d& x) noexcept
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m256i</returns>
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_adds_epu32(const __m256i& a, const __m256i& b) noexcept
 	{
-		x = _mm256_add_pd(x, _mm256_set1_pd(0x0010000000000000));
-		return _mm256_xor_si256(
-			_mm256_castpd_si256(x),
-			_mm256_castpd_si256(_mm256_set1_pd(0x0010000000000000))
-		);
-	}//End of _mm256_cvtpd_epu64
+		const __m256i sign_bit = _mm256_set1_epi32(static_cast<int32_t>(0x80000000));
+		const __m256i sum = _mm256_add_epi32(a, b);
+		//The sum wrapped around where it is smaller than 'a', compare as signed after flipping the sign bit
+		const __m256i mask = _mm256_cmpgt_epi32(_mm256_xor_si256(a, sign_bit), _mm256_xor_si256(sum, sign_bit));
+		return _mm256_or_si256(sum, mask);
+	}//End of _mm256_adds_epu32
 
 	///<summary>
-	/// <para>Converts packed doubles in 'x' to packed uint64_t</para>
-	/// <para>Range: [-2^51, 2^51]</para>
-	/// <para>Requires SSE2 at runtime.</para>
-	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	///<para> Subtract Packed Unsigned 32-Bit Integers in 'a' and 'b' with saturation using AVX2</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX2.</para>
 	///</summary>
-	/// <param name="x"></param>
-	/// <returns>__m256d</returns>
-	[[nodiscard]] inline __m128i _mm_cvtpd_epi64(__m128d& x) noexcept
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m256i</returns>
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_subs_epu32(const __m256i& a, const __m256i& b) noexcept
 	{
-		x = _mm_add_pd(x, _mm_set1_pd(0x0018000000000000));
-		return _mm_sub_epi64(
-			_mm_castpd_si128(x),
-			_mm_castpd_si128(_mm_set1_pd(0x0018000000000000))
-		);
-	}//End of _mm_cvtpd_epi64
+		const __m256i sign_bit = _mm256_set1_epi32(static_cast<int32_t>(0x80000000));
+		const __m256i diff = _mm256_sub_epi32(a, b);
+		//Clamp to 0 where 'b' > 'a', compare as signed after flipping the sign bit
+		const __m256i mask = _mm256_cmpgt_epi32(_mm256_xor_si256(b, sign_bit), _mm256_xor_si256(a, sign_bit));
+		return _mm256_andnot_si256(mask, diff);
+	}//End of _mm256_subs_epu32
 
 	///<summary>
-	/// <para>Converts packed doubles in 'x' to packed uint64_t</para>
-	/// <para>Range: [-2^51, 2^51]</para>
-	/// <para>Requires AVX2 at runtime.</para>
-	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	///<para> Add Packed Signed 32-Bit Integers in 'a' and 'b' with saturation using AVX-512</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX-512.</para>
 	///</summary>
-	/// <param name="x"></param>
-	/// <returns>__m256d</returns>
-	[[nodiscard]] inline __m256i _mm256_cvtpd_epi64(__m256d& x) noexcept
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m512i</returns>
+	[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_adds_epi32(const __m512i& a, const __m512i& b) noexcept
 	{
-		x = _mm256_add_pd(x, _mm256_set1_pd(0x0018000000000000));
-		return _mm256_sub_epi64(
-			_mm256_castpd_si256(x),
-			_mm256_castpd_si256(_mm256_set1_pd(0x0018000000000000))
-		);
-	}//End of _mm256_cvtpd_epi64
+		const __m512i sum = _mm512_add_epi32(a, b);
+		//Sign bit of 'overflow' is set where the result wrapped around
+		const __m512i overflow = _mm512_and_si512(_mm512_xor_si512(a, sum), _mm512_xor_si512(b, sum));
+		const __mmask16 mask = _mm512_cmplt_epi32_mask(overflow, _mm512_setzero_si512());
+		const __m512i saturated = _mm512_xor_si512(_mm512_srai_epi32(a, 31), _mm512_set1_epi32(INT32_MAX));
+		return _mm512_mask_mov_epi32(sum, mask, saturated);
+	}//End of _mm512_adds_epi32
 
 	///<summary>
-	/// <para>Narrow numbers in 'bits' to a certain range.</para>
-	/// <para>Much faster replacement for _mm_rem_epi32 / _mm_rem_epu32 for random number range generation</para>
-	/// <para>Requires SSE2 instruction set at runtime.</para>
-	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
-	///</summary>
-	/// <param name="bits"></param>
-	/// <param name="range"></param>
-	/// <returns>__m128i</returns>
-	[[nodiscard]] inline __m128i _mm_narrow_epi32(const __m128i& bits, const uint32_t range) noexcept
+	///<para> Subtract Packed Signed 32-Bit Integers in 'a' and 'b' with saturation using AVX-512</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX-512.</para>
+	///</summary>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m512i</returns>
+	[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_subs_epi32(const __m512i& a, const __m512i& b) noexcept
 	{
-		const __m128i mantissaMask = _mm_set1_epi32(0x7FFFFF);
-		const __m128i mantissa = _mm_and_si128(bits, mantissaMask);
-		const __m128 one = _mm_set1_ps(1.0f);
-		__m128 val = _mm_or_ps(_mm_castsi128_ps(mantissa), one);
+		const __m512i diff = _mm512_sub_epi32(a, b);
+		//Sign bit of 'overflow' is set where the result wrapped around
+		const __m512i overflow = _mm512_and_si512(_mm512_xor_si512(a, b), _mm512_xor_si512(a, diff));
+		const __mmask16 mask = _mm512_cmplt_epi32_mask(overflow, _mm512_setzero_si512());
+		const __m512i saturated = _mm512_xor_si512(_mm512_srai_epi32(a, 31), _mm512_set1_epi32(INT32_MAX));
+		return _mm512_mask_mov_epi32(diff, mask, saturated);
+	}//End of _mm512_subs_epi32
 
-		const __m128 rf = _mm_set1_ps((float)range);
-		val = _mm_mul_ps(val, rf);
-		val = _mm_sub_ps(val, rf);
+	///<summary>
+	///<para> Add Packed Unsigned 32-Bit Integers in 'a' and 'b' with saturation using AVX-512</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX-512.</para>
+	///</summary>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m512i</returns>
+	[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_adds_epu32(const __m512i& a, const __m512i& b) noexcept
+	{
+		const __m512i sum = _mm512_add_epi32(a, b);
+		//The sum wrapped around where it is smaller than 'a'
+		const __mmask16 mask = _mm512_cmplt_epu32_mask(sum, a);
+		return _mm512_mask_mov_epi32(sum, mask, _mm512_set1_epi32(-1));
+	}//End of _mm512_adds_epu32
 
-		return _mm_cvttps_epi32(val);
-	}//End of _mm_narrow_epi32
+	///<summary>
+	///<para> Subtract Packed Unsigned 32-Bit Integers in 'a' and 'b' with saturation using AVX-512</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX-512.</para>
+	///</summary>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m512i</returns>
+	[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_subs_epu32(const __m512i& a, const __m512i& b) noexcept
+	{
+		//Keep the difference only where 'a' >= 'b', otherwise 0
+		const __mmask16 mask = _mm512_cmpge_epu32_mask(a, b);
+		return _mm512_maskz_mov_epi32(mask, _mm512_sub_epi32(a, b));
+	}//End of _mm512_subs_epu32
 
 	///<summary>
-	/// <para>Narrow numbers in 'bits' to a certain range.</para>
-	/// <para>Much faster replacement for _mm_rem_epi64 / _mm_rem_epu64 for random number range generation</para>
-	/// <para>Requires SSE2 instruction set at runtime.</para>
-	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	///<para> Add Packed Signed 64-Bit Integers in 'a' and 'b' with saturation using SSE2</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without SSE2.</para>
 	///</summary>
-	/// <param name="bits"></param>
-	/// <param name="range"></param>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
 	/// <returns>__m128i</returns>
-	[[nodiscard]] inline __m128i _mm_narrow_epi64(const __m128i& bits, const uint64_t range) noexcept
+	[[nodiscard]] inline __m128i _mm_adds_epi64(const __m128i& a, const __m128i& b) noexcept
 	{
-		const __m128i mantissaMask = _mm_set1_epi64x(0x7FFFFFFFFFFFFFFF);
-		const __m128i mantissa = _mm_and_si128(bits, mantissaMask);
-		const __m128d one = _mm_set1_pd(1.0);
-		__m128d val = _mm_or_pd(_mm_castsi128_pd(mantissa), one);
-
-		const __m128d rf = _mm_set1_pd((double)range);
-		val = _mm_mul_pd(val, rf);
-		val = _mm_sub_pd(val, rf);
+		const __m128i sum = _mm_add_epi64(a, b);
+		//Sign bit of 'overflow' is set where the result wrapped around
+		const __m128i overflow = _mm_and_si128(_mm_xor_si128(a, sum), _mm_xor_si128(b, sum));
+		const __m128i mask = _mm_shuffle_epi32(_mm_srai_epi32(overflow, 31), _MM_SHUFFLE(3, 3, 1, 1));
+		const __m128i saturated = _mm_xor_si128(_mm_shuffle_epi32(_mm_srai_epi32(a, 31), _MM_SHUFFLE(3, 3, 1, 1)), _mm_set1_epi64x(INT64_MAX));
+		return _mm_or_si128(_mm_andnot_si128(mask, sum), _mm_and_si128(mask, saturated));
+	}//End of _mm_adds_epi64
 
-		return tpa::simd::_mm_cvtpd_epi64(val);
-	}//End of _mm_narrow_epi64
+	///<summary>
+	///<para> Subtract Packed Signed 64-Bit Integers in 'a' and 'b' with saturation using SSE2</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without SSE2.</para>
+	///</summary>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m128i</returns>
+	[[nodiscard]] inline __m128i _mm_subs_epi64(const __m128i& a, const __m128i& b) noexcept
+	{
+		const __m128i diff = _mm_sub_epi64(a, b);
+		//Sign bit of 'overflow' is set where the result wrapped around
+		const __m128i overflow = _mm_and_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, diff));
+		const __m128i mask = _mm_shuffle_epi32(_mm_srai_epi32(overflow, 31), _MM_SHUFFLE(3, 3, 1, 1));
+		const __m128i saturated = _mm_xor_si128(_mm_shuffle_epi32(_mm_srai_epi32(a, 31), _MM_SHUFFLE(3, 3, 1, 1)), _mm_set1_epi64x(INT64_MAX));
+		return _mm_or_si128(_mm_andnot_si128(mask, diff), _mm_and_si128(mask, saturated));
+	}//End of _mm_subs_epi64
 
 	///<summary>
-	/// <para>Narrow numbers in 'bits' to a certain range.</para>
-	/// <para>Much faster replacement for _mm256_rem_epi32 / _mm256_rem_epu32 for random number range generation</para>
-	/// <para>Requires AVX2 and FMA instruction sets at runtime.</para>
-	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	///<para> Add Packed Unsigned 64-Bit Integers in 'a' and 'b' with saturation using SSE4.2</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without SSE4.2.</para>
 	///</summary>
-	/// <param name="bits"></param>
-	/// <param name="range"></param>
-	/// <returns>__m256i</returns>
-	[[nodiscard]] inline __m256i _mm256_narrow_epi32(const __m256i& bits, const uint32_t range) noexcept
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m128i</returns>
+	[[nodiscard]] TPA_TARGET_SSE41 inline __m128i _mm_adds_epu64(const __m128i& a, const __m128i& b) noexcept
 	{
-		const __m256i mantissaMask = _mm256_set1_epi32(0x7FFFFF);
-		const __m256i mantissa = _mm256_and_si256(bits, mantissaMask);
-		const __m256 one = _mm256_set1_ps(1.0f);
-		__m256 val = _mm256_or_ps(_mm256_castsi256_ps(mantissa), one);
+		const __m128i sign_bit = _mm_set1_epi64x(static_cast<int64_t>(0x8000000000000000ull));
+		const __m128i sum = _mm_add_epi64(a, b);
+		//The sum wrapped around where it is smaller than 'a', compare as signed after flipping the sign bit
+		const __m128i mask = _mm_cmpgt_epi64(_mm_xor_si128(a, sign_bit), _mm_xor_si128(sum, sign_bit));
+		return _mm_or_si128(sum, mask);
+	}//End of _mm_adds_epu64
 
-		const __m256 rf = _mm256_set1_ps((float)range);
-		val = _mm256_fmsub_ps(val, rf, rf);
+	///<summary>
+	///<para> Subtract Packed Unsigned 64-Bit Integers in 'a' and 'b' with saturation using SSE4.2</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without SSE4.2.</para>
+	///</summary>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m128i</returns>
+	[[nodiscard]] TPA_TARGET_SSE41 inline __m128i _mm_subs_epu64(const __m128i& a, const __m128i& b) noexcept
+	{
+		const __m128i sign_bit = _mm_set1_epi64x(static_cast<int64_t>(0x8000000000000000ull));
+		const __m128i diff = _mm_sub_epi64(a, b);
+		//Clamp to 0 where 'b' > 'a', compare as signed after flipping the sign bit
+		const __m128i mask = _mm_cmpgt_epi64(_mm_xor_si128(b, sign_bit), _mm_xor_si128(a, sign_bit));
+		return _mm_andnot_si128(mask, diff);
+	}//End of _mm_subs_epu64
 
-		return _mm256_cvttps_epi32(val);
-	}//End of _mm256_narrow_epi32
+	///<summary>
+	///<para> Add Packed Signed 64-Bit Integers in 'a' and 'b' with saturation using AVX2</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX2.</para>
+	///</summary>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m256i</returns>
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_adds_epi64(const __m256i& a, const __m256i& b) noexcept
+	{
+		const __m256i sum = _mm256_add_epi64(a, b);
+		//Sign bit of 'overflow' is set where the result wrapped around
+		const __m256i overflow = _mm256_and_si256(_mm256_xor_si256(a, sum), _mm256_xor_si256(b, sum));
+		const __m256i mask = _mm256_shuffle_epi32(_mm256_srai_epi32(overflow, 31), _MM_SHUFFLE(3, 3, 1, 1));
+		const __m256i saturated = _mm256_xor_si256(_mm256_shuffle_epi32(_mm256_srai_epi32(a, 31), _MM_SHUFFLE(3, 3, 1, 1)), _mm256_set1_epi64x(INT64_MAX));
+		return _mm256_or_si256(_mm256_andnot_si256(mask, sum), _mm256_and_si256(mask, saturated));
+	}//End of _mm256_adds_epi64
 
 	///<summary>
-	/// <para>Narrow numbers in 'bits' to a certain range.</para>
-	/// <para>Much faster replacement for _mm256_rem_epi64 / _mm256_rem_epu64 for random number range generation</para>
-	/// <para>Requires AVX2 and FMA instruction sets at runtime.</para>
-	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	///<para> Subtract Packed Signed 64-Bit Integers in 'a' and 'b' with saturation using AVX2</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX2.</para>
 	///</summary>
-	/// <param name="bits"></param>
-	/// <param name="range"></param>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
 	/// <returns>__m256i</returns>
-	[[nodiscard]] inline __m256i _mm256_narrow_epi64(const __m256i& bits, const uint64_t range) noexcept
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_subs_epi64(const __m256i& a, const __m256i& b) noexcept
 	{
-		const __m256i mantissaMask = _mm256_set1_epi64x(0x7FFFFFFFFFFFFFFF);
-		const __m256i mantissa = _mm256_and_si256(bits, mantissaMask);
-		const __m256d one = _mm256_set1_pd(1.0);
-		__m256d val = _mm256_or_pd(_mm256_castsi256_pd(mantissa), one);
+		const __m256i diff = _mm256_sub_epi64(a, b);
+		//Sign bit of 'overflow' is set where the result wrapped around
+		const __m256i overflow = _mm256_and_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, diff));
+		const __m256i mask = _mm256_shuffle_epi32(_mm256_srai_epi32(overflow, 31), _MM_SHUFFLE(3, 3, 1, 1));
+		const __m256i saturated = _mm256_xor_si256(_mm256_shuffle_epi32(_mm256_srai_epi32(a, 31), _MM_SHUFFLE(3, 3, 1, 1)), _mm256_set1_epi64x(INT64_MAX));
+		return _mm256_or_si256(_mm256_andnot_si256(mask, diff), _mm256_and_si256(mask, saturated));
+	}//End of _mm256_subs_epi64
 
-		const __m256d rf = _mm256_set1_pd((double)range);
-		val = _mm256_fmsub_pd(val, rf, rf);
+	///<summary>
+	///<para> Add Packed Unsigned 64-Bit Integers in 'a' and 'b' with saturation using AVX2</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX2.</para>
+	///</summary>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m256i</returns>
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_adds_epu64(const __m256i& a, const __m256i& b) noexcept
+	{
+		const __m256i sign_bit = _mm256_set1_epi64x(static_cast<int64_t>(0x8000000000000000ull));
+		const __m256i sum = _mm256_add_epi64(a, b);
+		//The sum wrapped around where it is smaller than 'a', compare as signed after flipping the sign bit
+		const __m256i mask = _mm256_cmpgt_epi64(_mm256_xor_si256(a, sign_bit), _mm256_xor_si256(sum, sign_bit));
+		return _mm256_or_si256(sum, mask);
+	}//End of _mm256_adds_epu64
 
-		return tpa::simd::_mm256_cvtpd_epi64(val);
-	}//End of _mm256_narrow_epi64
+	///<summary>
+	///<para> Subtract Packed Unsigned 64-Bit Integers in 'a' and 'b' with saturation using AVX2</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX2.</para>
+	///</summary>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m256i</returns>
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_subs_epu64(const __m256i& a, const __m256i& b) noexcept
+	{
+		const __m256i sign_bit = _mm256_set1_epi64x(static_cast<int64_t>(0x8000000000000000ull));
+		const __m256i diff = _mm256_sub_epi64(a, b);
+		//Clamp to 0 where 'b' > 'a', compare as signed after flipping the sign bit
+		const __m256i mask = _mm256_cmpgt_epi64(_mm256_xor_si256(b, sign_bit), _mm256_xor_si256(a, sign_bit));
+		return _mm256_andnot_si256(mask, diff);
+	}//End of _mm256_subs_epu64
 
 	///<summary>
-	/// <para>Narrow numbers in 'bits' to a certain range.</para>
-	/// <para>Much faster replacement for _mm512_rem_epi32 / _mm512_rem_epu32 for random number range generation</para>
-	/// <para>Requires AVX-512 (foundation) instruction set at runtime.</para>
-	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	///<para> Add Packed Signed 64-Bit Integers in 'a' and 'b' with saturation using AVX-512</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX-512.</para>
 	///</summary>
-	/// <param name="bits"></param>
-	/// <param name="range"></param>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
 	/// <returns>__m512i</returns>
-	[[nodiscard]] inline __m512i _mm512_narrow_epi32(const __m512i& bits, const uint32_t range) noexcept
+	[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_adds_epi64(const __m512i& a, const __m512i& b) noexcept
 	{
-		const __m512i mantissaMask = _mm512_set1_epi64(0x7FFFFF);
-		const __m512i mantissa = _mm512_and_si512(bits, mantissaMask);
-		const __m512 one = _mm512_set1_ps(1.0f);
-		__m512 val = _mm512_or_ps(_mm512_castsi512_ps(mantissa), one);
-
-		const __m512 rf = _mm512_set1_ps((float)range);
-		val = _mm512_fmsub_ps(val, rf, rf);
-
-		return _mm512_cvttps_epi32(val);
-	}//End of _mm512_narrow_epi32
+		const __m512i sum = _mm512_add_epi64(a, b);
+		//Sign bit of 'overflow' is set where the result wrapped around
+		const __m512i overflow = _mm512_and_si512(_mm512_xor_si512(a, sum), _mm512_xor_si512(b, sum));
+		const __mmask8 mask = _mm512_cmplt_epi64_mask(overflow, _mm512_setzero_si512());
+		const __m512i saturated = _mm512_xor_si512(_mm512_srai_epi64(a, 63), _mm512_set1_epi64(INT64_MAX));
+		return _mm512_mask_mov_epi64(sum, mask, saturated);
+	}//End of _mm512_adds_epi64
 
 	///<summary>
-	/// <para>Narrow numbers in 'bits' to a certain range.</para>
-	/// <para>Much faster replacement for _mm512_rem_epi64 / _mm512_rem_epu64 for random number range generation</para>
-	/// <para>Requires AVX-512 (foundation) and AVX-512 (Double Word Quad Word) instruction set at runtime.</para>
-	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	///<para> Subtract Packed Signed 64-Bit Integers in 'a' and 'b' with saturation using AVX-512</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX-512.</para>
 	///</summary>
-	/// <param name="bits"></param>
-	/// <param name="range"></param>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
 	/// <returns>__m512i</returns>
-	[[nodiscard]] inline __m512i _mm512_narrow_epi64(const __m512i& bits, const uint64_t range) noexcept
+	[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_subs_epi64(const __m512i& a, const __m512i& b) noexcept
 	{
-		const __m512i mantissaMask = _mm512_set1_epi64(0x7FFFFFFFFFFFFFFF);
-		const __m512i mantissa = _mm512_and_si512(bits, mantissaMask);
-		const __m512d one = _mm512_set1_pd(1.0);
-		__m512d val = _mm512_or_pd(_mm512_castsi512_pd(mantissa), one);
+		const __m512i diff = _mm512_sub_epi64(a, b);
+		//Sign bit of 'overflow' is set where the result wrapped around
+		const __m512i overflow = _mm512_and_si512(_mm512_xor_si512(a, b), _mm512_xor_si512(a, diff));
+		const __mmask8 mask = _mm512_cmplt_epi64_mask(overflow, _mm512_setzero_si512());
+		const __m512i saturated = _mm512_xor_si512(_mm512_srai_epi64(a, 63), _mm512_set1_epi64(INT64_MAX));
+		return _mm512_mask_mov_epi64(diff, mask, saturated);
+	}//End of _mm512_subs_epi64
 
-		const __m512d rf = _mm512_set1_pd((double)range);
-		val = _mm512_fmsub_pd(val, rf, rf);
+	///<summary>
+	///<para> Add Packed Unsigned 64-Bit Integers in 'a' and 'b' with saturation using AVX-512</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX-512.</para>
+	///</summary>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m512i</returns>
+	[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_adds_epu64(const __m512i& a, const __m512i& b) noexcept
+	{
+		const __m512i sum = _mm512_add_epi64(a, b);
+		//The sum wrapped around where it is smaller than 'a'
+		const __mmask8 mask = _mm512_cmplt_epu64_mask(sum, a);
+		return _mm512_mask_mov_epi64(sum, mask, _mm512_set1_epi32(-1));
+	}//End of _mm512_adds_epu64
 
-		return _mm512_cvttpd_epi64(val);
-	}//End of _mm512_narrow_epi64
+	///<summary>
+	///<para> Subtract Packed Unsigned 64-Bit Integers in 'a' and 'b' with saturation using AVX-512</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX-512.</para>
+	///</summary>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m512i</returns>
+	[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_subs_epu64(const __m512i& a, const __m512i& b) noexcept
+	{
+		//Keep the difference only where 'a' >= 'b', otherwise 0
+		const __mmask8 mask = _mm512_cmpge_epu64_mask(a, b);
+		return _mm512_maskz_mov_epi64(mask, _mm512_sub_epi64(a, b));
+	}//End of _mm512_subs_epu64
 
-	/// <summary>
-	/// <para>Sums the values stored in an __m128i vector of int32_t</para>
-	/// <para>Requires SSE2 at runtime</para>
-	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
-	/// </summary>
+	///<summary>
+	///<para> Computes the absolute value of floats stored in 'x' using SSE</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without SSE.</para>
+	///</summary>
 	/// <param name="x"></param>
-	/// <returns></returns>
-	inline uint32_t _mm_sum_epi32(__m128i& x)
+	/// <returns>__m128</returns>
+	[[nodiscard]] inline __m128 _mm_abs_ps(const __m128& x) noexcept
 	{
-		__m128i hi64 = _mm_unpackhi_epi64(x, x);
-		__m128i sum64 = _mm_add_epi32(hi64, x);
-		__m128i hi32 = _mm_shuffle_epi32(sum64, _MM_SHUFFLE(2, 3, 0, 1));
-		__m128i sum32 = _mm_add_epi32(sum64, hi32);
-		return _mm_cvtsi128_si32(sum32);
-	}//End of _mm_sum_epi32
+		constexpr __m128 sign_mask = { -0.0f, -0.0f, -0.0f, -0.0f };
+		return _mm_andnot_ps(sign_mask, x);
+	}//End of _mm_abs_ps
 
-	/// <summary>
-	/// <para>Sums the values stored in an __m256i vector of int32_t</para>
-	/// <para>Requires AVX2 at runtime</para>
-	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
-	/// </summary>
-	/// <param name="v"></param>
-	/// <returns></returns>
-	inline uint32_t _mm256_sum_epi32(__m256i& v)
+	///<summary>
+	///<para> Computes the absolute value of doubles stored in 'x' using SSE2</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without SSE2.</para>
+	///</summary>
+	/// <param name="x"></param>
+	/// <returns>__m128d</returns>
+	[[nodiscard]] inline __m128d _mm_abs_pd(const __m128d& x) noexcept
 	{
-		__m128i sum128 = _mm_add_epi32(
-			_mm256_castsi256_si128(v),
-			_mm256_extracti128_si256(v, 1));
-		return _mm_sum_epi32(sum128);
-	}//End of _mm256_sum_epi32
+		constexpr __m128d sign_mask = { -0.0, -0.0 };
+		return _mm_andnot_pd(sign_mask, x);
+	}//End of _mm_abs_pd
 
-	/// <summary>
-	/// <para>Sums the values stored in an __m512i vector of int32_t</para>
-	/// <para>Requires AVX512 at runtime </para>
-	/// <para>AVX512's _mm512_reduce_add_epi32 may be faster in some cases.</para>
-	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
-	/// </summary>
-	/// <param name="v"></param>
-	/// <returns></returns>
-	inline uint32_t _mm512_sum_epi32(__m512i& v)
+	///<summary>
+	///<para> Computes the absolute value of floats stored in 'x' using AVX</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX.</para>
+	///</summary>
+	/// <param name="x"></param>
+	/// <returns>__m256</returns>
+	[[nodiscard]] TPA_TARGET_AVX inline __m256 _mm256_abs_ps(const __m256& x) noexcept
 	{
-		__m256i sum256 = _mm256_add_epi32(
-			_mm512_castsi512_si256(v),
-			_mm512_extracti64x4_epi64(v, 1));
-		return _mm256_sum_epi32(sum256);
-	}//End of _mm512_sum_epi32
+		constexpr __m256 sign_mask = { -0.0f, -0.0f, -0.0f, -0.0f, -0.0f, -0.0f, -0.0f, -0.0f };
+		return _mm256_andnot_ps(sign_mask, x);
+	}//End of _mm256_abs_ps
 
-	/// <summary>
-	/// <para>Sums the values stored in an __m128i vector of int64_t</para>
-	/// <para>Requires SSE2 at runtime</para>
-	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
-	/// </summary>
+	///<summary>
+	///<para> Computes the absolute value of doubles stored in 'x' using AVX</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX.</para>
+	///</summary>
 	/// <param name="x"></param>
-	/// <returns></returns>
-	inline uint64_t _mm_sum_epi64(__m128i& x)
+	/// <returns>__m256d</returns>
+	[[nodiscard]] TPA_TARGET_AVX inline __m256d _mm256_abs_pd(const __m256d& x) noexcept
 	{
-		__m128i hi64 = _mm_unpackhi_epi64(x, x);
-		__m128i sum64 = _mm_add_epi64(hi64, x);
-		return _mm_cvtsi128_si64(sum64);
-	}//End of _mm_sum_epi64
+		constexpr __m256d sign_mask = { -0.0, -0.0, -0.0, -0.0 };
+		return _mm256_andnot_pd(sign_mask, x);
+	}//End of _mm256_abs_pd
 
-	/// <summary>
-	/// <para>Sums the values stored in an __m256i vector of int64_t</para>
-	/// <para>Requires AVX2 at runtime</para>
+	///<summary>
+	/// <para>Converts packed uint64_t in 'x' to packed doubles</para>
+	/// <para>Full Range Supported.</para>
+	/// <para>Requires SSE4.1 at runtime.</para>
 	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
-	/// </summary>
-	/// <param name="v"></param>
-	/// <returns></returns>
-	inline uint64_t _mm256_sum_epi64(__m256i& v)
+	///</summary>
+	/// <param name="x"></param>
+	/// <returns>__m128d</returns>
+	[[nodiscard]] TPA_TARGET_SSE41 inline __m128d _mm_cvtepu64_pd(const __m128i& x) noexcept
 	{
-		__m128i sum128 = _mm_add_epi64(
-			_mm256_castsi256_si128(v),
-			_mm256_extracti128_si256(v, 1));
-		return _mm_sum_epi64(sum128);
-	}//End of _mm256_sum_epi64
+		__m128i xH = _mm_srli_epi64(x, 32ll);
+		xH = _mm_or_si128(xH, _mm_castpd_si128(_mm_set1_pd(19342813113834066795298816.0)));          //  2^84
+		__m128i xL = _mm_blend_epi16(x, _mm_castpd_si128(_mm_set1_pd(0x0010000000000000)), 0xcc);   //  2^52
+		__m128d f = _mm_sub_pd(_mm_castsi128_pd(xH), _mm_set1_pd(19342813118337666422669312.));     //  2^84 + 2^52
 
-	/// <summary>
-	/// <para>Sums the values stored in an __m512i vector of int64_t</para>
-	/// <para>Requires AVX512 at runtime </para>
-	/// <para>AVX512's _mm512_reduce_add_epi64 may be faster in some cases.</para>
-	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
-	/// </summary>
-	/// <param name="v"></param>
-	/// <returns></returns>
-	inline uint64_t _mm512_sum_epi64(__m512i& v)
-	{
-		__m256i sum256 = _mm256_add_epi64(
-			_mm512_castsi512_si256(v),
-			_mm512_extracti64x4_epi64(v, 1));
-		return _mm256_sum_epi64(sum256);
-	}//End of _mm512_sum_epi64
+		return _mm_add_pd(f, _mm_castsi128_pd(xL));
+	}//End of _mm_cvtepu64_pd
 
-	/// <summary>
-	/// <para>Sums the values stored in an __m128 vector of floats</para>
-	/// <para>Requires SSE1 at runtime</para>
+	///<summary>
+	/// <para>Converts packed uint64_t in 'x' to packed doubles</para>
+	/// <para>Full Range Supported.</para>
+	/// <para>Requires AVX2 at runtime.</para>
 	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
-	/// </summary>
+	///</summary>
 	/// <param name="x"></param>
-	/// <returns></returns>
-	inline float _mm_sum_ps(__m128& x)
+	/// <returns>__m256d</returns>
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256d _mm256_cvtepu64_pd(const __m256i& x) noexcept
 	{
-		__m128 shuff = _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 0, 1));
-		__m128 sums = _mm_add_ps(x, shuff);
-		shuff = _mm_movehl_ps(shuff, sums);
-		sums = _mm_add_ss(sums, shuff);
-		return _mm_cvtss_f32(sums);
-	}//End of _mm_sum_ps
+		__m256i xH = _mm256_srli_epi64(x, 32ll);
+		xH = _mm256_or_si256(xH, _mm256_castpd_si256(_mm256_set1_pd(19342813113834066795298816.0)));          //  2^84
+		__m256i xL = _mm256_blend_epi16(x, _mm256_castpd_si256(_mm256_set1_pd(0x0010000000000000)), 0xcc);   //  2^52
+		__m256d f = _mm256_sub_pd(_mm256_castsi256_pd(xH), _mm256_set1_pd(19342813118337666422669312.));     //  2^84 + 2^52
 
-	/// <summary>
-	/// <para>Sums the values stored in an __m256 vector of float</para>
-	/// <para>Requires AVX at runtime</para>
+		return _mm256_add_pd(f, _mm256_castsi256_pd(xL));
+	}//End of _mm256_cvtepu64_pd
+
+	///<summary>
+	/// <para>Converts packed int64_t in 'x' to packed doubles</para>
+	/// <para>Full Range Supported.</para>
+	/// <para>Requires SSE4.1 at runtime.</para>
 	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
-	/// </summary>
-	/// <param name="v"></param>
-	/// <returns></returns>
-	inline float _mm256_sum_ps(__m256& x)
+	///</summary>
+	/// <param name="x"></param>
+	/// <returns>__m128d</returns>
+	[[nodiscard]] TPA_TARGET_SSE41 inline __m128d _mm_cvtepi64_pd(const __m128i& x) noexcept
 	{
-		__m128 vlow = _mm256_castps256_ps128(x);
-		__m128 vhigh = _mm256_extractf128_ps(x, 1);
-		__m128 v128 = _mm_add_ps(vlow, vhigh);
-		return _mm_sum_ps(v128);
-	}//End of _mm256_sum_ps
+		__m128i xH = _mm_srai_epi32(x, 16);
+		xH = _mm_blend_epi16(xH, _mm_setzero_si128(), 0x33);
+		xH = _mm_add_epi64(xH, _mm_castpd_si128(_mm_set1_pd(442721857769029238784.)));              //  3*2^67
+		__m128i xL = _mm_blend_epi16(x, _mm_castpd_si128(_mm_set1_pd(0x0010000000000000)), 0x88);   //  2^52
+		__m128d f = _mm_sub_pd(_mm_castsi128_pd(xH), _mm_set1_pd(442726361368656609280.));          //  3*2^67 + 2^52
 
-	/// <summary>
-	/// <para>Sums the values stored in an __m512 vector of floats</para>
-	/// <para>Requires AVX512 Foundation at runtime </para>
-	/// <para>AVX512's _mm512_reduce_add_ps may be faster in some cases.</para>
+		return _mm_add_pd(f, _mm_castsi128_pd(xL));
+	}//End of _mm_cvtepi64_pd
+
+	///<summary>
+	/// <para>Converts packed int64_t in 'x' to packed doubles</para>
+	/// <para>Full Range Supported.</para>
+	/// <para>Requires AVX2 at runtime.</para>
 	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
-	/// </summary>
-	/// <param name="v"></param>
-	/// <returns></returns>
-	inline float _mm512_sum_ps(__m512& x)
+	///</summary>
+	/// <param name="x"></param>
+	/// <returns>__m256d</returns>
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256d _mm256_cvtepi64_pd(const __m256i& x) noexcept
 	{
-		__m256 vlow = _mm512_castps512_ps256(x);
-		__m256 vhigh = _mm512_extractf32x8_ps(x, 1);
-		__m256 v256 = _mm256_add_ps(vlow, vhigh);
-		return _mm256_sum_ps(v256);
-	}//End of _mm512_sum_ps
+		__m256i xH = _mm256_srai_epi32(x, 16);
+		xH = _mm256_blend_epi16(xH, _mm256_setzero_si256(), 0x33);
+		xH = _mm256_add_epi64(xH, _mm256_castpd_si256(_mm256_set1_pd(442721857769029238784.0)));              //  3*2^67
+		__m256i xL = _mm256_blend_epi16(x, _mm256_castpd_si256(_mm256_set1_pd(0x0010000000000000)), 0x88);   //  2^52
+		__m256d f = _mm256_sub_pd(_mm256_castsi256_pd(xH), _mm256_set1_pd(442726361368656609280.0));          //  3*2^67 + 2^52
 
-	/// <summary>
-	/// <para>Sums the values stored in an __m128d vector of doubles</para>
-	/// <para>Requires SSE2 at runtime</para>
+		return _mm256_add_pd(f, _mm256_castsi256_pd(xL));
+	}//End of _mm256_cvtepi64_pd
+
+	///<summary>
+	/// <para>Converts packed doubles in 'x' to packed int64_t</para>
+	/// <para>Range: [0, 2^51]</para>
+	/// <para>Requires SSE2 at runtime.</para>
 	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
-	/// </summary>
+	///</summary>
 	/// <param name="x"></param>
-	/// <returns></returns>
-	inline double _mm_sum_pd(__m128d& x)
+	/// <returns>__m128i</returns>
+	[[nodiscard]] inline __m128i _mm_cvtpd_epu64(__m128d& x) noexcept
 	{
-		__m128 undef = _mm_undefined_ps();
-		__m128 shuftmp = _mm_movehl_ps(undef, _mm_castpd_ps(x));
-		__m128d shuf = _mm_castps_pd(shuftmp);
-		return  _mm_cvtsd_f64(_mm_add_sd(x, shuf));
-	}//End of _mm_sum_pd
+		x = _mm_add_pd(x, _mm_set1_pd(0x0010000000000000));
+		return _mm_xor_si128(
+			_mm_castpd_si128(x),
+			_mm_castpd_si128(_mm_set1_pd(0x0010000000000000))
+		);
+	}//End of _mm_cvtpd_epu64
 
-	/// <summary>
-	/// <para>Sums the values stored in an __m256d vector of doubles</para>
-	/// <para>Requires AVX at runtime</para>
+	///<summary>
+	/// <para>Converts packed doubles in 'x' to packed uint64_t</para>
+	/// <para>Range: [0, 2^51]</para>
+	/// <para>Requires AVX2 at runtime.</para>
 	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
-	/// </summary>
-	/// <param name="v"></param>
-	/// <returns></returns>
-	inline double _mm256_sum_pd(__m256d& x)
+	///</summary>
+	/// <param name="x"></param>
+	/// <returns>__m256d</returns>
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_cvtpd_epu64(__m256d& x) noexcept
 	{
-		__m128d vlow = _mm256_castpd256_pd128(x);
-		__m128d vhigh = _mm256_extractf128_pd(x, 1);
-		__m128d v128 = _mm_add_pd(vlow, vhigh);
-		return _mm_sum_pd(v128);
-	}//End of _mm256_sum_pd
+		x = _mm256_add_pd(x, _mm256_set1_pd(0x0010000000000000));
+		return _mm256_xor_si256(
+			_mm256_castpd_si256(x),
+			_mm256_castpd_si256(_mm256_set1_pd(0x0010000000000000))
+		);
+	}//End of _mm256_cvtpd_epu64
 
-	/// <summary>
-	/// <para>Sums the values stored in an __m512d vector of doubles</para>
-	/// <para>Requires AVX512 Foundation at runtime </para>
-	/// <para>AVX512's _mm512_reduce_add_pd may be faster in some cases.</para>
+	///<summary>
+	/// <para>Converts packed doubles in 'x' to packed uint64_t</para>
+	/// <para>Range: [-2^51, 2^51]</para>
+	/// <para>Requires SSE2 at runtime.</para>
 	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
-	/// </summary>
-	/// <param name="v"></param>
-	/// <returns></returns>
-	inline double _mm512_sum_pd(__m512d& x)
+	///</summary>
+	/// <param name="x"></param>
+	/// <returns>__m256d</returns>
+	[[nodiscard]] inline __m128i _mm_cvtpd_epi64(__m128d& x) noexcept
 	{
-		__m256d vlow = _mm512_castpd512_pd256(x);
-		__m256d vhigh = _mm512_extractf64x4_pd(x, 1);
-		__m256d v256 = _mm256_add_pd(vlow, vhigh);
-		return _mm256_sum_pd(v256);
-	}//End of _mm512_sum_pd
+		x = _mm_add_pd(x, _mm_set1_pd(0x0018000000000000));
+		return _mm_sub_epi64(
+			_mm_castpd_si128(x),
+			_mm_castpd_si128(_mm_set1_pd(0x0018000000000000))
+		);
+	}//End of _mm_cvtpd_epi64
 
-	/// <summary>
-	/// <para>Sums the values stored in an __m128i vector of int8_t</para>
-	/// <para>Requires SSE2 at runtime</para>
+	///<summary>
+	/// <para>Converts packed doubles in 'x' to packed uint64_t</para>
+	/// <para>Range: [-2^51, 2^51]</para>
+	/// <para>Requires AVX2 at runtime.</para>
 	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
-	/// </summary>
+	///</summary>
 	/// <param name="x"></param>
-	/// <returns></returns>
-	inline uint32_t _mm_sum_epi8(__m128i& x)
+	/// <returns>__m256d</returns>
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_cvtpd_epi64(__m256d& x) noexcept
 	{
-		__m128i v = _mm_sad_epu8(x, _mm_setzero_si128());
-		return _mm_cvtsi128_si32(v) + _mm_extract_epi16(v, 4);
-	}//End of _mm_sum_epi8
+		x = _mm256_add_pd(x, _mm256_set1_pd(0x0018000000000000));
+		return _mm256_sub_epi64(
+			_mm256_castpd_si256(x),
+			_mm256_castpd_si256(_mm256_set1_pd(0x0018000000000000))
+		);
+	}//End of _mm256_cvtpd_epi64
 
-	/// <summary>
-	/// <para>Sums the values stored in an __m256i vector of int8_t</para>
-	/// <para>Requires AVX2 at runtime</para>
+	///<summary>
+	/// <para>Narrow numbers in 'bits' to a certain range.</para>
+	/// <para>Much faster replacement for _mm_rem_epi32 / _mm_rem_epu32 for random number range generation</para>
+	/// <para>Requires SSE2 instruction set at runtime.</para>
 	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
-	/// </summary>
+	///</summary>
+	/// <param name="bits"></param>
+	/// <param name="range"></param>
+	/// <returns>__m128i</returns>
+	[[nodiscard]] inline __m128i _mm_narrow_epi32(const __m128i& bits, const uint32_t range) noexcept
+	{
+		const __m128i mantissaMask = _mm_set1_epi32(0x7FFFFF);
+		const __m128i mantissa = _mm_and_si128(bits, mantissaMask);
+		const __m128 one = _mm_set1_ps(1.0f);
+		__m128 val = _mm_or_ps(_mm_castsi128_ps(mantissa), one);
+
+		const __m128 rf = _mm_set1_ps((float)range);
+		val = _mm_mul_ps(val, rf);
+		val = _mm_sub_ps(val, rf);
+
+		return _mm_cvttps_epi32(val);
+	}//End of _mm_narrow_epi32
+
+	///<summary>
+	/// <para>Narrow numbers in 'bits' to a certain range.</para>
+	/// <para>Much faster replacement for _mm_rem_epi64 / _mm_rem_epu64 for random number range generation</para>
+	/// <para>Requires SSE2 instruction set at runtime.</para>
+	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	///</summary>
+	/// <param name="bits"></param>
+	/// <param name="range"></param>
+	/// <returns>__m128i</returns>
+	[[nodiscard]] inline __m128i _mm_narrow_epi64(const __m128i& bits, const uint64_t range) noexcept
+	{
+		const __m128i mantissaMask = _mm_set1_epi64x(0x7FFFFFFFFFFFFFFF);
+		const __m128i mantissa = _mm_and_si128(bits, mantissaMask);
+		const __m128d one = _mm_set1_pd(1.0);
+		__m128d val = _mm_or_pd(_mm_castsi128_pd(mantissa), one);
+
+		const __m128d rf = _mm_set1_pd((double)range);
+		val = _mm_mul_pd(val, rf);
+		val = _mm_sub_pd(val, rf);
+
+		return tpa::simd::_mm_cvtpd_epi64(val);
+	}//End of _mm_narrow_epi64
+
+	///<summary>
+	/// <para>Narrow numbers in 'bits' to a certain range.</para>
+	/// <para>Much faster replacement for _mm256_rem_epi32 / _mm256_rem_epu32 for random number range generation</para>
+	/// <para>Requires AVX2 and FMA instruction sets at runtime.</para>
+	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	///</summary>
+	/// <param name="bits"></param>
+	/// <param name="range"></param>
+	/// <returns>__m256i</returns>
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_narrow_epi32(const __m256i& bits, const uint32_t range) noexcept
+	{
+		const __m256i mantissaMask = _mm256_set1_epi32(0x7FFFFF);
+		const __m256i mantissa = _mm256_and_si256(bits, mantissaMask);
+		const __m256 one = _mm256_set1_ps(1.0f);
+		__m256 val = _mm256_or_ps(_mm256_castsi256_ps(mantissa), one);
+
+		const __m256 rf = _mm256_set1_ps((float)range);
+		val = _mm256_fmsub_ps(val, rf, rf);
+
+		return _mm256_cvttps_epi32(val);
+	}//End of _mm256_narrow_epi32
+
+	///<summary>
+	/// <para>Narrow numbers in 'bits' to a certain range.</para>
+	/// <para>Much faster replacement for _mm256_rem_epi64 / _mm256_rem_epu64 for random number range generation</para>
+	/// <para>Requires AVX2 and FMA instruction sets at runtime.</para>
+	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	///</summary>
+	/// <param name="bits"></param>
+	/// <param name="range"></param>
+	/// <returns>__m256i</returns>
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_narrow_epi64(const __m256i& bits, const uint64_t range) noexcept
+	{
+		const __m256i mantissaMask = _mm256_set1_epi64x(0x7FFFFFFFFFFFFFFF);
+		const __m256i mantissa = _mm256_and_si256(bits, mantissaMask);
+		const __m256d one = _mm256_set1_pd(1.0);
+		__m256d val = _mm256_or_pd(_mm256_castsi256_pd(mantissa), one);
+
+		const __m256d rf = _mm256_set1_pd((double)range);
+		val = _mm256_fmsub_pd(val, rf, rf);
+
+		return tpa::simd::_mm256_cvtpd_epi64(val);
+	}//End of _mm256_narrow_epi64
+
+	///<summary>
+	/// <para>Narrow numbers in 'bits' to a certain range.</para>
+	/// <para>Much faster replacement for _mm512_rem_epi32 / _mm512_rem_epu32 for random number range generation</para>
+	/// <para>Requires AVX-512 (foundation) instruction set at runtime.</para>
+	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	///</summary>
+	/// <param name="bits"></param>
+	/// <param name="range"></param>
+	/// <returns>__m512i</returns>
+	[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_narrow_epi32(const __m512i& bits, const uint32_t range) noexcept
+	{
+		const __m512i mantissaMask = _mm512_set1_epi64(0x7FFFFF);
+		const __m512i mantissa = _mm512_and_si512(bits, mantissaMask);
+		const __m512 one = _mm512_set1_ps(1.0f);
+		__m512 val = _mm512_or_ps(_mm512_castsi512_ps(mantissa), one);
+
+		const __m512 rf = _mm512_set1_ps((float)range);
+		val = _mm512_fmsub_ps(val, rf, rf);
+
+		return _mm512_cvttps_epi32(val);
+	}//End of _mm512_narrow_epi32
+
+	///<summary>
+	/// <para>Narrow numbers in 'bits' to a certain range.</para>
+	/// <para>Much faster replacement for _mm512_rem_epi64 / _mm512_rem_epu64 for random number range generation</para>
+	/// <para>Requires AVX-512 (foundation) and AVX-512 (Double Word Quad Word) instruction set at runtime.</para>
+	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	///</summary>
+	/// <param name="bits"></param>
+	/// <param name="range"></param>
+	/// <returns>__m512i</returns>
+	[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_narrow_epi64(const __m512i& bits, const uint64_t range) noexcept
+	{
+		const __m512i mantissaMask = _mm512_set1_epi64(0x7FFFFFFFFFFFFFFF);
+		const __m512i mantissa = _mm512_and_si512(bits, mantissaMask);
+		const __m512d one = _mm512_set1_pd(1.0);
+		__m512d val = _mm512_or_pd(_mm512_castsi512_pd(mantissa), one);
+
+		const __m512d rf = _mm512_set1_pd((double)range);
+		val = _mm512_fmsub_pd(val, rf, rf);
+
+		return _mm512_cvttpd_epi64(val);
+	}//End of _mm512_narrow_epi64
+
+	/// <summary>
+	/// <para>Sums the values stored in an __m128i vector of int32_t</para>
+	/// <para>Requires SSE2 at runtime</para>
+	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	/// </summary>
+	/// <param name="x"></param>
+	/// <returns></returns>
+	inline uint32_t _mm_sum_epi32(__m128i& x)
+	{
+		__m128i hi64 = _mm_unpackhi_epi64(x, x);
+		__m128i sum64 = _mm_add_epi32(hi64, x);
+		__m128i hi32 = _mm_shuffle_epi32(sum64, _MM_SHUFFLE(2, 3, 0, 1));
+		__m128i sum32 = _mm_add_epi32(sum64, hi32);
+		return _mm_cvtsi128_si32(sum32);
+	}//End of _mm_sum_epi32
+
+	/// <summary>
+	/// <para>Sums the values stored in an __m256i vector of int32_t</para>
+	/// <para>Requires AVX2 at runtime</para>
+	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	/// </summary>
 	/// <param name="v"></param>
 	/// <returns></returns>
-	inline uint32_t _mm256_sum_epi8(__m256i& x)
+	TPA_TARGET_AVX2 inline uint32_t _mm256_sum_epi32(__m256i& v)
 	{
 		__m128i sum128 = _mm_add_epi32(
-			_mm256_castsi256_si128(x),
-			_mm256_extracti128_si256(x, 1));
-		return _mm_sum_epi8(sum128);
-	}//End of _mm256_sum_epi8
+			_mm256_castsi256_si128(v),
+			_mm256_extracti128_si256(v, 1));
+		return _mm_sum_epi32(sum128);
+	}//End of _mm256_sum_epi32
 
 	/// <summary>
-	/// <para>Sums the values stored in an __m512i vector of int8_t</para>
-	/// <para>Requires AVX512 Byte and Word at runtime </para>
+	/// <para>Sums the values stored in an __m512i vector of int32_t</para>
+	/// <para>Requires AVX512 at runtime </para>
+	/// <para>AVX512's _mm512_reduce_add_epi32 may be faster in some cases.</para>
 	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
 	/// </summary>
 	/// <param name="v"></param>
 	/// <returns></returns>
-	inline uint32_t _mm512_sum_epi8(__m512i& v)
+	TPA_TARGET_AVX512 inline uint32_t _mm512_sum_epi32(__m512i& v)
 	{
 		__m256i sum256 = _mm256_add_epi32(
 			_mm512_castsi512_si256(v),
 			_mm512_extracti64x4_epi64(v, 1));
-		return _mm256_sum_epi8(sum256);
-	}//End of _mm512_sum_epi8
+		return _mm256_sum_epi32(sum256);
+	}//End of _mm512_sum_epi32
 
 	/// <summary>
-	/// <para>Sums the values stored in an __m128i vector of int16_t</para>
+	/// <para>Sums the values stored in an __m128i vector of int64_t</para>
 	/// <para>Requires SSE2 at runtime</para>
 	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
 	/// </summary>
 	/// <param name="x"></param>
 	/// <returns></returns>
-	inline uint32_t _mm_sum_epi16(__m128i& x)
+	inline uint64_t _mm_sum_epi64(__m128i& x)
 	{
-		__m128i _temp = _mm_madd_epi16(x, _mm_set1_epi16(1));
-		return tpa::simd::_mm_sum_epi32(_temp);
-	}//End of _mm_sum_epi16
+		__m128i hi64 = _mm_unpackhi_epi64(x, x);
+		__m128i sum64 = _mm_add_epi64(hi64, x);
+		return _mm_cvtsi128_si64(sum64);
+	}//End of _mm_sum_epi64
 
 	/// <summary>
-	/// <para>Sums the values stored in an __m256i vector of int16_t</para>
+	/// <para>Sums the values stored in an __m256i vector of int64_t</para>
 	/// <para>Requires AVX2 at runtime</para>
 	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
 	/// </summary>
 	/// <param name="v"></param>
 	/// <returns></returns>
-	inline uint32_t _mm256_sum_epi16(__m256i& x)
+	TPA_TARGET_AVX2 inline uint64_t _mm256_sum_epi64(__m256i& v)
 	{
-		__m256i _temp = _mm256_madd_epi16(x, _mm256_set1_epi16(1));
-		return tpa::simd::_mm256_sum_epi32(_temp);
-	}//End of _mm256_sum_epi16
+		__m128i sum128 = _mm_add_epi64(
+			_mm256_castsi256_si128(v),
+			_mm256_extracti128_si256(v, 1));
+		return _mm_sum_epi64(sum128);
+	}//End of _mm256_sum_epi64
 
 	/// <summary>
-	/// <para>Sums the values stored in an __m512i vector of int16_t</para>
-	/// <para>Requires AVX512 Byte & Word at runtime </para>
+	/// <para>Sums the values stored in an __m512i vector of int64_t</para>
+	/// <para>Requires AVX512 at runtime </para>
+	/// <para>AVX512's _mm512_reduce_add_epi64 may be faster in some cases.</para>
 	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
 	/// </summary>
 	/// <param name="v"></param>
 	/// <returns></returns>
-	inline uint32_t _mm512_sum_epi16(__m512i& x)
+	TPA_TARGET_AVX512 inline uint64_t _mm512_sum_epi64(__m512i& v)
 	{
-		__m512i _temp = _mm512_madd_epi16(x, _mm512_set1_epi16(1));
-		return tpa::simd::_mm512_sum_epi32(_temp);
-	}//End of _mm512_sum_epi16
+		__m256i sum256 = _mm256_add_epi64(
+			_mm512_castsi512_si256(v),
+			_mm512_extracti64x4_epi64(v, 1));
+		return _mm256_sum_epi64(sum256);
+	}//End of _mm512_sum_epi64
+
+	/// <summary>
+	/// <para>Sums the values stored in an __m128 vector of floats</para>
+	/// <para>Requires SSE1 at runtime</para>
+	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	/// </summary>
+	/// <param name="x"></param>
+	/// <returns></returns>
+	inline float _mm_sum_ps(__m128& x)
+	{
+		__m128 shuff = _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 0, 1));
+		__m128 sums = _mm_add_ps(x, shuff);
+		shuff = _mm_movehl_ps(shuff, sums);
+		sums = _mm_add_ss(sums, shuff);
+		return _mm_cvtss_f32(sums);
+	}//End of _mm_sum_ps
+
+	/// <summary>
+	/// <para>Sums the values stored in an __m256 vector of float</para>
+	/// <para>Requires AVX at runtime</para>
+	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	/// </summary>
+	/// <param name="v"></param>
+	/// <returns></returns>
+	TPA_TARGET_AVX inline float _mm256_sum_ps(__m256& x)
+	{
+		__m128 vlow = _mm256_castps256_ps128(x);
+		__m128 vhigh = _mm256_extractf128_ps(x, 1);
+		__m128 v128 = _mm_add_ps(vlow, vhigh);
+		return _mm_sum_ps(v128);
+	}//End of _mm256_sum_ps
+
+	/// <summary>
+	/// <para>Sums the values stored in an __m512 vector of floats</para>
+	/// <para>Requires AVX512 Foundation at runtime </para>
+	/// <para>AVX512's _mm512_reduce_add_ps may be faster in some cases.</para>
+	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	/// </summary>
+	/// <param name="v"></param>
+	/// <returns></returns>
+	TPA_TARGET_AVX512 inline float _mm512_sum_ps(__m512& x)
+	{
+		__m256 vlow = _mm512_castps512_ps256(x);
+		__m256 vhigh = _mm512_extractf32x8_ps(x, 1);
+		__m256 v256 = _mm256_add_ps(vlow, vhigh);
+		return _mm256_sum_ps(v256);
+	}//End of _mm512_sum_ps
+
+	/// <summary>
+	/// <para>Sums the values stored in an __m128d vector of doubles</para>
+	/// <para>Requires SSE2 at runtime</para>
+	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	/// </summary>
+	/// <param name="x"></param>
+	/// <returns></returns>
+	inline double _mm_sum_pd(__m128d& x)
+	{
+		__m128 undef = _mm_undefined_ps();
+		__m128 shuftmp = _mm_movehl_ps(undef, _mm_castpd_ps(x));
+		__m128d shuf = _mm_castps_pd(shuftmp);
+		return  _mm_cvtsd_f64(_mm_add_sd(x, shuf));
+	}//End of _mm_sum_pd
+
+	/// <summary>
+	/// <para>Sums the values stored in an __m256d vector of doubles</para>
+	/// <para>Requires AVX at runtime</para>
+	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	/// </summary>
+	/// <param name="v"></param>
+	/// <returns></returns>
+	TPA_TARGET_AVX inline double _mm256_sum_pd(__m256d& x)
+	{
+		__m128d vlow = _mm256_castpd256_pd128(x);
+		__m128d vhigh = _mm256_extractf128_pd(x, 1);
+		__m128d v128 = _mm_add_pd(vlow, vhigh);
+		return _mm_sum_pd(v128);
+	}//End of _mm256_sum_pd
+
+	/// <summary>
+	/// <para>Sums the values stored in an __m512d vector of doubles</para>
+	/// <para>Requires AVX512 Foundation at runtime </para>
+	/// <para>AVX512's _mm512_reduce_add_pd may be faster in some cases.</para>
+	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	/// </summary>
+	/// <param name="v"></param>
+	/// <returns></returns>
+	TPA_TARGET_AVX512 inline double _mm512_sum_pd(__m512d& x)
+	{
+		__m256d vlow = _mm512_castpd512_pd256(x);
+		__m256d vhigh = _mm512_extractf64x4_pd(x, 1);
+		__m256d v256 = _mm256_add_pd(vlow, vhigh);
+		return _mm256_sum_pd(v256);
+	}//End of _mm512_sum_pd
+
+	/// <summary>
+	/// <para>Sums the values stored in an __m128i vector of int8_t</para>
+	/// <para>Requires SSE2 at runtime</para>
+	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	/// </summary>
+	/// <param name="x"></param>
+	/// <returns></returns>
+	inline uint32_t _mm_sum_epi8(__m128i& x)
+	{
+		__m128i v = _mm_sad_epu8(x, _mm_setzero_si128());
+		return _mm_cvtsi128_si32(v) + _mm_extract_epi16(v, 4);
+	}//End of _mm_sum_epi8
+
+	/// <summary>
+	/// <para>Sums the values stored in an __m256i vector of int8_t</para>
+	/// <para>Requires AVX2 at runtime</para>
+	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	/// </summary>
+	/// <param name="v"></param>
+	/// <returns></returns>
+	TPA_TARGET_AVX2 inline uint32_t _mm256_sum_epi8(__m256i& x)
+	{
+		__m128i sum128 = _mm_add_epi32(
+			_mm256_castsi256_si128(x),
+			_mm256_extracti128_si256(x, 1));
+		return _mm_sum_epi8(sum128);
+	}//End of _mm256_sum_epi8
+
+	/// <summary>
+	/// <para>Sums the values stored in an __m512i vector of int8_t</para>
+	/// <para>Requires AVX512 Byte and Word at runtime </para>
+	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	/// </summary>
+	/// <param name="v"></param>
+	/// <returns></returns>
+	TPA_TARGET_AVX512 inline uint32_t _mm512_sum_epi8(__m512i& v)
+	{
+		__m256i sum256 = _mm256_add_epi32(
+			_mm512_castsi512_si256(v),
+			_mm512_extracti64x4_epi64(v, 1));
+		return _mm256_sum_epi8(sum256);
+	}//End of _mm512_sum_epi8
+
+	/// <summary>
+	/// <para>Sums the values stored in an __m128i vector of int16_t</para>
+	/// <para>Requires SSE2 at runtime</para>
+	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	/// </summary>
+	/// <param name="x"></param>
+	/// <returns></returns>
+	inline uint32_t _mm_sum_epi16(__m128i& x)
+	{
+		__m128i _temp = _mm_madd_epi16(x, _mm_set1_epi16(1));
+		return tpa::simd::_mm_sum_epi32(_temp);
+	}//End of _mm_sum_epi16
+
+	/// <summary>
+	/// <para>Sums the values stored in an __m256i vector of int16_t</para>
+	/// <para>Requires AVX2 at runtime</para>
+	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	/// </summary>
+	/// <param name="v"></param>
+	/// <returns></returns>
+	TPA_TARGET_AVX2 inline uint32_t _mm256_sum_epi16(__m256i& x)
+	{
+		__m256i _temp = _mm256_madd_epi16(x, _mm256_set1_epi16(1));
+		return tpa::simd::_mm256_sum_epi32(_temp);
+	}//End of _mm256_sum_epi16
+
+	/// <summary>
+	/// <para>Sums the values stored in an __m512i vector of int16_t</para>
+	/// <para>Requires AVX512 Byte & Word at runtime </para>
+	/// <para>Note: This is a function which is part of TPA and is not an instruction or intrinsic.</para>
+	/// </summary>
+	/// <param name="v"></param>
+	/// <returns></returns>
+	TPA_TARGET_AVX512 inline uint32_t _mm512_sum_epi16(__m512i& x)
+	{
+		__m512i _temp = _mm512_madd_epi16(x, _mm512_set1_epi16(1));
+		return tpa::simd::_mm512_sum_epi32(_temp);
+	}//End of _mm512_sum_epi16
+#endif
+#pragma endregion
+
+#pragma region integer_division
+	/// <summary>
+	/// <para>Precomputed divisor used for fast integer division and modulo by a runtime-invariant value.</para>
+	/// <para>The divisor is converted once to a 'magic number' multiplier and shift (Granlund-Montgomery / libdivide),</para>
+	/// <para>every following division is then a multiply-high, an add and a shift which vectorizes at every integer width.</para>
+	/// <para>Works for all 8, 16, 32 and 64-bit signed and unsigned integers, throws tpa::exceptions::DivideByZero when passed 0.</para>
+	/// <para>Note: This is part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	template<typename T>
+	requires std::is_integral<T>::value && (!std::is_same<T, bool>::value)
+	struct int_divider
+	{
+		using U = std::make_unsigned_t<T>;
+		static constexpr uint32_t bits = static_cast<uint32_t>(sizeof(T) * 8u);
+
+		T divisor = 1;
+		T magic = 1;
+		uint32_t shift1 = 0u;
+		uint32_t shift2 = 0u;
+		T sign = 0;
+
+		constexpr int_divider(const T d) : divisor(d)
+		{
+			if (d == 0)
+			{
+				throw tpa::exceptions::DivideByZero();
+			}//End if
+
+			if constexpr (std::is_unsigned<T>())
+			{
+				//l = ceil(log2(d))
+				const uint32_t l = (d == 1) ? 0u : bits - static_cast<uint32_t>(std::countl_zero(static_cast<U>(d - 1u)));
+
+				magic = static_cast<T>(static_cast<U>(pow2_div(bits + l, static_cast<uint64_t>(d)) + 1u));
+				shift1 = (l < 1u) ? l : 1u;
+				shift2 = (l > 0u) ? l - 1u : 0u;
+			}//End if
+			else
+			{
+				const U ad = (d < 0) ? static_cast<U>(0u - static_cast<U>(d)) : static_cast<U>(d);
+
+				//l = max(ceil(log2(|d|)), 1)
+				uint32_t l = (ad == 1u) ? 0u : bits - static_cast<uint32_t>(std::countl_zero(static_cast<U>(ad - 1u)));
+				if (l < 1u) l = 1u;
+
+				magic = static_cast<T>(static_cast<U>(pow2_div(bits + l - 1u, static_cast<uint64_t>(ad)) + 1u));
+				shift2 = l - 1u;
+				sign = (d < 0) ? static_cast<T>(-1) : static_cast<T>(0);
+			}//End else
+		}//End of constructor
+
+		/// <summary>
+		/// <para>Returns n / divisor, rounded toward zero like the built-in operator.</para>
+		/// </summary>
+		/// <param name="n"></param>
+		/// <returns></returns>
+		[[nodiscard]] constexpr T divide(const T n) const noexcept
+		{
+			if constexpr (std::is_unsigned<T>())
+			{
+				const U t = mulhi(static_cast<U>(magic), static_cast<U>(n));
+				return static_cast<T>(static_cast<U>(static_cast<U>(t + static_cast<U>(static_cast<U>(n - t) >> shift1)) >> shift2));
+			}//End if
+			else
+			{
+				const U un = static_cast<U>(n);
+				const U um = static_cast<U>(magic);
+				const U neg_n = static_cast<U>(0u - (un >> (bits - 1u)));
+				const U neg_m = static_cast<U>(0u - (um >> (bits - 1u)));
+
+				//Signed multiply-high from the unsigned product
+				const U hi = static_cast<U>(mulhi(um, un) - (neg_n & um) - (neg_m & un));
+
+				T q = static_cast<T>(static_cast<U>(un + hi));
+				q = static_cast<T>(q >> shift2);
+				q = static_cast<T>(q - static_cast<T>(neg_n));
+				return static_cast<T>(static_cast<T>(q ^ sign) - sign);
+			}//End else
+		}//End of divide
+
+		/// <summary>
+		/// <para>Returns n % divisor, with the sign of n like the built-in operator.</para>
+		/// </summary>
+		/// <param name="n"></param>
+		/// <returns></returns>
+		[[nodiscard]] constexpr T modulo(const T n) const noexcept
+		{
+			return static_cast<T>(static_cast<U>(static_cast<U>(n) - static_cast<U>(static_cast<U>(divide(n)) * static_cast<U>(divisor))));
+		}//End of modulo
+
+		/// <summary>
+		/// <para>Returns the high half of the full-width product of a and b.</para>
+		/// </summary>
+		/// <param name="a"></param>
+		/// <param name="b"></param>
+		/// <returns></returns>
+		[[nodiscard]] static constexpr U mulhi(const U a, const U b) noexcept
+		{
+			if constexpr (sizeof(U) < 8)
+			{
+				return static_cast<U>((static_cast<uint64_t>(a) * static_cast<uint64_t>(b)) >> bits);
+			}//End if
+			else
+			{
+				const uint64_t a_lo = a & 0xFFFFFFFFull;
+				const uint64_t a_hi = a >> 32;
+				const uint64_t b_lo = b & 0xFFFFFFFFull;
+				const uint64_t b_hi = b >> 32;
+
+				const uint64_t t = (a_hi * b_lo) + ((a_lo * b_lo) >> 32);
+				const uint64_t w = (t & 0xFFFFFFFFull) + (a_lo * b_hi);
+
+				return (a_hi * b_hi) + (t >> 32) + (w >> 32);
+			}//End else
+		}//End of mulhi
+
+	private:
+		/// <summary>
+		/// <para>Returns the low 64 bits of floor(2^k / d) using binary long division, k may be as large as 128.</para>
+		/// </summary>
+		/// <param name="k"></param>
+		/// <param name="d"></param>
+		/// <returns></returns>
+		[[nodiscard]] static constexpr uint64_t pow2_div(const uint32_t k, const uint64_t d) noexcept
+		{
+			uint64_t q = 0ull;
+			uint64_t r = 0ull;
+
+			for (int32_t b = static_cast<int32_t>(k); b >= 0; --b)
+			{
+				const bool carry = (r >> 63) != 0ull;
+				r = (r << 1) | ((b == static_cast<int32_t>(k)) ? 1ull : 0ull);
+				q <<= 1;
+
+				if (carry || r >= d)
+				{
+					r -= d;
+					q |= 1ull;
+				}//End if
+			}//End for
+
+			return q;
+		}//End of pow2_div
+	};//End of int_divider
+
+#ifdef TPA_X86_64
+	///<summary>
+	///<para> Multiply Packed Unsigned 32-Bit Integers in 'a' by 'b' and return the high 32 bits of each product using SSE2</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without SSE2.</para>
+	///</summary>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m128i</returns>
+	[[nodiscard]] inline __m128i _mm_mulhi_epu32(const __m128i& a, const __m128i& b) noexcept
+	{
+		const __m128i even = _mm_srli_epi64(_mm_mul_epu32(a, b), 32);
+		const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+		const __m128i hi_mask = _mm_set1_epi64x(static_cast<int64_t>(0xFFFFFFFF00000000ull));
+		return _mm_or_si128(even, _mm_and_si128(odd, hi_mask));
+	}//End of _mm_mulhi_epu32
+
+	///<summary>
+	///<para> Multiply Packed Signed 32-Bit Integers in 'a' by 'b' and return the high 32 bits of each product using SSE2</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without SSE2.</para>
+	///</summary>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m128i</returns>
+	[[nodiscard]] inline __m128i _mm_mulhi_epi32(const __m128i& a, const __m128i& b) noexcept
+	{
+		const __m128i hi = tpa::simd::_mm_mulhi_epu32(a, b);
+		const __m128i fix_a = _mm_and_si128(_mm_srai_epi32(a, 31), b);
+		const __m128i fix_b = _mm_and_si128(_mm_srai_epi32(b, 31), a);
+		return _mm_sub_epi32(_mm_sub_epi32(hi, fix_a), fix_b);
+	}//End of _mm_mulhi_epi32
+
+	///<summary>
+	///<para> Multiply Packed Unsigned 64-Bit Integers in 'a' by 'b' and return the high 64 bits of each product using SSE2</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without SSE2.</para>
+	///</summary>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m128i</returns>
+	[[nodiscard]] inline __m128i _mm_mulhi_epu64(const __m128i& a, const __m128i& b) noexcept
+	{
+		const __m128i lo_mask = _mm_set1_epi64x(0xFFFFFFFFll);
+		const __m128i a_hi = _mm_srli_epi64(a, 32);
+		const __m128i b_hi = _mm_srli_epi64(b, 32);
+
+		const __m128i ll = _mm_mul_epu32(a, b);
+		const __m128i lh = _mm_mul_epu32(a, b_hi);
+		const __m128i hl = _mm_mul_epu32(a_hi, b);
+		const __m128i hh = _mm_mul_epu32(a_hi, b_hi);
+
+		const __m128i t = _mm_add_epi64(hl, _mm_srli_epi64(ll, 32));
+		const __m128i w = _mm_add_epi64(_mm_and_si128(t, lo_mask), lh);
+
+		return _mm_add_epi64(_mm_add_epi64(hh, _mm_srli_epi64(t, 32)), _mm_srli_epi64(w, 32));
+	}//End of _mm_mulhi_epu64
+
+	///<summary>
+	///<para> Multiply Packed Signed 64-Bit Integers in 'a' by 'b' and return the high 64 bits of each product using SSE2</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without SSE2.</para>
+	///</summary>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m128i</returns>
+	[[nodiscard]] inline __m128i _mm_mulhi_epi64(const __m128i& a, const __m128i& b) noexcept
+	{
+		const __m128i hi = tpa::simd::_mm_mulhi_epu64(a, b);
+		const __m128i sign_a = _mm_shuffle_epi32(_mm_srai_epi32(a, 31), _MM_SHUFFLE(3, 3, 1, 1));
+		const __m128i sign_b = _mm_shuffle_epi32(_mm_srai_epi32(b, 31), _MM_SHUFFLE(3, 3, 1, 1));
+		const __m128i fix_a = _mm_and_si128(sign_a, b);
+		const __m128i fix_b = _mm_and_si128(sign_b, a);
+		return _mm_sub_epi64(_mm_sub_epi64(hi, fix_a), fix_b);
+	}//End of _mm_mulhi_epi64
+
+	///<summary>
+	///<para> Multiply Packed Unsigned 32-Bit Integers in 'a' by 'b' and return the high 32 bits of each product using AVX2</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX2.</para>
+	///</summary>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m256i</returns>
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_mulhi_epu32(const __m256i& a, const __m256i& b) noexcept
+	{
+		const __m256i even = _mm256_srli_epi64(_mm256_mul_epu32(a, b), 32);
+		const __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+		return _mm256_blend_epi32(even, odd, 0xAA);
+	}//End of _mm256_mulhi_epu32
+
+	///<summary>
+	///<para> Multiply Packed Signed 32-Bit Integers in 'a' by 'b' and return the high 32 bits of each product using AVX2</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX2.</para>
+	///</summary>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m256i</returns>
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_mulhi_epi32(const __m256i& a, const __m256i& b) noexcept
+	{
+		const __m256i even = _mm256_srli_epi64(_mm256_mul_epi32(a, b), 32);
+		const __m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+		return _mm256_blend_epi32(even, odd, 0xAA);
+	}//End of _mm256_mulhi_epi32
+
+	///<summary>
+	///<para> Multiply Packed Unsigned 64-Bit Integers in 'a' by 'b' and return the high 64 bits of each product using AVX2</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX2.</para>
+	///</summary>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m256i</returns>
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_mulhi_epu64(const __m256i& a, const __m256i& b) noexcept
+	{
+		const __m256i lo_mask = _mm256_set1_epi64x(0xFFFFFFFFll);
+		const __m256i a_hi = _mm256_srli_epi64(a, 32);
+		const __m256i b_hi = _mm256_srli_epi64(b, 32);
+
+		const __m256i ll = _mm256_mul_epu32(a, b);
+		const __m256i lh = _mm256_mul_epu32(a, b_hi);
+		const __m256i hl = _mm256_mul_epu32(a_hi, b);
+		const __m256i hh = _mm256_mul_epu32(a_hi, b_hi);
+
+		const __m256i t = _mm256_add_epi64(hl, _mm256_srli_epi64(ll, 32));
+		const __m256i w = _mm256_add_epi64(_mm256_and_si256(t, lo_mask), lh);
+
+		return _mm256_add_epi64(_mm256_add_epi64(hh, _mm256_srli_epi64(t, 32)), _mm256_srli_epi64(w, 32));
+	}//End of _mm256_mulhi_epu64
+
+	///<summary>
+	///<para> Multiply Packed Signed 64-Bit Integers in 'a' by 'b' and return the high 64 bits of each product using AVX2</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX2.</para>
+	///</summary>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m256i</returns>
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_mulhi_epi64(const __m256i& a, const __m256i& b) noexcept
+	{
+		const __m256i zero = _mm256_setzero_si256();
+		const __m256i hi = tpa::simd::_mm256_mulhi_epu64(a, b);
+		const __m256i fix_a = _mm256_and_si256(_mm256_cmpgt_epi64(zero, a), b);
+		const __m256i fix_b = _mm256_and_si256(_mm256_cmpgt_epi64(zero, b), a);
+		return _mm256_sub_epi64(_mm256_sub_epi64(hi, fix_a), fix_b);
+	}//End of _mm256_mulhi_epi64
+
+	///<summary>
+	///<para> Multiply Packed Unsigned 32-Bit Integers in 'a' by 'b' and return the high 32 bits of each product using AVX-512</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX-512.</para>
+	///</summary>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m512i</returns>
+	[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_mulhi_epu32(const __m512i& a, const __m512i& b) noexcept
+	{
+		const __m512i even = _mm512_srli_epi64(_mm512_mul_epu32(a, b), 32);
+		const __m512i odd = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+		return _mm512_mask_blend_epi32(0xAAAA, even, odd);
+	}//End of _mm512_mulhi_epu32
+
+	///<summary>
+	///<para> Multiply Packed Signed 32-Bit Integers in 'a' by 'b' and return the high 32 bits of each product using AVX-512</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX-512.</para>
+	///</summary>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m512i</returns>
+	[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_mulhi_epi32(const __m512i& a, const __m512i& b) noexcept
+	{
+		const __m512i even = _mm512_srli_epi64(_mm512_mul_epi32(a, b), 32);
+		const __m512i odd = _mm512_mul_epi32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+		return _mm512_mask_blend_epi32(0xAAAA, even, odd);
+	}//End of _mm512_mulhi_epi32
+
+	///<summary>
+	///<para> Multiply Packed Unsigned 64-Bit Integers in 'a' by 'b' and return the high 64 bits of each product using AVX-512</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX-512.</para>
+	///</summary>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m512i</returns>
+	[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_mulhi_epu64(const __m512i& a, const __m512i& b) noexcept
+	{
+		const __m512i lo_mask = _mm512_set1_epi64(0xFFFFFFFFll);
+		const __m512i a_hi = _mm512_srli_epi64(a, 32);
+		const __m512i b_hi = _mm512_srli_epi64(b, 32);
+
+		const __m512i ll = _mm512_mul_epu32(a, b);
+		const __m512i lh = _mm512_mul_epu32(a, b_hi);
+		const __m512i hl = _mm512_mul_epu32(a_hi, b);
+		const __m512i hh = _mm512_mul_epu32(a_hi, b_hi);
+
+		const __m512i t = _mm512_add_epi64(hl, _mm512_srli_epi64(ll, 32));
+		const __m512i w = _mm512_add_epi64(_mm512_and_si512(t, lo_mask), lh);
+
+		return _mm512_add_epi64(_mm512_add_epi64(hh, _mm512_srli_epi64(t, 32)), _mm512_srli_epi64(w, 32));
+	}//End of _mm512_mulhi_epu64
+
+	///<summary>
+	///<para> Multiply Packed Signed 64-Bit Integers in 'a' by 'b' and return the high 64 bits of each product using AVX-512</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX-512.</para>
+	///</summary>
+	/// <param name="a"></param>
+	/// <param name="b"></param>
+	/// <returns>__m512i</returns>
+	[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_mulhi_epi64(const __m512i& a, const __m512i& b) noexcept
+	{
+		const __m512i hi = tpa::simd::_mm512_mulhi_epu64(a, b);
+		const __m512i fix_a = _mm512_and_si512(_mm512_srai_epi64(a, 63), b);
+		const __m512i fix_b = _mm512_and_si512(_mm512_srai_epi64(b, 63), a);
+		return _mm512_sub_epi64(_mm512_sub_epi64(hi, fix_a), fix_b);
+	}//End of _mm512_mulhi_epi64
+
+	///<summary>
+	///<para> Divide packed integers in 'n' by a precomputed tpa::simd::int_divider using SSE2</para>
+	///<para>The element width and signedness are taken from the divider, 8-bit lanes are widened to 16-bit internally.</para>
+	///<para>Replaces _mm_div_epi8 ... _mm_div_epu64 (SVML) when the divisor is the same for every lane.</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without SSE2.</para>
+	///</summary>
+	/// <param name="n"></param>
+	/// <param name="d"></param>
+	/// <returns>__m128i</returns>
+	template<typename T>
+	[[nodiscard]] inline __m128i _mm_div_magic(const __m128i& n, const tpa::simd::int_divider<T>& d) noexcept
+	{
+		const __m128i s1 = _mm_cvtsi32_si128(static_cast<int>(d.shift1));
+		const __m128i s2 = _mm_cvtsi32_si128(static_cast<int>(d.shift2));
+
+		if constexpr (sizeof(T) == 1)
+		{
+			const __m128i m = _mm_set1_epi16(static_cast<int16_t>(d.magic));
+
+			if constexpr (std::is_unsigned<T>())
+			{
+				const __m128i zero = _mm_setzero_si128();
+				__m128i lo = _mm_unpacklo_epi8(n, zero);
+				__m128i hi = _mm_unpackhi_epi8(n, zero);
+				__m128i t_lo = _mm_srli_epi16(_mm_mullo_epi16(lo, m), 8);
+				__m128i t_hi = _mm_srli_epi16(_mm_mullo_epi16(hi, m), 8);
+
+				lo = _mm_srl_epi16(_mm_add_epi16(t_lo, _mm_srl_epi16(_mm_sub_epi16(lo, t_lo), s1)), s2);
+				hi = _mm_srl_epi16(_mm_add_epi16(t_hi, _mm_srl_epi16(_mm_sub_epi16(hi, t_hi), s1)), s2);
+
+				return _mm_packus_epi16(lo, hi);
+			}//End if
+			else
+			{
+				const __m128i sign = _mm_set1_epi16(static_cast<int16_t>(d.sign));
+				__m128i lo = _mm_srai_epi16(_mm_unpacklo_epi8(n, n), 8);
+				__m128i hi = _mm_srai_epi16(_mm_unpackhi_epi8(n, n), 8);
+
+				lo = _mm_sub_epi16(_mm_sra_epi16(_mm_add_epi16(lo, _mm_srai_epi16(_mm_mullo_epi16(lo, m), 8)), s2), _mm_srai_epi16(lo, 15));
+				hi = _mm_sub_epi16(_mm_sra_epi16(_mm_add_epi16(hi, _mm_srai_epi16(_mm_mullo_epi16(hi, m), 8)), s2), _mm_srai_epi16(hi, 15));
+
+				lo = _mm_sub_epi16(_mm_xor_si128(lo, sign), sign);
+				hi = _mm_sub_epi16(_mm_xor_si128(hi, sign), sign);
+
+				return _mm_packs_epi16(lo, hi);
+			}//End else
+		}//End if
+		else if constexpr (sizeof(T) == 2)
+		{
+			const __m128i m = _mm_set1_epi16(static_cast<int16_t>(d.magic));
+
+			if constexpr (std::is_unsigned<T>())
+			{
+				const __m128i t = _mm_mulhi_epu16(n, m);
+				return _mm_srl_epi16(_mm_add_epi16(t, _mm_srl_epi16(_mm_sub_epi16(n, t), s1)), s2);
+			}//End if
+			else
+			{
+				const __m128i sign = _mm_set1_epi16(static_cast<int16_t>(d.sign));
+				__m128i q = _mm_add_epi16(n, _mm_mulhi_epi16(n, m));
+				q = _mm_sub_epi16(_mm_sra_epi16(q, s2), _mm_srai_epi16(n, 15));
+				return _mm_sub_epi16(_mm_xor_si128(q, sign), sign);
+			}//End else
+		}//End if
+		else if constexpr (sizeof(T) == 4)
+		{
+			const __m128i m = _mm_set1_epi32(static_cast<int32_t>(d.magic));
+
+			if constexpr (std::is_unsigned<T>())
+			{
+				const __m128i t = tpa::simd::_mm_mulhi_epu32(n, m);
+				return _mm_srl_epi32(_mm_add_epi32(t, _mm_srl_epi32(_mm_sub_epi32(n, t), s1)), s2);
+			}//End if
+			else
+			{
+				const __m128i sign = _mm_set1_epi32(static_cast<int32_t>(d.sign));
+				__m128i q = _mm_add_epi32(n, tpa::simd::_mm_mulhi_epi32(n, m));
+				q = _mm_sub_epi32(_mm_sra_epi32(q, s2), _mm_srai_epi32(n, 31));
+				return _mm_sub_epi32(_mm_xor_si128(q, sign), sign);
+			}//End else
+		}//End if
+		else
+		{
+			const __m128i m = _mm_set1_epi64x(static_cast<int64_t>(d.magic));
+
+			if constexpr (std::is_unsigned<T>())
+			{
+				const __m128i t = tpa::simd::_mm_mulhi_epu64(n, m);
+				return _mm_srl_epi64(_mm_add_epi64(t, _mm_srl_epi64(_mm_sub_epi64(n, t), s1)), s2);
+			}//End if
+			else
+			{
+				const __m128i sign = _mm_set1_epi64x(static_cast<int64_t>(d.sign));
+				const __m128i n_sign = _mm_shuffle_epi32(_mm_srai_epi32(n, 31), _MM_SHUFFLE(3, 3, 1, 1));
+				const __m128i msb = _mm_srl_epi64(_mm_set1_epi64x(static_cast<int64_t>(0x8000000000000000ull)), s2);
+
+				__m128i q = _mm_add_epi64(n, tpa::simd::_mm_mulhi_epi64(n, m));
+				//Arithmetic shift right emulated with a logical shift
+				q = _mm_sub_epi64(_mm_xor_si128(_mm_srl_epi64(q, s2), msb), msb);
+				q = _mm_sub_epi64(q, n_sign);
+				return _mm_sub_epi64(_mm_xor_si128(q, sign), sign);
+			}//End else
+		}//End else
+	}//End of _mm_div_magic
+
+	///<summary>
+	///<para> Computes the remainder of packed integers in 'n' divided by a precomputed tpa::simd::int_divider using SSE2</para>
+	///<para>Replaces _mm_rem_epi8 ... _mm_rem_epu64 (SVML) when the divisor is the same for every lane.</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without SSE2.</para>
+	///</summary>
+	/// <param name="n"></param>
+	/// <param name="d"></param>
+	/// <returns>__m128i</returns>
+	template<typename T>
+	[[nodiscard]] inline __m128i _mm_rem_magic(const __m128i& n, const tpa::simd::int_divider<T>& d) noexcept
+	{
+		const __m128i q = tpa::simd::_mm_div_magic(n, d);
+
+		if constexpr (sizeof(T) == 1)
+		{
+			//Quotient * divisor fits in the low byte of a 16-bit product
+			const __m128i dv = _mm_set1_epi16(static_cast<int16_t>(static_cast<uint8_t>(d.divisor)));
+			const __m128i lo_mask = _mm_set1_epi16(0x00FF);
+			const __m128i p_even = _mm_and_si128(_mm_mullo_epi16(q, dv), lo_mask);
+			const __m128i p_odd = _mm_slli_epi16(_mm_mullo_epi16(_mm_srli_epi16(q, 8), dv), 8);
+			return _mm_sub_epi8(n, _mm_or_si128(p_even, p_odd));
+		}//End if
+		else if constexpr (sizeof(T) == 2)
+		{
+			return _mm_sub_epi16(n, _mm_mullo_epi16(q, _mm_set1_epi16(static_cast<int16_t>(d.divisor))));
+		}//End if
+		else if constexpr (sizeof(T) == 4)
+		{
+			return _mm_sub_epi32(n, tpa::simd::_mm_mul_epi32(q, _mm_set1_epi32(static_cast<int32_t>(d.divisor))));
+		}//End if
+		else
+		{
+			return _mm_sub_epi64(n, tpa::simd::_mm_mul_epi64(q, _mm_set1_epi64x(static_cast<int64_t>(d.divisor))));
+		}//End else
+	}//End of _mm_rem_magic
+
+	///<summary>
+	///<para> Divide packed integers in 'n' by a precomputed tpa::simd::int_divider using AVX2</para>
+	///<para>The element width and signedness are taken from the divider, 8-bit lanes are widened to 16-bit internally.</para>
+	///<para>Replaces _mm256_div_epi8 ... _mm256_div_epu64 (SVML) when the divisor is the same for every lane.</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX2.</para>
+	///</summary>
+	/// <param name="n"></param>
+	/// <param name="d"></param>
+	/// <returns>__m256i</returns>
+	template<typename T>
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_div_magic(const __m256i& n, const tpa::simd::int_divider<T>& d) noexcept
+	{
+		const __m128i s1 = _mm_cvtsi32_si128(static_cast<int>(d.shift1));
+		const __m128i s2 = _mm_cvtsi32_si128(static_cast<int>(d.shift2));
+
+		if constexpr (sizeof(T) == 1)
+		{
+			const __m256i m = _mm256_set1_epi16(static_cast<int16_t>(d.magic));
+
+			if constexpr (std::is_unsigned<T>())
+			{
+				const __m256i zero = _mm256_setzero_si256();
+				__m256i lo = _mm256_unpacklo_epi8(n, zero);
+				__m256i hi = _mm256_unpackhi_epi8(n, zero);
+				__m256i t_lo = _mm256_srli_epi16(_mm256_mullo_epi16(lo, m), 8);
+				__m256i t_hi = _mm256_srli_epi16(_mm256_mullo_epi16(hi, m), 8);
+
+				lo = _mm256_srl_epi16(_mm256_add_epi16(t_lo, _mm256_srl_epi16(_mm256_sub_epi16(lo, t_lo), s1)), s2);
+				hi = _mm256_srl_epi16(_mm256_add_epi16(t_hi, _mm256_srl_epi16(_mm256_sub_epi16(hi, t_hi), s1)), s2);
+
+				return _mm256_packus_epi16(lo, hi);
+			}//End if
+			else
+			{
+				const __m256i sign = _mm256_set1_epi16(static_cast<int16_t>(d.sign));
+				__m256i lo = _mm256_srai_epi16(_mm256_unpacklo_epi8(n, n), 8);
+				__m256i hi = _mm256_srai_epi16(_mm256_unpackhi_epi8(n, n), 8);
+
+				lo = _mm256_sub_epi16(_mm256_sra_epi16(_mm256_add_epi16(lo, _mm256_srai_epi16(_mm256_mullo_epi16(lo, m), 8)), s2), _mm256_srai_epi16(lo, 15));
+				hi = _mm256_sub_epi16(_mm256_sra_epi16(_mm256_add_epi16(hi, _mm256_srai_epi16(_mm256_mullo_epi16(hi, m), 8)), s2), _mm256_srai_epi16(hi, 15));
+
+				lo = _mm256_sub_epi16(_mm256_xor_si256(lo, sign), sign);
+				hi = _mm256_sub_epi16(_mm256_xor_si256(hi, sign), sign);
+
+				return _mm256_packs_epi16(lo, hi);
+			}//End else
+		}//End if
+		else if constexpr (sizeof(T) == 2)
+		{
+			const __m256i m = _mm256_set1_epi16(static_cast<int16_t>(d.magic));
+
+			if constexpr (std::is_unsigned<T>())
+			{
+				const __m256i t = _mm256_mulhi_epu16(n, m);
+				return _mm256_srl_epi16(_mm256_add_epi16(t, _mm256_srl_epi16(_mm256_sub_epi16(n, t), s1)), s2);
+			}//End if
+			else
+			{
+				const __m256i sign = _mm256_set1_epi16(static_cast<int16_t>(d.sign));
+				__m256i q = _mm256_add_epi16(n, _mm256_mulhi_epi16(n, m));
+				q = _mm256_sub_epi16(_mm256_sra_epi16(q, s2), _mm256_srai_epi16(n, 15));
+				return _mm256_sub_epi16(_mm256_xor_si256(q, sign), sign);
+			}//End else
+		}//End if
+		else if constexpr (sizeof(T) == 4)
+		{
+			const __m256i m = _mm256_set1_epi32(static_cast<int32_t>(d.magic));
+
+			if constexpr (std::is_unsigned<T>())
+			{
+				const __m256i t = tpa::simd::_mm256_mulhi_epu32(n, m);
+				return _mm256_srl_epi32(_mm256_add_epi32(t, _mm256_srl_epi32(_mm256_sub_epi32(n, t), s1)), s2);
+			}//End if
+			else
+			{
+				const __m256i sign = _mm256_set1_epi32(static_cast<int32_t>(d.sign));
+				__m256i q = _mm256_add_epi32(n, tpa::simd::_mm256_mulhi_epi32(n, m));
+				q = _mm256_sub_epi32(_mm256_sra_epi32(q, s2), _mm256_srai_epi32(n, 31));
+				return _mm256_sub_epi32(_mm256_xor_si256(q, sign), sign);
+			}//End else
+		}//End if
+		else
+		{
+			const __m256i m = _mm256_set1_epi64x(static_cast<int64_t>(d.magic));
+
+			if constexpr (std::is_unsigned<T>())
+			{
+				const __m256i t = tpa::simd::_mm256_mulhi_epu64(n, m);
+				return _mm256_srl_epi64(_mm256_add_epi64(t, _mm256_srl_epi64(_mm256_sub_epi64(n, t), s1)), s2);
+			}//End if
+			else
+			{
+				const __m256i sign = _mm256_set1_epi64x(static_cast<int64_t>(d.sign));
+				const __m256i n_sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), n);
+				const __m256i msb = _mm256_srl_epi64(_mm256_set1_epi64x(static_cast<int64_t>(0x8000000000000000ull)), s2);
+
+				__m256i q = _mm256_add_epi64(n, tpa::simd::_mm256_mulhi_epi64(n, m));
+				//Arithmetic shift right emulated with a logical shift
+				q = _mm256_sub_epi64(_mm256_xor_si256(_mm256_srl_epi64(q, s2), msb), msb);
+				q = _mm256_sub_epi64(q, n_sign);
+				return _mm256_sub_epi64(_mm256_xor_si256(q, sign), sign);
+			}//End else
+		}//End else
+	}//End of _mm256_div_magic
+
+	///<summary>
+	///<para> Computes the remainder of packed integers in 'n' divided by a precomputed tpa::simd::int_divider using AVX2</para>
+	///<para>Replaces _mm256_rem_epi8 ... _mm256_rem_epu64 (SVML) when the divisor is the same for every lane.</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX2.</para>
+	///</summary>
+	/// <param name="n"></param>
+	/// <param name="d"></param>
+	/// <returns>__m256i</returns>
+	template<typename T>
+	[[nodiscard]] TPA_TARGET_AVX2 inline __m256i _mm256_rem_magic(const __m256i& n, const tpa::simd::int_divider<T>& d) noexcept
+	{
+		const __m256i q = tpa::simd::_mm256_div_magic(n, d);
+
+		if constexpr (sizeof(T) == 1)
+		{
+			//Quotient * divisor fits in the low byte of a 16-bit product
+			const __m256i dv = _mm256_set1_epi16(static_cast<int16_t>(static_cast<uint8_t>(d.divisor)));
+			const __m256i lo_mask = _mm256_set1_epi16(0x00FF);
+			const __m256i p_even = _mm256_and_si256(_mm256_mullo_epi16(q, dv), lo_mask);
+			const __m256i p_odd = _mm256_slli_epi16(_mm256_mullo_epi16(_mm256_srli_epi16(q, 8), dv), 8);
+			return _mm256_sub_epi8(n, _mm256_or_si256(p_even, p_odd));
+		}//End if
+		else if constexpr (sizeof(T) == 2)
+		{
+			return _mm256_sub_epi16(n, _mm256_mullo_epi16(q, _mm256_set1_epi16(static_cast<int16_t>(d.divisor))));
+		}//End if
+		else if constexpr (sizeof(T) == 4)
+		{
+			return _mm256_sub_epi32(n, _mm256_mullo_epi32(q, _mm256_set1_epi32(static_cast<int32_t>(d.divisor))));
+		}//End if
+		else
+		{
+			return _mm256_sub_epi64(n, tpa::simd::_mm256_mul_epi64(q, _mm256_set1_epi64x(static_cast<int64_t>(d.divisor))));
+		}//End else
+	}//End of _mm256_rem_magic
+
+	///<summary>
+	///<para> Divide packed integers in 'n' by a precomputed tpa::simd::int_divider using AVX-512</para>
+	///<para>The element width and signedness are taken from the divider, 8-bit lanes are widened to 16-bit internally.</para>
+	///<para>Replaces _mm512_div_epi8 ... _mm512_div_epu64 (SVML) when the divisor is the same for every lane.</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX-512F, 8 and 16-bit types also require AVX-512BW.</para>
+	///</summary>
+	/// <param name="n"></param>
+	/// <param name="d"></param>
+	/// <returns>__m512i</returns>
+	template<typename T>
+	[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_div_magic(const __m512i& n, const tpa::simd::int_divider<T>& d) noexcept
+	{
+		const __m128i s1 = _mm_cvtsi32_si128(static_cast<int>(d.shift1));
+		const __m128i s2 = _mm_cvtsi32_si128(static_cast<int>(d.shift2));
+
+		if constexpr (sizeof(T) == 1)
+		{
+			const __m512i m = _mm512_set1_epi16(static_cast<int16_t>(d.magic));
+
+			if constexpr (std::is_unsigned<T>())
+			{
+				const __m512i zero = _mm512_setzero_si512();
+				__m512i lo = _mm512_unpacklo_epi8(n, zero);
+				__m512i hi = _mm512_unpackhi_epi8(n, zero);
+				__m512i t_lo = _mm512_srli_epi16(_mm512_mullo_epi16(lo, m), 8);
+				__m512i t_hi = _mm512_srli_epi16(_mm512_mullo_epi16(hi, m), 8);
+
+				lo = _mm512_srl_epi16(_mm512_add_epi16(t_lo, _mm512_srl_epi16(_mm512_sub_epi16(lo, t_lo), s1)), s2);
+				hi = _mm512_srl_epi16(_mm512_add_epi16(t_hi, _mm512_srl_epi16(_mm512_sub_epi16(hi, t_hi), s1)), s2);
+
+				return _mm512_packus_epi16(lo, hi);
+			}//End if
+			else
+			{
+				const __m512i sign = _mm512_set1_epi16(static_cast<int16_t>(d.sign));
+				__m512i lo = _mm512_srai_epi16(_mm512_unpacklo_epi8(n, n), 8);
+				__m512i hi = _mm512_srai_epi16(_mm512_unpackhi_epi8(n, n), 8);
+
+				lo = _mm512_sub_epi16(_mm512_sra_epi16(_mm512_add_epi16(lo, _mm512_srai_epi16(_mm512_mullo_epi16(lo, m), 8)), s2), _mm512_srai_epi16(lo, 15));
+				hi = _mm512_sub_epi16(_mm512_sra_epi16(_mm512_add_epi16(hi, _mm512_srai_epi16(_mm512_mullo_epi16(hi, m), 8)), s2), _mm512_srai_epi16(hi, 15));
+
+				lo = _mm512_sub_epi16(_mm512_xor_si512(lo, sign), sign);
+				hi = _mm512_sub_epi16(_mm512_xor_si512(hi, sign), sign);
+
+				return _mm512_packs_epi16(lo, hi);
+			}//End else
+		}//End if
+		else if constexpr (sizeof(T) == 2)
+		{
+			const __m512i m = _mm512_set1_epi16(static_cast<int16_t>(d.magic));
+
+			if constexpr (std::is_unsigned<T>())
+			{
+				const __m512i t = _mm512_mulhi_epu16(n, m);
+				return _mm512_srl_epi16(_mm512_add_epi16(t, _mm512_srl_epi16(_mm512_sub_epi16(n, t), s1)), s2);
+			}//End if
+			else
+			{
+				const __m512i sign = _mm512_set1_epi16(static_cast<int16_t>(d.sign));
+				__m512i q = _mm512_add_epi16(n, _mm512_mulhi_epi16(n, m));
+				q = _mm512_sub_epi16(_mm512_sra_epi16(q, s2), _mm512_srai_epi16(n, 15));
+				return _mm512_sub_epi16(_mm512_xor_si512(q, sign), sign);
+			}//End else
+		}//End if
+		else if constexpr (sizeof(T) == 4)
+		{
+			const __m512i m = _mm512_set1_epi32(static_cast<int32_t>(d.magic));
+
+			if constexpr (std::is_unsigned<T>())
+			{
+				const __m512i t = tpa::simd::_mm512_mulhi_epu32(n, m);
+				return _mm512_srl_epi32(_mm512_add_epi32(t, _mm512_srl_epi32(_mm512_sub_epi32(n, t), s1)), s2);
+			}//End if
+			else
+			{
+				const __m512i sign = _mm512_set1_epi32(static_cast<int32_t>(d.sign));
+				__m512i q = _mm512_add_epi32(n, tpa::simd::_mm512_mulhi_epi32(n, m));
+				q = _mm512_sub_epi32(_mm512_sra_epi32(q, s2), _mm512_srai_epi32(n, 31));
+				return _mm512_sub_epi32(_mm512_xor_si512(q, sign), sign);
+			}//End else
+		}//End if
+		else
+		{
+			const __m512i m = _mm512_set1_epi64(static_cast<int64_t>(d.magic));
+
+			if constexpr (std::is_unsigned<T>())
+			{
+				const __m512i t = tpa::simd::_mm512_mulhi_epu64(n, m);
+				return _mm512_srl_epi64(_mm512_add_epi64(t, _mm512_srl_epi64(_mm512_sub_epi64(n, t), s1)), s2);
+			}//End if
+			else
+			{
+				const __m512i sign = _mm512_set1_epi64(static_cast<int64_t>(d.sign));
+				__m512i q = _mm512_add_epi64(n, tpa::simd::_mm512_mulhi_epi64(n, m));
+				q = _mm512_sub_epi64(_mm512_sra_epi64(q, s2), _mm512_srai_epi64(n, 63));
+				return _mm512_sub_epi64(_mm512_xor_si512(q, sign), sign);
+			}//End else
+		}//End else
+	}//End of _mm512_div_magic
+
+	///<summary>
+	///<para> Computes the remainder of packed integers in 'n' divided by a precomputed tpa::simd::int_divider using AVX-512</para>
+	///<para>Replaces _mm512_rem_epi8 ... _mm512_rem_epu64 (SVML) when the divisor is the same for every lane.</para>
+	///<para>Note: This is not a hardware intrinsic, it is a function consisting of several instructions.</para>
+	///<para>Note: This function is a part of TPA and is not available by default within 'immintrin.h' or SVML.</para>
+	/// <para>Warning: This function is unsafe if called on a platform without AVX-512F, 8 and 16-bit types also require AVX-512BW.</para>
+	///</summary>
+	/// <param name="n"></param>
+	/// <param name="d"></param>
+	/// <returns>__m512i</returns>
+	template<typename T>
+	[[nodiscard]] TPA_TARGET_AVX512 inline __m512i _mm512_rem_magic(const __m512i& n, const tpa::simd::int_divider<T>& d) noexcept
+	{
+		const __m512i q = tpa::simd::_mm512_div_magic(n, d);
+
+		if constexpr (sizeof(T) == 1)
+		{
+			//Quotient * divisor fits in the low byte of a 16-bit product
+			const __m512i dv = _mm512_set1_epi16(static_cast<int16_t>(static_cast<uint8_t>(d.divisor)));
+			const __m512i lo_mask = _mm512_set1_epi16(0x00FF);
+			const __m512i p_even = _mm512_and_si512(_mm512_mullo_epi16(q, dv), lo_mask);
+			const __m512i p_odd = _mm512_slli_epi16(_mm512_mullo_epi16(_mm512_srli_epi16(q, 8), dv), 8);
+			return _mm512_sub_epi8(n, _mm512_or_si512(p_even, p_odd));
+		}//End if
+		else if constexpr (sizeof(T) == 2)
+		{
+			return _mm512_sub_epi16(n, _mm512_mullo_epi16(q, _mm512_set1_epi16(static_cast<int16_t>(d.divisor))));
+		}//End if
+		else if constexpr (sizeof(T) == 4)
+		{
+			return _mm512_sub_epi32(n, _mm512_mullo_epi32(q, _mm512_set1_epi32(static_cast<int32_t>(d.divisor))));
+		}//End if
+		else
+		{
+			return _mm512_sub_epi64(n, _mm512_mullox_epi64(q, _mm512_set1_epi64(static_cast<int64_t>(d.divisor))));
+		}//End else
+	}//End of _mm512_rem_magic
 #endif
 #pragma endregion
 };
@@ -39,6 +39,9 @@
 #include "../tpa_concepts.hpp"
 #include "../InstructionSet.hpp"
 #include "simd.hpp"
+#include "vec.hpp"
+#include "../algorithm/sort.hpp"
+#include "../algorithm/is_sorted.hpp"
 
 #ifdef _M_AMD64
 #include <immintrin.h>
@@ -159,10 +162,10 @@ namespace tpa {
 
                                 for (; (i + 128uz) < end; i += 128uz)
                                 {
-                                    _a = _mm256_load_si256((__m256i*) &arr[i]);
-                                    _b = _mm256_load_si256((__m256i*) &arr[i + 32uz]);
-                                    _c = _mm256_load_si256((__m256i*) &arr[i + 64uz]);
-                                    _d = _mm256_load_si256((__m256i*) &arr[i + 96uz]);
+                                    _a = _mm256_loadu_si256((__m256i*) &arr[i]);
+                                    _b = _mm256_loadu_si256((__m256i*) &arr[i + 32uz]);
+                                    _c = _mm256_loadu_si256((__m256i*) &arr[i + 64uz]);
+                                    _d = _mm256_loadu_si256((__m256i*) &arr[i + 96uz]);
 
                                     _sum = _mm256_add_epi8(_a, _b);
                                     _sum = _mm256_add_epi8(_sum, _c);
@@ -185,10 +188,10 @@ namespace tpa {
 
                                 for (; (i + 64uz) < end; i += 64uz)
                                 {
-                                    _a = _mm_load_si128((__m128i*) &arr[i]);
-                                    _b = _mm_load_si128((__m128i*) &arr[i + 16uz]);
-                                    _c = _mm_load_si128((__m128i*) &arr[i + 32uz]);
-                                    _d = _mm_load_si128((__m128i*) &arr[i + 48uz]);
+                                    _a = _mm_loadu_si128((__m128i*) &arr[i]);
+                                    _b = _mm_loadu_si128((__m128i*) &arr[i + 16uz]);
+                                    _c = _mm_loadu_si128((__m128i*) &arr[i + 32uz]);
+                                    _d = _mm_loadu_si128((__m128i*) &arr[i + 48uz]);
 
                                     _sum = _mm_add_epi8(_a, _b);
                                     _sum = _mm_add_epi8(_sum, _c);
@@ -247,10 +250,10 @@ namespace tpa {
 
                             for (; (i + 128uz) < end; i += 128uz)
                             {
-                                _a = _mm256_load_si256((__m256i*) & arr[i]);
-                                _b = _mm256_load_si256((__m256i*) & arr[i + 32uz]);
-                                _c = _mm256_load_si256((__m256i*) & arr[i + 64uz]);
-                                _d = _mm256_load_si256((__m256i*) & arr[i + 96uz]);
+                                _a = _mm256_loadu_si256((__m256i*) & arr[i]);
+                                _b = _mm256_loadu_si256((__m256i*) & arr[i + 32uz]);
+                                _c = _mm256_loadu_si256((__m256i*) & arr[i + 64uz]);
+                                _d = _mm256_loadu_si256((__m256i*) & arr[i + 96uz]);
 
                                 _sum = _mm256_add_epi8(_a, _b);
                                 _sum = _mm256_add_epi8(_sum, _c);
@@ -273,10 +276,10 @@ namespace tpa {
 
                             for (; (i + 64uz) < end; i += 64uz)
                             {
-                                _a = _mm_load_si128((__m128i*) & arr[i]);
-                                _b = _mm_load_si128((__m128i*) & arr[i + 16uz]);
-                                _c = _mm_load_si128((__m128i*) & arr[i + 32uz]);
-                                _d = _mm_load_si128((__m128i*) & arr[i + 48uz]);
+                                _a = _mm_loadu_si128((__m128i*) & arr[i]);
+                                _b = _mm_loadu_si128((__m128i*) & arr[i + 16uz]);
+                                _c = _mm_loadu_si128((__m128i*) & arr[i + 32uz]);
+                                _d = _mm_loadu_si128((__m128i*) & arr[i + 48uz]);
 
                                 _sum = _mm_add_epi8(_a, _b);
                                 _sum = _mm_add_epi8(_sum, _c);
@@ -335,10 +338,10 @@ namespace tpa {
 
                             for (; (i + 64uz) < end; i += 64uz)
                             {
-                                _a = _mm256_load_si256((__m256i*) & arr[i]);
-                                _b = _mm256_load_si256((__m256i*) & arr[i + 16uz]);
-                                _c = _mm256_load_si256((__m256i*) & arr[i + 32uz]);
-                                _d = _mm256_load_si256((__m256i*) & arr[i + 48uz]);
+                                _a = _mm256_loadu_si256((__m256i*) & arr[i]);
+                                _b = _mm256_loadu_si256((__m256i*) & arr[i + 16uz]);
+                                _c = _mm256_loadu_si256((__m256i*) & arr[i + 32uz]);
+                                _d = _mm256_loadu_si256((__m256i*) & arr[i + 48uz]);
 
                                 _sum = _mm256_add_epi16(_a, _b);
                                 _sum = _mm256_add_epi16(_sum, _c);
@@ -361,10 +364,10 @@ namespace tpa {
 
                             for (; (i + 32uz) < end; i += 32uz)
                             {
-                                _a = _mm_load_si128((__m128i*) & arr[i]);
-                                _b = _mm_load_si128((__m128i*) & arr[i + 8uz]);
-                                _c = _mm_load_si128((__m128i*) & arr[i + 16uz]);
-                                _d = _mm_load_si128((__m128i*) & arr[i + 24uz]);
+                                _a = _mm_loadu_si128((__m128i*) & arr[i]);
+                                _b = _mm_loadu_si128((__m128i*) & arr[i + 8uz]);
+                                _c = _mm_loadu_si128((__m128i*) & arr[i + 16uz]);
+                                _d = _mm_loadu_si128((__m128i*) & arr[i + 24uz]);
 
                                 _sum = _mm_add_epi16(_a, _b);
                                 _sum = _mm_add_epi16(_sum, _c);
@@ -423,10 +426,10 @@ namespace tpa {
 
                             for (; (i + 64uz) < end; i += 64uz)
                             {
-                                _a = _mm256_load_si256((__m256i*) & arr[i]);
-                                _b = _mm256_load_si256((__m256i*) & arr[i + 16uz]);
-                                _c = _mm256_load_si256((__m256i*) & arr[i + 32uz]);
-                                _d = _mm256_load_si256((__m256i*) & arr[i + 48uz]);
+                                _a = _mm256_loadu_si256((__m256i*) & arr[i]);
+                                _b = _mm256_loadu_si256((__m256i*) & arr[i + 16uz]);
+                                _c = _mm256_loadu_si256((__m256i*) & arr[i + 32uz]);
+                                _d = _mm256_loadu_si256((__m256i*) & arr[i + 48uz]);
 
                                 _sum = _mm256_add_epi16(_a, _b);
                                 _sum = _mm256_add_epi16(_sum, _c);
@@ -449,10 +452,10 @@ namespace tpa {
 
                             for (; (i + 32uz) < end; i += 32uz)
                             {
-                                _a = _mm_load_si128((__m128i*) & arr[i]);
-                                _b = _mm_load_si128((__m128i*) & arr[i + 8uz]);
-                                _c = _mm_load_si128((__m128i*) & arr[i + 16uz]);
-                                _d = _mm_load_si128((__m128i*) & arr[i + 24uz]);
+                                _a = _mm_loadu_si128((__m128i*) & arr[i]);
+                                _b = _mm_loadu_si128((__m128i*) & arr[i + 8uz]);
+                                _c = _mm_loadu_si128((__m128i*) & arr[i + 16uz]);
+                                _d = _mm_loadu_si128((__m128i*) & arr[i + 24uz]);
 
                                 _sum = _mm_add_epi16(_a, _b);
                                 _sum = _mm_add_epi16(_sum, _c);
@@ -485,10 +488,10 @@ namespace tpa {
 
                             for (; (i + 64uz) < end; i += 64uz)
                             {
-                                _a = _mm512_load_epi32(&arr[i]);
-                                _b = _mm512_load_epi32(&arr[i + 16uz]);
-                                _c = _mm512_load_epi32(&arr[i + 32uz]);
-                                _d = _mm512_load_epi32(&arr[i + 48uz]);
+                                _a = _mm512_loadu_epi32(&arr[i]);
+                                _b = _mm512_loadu_epi32(&arr[i + 16uz]);
+                                _c = _mm512_loadu_epi32(&arr[i + 32uz]);
+                                _d = _mm512_loadu_epi32(&arr[i + 48uz]);
 
                                 _sum = _mm512_add_epi32(_a, _b);
                                 _sum = _mm512_add_epi32(_sum, _c);
@@ -511,10 +514,10 @@ namespace tpa {
 
                             for (; (i + 32uz) < end; i += 32uz)
                             {
-                                _a = _mm256_load_si256((__m256i*) & arr[i]);
-                                _b = _mm256_load_si256((__m256i*) & arr[i + 8uz]);
-                                _c = _mm256_load_si256((__m256i*) & arr[i + 16uz]);
-                                _d = _mm256_load_si256((__m256i*) & arr[i + 24uz]);
+                                _a = _mm256_loadu_si256((__m256i*) & arr[i]);
+                                _b = _mm256_loadu_si256((__m256i*) & arr[i + 8uz]);
+                                _c = _mm256_loadu_si256((__m256i*) & arr[i + 16uz]);
+                                _d = _mm256_loadu_si256((__m256i*) & arr[i + 24uz]);
 
                                 _sum = _mm256_add_epi32(_a, _b);
                                 _sum = _mm256_add_epi32(_sum, _c);
@@ -537,10 +540,10 @@ namespace tpa {
 
                             for (; (i + 16uz) < end; i += 16uz)
                             {
-                                _a = _mm_load_si128((__m128i*) & arr[i]);
-                                _b = _mm_load_si128((__m128i*) & arr[i + 4uz]);
-                                _c = _mm_load_si128((__m128i*) & arr[i + 8uz]);
-                                _d = _mm_load_si128((__m128i*) & arr[i + 12uz]);
+                                _a = _mm_loadu_si128((__m128i*) & arr[i]);
+                                _b = _mm_loadu_si128((__m128i*) & arr[i + 4uz]);
+                                _c = _mm_loadu_si128((__m128i*) & arr[i + 8uz]);
+                                _d = _mm_loadu_si128((__m128i*) & arr[i + 12uz]);
 
                                 _sum = _mm_add_epi32(_a, _b);
                                 _sum = _mm_add_epi32(_sum, _c);
@@ -573,10 +576,10 @@ namespace tpa {
 
                             for (; (i + 64uz) < end; i += 64uz)
                             {
-                                _a = _mm512_load_epi32(&arr[i]);
-                                _b = _mm512_load_epi32(&arr[i + 16uz]);
-                                _c = _mm512_load_epi32(&arr[i + 32uz]);
-                                _d = _mm512_load_epi32(&arr[i + 48uz]);
+                                _a = _mm512_loadu_epi32(&arr[i]);
+                                _b = _mm512_loadu_epi32(&arr[i + 16uz]);
+                                _c = _mm512_loadu_epi32(&arr[i + 32uz]);
+                                _d = _mm512_loadu_epi32(&arr[i + 48uz]);
 
                                 _sum = _mm512_add_epi32(_a, _b);
                                 _sum = _mm512_add_epi32(_sum, _c);
@@ -599,10 +602,10 @@ namespace tpa {
 
                             for (; (i + 32uz) < end; i += 32uz)
                             {
-                                _a = _mm256_load_si256((__m256i*) & arr[i]);
-                                _b = _mm256_load_si256((__m256i*) & arr[i + 8uz]);
-                                _c = _mm256_load_si256((__m256i*) & arr[i + 16uz]);
-                                _d = _mm256_load_si256((__m256i*) & arr[i + 24uz]);
+                                _a = _mm256_loadu_si256((__m256i*) & arr[i]);
+                                _b = _mm256_loadu_si256((__m256i*) & arr[i + 8uz]);
+                                _c = _mm256_loadu_si256((__m256i*) & arr[i + 16uz]);
+                                _d = _mm256_loadu_si256((__m256i*) & arr[i + 24uz]);
 
                                 _sum = _mm256_add_epi32(_a, _b);
                                 _sum = _mm256_add_epi32(_sum, _c);
@@ -625,10 +628,10 @@ namespace tpa {
 
                             for (; (i + 16uz) < end; i += 16uz)
                             {
-                                _a = _mm_load_si128((__m128i*) & arr[i]);
-                                _b = _mm_load_si128((__m128i*) & arr[i + 4uz]);
-                                _c = _mm_load_si128((__m128i*) & arr[i + 8uz]);
-                                _d = _mm_load_si128((__m128i*) & arr[i + 12uz]);
+                                _a = _mm_loadu_si128((__m128i*) & arr[i]);
+                                _b = _mm_loadu_si128((__m128i*) & arr[i + 4uz]);
+                                _c = _mm_loadu_si128((__m128i*) & arr[i + 8uz]);
+                                _d = _mm_loadu_si128((__m128i*) & arr[i + 12uz]);
 
                                 _sum = _mm_add_epi32(_a, _b);
                                 _sum = _mm_add_epi32(_sum, _c);
@@ -661,10 +664,10 @@ namespace tpa {
 
                             for (; (i + 32uz) < end; i += 32uz)
                             {
-                                _a = _mm512_load_epi64(&arr[i]);
-                                _b = _mm512_load_epi64(&arr[i + 8uz]);
-                                _c = _mm512_load_epi64(&arr[i + 16uz]);
-                                _d = _mm512_load_epi64(&arr[i + 24uz]);
+                                _a = _mm512_loadu_epi64(&arr[i]);
+                                _b = _mm512_loadu_epi64(&arr[i + 8uz]);
+                                _c = _mm512_loadu_epi64(&arr[i + 16uz]);
+                                _d = _mm512_loadu_epi64(&arr[i + 24uz]);
 
                                 _sum = _mm512_add_epi64(_a, _b);
                                 _sum = _mm512_add_epi64(_sum, _c);
@@ -687,10 +690,10 @@ namespace tpa {
 
                             for (; (i + 16uz) < end; i += 16uz)
                             {
-                                _a = _mm256_load_si256((__m256i*) & arr[i]);
-                                _b = _mm256_load_si256((__m256i*) & arr[i + 4uz]);
-                                _c = _mm256_load_si256((__m256i*) & arr[i + 8uz]);
-                                _d = _mm256_load_si256((__m256i*) & arr[i + 12uz]);
+                                _a = _mm256_loadu_si256((__m256i*) & arr[i]);
+                                _b = _mm256_loadu_si256((__m256i*) & arr[i + 4uz]);
+                                _c = _mm256_loadu_si256((__m256i*) & arr[i + 8uz]);
+                                _d = _mm256_loadu_si256((__m256i*) & arr[i + 12uz]);
 
                                 _sum = _mm256_add_epi64(_a, _b);
                                 _sum = _mm256_add_epi64(_sum, _c);
@@ -713,10 +716,10 @@ namespace tpa {
 
                             for (; (i + 8uz) < end; i += 8uz)
                             {
-                                _a = _mm_load_si128((__m128i*) & arr[i]);
-                                _b = _mm_load_si128((__m128i*) & arr[i + 2uz]);
-                                _c = _mm_load_si128((__m128i*) & arr[i + 4uz]);
-                                _d = _mm_load_si128((__m128i*) & arr[i + 6uz]);
+                                _a = _mm_loadu_si128((__m128i*) & arr[i]);
+                                _b = _mm_loadu_si128((__m128i*) & arr[i + 2uz]);
+                                _c = _mm_loadu_si128((__m128i*) & arr[i + 4uz]);
+                                _d = _mm_loadu_si128((__m128i*) & arr[i + 6uz]);
 
                                 _sum = _mm_add_epi64(_a, _b);
                                 _sum = _mm_add_epi64(_sum, _c);
@@ -749,10 +752,10 @@ namespace tpa {
 
                             for (; (i + 32uz) < end; i += 32uz)
                             {
-                                _a = _mm512_load_epi64(&arr[i]);
-                                _b = _mm512_load_epi64(&arr[i + 8uz]);
-                                _c = _mm512_load_epi64(&arr[i + 16uz]);
-                                _d = _mm512_load_epi64(&arr[i + 24uz]);
+                                _a = _mm512_loadu_epi64(&arr[i]);
+                                _b = _mm512_loadu_epi64(&arr[i + 8uz]);
+                                _c = _mm512_loadu_epi64(&arr[i + 16uz]);
+                                _d = _mm512_loadu_epi64(&arr[i + 24uz]);
 
                                 _sum = _mm512_add_epi64(_a, _b);
                                 _sum = _mm512_add_epi64(_sum, _c);
@@ -775,10 +778,10 @@ namespace tpa {
 
                             for (; (i + 16uz) < end; i += 16uz)
                             {
-                                _a = _mm256_load_si256((__m256i*) & arr[i]);
-                                _b = _mm256_load_si256((__m256i*) & arr[i + 4uz]);
-                                _c = _mm256_load_si256((__m256i*) & arr[i + 8uz]);
-                                _d = _mm256_load_si256((__m256i*) & arr[i + 12uz]);
+                                _a = _mm256_loadu_si256((__m256i*) & arr[i]);
+                                _b = _mm256_loadu_si256((__m256i*) & arr[i + 4uz]);
+                                _c = _mm256_loadu_si256((__m256i*) & arr[i + 8uz]);
+                                _d = _mm256_loadu_si256((__m256i*) & arr[i + 12uz]);
 
                                 _sum = _mm256_add_epi64(_a, _b);
                                 _sum = _mm256_add_epi64(_sum, _c);
@@ -801,10 +804,10 @@ namespace tpa {
 
                             for (; (i + 8uz) < end; i += 8uz)
                             {
-                                _a = _mm_load_si128((__m128i*) & arr[i]);
-                                _b = _mm_load_si128((__m128i*) & arr[i + 2uz]);
-                                _c = _mm_load_si128((__m128i*) & arr[i + 4uz]);
-                                _d = _mm_load_si128((__m128i*) & arr[i + 6uz]);
+                                _a = _mm_loadu_si128((__m128i*) & arr[i]);
+                                _b = _mm_loadu_si128((__m128i*) & arr[i + 2uz]);
+                                _c = _mm_loadu_si128((__m128i*) & arr[i + 4uz]);
+                                _d = _mm_loadu_si128((__m128i*) & arr[i + 6uz]);
 
                                 _sum = _mm_add_epi64(_a, _b);
                                 _sum = _mm_add_epi64(_sum, _c);
@@ -837,10 +840,10 @@ namespace tpa {
 
                                     for (; (i + 64uz) < end; i += 64uz)
                                     {
-                                        _a = _mm512_load_ps(&arr[i]);
-                                        _b = _mm512_load_ps(&arr[i + 16uz]);
-                                        _c = _mm512_load_ps(&arr[i + 32uz]);
-                                        _d = _mm512_load_ps(&arr[i + 48uz]);
+                                        _a = _mm512_loadu_ps(&arr[i]);
+                                        _b = _mm512_loadu_ps(&arr[i + 16uz]);
+                                        _c = _mm512_loadu_ps(&arr[i + 32uz]);
+                                        _d = _mm512_loadu_ps(&arr[i + 48uz]);
 
                                         _sum = _mm512_add_ps(_a, _b);
                                         _sum = _mm512_add_ps(_sum, _c);
@@ -863,10 +866,10 @@ namespace tpa {
 
                                     for (; (i + 32uz) < end; i += 32uz)
                                     {
-                                        _a = _mm256_load_ps(&arr[i]);
-                                        _b = _mm256_load_ps(&arr[i + 8uz]);
-                                        _c = _mm256_load_ps(&arr[i + 16uz]);
-                                        _d = _mm256_load_ps(&arr[i + 24uz]);
+                                        _a = _mm256_loadu_ps(&arr[i]);
+                                        _b = _mm256_loadu_ps(&arr[i + 8uz]);
+                                        _c = _mm256_loadu_ps(&arr[i + 16uz]);
+                                        _d = _mm256_loadu_ps(&arr[i + 24uz]);
 
                                         _sum = _mm256_add_ps(_a, _b);
                                         _sum = _mm256_add_ps(_sum, _c);
@@ -889,10 +892,10 @@ namespace tpa {
 
                                     for (; (i + 16uz) < end; i += 16uz)
                                     {
-                                        _a = _mm_load_ps(&arr[i]);
-                                        _b = _mm_load_ps(&arr[i + 4uz]);
-                                        _c = _mm_load_ps(&arr[i + 8uz]);
-                                        _d = _mm_load_ps(&arr[i + 12uz]);
+                                        _a = _mm_loadu_ps(&arr[i]);
+                                        _b = _mm_loadu_ps(&arr[i + 4uz]);
+                                        _c = _mm_loadu_ps(&arr[i + 8uz]);
+                                        _d = _mm_loadu_ps(&arr[i + 12uz]);
 
                                         _sum = _mm_add_ps(_a, _b);
                                         _sum = _mm_add_ps(_sum, _c);
@@ -925,10 +928,10 @@ namespace tpa {
 
                                 for (; (i + 32uz) < end; i += 32uz)
                                 {
-                                    _a = _mm512_load_pd(&arr[i]);
-                                    _b = _mm512_load_pd(&arr[i + 8uz]);
-                                    _c = _mm512_load_pd(&arr[i + 16uz]);
-                                    _d = _mm512_load_pd(&arr[i + 24uz]);
+                                    _a = _mm512_loadu_pd(&arr[i]);
+                                    _b = _mm512_loadu_pd(&arr[i + 8uz]);
+                                    _c = _mm512_loadu_pd(&arr[i + 16uz]);
+                                    _d = _mm512_loadu_pd(&arr[i + 24uz]);
 
                                     _sum = _mm512_add_pd(_a, _b);
                                     _sum = _mm512_add_pd(_sum, _c);
@@ -951,10 +954,10 @@ namespace tpa {
 
                                 for (; (i + 16uz) < end; i += 16uz)
                                 {
-                                    _a = _mm256_load_pd(&arr[i]);
-                                    _b = _mm256_load_pd(&arr[i + 4uz]);
-                                    _c = _mm256_load_pd(&arr[i + 8uz]);
-                                    _d = _mm256_load_pd(&arr[i + 12uz]);
+                                    _a = _mm256_loadu_pd(&arr[i]);
+                                    _b = _mm256_loadu_pd(&arr[i + 4uz]);
+                                    _c = _mm256_loadu_pd(&arr[i + 8uz]);
+                                    _d = _mm256_loadu_pd(&arr[i + 12uz]);
 
                                     _sum = _mm256_add_pd(_a, _b);
                                     _sum = _mm256_add_pd(_sum, _c);
@@ -977,10 +980,10 @@ namespace tpa {
 
                                 for (; (i + 8uz) < end; i += 8uz)
                                 {
-                                    _a = _mm_load_pd(&arr[i]);
-                                    _b = _mm_load_pd(&arr[i + 2uz]);
-                                    _c = _mm_load_pd(&arr[i + 4uz]);
-                                    _d = _mm_load_pd(&arr[i + 6uz]);
+                                    _a = _mm_loadu_pd(&arr[i]);
+                                    _b = _mm_loadu_pd(&arr[i + 2uz]);
+                                    _c = _mm_loadu_pd(&arr[i + 4uz]);
+                                    _d = _mm_loadu_pd(&arr[i + 6uz]);
 
                                     _sum = _mm_add_pd(_a, _b);
                                     _sum = _mm_add_pd(_sum, _c);
@@ -1100,7 +1103,14 @@ namespace tpa {
 
             static_assert(tpa::util::calculatable<T>, "Error in tpa::stat::median! The value_type of this container does not meet the requirements of tpa::util::calculatable! ");
 
-            if (!std::is_sorted(std::execution::par_unseq, arr.cbegin(), arr.cend()))
+            if constexpr (tpa::simd::is_vec_type<T>)
+            {
+                if (!tpa::is_sorted(arr))
+                {
+                    tpa::sort(arr);
+                }//End if
+            }//End if
+            else if (!std::is_sorted(std::execution::par_unseq, arr.cbegin(), arr.cend()))
             {
                 std::sort(std::execution::par_unseq, arr.begin(), arr.end());
             }//End if
@@ -101,9 +101,11 @@ namespace tpa{
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::trigonometry: " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::trigonometry will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
@@ -134,7 +136,7 @@ namespace tpa{
 								for (; (i + 16) < end; i += 16)
 								{
 									//Set Values
-									_nums = _mm512_load_epi32(&source[i]);
+									_nums = _mm512_loadu_epi32(&source[i]);
 									_source = _mm512_cvtepi32_ps(_nums);
 									_dest = _mm512_setzero_ps();
 
@@ -303,7 +305,7 @@ namespace tpa{
 									}//End else
 
 									//Store Result
-									_mm512_store_ps(&dest[i], _dest);
+									_mm512_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 							else if (tpa::hasAVX)
@@ -314,7 +316,7 @@ namespace tpa{
 								for (; (i + 8) < end; i += 8)
 								{
 									//Set Values
-									_nums = _mm256_load_si256((__m256i*)&source[i]);
+									_nums = _mm256_loadu_si256((__m256i*)&source[i]);
 									_source = _mm256_cvtepi32_ps(_nums);
 									_dest = _mm256_setzero_ps();
 
@@ -483,7 +485,7 @@ namespace tpa{
 									}//End else
 
 									//Store Result									
-									_mm256_store_ps(& dest[i], _dest);
+									_mm256_storeu_ps(& dest[i], _dest);
 
 								}//End for
 							}//End if hasAVX
@@ -495,7 +497,7 @@ namespace tpa{
 								for (; (i + 4) < end; i += 4)
 								{
 									//Set Values
-									_nums = _mm_load_si128((__m128i*)&source[i]);
+									_nums = _mm_loadu_si128((__m128i*)&source[i]);
 									_source = _mm_cvtepi32_ps(_nums);
 									_dest = _mm_setzero_ps();
 
@@ -664,7 +666,7 @@ namespace tpa{
 									}//End else
 
 									//Store Result									
-									_mm_store_ps(&dest[i], _dest);
+									_mm_storeu_ps(&dest[i], _dest);
 
 								}//End for
 							}//End if has_SSE
@@ -683,7 +685,7 @@ namespace tpa{
 								for (; (i + 16) < end; i += 16)
 								{
 									//Set Values
-									_nums = _mm512_load_epi32(&source[i]);
+									_nums = _mm512_loadu_epi32(&source[i]);
 									_source = _mm512_cvtepu32_ps(_nums);
 									_dest = _mm512_setzero_ps();
 
@@ -852,7 +854,7 @@ namespace tpa{
 									}//End else
 
 									//Store Result
-									_mm512_store_ps(&dest[i], _dest);
+									_mm512_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End if hasAVX512
 #endif
@@ -869,7 +871,7 @@ namespace tpa{
 							for (; (i+16) < end; i += 16)
 							{
 								//Set Values
-								_source = _mm512_load_ps(&source[i]);
+								_source = _mm512_loadu_ps(&source[i]);
 								_dest = _mm512_setzero_ps();
 
 								//Sine
@@ -1037,7 +1039,7 @@ namespace tpa{
 								}//End else
 
 								//Store Result
-								_mm512_store_ps(&dest[i], _dest);
+								_mm512_storeu_ps(&dest[i], _dest);
 							}//End for
 						}//End if hasAVX512
 						else if (tpa::hasAVX)
@@ -1047,7 +1049,7 @@ namespace tpa{
 							for (; (i+8) < end; i += 8)
 							{
 								//Set Values
-								_source = _mm256_load_ps(&source[i]);
+								_source = _mm256_loadu_ps(&source[i]);
 								_dest = _mm256_setzero_ps();
 
 								//Sine
@@ -1215,7 +1217,7 @@ namespace tpa{
 								}//End else
 
 								//Store Result
-								_mm256_store_ps(&dest[i], _dest);
+								_mm256_storeu_ps(&dest[i], _dest);
 							}//End for
 						}//End if hasAVX
 						else if (tpa::has_SSE)
@@ -1225,7 +1227,7 @@ namespace tpa{
 						for (; (i+4) < end; i += 4)
 						{
 							//Set Values
-							_source = _mm_load_ps(&source[i]);
+							_source = _mm_loadu_ps(&source[i]);
 							_dest = _mm_setzero_ps();
 
 							//Sine
@@ -1393,7 +1395,7 @@ namespace tpa{
 							}//End else
 
 							//Store Result
-							_mm_store_ps(&dest[i], _dest);
+							_mm_storeu_ps(&dest[i], _dest);
 						}//End for
 						}//End if has_SSE
 #endif						
@@ -1411,7 +1413,7 @@ namespace tpa{
 							for (; (i + 16) < end; i += 16)
 							{
 								//Set Values
-								_source = _mm512_load_ps(&source[i]);
+								_source = _mm512_loadu_ps(&source[i]);
 								_dest = _mm512_setzero_ps();
 
 								//Sine
@@ -1580,7 +1582,7 @@ namespace tpa{
 
 								//Store Result
 								_res = _mm512_cvt_roundps_epi32(_dest, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
-								_mm512_store_epi32(&dest[i], _res);
+								_mm512_storeu_epi32(&dest[i], _res);
 
 							}//End for
 						}//End if hasAVX512
@@ -1592,7 +1594,7 @@ namespace tpa{
 							for (; (i + 8) < end; i += 8)
 							{
 								//Set Values
-								_source = _mm256_load_ps(&source[i]);
+								_source = _mm256_loadu_ps(&source[i]);
 								_dest = _mm256_setzero_ps();
 
 								//Sine
@@ -1761,7 +1763,7 @@ namespace tpa{
 
 								//Store Result
 								_res = _mm256_cvtps_epi32(_mm256_round_ps(_dest, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
-								_mm256_store_si256((__m256i*)&dest[i], _res);
+								_mm256_storeu_si256((__m256i*)&dest[i], _res);
 
 							}//End for
 						}//End if hasAVX
@@ -1773,7 +1775,7 @@ namespace tpa{
 							for (; (i + 4) < end; i += 4)
 							{
 								//Set Values
-								_source = _mm_load_ps(&source[i]);
+								_source = _mm_loadu_ps(&source[i]);
 								_dest = _mm_setzero_ps();
 
 								//Sine
@@ -1942,7 +1944,7 @@ namespace tpa{
 
 								//Store Result
 								_res = _mm_cvtps_epi32(_mm_round_ps(_dest, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
-								_mm_store_si128((__m128i*)& dest[i], _res);
+								_mm_storeu_si128((__m128i*)& dest[i], _res);
 
 							}//End for
 						}//End if has_SSE
@@ -1961,7 +1963,7 @@ namespace tpa{
 						for (; (i + 16) < end; i += 16)
 						{
 							//Set Values
-							_source = _mm512_load_ps(&source[i]);
+							_source = _mm512_loadu_ps(&source[i]);
 							_dest = _mm512_setzero_ps();
 
 							//Sine
@@ -2130,7 +2132,7 @@ namespace tpa{
 
 							//Store Result
 							_res = _mm512_cvt_roundps_epu32(_dest, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
-							_mm512_store_epi32(&dest[i], _res);
+							_mm512_storeu_epi32(&dest[i], _res);
 
 						}//End for
 					}//End if hasAVX512
@@ -2148,7 +2150,7 @@ namespace tpa{
 							for (; (i+8) < end; i += 8)
 							{
 								//Set Values
-								_source = _mm512_load_pd(&source[i]);
+								_source = _mm512_loadu_pd(&source[i]);
 								_dest = _mm512_setzero_pd();
 
 								//Sine
@@ -2316,7 +2318,7 @@ namespace tpa{
 								}//End else
 
 								//Store Result
-								_mm512_store_pd(&dest[i], _dest);
+								_mm512_storeu_pd(&dest[i], _dest);
 							}//End for
 						}//End if hasAVX512
 						else if (tpa::hasAVX)
@@ -2326,7 +2328,7 @@ namespace tpa{
 							for (; (i+4) < end; i += 4)
 							{
 								//Set Values
-								_source = _mm256_load_pd(&source[i]);
+								_source = _mm256_loadu_pd(&source[i]);
 								_dest = _mm256_setzero_pd();
 
 								//Sine
@@ -2494,7 +2496,7 @@ namespace tpa{
 								}//End else
 
 								//Store Result
-								_mm256_store_pd(&dest[i], _dest);
+								_mm256_storeu_pd(&dest[i], _dest);
 							}//End for
 						}//End if hasAVX
 						else if (tpa::has_SSE2)
@@ -2504,7 +2506,7 @@ namespace tpa{
 						for (; (i+2) < end; i += 2)
 						{
 							//Set Values
-							_source = _mm_load_pd(&source[i]);
+							_source = _mm_loadu_pd(&source[i]);
 							_dest = _mm_setzero_pd();
 
 							//Sine
@@ -2672,7 +2674,7 @@ namespace tpa{
 							}//End else
 
 							//Store Result
-							_mm_store_pd(&dest[i], _dest);
+							_mm_storeu_pd(&dest[i], _dest);
 						}//End for
 						}//End if has_SSE2
 #endif						
@@ -2690,7 +2692,7 @@ namespace tpa{
 						for (; (i + 8) < end; i += 8)
 						{
 							//Set Values
-							_source = _mm512_load_pd(&source[i]);
+							_source = _mm512_loadu_pd(&source[i]);
 							_dest = _mm512_setzero_pd();
 
 							//Sine
@@ -2859,7 +2861,7 @@ namespace tpa{
 
 							//Store Result
 							_res = _mm512_cvt_roundpd_epi64(_dest, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
-							_mm512_store_epi64(&dest[i], _res);
+							_mm512_storeu_epi64(&dest[i], _res);
 
 						}//End for
 					}//End if hasAVX512
@@ -2878,7 +2880,7 @@ namespace tpa{
 						for (; (i + 8) < end; i += 8)
 						{
 							//Set Values
-							_source = _mm512_load_pd(&source[i]);
+							_source = _mm512_loadu_pd(&source[i]);
 							_dest = _mm512_setzero_pd();
 
 							//Sine
@@ -3047,7 +3049,7 @@ namespace tpa{
 
 							//Store Result
 							_res = _mm512_cvt_roundpd_epu64(_dest, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
-							_mm512_store_epi64(&dest[i], _res);
+							_mm512_storeu_epi64(&dest[i], _res);
 
 						}//End for
 					}//End if hasAVX512
@@ -3066,7 +3068,7 @@ namespace tpa{
 						for (; (i + 8) < end; i += 8)
 						{
 							//Set Values
-							_nums = _mm512_load_epi64(&source[i]);
+							_nums = _mm512_loadu_epi64(&source[i]);
 							_source = _mm512_cvtepi64_pd(_nums);
 							_dest = _mm512_setzero_pd();
 
@@ -3235,7 +3237,7 @@ namespace tpa{
 							}//End else
 
 							//Store Result							
-							_mm512_store_pd(&dest[i], _dest);
+							_mm512_storeu_pd(&dest[i], _dest);
 
 						}//End for
 					}//End if hasAVX512
@@ -3254,7 +3256,7 @@ namespace tpa{
 						for (; (i + 8) < end; i += 8)
 						{
 							//Set Values
-							_nums = _mm512_load_epi64(&source[i]);
+							_nums = _mm512_loadu_epi64(&source[i]);
 							_source = _mm512_cvtepu64_pd(_nums);
 							_dest = _mm512_setzero_pd();
 
@@ -3423,7 +3425,7 @@ namespace tpa{
 							}//End else
 
 							//Store Result							
-							_mm512_store_pd(&dest[i], _dest);
+							_mm512_storeu_pd(&dest[i], _dest);
 
 						}//End for
 					}//End if hasAVX512
@@ -3580,14 +3582,6 @@ namespace tpa{
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::trigonometry: " << ex.what() << "\n";
-			std::cerr << "tpa::simd::trigonometry will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -3644,9 +3638,11 @@ namespace tpa{
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::atan2: " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::atan2 will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
@@ -3676,8 +3672,8 @@ namespace tpa{
 							for (; (i + 16uz) < end; i += 16uz)
 							{
 								//Set Values
-								_source1 = _mm512_load_ps(&source1[i]);
-								_source2 = _mm512_load_ps(&source2[i]);
+								_source1 = _mm512_loadu_ps(&source1[i]);
+								_source2 = _mm512_loadu_ps(&source2[i]);
 								_dest = _mm512_setzero_ps();
 
 								//atan2
@@ -3701,7 +3697,7 @@ namespace tpa{
 								}//End else
 
 								//Store Result
-								_mm512_store_ps(&dest[i], _dest);
+								_mm512_storeu_ps(&dest[i], _dest);
 							}//End for
 						}//End of hasAVX512
 						else if (tpa::hasAVX)
@@ -3711,8 +3707,8 @@ namespace tpa{
 							for (; (i + 8uz) < end; i += 8uz)
 							{
 								//Set Values
-								_source1 = _mm256_load_ps(&source1[i]);
-								_source2 = _mm256_load_ps(&source2[i]);
+								_source1 = _mm256_loadu_ps(&source1[i]);
+								_source2 = _mm256_loadu_ps(&source2[i]);
 								_dest = _mm256_setzero_ps();
 
 								//atan2
@@ -3736,7 +3732,7 @@ namespace tpa{
 								}//End else
 
 								//Store Result
-								_mm256_store_ps(&dest[i], _dest);
+								_mm256_storeu_ps(&dest[i], _dest);
 							}//End for
 						}//End of hasAVX
 						else if (tpa::has_SSE)
@@ -3746,8 +3742,8 @@ namespace tpa{
 							for (; (i + 4uz) < end; i += 4uz)
 							{
 								//Set Values
-								_source1 = _mm_load_ps(&source1[i]);
-								_source2 = _mm_load_ps(&source2[i]);
+								_source1 = _mm_loadu_ps(&source1[i]);
+								_source2 = _mm_loadu_ps(&source2[i]);
 								_dest = _mm_setzero_ps();
 
 								//atan2
@@ -3771,7 +3767,7 @@ namespace tpa{
 								}//End else
 
 								//Store Result
-								_mm_store_ps(&dest[i], _dest);
+								_mm_storeu_ps(&dest[i], _dest);
 							}//End for
 						}//End of has_SSE
 #endif
@@ -3789,8 +3785,8 @@ namespace tpa{
 							for (; (i + 16uz) < end; i += 16uz)
 							{
 								//Set Values
-								_source1int = _mm512_load_epi32(&source1[i]);
-								_source2int = _mm512_load_epi32(&source2[i]);
+								_source1int = _mm512_loadu_epi32(&source1[i]);
+								_source2int = _mm512_loadu_epi32(&source2[i]);
 
 								_source1 = _mm512_cvtepi32_ps(_source1int);
 								_source2 = _mm512_cvtepi32_ps(_source2int);
@@ -3817,7 +3813,7 @@ namespace tpa{
 								}//End else
 
 								//Store Result
-								_mm512_store_ps(&dest[i], _dest);
+								_mm512_storeu_ps(&dest[i], _dest);
 							}//End for
 						}//End of hasAVX512
 						else if (tpa::hasAVX)
@@ -3828,8 +3824,8 @@ namespace tpa{
 							for (; (i + 8uz) < end; i += 8uz)
 							{
 								//Set Values
-								_source1int = _mm256_load_si256((__m256i*) &source1[i]);
-								_source2int = _mm256_load_si256((__m256i*) &source2[i]);
+								_source1int = _mm256_loadu_si256((__m256i*) &source1[i]);
+								_source2int = _mm256_loadu_si256((__m256i*) &source2[i]);
 
 								_source1 = _mm256_cvtepi32_ps(_source1int);
 								_source2 = _mm256_cvtepi32_ps(_source2int);
@@ -3856,7 +3852,7 @@ namespace tpa{
 								}//End else
 
 								//Store Result
-								_mm256_store_ps(&dest[i], _dest);
+								_mm256_storeu_ps(&dest[i], _dest);
 							}//End for
 						}//End of hasAVX
 						else if (tpa::has_SSE2)
@@ -3867,8 +3863,8 @@ namespace tpa{
 							for (; (i + 4uz) < end; i += 4uz)
 							{
 								//Set Values
-								_source1int = _mm_load_si128((__m128i*) &source1[i]);
-								_source2int = _mm_load_si128((__m128i*) &source2[i]);
+								_source1int = _mm_loadu_si128((__m128i*) &source1[i]);
+								_source2int = _mm_loadu_si128((__m128i*) &source2[i]);
 
 								_source1 = _mm_cvtepi32_ps(_source1int);
 								_source2 = _mm_cvtepi32_ps(_source2int);
@@ -3895,7 +3891,7 @@ namespace tpa{
 								}//End else
 
 								//Store Result
-								_mm_store_ps(&dest[i], _dest);
+								_mm_storeu_ps(&dest[i], _dest);
 							}//End for
 						}//End of has_SSE
 #endif
@@ -3913,8 +3909,8 @@ namespace tpa{
 						for (; (i + 16uz) < end; i += 16uz)
 						{
 							//Set Values
-							_source1int = _mm512_load_epi32(&source1[i]);
-							_source2int = _mm512_load_epi32(&source2[i]);
+							_source1int = _mm512_loadu_epi32(&source1[i]);
+							_source2int = _mm512_loadu_epi32(&source2[i]);
 
 							_source1 = _mm512_cvtepu32_ps(_source1int);
 							_source2 = _mm512_cvtepu32_ps(_source2int);
@@ -3941,7 +3937,7 @@ namespace tpa{
 							}//End else
 
 							//Store Result
-							_mm512_store_ps(&dest[i], _dest);
+							_mm512_storeu_ps(&dest[i], _dest);
 						}//End for
 					}//End of hasAVX512					
 #endif
@@ -3958,8 +3954,8 @@ namespace tpa{
 							for (; (i + 8uz) < end; i += 8uz)
 							{
 								//Set Values
-								_source1 = _mm512_load_pd(&source1[i]);
-								_source2 = _mm512_load_pd(&source2[i]);
+								_source1 = _mm512_loadu_pd(&source1[i]);
+								_source2 = _mm512_loadu_pd(&source2[i]);
 								_dest = _mm512_setzero_pd();
 
 								//atan2
@@ -3983,7 +3979,7 @@ namespace tpa{
 								}//End else
 
 								//Store Result
-								_mm512_store_pd(&dest[i], _dest);
+								_mm512_storeu_pd(&dest[i], _dest);
 							}//End for
 						}//End of hasAVX512
 						else if (tpa::hasAVX)
@@ -3993,8 +3989,8 @@ namespace tpa{
 							for (; (i + 4uz) < end; i += 4uz)
 							{
 								//Set Values
-								_source1 = _mm256_load_pd(&source1[i]);
-								_source2 = _mm256_load_pd(&source2[i]);
+								_source1 = _mm256_loadu_pd(&source1[i]);
+								_source2 = _mm256_loadu_pd(&source2[i]);
 								_dest = _mm256_setzero_pd();
 
 								//atan2
@@ -4018,7 +4014,7 @@ namespace tpa{
 								}//End else
 
 								//Store Result
-								_mm256_store_pd(&dest[i], _dest);
+								_mm256_storeu_pd(&dest[i], _dest);
 							}//End for
 						}//End of hasAVX
 						else if (tpa::has_SSE2)
@@ -4028,8 +4024,8 @@ namespace tpa{
 							for (; (i + 2uz) < end; i += 2uz)
 							{
 								//Set Values
-								_source1 = _mm_load_pd(&source1[i]);
-								_source2 = _mm_load_pd(&source2[i]);
+								_source1 = _mm_loadu_pd(&source1[i]);
+								_source2 = _mm_loadu_pd(&source2[i]);
 								_dest = _mm_setzero_pd();
 
 								//atan2
@@ -4053,7 +4049,7 @@ namespace tpa{
 								}//End else
 
 								//Store Result
-								_mm_store_pd(&dest[i], _dest);
+								_mm_storeu_pd(&dest[i], _dest);
 							}//End for
 						}//End of has_SSE
 #endif
@@ -4071,8 +4067,8 @@ namespace tpa{
 						for (; (i + 8uz) < end; i += 8uz)
 						{
 							//Set Values
-							_source1int = _mm512_load_epi64(&source1[i]);
-							_source2int = _mm512_load_epi64(&source2[i]);
+							_source1int = _mm512_loadu_epi64(&source1[i]);
+							_source2int = _mm512_loadu_epi64(&source2[i]);
 
 							_source1 = _mm512_cvtepi64_pd(_source1int);
 							_source2 = _mm512_cvtepi64_pd(_source2int);
@@ -4099,7 +4095,7 @@ namespace tpa{
 							}//End else
 
 							//Store Result
-							_mm512_store_pd(&dest[i], _dest);
+							_mm512_storeu_pd(&dest[i], _dest);
 						}//End for
 					}//End of hasAVX512					
 #endif
@@ -4117,8 +4113,8 @@ namespace tpa{
 						for (; (i + 8uz) < end; i += 8uz)
 						{
 							//Set Values
-							_source1int = _mm512_load_epi64(&source1[i]);
-							_source2int = _mm512_load_epi64(&source2[i]);
+							_source1int = _mm512_loadu_epi64(&source1[i]);
+							_source2int = _mm512_loadu_epi64(&source2[i]);
 
 							_source1 = _mm512_cvtepu64_pd(_source1int);
 							_source2 = _mm512_cvtepu64_pd(_source2int);
@@ -4145,7 +4141,7 @@ namespace tpa{
 							}//End else
 
 							//Store Result
-							_mm512_store_pd(&dest[i], _dest);
+							_mm512_storeu_pd(&dest[i], _dest);
 						}//End for
 					}//End of hasAVX512					
 #endif
@@ -4194,14 +4190,6 @@ namespace tpa{
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::atan2: " << ex.what() << "\n";
-			std::cerr << "tpa::simd::atan2 will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
@@ -4258,9 +4246,11 @@ namespace tpa{
 
 			if (dest.size() < smallest)
 			{
-				throw tpa::exceptions::ArrayTooSmall();
+				std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
+				std::cerr << "Exception thrown in tpa::simd::hypot: " << tpa::exceptions::ArrayTooSmall().what() << "\n";
+				std::cerr << "tpa::simd::hypot will execute upto the current size of the container.";
+				smallest = dest.size();
 			}//End if
-		recover:
 
 			std::vector<std::pair<size_t, size_t>> sections;
 			tpa::util::prepareThreading(sections, smallest);
@@ -4290,14 +4280,14 @@ namespace tpa{
 								for (; (i + 16uz) < end; i += 16uz)
 								{
 									//Set Values
-									_source1 = _mm512_load_ps(&source1[i]);
-									_source2 = _mm512_load_ps(&source2[i]);
+									_source1 = _mm512_loadu_ps(&source1[i]);
+									_source2 = _mm512_loadu_ps(&source2[i]);
 									
 									//hypot
 									_dest = _mm512_hypot_ps(_source1, _source2);
 
 									//Store Result
-									_mm512_store_ps(&dest[i], _dest);
+									_mm512_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End of hasAVX512
 							else if (tpa::hasAVX)
@@ -4307,14 +4297,14 @@ namespace tpa{
 								for (; (i + 8uz) < end; i += 8uz)
 								{
 									//Set Values
-									_source1 = _mm256_load_ps(&source1[i]);
-									_source2 = _mm256_load_ps(&source2[i]);
+									_source1 = _mm256_loadu_ps(&source1[i]);
+									_source2 = _mm256_loadu_ps(&source2[i]);
 									
 									//hypot
 									_dest = _mm256_hypot_ps(_source1, _source2);
 
 									//Store Result
-									_mm256_store_ps(&dest[i], _dest);
+									_mm256_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End of hasAVX
 							else if (tpa::has_SSE)
@@ -4324,14 +4314,14 @@ namespace tpa{
 								for (; (i + 4uz) < end; i += 4uz)
 								{
 									//Set Values
-									_source1 = _mm_load_ps(&source1[i]);
-									_source2 = _mm_load_ps(&source2[i]);
+									_source1 = _mm_loadu_ps(&source1[i]);
+									_source2 = _mm_loadu_ps(&source2[i]);
 									
 									//hypot
 									_dest = _mm_hypot_ps(_source1, _source2);
 
 									//Store Result
-									_mm_store_ps(&dest[i], _dest);
+									_mm_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End of has_SSE
 #endif
@@ -4349,8 +4339,8 @@ namespace tpa{
 								for (; (i + 16uz) < end; i += 16uz)
 								{
 									//Set Values
-									_source1int = _mm512_load_epi32(&source1[i]);
-									_source2int = _mm512_load_epi32(&source2[i]);
+									_source1int = _mm512_loadu_epi32(&source1[i]);
+									_source2int = _mm512_loadu_epi32(&source2[i]);
 
 									_source1 = _mm512_cvtepi32_ps(_source1int);
 									_source2 = _mm512_cvtepi32_ps(_source2int);
@@ -4360,7 +4350,7 @@ namespace tpa{
 									_dest = _mm512_hypot_ps(_source1, _source2);
 									
 									//Store Result
-									_mm512_store_ps(&dest[i], _dest);
+									_mm512_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End of hasAVX512
 							else if (tpa::hasAVX)
@@ -4371,8 +4361,8 @@ namespace tpa{
 								for (; (i + 8uz) < end; i += 8uz)
 								{
 									//Set Values
-									_source1int = _mm256_load_si256((__m256i*) & source1[i]);
-									_source2int = _mm256_load_si256((__m256i*) & source2[i]);
+									_source1int = _mm256_loadu_si256((__m256i*) & source1[i]);
+									_source2int = _mm256_loadu_si256((__m256i*) & source2[i]);
 
 									_source1 = _mm256_cvtepi32_ps(_source1int);
 									_source2 = _mm256_cvtepi32_ps(_source2int);
@@ -4382,7 +4372,7 @@ namespace tpa{
 									_dest = _mm256_hypot_ps(_source1, _source2);
 									
 									//Store Result
-									_mm256_store_ps(&dest[i], _dest);
+									_mm256_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End of hasAVX
 							else if (tpa::has_SSE2)
@@ -4393,8 +4383,8 @@ namespace tpa{
 								for (; (i + 4uz) < end; i += 4uz)
 								{
 									//Set Values
-									_source1int = _mm_load_si128((__m128i*) & source1[i]);
-									_source2int = _mm_load_si128((__m128i*) & source2[i]);
+									_source1int = _mm_loadu_si128((__m128i*) & source1[i]);
+									_source2int = _mm_loadu_si128((__m128i*) & source2[i]);
 
 									_source1 = _mm_cvtepi32_ps(_source1int);
 									_source2 = _mm_cvtepi32_ps(_source2int);
@@ -4404,7 +4394,7 @@ namespace tpa{
 									_dest = _mm_hypot_ps(_source1, _source2);
 									
 									//Store Result
-									_mm_store_ps(&dest[i], _dest);
+									_mm_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End of has_SSE
 #endif
@@ -4422,8 +4412,8 @@ namespace tpa{
 								for (; (i + 16uz) < end; i += 16uz)
 								{
 									//Set Values
-									_source1int = _mm512_load_epi32(&source1[i]);
-									_source2int = _mm512_load_epi32(&source2[i]);
+									_source1int = _mm512_loadu_epi32(&source1[i]);
+									_source2int = _mm512_loadu_epi32(&source2[i]);
 
 									_source1 = _mm512_cvtepu32_ps(_source1int);
 									_source2 = _mm512_cvtepu32_ps(_source2int);
@@ -4433,7 +4423,7 @@ namespace tpa{
 									_dest = _mm512_hypot_ps(_source1, _source2);
 									
 									//Store Result
-									_mm512_store_ps(&dest[i], _dest);
+									_mm512_storeu_ps(&dest[i], _dest);
 								}//End for
 							}//End of hasAVX512					
 #endif
@@ -4450,14 +4440,14 @@ namespace tpa{
 								for (; (i + 8uz) < end; i += 8uz)
 								{
 									//Set Values
-									_source1 = _mm512_load_pd(&source1[i]);
-									_source2 = _mm512_load_pd(&source2[i]);
+									_source1 = _mm512_loadu_pd(&source1[i]);
+									_source2 = _mm512_loadu_pd(&source2[i]);
 									
 									//hypot
 									_dest = _mm512_hypot_pd(_source1, _source2);
 
 									//Store Result
-									_mm512_store_pd(&dest[i], _dest);
+									_mm512_storeu_pd(&dest[i], _dest);
 								}//End for
 							}//End of hasAVX512
 							else if (tpa::hasAVX)
@@ -4467,14 +4457,14 @@ namespace tpa{
 								for (; (i + 4uz) < end; i += 4uz)
 								{
 									//Set Values
-									_source1 = _mm256_load_pd(&source1[i]);
-									_source2 = _mm256_load_pd(&source2[i]);
+									_source1 = _mm256_loadu_pd(&source1[i]);
+									_source2 = _mm256_loadu_pd(&source2[i]);
 									
 									//hypot
 									_dest = _mm256_hypot_pd(_source1, _source2);
 
 									//Store Result
-									_mm256_store_pd(&dest[i], _dest);
+									_mm256_storeu_pd(&dest[i], _dest);
 								}//End for
 							}//End of hasAVX
 							else if (tpa::has_SSE2)
@@ -4484,14 +4474,14 @@ namespace tpa{
 								for (; (i + 2uz) < end; i += 2uz)
 								{
 									//Set Values
-									_source1 = _mm_load_pd(&source1[i]);
-									_source2 = _mm_load_pd(&source2[i]);
+									_source1 = _mm_loadu_pd(&source1[i]);
+									_source2 = _mm_loadu_pd(&source2[i]);
 									
 									//hypot
 									_dest = _mm_hypot_pd(_source1, _source2);
 
 									//Store Result
-									_mm_store_pd(&dest[i], _dest);
+									_mm_storeu_pd(&dest[i], _dest);
 								}//End for
 							}//End of has_SSE2
 #endif
@@ -4509,8 +4499,8 @@ namespace tpa{
 						for (; (i + 8uz) < end; i += 8uz)
 						{
 							//Set Values
-							_source1int = _mm512_load_epi64(&source1[i]);
-							_source2int = _mm512_load_epi64(&source2[i]);
+							_source1int = _mm512_loadu_epi64(&source1[i]);
+							_source2int = _mm512_loadu_epi64(&source2[i]);
 
 							_source1 = _mm512_cvtepi64_pd(_source1int);
 							_source2 = _mm512_cvtepi64_pd(_source2int);
@@ -4520,7 +4510,7 @@ namespace tpa{
 							_dest = _mm512_hypot_pd(_source1, _source2);
 							
 							//Store Result
-							_mm512_store_pd(&dest[i], _dest);
+							_mm512_storeu_pd(&dest[i], _dest);
 						}//End for
 					}//End of hasAVX512					
 #endif
@@ -4538,8 +4528,8 @@ namespace tpa{
 						for (; (i + 8uz) < end; i += 8uz)
 						{
 							//Set Values
-							_source1int = _mm512_load_epi64(&source1[i]);
-							_source2int = _mm512_load_epi64(&source2[i]);
+							_source1int = _mm512_loadu_epi64(&source1[i]);
+							_source2int = _mm512_loadu_epi64(&source2[i]);
 
 							_source1 = _mm512_cvtepu64_pd(_source1int);
 							_source2 = _mm512_cvtepu64_pd(_source2int);
@@ -4549,7 +4539,7 @@ namespace tpa{
 							_dest = _mm512_hypot_pd(_source1, _source2);
 							
 							//Store Result
-							_mm512_store_pd(&dest[i], _dest);
+							_mm512_storeu_pd(&dest[i], _dest);
 						}//End for
 					}//End of hasAVX512					
 #endif
@@ -4580,14 +4570,6 @@ namespace tpa{
 			}//End if
 
 		}//End try
-		catch (const tpa::exceptions::ArrayTooSmall& ex)
-		{
-			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
-			std::cerr << "Exception thrown in tpa::simd::hypot: " << ex.what() << "\n";
-			std::cerr << "tpa::simd::hypot will execute upto the current size of the container.";
-			smallest = dest.size();
-			goto recover;
-		}//End catch
 		catch (const std::future_error& ex)
 		{
 			std::scoped_lock<std::mutex> lock(tpa::util::consoleMtx);
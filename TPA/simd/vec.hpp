@@ -0,0 +1,685 @@
+#pragma once
+/*
+*	Portable SIMD vector type for TPA Library
+*	By: David Aaron Braun
+*	2022-08-08
+*	Wraps a native SIMD register of 'W' lanes of type 'T'
+*/
+
+/*
+*           Copyright David Aaron Braun 2021 - .
+*   Distributed under the Boost Software License, Version 1.0.
+*       (See accompanying file LICENSE_1_0.txt or copy at
+*           https://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include <concepts>
+#include <utility>
+#include <cstdint>
+#include <cmath>
+#include <bit>
+#include <array>
+
+#include "../_util.hpp"
+#include "../size_t_lit.hpp"
+#include "../tpa_macros.hpp"
+#include "../predicates.hpp"
+#include "../InstructionSet.hpp"
+#include "simd.hpp"
+
+#undef min
+#undef max
+#undef abs
+#undef sqrt
+
+#ifdef TPA_NEON
+/// <summary>
+/// <para>Private Namespace for TPA NEON helpers.</para>
+/// <para>MSVC defines every 128-bit NEON type as __n128 so the helpers are selected by the lane type 'T' rather than overloaded on the register type.</para>
+/// </summary>
+namespace tpa_neon_private {
+
+	/// <summary>
+	/// Maps a lane size and signedness to the 128-bit NEON integer register
+	/// </summary>
+	template<size_t SIZE, bool SIGNED> struct int_register {};
+	template<> struct int_register<1uz, true> { using type = int8x16_t; };
+	template<> struct int_register<1uz, false> { using type = uint8x16_t; };
+	template<> struct int_register<2uz, true> { using type = int16x8_t; };
+	template<> struct int_register<2uz, false> { using type = uint16x8_t; };
+	template<> struct int_register<4uz, true> { using type = int32x4_t; };
+	template<> struct int_register<4uz, false> { using type = uint32x4_t; };
+	template<> struct int_register<8uz, true> { using type = int64x2_t; };
+	template<> struct int_register<8uz, false> { using type = uint64x2_t; };
+
+	template<typename T>
+	using mask_t = int_register<sizeof(T), false>::type;
+
+	template<typename T>
+	inline constexpr bool is_s8 = std::is_integral<T>::value && std::is_signed<T>::value && sizeof(T) == 1uz;
+	template<typename T>
+	inline constexpr bool is_u8 = std::is_integral<T>::value && std::is_unsigned<T>::value && sizeof(T) == 1uz;
+	template<typename T>
+	inline constexpr bool is_s16 = std::is_integral<T>::value && std::is_signed<T>::value && sizeof(T) == 2uz;
+	template<typename T>
+	inline constexpr bool is_u16 = std::is_integral<T>::value && std::is_unsigned<T>::value && sizeof(T) == 2uz;
+	template<typename T>
+	inline constexpr bool is_s32 = std::is_integral<T>::value && std::is_signed<T>::value && sizeof(T) == 4uz;
+	template<typename T>
+	inline constexpr bool is_u32 = std::is_integral<T>::value && std::is_unsigned<T>::value && sizeof(T) == 4uz;
+	template<typename T>
+	inline constexpr bool is_s64 = std::is_integral<T>::value && std::is_signed<T>::value && sizeof(T) == 8uz;
+
+	template<typename T, typename R>
+	[[nodiscard]] inline R load(const T* p) noexcept
+	{
+		if constexpr (std::is_same<T, float>::value) { return vld1q_f32(p); }
+		else if constexpr (std::is_same<T, double>::value) { return vld1q_f64(p); }
+		else if constexpr (is_s8<T>) { return vld1q_s8(reinterpret_cast<const int8_t*>(p)); }
+		else if constexpr (is_u8<T>) { return vld1q_u8(reinterpret_cast<const uint8_t*>(p)); }
+		else if constexpr (is_s16<T>) { return vld1q_s16(reinterpret_cast<const int16_t*>(p)); }
+		else if constexpr (is_u16<T>) { return vld1q_u16(reinterpret_cast<const uint16_t*>(p)); }
+		else if constexpr (is_s32<T>) { return vld1q_s32(reinterpret_cast<const int32_t*>(p)); }
+		else if constexpr (is_u32<T>) { return vld1q_u32(reinterpret_cast<const uint32_t*>(p)); }
+		else if constexpr (is_s64<T>) { return vld1q_s64(reinterpret_cast<const int64_t*>(p)); }
+		else { return vld1q_u64(reinterpret_cast<const uint64_t*>(p)); }
+	}//End of load
+
+	template<typename T, typename R>
+	inline void store(T* p, const R a) noexcept
+	{
+		if constexpr (std::is_same<T, float>::value) { vst1q_f32(p, a); }
+		else if constexpr (std::is_same<T, double>::value) { vst1q_f64(p, a); }
+		else if constexpr (is_s8<T>) { vst1q_s8(reinterpret_cast<int8_t*>(p), a); }
+		else if constexpr (is_u8<T>) { vst1q_u8(reinterpret_cast<uint8_t*>(p), a); }
+		else if constexpr (is_s16<T>) { vst1q_s16(reinterpret_cast<int16_t*>(p), a); }
+		else if constexpr (is_u16<T>) { vst1q_u16(reinterpret_cast<uint16_t*>(p), a); }
+		else if constexpr (is_s32<T>) { vst1q_s32(reinterpret_cast<int32_t*>(p), a); }
+		else if constexpr (is_u32<T>) { vst1q_u32(reinterpret_cast<uint32_t*>(p), a); }
+		else if constexpr (is_s64<T>) { vst1q_s64(reinterpret_cast<int64_t*>(p), a); }
+		else { vst1q_u64(reinterpret_cast<uint64_t*>(p), a); }
+	}//End of store
+
+	template<typename T, typename R>
+	[[nodiscard]] inline R dup(const T v) noexcept
+	{
+		if constexpr (std::is_same<T, float>::value) { return vdupq_n_f32(v); }
+		else if constexpr (std::is_same<T, double>::value) { return vdupq_n_f64(v); }
+		else if constexpr (is_s8<T>) { return vdupq_n_s8(static_cast<int8_t>(v)); }
+		else if constexpr (is_u8<T>) { return vdupq_n_u8(static_cast<uint8_t>(v)); }
+		else if constexpr (is_s16<T>) { return vdupq_n_s16(static_cast<int16_t>(v)); }
+		else if constexpr (is_u16<T>) { return vdupq_n_u16(static_cast<uint16_t>(v)); }
+		else if constexpr (is_s32<T>) { return vdupq_n_s32(static_cast<int32_t>(v)); }
+		else if constexpr (is_u32<T>) { return vdupq_n_u32(static_cast<uint32_t>(v)); }
+		else if constexpr (is_s64<T>) { return vdupq_n_s64(static_cast<int64_t>(v)); }
+		else { return vdupq_n_u64(static_cast<uint64_t>(v)); }
+	}//End of dup
+
+	template<typename T, typename R>
+	[[nodiscard]] inline R add(const R a, const R b) noexcept
+	{
+		if constexpr (std::is_same<T, float>::value) { return vaddq_f32(a, b); }
+		else if constexpr (std::is_same<T, double>::value) { return vaddq_f64(a, b); }
+		else if constexpr (is_s8<T>) { return vaddq_s8(a, b); }
+		else if constexpr (is_u8<T>) { return vaddq_u8(a, b); }
+		else if constexpr (is_s16<T>) { return vaddq_s16(a, b); }
+		else if constexpr (is_u16<T>) { return vaddq_u16(a, b); }
+		else if constexpr (is_s32<T>) { return vaddq_s32(a, b); }
+		else if constexpr (is_u32<T>) { return vaddq_u32(a, b); }
+		else if constexpr (is_s64<T>) { return vaddq_s64(a, b); }
+		else { return vaddq_u64(a, b); }
+	}//End of add
+
+	template<typename T, typename R>
+	[[nodiscard]] inline R sub(const R a, const R b) noexcept
+	{
+		if constexpr (std::is_same<T, float>::value) { return vsubq_f32(a, b); }
+		else if constexpr (std::is_same<T, double>::value) { return vsubq_f64(a, b); }
+		else if constexpr (is_s8<T>) { return vsubq_s8(a, b); }
+		else if constexpr (is_u8<T>) { return vsubq_u8(a, b); }
+		else if constexpr (is_s16<T>) { return vsubq_s16(a, b); }
+		else if constexpr (is_u16<T>) { return vsubq_u16(a, b); }
+		else if constexpr (is_s32<T>) { return vsubq_s32(a, b); }
+		else if constexpr (is_u32<T>) { return vsubq_u32(a, b); }
+		else if constexpr (is_s64<T>) { return vsubq_s64(a, b); }
+		else { return vsubq_u64(a, b); }
+	}//End of sub
+
+	/// <summary>
+	/// NEON has no 64-bit integer multiply, those lanes are multiplied one at a time
+	/// </summary>
+	template<typename T, typename R>
+	[[nodiscard]] inline R mul(const R a, const R b) noexcept
+	{
+		if constexpr (std::is_same<T, float>::value) { return vmulq_f32(a, b); }
+		else if constexpr (std::is_same<T, double>::value) { return vmulq_f64(a, b); }
+		else if constexpr (is_s8<T>) { return vmulq_s8(a, b); }
+		else if constexpr (is_u8<T>) { return vmulq_u8(a, b); }
+		else if constexpr (is_s16<T>) { return vmulq_s16(a, b); }
+		else if constexpr (is_u16<T>) { return vmulq_u16(a, b); }
+		else if constexpr (is_s32<T>) { return vmulq_s32(a, b); }
+		else if constexpr (is_u32<T>) { return vmulq_u32(a, b); }
+		else if constexpr (is_s64<T>)
+		{
+			const int64x2_t lo = vdupq_n_s64(vgetq_lane_s64(a, 0) * vgetq_lane_s64(b, 0));
+			return vsetq_lane_s64(vgetq_lane_s64(a, 1) * vgetq_lane_s64(b, 1), lo, 1);
+		}//End if
+		else
+		{
+			const uint64x2_t lo = vdupq_n_u64(vgetq_lane_u64(a, 0) * vgetq_lane_u64(b, 0));
+			return vsetq_lane_u64(vgetq_lane_u64(a, 1) * vgetq_lane_u64(b, 1), lo, 1);
+		}//End else
+	}//End of mul
+
+	template<typename T, typename R>
+	[[nodiscard]] inline R min(const R a, const R b) noexcept
+	{
+		if constexpr (std::is_same<T, float>::value) { return vminq_f32(a, b); }
+		else if constexpr (std::is_same<T, double>::value) { return vminq_f64(a, b); }
+		else if constexpr (is_s8<T>) { return vminq_s8(a, b); }
+		else if constexpr (is_u8<T>) { return vminq_u8(a, b); }
+		else if constexpr (is_s16<T>) { return vminq_s16(a, b); }
+		else if constexpr (is_u16<T>) { return vminq_u16(a, b); }
+		else if constexpr (is_s32<T>) { return vminq_s32(a, b); }
+		else if constexpr (is_u32<T>) { return vminq_u32(a, b); }
+		else if constexpr (is_s64<T>) { return vbslq_s64(vcgtq_s64(a, b), b, a); }
+		else { return vbslq_u64(vcgtq_u64(a, b), b, a); }
+	}//End of min
+
+	template<typename T, typename R>
+	[[nodiscard]] inline R max(const R a, const R b) noexcept
+	{
+		if constexpr (std::is_same<T, float>::value) { return vmaxq_f32(a, b); }
+		else if constexpr (std::is_same<T, double>::value) { return vmaxq_f64(a, b); }
+		else if constexpr (is_s8<T>) { return vmaxq_s8(a, b); }
+		else if constexpr (is_u8<T>) { return vmaxq_u8(a, b); }
+		else if constexpr (is_s16<T>) { return vmaxq_s16(a, b); }
+		else if constexpr (is_u16<T>) { return vmaxq_u16(a, b); }
+		else if constexpr (is_s32<T>) { return vmaxq_s32(a, b); }
+		else if constexpr (is_u32<T>) { return vmaxq_u32(a, b); }
+		else if constexpr (is_s64<T>) { return vbslq_s64(vcgtq_s64(a, b), a, b); }
+		else { return vbslq_u64(vcgtq_u64(a, b), a, b); }
+	}//End of max
+
+	/// <summary>
+	/// Signed types only, unsigned negation is handled by the caller
+	/// </summary>
+	template<typename T, typename R>
+	[[nodiscard]] inline R neg(const R a) noexcept
+	{
+		if constexpr (std::is_same<T, float>::value) { return vnegq_f32(a); }
+		else if constexpr (std::is_same<T, double>::value) { return vnegq_f64(a); }
+		else if constexpr (is_s8<T>) { return vnegq_s8(a); }
+		else if constexpr (is_s16<T>) { return vnegq_s16(a); }
+		else if constexpr (is_s32<T>) { return vnegq_s32(a); }
+		else { return vnegq_s64(a); }
+	}//End of neg
+
+	/// <summary>
+	/// Signed types only, unsigned types are returned unchanged by the caller
+	/// </summary>
+	template<typename T, typename R>
+	[[nodiscard]] inline R abs(const R a) noexcept
+	{
+		if constexpr (std::is_same<T, float>::value) { return vabsq_f32(a); }
+		else if constexpr (std::is_same<T, double>::value) { return vabsq_f64(a); }
+		else if constexpr (is_s8<T>) { return vabsq_s8(a); }
+		else if constexpr (is_s16<T>) { return vabsq_s16(a); }
+		else if constexpr (is_s32<T>) { return vabsq_s32(a); }
+		else { return vabsq_s64(a); }
+	}//End of abs
+
+	template<typename T, typename R>
+	[[nodiscard]] inline mask_t<T> cmpeq(const R a, const R b) noexcept
+	{
+		if constexpr (std::is_same<T, float>::value) { return vceqq_f32(a, b); }
+		else if constexpr (std::is_same<T, double>::value) { return vceqq_f64(a, b); }
+		else if constexpr (is_s8<T>) { return vceqq_s8(a, b); }
+		else if constexpr (is_u8<T>) { return vceqq_u8(a, b); }
+		else if constexpr (is_s16<T>) { return vceqq_s16(a, b); }
+		else if constexpr (is_u16<T>) { return vceqq_u16(a, b); }
+		else if constexpr (is_s32<T>) { return vceqq_s32(a, b); }
+		else if constexpr (is_u32<T>) { return vceqq_u32(a, b); }
+		else if constexpr (is_s64<T>) { return vceqq_s64(a, b); }
+		else { return vceqq_u64(a, b); }
+	}//End of cmpeq
+
+	template<typename T, typename R>
+	[[nodiscard]] inline mask_t<T> cmpgt(const R a, const R b) noexcept
+	{
+		if constexpr (std::is_same<T, float>::value) { return vcgtq_f32(a, b); }
+		else if constexpr (std::is_same<T, double>::value) { return vcgtq_f64(a, b); }
+		else if constexpr (is_s8<T>) { return vcgtq_s8(a, b); }
+		else if constexpr (is_u8<T>) { return vcgtq_u8(a, b); }
+		else if constexpr (is_s16<T>) { return vcgtq_s16(a, b); }
+		else if constexpr (is_u16<T>) { return vcgtq_u16(a, b); }
+		else if constexpr (is_s32<T>) { return vcgtq_s32(a, b); }
+		else if constexpr (is_u32<T>) { return vcgtq_u32(a, b); }
+		else if constexpr (is_s64<T>) { return vcgtq_s64(a, b); }
+		else { return vcgtq_u64(a, b); }
+	}//End of cmpgt
+
+	template<typename T, typename R>
+	[[nodiscard]] inline mask_t<T> cmpge(const R a, const R b) noexcept
+	{
+		if constexpr (std::is_same<T, float>::value) { return vcgeq_f32(a, b); }
+		else if constexpr (std::is_same<T, double>::value) { return vcgeq_f64(a, b); }
+		else if constexpr (is_s8<T>) { return vcgeq_s8(a, b); }
+		else if constexpr (is_u8<T>) { return vcgeq_u8(a, b); }
+		else if constexpr (is_s16<T>) { return vcgeq_s16(a, b); }
+		else if constexpr (is_u16<T>) { return vcgeq_u16(a, b); }
+		else if constexpr (is_s32<T>) { return vcgeq_s32(a, b); }
+		else if constexpr (is_u32<T>) { return vcgeq_u32(a, b); }
+		else if constexpr (is_s64<T>) { return vcgeq_s64(a, b); }
+		else { return vcgeq_u64(a, b); }
+	}//End of cmpge
+
+	template<typename T, typename R>
+	[[nodiscard]] inline R select(const mask_t<T> m, const R a, const R b) noexcept
+	{
+		if constexpr (std::is_same<T, float>::value) { return vbslq_f32(m, a, b); }
+		else if constexpr (std::is_same<T, double>::value) { return vbslq_f64(m, a, b); }
+		else if constexpr (is_s8<T>) { return vbslq_s8(m, a, b); }
+		else if constexpr (is_u8<T>) { return vbslq_u8(m, a, b); }
+		else if constexpr (is_s16<T>) { return vbslq_s16(m, a, b); }
+		else if constexpr (is_u16<T>) { return vbslq_u16(m, a, b); }
+		else if constexpr (is_s32<T>) { return vbslq_s32(m, a, b); }
+		else if constexpr (is_u32<T>) { return vbslq_u32(m, a, b); }
+		else if constexpr (is_s64<T>) { return vbslq_s64(m, a, b); }
+		else { return vbslq_u64(m, a, b); }
+	}//End of select
+
+	/// <summary>
+	/// Reinterprets any register of lane type 'T' as the unsigned register of the same lane size
+	/// </summary>
+	template<typename T, typename R>
+	[[nodiscard]] inline mask_t<T> as_unsigned(const R a) noexcept
+	{
+		if constexpr (std::is_same<T, float>::value) { return vreinterpretq_u32_f32(a); }
+		else if constexpr (std::is_same<T, double>::value) { return vreinterpretq_u64_f64(a); }
+		else if constexpr (is_s8<T>) { return vreinterpretq_u8_s8(a); }
+		else if constexpr (is_s16<T>) { return vreinterpretq_u16_s16(a); }
+		else if constexpr (is_s32<T>) { return vreinterpretq_u32_s32(a); }
+		else if constexpr (is_s64<T>) { return vreinterpretq_u64_s64(a); }
+		else { return a; }
+	}//End of as_unsigned
+
+	/// <summary>
+	/// Reinterprets an unsigned register as the register of lane type 'T'
+	/// </summary>
+	template<typename T, typename R>
+	[[nodiscard]] inline R from_unsigned(const mask_t<T> a) noexcept
+	{
+		if constexpr (std::is_same<T, float>::value) { return vreinterpretq_f32_u32(a); }
+		else if constexpr (std::is_same<T, double>::value) { return vreinterpretq_f64_u64(a); }
+		else if constexpr (is_s8<T>) { return vreinterpretq_s8_u8(a); }
+		else if constexpr (is_s16<T>) { return vreinterpretq_s16_u16(a); }
+		else if constexpr (is_s32<T>) { return vreinterpretq_s32_u32(a); }
+		else if constexpr (is_s64<T>) { return vreinterpretq_s64_u64(a); }
+		else { return a; }
+	}//End of from_unsigned
+
+	/// <summary>
+	/// Bitwise operations on unsigned registers, 'OP' is 0 for AND, 1 for OR, 2 for XOR and 3 for NOT
+	/// </summary>
+	template<typename T, int OP>
+	[[nodiscard]] inline mask_t<T> bitwise(const mask_t<T> a, const mask_t<T> b) noexcept
+	{
+		if constexpr (sizeof(T) == 1uz)
+		{
+			if constexpr (OP == 0) { return vandq_u8(a, b); }
+			else if constexpr (OP == 1) { return vorrq_u8(a, b); }
+			else if constexpr (OP == 2) { return veorq_u8(a, b); }
+			else { return vmvnq_u8(a); }
+		}//End if
+		else if constexpr (sizeof(T) == 2uz)
+		{
+			if constexpr (OP == 0) { return vandq_u16(a, b); }
+			else if constexpr (OP == 1) { return vorrq_u16(a, b); }
+			else if constexpr (OP == 2) { return veorq_u16(a, b); }
+			else { return vmvnq_u16(a); }
+		}//End if
+		else if constexpr (sizeof(T) == 4uz)
+		{
+			if constexpr (OP == 0) { return vandq_u32(a, b); }
+			else if constexpr (OP == 1) { return vorrq_u32(a, b); }
+			else if constexpr (OP == 2) { return veorq_u32(a, b); }
+			else { return vmvnq_u32(a); }
+		}//End if
+		else
+		{
+			if constexpr (OP == 0) { return vandq_u64(a, b); }
+			else if constexpr (OP == 1) { return vorrq_u64(a, b); }
+			else if constexpr (OP == 2) { return veorq_u64(a, b); }
+			else { return veorq_u64(a, vdupq_n_u64(~0ull)); }
+		}//End else
+	}//End of bitwise
+
+	/// <summary>
+	/// Shifts every lane left by 'n', a negative 'n' shifts right (arithmetic for signed types, logical for unsigned)
+	/// </summary>
+	template<typename T, typename R>
+	[[nodiscard]] inline R shift(const R a, const int n) noexcept
+	{
+		if constexpr (is_s8<T>) { return vshlq_s8(a, vdupq_n_s8(static_cast<int8_t>(n))); }
+		else if constexpr (is_u8<T>) { return vshlq_u8(a, vdupq_n_s8(static_cast<int8_t>(n))); }
+		else if constexpr (is_s16<T>) { return vshlq_s16(a, vdupq_n_s16(static_cast<int16_t>(n))); }
+		else if constexpr (is_u16<T>) { return vshlq_u16(a, vdupq_n_s16(static_cast<int16_t>(n))); }
+		else if constexpr (is_s32<T>) { return vshlq_s32(a, vdupq_n_s32(n)); }
+		else if constexpr (is_u32<T>) { return vshlq_u32(a, vdupq_n_s32(n)); }
+		else if constexpr (is_s64<T>) { return vshlq_s64(a, vdupq_n_s64(n)); }
+		else { return vshlq_u64(a, vdupq_n_s64(n)); }
+	}//End of shift
+
+	template<typename T, typename R>
+	[[nodiscard]] inline R reverse(const R a) noexcept
+	{
+		if constexpr (std::is_same<T, float>::value) { const float32x4_t r = vrev64q_f32(a); return vextq_f32(r, r, 2); }
+		else if constexpr (std::is_same<T, double>::value) { return vextq_f64(a, a, 1); }
+		else if constexpr (is_s8<T>) { const int8x16_t r = vrev64q_s8(a); return vextq_s8(r, r, 8); }
+		else if constexpr (is_u8<T>) { const uint8x16_t r = vrev64q_u8(a); return vextq_u8(r, r, 8); }
+		else if constexpr (is_s16<T>) { const int16x8_t r = vrev64q_s16(a); return vextq_s16(r, r, 4); }
+		else if constexpr (is_u16<T>) { const uint16x8_t r = vrev64q_u16(a); return vextq_u16(r, r, 4); }
+		else if constexpr (is_s32<T>) { const int32x4_t r = vrev64q_s32(a); return vextq_s32(r, r, 2); }
+		else if constexpr (is_u32<T>) { const uint32x4_t r = vrev64q_u32(a); return vextq_u32(r, r, 2); }
+		else if constexpr (is_s64<T>) { return vextq_s64(a, a, 1); }
+		else { return vextq_u64(a, a, 1); }
+	}//End of reverse
+}//End of namespace
+#endif
+
+/// <summary>
+/// TPA SIMD Utility Functions
+/// </summary>
+namespace tpa::simd {
+
+#pragma region register_type
+	/// <summary>
+	/// <para>Maps 'W' lanes of 'T' to the native register used to hold them.</para>
+	/// <para>A single lane is always held in a plain 'T'.</para>
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	/// <typeparam name="W"></typeparam>
+	template<typename T, size_t W>
+	struct register_type { using type = T; };
+
+	/// <summary>
+	/// <para>Maps 'W' lanes of 'T' to the native register used to hold the result of a comparison.</para>
+	/// <para>AVX-512 uses __mmask registers, AVX/SSE use a vector of all-ones / all-zeros lanes, NEON uses an unsigned vector and a single lane uses bool.</para>
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	/// <typeparam name="W"></typeparam>
+	template<typename T, size_t W>
+	struct mask_register { using type = bool; };
+
+#ifdef TPA_X86_64
+	template<> struct register_type<float, 16uz> { using type = __m512; };
+	template<> struct register_type<float, 8uz> { using type = __m256; };
+	template<> struct register_type<float, 4uz> { using type = __m128; };
+	template<> struct register_type<double, 8uz> { using type = __m512d; };
+	template<> struct register_type<double, 4uz> { using type = __m256d; };
+	template<> struct register_type<double, 2uz> { using type = __m128d; };
+
+	template<typename T, size_t W> requires std::is_integral<T>::value && (W > 1uz) && (sizeof(T) * W == 64uz)
+	struct register_type<T, W> { using type = __m512i; };
+
+	template<typename T, size_t W> requires std::is_integral<T>::value && (W > 1uz) && (sizeof(T) * W == 32uz)
+	struct register_type<T, W> { using type = __m256i; };
+
+	template<typename T, size_t W> requires std::is_integral<T>::value && (W > 1uz) && (sizeof(T) * W == 16uz)
+	struct register_type<T, W> { using type = __m128i; };
+
+	template<typename T, size_t W> requires (W == 8uz) && (sizeof(T) * W == 64uz)
+	struct mask_register<T, W> { using type = __mmask8; };
+
+	template<typename T, size_t W> requires (W == 16uz) && (sizeof(T) * W == 64uz)
+	struct mask_register<T, W> { using type = __mmask16; };
+
+	template<typename T, size_t W> requires (W == 32uz) && (sizeof(T) * W == 64uz)
+	struct mask_register<T, W> { using type = __mmask32; };
+
+	template<typename T, size_t W> requires (W == 64uz) && (sizeof(T) * W == 64uz)
+	struct mask_register<T, W> { using type = __mmask64; };
+
+	template<typename T, size_t W> requires (W > 1uz) && (sizeof(T) * W == 32uz || sizeof(T) * W == 16uz)
+	struct mask_register<T, W> { using type = register_type<T, W>::type; };
+#elif defined(TPA_NEON)
+	template<> struct register_type<float, 4uz> { using type = float32x4_t; };
+	template<> struct register_type<double, 2uz> { using type = float64x2_t; };
+
+	template<typename T, size_t W> requires std::is_integral<T>::value && (W > 1uz) && (sizeof(T) * W == 16uz)
+	struct register_type<T, W> { using type = tpa_neon_private::int_register<sizeof(T), std::is_signed<T>::value>::type; };
+
+	template<typename T, size_t W> requires (W > 1uz) && (sizeof(T) * W == 16uz)
+	struct mask_register<T, W> { using type = tpa_neon_private::mask_t<T>; };
+#endif
+#pragma endregion
+
+	/// <summary>
+	/// <para>Returns true if vec&lt;T, W&gt; can be used on this hardware at runtime.</para>
+	/// <para>A width of 1 (scalar) is always supported.</para>
+	/// <para>Used to select the widest available vec width, e.g.</para>
+	/// <para>if (tpa::simd::vec_supported&lt;T, 64uz / sizeof(T)&gt;()) {...}</para>
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	/// <typeparam name="W"></typeparam>
+	/// <returns></returns>
+	template<typename T, size_t W>
+	[[nodiscard]] inline bool vec_supported() noexcept
+	{
+		if constexpr (W == 1uz)
+		{
+			return true;
+		}//End if
+#ifdef TPA_X86_64
+		//Each width is compiled for the whole target of its region in vec.hpp, so every extension in it is required
+		else if constexpr (sizeof(T) * W == 64uz)
+		{
+			return tpa::hasAVX512 && tpa::hasAVX512_ByteWord && tpa::hasAVX512_DWQW && tpa::hasAVX512_VL;
+		}//End if
+		else if constexpr (sizeof(T) * W == 32uz)
+		{
+			return tpa::hasAVX2 && tpa::hasFMA;
+		}//End if
+		else if constexpr (sizeof(T) * W == 16uz)
+		{
+			return tpa::has_SSE41 && tpa::has_SSE42;
+		}//End if
+#elif defined(TPA_NEON)
+		else if constexpr (sizeof(T) * W == 16uz)
+		{
+			return tpa::hasNeon;
+		}//End if
+#endif
+		else
+		{
+			return false;
+		}//End else
+	}//End of vec_supported
+
+	/// <summary>
+	/// <para>True if 'T' can be held in a tpa::simd::vec wider than 1 lane (every integer type except bool, float and double).</para>
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	template<typename T>
+	inline constexpr bool is_vec_type = (std::is_integral<T>::value && !std::is_same<T, bool>::value && sizeof(T) <= 8uz) ||
+		std::is_same<T, float>::value || std::is_same<T, double>::value;
+
+	/// <summary>
+	/// <para>Returns the first index in [i, end] at which &amp;ptr[index] is aligned to ALIGN bytes.</para>
+	/// <para>Used to peel a short prologue so that the SIMD loop which follows runs on aligned addresses.</para>
+	/// <para>Returns 'i' if 'ptr' can never reach the alignment because it is not aligned to sizeof(T).</para>
+	/// </summary>
+	/// <typeparam name="ALIGN">A power of 2</typeparam>
+	/// <typeparam name="T"></typeparam>
+	/// <param name="i"></param>
+	/// <param name="end"></param>
+	/// <param name="ptr"></param>
+	/// <returns></returns>
+	template<size_t ALIGN, typename T>
+	requires (std::has_single_bit(ALIGN))
+	[[nodiscard]] inline size_t align_index(const size_t i, const size_t end, const T* ptr) noexcept
+	{
+		const size_t misalignment = (ALIGN - (reinterpret_cast<uintptr_t>(ptr + i) & (ALIGN - 1uz))) & (ALIGN - 1uz);
+
+		if ((misalignment % sizeof(T)) != 0uz)
+		{
+			return i;
+		}//End if
+
+		return tpa::util::min(end, i + (misalignment / sizeof(T)));
+	}//End of align_index
+
+	/// <summary>
+	/// <para>Orders the non-temporal stores made by this thread (vec::store_stream) before any store which follows (SFENCE).</para>
+	/// </summary>
+	inline void stream_fence() noexcept
+	{
+#ifdef TPA_X86_64
+		_mm_sfence();
+#endif
+	}//End of stream_fence
+
+	/// <summary>
+	/// <para>The number of independent vectors (or accumulators) the SIMD block loops keep in flight per iteration, set with TPA_UNROLL.</para>
+	/// </summary>
+	inline constexpr size_t unroll = TPA_UNROLL;
+
+	static_assert(unroll >= 1uz, "TPA_UNROLL must be at least 1.");
+
+	/// <summary>
+	/// <para>How many bytes ahead of the current element the SIMD block loops prefetch, set with TPA_PREFETCH_DISTANCE, 0 = no software prefetching.</para>
+	/// </summary>
+	inline constexpr size_t prefetch_distance = TPA_PREFETCH_DISTANCE;
+
+	/// <summary>
+	/// <para>Prefetches the cache lines covering [ptr, ptr + BYTES) offset by tpa::simd::prefetch_distance into L1.</para>
+	/// <para>Hardware prefetchers lose the stream at page boundaries and when several streams are read at once, this keeps them fed.</para>
+	/// <para>A prefetch never faults so it is safe to run past the end of the data.</para>
+	/// </summary>
+	/// <typeparam name="BYTES">The number of bytes which the caller is about to read from 'ptr'</typeparam>
+	/// <typeparam name="T"></typeparam>
+	/// <param name="ptr"></param>
+	template<size_t BYTES = 64uz, typename T>
+	inline void prefetch([[maybe_unused]] const T* ptr) noexcept
+	{
+		if constexpr (prefetch_distance != 0uz)
+		{
+			const char* line = reinterpret_cast<const char*>(ptr) + prefetch_distance;
+
+			for (size_t b = 0uz; b < BYTES; b += 64uz)
+			{
+#ifdef TPA_X86_64
+				_mm_prefetch(line + b, _MM_HINT_T0);
+#elif defined(__GNUC__) || defined(__clang__)
+				__builtin_prefetch(line + b, 0, 3);
+#elif defined(_MSC_VER) && defined(TPA_ARM)
+				__prefetch(line + b);
+#endif
+			}//End for
+		}//End if
+	}//End of prefetch
+
+	/// <summary>
+	/// <para>Left-pack permutations for 256-bit vectors, indexed by the lane mask.</para>
+	/// <para>Entry 'm' holds the 32-bit lane indices selected by 'm' as 8 packed bytes, lowest lane first.</para>
+	/// </summary>
+	inline constexpr std::array<uint64_t, 256uz> compress_lut32 = []()
+	{
+		std::array<uint64_t, 256uz> lut{};
+
+		for (size_t m = 0uz; m != 256uz; ++m)
+		{
+			size_t n = 0uz;
+			for (size_t k = 0uz; k != 8uz; ++k)
+			{
+				if ((m >> k) & 1uz)
+				{
+					lut[m] |= static_cast<uint64_t>(k) << (8uz * n++);
+				}//End if
+			}//End for
+		}//End for
+
+		return lut;
+	}();
+
+	/// <summary>
+	/// <para>As compress_lut32 for 64-bit lanes, each selected lane moves as a pair of 32-bit lanes.</para>
+	/// </summary>
+	inline constexpr std::array<uint64_t, 16uz> compress_lut64 = []()
+	{
+		std::array<uint64_t, 16uz> lut{};
+
+		for (size_t m = 0uz; m != 16uz; ++m)
+		{
+			size_t n = 0uz;
+			for (size_t k = 0uz; k != 4uz; ++k)
+			{
+				if ((m >> k) & 1uz)
+				{
+					lut[m] |= static_cast<uint64_t>(2uz * k) << (8uz * n++);
+					lut[m] |= static_cast<uint64_t>((2uz * k) + 1uz) << (8uz * n++);
+				}//End if
+			}//End for
+		}//End for
+
+		return lut;
+	}();
+
+	/// <summary>
+	/// <para>The size of the native register holding 'W' lanes of 'T', 0 for a single lane (a plain 'T').</para>
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	/// <typeparam name="W"></typeparam>
+	template<typename T, size_t W>
+	inline constexpr size_t register_bytes = (W == 1uz) ? 0uz : sizeof(T) * W;
+
+	/// <summary>
+	/// <para>A type which can be held in the lanes of a tpa::simd::vec.</para>
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	template<typename T>
+	concept lane_type = std::is_arithmetic<T>::value && (!std::is_same<T, bool>::value);
+
+	/// <summary>
+	/// <para>tpa::simd::mask, tpa::simd::vec and their functions are defined in vec_impl.hpp once per register size.</para>
+	/// <para>Each definition is compiled for the instruction set which its size needs (SSE4.2, AVX2 or AVX-512) so the library builds for the baseline ISA,</para>
+	/// <para>kernels compiled for that instruction set (TPA_TARGET_*) then inline them.</para>
+	/// </summary>
+	template<typename T, size_t W>
+	struct mask;
+
+	template<tpa::simd::lane_type T, size_t W>
+	struct vec;
+
+}//End of namespace
+
+#ifdef TPA_X86_64
+TPA_TARGET_REGION_BEGIN(TPA_ISA_AVX512)
+#define TPA_VEC_BYTES 64uz
+#include "vec_impl.hpp"
+#undef TPA_VEC_BYTES
+TPA_TARGET_REGION_END
+
+TPA_TARGET_REGION_BEGIN(TPA_ISA_AVX2)
+#define TPA_VEC_BYTES 32uz
+#include "vec_impl.hpp"
+#undef TPA_VEC_BYTES
+TPA_TARGET_REGION_END
+
+TPA_TARGET_REGION_BEGIN(TPA_ISA_SSE41)
+#define TPA_VEC_BYTES 16uz
+#include "vec_impl.hpp"
+#undef TPA_VEC_BYTES
+TPA_TARGET_REGION_END
+#elif defined(TPA_NEON)
+#define TPA_VEC_BYTES 16uz
+#include "vec_impl.hpp"
+#undef TPA_VEC_BYTES
+#endif
+
+//A single lane is a plain 'T' and is compiled for the baseline ISA
+#define TPA_VEC_BYTES 0uz
+#include "vec_impl.hpp"
+#undef TPA_VEC_BYTES
@@ -0,0 +1,1907 @@
+/*
+*	Portable SIMD vector type for TPA Library
+*	By: David Aaron Braun
+*	2022-08-08
+*	Defines tpa::simd::mask, tpa::simd::vec and their functions for registers of TPA_VEC_BYTES bytes
+*	Included by vec.hpp once per register size, each time under the target for that size, do not include directly
+*/
+
+/*
+*           Copyright David Aaron Braun 2021 - .
+*   Distributed under the Boost Software License, Version 1.0.
+*       (See accompanying file LICENSE_1_0.txt or copy at
+*           https://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/// <summary>
+/// TPA SIMD Utility Functions
+/// </summary>
+namespace tpa::simd {
+
+	/// <summary>
+	/// <para>The result of comparing two tpa::simd::vec&lt;T, W&gt;, one boolean per lane.</para>
+	/// <para>Use with tpa::simd::select or test with any(), all(), none(), count() and bits().</para>
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	/// <typeparam name="W"></typeparam>
+	template<typename T, size_t W>
+	requires (tpa::simd::register_bytes<T, W> == TPA_VEC_BYTES)
+	struct mask<T, W>
+	{
+		using value_type = T;
+		using native_type = mask_register<T, W>::type;
+
+		static constexpr size_t width = W;
+		static constexpr size_t bytes = sizeof(T) * W;
+
+		native_type reg;
+
+		mask() noexcept = default;
+
+		explicit constexpr mask(const native_type r) noexcept : reg(r) {}
+
+		/// <summary>
+		/// <para>User-provided copies pass and return a mask in memory under every target, see the copy constructor of tpa::simd::vec.</para>
+		/// </summary>
+		mask(const mask&) noexcept = default;
+		constexpr mask(const mask& other) noexcept requires (W != 1uz) : reg(other.reg) {}
+		mask& operator=(const mask&) noexcept = default;
+
+		/// <summary>
+		/// <para>Returns the mask as an integer, bit 'k' is set if lane 'k' is set.</para>
+		/// </summary>
+		/// <returns></returns>
+		[[nodiscard]] inline uint64_t bits() const noexcept
+		{
+			if constexpr (W == 1uz)
+			{
+				return static_cast<uint64_t>(reg);
+			}//End if
+#ifdef TPA_X86_64
+			else if constexpr (bytes == 64uz)
+			{
+				return static_cast<uint64_t>(reg);
+			}//End if
+			else if constexpr (std::is_same<T, float>::value)
+			{
+				if constexpr (bytes == 32uz) { return static_cast<uint64_t>(_mm256_movemask_ps(reg)); }
+				else { return static_cast<uint64_t>(_mm_movemask_ps(reg)); }
+			}//End if
+			else if constexpr (std::is_same<T, double>::value)
+			{
+				if constexpr (bytes == 32uz) { return static_cast<uint64_t>(_mm256_movemask_pd(reg)); }
+				else { return static_cast<uint64_t>(_mm_movemask_pd(reg)); }
+			}//End if
+			else if constexpr (sizeof(T) == 1uz)
+			{
+				if constexpr (bytes == 32uz) { return static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(reg))); }
+				else { return static_cast<uint64_t>(_mm_movemask_epi8(reg)); }
+			}//End if
+			else if constexpr (sizeof(T) == 2uz)
+			{
+				//Narrow each 16-bit lane to 8 bits (saturation preserves 0 and -1) then take the byte mask
+				if constexpr (bytes == 32uz) { return static_cast<uint64_t>(_mm_movemask_epi8(_mm_packs_epi16(_mm256_castsi256_si128(reg), _mm256_extracti128_si256(reg, 1)))); }
+				else { return static_cast<uint64_t>(_mm_movemask_epi8(_mm_packs_epi16(reg, _mm_setzero_si128())) & 0xFF); }
+			}//End if
+			else if constexpr (sizeof(T) == 4uz)
+			{
+				if constexpr (bytes == 32uz) { return static_cast<uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(reg))); }
+				else { return static_cast<uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(reg))); }
+			}//End if
+			else
+			{
+				if constexpr (bytes == 32uz) { return static_cast<uint64_t>(_mm256_movemask_pd(_mm256_castsi256_pd(reg))); }
+				else { return static_cast<uint64_t>(_mm_movemask_pd(_mm_castsi128_pd(reg))); }
+			}//End else
+#elif defined(TPA_NEON)
+			else
+			{
+				using U = std::conditional_t<sizeof(T) == 1uz, uint8_t, std::conditional_t<sizeof(T) == 2uz, uint16_t, std::conditional_t<sizeof(T) == 4uz, uint32_t, uint64_t>>>;
+
+				U lanes[W];
+				tpa_neon_private::store<U>(lanes, reg);
+
+				uint64_t res = 0;
+				for (size_t k = 0; k != W; ++k)
+				{
+					res |= static_cast<uint64_t>(lanes[k] & 1u) << k;
+				}//End for
+
+				return res;
+			}//End else
+#endif
+		}//End of bits
+
+		/// <summary>
+		/// Returns true if any lane is set
+		/// </summary>
+		[[nodiscard]] inline bool any() const noexcept { return bits() != 0ull; }
+
+		/// <summary>
+		/// Returns true if every lane is set
+		/// </summary>
+		[[nodiscard]] inline bool all() const noexcept { return bits() == (W == 64uz ? ~0ull : ((1ull << W) - 1ull)); }
+
+		/// <summary>
+		/// Returns true if no lane is set
+		/// </summary>
+		[[nodiscard]] inline bool none() const noexcept { return bits() == 0ull; }
+
+		/// <summary>
+		/// Returns the number of lanes which are set
+		/// </summary>
+		[[nodiscard]] inline size_t count() const noexcept { return static_cast<size_t>(std::popcount(bits())); }
+
+		/// <summary>
+		/// <para>Bitwise operations on masks, 'OP' is 0 for AND, 1 for OR, 2 for XOR and 3 for NOT.</para>
+		/// </summary>
+		template<int OP>
+		[[nodiscard]] static inline mask bitwise(const mask a, const mask b) noexcept
+		{
+			if constexpr (W == 1uz)
+			{
+				if constexpr (OP == 0) { return mask(a.reg && b.reg); }
+				else if constexpr (OP == 1) { return mask(a.reg || b.reg); }
+				else if constexpr (OP == 2) { return mask(a.reg != b.reg); }
+				else { return mask(!a.reg); }
+			}//End if
+#ifdef TPA_X86_64
+			else if constexpr (bytes == 64uz)
+			{
+				if constexpr (OP == 0) { return mask(static_cast<native_type>(a.reg & b.reg)); }
+				else if constexpr (OP == 1) { return mask(static_cast<native_type>(a.reg | b.reg)); }
+				else if constexpr (OP == 2) { return mask(static_cast<native_type>(a.reg ^ b.reg)); }
+				else { return mask(static_cast<native_type>(~a.reg)); }
+			}//End if
+			else if constexpr (std::is_same<T, float>::value)
+			{
+				if constexpr (bytes == 32uz)
+				{
+					if constexpr (OP == 0) { return mask(_mm256_and_ps(a.reg, b.reg)); }
+					else if constexpr (OP == 1) { return mask(_mm256_or_ps(a.reg, b.reg)); }
+					else if constexpr (OP == 2) { return mask(_mm256_xor_ps(a.reg, b.reg)); }
+					else { return mask(_mm256_xor_ps(a.reg, _mm256_castsi256_ps(_mm256_set1_epi32(-1)))); }
+				}//End if
+				else
+				{
+					if constexpr (OP == 0) { return mask(_mm_and_ps(a.reg, b.reg)); }
+					else if constexpr (OP == 1) { return mask(_mm_or_ps(a.reg, b.reg)); }
+					else if constexpr (OP == 2) { return mask(_mm_xor_ps(a.reg, b.reg)); }
+					else { return mask(_mm_xor_ps(a.reg, _mm_castsi128_ps(_mm_set1_epi32(-1)))); }
+				}//End else
+			}//End if
+			else if constexpr (std::is_same<T, double>::value)
+			{
+				if constexpr (bytes == 32uz)
+				{
+					if constexpr (OP == 0) { return mask(_mm256_and_pd(a.reg, b.reg)); }
+					else if constexpr (OP == 1) { return mask(_mm256_or_pd(a.reg, b.reg)); }
+					else if constexpr (OP == 2) { return mask(_mm256_xor_pd(a.reg, b.reg)); }
+					else { return mask(_mm256_xor_pd(a.reg, _mm256_castsi256_pd(_mm256_set1_epi32(-1)))); }
+				}//End if
+				else
+				{
+					if constexpr (OP == 0) { return mask(_mm_and_pd(a.reg, b.reg)); }
+					else if constexpr (OP == 1) { return mask(_mm_or_pd(a.reg, b.reg)); }
+					else if constexpr (OP == 2) { return mask(_mm_xor_pd(a.reg, b.reg)); }
+					else { return mask(_mm_xor_pd(a.reg, _mm_castsi128_pd(_mm_set1_epi32(-1)))); }
+				}//End else
+			}//End if
+			else
+			{
+				if constexpr (bytes == 32uz)
+				{
+					if constexpr (OP == 0) { return mask(_mm256_and_si256(a.reg, b.reg)); }
+					else if constexpr (OP == 1) { return mask(_mm256_or_si256(a.reg, b.reg)); }
+					else if constexpr (OP == 2) { return mask(_mm256_xor_si256(a.reg, b.reg)); }
+					else { return mask(tpa::simd::_mm256_not_si256(a.reg)); }
+				}//End if
+				else
+				{
+					if constexpr (OP == 0) { return mask(_mm_and_si128(a.reg, b.reg)); }
+					else if constexpr (OP == 1) { return mask(_mm_or_si128(a.reg, b.reg)); }
+					else if constexpr (OP == 2) { return mask(_mm_xor_si128(a.reg, b.reg)); }
+					else { return mask(tpa::simd::_mm_not_si128(a.reg)); }
+				}//End else
+			}//End else
+#elif defined(TPA_NEON)
+			else
+			{
+				return mask(tpa_neon_private::bitwise<T, OP>(a.reg, b.reg));
+			}//End else
+#endif
+		}//End of bitwise
+
+		[[nodiscard]] friend inline mask operator&(const mask a, const mask b) noexcept { return mask::bitwise<0>(a, b); }
+		[[nodiscard]] friend inline mask operator|(const mask a, const mask b) noexcept { return mask::bitwise<1>(a, b); }
+		[[nodiscard]] friend inline mask operator^(const mask a, const mask b) noexcept { return mask::bitwise<2>(a, b); }
+		[[nodiscard]] friend inline mask operator~(const mask a) noexcept { return mask::bitwise<3>(a, a); }
+	};//End of mask
+
+	/// <summary>
+	/// <para>Portable SIMD vector of 'W' lanes of type 'T'.</para>
+	/// <para>Wraps the native register for the width (__m512, __m256i, float32x4_t, etc.) so that a single kernel can be written once and instantiated for every ISA.</para>
+	/// <para>W must fill a 128, 256 or 512-bit register (128-bit only on ARM) or be 1, a vec of width 1 is a plain scalar and is always available.</para>
+	/// <para>Operations without a native instruction are emulated, integer division and square roots are computed lane by lane.</para>
+	/// <para>Warning: Check tpa::simd::vec_supported&lt;T, W&gt;() before using a width greater than 1.</para>
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	/// <typeparam name="W"></typeparam>
+	template<tpa::simd::lane_type T, size_t W>
+	requires (tpa::simd::register_bytes<T, W> == TPA_VEC_BYTES)
+	struct vec<T, W>
+	{
+		using value_type = T;
+		using native_type = register_type<T, W>::type;
+		using mask_type = tpa::simd::mask<T, W>;
+
+		static constexpr size_t width = W;
+		static constexpr size_t bytes = sizeof(T) * W;
+
+		static_assert(W == 1uz || !std::is_same<native_type, T>::value,
+			"Compile Error! tpa::simd::vec<T, W> requires W lanes of T to fill a native SIMD register on this platform.");
+
+		native_type reg;
+
+		vec() noexcept = default;
+
+		/// <summary>
+		/// Wraps a native register
+		/// </summary>
+		/// <param name="r"></param>
+		explicit constexpr vec(const native_type r) noexcept : reg(r) {}
+
+		/// <summary>
+		/// Broadcasts 'val' to every lane
+		/// </summary>
+		/// <param name="val"></param>
+		explicit vec(const T val) noexcept requires (W != 1uz) : reg(broadcast(val)) {}
+
+		/// <summary>
+		/// <para>The copy constructor is user-provided so that a vec is passed and returned in memory (by reference) under every target.</para>
+		/// <para>A trivial copy would be passed in a register only by code compiled for the ISA of the register, so a call between a kernel and code
+		/// compiled for the baseline ISA (a user supplied lambda which was not inlined, e.g. at -O0) would disagree on where the vec is.</para>
+		/// <para>Calls which are inlined, as they are inside the kernels, copy nothing.</para>
+		/// </summary>
+		/// <param name="other"></param>
+		vec(const vec&) noexcept = default;
+		constexpr vec(const vec& other) noexcept requires (W != 1uz) : reg(other.reg) {}
+		vec& operator=(const vec&) noexcept = default;
+
+#pragma region load_store
+		/// <summary>
+		/// <para>Loads W values from (potentially unaligned) memory.</para>
+		/// </summary>
+		/// <param name="ptr"></param>
+		/// <returns></returns>
+		[[nodiscard]] static inline vec load(const T* ptr) noexcept
+		{
+			if constexpr (W == 1uz)
+			{
+				return vec(*ptr);
+			}//End if
+#ifdef TPA_X86_64
+			else if constexpr (std::is_same<T, float>::value)
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_loadu_ps(ptr)); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_loadu_ps(ptr)); }
+				else { return vec(_mm_loadu_ps(ptr)); }
+			}//End if
+			else if constexpr (std::is_same<T, double>::value)
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_loadu_pd(ptr)); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_loadu_pd(ptr)); }
+				else { return vec(_mm_loadu_pd(ptr)); }
+			}//End if
+			else
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_loadu_si512(ptr)); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_loadu_si256((const __m256i*)ptr)); }
+				else { return vec(_mm_loadu_si128((const __m128i*)ptr)); }
+			}//End else
+#elif defined(TPA_NEON)
+			else
+			{
+				return vec(tpa_neon_private::load<T, native_type>(ptr));
+			}//End else
+#endif
+		}//End of load
+
+		/// <summary>
+		/// <para>Stores W values to (potentially unaligned) memory.</para>
+		/// </summary>
+		/// <param name="ptr"></param>
+		inline void store(T* ptr) const noexcept
+		{
+			if constexpr (W == 1uz)
+			{
+				*ptr = reg;
+			}//End if
+#ifdef TPA_X86_64
+			else if constexpr (std::is_same<T, float>::value)
+			{
+				if constexpr (bytes == 64uz) { _mm512_storeu_ps(ptr, reg); }
+				else if constexpr (bytes == 32uz) { _mm256_storeu_ps(ptr, reg); }
+				else { _mm_storeu_ps(ptr, reg); }
+			}//End if
+			else if constexpr (std::is_same<T, double>::value)
+			{
+				if constexpr (bytes == 64uz) { _mm512_storeu_pd(ptr, reg); }
+				else if constexpr (bytes == 32uz) { _mm256_storeu_pd(ptr, reg); }
+				else { _mm_storeu_pd(ptr, reg); }
+			}//End if
+			else
+			{
+				if constexpr (bytes == 64uz) { _mm512_storeu_si512(ptr, reg); }
+				else if constexpr (bytes == 32uz) { _mm256_storeu_si256((__m256i*)ptr, reg); }
+				else { _mm_storeu_si128((__m128i*)ptr, reg); }
+			}//End else
+#elif defined(TPA_NEON)
+			else
+			{
+				tpa_neon_private::store<T>(ptr, reg);
+			}//End else
+#endif
+		}//End of store
+
+		/// <summary>
+		/// <para>Loads W values from memory aligned to sizeof(vec) bytes.</para>
+		/// <para>Faults on x86 if 'ptr' is not aligned, NEON has no aligned form and uses load().</para>
+		/// </summary>
+		/// <param name="ptr"></param>
+		/// <returns></returns>
+		[[nodiscard]] static inline vec load_aligned(const T* ptr) noexcept
+		{
+#ifdef TPA_X86_64
+			if constexpr (W == 1uz)
+			{
+				return vec(*ptr);
+			}//End if
+			else if constexpr (std::is_same<T, float>::value)
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_load_ps(ptr)); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_load_ps(ptr)); }
+				else { return vec(_mm_load_ps(ptr)); }
+			}//End if
+			else if constexpr (std::is_same<T, double>::value)
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_load_pd(ptr)); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_load_pd(ptr)); }
+				else { return vec(_mm_load_pd(ptr)); }
+			}//End if
+			else
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_load_si512(ptr)); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_load_si256((const __m256i*)ptr)); }
+				else { return vec(_mm_load_si128((const __m128i*)ptr)); }
+			}//End else
+#else
+			return vec::load(ptr);
+#endif
+		}//End of load_aligned
+
+		/// <summary>
+		/// <para>Stores W values to memory aligned to sizeof(vec) bytes.</para>
+		/// <para>Faults on x86 if 'ptr' is not aligned, NEON has no aligned form and uses store().</para>
+		/// </summary>
+		/// <param name="ptr"></param>
+		inline void store_aligned(T* ptr) const noexcept
+		{
+#ifdef TPA_X86_64
+			if constexpr (W == 1uz)
+			{
+				*ptr = reg;
+			}//End if
+			else if constexpr (std::is_same<T, float>::value)
+			{
+				if constexpr (bytes == 64uz) { _mm512_store_ps(ptr, reg); }
+				else if constexpr (bytes == 32uz) { _mm256_store_ps(ptr, reg); }
+				else { _mm_store_ps(ptr, reg); }
+			}//End if
+			else if constexpr (std::is_same<T, double>::value)
+			{
+				if constexpr (bytes == 64uz) { _mm512_store_pd(ptr, reg); }
+				else if constexpr (bytes == 32uz) { _mm256_store_pd(ptr, reg); }
+				else { _mm_store_pd(ptr, reg); }
+			}//End if
+			else
+			{
+				if constexpr (bytes == 64uz) { _mm512_store_si512(ptr, reg); }
+				else if constexpr (bytes == 32uz) { _mm256_store_si256((__m256i*)ptr, reg); }
+				else { _mm_store_si128((__m128i*)ptr, reg); }
+			}//End else
+#else
+			this->store(ptr);
+#endif
+		}//End of store_aligned
+
+		/// <summary>
+		/// <para>Stores W values to memory aligned to sizeof(vec) bytes with a non-temporal hint, the cache lines are written straight to memory.</para>
+		/// <para>Call tpa::simd::stream_fence() after the last streaming store, before the data is read by another thread.</para>
+		/// <para>Faults on x86 if 'ptr' is not aligned, NEON has no non-temporal store intrinsic and uses store().</para>
+		/// </summary>
+		/// <param name="ptr"></param>
+		inline void store_stream(T* ptr) const noexcept
+		{
+#ifdef TPA_X86_64
+			if constexpr (W == 1uz)
+			{
+				*ptr = reg;
+			}//End if
+			else if constexpr (std::is_same<T, float>::value)
+			{
+				if constexpr (bytes == 64uz) { _mm512_stream_ps(ptr, reg); }
+				else if constexpr (bytes == 32uz) { _mm256_stream_ps(ptr, reg); }
+				else { _mm_stream_ps(ptr, reg); }
+			}//End if
+			else if constexpr (std::is_same<T, double>::value)
+			{
+				if constexpr (bytes == 64uz) { _mm512_stream_pd(ptr, reg); }
+				else if constexpr (bytes == 32uz) { _mm256_stream_pd(ptr, reg); }
+				else { _mm_stream_pd(ptr, reg); }
+			}//End if
+			else
+			{
+				if constexpr (bytes == 64uz) { _mm512_stream_si512((__m512i*)ptr, reg); }
+				else if constexpr (bytes == 32uz) { _mm256_stream_si256((__m256i*)ptr, reg); }
+				else { _mm_stream_si128((__m128i*)ptr, reg); }
+			}//End else
+#else
+			this->store(ptr);
+#endif
+		}//End of store_stream
+
+		/// <summary>
+		/// <para>Loads the first 'n' values (n &lt; W) from memory, the remaining lanes are zero.</para>
+		/// <para>Nothing past the first 'n' values is read, 512-bit vectors use an AVX-512 masked load and other widths copy through the stack.</para>
+		/// </summary>
+		/// <param name="ptr"></param>
+		/// <param name="n"></param>
+		/// <returns></returns>
+		[[nodiscard]] static inline vec load_partial(const T* ptr, const size_t n) noexcept
+		{
+#ifdef TPA_X86_64
+			if constexpr (W != 1uz && bytes == 64uz)
+			{
+				const uint64_t m = (n >= 64uz) ? ~0ull : ((1ull << n) - 1ull);
+
+				if constexpr (std::is_same<T, float>::value) { return vec(_mm512_maskz_loadu_ps(static_cast<__mmask16>(m), ptr)); }
+				else if constexpr (std::is_same<T, double>::value) { return vec(_mm512_maskz_loadu_pd(static_cast<__mmask8>(m), ptr)); }
+				else if constexpr (sizeof(T) == 1uz) { return vec(_mm512_maskz_loadu_epi8(static_cast<__mmask64>(m), ptr)); }
+				else if constexpr (sizeof(T) == 2uz) { return vec(_mm512_maskz_loadu_epi16(static_cast<__mmask32>(m), ptr)); }
+				else if constexpr (sizeof(T) == 4uz) { return vec(_mm512_maskz_loadu_epi32(static_cast<__mmask16>(m), ptr)); }
+				else { return vec(_mm512_maskz_loadu_epi64(static_cast<__mmask8>(m), ptr)); }
+			}//End if
+			else
+#endif
+			{
+				alignas(64) T x[W] = {};
+
+				for (size_t k = 0; k != n; ++k)
+				{
+					x[k] = ptr[k];
+				}//End for
+
+				return vec::load(x);
+			}//End else
+		}//End of load_partial
+
+		/// <summary>
+		/// <para>Stores the first 'n' lanes (n &lt; W) to memory.</para>
+		/// <para>Nothing past the first 'n' values is written, 512-bit vectors use an AVX-512 masked store and other widths copy through the stack.</para>
+		/// </summary>
+		/// <param name="ptr"></param>
+		/// <param name="n"></param>
+		inline void store_partial(T* ptr, const size_t n) const noexcept
+		{
+#ifdef TPA_X86_64
+			if constexpr (W != 1uz && bytes == 64uz)
+			{
+				const uint64_t m = (n >= 64uz) ? ~0ull : ((1ull << n) - 1ull);
+
+				if constexpr (std::is_same<T, float>::value) { _mm512_mask_storeu_ps(ptr, static_cast<__mmask16>(m), reg); }
+				else if constexpr (std::is_same<T, double>::value) { _mm512_mask_storeu_pd(ptr, static_cast<__mmask8>(m), reg); }
+				else if constexpr (sizeof(T) == 1uz) { _mm512_mask_storeu_epi8(ptr, static_cast<__mmask64>(m), reg); }
+				else if constexpr (sizeof(T) == 2uz) { _mm512_mask_storeu_epi16(ptr, static_cast<__mmask32>(m), reg); }
+				else if constexpr (sizeof(T) == 4uz) { _mm512_mask_storeu_epi32(ptr, static_cast<__mmask16>(m), reg); }
+				else { _mm512_mask_storeu_epi64(ptr, static_cast<__mmask8>(m), reg); }
+			}//End if
+			else
+#endif
+			{
+				alignas(64) T x[W];
+				store(x);
+
+				for (size_t k = 0; k != n; ++k)
+				{
+					ptr[k] = x[k];
+				}//End for
+			}//End else
+		}//End of store_partial
+
+		/// <summary>
+		/// <para>Returns a native register with 'val' in every lane.</para>
+		/// </summary>
+		/// <param name="val"></param>
+		/// <returns></returns>
+		[[nodiscard]] static inline native_type broadcast(const T val) noexcept
+		{
+			if constexpr (W == 1uz)
+			{
+				return val;
+			}//End if
+#ifdef TPA_X86_64
+			else if constexpr (std::is_same<T, float>::value)
+			{
+				if constexpr (bytes == 64uz) { return _mm512_set1_ps(val); }
+				else if constexpr (bytes == 32uz) { return _mm256_set1_ps(val); }
+				else { return _mm_set1_ps(val); }
+			}//End if
+			else if constexpr (std::is_same<T, double>::value)
+			{
+				if constexpr (bytes == 64uz) { return _mm512_set1_pd(val); }
+				else if constexpr (bytes == 32uz) { return _mm256_set1_pd(val); }
+				else { return _mm_set1_pd(val); }
+			}//End if
+			else if constexpr (sizeof(T) == 1uz)
+			{
+				if constexpr (bytes == 64uz) { return _mm512_set1_epi8(static_cast<char>(val)); }
+				else if constexpr (bytes == 32uz) { return _mm256_set1_epi8(static_cast<char>(val)); }
+				else { return _mm_set1_epi8(static_cast<char>(val)); }
+			}//End if
+			else if constexpr (sizeof(T) == 2uz)
+			{
+				if constexpr (bytes == 64uz) { return _mm512_set1_epi16(static_cast<short>(val)); }
+				else if constexpr (bytes == 32uz) { return _mm256_set1_epi16(static_cast<short>(val)); }
+				else { return _mm_set1_epi16(static_cast<short>(val)); }
+			}//End if
+			else if constexpr (sizeof(T) == 4uz)
+			{
+				if constexpr (bytes == 64uz) { return _mm512_set1_epi32(static_cast<int>(val)); }
+				else if constexpr (bytes == 32uz) { return _mm256_set1_epi32(static_cast<int>(val)); }
+				else { return _mm_set1_epi32(static_cast<int>(val)); }
+			}//End if
+			else
+			{
+				if constexpr (bytes == 64uz) { return _mm512_set1_epi64(static_cast<long long>(val)); }
+				else if constexpr (bytes == 32uz) { return _mm256_set1_epi64x(static_cast<long long>(val)); }
+				else { return _mm_set1_epi64x(static_cast<long long>(val)); }
+			}//End else
+#elif defined(TPA_NEON)
+			else
+			{
+				return tpa_neon_private::dup<T, native_type>(val);
+			}//End else
+#endif
+		}//End of broadcast
+
+		/// <summary>
+		/// <para>Returns the value of lane 'k'.</para>
+		/// <para>Note: This is slow, it is intended for reductions and debugging not for use inside a kernel's loop.</para>
+		/// </summary>
+		/// <param name="k"></param>
+		/// <returns></returns>
+		[[nodiscard]] inline T operator[](const size_t k) const noexcept
+		{
+			if constexpr (W == 1uz)
+			{
+				return reg;
+			}//End if
+			else
+			{
+				alignas(64) T x[W];
+				store(x);
+
+				return x[k];
+			}//End else
+		}//End operator[]
+#pragma endregion
+
+#pragma region lanewise
+		/// <summary>
+		/// <para>Applies a scalar function to every lane of 'a', used where no SIMD instruction exists.</para>
+		/// </summary>
+		/// <typeparam name="FUNC"></typeparam>
+		/// <param name="a"></param>
+		/// <param name="func"></param>
+		/// <returns></returns>
+		template<typename FUNC>
+		[[nodiscard]] static inline vec lanewise(const vec a, const FUNC& func) noexcept
+		{
+			alignas(64) T x[W];
+			a.store(x);
+
+			for (size_t k = 0; k != W; ++k)
+			{
+				x[k] = static_cast<T>(func(x[k]));
+			}//End for
+
+			return vec::load(x);
+		}//End of lanewise
+
+		/// <summary>
+		/// <para>Applies a scalar function to every pair of lanes in 'a' and 'b', used where no SIMD instruction exists.</para>
+		/// </summary>
+		/// <typeparam name="FUNC"></typeparam>
+		/// <param name="a"></param>
+		/// <param name="b"></param>
+		/// <param name="func"></param>
+		/// <returns></returns>
+		template<typename FUNC>
+		[[nodiscard]] static inline vec lanewise(const vec a, const vec b, const FUNC& func) noexcept
+		{
+			alignas(64) T x[W];
+			alignas(64) T y[W];
+			a.store(x);
+			b.store(y);
+
+			for (size_t k = 0; k != W; ++k)
+			{
+				x[k] = static_cast<T>(func(x[k], y[k]));
+			}//End for
+
+			return vec::load(x);
+		}//End of lanewise
+#pragma endregion
+
+#pragma region arithmetic
+		[[nodiscard]] friend inline vec operator+(const vec a, const vec b) noexcept
+		{
+			if constexpr (W == 1uz)
+			{
+				return vec(static_cast<T>(a.reg + b.reg));
+			}//End if
+#ifdef TPA_X86_64
+			else if constexpr (std::is_same<T, float>::value)
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_add_ps(a.reg, b.reg)); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_add_ps(a.reg, b.reg)); }
+				else { return vec(_mm_add_ps(a.reg, b.reg)); }
+			}//End if
+			else if constexpr (std::is_same<T, double>::value)
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_add_pd(a.reg, b.reg)); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_add_pd(a.reg, b.reg)); }
+				else { return vec(_mm_add_pd(a.reg, b.reg)); }
+			}//End if
+			else if constexpr (sizeof(T) == 1uz)
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_add_epi8(a.reg, b.reg)); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_add_epi8(a.reg, b.reg)); }
+				else { return vec(_mm_add_epi8(a.reg, b.reg)); }
+			}//End if
+			else if constexpr (sizeof(T) == 2uz)
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_add_epi16(a.reg, b.reg)); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_add_epi16(a.reg, b.reg)); }
+				else { return vec(_mm_add_epi16(a.reg, b.reg)); }
+			}//End if
+			else if constexpr (sizeof(T) == 4uz)
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_add_epi32(a.reg, b.reg)); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_add_epi32(a.reg, b.reg)); }
+				else { return vec(_mm_add_epi32(a.reg, b.reg)); }
+			}//End if
+			else
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_add_epi64(a.reg, b.reg)); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_add_epi64(a.reg, b.reg)); }
+				else { return vec(_mm_add_epi64(a.reg, b.reg)); }
+			}//End else
+#elif defined(TPA_NEON)
+			else
+			{
+				return vec(tpa_neon_private::add<T>(a.reg, b.reg));
+			}//End else
+#endif
+		}//End of operator+
+
+		[[nodiscard]] friend inline vec operator-(const vec a, const vec b) noexcept
+		{
+			if constexpr (W == 1uz)
+			{
+				return vec(static_cast<T>(a.reg - b.reg));
+			}//End if
+#ifdef TPA_X86_64
+			else if constexpr (std::is_same<T, float>::value)
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_sub_ps(a.reg, b.reg)); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_sub_ps(a.reg, b.reg)); }
+				else { return vec(_mm_sub_ps(a.reg, b.reg)); }
+			}//End if
+			else if constexpr (std::is_same<T, double>::value)
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_sub_pd(a.reg, b.reg)); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_sub_pd(a.reg, b.reg)); }
+				else { return vec(_mm_sub_pd(a.reg, b.reg)); }
+			}//End if
+			else if constexpr (sizeof(T) == 1uz)
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_sub_epi8(a.reg, b.reg)); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_sub_epi8(a.reg, b.reg)); }
+				else { return vec(_mm_sub_epi8(a.reg, b.reg)); }
+			}//End if
+			else if constexpr (sizeof(T) == 2uz)
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_sub_epi16(a.reg, b.reg)); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_sub_epi16(a.reg, b.reg)); }
+				else { return vec(_mm_sub_epi16(a.reg, b.reg)); }
+			}//End if
+			else if constexpr (sizeof(T) == 4uz)
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_sub_epi32(a.reg, b.reg)); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_sub_epi32(a.reg, b.reg)); }
+				else { return vec(_mm_sub_epi32(a.reg, b.reg)); }
+			}//End if
+			else
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_sub_epi64(a.reg, b.reg)); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_sub_epi64(a.reg, b.reg)); }
+				else { return vec(_mm_sub_epi64(a.reg, b.reg)); }
+			}//End else
+#elif defined(TPA_NEON)
+			else
+			{
+				return vec(tpa_neon_private::sub<T>(a.reg, b.reg));
+			}//End else
+#endif
+		}//End of operator-
+
+		[[nodiscard]] friend inline vec operator*(const vec a, const vec b) noexcept
+		{
+			if constexpr (W == 1uz)
+			{
+				return vec(static_cast<T>(a.reg * b.reg));
+			}//End if
+#ifdef TPA_X86_64
+			else if constexpr (std::is_same<T, float>::value)
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_mul_ps(a.reg, b.reg)); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_mul_ps(a.reg, b.reg)); }
+				else { return vec(_mm_mul_ps(a.reg, b.reg)); }
+			}//End if
+			else if constexpr (std::is_same<T, double>::value)
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_mul_pd(a.reg, b.reg)); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_mul_pd(a.reg, b.reg)); }
+				else { return vec(_mm_mul_pd(a.reg, b.reg)); }
+			}//End if
+			else if constexpr (sizeof(T) == 1uz)
+			{
+				if constexpr (bytes == 64uz) { return vec(tpa::simd::_mm512_mullo_epi8(a.reg, b.reg)); }
+				else if constexpr (bytes == 32uz) { return vec(tpa::simd::_mm256_mullo_epi8(a.reg, b.reg)); }
+				else { return vec(tpa::simd::_mm_mullo_epi8(a.reg, b.reg)); }
+			}//End if
+			else if constexpr (sizeof(T) == 2uz)
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_mullo_epi16(a.reg, b.reg)); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_mullo_epi16(a.reg, b.reg)); }
+				else { return vec(_mm_mullo_epi16(a.reg, b.reg)); }
+			}//End if
+			else if constexpr (sizeof(T) == 4uz)
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_mullo_epi32(a.reg, b.reg)); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_mullo_epi32(a.reg, b.reg)); }
+				else { return vec(_mm_mullo_epi32(a.reg, b.reg)); }
+			}//End if
+			else
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_mullox_epi64(a.reg, b.reg)); }
+				else if constexpr (bytes == 32uz) { return vec(tpa::simd::_mm256_mul_epi64(a.reg, b.reg)); }
+				else { return vec(tpa::simd::_mm_mul_epi64(a.reg, b.reg)); }
+			}//End else
+#elif defined(TPA_NEON)
+			else
+			{
+				return vec(tpa_neon_private::mul<T>(a.reg, b.reg));
+			}//End else
+#endif
+		}//End of operator*
+
+		[[nodiscard]] friend inline vec operator/(const vec a, const vec b) noexcept
+		{
+			if constexpr (W == 1uz)
+			{
+				return vec(static_cast<T>(a.reg / b.reg));
+			}//End if
+#ifdef TPA_X86_64
+			else if constexpr (std::is_same<T, float>::value)
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_div_ps(a.reg, b.reg)); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_div_ps(a.reg, b.reg)); }
+				else { return vec(_mm_div_ps(a.reg, b.reg)); }
+			}//End if
+			else if constexpr (std::is_same<T, double>::value)
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_div_pd(a.reg, b.reg)); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_div_pd(a.reg, b.reg)); }
+				else { return vec(_mm_div_pd(a.reg, b.reg)); }
+			}//End if
+#elif defined(TPA_NEON)
+			else if constexpr (std::is_same<T, float>::value)
+			{
+				return vec(vdivq_f32(a.reg, b.reg));
+			}//End if
+			else if constexpr (std::is_same<T, double>::value)
+			{
+				return vec(vdivq_f64(a.reg, b.reg));
+			}//End if
+#endif
+			else
+			{
+				//No SIMD integer division, divide by a runtime-invariant divisor with tpa::simd::int_divider instead
+				return vec::lanewise(a, b, [](const T x, const T y) { return x / y; });
+			}//End else
+		}//End of operator/
+
+		[[nodiscard]] friend inline vec operator-(const vec a) noexcept
+		{
+			if constexpr (W == 1uz)
+			{
+				return vec(static_cast<T>(-a.reg));
+			}//End if
+			else if constexpr (std::is_unsigned<T>::value)
+			{
+				return vec(static_cast<T>(0)) - a;
+			}//End if
+#ifdef TPA_X86_64
+			else if constexpr (std::is_same<T, float>::value)
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a.reg), _mm512_set1_epi32(static_cast<int>(0x80000000))))); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_xor_ps(a.reg, _mm256_set1_ps(-0.0f))); }
+				else { return vec(_mm_xor_ps(a.reg, _mm_set1_ps(-0.0f))); }
+			}//End if
+			else if constexpr (std::is_same<T, double>::value)
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(a.reg), _mm512_set1_epi64(static_cast<long long>(0x8000000000000000ull))))); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_xor_pd(a.reg, _mm256_set1_pd(-0.0))); }
+				else { return vec(_mm_xor_pd(a.reg, _mm_set1_pd(-0.0))); }
+			}//End if
+			else
+			{
+				return vec(static_cast<T>(0)) - a;
+			}//End else
+#elif defined(TPA_NEON)
+			else
+			{
+				return vec(tpa_neon_private::neg<T>(a.reg));
+			}//End else
+#endif
+		}//End of operator- (unary)
+
+		[[nodiscard]] friend inline vec operator+(const vec a, const T b) noexcept { return a + vec(vec::broadcast(b)); }
+		[[nodiscard]] friend inline vec operator-(const vec a, const T b) noexcept { return a - vec(vec::broadcast(b)); }
+		[[nodiscard]] friend inline vec operator*(const vec a, const T b) noexcept { return a * vec(vec::broadcast(b)); }
+		[[nodiscard]] friend inline vec operator/(const vec a, const T b) noexcept { return a / vec(vec::broadcast(b)); }
+
+		[[nodiscard]] friend inline vec operator+(const T a, const vec b) noexcept { return vec(vec::broadcast(a)) + b; }
+		[[nodiscard]] friend inline vec operator-(const T a, const vec b) noexcept { return vec(vec::broadcast(a)) - b; }
+		[[nodiscard]] friend inline vec operator*(const T a, const vec b) noexcept { return vec(vec::broadcast(a)) * b; }
+		[[nodiscard]] friend inline vec operator/(const T a, const vec b) noexcept { return vec(vec::broadcast(a)) / b; }
+
+		inline vec& operator+=(const vec b) noexcept { return *this = *this + b; }
+		inline vec& operator-=(const vec b) noexcept { return *this = *this - b; }
+		inline vec& operator*=(const vec b) noexcept { return *this = *this * b; }
+		inline vec& operator/=(const vec b) noexcept { return *this = *this / b; }
+#pragma endregion
+
+#pragma region bitwise
+		/// <summary>
+		/// <para>Bitwise operations on the raw bits of every lane, 'OP' is 0 for AND, 1 for OR, 2 for XOR and 3 for NOT.</para>
+		/// <para>Floating-point lanes are operated on as their IEEE-754 bit patterns.</para>
+		/// </summary>
+		template<int OP>
+		[[nodiscard]] static inline vec bitwise(const vec a, const vec b) noexcept
+		{
+			if constexpr (W == 1uz)
+			{
+				using U = std::conditional_t<sizeof(T) == 1uz, uint8_t, std::conditional_t<sizeof(T) == 2uz, uint16_t, std::conditional_t<sizeof(T) == 4uz, uint32_t, uint64_t>>>;
+
+				const U x = std::bit_cast<U>(a.reg);
+				const U y = std::bit_cast<U>(b.reg);
+
+				if constexpr (OP == 0) { return vec(std::bit_cast<T>(static_cast<U>(x & y))); }
+				else if constexpr (OP == 1) { return vec(std::bit_cast<T>(static_cast<U>(x | y))); }
+				else if constexpr (OP == 2) { return vec(std::bit_cast<T>(static_cast<U>(x ^ y))); }
+				else { return vec(std::bit_cast<T>(static_cast<U>(~x))); }
+			}//End if
+#ifdef TPA_X86_64
+			else if constexpr (bytes == 64uz)
+			{
+				__m512i x, y, r;
+
+				if constexpr (std::is_same<T, float>::value) { x = _mm512_castps_si512(a.reg); y = _mm512_castps_si512(b.reg); }
+				else if constexpr (std::is_same<T, double>::value) { x = _mm512_castpd_si512(a.reg); y = _mm512_castpd_si512(b.reg); }
+				else { x = a.reg; y = b.reg; }
+
+				if constexpr (OP == 0) { r = _mm512_and_si512(x, y); }
+				else if constexpr (OP == 1) { r = _mm512_or_si512(x, y); }
+				else if constexpr (OP == 2) { r = _mm512_xor_si512(x, y); }
+				else { r = tpa::simd::_mm512_not_si512(x); }
+
+				if constexpr (std::is_same<T, float>::value) { return vec(_mm512_castsi512_ps(r)); }
+				else if constexpr (std::is_same<T, double>::value) { return vec(_mm512_castsi512_pd(r)); }
+				else { return vec(r); }
+			}//End if
+			else
+			{
+				//Below AVX-512 a mask is held in the same register type as the vec
+				const mask_type r = mask_type::template bitwise<OP>(mask_type(a.reg), mask_type(b.reg));
+				return vec(r.reg);
+			}//End else
+#elif defined(TPA_NEON)
+			else
+			{
+				return vec(tpa_neon_private::from_unsigned<T, native_type>(tpa_neon_private::bitwise<T, OP>(tpa_neon_private::as_unsigned<T>(a.reg), tpa_neon_private::as_unsigned<T>(b.reg))));
+			}//End else
+#endif
+		}//End of bitwise
+
+		[[nodiscard]] friend inline vec operator&(const vec a, const vec b) noexcept { return vec::bitwise<0>(a, b); }
+		[[nodiscard]] friend inline vec operator|(const vec a, const vec b) noexcept { return vec::bitwise<1>(a, b); }
+		[[nodiscard]] friend inline vec operator^(const vec a, const vec b) noexcept { return vec::bitwise<2>(a, b); }
+		[[nodiscard]] friend inline vec operator~(const vec a) noexcept { return vec::bitwise<3>(a, a); }
+
+		/// <summary>
+		/// <para>Shifts every lane left by 'n' bits.</para>
+		/// </summary>
+		[[nodiscard]] friend inline vec operator<<(const vec a, const int n) noexcept requires std::is_integral<T>::value
+		{
+			if constexpr (W == 1uz)
+			{
+				return vec(static_cast<T>(a.reg << n));
+			}//End if
+#ifdef TPA_X86_64
+			else if constexpr (sizeof(T) == 1uz)
+			{
+				return vec::lanewise(a, [n](const T x) { return x << n; });
+			}//End if
+			else if constexpr (sizeof(T) == 2uz)
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_sll_epi16(a.reg, _mm_cvtsi32_si128(n))); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_sll_epi16(a.reg, _mm_cvtsi32_si128(n))); }
+				else { return vec(_mm_sll_epi16(a.reg, _mm_cvtsi32_si128(n))); }
+			}//End if
+			else if constexpr (sizeof(T) == 4uz)
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_sll_epi32(a.reg, _mm_cvtsi32_si128(n))); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_sll_epi32(a.reg, _mm_cvtsi32_si128(n))); }
+				else { return vec(_mm_sll_epi32(a.reg, _mm_cvtsi32_si128(n))); }
+			}//End if
+			else
+			{
+				if constexpr (bytes == 64uz) { return vec(_mm512_sll_epi64(a.reg, _mm_cvtsi32_si128(n))); }
+				else if constexpr (bytes == 32uz) { return vec(_mm256_sll_epi64(a.reg, _mm_cvtsi32_si128(n))); }
+				else { return vec(_mm_sll_epi64(a.reg, _mm_cvtsi32_si128(n))); }
+			}//End else
+#elif defined(TPA_NEON)
+			else
+			{
+				return vec(tpa_neon_private::shift<T>(a.reg, n));
+			}//End else
+#endif
+		}//End of operator<<
+
+		/// <summary>
+		/// <para>Shifts every lane right by 'n' bits, arithmetic for signed types and logical for unsigned types.</para>
+		/// </summary>
+		[[nodiscard]] friend inline vec operator>>(const vec a, const int n) noexcept requires std::is_integral<T>::value
+		{
+			if constexpr (W == 1uz)
+			{
+				return vec(static_cast<T>(a.reg >> n));
+			}//End if
+#ifdef TPA_X86_64
+			else if constexpr (sizeof(T) == 1uz)
+			{
+				return vec::lanewise(a, [n](const T x) { return x >> n; });
+			}//End if
+			else if constexpr (sizeof(T) == 2uz)
+			{
+				if constexpr (std::is_signed<T>::value)
+				{
+					if constexpr (bytes == 64uz) { return vec(_mm512_sra_epi16(a.reg, _mm_cvtsi32_si128(n))); }
+					else if constexpr (bytes == 32uz) { return vec(_mm256_sra_epi16(a.reg, _mm_cvtsi32_si128(n))); }
+					else { return vec(_mm_sra_epi16(a.reg, _mm_cvtsi32_si128(n))); }
+				}//End if
+				else
+				{
+					if constexpr (bytes == 64uz) { return vec(_mm512_srl_epi16(a.reg, _mm_cvtsi32_si128(n))); }
+					else if constexpr (bytes == 32uz) { return vec(_mm256_srl_epi16(a.reg, _mm_cvtsi32_si128(n))); }
+					else { return vec(_mm_srl_epi16(a.reg, _mm_cvtsi32_si128(n))); }
+				}//End else
+			}//End if
+			else if constexpr (sizeof(T) == 4uz)
+			{
+				if constexpr (std::is_signed<T>::value)
+				{
+					if constexpr (bytes == 64uz) { return vec(_mm512_sra_epi32(a.reg, _mm_cvtsi32_si128(n))); }
+					else if constexpr (bytes == 32uz) { return vec(_mm256_sra_epi32(a.reg, _mm_cvtsi32_si128(n))); }
+					else { return vec(_mm_sra_epi32(a.reg, _mm_cvtsi32_si128(n))); }
+				}//End if
+				else
+				{
+					if constexpr (bytes == 64uz) { return vec(_mm512_srl_epi32(a.reg, _mm_cvtsi32_si128(n))); }
+					else if constexpr (bytes == 32uz) { return vec(_mm256_srl_epi32(a.reg, _mm_cvtsi32_si128(n))); }
+					else { return vec(_mm_srl_epi32(a.reg, _mm_cvtsi32_si128(n))); }
+				}//End else
+			}//End if
+			else
+			{
+				if constexpr (std::is_signed<T>::value)
+				{
+					//No 64-bit arithmetic shift below AVX-512
+					if constexpr (bytes == 64uz) { return vec(_mm512_sra_epi64(a.reg, _mm_cvtsi32_si128(n))); }
+					else { return vec::lanewise(a, [n](const T x) { return x >> n; }); }
+				}//End if
+				else
+				{
+					if constexpr (bytes == 64uz) { return vec(_mm512_srl_epi64(a.reg, _mm_cvtsi32_si128(n))); }
+					else if constexpr (bytes == 32uz) { return vec(_mm256_srl_epi64(a.reg, _mm_cvtsi32_si128(n))); }
+					else { return vec(_mm_srl_epi64(a.reg, _mm_cvtsi32_si128(n))); }
+				}//End else
+			}//End else
+#elif defined(TPA_NEON)
+			else
+			{
+				return vec(tpa_neon_private::shift<T>(a.reg, -n));
+			}//End else
+#endif
+		}//End of operator>>
+#pragma endregion
+
+#pragma region compare
+		/// <summary>
+		/// <para>Compares 'a' and 'b' lane by lane using the tpa::comp predicate 'PRED'.</para>
+		/// <para>Floating-point comparisons are ordered, any comparison with NaN is false except NOT_EQUAL.</para>
+		/// </summary>
+		template<tpa::comp PRED>
+		[[nodiscard]] static inline mask_type compare(const vec a, const vec b) noexcept
+		{
+			if constexpr (PRED == tpa::comp::MIN || PRED == tpa::comp::MAX)
+			{
+				[] <bool flag = false>()
+				{
+					static_assert(flag, " You have specifed an invalid predicate in tpa::simd::vec::compare<__UNDEFINED_PREDICATE__>, use tpa::simd::min or tpa::simd::max.");
+				}();
+			}//End if
+			else if constexpr (W == 1uz)
+			{
+				if constexpr (PRED == tpa::comp::EQUAL) { return mask_type(a.reg == b.reg); }
+				else if constexpr (PRED == tpa::comp::NOT_EQUAL) { return mask_type(a.reg != b.reg); }
+				else if constexpr (PRED == tpa::comp::LESS_THAN) { return mask_type(a.reg < b.reg); }
+				else if constexpr (PRED == tpa::comp::LESS_THAN_OR_EQUAL) { return mask_type(a.reg <= b.reg); }
+				else if constexpr (PRED == tpa::comp::GREATER_THAN) { return mask_type(a.reg > b.reg); }
+				else { return mask_type(a.reg >= b.reg); }
+			}//End if
+#ifdef TPA_X86_64
+			else if constexpr (std::is_floating_point<T>::value && bytes != 16uz)
+			{
+				constexpr int imm =
+					(PRED == tpa::comp::EQUAL) ? _CMP_EQ_OQ :
+					(PRED == tpa::comp::NOT_EQUAL) ? _CMP_NEQ_UQ :
+					(PRED == tpa::comp::LESS_THAN) ? _CMP_LT_OQ :
+					(PRED == tpa::comp::LESS_THAN_OR_EQUAL) ? _CMP_LE_OQ :
+					(PRED == tpa::comp::GREATER_THAN) ? _CMP_GT_OQ : _CMP_GE_OQ;
+
+				if constexpr (std::is_same<T, float>::value)
+				{
+					if constexpr (bytes == 64uz) { return mask_type(_mm512_cmp_ps_mask(a.reg, b.reg, imm)); }
+					else { return mask_type(_mm256_cmp_ps(a.reg, b.reg, imm)); }
+				}//End if
+				else
+				{
+					if constexpr (bytes == 64uz) { return mask_type(_mm512_cmp_pd_mask(a.reg, b.reg, imm)); }
+					else { return mask_type(_mm256_cmp_pd(a.reg, b.reg, imm)); }
+				}//End else
+			}//End if
+			else if constexpr (std::is_same<T, float>::value)
+			{
+				if constexpr (PRED == tpa::comp::EQUAL) { return mask_type(_mm_cmpeq_ps(a.reg, b.reg)); }
+				else if constexpr (PRED == tpa::comp::NOT_EQUAL) { return mask_type(_mm_cmpneq_ps(a.reg, b.reg)); }
+				else if constexpr (PRED == tpa::comp::LESS_THAN) { return mask_type(_mm_cmplt_ps(a.reg, b.reg)); }
+				else if constexpr (PRED == tpa::comp::LESS_THAN_OR_EQUAL) { return mask_type(_mm_cmple_ps(a.reg, b.reg)); }
+				else if constexpr (PRED == tpa::comp::GREATER_THAN) { return mask_type(_mm_cmpgt_ps(a.reg, b.reg)); }
+				else { return mask_type(_mm_cmpge_ps(a.reg, b.reg)); }
+			}//End if
+			else if constexpr (std::is_same<T, double>::value)
+			{
+				if constexpr (PRED == tpa::comp::EQUAL) { return mask_type(_mm_cmpeq_pd(a.reg, b.reg)); }
+				else if constexpr (PRED == tpa::comp::NOT_EQUAL) { return mask_type(_mm_cmpneq_pd(a.reg, b.reg)); }
+				else if constexpr (PRED == tpa::comp::LESS_THAN) { return mask_type(_mm_cmplt_pd(a.reg, b.reg)); }
+				else if constexpr (PRED == tpa::comp::LESS_THAN_OR_EQUAL) { return mask_type(_mm_cmple_pd(a.reg, b.reg)); }
+				else if constexpr (PRED == tpa::comp::GREATER_THAN) { return mask_type(_mm_cmpgt_pd(a.reg, b.reg)); }
+				else { return mask_type(_mm_cmpge_pd(a.reg, b.reg)); }
+			}//End if
+			else if constexpr (bytes == 64uz)
+			{
+				constexpr int imm =
+					(PRED == tpa::comp::EQUAL) ? _MM_CMPINT_EQ :
+					(PRED == tpa::comp::NOT_EQUAL) ? _MM_CMPINT_NE :
+					(PRED == tpa::comp::LESS_THAN) ? _MM_CMPINT_LT :
+					(PRED == tpa::comp::LESS_THAN_OR_EQUAL) ? _MM_CMPINT_LE :
+					(PRED == tpa::comp::GREATER_THAN) ? _MM_CMPINT_NLE : _MM_CMPINT_NLT;
+
+				if constexpr (std::is_signed<T>::value)
+				{
+					if constexpr (sizeof(T) == 1uz) { return mask_type(_mm512_cmp_epi8_mask(a.reg, b.reg, imm)); }
+					else if constexpr (sizeof(T) == 2uz) { return mask_type(_mm512_cmp_epi16_mask(a.reg, b.reg, imm)); }
+					else if constexpr (sizeof(T) == 4uz) { return mask_type(_mm512_cmp_epi32_mask(a.reg, b.reg, imm)); }
+					else { return mask_type(_mm512_cmp_epi64_mask(a.reg, b.reg, imm)); }
+				}//End if
+				else
+				{
+					if constexpr (sizeof(T) == 1uz) { return mask_type(_mm512_cmp_epu8_mask(a.reg, b.reg, imm)); }
+					else if constexpr (sizeof(T) == 2uz) { return mask_type(_mm512_cmp_epu16_mask(a.reg, b.reg, imm)); }
+					else if constexpr (sizeof(T) == 4uz) { return mask_type(_mm512_cmp_epu32_mask(a.reg, b.reg, imm)); }
+					else { return mask_type(_mm512_cmp_epu64_mask(a.reg, b.reg, imm)); }
+				}//End else
+			}//End if
+			else
+			{
+				//AVX2 and SSE only have signed equal and greater than, everything else is derived from those
+				if constexpr (PRED == tpa::comp::EQUAL) { return mask_type(vec::int_eq(a, b)); }
+				else if constexpr (PRED == tpa::comp::NOT_EQUAL) { return ~mask_type(vec::int_eq(a, b)); }
+				else if constexpr (PRED == tpa::comp::LESS_THAN) { return mask_type(vec::int_gt(b, a)); }
+				else if constexpr (PRED == tpa::comp::LESS_THAN_OR_EQUAL) { return ~mask_type(vec::int_gt(a, b)); }
+				else if constexpr (PRED == tpa::comp::GREATER_THAN) { return mask_type(vec::int_gt(a, b)); }
+				else { return ~mask_type(vec::int_gt(b, a)); }
+			}//End else
+#elif defined(TPA_NEON)
+			else
+			{
+				if constexpr (PRED == tpa::comp::EQUAL) { return mask_type(tpa_neon_private::cmpeq<T>(a.reg, b.reg)); }
+				else if constexpr (PRED == tpa::comp::NOT_EQUAL) { return ~mask_type(tpa_neon_private::cmpeq<T>(a.reg, b.reg)); }
+				else if constexpr (PRED == tpa::comp::LESS_THAN) { return mask_type(tpa_neon_private::cmpgt<T>(b.reg, a.reg)); }
+				else if constexpr (PRED == tpa::comp::LESS_THAN_OR_EQUAL) { return mask_type(tpa_neon_private::cmpge<T>(b.reg, a.reg)); }
+				else if constexpr (PRED == tpa::comp::GREATER_THAN) { return mask_type(tpa_neon_private::cmpgt<T>(a.reg, b.reg)); }
+				else { return mask_type(tpa_neon_private::cmpge<T>(a.reg, b.reg)); }
+			}//End else
+#endif
+		}//End of compare
+
+#ifdef TPA_X86_64
+		/// <summary>
+		/// AVX2 / SSE integer equality, all ones in each equal lane
+		/// </summary>
+		[[nodiscard]] static inline native_type int_eq(const vec a, const vec b) noexcept
+		{
+			if constexpr (bytes == 32uz)
+			{
+				if constexpr (sizeof(T) == 1uz) { return _mm256_cmpeq_epi8(a.reg, b.reg); }
+				else if constexpr (sizeof(T) == 2uz) { return _mm256_cmpeq_epi16(a.reg, b.reg); }
+				else if constexpr (sizeof(T) == 4uz) { return _mm256_cmpeq_epi32(a.reg, b.reg); }
+				else { return _mm256_cmpeq_epi64(a.reg, b.reg); }
+			}//End if
+			else
+			{
+				if constexpr (sizeof(T) == 1uz) { return _mm_cmpeq_epi8(a.reg, b.reg); }
+				else if constexpr (sizeof(T) == 2uz) { return _mm_cmpeq_epi16(a.reg, b.reg); }
+				else if constexpr (sizeof(T) == 4uz) { return _mm_cmpeq_epi32(a.reg, b.reg); }
+				else { return _mm_cmpeq_epi64(a.reg, b.reg); }
+			}//End else
+		}//End of int_eq
+
+		/// <summary>
+		/// AVX2 / SSE integer greater than, unsigned lanes are compared by flipping the sign bit
+		/// </summary>
+		[[nodiscard]] static inline native_type int_gt(const vec a, const vec b) noexcept
+		{
+			native_type x = a.reg;
+			native_type y = b.reg;
+
+			if constexpr (std::is_unsigned<T>::value)
+			{
+				const native_type sign = vec::broadcast(static_cast<T>(static_cast<T>(1) << (sizeof(T) * 8uz - 1uz)));
+
+				if constexpr (bytes == 32uz) { x = _mm256_xor_si256(x, sign); y = _mm256_xor_si256(y, sign); }
+				else { x = _mm_xor_si128(x, sign); y = _mm_xor_si128(y, sign); }
+			}//End if
+
+			if constexpr (bytes == 32uz)
+			{
+				if constexpr (sizeof(T) == 1uz) { return _mm256_cmpgt_epi8(x, y); }
+				else if constexpr (sizeof(T) == 2uz) { return _mm256_cmpgt_epi16(x, y); }
+				else if constexpr (sizeof(T) == 4uz) { return _mm256_cmpgt_epi32(x, y); }
+				else { return _mm256_cmpgt_epi64(x, y); }
+			}//End if
+			else
+			{
+				if constexpr (sizeof(T) == 1uz) { return _mm_cmpgt_epi8(x, y); }
+				else if constexpr (sizeof(T) == 2uz) { return _mm_cmpgt_epi16(x, y); }
+				else if constexpr (sizeof(T) == 4uz) { return _mm_cmpgt_epi32(x, y); }
+				else { return _mm_cmpgt_epi64(x, y); }
+			}//End else
+		}//End of int_gt
+#endif
+
+		[[nodiscard]] friend inline mask_type operator==(const vec a, const vec b) noexcept { return vec::compare<tpa::comp::EQUAL>(a, b); }
+		[[nodiscard]] friend inline mask_type operator!=(const vec a, const vec b) noexcept { return vec::compare<tpa::comp::NOT_EQUAL>(a, b); }
+		[[nodiscard]] friend inline mask_type operator<(const vec a, const vec b) noexcept { return vec::compare<tpa::comp::LESS_THAN>(a, b); }
+		[[nodiscard]] friend inline mask_type operator<=(const vec a, const vec b) noexcept { return vec::compare<tpa::comp::LESS_THAN_OR_EQUAL>(a, b); }
+		[[nodiscard]] friend inline mask_type operator>(const vec a, const vec b) noexcept { return vec::compare<tpa::comp::GREATER_THAN>(a, b); }
+		[[nodiscard]] friend inline mask_type operator>=(const vec a, const vec b) noexcept { return vec::compare<tpa::comp::GREATER_THAN_OR_EQUAL>(a, b); }
+
+		[[nodiscard]] friend inline mask_type operator==(const vec a, const T b) noexcept { return a == vec(vec::broadcast(b)); }
+		[[nodiscard]] friend inline mask_type operator!=(const vec a, const T b) noexcept { return a != vec(vec::broadcast(b)); }
+		[[nodiscard]] friend inline mask_type operator<(const vec a, const T b) noexcept { return a < vec(vec::broadcast(b)); }
+		[[nodiscard]] friend inline mask_type operator<=(const vec a, const T b) noexcept { return a <= vec(vec::broadcast(b)); }
+		[[nodiscard]] friend inline mask_type operator>(const vec a, const T b) noexcept { return a > vec(vec::broadcast(b)); }
+		[[nodiscard]] friend inline mask_type operator>=(const vec a, const T b) noexcept { return a >= vec(vec::broadcast(b)); }
+#pragma endregion
+	};//End of vec
+
+#pragma region vec_functions
+	/// <summary>
+	/// <para>Lane-wise selection, returns 'a' in each lane where 'm' is set and 'b' elsewhere.</para>
+	/// </summary>
+	template<typename T, size_t W>
+	requires (tpa::simd::register_bytes<T, W> == TPA_VEC_BYTES)
+	[[nodiscard]] inline vec<T, W> select(const mask<T, W> m, const vec<T, W> a, const vec<T, W> b) noexcept
+	{
+		using V = vec<T, W>;
+		constexpr size_t bytes = V::bytes;
+
+		if constexpr (W == 1uz)
+		{
+			return m.reg ? a : b;
+		}//End if
+#ifdef TPA_X86_64
+		else if constexpr (bytes == 64uz)
+		{
+			if constexpr (std::is_same<T, float>::value) { return V(_mm512_mask_blend_ps(m.reg, b.reg, a.reg)); }
+			else if constexpr (std::is_same<T, double>::value) { return V(_mm512_mask_blend_pd(m.reg, b.reg, a.reg)); }
+			else if constexpr (sizeof(T) == 1uz) { return V(_mm512_mask_blend_epi8(m.reg, b.reg, a.reg)); }
+			else if constexpr (sizeof(T) == 2uz) { return V(_mm512_mask_blend_epi16(m.reg, b.reg, a.reg)); }
+			else if constexpr (sizeof(T) == 4uz) { return V(_mm512_mask_blend_epi32(m.reg, b.reg, a.reg)); }
+			else { return V(_mm512_mask_blend_epi64(m.reg, b.reg, a.reg)); }
+		}//End if
+		else if constexpr (bytes == 32uz)
+		{
+			if constexpr (std::is_same<T, float>::value) { return V(_mm256_blendv_ps(b.reg, a.reg, m.reg)); }
+			else if constexpr (std::is_same<T, double>::value) { return V(_mm256_blendv_pd(b.reg, a.reg, m.reg)); }
+			else { return V(_mm256_blendv_epi8(b.reg, a.reg, m.reg)); }
+		}//End if
+		else
+		{
+			//SSE floats do not require SSE4.1 so blend with and / andnot
+			if constexpr (std::is_same<T, float>::value) { return V(_mm_or_ps(_mm_and_ps(m.reg, a.reg), _mm_andnot_ps(m.reg, b.reg))); }
+			else if constexpr (std::is_same<T, double>::value) { return V(_mm_or_pd(_mm_and_pd(m.reg, a.reg), _mm_andnot_pd(m.reg, b.reg))); }
+			else { return V(_mm_blendv_epi8(b.reg, a.reg, m.reg)); }
+		}//End else
+#elif defined(TPA_NEON)
+		else
+		{
+			return V(tpa_neon_private::select<T>(m.reg, a.reg, b.reg));
+		}//End else
+#endif
+	}//End of select
+
+	/// <summary>
+	/// <para>Reinterprets a mask of T as a mask of U, a lane type of the same size, so that a comparison of one vec can select lanes of another.</para>
+	/// <para>e.g. tpa::simd::select(tpa::simd::mask_cast&lt;uint32_t&gt;(values &lt; best), indices, best_indices) for a vec of float</para>
+	/// </summary>
+	template<typename U, typename T, size_t W>
+	requires (sizeof(U) == sizeof(T)) && (tpa::simd::register_bytes<T, W> == TPA_VEC_BYTES)
+	[[nodiscard]] inline mask<U, W> mask_cast(const mask<T, W> m) noexcept
+	{
+		constexpr size_t bytes = sizeof(T) * W;
+
+		if constexpr (W == 1uz || std::is_same<typename mask<T, W>::native_type, typename mask<U, W>::native_type>::value)
+		{
+			return mask<U, W>(m.reg);
+		}//End if
+#ifdef TPA_X86_64
+		else
+		{
+			//Float and integer masks of the same width differ only in register type
+			if constexpr (bytes == 32uz)
+			{
+				__m256i r;
+
+				if constexpr (std::is_same<T, float>::value) { r = _mm256_castps_si256(m.reg); }
+				else if constexpr (std::is_same<T, double>::value) { r = _mm256_castpd_si256(m.reg); }
+				else { r = m.reg; }
+
+				if constexpr (std::is_same<U, float>::value) { return mask<U, W>(_mm256_castsi256_ps(r)); }
+				else if constexpr (std::is_same<U, double>::value) { return mask<U, W>(_mm256_castsi256_pd(r)); }
+				else { return mask<U, W>(r); }
+			}//End if
+			else
+			{
+				__m128i r;
+
+				if constexpr (std::is_same<T, float>::value) { r = _mm_castps_si128(m.reg); }
+				else if constexpr (std::is_same<T, double>::value) { r = _mm_castpd_si128(m.reg); }
+				else { r = m.reg; }
+
+				if constexpr (std::is_same<U, float>::value) { return mask<U, W>(_mm_castsi128_ps(r)); }
+				else if constexpr (std::is_same<U, double>::value) { return mask<U, W>(_mm_castsi128_pd(r)); }
+				else { return mask<U, W>(r); }
+			}//End else
+		}//End else
+#endif
+	}//End of mask_cast
+
+	/// <summary>
+	/// <para>Lane-wise minimum of 'a' and 'b'</para>
+	/// </summary>
+	template<typename T, size_t W>
+	requires (tpa::simd::register_bytes<T, W> == TPA_VEC_BYTES)
+	[[nodiscard]] inline vec<T, W> min(const vec<T, W> a, const vec<T, W> b) noexcept
+	{
+		using V = vec<T, W>;
+		constexpr size_t bytes = V::bytes;
+
+		if constexpr (W == 1uz)
+		{
+			return V(static_cast<T>(tpa::util::min(a.reg, b.reg)));
+		}//End if
+#ifdef TPA_X86_64
+		else if constexpr (std::is_same<T, float>::value)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_min_ps(a.reg, b.reg)); }
+			else if constexpr (bytes == 32uz) { return V(_mm256_min_ps(a.reg, b.reg)); }
+			else { return V(_mm_min_ps(a.reg, b.reg)); }
+		}//End if
+		else if constexpr (std::is_same<T, double>::value)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_min_pd(a.reg, b.reg)); }
+			else if constexpr (bytes == 32uz) { return V(_mm256_min_pd(a.reg, b.reg)); }
+			else { return V(_mm_min_pd(a.reg, b.reg)); }
+		}//End if
+		else if constexpr (std::is_same<T, int8_t>::value)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_min_epi8(a.reg, b.reg)); }
+			else if constexpr (bytes == 32uz) { return V(_mm256_min_epi8(a.reg, b.reg)); }
+			else { return V(_mm_min_epi8(a.reg, b.reg)); }
+		}//End if
+		else if constexpr (std::is_same<T, uint8_t>::value)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_min_epu8(a.reg, b.reg)); }
+			else if constexpr (bytes == 32uz) { return V(_mm256_min_epu8(a.reg, b.reg)); }
+			else { return V(_mm_min_epu8(a.reg, b.reg)); }
+		}//End if
+		else if constexpr (std::is_same<T, int16_t>::value)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_min_epi16(a.reg, b.reg)); }
+			else if constexpr (bytes == 32uz) { return V(_mm256_min_epi16(a.reg, b.reg)); }
+			else { return V(_mm_min_epi16(a.reg, b.reg)); }
+		}//End if
+		else if constexpr (std::is_same<T, uint16_t>::value)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_min_epu16(a.reg, b.reg)); }
+			else if constexpr (bytes == 32uz) { return V(_mm256_min_epu16(a.reg, b.reg)); }
+			else { return V(_mm_min_epu16(a.reg, b.reg)); }
+		}//End if
+		else if constexpr (std::is_same<T, int32_t>::value)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_min_epi32(a.reg, b.reg)); }
+			else if constexpr (bytes == 32uz) { return V(_mm256_min_epi32(a.reg, b.reg)); }
+			else { return V(_mm_min_epi32(a.reg, b.reg)); }
+		}//End if
+		else if constexpr (std::is_same<T, uint32_t>::value)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_min_epu32(a.reg, b.reg)); }
+			else if constexpr (bytes == 32uz) { return V(_mm256_min_epu32(a.reg, b.reg)); }
+			else { return V(_mm_min_epu32(a.reg, b.reg)); }
+		}//End if
+		else if constexpr (std::is_signed<T>::value && sizeof(T) == 8uz && bytes == 64uz)
+		{
+			return V(_mm512_min_epi64(a.reg, b.reg));
+		}//End if
+		else if constexpr (sizeof(T) == 8uz && bytes == 64uz)
+		{
+			return V(_mm512_min_epu64(a.reg, b.reg));
+		}//End if
+		else
+		{
+			//64-bit lanes below AVX-512 and any remaining integer types
+			return tpa::simd::select(a > b, b, a);
+		}//End else
+#elif defined(TPA_NEON)
+		else
+		{
+			return V(tpa_neon_private::min<T>(a.reg, b.reg));
+		}//End else
+#endif
+	}//End of min
+
+	/// <summary>
+	/// <para>Lane-wise maximum of 'a' and 'b'</para>
+	/// </summary>
+	template<typename T, size_t W>
+	requires (tpa::simd::register_bytes<T, W> == TPA_VEC_BYTES)
+	[[nodiscard]] inline vec<T, W> max(const vec<T, W> a, const vec<T, W> b) noexcept
+	{
+		using V = vec<T, W>;
+		constexpr size_t bytes = V::bytes;
+
+		if constexpr (W == 1uz)
+		{
+			return V(static_cast<T>(tpa::util::max(a.reg, b.reg)));
+		}//End if
+#ifdef TPA_X86_64
+		else if constexpr (std::is_same<T, float>::value)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_max_ps(a.reg, b.reg)); }
+			else if constexpr (bytes == 32uz) { return V(_mm256_max_ps(a.reg, b.reg)); }
+			else { return V(_mm_max_ps(a.reg, b.reg)); }
+		}//End if
+		else if constexpr (std::is_same<T, double>::value)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_max_pd(a.reg, b.reg)); }
+			else if constexpr (bytes == 32uz) { return V(_mm256_max_pd(a.reg, b.reg)); }
+			else { return V(_mm_max_pd(a.reg, b.reg)); }
+		}//End if
+		else if constexpr (std::is_same<T, int8_t>::value)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_max_epi8(a.reg, b.reg)); }
+			else if constexpr (bytes == 32uz) { return V(_mm256_max_epi8(a.reg, b.reg)); }
+			else { return V(_mm_max_epi8(a.reg, b.reg)); }
+		}//End if
+		else if constexpr (std::is_same<T, uint8_t>::value)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_max_epu8(a.reg, b.reg)); }
+			else if constexpr (bytes == 32uz) { return V(_mm256_max_epu8(a.reg, b.reg)); }
+			else { return V(_mm_max_epu8(a.reg, b.reg)); }
+		}//End if
+		else if constexpr (std::is_same<T, int16_t>::value)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_max_epi16(a.reg, b.reg)); }
+			else if constexpr (bytes == 32uz) { return V(_mm256_max_epi16(a.reg, b.reg)); }
+			else { return V(_mm_max_epi16(a.reg, b.reg)); }
+		}//End if
+		else if constexpr (std::is_same<T, uint16_t>::value)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_max_epu16(a.reg, b.reg)); }
+			else if constexpr (bytes == 32uz) { return V(_mm256_max_epu16(a.reg, b.reg)); }
+			else { return V(_mm_max_epu16(a.reg, b.reg)); }
+		}//End if
+		else if constexpr (std::is_same<T, int32_t>::value)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_max_epi32(a.reg, b.reg)); }
+			else if constexpr (bytes == 32uz) { return V(_mm256_max_epi32(a.reg, b.reg)); }
+			else { return V(_mm_max_epi32(a.reg, b.reg)); }
+		}//End if
+		else if constexpr (std::is_same<T, uint32_t>::value)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_max_epu32(a.reg, b.reg)); }
+			else if constexpr (bytes == 32uz) { return V(_mm256_max_epu32(a.reg, b.reg)); }
+			else { return V(_mm_max_epu32(a.reg, b.reg)); }
+		}//End if
+		else if constexpr (std::is_signed<T>::value && sizeof(T) == 8uz && bytes == 64uz)
+		{
+			return V(_mm512_max_epi64(a.reg, b.reg));
+		}//End if
+		else if constexpr (sizeof(T) == 8uz && bytes == 64uz)
+		{
+			return V(_mm512_max_epu64(a.reg, b.reg));
+		}//End if
+		else
+		{
+			//64-bit lanes below AVX-512 and any remaining integer types
+			return tpa::simd::select(a > b, a, b);
+		}//End else
+#elif defined(TPA_NEON)
+		else
+		{
+			return V(tpa_neon_private::max<T>(a.reg, b.reg));
+		}//End else
+#endif
+	}//End of max
+
+	/// <summary>
+	/// <para>Lane-wise absolute value of 'a', unsigned types are returned unchanged.</para>
+	/// </summary>
+	template<typename T, size_t W>
+	requires (tpa::simd::register_bytes<T, W> == TPA_VEC_BYTES)
+	[[nodiscard]] inline vec<T, W> abs(const vec<T, W> a) noexcept
+	{
+		using V = vec<T, W>;
+		constexpr size_t bytes = V::bytes;
+
+		if constexpr (std::is_unsigned<T>::value)
+		{
+			return a;
+		}//End if
+		else if constexpr (W == 1uz)
+		{
+			return V(static_cast<T>(tpa::util::abs(a.reg)));
+		}//End if
+#ifdef TPA_X86_64
+		else if constexpr (std::is_same<T, float>::value)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(a.reg), _mm512_set1_epi32(0x7FFFFFFF)))); }
+			else if constexpr (bytes == 32uz) { return V(tpa::simd::_mm256_abs_ps(a.reg)); }
+			else { return V(tpa::simd::_mm_abs_ps(a.reg)); }
+		}//End if
+		else if constexpr (std::is_same<T, double>::value)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_castsi512_pd(_mm512_and_si512(_mm512_castpd_si512(a.reg), _mm512_set1_epi64(0x7FFFFFFFFFFFFFFFll)))); }
+			else if constexpr (bytes == 32uz) { return V(tpa::simd::_mm256_abs_pd(a.reg)); }
+			else { return V(tpa::simd::_mm_abs_pd(a.reg)); }
+		}//End if
+		else if constexpr (sizeof(T) == 1uz)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_abs_epi8(a.reg)); }
+			else if constexpr (bytes == 32uz) { return V(_mm256_abs_epi8(a.reg)); }
+			else { return V(_mm_abs_epi8(a.reg)); }
+		}//End if
+		else if constexpr (sizeof(T) == 2uz)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_abs_epi16(a.reg)); }
+			else if constexpr (bytes == 32uz) { return V(_mm256_abs_epi16(a.reg)); }
+			else { return V(_mm_abs_epi16(a.reg)); }
+		}//End if
+		else if constexpr (sizeof(T) == 4uz)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_abs_epi32(a.reg)); }
+			else if constexpr (bytes == 32uz) { return V(_mm256_abs_epi32(a.reg)); }
+			else { return V(_mm_abs_epi32(a.reg)); }
+		}//End if
+		else
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_abs_epi64(a.reg)); }
+			else { return tpa::simd::select(a < static_cast<T>(0), -a, a); }
+		}//End else
+#elif defined(TPA_NEON)
+		else
+		{
+			return V(tpa_neon_private::abs<T>(a.reg));
+		}//End else
+#endif
+	}//End of abs
+
+	/// <summary>
+	/// <para>Lane-wise square root of 'a', integer types are computed lane by lane and truncated.</para>
+	/// </summary>
+	template<typename T, size_t W>
+	requires (tpa::simd::register_bytes<T, W> == TPA_VEC_BYTES)
+	[[nodiscard]] inline vec<T, W> sqrt(const vec<T, W> a) noexcept
+	{
+		using V = vec<T, W>;
+		constexpr size_t bytes = V::bytes;
+
+		if constexpr (W == 1uz)
+		{
+			return V(static_cast<T>(std::sqrt(a.reg)));
+		}//End if
+#ifdef TPA_X86_64
+		else if constexpr (std::is_same<T, float>::value)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_sqrt_ps(a.reg)); }
+			else if constexpr (bytes == 32uz) { return V(_mm256_sqrt_ps(a.reg)); }
+			else { return V(_mm_sqrt_ps(a.reg)); }
+		}//End if
+		else if constexpr (std::is_same<T, double>::value)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_sqrt_pd(a.reg)); }
+			else if constexpr (bytes == 32uz) { return V(_mm256_sqrt_pd(a.reg)); }
+			else { return V(_mm_sqrt_pd(a.reg)); }
+		}//End if
+#elif defined(TPA_NEON)
+		else if constexpr (std::is_same<T, float>::value)
+		{
+			return V(vsqrtq_f32(a.reg));
+		}//End if
+		else if constexpr (std::is_same<T, double>::value)
+		{
+			return V(vsqrtq_f64(a.reg));
+		}//End if
+#endif
+		else
+		{
+			return V::lanewise(a, [](const T x) { return std::sqrt(x); });
+		}//End else
+	}//End of sqrt
+
+	/// <summary>
+	/// <para>Lane-wise (a * b) + c.</para>
+	/// <para>float and double are fused (a single rounding) on NEON and AVX-512, other widths and integer types multiply then add.</para>
+	/// </summary>
+	template<typename T, size_t W>
+	requires (tpa::simd::register_bytes<T, W> == TPA_VEC_BYTES)
+	[[nodiscard]] inline vec<T, W> fma(const vec<T, W> a, const vec<T, W> b, const vec<T, W> c) noexcept
+	{
+		using V = vec<T, W>;
+		constexpr size_t bytes = V::bytes;
+
+		if constexpr (W == 1uz)
+		{
+			return V(static_cast<T>((a.reg * b.reg) + c.reg));
+		}//End if
+#ifdef TPA_X86_64
+		else if constexpr (std::is_same<T, float>::value && bytes == 64uz)
+		{
+			return V(_mm512_fmadd_ps(a.reg, b.reg, c.reg));
+		}//End if
+		else if constexpr (std::is_same<T, double>::value && bytes == 64uz)
+		{
+			return V(_mm512_fmadd_pd(a.reg, b.reg, c.reg));
+		}//End if
+#elif defined(TPA_NEON)
+		else if constexpr (std::is_same<T, float>::value)
+		{
+			return V(vfmaq_f32(c.reg, a.reg, b.reg));
+		}//End if
+		else if constexpr (std::is_same<T, double>::value)
+		{
+			return V(vfmaq_f64(c.reg, a.reg, b.reg));
+		}//End if
+#endif
+		else
+		{
+			//256-bit and 128-bit vec only require AVX / SSE, not FMA
+			return (a * b) + c;
+		}//End else
+	}//End of fma
+
+	/// <summary>
+	/// <para>Reverses the order of the lanes in 'a'.</para>
+	/// </summary>
+	template<typename T, size_t W>
+	requires (tpa::simd::register_bytes<T, W> == TPA_VEC_BYTES)
+	[[nodiscard]] inline vec<T, W> reverse(const vec<T, W> a) noexcept
+	{
+		using V = vec<T, W>;
+		constexpr size_t bytes = V::bytes;
+
+		if constexpr (W == 1uz)
+		{
+			return a;
+		}//End if
+#ifdef TPA_X86_64
+		else if constexpr (sizeof(T) <= 2uz)
+		{
+			//Reverse the bytes of each element within every 128-bit lane then reverse the 128-bit lanes
+			const __m128i idx = (sizeof(T) == 1uz) ?
+				_mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0) :
+				_mm_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+
+			if constexpr (bytes == 64uz)
+			{
+				const __m512i r = _mm512_shuffle_epi8(a.reg, _mm512_broadcast_i32x4(idx));
+				return V(_mm512_shuffle_i64x2(r, r, 0x1B));
+			}//End if
+			else if constexpr (bytes == 32uz)
+			{
+				const __m256i r = _mm256_shuffle_epi8(a.reg, _mm256_broadcastsi128_si256(idx));
+				return V(_mm256_permute2x128_si256(r, r, 0x01));
+			}//End if
+			else
+			{
+				return V(_mm_shuffle_epi8(a.reg, idx));
+			}//End else
+		}//End if
+		else if constexpr (std::is_same<T, float>::value)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_permutexvar_ps(_mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0), a.reg)); }
+			else if constexpr (bytes == 32uz) { const __m256 r = _mm256_permute_ps(a.reg, 0x1B); return V(_mm256_permute2f128_ps(r, r, 0x01)); }
+			else { return V(_mm_shuffle_ps(a.reg, a.reg, 0x1B)); }
+		}//End if
+		else if constexpr (std::is_same<T, double>::value)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_permutexvar_pd(_mm512_setr_epi64(7, 6, 5, 4, 3, 2, 1, 0), a.reg)); }
+			else if constexpr (bytes == 32uz) { const __m256d r = _mm256_permute_pd(a.reg, 0x05); return V(_mm256_permute2f128_pd(r, r, 0x01)); }
+			else { return V(_mm_shuffle_pd(a.reg, a.reg, 0x01)); }
+		}//End if
+		else if constexpr (sizeof(T) == 4uz)
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_permutexvar_epi32(_mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0), a.reg)); }
+			else if constexpr (bytes == 32uz) { return V(_mm256_permutevar8x32_epi32(a.reg, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0))); }
+			else { return V(_mm_shuffle_epi32(a.reg, 0x1B)); }
+		}//End if
+		else
+		{
+			if constexpr (bytes == 64uz) { return V(_mm512_permutexvar_epi64(_mm512_setr_epi64(7, 6, 5, 4, 3, 2, 1, 0), a.reg)); }
+			else if constexpr (bytes == 32uz) { return V(_mm256_permute4x64_epi64(a.reg, 0x1B)); }
+			else { return V(_mm_shuffle_epi32(a.reg, 0x4E)); }
+		}//End else
+#elif defined(TPA_NEON)
+		else
+		{
+			return V(tpa_neon_private::reverse<T>(a.reg));
+		}//End else
+#endif
+	}//End of reverse
+
+	/// <summary>
+	/// <para>Returns the sum of every lane in 'a'.</para>
+	/// <para>Integer sums wrap in 'T', widen before reducing if that is a concern.</para>
+	/// </summary>
+	template<typename T, size_t W>
+	requires (tpa::simd::register_bytes<T, W> == TPA_VEC_BYTES)
+	[[nodiscard]] inline T reduce_add(const vec<T, W> a) noexcept
+	{
+		alignas(64) T x[W];
+		a.store(x);
+
+		T res = x[0];
+		for (size_t k = 1; k != W; ++k)
+		{
+			res = static_cast<T>(res + x[k]);
+		}//End for
+
+		return res;
+	}//End of reduce_add
+
+	/// <summary>
+	/// <para>Returns the smallest lane in 'a'.</para>
+	/// </summary>
+	template<typename T, size_t W>
+	requires (tpa::simd::register_bytes<T, W> == TPA_VEC_BYTES)
+	[[nodiscard]] inline T reduce_min(const vec<T, W> a) noexcept
+	{
+		alignas(64) T x[W];
+		a.store(x);
+
+		T res = x[0];
+		for (size_t k = 1; k != W; ++k)
+		{
+			res = static_cast<T>(tpa::util::min(res, x[k]));
+		}//End for
+
+		return res;
+	}//End of reduce_min
+
+	/// <summary>
+	/// <para>Returns the largest lane in 'a'.</para>
+	/// </summary>
+	template<typename T, size_t W>
+	requires (tpa::simd::register_bytes<T, W> == TPA_VEC_BYTES)
+	[[nodiscard]] inline T reduce_max(const vec<T, W> a) noexcept
+	{
+		alignas(64) T x[W];
+		a.store(x);
+
+		T res = x[0];
+		for (size_t k = 1; k != W; ++k)
+		{
+			res = static_cast<T>(tpa::util::max(res, x[k]));
+		}//End for
+
+		return res;
+	}//End of reduce_max
+
+	/// <summary>
+	/// <para>Writes the lanes of 'a' where 'm' is set to consecutive elements of 'dest' and returns how many were written.</para>
+	/// <para>Only the returned number of elements are written, 'dest' does not need to be aligned.</para>
+	/// <para>512-bit vectors use VPCOMPRESS (8-bit and 16-bit lanes require AVX-512 VBMI2), 256-bit vectors of 32-bit and 64-bit lanes use a permute table and a masked store (AVX2), other widths are compacted lane by lane.</para>
+	/// </summary>
+	template<typename T, size_t W>
+	requires (tpa::simd::register_bytes<T, W> == TPA_VEC_BYTES)
+	inline size_t compress_store(const vec<T, W> a, const mask<T, W> m, T* dest) noexcept
+	{
+		constexpr size_t bytes = vec<T, W>::bytes;
+
+#ifdef TPA_X86_64
+		if constexpr (W != 1uz && bytes == 32uz && sizeof(T) >= 4uz)
+		{
+			const size_t bits = static_cast<size_t>(m.bits());
+			const size_t n = static_cast<size_t>(std::popcount(bits));
+
+			//Move the selected lanes to the front, then store only the first n
+			const uint64_t packed = (sizeof(T) == 4uz) ? compress_lut32[bits] : compress_lut64[bits];
+			const __m256i _perm = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(static_cast<int64_t>(packed)));
+			const __m256i _keep = _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int32_t>(n * (sizeof(T) / 4uz))), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+
+			if constexpr (std::is_same<T, float>::value)
+			{
+				_mm256_maskstore_ps(dest, _keep, _mm256_permutevar8x32_ps(a.reg, _perm));
+			}//End if
+			else if constexpr (std::is_same<T, double>::value)
+			{
+				_mm256_maskstore_pd(dest, _keep, _mm256_castsi256_pd(_mm256_permutevar8x32_epi32(_mm256_castpd_si256(a.reg), _perm)));
+			}//End if
+			else if constexpr (sizeof(T) == 4uz)
+			{
+				_mm256_maskstore_epi32(reinterpret_cast<int*>(dest), _keep, _mm256_permutevar8x32_epi32(a.reg, _perm));
+			}//End if
+			else
+			{
+				_mm256_maskstore_epi64(reinterpret_cast<long long*>(dest), _keep, _mm256_permutevar8x32_epi32(a.reg, _perm));
+			}//End else
+
+			return n;
+		}//End if
+		else if constexpr (W != 1uz && bytes == 64uz)
+		{
+			const size_t n = m.count();
+
+			if constexpr (std::is_same<T, float>::value)
+			{
+				_mm512_mask_storeu_ps(dest, static_cast<__mmask16>((1u << n) - 1u), _mm512_maskz_compress_ps(m.reg, a.reg));
+				return n;
+			}//End if
+			else if constexpr (std::is_same<T, double>::value)
+			{
+				_mm512_mask_storeu_pd(dest, static_cast<__mmask8>((1u << n) - 1u), _mm512_maskz_compress_pd(m.reg, a.reg));
+				return n;
+			}//End if
+			else if constexpr (sizeof(T) == 4uz)
+			{
+				_mm512_mask_storeu_epi32(dest, static_cast<__mmask16>((1u << n) - 1u), _mm512_maskz_compress_epi32(m.reg, a.reg));
+				return n;
+			}//End if
+			else if constexpr (sizeof(T) == 8uz)
+			{
+				_mm512_mask_storeu_epi64(dest, static_cast<__mmask8>((1u << n) - 1u), _mm512_maskz_compress_epi64(m.reg, a.reg));
+				return n;
+			}//End if
+			else if constexpr (sizeof(T) == 2uz)
+			{
+				if (tpa::hasAVX512_VBMI2)
+				{
+					//VPCOMPRESSB/W are outside the base AVX-512 target of this region
+					[&]() TPA_TARGET(TPA_ISA_AVX512 ",avx512vbmi2") { _mm512_mask_storeu_epi16(dest, static_cast<__mmask32>((1ull << n) - 1ull), _mm512_maskz_compress_epi16(m.reg, a.reg)); }();
+					return n;
+				}//End if
+			}//End if
+			else
+			{
+				if (tpa::hasAVX512_VBMI2)
+				{
+					[&]() TPA_TARGET(TPA_ISA_AVX512 ",avx512vbmi2") { _mm512_mask_storeu_epi8(dest, static_cast<__mmask64>(n == 64uz ? ~0ull : (1ull << n) - 1ull), _mm512_maskz_compress_epi8(m.reg, a.reg)); }();
+					return n;
+				}//End if
+			}//End else
+		}//End if
+#endif
+		alignas(64) T x[W];
+		a.store(x);
+
+		uint64_t bits = m.bits();
+		size_t n = 0uz;
+
+		for (size_t k = 0uz; k != W; ++k)
+		{
+			if ((bits >> k) & 1ull)
+			{
+				dest[n++] = x[k];
+			}//End if
+		}//End for
+
+		return n;
+	}//End of compress_store
+
+	/// <summary>
+	/// <para>Returns a vec whose lane 'k' is base[idx[k]], the index lanes are signed integers as wide as T.</para>
+	/// <para>256-bit and 512-bit vectors of 32-bit and 64-bit lanes use VPGATHER (AVX2 / AVX-512), other widths are loaded lane by lane.</para>
+	/// </summary>
+	template<typename T, typename I, size_t W>
+	requires std::is_integral<I>::value && (sizeof(I) == sizeof(T)) && (tpa::simd::register_bytes<T, W> == TPA_VEC_BYTES)
+	[[nodiscard]] inline vec<T, W> gather(const T* base, const vec<I, W> idx) noexcept
+	{
+		using V = vec<T, W>;
+		constexpr size_t bytes = V::bytes;
+
+#ifdef TPA_X86_64
+		if constexpr (W != 1uz && bytes == 32uz && sizeof(T) >= 4uz)
+		{
+			if constexpr (std::is_same<T, float>::value) { return V(_mm256_i32gather_ps(base, idx.reg, 4)); }
+			else if constexpr (std::is_same<T, double>::value) { return V(_mm256_i64gather_pd(base, idx.reg, 8)); }
+			else if constexpr (sizeof(T) == 4uz) { return V(_mm256_i32gather_epi32(reinterpret_cast<const int*>(base), idx.reg, 4)); }
+			else { return V(_mm256_i64gather_epi64(reinterpret_cast<const long long*>(base), idx.reg, 8)); }
+		}//End if
+		else if constexpr (W != 1uz && bytes == 64uz && sizeof(T) >= 4uz)
+		{
+			if constexpr (std::is_same<T, float>::value) { return V(_mm512_i32gather_ps(idx.reg, base, 4)); }
+			else if constexpr (std::is_same<T, double>::value) { return V(_mm512_i64gather_pd(idx.reg, base, 8)); }
+			else if constexpr (sizeof(T) == 4uz) { return V(_mm512_i32gather_epi32(idx.reg, base, 4)); }
+			else { return V(_mm512_i64gather_epi64(idx.reg, base, 8)); }
+		}//End if
+#endif
+		alignas(64) I lanes[W];
+		idx.store(lanes);
+
+		alignas(64) T x[W];
+		for (size_t k = 0uz; k != W; ++k)
+		{
+			x[k] = base[lanes[k]];
+		}//End for
+
+		return V::load(x);
+	}//End of gather
+#pragma endregion
+}//End of namespace
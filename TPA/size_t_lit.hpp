@@ -17,9 +17,9 @@
 /// </summary>
 /// <param name="n"></param>
 /// <returns></returns>
-consteval std::size_t operator ""uz(std::size_t n)
+consteval std::size_t operator ""uz(unsigned long long n)
 {
-	return n;
+	return static_cast<std::size_t>(n);
 }
 
 /// <summary>
@@ -28,9 +28,9 @@ consteval std::size_t operator ""uz(std::size_t n)
 /// </summary>
 /// <param name="n"></param>
 /// <returns></returns>
-consteval std::size_t operator ""UZ(std::size_t n)
+consteval std::size_t operator ""UZ(unsigned long long n)
 {
-	return n;
+	return static_cast<std::size_t>(n);
 }
 
 #endif
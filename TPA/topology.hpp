@@ -0,0 +1,599 @@
+#pragma once
+/*
+* Truly Parallel Algorithms Library - Cache, TLB and core topology
+* By: David Aaron Braun
+* 2022-08-16
+* Cache levels, TLBs, SMT siblings and NUMA nodes from CPUID and /sys/devices/system/cpu (Linux)
+*/
+
+/*
+*           Copyright David Aaron Braun 2021 - .
+*   Distributed under the Boost Software License, Version 1.0.
+*       (See accompanying file LICENSE_1_0.txt or copy at
+*           https://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+
+#ifdef __linux__
+#include <fstream>
+#endif
+
+#include "size_t_lit.hpp"
+#include "tpa_macros.hpp"
+#include "InstructionSet.hpp"
+
+/// <summary>
+/// <para>Truly Parallel Algorithms</para>
+/// <para>CPU Topology.</para>
+/// <para>By David Aaron Braun</para>
+/// <para>Version 0.1</para>
+/// </summary>
+namespace tpa::cpu {
+
+	/// <summary>
+	/// <para>What a cache or TLB holds.</para>
+	/// </summary>
+	enum class cache_type : uint8_t
+	{
+		DATA = 0,
+		INSTRUCTION,
+		UNIFIED
+	};
+
+	/// <summary>
+	/// <para>One level and type of cache, e.g. the L1 data cache.</para>
+	/// </summary>
+	struct cache
+	{
+		uint32_t level = 0u;
+		cache_type type = cache_type::UNIFIED;
+		size_t size = 0uz;//Bytes of one instance
+		size_t line_size = 0uz;//Bytes
+		size_t ways = 0uz;//0 = fully associative or unknown
+		size_t sets = 0uz;
+		size_t sharing = 0uz;//Logical CPUs which share one instance, 0 if unknown
+		std::vector<std::vector<uint32_t>> instances;//The logical CPUs of each instance, empty if the operating system does not report them
+	};//End of cache
+
+	/// <summary>
+	/// <para>One translation lookaside buffer for one page size.</para>
+	/// </summary>
+	struct tlb
+	{
+		uint32_t level = 0u;
+		cache_type type = cache_type::UNIFIED;
+		size_t page_size = 0uz;//Bytes
+		size_t entries = 0uz;
+		size_t ways = 0uz;//0 = fully associative or unknown
+	};//End of tlb
+
+	/// <summary>
+	/// <para>The cache, TLB, core and NUMA layout of the machine, see tpa::cpu::topology().</para>
+	/// </summary>
+	struct topology_info
+	{
+		uint32_t logical_cpus = 0u;
+		std::vector<cache> caches;//Ordered by level, data before instruction before unified
+		std::vector<tlb> tlbs;//Ordered by level
+		std::vector<std::vector<uint32_t>> cores;//The SMT siblings (logical CPUs) of each physical core
+		std::vector<std::vector<uint32_t>> numa_nodes;//The logical CPUs of each NUMA node, a single node holding every CPU when unknown
+
+		/// <summary>
+		/// <para>Returns the cache of 'level' holding data (DATA or UNIFIED), nullptr if there is none.</para>
+		/// </summary>
+		/// <param name="level"></param>
+		/// <returns></returns>
+		[[nodiscard]] const cache* data_cache(const uint32_t level) const noexcept
+		{
+			for (const cache& c : caches)
+			{
+				if (c.level == level && c.type != cache_type::INSTRUCTION)
+				{
+					return &c;
+				}//End if
+			}//End for
+
+			return nullptr;
+		}//End of data_cache
+
+		/// <summary>
+		/// <para>Returns the highest level cache holding data, nullptr if no cache is known.</para>
+		/// </summary>
+		/// <returns></returns>
+		[[nodiscard]] const cache* last_level_cache() const noexcept
+		{
+			const cache* res = nullptr;
+
+			for (const cache& c : caches)
+			{
+				if (c.type != cache_type::INSTRUCTION && (res == nullptr || c.level >= res->level))
+				{
+					res = &c;
+				}//End if
+			}//End for
+
+			return res;
+		}//End of last_level_cache
+	};//End of topology_info
+}//End of namespace
+
+/// <summary>
+/// <para>Private Namespace for TPA topology. Not intended to be used directly.</para>
+/// </summary>
+namespace tpa_topology_private {
+
+	/// <summary>
+	/// <para>Parses a Linux CPU list such as "0-3,8,10-11".</para>
+	/// </summary>
+	/// <param name="list"></param>
+	/// <returns></returns>
+	[[nodiscard]] inline std::vector<uint32_t> parse_cpu_list(const std::string& list)
+	{
+		std::vector<uint32_t> cpus;
+		size_t pos = 0uz;
+
+		while (pos < list.size())
+		{
+			size_t next = list.find(',', pos);
+
+			if (next == std::string::npos)
+			{
+				next = list.size();
+			}//End if
+
+			const std::string range = list.substr(pos, next - pos);
+			const size_t dash = range.find('-');
+
+			if (!range.empty() && range.front() >= '0' && range.front() <= '9')
+			{
+				const uint32_t first = static_cast<uint32_t>(std::strtoul(range.c_str(), nullptr, 10));
+				const uint32_t last = (dash == std::string::npos) ? first : static_cast<uint32_t>(std::strtoul(range.c_str() + dash + 1uz, nullptr, 10));
+
+				for (uint32_t c = first; c <= last; ++c)
+				{
+					cpus.push_back(c);
+				}//End for
+			}//End if
+
+			pos = next + 1uz;
+		}//End while
+
+		return cpus;
+	}//End of parse_cpu_list
+
+	/// <summary>
+	/// <para>Sorts the groups and removes duplicates, each group of CPUs is reported once per CPU by the operating system.</para>
+	/// </summary>
+	/// <param name="groups"></param>
+	inline void unique_groups(std::vector<std::vector<uint32_t>>& groups)
+	{
+		std::sort(groups.begin(), groups.end());
+		groups.erase(std::unique(groups.begin(), groups.end()), groups.end());
+	}//End of unique_groups
+
+	/// <summary>
+	/// <para>Sorts the caches by level then by type.</para>
+	/// </summary>
+	/// <param name="caches"></param>
+	inline void sort_caches(std::vector<tpa::cpu::cache>& caches)
+	{
+		std::stable_sort(caches.begin(), caches.end(), [](const tpa::cpu::cache& a, const tpa::cpu::cache& b)
+			{
+				return (a.level != b.level) ? (a.level < b.level) : (a.type < b.type);
+			});
+	}//End of sort_caches
+
+#ifdef __linux__
+	/// <summary>
+	/// <para>Reads the first line of a file, empty if it can not be read.</para>
+	/// </summary>
+	/// <param name="path"></param>
+	/// <returns></returns>
+	[[nodiscard]] inline std::string read_line(const std::string& path)
+	{
+		std::ifstream file(path);
+		std::string line;
+
+		if (file)
+		{
+			std::getline(file, line);
+		}//End if
+
+		return line;
+	}//End of read_line
+
+	/// <summary>
+	/// <para>Parses a sysfs size such as "48K" or "32M" into bytes.</para>
+	/// </summary>
+	/// <param name="text"></param>
+	/// <returns></returns>
+	[[nodiscard]] inline size_t parse_size(const std::string& text) noexcept
+	{
+		char* suffix = nullptr;
+		size_t bytes = static_cast<size_t>(std::strtoull(text.c_str(), &suffix, 10));
+
+		if (suffix != nullptr)
+		{
+			if (*suffix == 'K') { bytes *= 1024uz; }
+			else if (*suffix == 'M') { bytes *= 1024uz * 1024uz; }
+			else if (*suffix == 'G') { bytes *= 1024uz * 1024uz * 1024uz; }
+		}//End if
+
+		return bytes;
+	}//End of parse_size
+
+	/// <summary>
+	/// <para>Fills in the caches, SMT siblings and NUMA nodes from /sys/devices/system, anything which can not be read is left empty.</para>
+	/// </summary>
+	/// <param name="topo"></param>
+	inline void probe_sysfs(tpa::cpu::topology_info& topo)
+	{
+		const std::string root = "/sys/devices/system/cpu/";
+
+		std::vector<uint32_t> online = parse_cpu_list(read_line(root + "online"));
+
+		if (online.empty())
+		{
+			return;
+		}//End if
+
+		topo.logical_cpus = static_cast<uint32_t>(online.size());
+
+		for (const uint32_t cpu : online)
+		{
+			const std::string dir = root + "cpu" + std::to_string(cpu) + "/";
+
+			//SMT siblings
+			std::vector<uint32_t> siblings = parse_cpu_list(read_line(dir + "topology/thread_siblings_list"));
+
+			if (!siblings.empty())
+			{
+				topo.cores.emplace_back(std::move(siblings));
+			}//End if
+
+			//Caches
+			for (uint32_t index = 0u; ; ++index)
+			{
+				const std::string idx = dir + "cache/index" + std::to_string(index) + "/";
+				const std::string level = read_line(idx + "level");
+
+				if (level.empty())
+				{
+					break;
+				}//End if
+
+				tpa::cpu::cache c;
+				c.level = static_cast<uint32_t>(std::strtoul(level.c_str(), nullptr, 10));
+
+				const std::string type = read_line(idx + "type");
+				c.type = (type == "Data") ? tpa::cpu::cache_type::DATA : (type == "Instruction") ? tpa::cpu::cache_type::INSTRUCTION : tpa::cpu::cache_type::UNIFIED;
+
+				std::vector<uint32_t> shared = parse_cpu_list(read_line(idx + "shared_cpu_list"));
+
+				auto found = std::find_if(topo.caches.begin(), topo.caches.end(), [&c](const tpa::cpu::cache& x) { return x.level == c.level && x.type == c.type; });
+
+				if (found == topo.caches.end())
+				{
+					c.size = parse_size(read_line(idx + "size"));
+					c.line_size = static_cast<size_t>(std::strtoull(read_line(idx + "coherency_line_size").c_str(), nullptr, 10));
+					c.ways = static_cast<size_t>(std::strtoull(read_line(idx + "ways_of_associativity").c_str(), nullptr, 10));
+					c.sets = static_cast<size_t>(std::strtoull(read_line(idx + "number_of_sets").c_str(), nullptr, 10));
+					c.sharing = shared.size();
+
+					topo.caches.emplace_back(std::move(c));
+					found = topo.caches.end() - 1;
+				}//End if
+
+				if (!shared.empty())
+				{
+					found->instances.emplace_back(std::move(shared));
+				}//End if
+			}//End for
+		}//End for
+
+		for (tpa::cpu::cache& c : topo.caches)
+		{
+			unique_groups(c.instances);
+		}//End for
+
+		unique_groups(topo.cores);
+
+		//NUMA nodes
+		for (uint32_t node = 0u; node != 4096u; ++node)
+		{
+			const std::string list = read_line("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+
+			if (list.empty())
+			{
+				//Node numbers may have gaps, stop once past the highest possible node
+				const std::vector<uint32_t> possible = parse_cpu_list(read_line("/sys/devices/system/node/possible"));
+
+				if (possible.empty() || node > possible.back())
+				{
+					break;
+				}//End if
+
+				continue;
+			}//End if
+
+			std::vector<uint32_t> cpus = parse_cpu_list(list);
+
+			if (!cpus.empty())
+			{
+				topo.numa_nodes.emplace_back(std::move(cpus));
+			}//End if
+		}//End for
+	}//End of probe_sysfs
+#endif
+
+#ifdef TPA_X86_64
+	/// <summary>
+	/// <para>Returns the associativity of an AMD L2 / L3 cache or TLB from the 4-bit encoding of CPUID 0x80000006, 0 = fully associative or unknown.</para>
+	/// </summary>
+	/// <param name="code"></param>
+	/// <returns></returns>
+	[[nodiscard]] inline size_t amd_ways(const uint32_t code) noexcept
+	{
+		constexpr std::array<size_t, 16> table = { 0uz, 1uz, 2uz, 3uz, 4uz, 6uz, 8uz, 0uz, 16uz, 0uz, 32uz, 48uz, 64uz, 96uz, 128uz, 0uz };
+
+		return table[code & 0xFu];
+	}//End of amd_ways
+
+	/// <summary>
+	/// <para>Fills in the caches from the deterministic cache parameters (leaf 0x00000004 on Intel, 0x8000001D on AMD) and the TLBs from leaf 0x00000018 (Intel) or 0x80000005 / 0x80000006 (AMD).</para>
+	/// <para>Caches are only filled in if the operating system did not report them, CPUID does not say which logical CPUs share an instance.</para>
+	/// </summary>
+	/// <param name="topo"></param>
+	inline void probe_cpuid(tpa::cpu::topology_info& topo)
+	{
+		std::array<int32_t, 4> cpui = {};
+
+		CPUID(cpui.data(), 0);
+		const uint32_t nIds = static_cast<uint32_t>(cpui[0]);
+
+		CPUID(cpui.data(), 0x80000000);
+		const uint32_t nExIds = static_cast<uint32_t>(cpui[0]);
+
+		bool topoext = false;
+
+		if (nExIds >= 0x80000001u)
+		{
+			CPUID(cpui.data(), 0x80000001);
+			topoext = ((static_cast<uint32_t>(cpui[2]) >> 22u) & 1u) != 0u;
+		}//End if
+
+		const bool intel = tpa::runtime_instruction_set.IsIntel();
+		const bool amd = tpa::runtime_instruction_set.IsAMD();
+
+		//Caches
+		if (topo.caches.empty() && ((intel && nIds >= 4u) || (amd && topoext && nExIds >= 0x8000001Du)))
+		{
+			const int32_t leaf = intel ? 4 : static_cast<int32_t>(0x8000001D);
+
+			for (int32_t sub = 0; sub != 16; ++sub)
+			{
+				CPUIDEX(cpui.data(), leaf, sub);
+
+				const uint32_t type = static_cast<uint32_t>(cpui[0]) & 0x1Fu;
+
+				if (type == 0u)//No more caches
+				{
+					break;
+				}//End if
+
+				tpa::cpu::cache c;
+				c.level = (static_cast<uint32_t>(cpui[0]) >> 5u) & 0x7u;
+				c.type = (type == 1u) ? tpa::cpu::cache_type::DATA : (type == 2u) ? tpa::cpu::cache_type::INSTRUCTION : tpa::cpu::cache_type::UNIFIED;
+				c.sharing = ((static_cast<uint32_t>(cpui[0]) >> 14u) & 0xFFFu) + 1uz;
+				c.line_size = (static_cast<uint32_t>(cpui[1]) & 0xFFFu) + 1uz;
+				c.sets = static_cast<uint32_t>(cpui[2]) + 1uz;
+
+				const bool fully_associative = ((static_cast<uint32_t>(cpui[0]) >> 9u) & 1u) != 0u;
+				const size_t ways = ((static_cast<uint32_t>(cpui[1]) >> 22u) & 0x3FFu) + 1uz;
+				const size_t partitions = ((static_cast<uint32_t>(cpui[1]) >> 12u) & 0x3FFu) + 1uz;
+
+				c.ways = fully_associative ? 0uz : ways;
+				c.size = ways * partitions * c.line_size * c.sets;
+
+				topo.caches.emplace_back(std::move(c));
+			}//End for
+		}//End if
+
+		//TLBs
+		if (intel && nIds >= 0x18u)
+		{
+			CPUIDEX(cpui.data(), 0x18, 0);
+			const uint32_t max_sub = static_cast<uint32_t>(cpui[0]);
+
+			for (uint32_t sub = 0u; sub <= max_sub; ++sub)
+			{
+				CPUIDEX(cpui.data(), 0x18, static_cast<int32_t>(sub));
+
+				const uint32_t edx = static_cast<uint32_t>(cpui[3]);
+				const uint32_t type = edx & 0x1Fu;
+
+				if (type == 0u)//Invalid sub-leaf
+				{
+					continue;
+				}//End if
+
+				const uint32_t ebx = static_cast<uint32_t>(cpui[1]);
+				const size_t ways = (ebx >> 16u) & 0xFFFFu;
+				const size_t sets = static_cast<uint32_t>(cpui[2]);
+				const bool fully_associative = ((edx >> 8u) & 1u) != 0u;
+
+				//1 = data, 2 = instruction, 3 = unified, 4 = load only, 5 = store only
+				const tpa::cpu::cache_type t = (type == 2u) ? tpa::cpu::cache_type::INSTRUCTION : (type == 3u) ? tpa::cpu::cache_type::UNIFIED : tpa::cpu::cache_type::DATA;
+
+				constexpr std::array<size_t, 4> page_sizes = { 4uz * 1024uz, 2uz * 1024uz * 1024uz, 4uz * 1024uz * 1024uz, 1024uz * 1024uz * 1024uz };
+
+				for (size_t p = 0uz; p != page_sizes.size(); ++p)
+				{
+					if (((ebx >> p) & 1u) != 0u)
+					{
+						topo.tlbs.push_back({ (edx >> 5u) & 0x7u, t, page_sizes[p], ways * sets, fully_associative ? 0uz : ways });
+					}//End if
+				}//End for
+			}//End for
+		}//End if
+		else if (amd && nExIds >= 0x80000006u)
+		{
+			constexpr size_t K4 = 4uz * 1024uz;
+			constexpr size_t M2 = 2uz * 1024uz * 1024uz;
+
+			CPUID(cpui.data(), 0x80000005);
+			const uint32_t l1_2m = static_cast<uint32_t>(cpui[0]);
+			const uint32_t l1_4k = static_cast<uint32_t>(cpui[1]);
+
+			//L1: 8-bit associativity (0xFF = fully associative) and 8-bit entry counts, data in the upper half
+			const auto l1_ways = [](const uint32_t code) noexcept { return (code == 0xFFu) ? 0uz : static_cast<size_t>(code); };
+
+			topo.tlbs.push_back({ 1u, tpa::cpu::cache_type::DATA, K4, (l1_4k >> 16u) & 0xFFu, l1_ways(l1_4k >> 24u) });
+			topo.tlbs.push_back({ 1u, tpa::cpu::cache_type::INSTRUCTION, K4, l1_4k & 0xFFu, l1_ways((l1_4k >> 8u) & 0xFFu) });
+			topo.tlbs.push_back({ 1u, tpa::cpu::cache_type::DATA, M2, (l1_2m >> 16u) & 0xFFu, l1_ways(l1_2m >> 24u) });
+			topo.tlbs.push_back({ 1u, tpa::cpu::cache_type::INSTRUCTION, M2, l1_2m & 0xFFu, l1_ways((l1_2m >> 8u) & 0xFFu) });
+
+			CPUID(cpui.data(), 0x80000006);
+			const uint32_t l2_2m = static_cast<uint32_t>(cpui[0]);
+			const uint32_t l2_4k = static_cast<uint32_t>(cpui[1]);
+
+			//L2: 4-bit encoded associativity and 12-bit entry counts, data in the upper half
+			topo.tlbs.push_back({ 2u, tpa::cpu::cache_type::DATA, K4, (l2_4k >> 16u) & 0xFFFu, amd_ways(l2_4k >> 28u) });
+			topo.tlbs.push_back({ 2u, tpa::cpu::cache_type::INSTRUCTION, K4, l2_4k & 0xFFFu, amd_ways(l2_4k >> 12u) });
+			topo.tlbs.push_back({ 2u, tpa::cpu::cache_type::DATA, M2, (l2_2m >> 16u) & 0xFFFu, amd_ways(l2_2m >> 28u) });
+			topo.tlbs.push_back({ 2u, tpa::cpu::cache_type::INSTRUCTION, M2, l2_2m & 0xFFFu, amd_ways(l2_2m >> 12u) });
+
+			std::erase_if(topo.tlbs, [](const tpa::cpu::tlb& t) { return t.entries == 0uz; });
+		}//End if
+
+		std::stable_sort(topo.tlbs.begin(), topo.tlbs.end(), [](const tpa::cpu::tlb& a, const tpa::cpu::tlb& b) { return a.level < b.level; });
+
+		//SMT siblings, assumes the operating system numbers the siblings of a core next to each other
+		if (topo.cores.empty() && nIds >= 0xBu)
+		{
+			CPUIDEX(cpui.data(), 0xB, 0);
+			const uint32_t per_core = static_cast<uint32_t>(cpui[1]) & 0xFFFFu;
+
+			if (per_core != 0u && topo.logical_cpus != 0u)
+			{
+				for (uint32_t cpu = 0u; cpu < topo.logical_cpus; cpu += per_core)
+				{
+					std::vector<uint32_t> core;
+
+					for (uint32_t s = cpu; s != cpu + per_core && s != topo.logical_cpus; ++s)
+					{
+						core.push_back(s);
+					}//End for
+
+					topo.cores.emplace_back(std::move(core));
+				}//End for
+			}//End if
+		}//End if
+	}//End of probe_cpuid
+#endif
+
+	/// <summary>
+	/// <para>Probes the topology, the operating system first then CPUID for anything it did not report.</para>
+	/// </summary>
+	/// <returns></returns>
+	[[nodiscard]] inline tpa::cpu::topology_info probe()
+	{
+		tpa::cpu::topology_info topo;
+
+#ifdef __linux__
+		probe_sysfs(topo);
+#endif
+
+		if (topo.logical_cpus == 0u)
+		{
+			topo.logical_cpus = std::thread::hardware_concurrency();
+		}//End if
+
+#ifdef TPA_X86_64
+		probe_cpuid(topo);
+#endif
+
+		sort_caches(topo.caches);
+
+		//Without SMT information every logical CPU is its own core
+		if (topo.cores.empty())
+		{
+			for (uint32_t cpu = 0u; cpu != topo.logical_cpus; ++cpu)
+			{
+				topo.cores.push_back({ cpu });
+			}//End for
+		}//End if
+
+		//Without NUMA information every logical CPU is on one node
+		if (topo.numa_nodes.empty())
+		{
+			topo.numa_nodes.emplace_back();
+
+			for (uint32_t cpu = 0u; cpu != topo.logical_cpus; ++cpu)
+			{
+				topo.numa_nodes.front().push_back(cpu);
+			}//End for
+		}//End if
+
+		return topo;
+	}//End of probe
+}//End of namespace
+
+namespace tpa::cpu {
+
+	/// <summary>
+	/// <para>Returns the cache levels, TLBs, SMT siblings and NUMA nodes of this machine.</para>
+	/// <para>Probed once on first use from /sys/devices/system/cpu on Linux and CPUID on x86-64, whatever neither reports is left empty (or 0).</para>
+	/// </summary>
+	/// <returns></returns>
+	[[nodiscard]] inline const topology_info& topology()
+	{
+		//Built on first use, not per call
+		static const topology_info topo = tpa_topology_private::probe();
+
+		return topo;
+	}//End of topology
+
+	/// <summary>
+	/// <para>Prints tpa::cpu::topology() to the console.</para>
+	/// </summary>
+	inline void output_topology()
+	{
+		const topology_info& topo = topology();
+
+		constexpr std::array<const char*, 3> type_names = { "Data", "Instruction", "Unified" };
+
+		std::cout << "CPU Topology\n";
+		std::cout << "-----------------------------\n";
+
+		std::cout << std::left << std::setw(21) << "Logical CPUs: " << topo.logical_cpus << "\n";
+		std::cout << std::left << std::setw(21) << "Physical Cores: " << topo.cores.size() << "\n";
+		std::cout << std::left << std::setw(21) << "NUMA Nodes: " << topo.numa_nodes.size() << "\n";
+
+		for (const cache& c : topo.caches)
+		{
+			std::cout << "L" << c.level << " " << std::left << std::setw(12) << type_names[static_cast<size_t>(c.type)] <<
+				std::setw(10) << (std::to_string(c.size / 1024uz) + "K") <<
+				std::setw(10) << (std::to_string(c.ways) + "-way") <<
+				std::setw(12) << (std::to_string(c.line_size) + "B lines") <<
+				"shared by " << c.sharing << " x " << c.instances.size() << "\n";
+		}//End for
+
+		for (const tlb& t : topo.tlbs)
+		{
+			std::cout << "L" << t.level << " TLB " << std::left << std::setw(12) << type_names[static_cast<size_t>(t.type)] <<
+				std::setw(10) << (std::to_string(t.page_size / 1024uz) + "K pages") <<
+				t.entries << " entries\n";
+		}//End for
+	}//End of output_topology
+}//End of namespace
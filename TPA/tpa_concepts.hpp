@@ -48,6 +48,35 @@ namespace tpa::util {
 		std::contiguous_iterator<ITER>;
 	};
 
+	/// <summary>
+	/// <para>Returns the alignment in bytes which the data() of CONT is guaranteed to have.</para>
+	/// <para>Read from CONT::alignment (e.g. tpa::buffer) or CONT::allocator_type::alignment (e.g. tpa::aligned_allocator), otherwise alignof(value_type).</para>
+	/// </summary>
+	template<typename CONT>
+	[[nodiscard]] consteval std::size_t container_alignment() noexcept
+	{
+		if constexpr (requires { {CONT::alignment} -> std::convertible_to<std::size_t>; })
+		{
+			return CONT::alignment;
+		}//End if
+		else if constexpr (requires { {CONT::allocator_type::alignment} -> std::convertible_to<std::size_t>; })
+		{
+			return CONT::allocator_type::alignment;
+		}//End if
+		else
+		{
+			return alignof(typename CONT::value_type);
+		}//End else
+	}//End of container_alignment
+
+	template<typename CONT>
+	/// <summary>
+	/// <para> concept aligned_sequence requires: </para>
+	/// <para> CONT satisfies contiguous_seqeunce </para>
+	/// <para> data() is guaranteed to be aligned to at least 64 bytes (1 cache line), see container_alignment </para>
+	/// </summary>
+	concept aligned_sequence = contiguous_seqeunce<CONT> && (container_alignment<CONT>() >= 64uz);
+
 	template<typename T>
 	/// <summary>
 	/// <para>Concept calculatable requires: </para>
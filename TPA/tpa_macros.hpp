@@ -65,6 +65,10 @@
 #elif defined(__aarch64__)
 #define TPA_ARM //ARM 32 / ARM 64 Architecture
 #include "arm_neon.h"
+#if defined(__ARM_FEATURE_SVE) && defined(TPA_EXPERIMENTAL_NEON)
+#define TPA_SVE //ARM Scalable Vector Extension, only when compiling for it (e.g. -march=armv8.2-a+sve)
+#include <arm_sve.h>
+#endif
 #elif defined(__IA64__)
 #define TPA_IT_64	//Intel Itanium 64 Architecture 
 #include "ia64intrin.h"
@@ -88,6 +92,10 @@
 #elif defined(__aarch64__)
 #define TPA_ARM //ARM 32 / ARM 64 Architecture
 #include "arm_neon.h"
+#if defined(__ARM_FEATURE_SVE) && defined(TPA_EXPERIMENTAL_NEON)
+#define TPA_SVE //ARM Scalable Vector Extension, only when compiling for it (e.g. -march=armv8.2-a+sve)
+#include <arm_sve.h>
+#endif
 #elif defined(__IA64__)
 #define TPA_IT_64	//Intel Itanium 64 Architecture 
 #include "ia64intrin.h"
@@ -127,3 +135,66 @@
 #warning("TPA Warning : This compiler may not be supported by the TPA library..")
 #warning("TPA Warning : TPA may not support this architecture.")
 #endif
+
+/*
+* The NEON and SVE kernels have not been verified on ARM hardware or under emulation yet.
+* Define TPA_EXPERIMENTAL_NEON before including TPA to compile them, otherwise ARM builds use the scalar kernels.
+*/
+#if defined(TPA_ARM) && defined(TPA_EXPERIMENTAL_NEON)
+#define TPA_NEON //NEON kernels (and SVE kernels when TPA_SVE is defined)
+#endif
+
+/*
+* TPA TARGET MACROS
+* Compiles a single function for a specific instruction set so that one binary can carry kernels for several ISAs,
+* the kernel to run is chosen once at runtime (see tpa::simd::kernel_table in simd/dispatch.hpp).
+* MSVC and the Intel compiler make every intrinsic available without per-function targets so these expand to nothing.
+* TPA_TARGET(isa) takes a list of extensions, it is used for the runtime checked blocks (if (tpa::hasAVX2) {...}) of the older functions.
+* TPA_TARGET_REGION_BEGIN(isa) and TPA_TARGET_REGION_END apply a target to every function defined between them.
+* TPA_FORCE_INLINE marks generic helpers shared by the kernels of several ISAs, they are always inlined into and compiled for the calling kernel.
+* TPA_FLATTEN marks kernels which call a user supplied operation, which is then inlined into and compiled for the kernel as well.
+*/
+#if (defined(__GNUC__) || defined(__clang__)) && defined(TPA_X86_64) && !defined(__INTEL_COMPILER)
+#define TPA_ISA_SSE41 "sse4.1,sse4.2,popcnt"
+#define TPA_ISA_AVX2 "avx,avx2,fma,bmi,bmi2,lzcnt,popcnt"
+#define TPA_ISA_AVX512 "avx512f,avx512bw,avx512dq,avx512vl,avx,avx2,fma,bmi,bmi2,lzcnt,popcnt"
+#define TPA_TARGET(isa) __attribute__((target(isa)))
+#define TPA_TARGET_SSE41 TPA_TARGET(TPA_ISA_SSE41)
+#define TPA_TARGET_AVX TPA_TARGET("avx")
+#define TPA_TARGET_AVX2 TPA_TARGET(TPA_ISA_AVX2)
+#define TPA_TARGET_AVX512 TPA_TARGET(TPA_ISA_AVX512)
+#define TPA_FORCE_INLINE __attribute__((always_inline)) inline
+#define TPA_FLATTEN __attribute__((flatten))
+#define TPA_PRAGMA(x) _Pragma(#x)
+#if defined(__clang__)
+#define TPA_TARGET_REGION_BEGIN(isa) TPA_PRAGMA(clang attribute push(__attribute__((target(isa))), apply_to = function))
+#define TPA_TARGET_REGION_END TPA_PRAGMA(clang attribute pop)
+#else
+#define TPA_TARGET_REGION_BEGIN(isa) TPA_PRAGMA(GCC push_options) TPA_PRAGMA(GCC target(isa))
+#define TPA_TARGET_REGION_END TPA_PRAGMA(GCC pop_options)
+#endif
+#else
+#define TPA_TARGET(isa)
+#define TPA_TARGET_SSE41
+#define TPA_TARGET_AVX
+#define TPA_TARGET_AVX2
+#define TPA_TARGET_AVX512
+#define TPA_FORCE_INLINE inline
+#define TPA_FLATTEN
+#define TPA_TARGET_REGION_BEGIN(isa)
+#define TPA_TARGET_REGION_END
+#endif
+
+/*
+* TPA TUNING MACROS
+* Define before including TPA to change them, both are compile-time only.
+* TPA_UNROLL - Number of independent vectors (or accumulators) each SIMD block loop keeps in flight per iteration, 1 disables unrolling.
+* TPA_PREFETCH_DISTANCE - How many bytes ahead of the current element the SIMD block loops prefetch the source data, 0 disables software prefetching.
+*/
+#ifndef TPA_UNROLL
+#define TPA_UNROLL 4
+#endif
+
+#ifndef TPA_PREFETCH_DISTANCE
+#define TPA_PREFETCH_DISTANCE 512
+#endif
@@ -31,21 +31,37 @@
 #include "size_t_lit.hpp"			//std::size_t literal suffix before C++23
 
 #include "InstructionSet.hpp"		//CPUID
+#include "topology.hpp"			//Cache, TLB, SMT & NUMA topology
+#include "buffer.hpp"			//Aligned allocator & huge page backed buffer
 
 #include "numeric/iota.hpp"			//iota
 #include "numeric/accumulate.hpp"	//accumulate
+#include "numeric/inner_product.hpp"//inner_product
 
 #include "algorithm/copy.hpp"		//copy
 #include "algorithm/copy_if.hpp"	//copy_if
+#include "algorithm/remove_if.hpp"	//remove_if
+#include "algorithm/partition_copy.hpp"//partition_copy
 #include "algorithm/fill.hpp"		//fill
 #include "algorithm/generate.hpp"	//generate
 #include "algorithm/min_element.hpp"//min_element
 #include "algorithm/max_element.hpp"//max_element
 #include "algorithm/minmax_element.hpp"//minmax_element
+#include "algorithm/argminmax.hpp"//argmin, argmax
 #include "algorithm/count.hpp"		//count
 #include "algorithm/count_if.hpp"	//count_if
+#include "algorithm/transform.hpp"	//transform
+#include "algorithm/sort.hpp"		//sort, sort_by_key, argsort
+#include "algorithm/is_sorted.hpp"	//is_sorted
+#include "algorithm/nth_element.hpp"//nth_element, partial_sort
+#include "algorithm/top_k.hpp"		//top_k
+#include "algorithm/merge.hpp"		//merge, multiway_merge
+#include "algorithm/find.hpp"		//find, find_if, any_of, all_of, none_of
+#include "algorithm/lower_bound.hpp"		//lower_bound_batch
 
 #include "simd/simd.hpp"			//SIMD Utility Functions
+#include "simd/vec.hpp"				//Portable SIMD vector type
+#include "simd/dispatch.hpp"			//Runtime kernel selection (kernel_table)
 #include "simd/basic_math.hpp"		//Basic Math
 #include "simd/fma.hpp"				//FMA
 #include "simd/trigonometry.hpp"	//Trigonometry
@@ -56,3 +72,4 @@
 #include "simd/logarithm.hpp"		//log, log2, log10, loglp, logb
 #include "simd/convert.hpp"			//static_cast
 #include "simd/stat.hpp"			//Statistical Functions (mean, median, mode... etc.)
+#include "simd/expression.hpp"		//Lazy fused expressions (expr, evaluate)
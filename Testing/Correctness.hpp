@@ -0,0 +1,217 @@
+#pragma once
+/*
+* Correctness checks of TPA algorithms against the standard library
+* Run at the start of the testing application, compiled for whatever -march / /arch the application is built with
+*/
+
+/*
+*           Copyright David Aaron Braun 2021 - .
+*   Distributed under the Boost Software License, Version 1.0.
+*       (See accompanying file LICENSE_1_0.txt or copy at
+*           https://www.boost.org/LICENSE_1_0.txt)
+*/
+#include <iostream>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../TPA/tpa_main.hpp"
+
+namespace correctness {
+
+	/// <summary>
+	/// <para>Prints the result of a check and counts the failures.</para>
+	/// </summary>
+	inline size_t failures = 0uz;
+
+	inline void check(const bool passed, const std::string& name)
+	{
+		if (!passed)
+		{
+			++failures;
+		}//End if
+
+		std::cout << (passed ? "PASS: " : "FAIL: ") << name << "\n";
+	}//End of check
+
+	/// <summary>
+	/// <para>Returns 'n' random values in [lo, hi].</para>
+	/// </summary>
+	template<typename T>
+	[[nodiscard]] inline std::vector<T> random_values(const size_t n, const T lo, const T hi, const uint32_t seed)
+	{
+		std::mt19937_64 gen(seed);
+		std::vector<T> v(n);
+
+		if constexpr (std::is_floating_point<T>::value)
+		{
+			std::uniform_real_distribution<T> dist(lo, hi);
+			std::generate(v.begin(), v.end(), [&]() { return dist(gen); });
+		}//End if
+		else
+		{
+			std::uniform_int_distribution<int64_t> dist(static_cast<int64_t>(lo), static_cast<int64_t>(hi));
+			std::generate(v.begin(), v.end(), [&]() { return static_cast<T>(dist(gen)); });
+		}//End else
+
+		return v;
+	}//End of random_values
+
+	/// <summary>
+	/// <para>Returns true if 'result' holds the same elements as 'input'.</para>
+	/// </summary>
+	template<typename T>
+	[[nodiscard]] inline bool is_permutation(const std::vector<T>& input, std::vector<T> result)
+	{
+		std::vector<T> expected = input;
+
+		std::sort(expected.begin(), expected.end());
+		std::sort(result.begin(), result.end());
+
+		return expected == result;
+	}//End of is_permutation
+
+	/// <summary>
+	/// <para>nth_element and partial_sort must rearrange the input and partition it around 'nth' / sort its first 'count' elements.</para>
+	/// </summary>
+	template<typename T>
+	inline void nth_element_partial_sort(const std::vector<T>& input, const size_t nth, const std::string& name)
+	{
+		std::vector<T> sorted = input;
+		std::sort(sorted.begin(), sorted.end());
+
+		std::vector<T> a = input;
+		tpa::nth_element(a, nth);
+
+		bool partitioned = (a[nth] == sorted[nth]);
+		for (size_t i = 0uz; i != a.size(); ++i)
+		{
+			partitioned &= (i < nth) ? !(a[nth] < a[i]) : !(a[i] < a[nth]);
+		}//End for
+
+		check(is_permutation(input, a) && partitioned, "nth_element " + name + " n = " + std::to_string(input.size()) + " nth = " + std::to_string(nth));
+
+		std::vector<T> b = input;
+		tpa::partial_sort(b, nth + 1uz);
+
+		check(is_permutation(input, b) && std::equal(b.begin(), b.begin() + nth + 1uz, sorted.begin()),
+			"partial_sort " + name + " n = " + std::to_string(input.size()) + " count = " + std::to_string(nth + 1uz));
+	}//End of nth_element_partial_sort
+
+	/// <summary>
+	/// <para>top_k must return the 'k' largest values in descending order, each with the index of an element holding it.</para>
+	/// </summary>
+	template<typename T>
+	inline void top_k(const std::vector<T>& input, const size_t k, const std::string& name)
+	{
+		std::vector<T> sorted = input;
+		std::sort(sorted.begin(), sorted.end(), std::greater<T>());
+
+		std::vector<T> values(k);
+		std::vector<size_t> indices(k);
+
+		const size_t written = tpa::top_k(input, k, values, indices);
+
+		bool passed = (written == k) && std::equal(values.begin(), values.end(), sorted.begin());
+		for (size_t i = 0uz; passed && i != k; ++i)
+		{
+			passed = indices[i] < input.size() && input[indices[i]] == values[i];
+		}//End for
+
+		check(passed, "top_k " + name + " n = " + std::to_string(input.size()) + " k = " + std::to_string(k));
+	}//End of top_k
+
+	/// <summary>
+	/// <para>transform with a generic lambda must match the same lambda applied to each element.</para>
+	/// </summary>
+	template<typename T>
+	inline void transform(const size_t n, const std::string& name)
+	{
+		const std::vector<T> input = random_values<T>(n, T(-1000), T(1000), 7u);
+		std::vector<T> output(n);
+
+		tpa::transform(input, output, [](const auto x) { return x + x; });
+
+		bool passed = true;
+		for (size_t i = 0uz; i != n; ++i)
+		{
+			passed &= (output[i] == static_cast<T>(input[i] + input[i]));
+		}//End for
+
+		check(passed, "transform x + x " + name + " n = " + std::to_string(n));
+	}//End of transform
+
+	/// <summary>
+	/// <para>Predicate find_if, any_of, all_of and none_of must agree with their std counterparts.</para>
+	/// </summary>
+	template<typename T>
+	inline void find_if(const std::vector<T>& input, const T threshold, const std::string& name)
+	{
+		const auto pred = [threshold](const auto x) { return x > decltype(x)(threshold); };
+		const auto std_pred = [threshold](const T x) { return x > threshold; };
+
+		const size_t expected = static_cast<size_t>(std::find_if(input.begin(), input.end(), std_pred) - input.begin());
+		const std::string suffix = name + " n = " + std::to_string(input.size()) + " > " + std::to_string(threshold);
+
+		check(tpa::find_if(input, pred) == expected, "find_if " + suffix);
+		check(tpa::any_of(input, pred) == std::any_of(input.begin(), input.end(), std_pred), "any_of " + suffix);
+		check(tpa::all_of(input, pred) == std::all_of(input.begin(), input.end(), std_pred), "all_of " + suffix);
+		check(tpa::none_of(input, pred) == std::none_of(input.begin(), input.end(), std_pred), "none_of " + suffix);
+	}//End of find_if
+
+	/// <summary>
+	/// <para>Runs every check, returns the number of failures.</para>
+	/// </summary>
+	inline size_t run_all()
+	{
+		failures = 0uz;
+
+		//nth_element, partial_sort
+		const std::vector<int32_t> small = { 40, 2, 21, 42, 16, 50, 93, 46, 4, 23, 76, 74, 52, 29, 54, 18, 96, 87, 3, 37 };
+		nth_element_partial_sort(small, 6uz, "int32_t");
+
+		for (const size_t n : { 1'000uz, 100'000uz, 1'000'000uz })
+		{
+			nth_element_partial_sort(random_values<int32_t>(n, -1'000'000, 1'000'000, 1u), n / 3uz, "int32_t");
+			nth_element_partial_sort(random_values<uint8_t>(n, 0, 255, 2u), n / 2uz, "uint8_t");
+			nth_element_partial_sort(random_values<int64_t>(n, -1'000, 1'000, 3u), n - 1uz, "int64_t");
+			nth_element_partial_sort(random_values<float>(n, -1.0f, 1.0f, 4u), 10uz, "float");
+			nth_element_partial_sort(random_values<double>(n, -1.0, 1.0, 5u), n / 4uz, "double");
+		}//End for
+
+		//top_k
+		top_k(small, 5uz, "int32_t");
+		top_k(random_values<int32_t>(1'000'000uz, -1'000'000, 1'000'000, 6u), 100uz, "int32_t");
+		top_k(random_values<float>(1'000'000uz, -1.0f, 1.0f, 7u), 1'000uz, "float");
+		top_k(random_values<uint16_t>(100'000uz, 0, 65535, 8u), 10uz, "uint16_t");
+
+		//transform
+		for (const size_t n : { 3uz, 100uz, 1'000'000uz })
+		{
+			transform<int32_t>(n, "int32_t");
+			transform<int16_t>(n, "int16_t");
+			transform<int64_t>(n, "int64_t");
+			transform<float>(n, "float");
+			transform<double>(n, "double");
+		}//End for
+
+		//find_if, any_of, all_of, none_of
+		const std::vector<int32_t> few = { 5, 3, 9, 3, 7, 1, 8, 3, 2, 0, 4, 6, 3, 3, 11, 12, 13 };
+		find_if(few, 10, "int32_t");
+		find_if(few, -1, "int32_t");
+		find_if(few, 13, "int32_t");
+
+		std::vector<int32_t> many = random_values<int32_t>(1'000'000uz, 0, 1'000, 9u);
+		many[777'777uz] = 5'000;
+		find_if(many, 1'000, "int32_t");
+		find_if(many, 5'000, "int32_t");
+		find_if(random_values<uint8_t>(100'000uz, 0, 200, 10u), uint8_t(199), "uint8_t");
+		find_if(random_values<double>(100'000uz, 0.0, 1.0, 11u), 0.99999, "double");
+
+		std::cout << failures << " correctness check(s) failed\n\n";
+
+		return failures;
+	}//End of run_all
+}//End of namespace
@@ -33,6 +33,7 @@
 //#include <boost/multiprecision/cpp_bin_float.hpp>
 
 #include "../TPA/tpa_main.hpp"
+#include "Correctness.hpp"
 
 using numtype = int64_t;//boost::multiprecision::cpp_bin_float_oct;
 using returnType = int64_t;//boost::multiprecision::cpp_bin_float_oct; 
@@ -65,6 +66,9 @@ int main()
 	    //vec3.resize(1'000'000'000);
 
 		tpa::runtime_instruction_set.output_CPU_info();	
+		tpa::cpu::output_topology();
+
+		correctness::run_all();
 
 		//Generate	
 		/*
@@ -183,6 +187,165 @@ int main()
 				"\n";
 		}//End for
 
+		//Unroll & prefetch policy at L2, LLC and DRAM resident sizes
+		//Rebuild with a different TPA_UNROLL / TPA_PREFETCH_DISTANCE (e.g. 1 / 0) to see what each adds
+		std::cout << "TPA_UNROLL = " << TPA_UNROLL << ", TPA_PREFETCH_DISTANCE = " << TPA_PREFETCH_DISTANCE << "\n";
+		{
+			const std::array<std::pair<const char*, size_t>, 3> working_sets = { {
+				{ "L2", (tpa::cpu::topology().data_cache(2u) != nullptr) ? tpa::cpu::topology().data_cache(2u)->size / 2uz : 0uz },
+				{ "LLC", (tpa::cpu::topology().last_level_cache() != nullptr) ? tpa::cpu::topology().last_level_cache()->size / 2uz : 0uz },
+				{ "DRAM", (tpa::cpu::topology().last_level_cache() != nullptr) ? tpa::cpu::topology().last_level_cache()->size * 8uz : 0uz } } };
+
+			for (const auto& [level, bytes] : working_sets)
+			{
+				if (bytes == 0uz)
+				{
+					continue;
+				}//End if
+
+				//Three arrays share the working set, repeat so that every size moves ~1 GiB in total
+				const size_t n = bytes / (3uz * sizeof(float));
+				const size_t reps = tpa::util::max(1uz, (1uz << 30) / bytes);
+
+				std::vector<float> a(n, 1.5f);
+				std::vector<float> b(n, 2.5f);
+				std::vector<float> c(n);
+
+				std::cout << "TPA transform " << level << " (" << n << " x " << reps << "): ";
+				{
+					tpa::util::Timer t;
+
+					for (size_t r = 0uz; r != reps; ++r)
+					{
+						tpa::transform(a, b, c, [](const auto& x, const auto& y) { return x * y + x; });
+					}//End for
+				}
+
+				std::cout << "TPA evaluate " << level << " (" << n << " x " << reps << "): ";
+				{
+					tpa::util::Timer t;
+
+					for (size_t r = 0uz; r != reps; ++r)
+					{
+						tpa::evaluate(tpa::expr(a) * b + a, c);
+					}//End for
+				}
+			}//End for
+		}
+
+		//Radix sort against std::sort on the same random data
+		{
+			std::vector<int64_t> keys(vec.size());
+			std::mt19937_64 gen(42);
+			std::generate(keys.begin(), keys.end(), [&gen]() { return static_cast<int64_t>(gen()); });
+
+			std::vector<int64_t> keys2 = keys;
+
+			std::cout << "TPA sort: ";
+			{
+				tpa::util::Timer t;
+				tpa::sort(keys);
+			}
+
+			std::cout << "std::sort par_unseq: ";
+			{
+				tpa::util::Timer t;
+				std::sort(std::execution::par_unseq, keys2.begin(), keys2.end());
+			}
+
+			std::cout << "Sorted arrays equal: " << std::boolalpha << (keys == keys2) << "\n";
+
+			std::cout << "TPA is_sorted: ";
+			{
+				tpa::util::Timer t;
+				std::cout << std::boolalpha << tpa::is_sorted(keys) << "\n";
+			}
+
+			std::vector<int64_t> merged(keys.size() + keys2.size());
+
+			std::cout << "TPA merge: ";
+			{
+				tpa::util::Timer t;
+				tpa::merge(keys, keys2, merged);
+			}
+
+			std::cout << "std::merge par_unseq: ";
+			{
+				tpa::util::Timer t;
+				std::merge(std::execution::par_unseq, keys.begin(), keys.end(), keys2.begin(), keys2.end(), merged.begin());
+			}
+
+			//Look up every random value in the sorted keys
+			std::vector<size_t> found(vec.size());
+
+			std::cout << "TPA lower_bound_batch: ";
+			{
+				tpa::util::Timer t;
+				tpa::lower_bound_batch(keys, vec, found);
+			}
+
+			std::cout << "std::lower_bound par_unseq: ";
+			{
+				tpa::util::Timer t;
+				std::transform(std::execution::par_unseq, vec.begin(), vec.end(), found.begin(), [&keys](const numtype x)
+					{
+						return static_cast<size_t>(std::lower_bound(keys.begin(), keys.end(), x) - keys.begin());
+					});
+			}
+		}
+
+		//Top 1000 of the random data, without and with a copy
+		{
+			constexpr size_t k = 1000uz;
+
+			std::vector<numtype> top_values(k);
+			std::vector<size_t> top_indices(k);
+
+			std::cout << "TPA top_k: ";
+			{
+				tpa::util::Timer t;
+				tpa::top_k(vec, k, top_values, top_indices);
+			}
+
+			std::vector<numtype> copy;
+
+			std::cout << "Copy + std::partial_sort: ";
+			{
+				tpa::util::Timer t;
+				copy = vec;
+				std::partial_sort(std::execution::par_unseq, copy.begin(), copy.begin() + k, copy.end(), std::greater<numtype>());
+			}
+
+			std::cout << "Top values equal: " << std::boolalpha << std::equal(top_values.begin(), top_values.end(), copy.begin()) << "\n";
+		}
+
+		//Search for a value placed at the back, every element has to be read
+		{
+			const numtype needle = std::numeric_limits<numtype>::max();
+			const numtype last = vec.back();
+			vec.back() = needle;
+
+			std::cout << "TPA find: ";
+			{
+				tpa::util::Timer t;
+				std::cout << tpa::find(vec, needle) << "\n";
+			}
+
+			std::cout << "std::find par_unseq: ";
+			{
+				tpa::util::Timer t;
+				std::cout << (std::find(std::execution::par_unseq, vec.begin(), vec.end(), needle) - vec.begin()) << "\n";
+			}
+
+			std::cout << "TPA any_of: ";
+			{
+				tpa::util::Timer t;
+				std::cout << std::boolalpha << tpa::any_of<tpa::cond::EQUAL_TO>(vec, needle) << "\n";
+			}
+
+			vec.back() = last;
+		}
+
 		std::cout << "End of Benchmark.\n";
 		
 		return EXIT_SUCCESS;